@@ -0,0 +1,135 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "ta_defs.h"
+#include "ta_registry.h"
+#include "ta_stream.h"
+
+/* This header contains the adapters between the Apache Arrow C data
+ * interface and the TA functions.
+ *
+ * Only the structs of the interface are needed (they are defined
+ * below when the producer did not include them already), not the
+ * Arrow library:
+ *     https://arrow.apache.org/docs/format/CDataInterface.html
+ *
+ * The input is a record batch (a struct array, format "+s") and the
+ * columns are found by their name: by default "open", "high", "low",
+ * "close" and "volume" for the inputs of these types, and "close" for
+ * the other inputs (inReal...). The input of a function with one
+ * input (or of a stream other than ATR and ADX) can also be a single
+ * column.
+ *
+ * A float64 column ("g") is used without copy, with its offset. The
+ * float32 ("f"), int32 ("i") and int64 ("l") columns are converted in
+ * a temporary buffer. A column (or a row of the batch) with a null is
+ * refused with TA_BAD_PARAM.
+ *
+ * Each output is a new array of the length of the batch, float64
+ * ("g") or int32 ("i") for the integer outputs. The bars without
+ * value (the lookback) are null in the validity bitmap; when all the
+ * bars have a value there is no bitmap. The consumer calls the
+ * release callback of each output (and of its schema) when done; the
+ * memory comes from the allocator of TA-Lib (TA_SetAllocator).
+ *
+ * Example, BBANDS of a record batch received from Arrow:
+ *     struct ArrowArray out[3];
+ *     struct ArrowSchema outSchema[3];
+ *     double optIn[4] = { 20, 2.0, 2.0, TA_MAType_SMA };
+ *
+ *     retCode = TA_ArrowCall( TA_FuncFind( "BBANDS" ), optIn,
+ *                             &schema, &batch, NULL, out, outSchema );
+ *     ... import out[i]/outSchema[i] in Arrow, which releases them ...
+ *
+ * A chunked array (or a table made of several record batches) is
+ * processed chunk by chunk with a TA_StreamState: the state carries
+ * the indicator from a chunk to the next one, and the values of all
+ * the chunks are identical to TA_StreamRun() on all the bars.
+ *
+ *     TA_StreamInit( &state, TA_STREAM_ATR, 14 );
+ *     for each batch
+ *        retCode = TA_ArrowStreamRun( &state, &schema, &batch, NULL,
+ *                                     &out, &outSchema );
+ *     TA_StreamFree( &state );
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+struct ArrowSchema {
+  /* Array type description */
+  const char* format;
+  const char* name;
+  const char* metadata;
+  int64_t flags;
+  int64_t n_children;
+  struct ArrowSchema** children;
+  struct ArrowSchema* dictionary;
+
+  /* Release callback */
+  void (*release)(struct ArrowSchema*);
+  /* Opaque producer-specific data */
+  void* private_data;
+};
+
+struct ArrowArray {
+  /* Array data description */
+  int64_t length;
+  int64_t null_count;
+  int64_t offset;
+  int64_t n_buffers;
+  int64_t n_children;
+  const void** buffers;
+  struct ArrowArray** children;
+  struct ArrowArray* dictionary;
+
+  /* Release callback */
+  void (*release)(struct ArrowArray*);
+  /* Opaque producer-specific data */
+  void* private_data;
+};
+
+#endif /* ARROW_C_DATA_INTERFACE */
+
+/* Calculate a function of the registry on all the rows of a batch.
+ *
+ * columns[i] is the name of the column of the input i of the
+ * function, NULL (or columns NULL) for the default. outArrays and
+ * outSchemas (which can be NULL) must hold func->nbOutput elements.
+ * On error, nothing is allocated and the release callbacks of the
+ * outputs are NULL.
+ */
+TA_RetCode TA_ArrowCall( const TA_FuncDef         *func,
+                         const double              optIn[],
+                         const struct ArrowSchema *schema,
+                         const struct ArrowArray  *batch,
+                         const char *const         columns[],
+                         struct ArrowArray         outArrays[],
+                         struct ArrowSchema        outSchemas[] );
+
+/* Consume the rows of a batch with the state (see TA_StreamRun).
+ *
+ * columns is { high, low, close }, NULL (or an element NULL) for the
+ * default names. The single input functions only need the close. The
+ * output has the rows of the batch, null while the state is within
+ * its lookback.
+ */
+TA_RetCode TA_ArrowStreamRun( TA_StreamState           *state,
+                              const struct ArrowSchema *schema,
+                              const struct ArrowArray  *batch,
+                              const char *const         columns[],
+                              struct ArrowArray        *outArray,
+                              struct ArrowSchema       *outSchema );
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,152 @@
+#pragma once
+
+#include "ta_defs.h"
+
+/* This header contains the columnar OHLCV file format and the
+ * memory-mapped loader.
+ *
+ * A columnar file holds the price bars of one or more symbols. Each
+ * column of a symbol is stored contiguously and starts on a 64 bytes
+ * boundary, so once the file is mapped in memory the columns can be
+ * passed as-is (zero-copy) to any TA function.
+ *
+ * Example:
+ *     TA_ColFile *file;
+ *     TA_ColSeries series;
+ *
+ *     retCode = TA_ColFileOpen( "universe.tacol", &file );
+ *     ...
+ *     retCode = TA_ColFileFindSeries( file, "MSFT", &series );
+ *     ...
+ *     retCode = TA_SMA( 0, series.nbBars-1, series.close, 20,
+ *                       &outBegIdx, &outNBElement, outReal );
+ *     ...
+ *     TA_ColFileClose( file );
+ *
+ * The pointers in a TA_ColSeries are valid until TA_ColFileClose().
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* File layout (version 1)
+ * -----------------------
+ * All integers and doubles are little-endian.
+ *
+ *    Offset  Size  Description
+ *    ------  ----  ---------------------------------------------
+ *         0     8  Magic "TACOLUMN"
+ *         8     4  Version (TA_COL_VERSION)
+ *        12     4  Header size in bytes (TA_COL_HEADER_SIZE)
+ *        16     4  Number of symbols
+ *        20     4  Flags (reserved, must be zero)
+ *        24     8  Offset of the symbol table
+ *        32     8  Total size of the file in bytes
+ *        40    24  Reserved (zero)
+ *
+ * The symbol table is an array of TA_ColSymbolEntry (128 bytes each).
+ * Each entry gives the name of the symbol, its number of bars and the
+ * offset of every column (zero when the column is absent).
+ *
+ * Every column offset is a multiple of TA_COL_ALIGNMENT. The
+ * open/high/low/close/volume columns are arrays of double, the
+ * timestamp column is an array of Int64 (unit defined by the producer,
+ * ta_csv2col writes seconds since 1970-01-01 UTC).
+ */
+#define TA_COL_MAGIC        "TACOLUMN"
+#define TA_COL_VERSION      1
+#define TA_COL_HEADER_SIZE  64
+#define TA_COL_ALIGNMENT    64
+#define TA_COL_SYMBOL_LEN   56
+
+typedef enum {
+   TA_COL_OPEN,
+   TA_COL_HIGH,
+   TA_COL_LOW,
+   TA_COL_CLOSE,
+   TA_COL_VOLUME,
+   TA_COL_TIMESTAMP,
+   TA_COL_NB_COLUMN
+} TA_ColumnId;
+
+typedef struct {
+   char   magic[8];
+   UInt32 version;
+   UInt32 headerSize;
+   UInt32 nbSymbols;
+   UInt32 flags;
+   UInt64 symbolTableOffset;
+   UInt64 fileSize;
+   UInt64 reserved[3];
+} TA_ColFileHeader;
+
+typedef struct {
+   char   symbol[TA_COL_SYMBOL_LEN]; /* NULL terminated. */
+   UInt64 nbBars;
+   UInt64 columnOffset[TA_COL_NB_COLUMN];
+   UInt64 reserved[2];
+} TA_ColSymbolEntry;
+
+/* A view on the columns of one symbol.
+ *
+ * Absent columns are set to NULL.
+ */
+typedef struct {
+   const char   *symbol;
+   int           nbBars;
+
+   const double *open;
+   const double *high;
+   const double *low;
+   const double *close;
+   const double *volume;
+   const Int64  *timestamp;
+} TA_ColSeries;
+
+/* Hidden implementation. */
+typedef struct TA_ColFile   TA_ColFile;
+typedef struct TA_ColWriter TA_ColWriter;
+
+/* Map a columnar file in memory.
+ *
+ * The file is validated (magic, version, offsets and alignment) before
+ * being made available. Returns TA_IO_ERROR when the file cannot be
+ * opened/mapped and TA_BAD_FILE_FORMAT when the content is invalid.
+ */
+TA_RetCode TA_ColFileOpen( const char *path, TA_ColFile **file );
+TA_RetCode TA_ColFileClose( TA_ColFile *file );
+
+int TA_ColFileNbSymbols( const TA_ColFile *file );
+
+TA_RetCode TA_ColFileGetSeries( const TA_ColFile *file,
+                                int               symbolIdx,
+                                TA_ColSeries     *series );
+
+TA_RetCode TA_ColFileFindSeries( const TA_ColFile *file,
+                                 const char       *symbol,
+                                 TA_ColSeries     *series );
+
+/* Writer used to produce a columnar file.
+ *
+ * The series are appended one after the other, the symbol table is
+ * written by TA_ColWriterClose(). Any of the array can be NULL when
+ * the column is not available.
+ */
+TA_RetCode TA_ColWriterOpen( const char *path, TA_ColWriter **writer );
+
+TA_RetCode TA_ColWriterAddSeries( TA_ColWriter *writer,
+                                  const char   *symbol,
+                                  int           nbBars,
+                                  const double  open[],
+                                  const double  high[],
+                                  const double  low[],
+                                  const double  close[],
+                                  const double  volume[],
+                                  const Int64   timestamp[] );
+
+TA_RetCode TA_ColWriterClose( TA_ColWriter *writer );
+
+#ifdef __cplusplus
+}
+#endif
@@ -140,6 +140,108 @@ unsigned int TA_GetUnstablePeriod(TA_FuncUnstId id);
 TA_RetCode TA_SetCompatibility(TA_Compatibility value);
 TA_Compatibility TA_GetCompatibility(void);
 
+/* The running sums of some TA functions (SMA and the functions using
+ * it, VAR, STDDEV, CORREL, BETA, OBV and AD) accumulate a small rounding
+ * error at each bar. Over millions of bars, the error can become
+ * significative, mostly when the magnitude of the values changes a lot.
+ *
+ * TA_PRECISION_COMPENSATED uses compensated (Neumaier) sums, and the
+ * products added to the sums are exact (fma), so the error stays bounded
+ * whatever the number of bars. These functions are 1 to 4 times slower
+ * (see "ta_bench precision"), and the results are not bit-identical to
+ * TA_PRECISION_DEFAULT. The streaming SMA (ta_stream.h) follows the
+ * setting too, TA_CorrelMatrix() does not.
+ *
+ * TA_PRECISION_PREFIX_SUM calculates the sums of the windows of SMA,
+ * VAR and STDDEV by blocks of bars: the differences between the sums
+ * of consecutive bars are added by a vectorized prefix sum, and the
+ * sum of a window is done again directly every few thousand bars, so
+ * the error does not grow with the number of bars either. It costs
+ * less than TA_PRECISION_COMPENSATED and a little more than
+ * TA_PRECISION_DEFAULT, and the results are not bit-identical to
+ * either. It applies to the functions using these
+ * sums (BBANDS, BBDist, BBWidth, ACCBANDS, SmaExt...); the other
+ * functions, and the streaming SMA, do as TA_PRECISION_DEFAULT.
+ *
+ * Like the compatibility, the setting applies to all the following calls.
+ */
+TA_RetCode TA_SetPrecision(TA_Precision value);
+TA_Precision TA_GetPrecision(void);
+
+/* By default a NaN in the input is used like any other value: it
+ * makes all the following outputs of a running sum (TA_SMA, TA_VAR...)
+ * or of a recursion (TA_EMA) NaN.
+ *
+ * With another policy, a NaN is a missing bar, and TA_SMA, TA_EMA,
+ * TA_WMA, TA_VAR, TA_STDDEV (and TA_MA, TA_BBANDS with these averages)
+ * handle it in their loop, without a pass to clean the input:
+ *
+ *    TA_MISSING_SKIP           The bar is ignored: the window is made of
+ *                              the last 'period' bars not missing.
+ *    TA_MISSING_CARRY_FORWARD  The bar has the value of the last bar not
+ *                              missing (nothing before the first one).
+ *    TA_MISSING_RESET          The calculation starts again after the
+ *                              bar, like at the start of the input.
+ *
+ * The number of outputs does not change (the lookback is the same),
+ * and an output is NaN when the bar is missing (except with
+ * TA_MISSING_CARRY_FORWARD) or when there are not enough bars yet. The
+ * sums are the ones of TA_PRECISION_DEFAULT. When nothing is missing,
+ * the values are identical to TA_MISSING_NONE.
+ *
+ * The functions of ta_missing.h do the same with validity bitmaps
+ * instead of NaN. The other functions, and the streaming states
+ * (ta_stream.h), do as TA_MISSING_NONE.
+ *
+ * Like the precision, the setting applies to all the following calls.
+ */
+TA_RetCode TA_SetMissingPolicy(TA_MissingPolicy value);
+TA_MissingPolicy TA_GetMissingPolicy(void);
+
+/* All the memory allocated by TA-Lib (temporary arrays of the TA
+ * functions, large circular buffers, streaming states, graphs...) goes
+ * through one allocator, by default malloc/realloc/free.
+ *
+ * TA_SetAllocator() replaces it, for example by an arena of the calling
+ * thread (userData is passed to each function). A NULL allocator restores
+ * the default. The allocator is not reset by TA_Initialize() and must be
+ * changed only when no memory allocated by TA-Lib is still in use: the
+ * memory is always freed by the current allocator.
+ *
+ * Example:
+ *      static void *myAlloc( void *arena, size_t size ) { ... }
+ *      static void *myRealloc( void *arena, void *ptr, size_t size ) { ... }
+ *      static void  myFree( void *arena, void *ptr ) { ... }
+ *
+ *      TA_Allocator allocator = { myAlloc, myRealloc, myFree, &arena };
+ *      TA_SetAllocator( &allocator );
+ */
+typedef struct TA_Allocator
+{
+   void *(*alloc)  ( void *userData, size_t size );
+   void *(*realloc)( void *userData, void *ptr, size_t size );
+   void  (*free)   ( void *userData, void *ptr );
+   void *userData;
+} TA_Allocator;
+
+TA_RetCode TA_SetAllocator( const TA_Allocator *allocator );
+
+/* Number of calls to the allocator since the last TA_ResetAllocStats().
+ * Counted whatever the allocator, for example to verify that the calls
+ * done at each new bar do not allocate. The counters are atomic, so
+ * they are exact with several threads calling TA-Lib; the three of
+ * them are read one after the other, not as a consistent snapshot.
+ */
+typedef struct TA_AllocStats
+{
+   unsigned long nbAlloc;
+   unsigned long nbRealloc;
+   unsigned long nbFree;
+} TA_AllocStats;
+
+void TA_GetAllocStats( TA_AllocStats *stats );
+void TA_ResetAllocStats( void );
+
 /* Candlesticks struct and functions
  * Because candlestick patterns are subjective, it is necessary
  * to allow the user to specify what should be the meaning of
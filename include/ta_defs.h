@@ -96,6 +96,9 @@ typedef enum {
     /*     14 */  TA_INVALID_LIST_TYPE,
     /*     15 */  TA_BAD_OBJECT,
     /*     16 */  TA_NOT_SUPPORTED,
+    /*     17 */  TA_IO_ERROR, /* File access failed */
+    /*     18 */  TA_BAD_FILE_FORMAT, /* Invalid or unsupported file content */
+    /*     19 */  TA_SETTINGS_MISMATCH, /* Saved with other settings */
     /*   5000 */  TA_INTERNAL_ERROR = 5000,
     /* 0xFFFF */  TA_UNKNOWN_ERR = 0xFFFF
 } TA_RetCode;
@@ -105,6 +108,19 @@ typedef enum {
     TA_COMPATIBILITY_METASTOCK
 } TA_Compatibility;
 
+typedef enum {
+    TA_PRECISION_DEFAULT,
+    TA_PRECISION_COMPENSATED,
+    TA_PRECISION_PREFIX_SUM
+} TA_Precision;
+
+typedef enum {
+    TA_MISSING_NONE,
+    TA_MISSING_SKIP,
+    TA_MISSING_CARRY_FORWARD,
+    TA_MISSING_RESET
+} TA_MissingPolicy;
+
 typedef enum {
    TA_MAType_SMA =0,
    TA_MAType_EMA =1,
@@ -5,6 +5,17 @@
 
 /* This header contains the prototype of all the Technical Analysis
  * function provided by TA-LIB.
+ *
+ * Output size: a function writes exactly
+ *     endIdx - max(startIdx, TA_XXX_Lookback(...)) + 1
+ * elements (0 when negative) in each output, starting at index 0.
+ * The outputs are never used beyond that as scratch space.
+ *
+ * In-place: any double output may be the same buffer as one of the
+ * inputs (for example outReal == inReal). The output element i
+ * corresponds to the input element outBegIdx+i, so the buffer must
+ * hold endIdx+1 elements and the result starts at its beginning.
+ * Only one of the outputs may be an input.
  */
 
 #ifdef __cplusplus
@@ -2015,6 +2026,30 @@ TA_RetCode TA_KAMA( int    startIdx,
 int TA_KAMA_Lookback( int           optInTimePeriod );  /* From 2 to 100000 */
 
 
+/*
+ * TA_KURT - Kurtosis over period
+ * 
+ * Input  = double
+ * Output = double
+ * 
+ * Optional Parameters
+ * -------------------
+ * optInTimePeriod:(From 2 to 100000)
+ *    Number of period
+ * 
+ * 
+ */
+TA_RetCode TA_KURT( int    startIdx,
+                    int    endIdx,
+                    const double inReal[],
+                    int           optInTimePeriod, /* From 2 to 100000 */
+                    int          *outBegIdx,
+                    int          *outNBElement,
+                    double        outReal[] );
+
+int TA_KURT_Lookback( int           optInTimePeriod );  /* From 2 to 100000 */
+
+
 /*
  * TA_LINEARREG - Linear Regression
  * 
@@ -2363,6 +2398,30 @@ TA_RetCode TA_MAXINDEX( int    startIdx,
 int TA_MAXINDEX_Lookback( int           optInTimePeriod );  /* From 2 to 100000 */
 
 
+/*
+ * TA_MEDIAN - Median over period
+ * 
+ * Input  = double
+ * Output = double
+ * 
+ * Optional Parameters
+ * -------------------
+ * optInTimePeriod:(From 2 to 100000)
+ *    Number of period
+ * 
+ * 
+ */
+TA_RetCode TA_MEDIAN( int    startIdx,
+                      int    endIdx,
+                      const double inReal[],
+                      int           optInTimePeriod, /* From 2 to 100000 */
+                      int          *outBegIdx,
+                      int          *outNBElement,
+                      double        outReal[] );
+
+int TA_MEDIAN_Lookback( int           optInTimePeriod );  /* From 2 to 100000 */
+
+
 /*
  * TA_MEDPRICE - Median Price
  * 
@@ -2630,6 +2689,35 @@ TA_RetCode TA_MOM( int    startIdx,
 int TA_MOM_Lookback( int           optInTimePeriod );  /* From 1 to 100000 */
 
 
+/*
+ * TA_MOMENTS - Rolling Moments (mean, variance, std dev, skewness, kurtosis, z-score)
+ * 
+ * Input  = double
+ * Output = double, double, double, double, double, double
+ * 
+ * Optional Parameters
+ * -------------------
+ * optInTimePeriod:(From 2 to 100000)
+ *    Number of period
+ * 
+ * 
+ */
+TA_RetCode TA_MOMENTS( int    startIdx,
+                       int    endIdx,
+                       const double inReal[],
+                       int           optInTimePeriod, /* From 2 to 100000 */
+                       int          *outBegIdx,
+                       int          *outNBElement,
+                       double        outMean[],
+                       double        outVar[],
+                       double        outStdDev[],
+                       double        outSkew[],
+                       double        outKurt[],
+                       double        outZScore[] );
+
+int TA_MOMENTS_Lookback( int           optInTimePeriod );  /* From 2 to 100000 */
+
+
 /*
  * TA_NATR - Normalized Average True Range
  * 
@@ -2674,6 +2762,30 @@ TA_RetCode TA_OBV( int    startIdx,
 int TA_OBV_Lookback( void );
 
 
+/*
+ * TA_PCTRANK - Percentile Rank over period
+ * 
+ * Input  = double
+ * Output = double
+ * 
+ * Optional Parameters
+ * -------------------
+ * optInTimePeriod:(From 2 to 100000)
+ *    Number of period
+ * 
+ * 
+ */
+TA_RetCode TA_PCTRANK( int    startIdx,
+                       int    endIdx,
+                       const double inReal[],
+                       int           optInTimePeriod, /* From 2 to 100000 */
+                       int          *outBegIdx,
+                       int          *outNBElement,
+                       double        outReal[] );
+
+int TA_PCTRANK_Lookback( int           optInTimePeriod );  /* From 2 to 100000 */
+
+
 /*
  * TA_PLUS_DI - Plus Directional Indicator
  * 
@@ -2758,6 +2870,35 @@ int TA_PPO_Lookback( int           optInFastPeriod, /* From 2 to 100000 */
                    int           optInSlowPeriod, /* From 2 to 100000 */
                    TA_MAType     optInMAType ); 
 
+/*
+ * TA_QUANTILE - Quantile over period
+ * 
+ * Input  = double
+ * Output = double
+ * 
+ * Optional Parameters
+ * -------------------
+ * optInTimePeriod:(From 2 to 100000)
+ *    Number of period
+ * 
+ * optInQuantile:(From 0 to 1)
+ *    Quantile (0.5 is the median)
+ * 
+ * 
+ */
+TA_RetCode TA_QUANTILE( int    startIdx,
+                        int    endIdx,
+                        const double inReal[],
+                        int           optInTimePeriod, /* From 2 to 100000 */
+                        double        optInQuantile, /* From 0 to 1 */
+                        int          *outBegIdx,
+                        int          *outNBElement,
+                        double        outReal[] );
+
+int TA_QUANTILE_Lookback( int           optInTimePeriod, /* From 2 to 100000 */
+                        double        optInQuantile );  /* From 0 to 1 */
+
+
 /*
  * TA_ROC - Rate of change : ((price/prevPrice)-1)*100
  * 
@@ -2968,6 +3109,30 @@ int TA_SAREXT_Lookback( double        optInStartValue, /* From TA_REAL_MIN to TA
                       double        optInAccelerationMaxShort );  /* From 0 to TA_REAL_MAX */
 
 
+/*
+ * TA_SKEW - Skewness over period
+ * 
+ * Input  = double
+ * Output = double
+ * 
+ * Optional Parameters
+ * -------------------
+ * optInTimePeriod:(From 2 to 100000)
+ *    Number of period
+ * 
+ * 
+ */
+TA_RetCode TA_SKEW( int    startIdx,
+                    int    endIdx,
+                    const double inReal[],
+                    int           optInTimePeriod, /* From 2 to 100000 */
+                    int          *outBegIdx,
+                    int          *outNBElement,
+                    double        outReal[] );
+
+int TA_SKEW_Lookback( int           optInTimePeriod );  /* From 2 to 100000 */
+
+
 /*
  * TA_SMA - Simple Moving Average
  * 
@@ -3518,6 +3683,30 @@ TA_RetCode TA_WMA( int    startIdx,
 
 int TA_WMA_Lookback( int           optInTimePeriod );  /* From 2 to 100000 */
 
+/*
+ * TA_ZSCORE - Z-Score over period
+ * 
+ * Input  = double
+ * Output = double
+ * 
+ * Optional Parameters
+ * -------------------
+ * optInTimePeriod:(From 2 to 100000)
+ *    Number of period
+ * 
+ * 
+ */
+TA_RetCode TA_ZSCORE( int    startIdx,
+                      int    endIdx,
+                      const double inReal[],
+                      int           optInTimePeriod, /* From 2 to 100000 */
+                      int          *outBegIdx,
+                      int          *outNBElement,
+                      double        outReal[] );
+
+int TA_ZSCORE_Lookback( int           optInTimePeriod );  /* From 2 to 100000 */
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "ta_defs.h"
+
+/* This header contains the indicator graph.
+ *
+ * Many TA functions are compositions of other functions (BBANDS is
+ * a MA and a STDDEV, STOCHRSI is a RSI followed by a STOCHF, ATR and
+ * NATR are both smoothing a TRANGE etc...). When the same series is
+ * needed by several indicators, calling each TA function recomputes
+ * these intermediates many times.
+ *
+ * With a TA_Graph the caller first declares all the indicators
+ * needed. The composite functions are decomposed and every
+ * intermediate having the same function, parameters and inputs is
+ * shared. TA_GraphCompute() then calculates each node exactly once,
+ * in dependency order, into a pool of buffers recycled as soon as
+ * an intermediate is no longer needed.
+ *
+ * The outputs are identical to calling the equivalent TA function
+ * with startIdx = 0.
+ *
+ * Example:
+ *     TA_Graph *graph;
+ *     TA_GraphSeries close = TA_GRAPH_CLOSE;
+ *     TA_GraphSeries sma, bbands[3];
+ *     double optIn[4];
+ *
+ *     retCode = TA_GraphAlloc( &graph );
+ *     optIn[0] = 20; optIn[1] = TA_MAType_SMA;
+ *     retCode = TA_GraphAdd( graph, TA_GRAPH_MA, &close, optIn, &sma );
+ *     optIn[0] = 20; optIn[1] = 2.0; optIn[2] = 2.0; optIn[3] = TA_MAType_SMA;
+ *     retCode = TA_GraphAdd( graph, TA_GRAPH_BBANDS, &close, optIn, bbands );
+ *     ...
+ *     retCode = TA_GraphCompute( graph, nbBars, open, high, low, close, volume );
+ *     retCode = TA_GraphGetSeries( graph, bbands[0], &outBegIdx, &outNBElement, &outReal );
+ *     ...
+ *     TA_GraphFree( graph );
+ *
+ * Here the SMA(20) is calculated only once, and bbands[1] (the
+ * middle band) is the same series as sma.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct TA_Graph TA_Graph;
+
+/* Identify a series within a graph. The price components are
+ * predefined, other series are returned by TA_GraphAdd().
+ */
+typedef int TA_GraphSeries;
+
+#define TA_GRAPH_OPEN     0
+#define TA_GRAPH_HIGH     1
+#define TA_GRAPH_LOW      2
+#define TA_GRAPH_CLOSE    3
+#define TA_GRAPH_VOLUME   4
+
+/* Functions available in a graph.
+ *
+ * The optional parameters are passed as an array of double in the
+ * same order as the TA function (integer and TA_MAType included).
+ * The defaults (TA_INTEGER_DEFAULT/TA_REAL_DEFAULT) are not
+ * accepted, all values must be explicit.
+ */
+typedef enum {
+                       /* Inputs          Optional parameters             Outputs */
+   TA_GRAPH_MA,        /* real            period, maType                  real */
+   TA_GRAPH_SMA,       /* real            period                          real */
+   TA_GRAPH_EMA,       /* real            period                          real */
+   TA_GRAPH_STDDEV,    /* real            period, nbDev                   real */
+   TA_GRAPH_BBANDS,    /* real            period, nbDevUp, nbDevDn, maType upper, middle, lower */
+   TA_GRAPH_TRANGE,    /* high,low,close                                  real */
+   TA_GRAPH_ATR,       /* high,low,close  period                          real */
+   TA_GRAPH_NATR,      /* high,low,close  period                          real */
+   TA_GRAPH_RSI,       /* real            period                          real */
+   TA_GRAPH_STOCHF,    /* high,low,close  fastK, fastD, fastDMAType       fastK, fastD */
+   TA_GRAPH_STOCHRSI,  /* real            period, fastK, fastD, fastDMAType fastK, fastD */
+   TA_GRAPH_ADX,       /* high,low,close  period                          real */
+   TA_GRAPH_ADXR,      /* high,low,close  period                          real */
+   TA_GRAPH_SMAEXT,    /* real            period, periodShift             real */
+   TA_GRAPH_BIAS,      /* real            period1, period2, period2Shift  percent */
+   TA_GRAPH_NB_FUNC
+} TA_GraphFuncId;
+
+typedef struct {
+   int nbNodes;     /* Nodes to be calculated, after sharing. */
+   int nbShared;    /* Nodes re-used instead of being added again. */
+   int nbBuffers;   /* Buffers allocated by the last TA_GraphCompute. */
+} TA_GraphInfo;
+
+TA_RetCode TA_GraphAlloc( TA_Graph **graph );
+TA_RetCode TA_GraphFree( TA_Graph *graph );
+
+/* Declare an indicator.
+ *
+ * 'inputs' and 'optIn' are arrays sized for the function (see
+ * TA_GraphFuncId), 'outputs' receives one TA_GraphSeries per output.
+ *
+ * An input can be any series of the graph, so indicators can be
+ * chained (like a RSI of an EMA).
+ */
+TA_RetCode TA_GraphAdd( TA_Graph *graph,
+                        TA_GraphFuncId funcId,
+                        const TA_GraphSeries inputs[],
+                        const double optIn[],
+                        TA_GraphSeries outputs[] );
+
+/* Calculate all the series for the provided price bars.
+ *
+ * A price component not needed by the graph can be NULL. Can be
+ * called again with another set of price bars.
+ */
+TA_RetCode TA_GraphCompute( TA_Graph *graph,
+                            int nbBars,
+                            const double open[],
+                            const double high[],
+                            const double low[],
+                            const double close[],
+                            const double volume[] );
+
+/* Same convention as the output of a TA function: outReal[0] is
+ * the value for the price bar outBegIdx.
+ *
+ * Only the series returned by TA_GraphAdd() are available. The
+ * pointer is valid until the next TA_GraphCompute() or TA_GraphFree().
+ */
+TA_RetCode TA_GraphGetSeries( const TA_Graph *graph,
+                              TA_GraphSeries series,
+                              int *outBegIdx,
+                              int *outNBElement,
+                              const double **outReal );
+
+TA_RetCode TA_GraphGetInfo( const TA_Graph *graph, TA_GraphInfo *info );
+
+#ifdef __cplusplus
+}
+#endif
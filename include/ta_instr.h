@@ -0,0 +1,93 @@
+#pragma once
+
+#include <stddef.h>
+
+#include "ta_defs.h"
+
+/* This header contains the instrumentation of the TA functions.
+ *
+ * The instrumentation is compiled in only when TA-Lib is built with
+ * TA_INSTRUMENT defined, otherwise it has no cost at all and
+ * TA_InstrGetSnapshot()/TA_InstrReset() return TA_NOT_SUPPORTED.
+ *
+ * The calls through the function registry (func->call, TA_FuncTail,
+ * see ta_registry.h) are counted by function and by thread:
+ *    - Number of calls.
+ *    - Input bars, the bars of the requested range (startIdx to endIdx).
+ *    - Output bars, the elements written (*outNBElement).
+ *    - Time spent in the function, in nanoseconds.
+ *    - Number of allocations and bytes allocated during the calls
+ *      (temporary arrays, large circular buffers...).
+ * The direct calls to the TA functions (TA_SMA...) are not counted.
+ *
+ * Example:
+ *     TA_InstrSnapshot total, snapshot;
+ *
+ *     ... in each worker thread, from time to time ...
+ *     TA_InstrGetSnapshot( &snapshot );
+ *     TA_InstrReset();
+ *     ... give the snapshot to the main thread ...
+ *
+ *     ... in the main thread ...
+ *     TA_InstrMerge( &total, &snapshot );
+ *     TA_InstrExport( &total, TA_INSTR_PROMETHEUS, buffer, sizeof(buffer), &size );
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Most functions in the registry (see TA_FuncCount). */
+#define TA_INSTR_MAX_FUNC 256
+
+typedef struct
+{
+   Int64 nbCalls;
+   Int64 nbInputBars;
+   Int64 nbOutputBars;
+   Int64 nbNanoseconds;
+   Int64 nbAlloc;
+   Int64 nbBytes;
+} TA_InstrCounters;
+
+/* The counters are indexed like TA_FuncAt(). */
+typedef struct
+{
+   int              nbFunc;
+   TA_InstrCounters func[TA_INSTR_MAX_FUNC];
+} TA_InstrSnapshot;
+
+typedef enum
+{
+   TA_INSTR_JSON,      /* {"functions":[{"name":"SMA","calls":1,...},...]} */
+   TA_INSTR_PROMETHEUS /* Text exposition format, ta_calls_total{function="SMA"} 1 */
+} TA_InstrFormat;
+
+/* Non-zero when built with TA_INSTRUMENT. */
+int TA_InstrEnabled( void );
+
+/* Copy the counters of the calling thread. */
+TA_RetCode TA_InstrGetSnapshot( TA_InstrSnapshot *snapshot );
+
+/* Set the counters of the calling thread to zero. */
+TA_RetCode TA_InstrReset( void );
+
+/* Add the counters of src to dest (a zeroed snapshot is empty). */
+TA_RetCode TA_InstrMerge( TA_InstrSnapshot *dest, const TA_InstrSnapshot *src );
+
+/* Write the counters of the functions called at least once, as a
+ * null-terminated text.
+ *
+ * *outSize is set to the size of the text, without the final null.
+ * When buffer is NULL, only *outSize is set. Returns TA_BAD_PARAM when
+ * bufferSize is too small.
+ */
+TA_RetCode TA_InstrExport( const TA_InstrSnapshot *snapshot,
+                           TA_InstrFormat          format,
+                           char                   *buffer,
+                           size_t                  bufferSize,
+                           size_t                 *outSize );
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "ta_defs.h"
+
+/* This header contains the fused calculation of several moving
+ * averages of the same input.
+ *
+ * Calling TA_MA once per TA_MAType reads the whole input again for
+ * each average, and DEMA/TEMA allocate and fill temporary arrays for
+ * their EMA. TA_MAFused() calculates all the requested averages in a
+ * single sweep over the input: the input is processed by chunks of
+ * bars small enough to stay in the cache, and every average is
+ * advanced over a chunk before moving to the next one.
+ *
+ * The EMA of the input (and the EMA of that EMA...) is calculated
+ * once when EMA, DEMA and TEMA need the same one, which is the case
+ * when startIdx is not after the lookback (ex: startIdx 0).
+ *
+ * Each output is identical to
+ *     TA_MA( startIdx, endIdx, inReal, optInTimePeriod, maType, ... )
+ * including the unstable periods and the compatibility setting, so
+ * outBegIdx[maType] is max( startIdx, TA_MA_Lookback(optInTimePeriod,maType) ).
+ *
+ * Not everything is shared:
+ *  - T3 updates its EMA with another formula than TA_EMA (the results
+ *    differ in the last bits), so it keeps its own chain of 6 EMA.
+ *  - SMA, WMA and TRIMA each keep their own running sums: they are
+ *    added in a different order, and sharing them would change the
+ *    results.
+ *  - MAMA is calculated by TA_MAMA (the algorithm needs its own pass).
+ *  - With TA_PRECISION_COMPENSATED or TA_PRECISION_PREFIX_SUM, the SMA
+ *    is calculated by TA_SMA.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TA_MA_NB_TYPE         9
+#define TA_MA_MASK(maType)    (1<<(maType))
+#define TA_MA_MASK_ALL        ((1<<TA_MA_NB_TYPE)-1)
+
+/* maTypeMask is a combination of TA_MA_MASK(). The three output
+ * arrays are indexed by TA_MAType, only the requested entries are
+ * used (the others can be NULL or not allocated).
+ *
+ * outReal[maType] must hold as many values as TA_MA would write. The
+ * outputs must not be the input, nor one of the other outputs.
+ */
+TA_RetCode TA_MAFused( int    startIdx,
+                       int    endIdx,
+                       const double inReal[],
+                       int    optInTimePeriod, /* From 1 to 100000 */
+                       int    maTypeMask,
+                       int    outBegIdx[],
+                       int    outNBElement[],
+                       double *const outReal[] );
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "ta_defs.h"
+
+/* This header contains the rolling statistics between all the
+ * series of a universe.
+ *
+ * TA_CORREL and TA_BETA work on exactly two series, so a rolling
+ * N x N correlation matrix needs N*(N-1)/2 calls, each one reading
+ * again both inputs. TA_CorrelMatrix() maintains the rolling sums,
+ * sums of squares and cross-products of all the pairs at once.
+ *
+ * The pairs are processed by tiles of TA_MATRIX_TILE x TA_MATRIX_TILE
+ * series. For each tile, the inputs are copied by chunks of bars in a
+ * contiguous buffer, so each input is read once per tile and the
+ * cross-products of the tile stay in the cache. The tiles are
+ * independent: when the library is built with OpenMP (/openmp, or
+ * -fopenmp), they are calculated in parallel by 'nbThread' threads.
+ *
+ * The outputs are written bar by bar, one full N x N matrix per bar
+ * (the matrices are symmetric):
+ *
+ *     outCorrel[(outIdx*nbSeries + i)*nbSeries + j]
+ *
+ * so each output must hold outNBElement*nbSeries*nbSeries values.
+ *
+ * Each correlation is identical to
+ *     TA_CORREL( startIdx, endIdx, inReal[i], inReal[j], optInTimePeriod, ... )
+ * and the lookback is TA_CORREL_Lookback( optInTimePeriod ).
+ *
+ * The covariance is the population covariance over the period:
+ *     (sumXY - sumX*sumY/period) / period
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TA_MATRIX_TILE 32
+
+/* outCorrel or outCovar can be NULL when not needed, but not both.
+ * nbThread <= 1 calculates all the tiles in the caller thread.
+ */
+TA_RetCode TA_CorrelMatrix( int    startIdx,
+                            int    endIdx,
+                            int    nbSeries,
+                            const double *const inReal[],
+                            int    optInTimePeriod, /* From 1 to 100000 */
+                            int    nbThread,
+                            int   *outBegIdx,
+                            int   *outNBElement,
+                            double outCorrel[],
+                            double outCovar[] );
+
+/* Beta of every series against a benchmark.
+ *
+ * outBeta[outIdx*nbSeries + i] is identical to the output of
+ *     TA_BETA( startIdx, endIdx, inBenchmark, inReal[i], optInTimePeriod, ... )
+ * (the variance is the one of the benchmark changes), and the
+ * lookback is TA_BETA_Lookback( optInTimePeriod ).
+ */
+TA_RetCode TA_BetaVector( int    startIdx,
+                          int    endIdx,
+                          int    nbSeries,
+                          const double *const inReal[],
+                          const double inBenchmark[],
+                          int    optInTimePeriod, /* From 1 to 100000 */
+                          int    nbThread,
+                          int   *outBegIdx,
+                          int   *outNBElement,
+                          double outBeta[] );
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "ta_defs.h"
+
+/* This header contains the moving averages and the variance with the
+ * missing bars given by a validity bitmap instead of NaN.
+ *
+ * The bits are in the order of Arrow (and of numpy.packbits with
+ * bitorder='little'): the bit of inReal[i] is
+ *     inValid[i >> 3] & (1 << (i & 7))
+ * and a bar is missing when its bit is 0, whatever its value. The
+ * bit of outReal[i] (i from 0 to outNBElement-1) is set the same way
+ * in outValid, which must hold (endIdx-startIdx+8)/8 bytes. outValid
+ * can be NULL: the outputs not valid are NaN in any case.
+ *
+ * The missing bars are handled following TA_SetMissingPolicy() (see
+ * ta_common.h), in the loop of the function: there is no pass on the
+ * input and no copy of it. With TA_MISSING_NONE, a missing bar makes
+ * all the following outputs not valid, like a NaN.
+ *
+ * Example, SMA of a column with nulls, the missing bars skipped:
+ *     TA_SetMissingPolicy( TA_MISSING_SKIP );
+ *     retCode = TA_MaskedSMA( 0, nbBars-1, close, closeValid, 20,
+ *                             &outBegIdx, &outNBElement, sma, smaValid );
+ *
+ * The lookback of each function is the one of the function without
+ * bitmap (TA_SMA_Lookback...).
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+TA_RetCode TA_MaskedSMA( int    startIdx,
+                         int    endIdx,
+                         const double inReal[],
+                         const unsigned char inValid[],
+                         int           optInTimePeriod, /* From 2 to 100000 */
+                         int          *outBegIdx,
+                         int          *outNBElement,
+                         double        outReal[],
+                         unsigned char outValid[] );
+
+TA_RetCode TA_MaskedEMA( int    startIdx,
+                         int    endIdx,
+                         const double inReal[],
+                         const unsigned char inValid[],
+                         int           optInTimePeriod, /* From 2 to 100000 */
+                         int          *outBegIdx,
+                         int          *outNBElement,
+                         double        outReal[],
+                         unsigned char outValid[] );
+
+TA_RetCode TA_MaskedWMA( int    startIdx,
+                         int    endIdx,
+                         const double inReal[],
+                         const unsigned char inValid[],
+                         int           optInTimePeriod, /* From 2 to 100000 */
+                         int          *outBegIdx,
+                         int          *outNBElement,
+                         double        outReal[],
+                         unsigned char outValid[] );
+
+TA_RetCode TA_MaskedVAR( int    startIdx,
+                         int    endIdx,
+                         const double inReal[],
+                         const unsigned char inValid[],
+                         int           optInTimePeriod, /* From 1 to 100000 */
+                         double        optInNbDev, /* From TA_REAL_MIN to TA_REAL_MAX */
+                         int          *outBegIdx,
+                         int          *outNBElement,
+                         double        outReal[],
+                         unsigned char outValid[] );
+
+TA_RetCode TA_MaskedSTDDEV( int    startIdx,
+                            int    endIdx,
+                            const double inReal[],
+                            const unsigned char inValid[],
+                            int           optInTimePeriod, /* From 2 to 100000 */
+                            double        optInNbDev, /* From TA_REAL_MIN to TA_REAL_MAX */
+                            int          *outBegIdx,
+                            int          *outNBElement,
+                            double        outReal[],
+                            unsigned char outValid[] );
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,124 @@
+#pragma once
+
+#include "ta_defs.h"
+
+/* This header contains the recursive indicators calculated on a
+ * panel of symbols.
+ *
+ * TA_EMA, TA_RSI, TA_ATR, TA_KAMA and TA_T3 can not be vectorized
+ * along the time: each output depends on the previous one. Over a
+ * universe of symbols, the same recursion is done independently for
+ * each symbol, and that dimension can be vectorized.
+ *
+ * A panel holds the values of nbSymbols symbols for each bar,
+ * interleaved bar by bar:
+ *
+ *     inReal[bar*nbSymbols + symbol]
+ *
+ * The symbols are processed by groups of up to 16*TA_PANEL_LANES:
+ * the values of a group for a bar are contiguous, and each step of
+ * the recursion is done for all the symbols of the group before the
+ * next step. The loops on the symbols are done TA_PANEL_LANES at a
+ * time with a constant count, the compiler turns them into SIMD
+ * instructions (SSE2/NEON: 2 lanes per instruction, AVX: 4, AVX-512:
+ * 8). When nbSymbols is not a multiple of TA_PANEL_LANES, the last
+ * symbols are copied in a temporary block.
+ *
+ * The outputs are written the same way, one row of nbSymbols values
+ * per bar:
+ *
+ *     outReal[outIdx*nbSymbols + symbol]
+ *
+ * so each output must hold outNBElement*nbSymbols values. outReal can
+ * be inReal (or one of inHigh/inLow/inClose).
+ *
+ * Each lane does exactly the operations of the function on one
+ * symbol, so the values of a symbol are identical to
+ *     TA_EMA( startIdx, endIdx, <the values of the symbol>, ... )
+ * including the unstable periods, the compatibility and the precision
+ * settings, and the lookback is the one of the function. This holds
+ * with FMA instructions too (-march=haswell): the contraction of the
+ * floating-point operations, which the compiler could do differently
+ * in the scalar and the vectorized code, is turned off for all the
+ * functions (see ta_utility.h).
+ *
+ * TA_PanelPack() and TA_PanelUnpack() convert between a panel and
+ * one array per symbol.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Symbols advanced together. Can be defined to 4 or 16 when building
+ * the library.
+ */
+#ifndef TA_PANEL_LANES
+   #define TA_PANEL_LANES 8
+#endif
+
+TA_RetCode TA_PanelEMA( int    startIdx,
+                        int    endIdx,
+                        int    nbSymbols,
+                        const double inReal[],
+                        int    optInTimePeriod, /* From 2 to 100000 */
+                        int   *outBegIdx,
+                        int   *outNBElement,
+                        double outReal[] );
+
+TA_RetCode TA_PanelRSI( int    startIdx,
+                        int    endIdx,
+                        int    nbSymbols,
+                        const double inReal[],
+                        int    optInTimePeriod, /* From 2 to 100000 */
+                        int   *outBegIdx,
+                        int   *outNBElement,
+                        double outReal[] );
+
+TA_RetCode TA_PanelATR( int    startIdx,
+                        int    endIdx,
+                        int    nbSymbols,
+                        const double inHigh[],
+                        const double inLow[],
+                        const double inClose[],
+                        int    optInTimePeriod, /* From 1 to 100000 */
+                        int   *outBegIdx,
+                        int   *outNBElement,
+                        double outReal[] );
+
+TA_RetCode TA_PanelKAMA( int    startIdx,
+                         int    endIdx,
+                         int    nbSymbols,
+                         const double inReal[],
+                         int    optInTimePeriod, /* From 2 to 100000 */
+                         int   *outBegIdx,
+                         int   *outNBElement,
+                         double outReal[] );
+
+TA_RetCode TA_PanelT3( int    startIdx,
+                       int    endIdx,
+                       int    nbSymbols,
+                       const double inReal[],
+                       int    optInTimePeriod, /* From 2 to 100000 */
+                       double optInVFactor,     /* From 0 to 1 */
+                       int   *outBegIdx,
+                       int   *outNBElement,
+                       double outReal[] );
+
+/* outPanel[bar*nbSymbols + symbol] = inSeries[symbol][bar], for the
+ * bars 0 to nbBars-1.
+ */
+TA_RetCode TA_PanelPack( int    nbSymbols,
+                         int    nbBars,
+                         const double *const inSeries[],
+                         double outPanel[] );
+
+/* outSeries[symbol][bar] = inPanel[bar*nbSymbols + symbol]. */
+TA_RetCode TA_PanelUnpack( int    nbSymbols,
+                           int    nbBars,
+                           const double inPanel[],
+                           double *const outSeries[] );
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,190 @@
+#pragma once
+
+#include "ta_defs.h"
+
+/* This header contains the registry of all the TA functions.
+ *
+ * Each function of ta_func.h is described by a TA_FuncDef: its
+ * inputs, optional parameters (with their range) and outputs, its
+ * unstable period id, and two entry points with a uniform signature
+ * for the lookback and the calculation.
+ *
+ * The registry is a constant table generated from ta_func.h by the
+ * ta_gen_registry tool (src/ta_func/ta_registry_table.h). Regenerate
+ * it when a function is added or modified:
+ *     ta_gen_registry <root of the repository>
+ *
+ * A dynamic caller (bindings, config-driven engine) finds the
+ * TA_FuncDef once by name, then each calculation is a single
+ * indirect call:
+ *
+ *     const TA_FuncDef *func = TA_FuncFind( "BBANDS" );
+ *     const double *inputs[1] = { close };
+ *     double optIn[4] = { 20, 2.0, 2.0, TA_MAType_SMA };
+ *     void *outputs[3] = { upper, middle, lower };
+ *
+ *     retCode = func->call( 0, nbBars-1, inputs, optIn,
+ *                           &outBegIdx, &outNBElement, outputs );
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum
+{
+   TA_INPUT_REAL,   /* Any series (inReal, inReal0, inPeriods...). */
+   TA_INPUT_OPEN,
+   TA_INPUT_HIGH,
+   TA_INPUT_LOW,
+   TA_INPUT_CLOSE,
+   TA_INPUT_VOLUME
+} TA_InputType;
+
+typedef enum
+{
+   TA_OPTIN_INTEGER,
+   TA_OPTIN_REAL,
+   TA_OPTIN_MATYPE
+} TA_OptInputType;
+
+typedef enum
+{
+   TA_OUTPUT_REAL,    /* double[] */
+   TA_OUTPUT_INTEGER  /* int[] */
+} TA_OutputType;
+
+typedef struct
+{
+   TA_InputType type;
+   const char  *name;
+} TA_InputDef;
+
+typedef struct
+{
+   TA_OptInputType type;
+   const char     *name;
+   double          min;
+   double          max;
+} TA_OptInputDef;
+
+typedef struct
+{
+   TA_OutputType type;
+   const char   *name;
+} TA_OutputDef;
+
+/* All the optional parameters are passed as double in the order of
+ * the TA function, an integer or a TA_MAType is converted with a
+ * cast. TA_INTEGER_DEFAULT and TA_REAL_DEFAULT are allowed.
+ *
+ * outputs[i] is a double* or an int* depending of the TA_OutputType.
+ */
+typedef int (*TA_FuncLookback)( const double optIn[] );
+
+typedef TA_RetCode (*TA_FuncCall)( int    startIdx,
+                                   int    endIdx,
+                                   const double *const inputs[],
+                                   const double optIn[],
+                                   int   *outBegIdx,
+                                   int   *outNBElement,
+                                   void  *const outputs[] );
+
+typedef struct
+{
+   const char           *name;   /* Without the "TA_" prefix, like "BBANDS". */
+   const char           *hint;   /* Like "Bollinger Bands". */
+   int                   nbInput;
+   const TA_InputDef    *inputs;
+   int                   nbOptInput;
+   const TA_OptInputDef *optInputs; /* NULL when nbOptInput is 0. */
+   int                   nbOutput;
+   const TA_OutputDef   *outputs;
+   TA_FuncUnstId         unstId;    /* TA_FUNC_UNST_NONE when not applicable. */
+   TA_FuncLookback       lookback;
+   TA_FuncCall           call;
+} TA_FuncDef;
+
+/* The functions are sorted by name (strcmp order). */
+int TA_FuncCount( void );
+const TA_FuncDef *TA_FuncAt( int idx );
+
+/* Case sensitive, with or without the "TA_" prefix.
+ * Return NULL if not found.
+ */
+const TA_FuncDef *TA_FuncFind( const char *name );
+
+/* Exact number of elements written in each output by a call on
+ * [startIdx,endIdx] with these optional parameters, that is
+ * endIdx-max(startIdx,lookback)+1 or 0. It allows to allocate the
+ * outputs precisely (for example in a shared arena) instead of
+ * endIdx-startIdx+1 elements.
+ *
+ * Return -1 when the range or the optional parameters are invalid.
+ */
+int TA_FuncOutputSize( const TA_FuncDef *func,
+                       int startIdx,
+                       int endIdx,
+                       const double optIn[] );
+
+/* Tail mode: calculate only the last values, for example the latest
+ * bar of a live series, with a warm-up bounded by maxWarmUp instead
+ * of all the history.
+ *
+ * How the warm-up is reduced depends of the function
+ * (see TA_FuncTailMode):
+ *
+ *  - TA_TAIL_WINDOW: a function on a fixed window (SMA, STDDEV,
+ *    WILLR...) is called directly on the tail. Its running sums
+ *    restart at the first bar of the window, while the ones of the
+ *    full call carry the rounding of all the previous bars: the values
+ *    can differ by the drift accumulated by the full call, which is
+ *    not limited to the last bits. On a series going from 1e-6 to
+ *    1e12, VAR differs by more than 1e14, STDDEV by 1e7 and WMA by
+ *    1e3.
+ *  - TA_TAIL_UNSTABLE: a function with an unstable period (EMA, RSI,
+ *    ADX, KAMA...) is called on the tail, and its recursion starts
+ *    max(maxWarmUp,lookback) bars before the first output. The result
+ *    is identical to the call on the tail with the unstable period
+ *    increased by that warm-up minus the lookback. With a negative
+ *    maxWarmUp (TA_TAIL_ALL_HISTORY), or when the tail starts before
+ *    the lookback, the recursion starts at the first bar and the
+ *    result is identical to the call on [0,endIdx].
+ *    The longer unstable period is only for this call: TA_Globals is
+ *    not modified, other threads are not affected.
+ *  - TA_TAIL_HISTORY: a function depending on all the history (AD,
+ *    OBV, SAR, DEMA, TEMA, TRIX, MACD, TrendData, or a TA_MAType other
+ *    than SMA, WMA or TRIMA in a composite like STOCH or BBANDS) has
+ *    no bounded warm-up. TA_FuncTail returns TA_NOT_SUPPORTED; call
+ *    the function on all the history instead.
+ *
+ * The outputs need nbTail elements, they are written for the bars
+ * [endIdx-nbTail+1, endIdx] (or from the lookback when it is after).
+ * Nothing is allocated. Return TA_BAD_PARAM when nbTail is less than 1.
+ */
+typedef enum
+{
+   TA_TAIL_WINDOW,
+   TA_TAIL_UNSTABLE,
+   TA_TAIL_HISTORY
+} TA_TailMode;
+
+#define TA_TAIL_ALL_HISTORY (-1)
+
+/* TA_TAIL_HISTORY for a NULL func. */
+TA_TailMode TA_FuncTailMode( const TA_FuncDef *func,
+                             const double optIn[] );
+
+TA_RetCode TA_FuncTail( const TA_FuncDef *func,
+                        int endIdx,
+                        int nbTail,
+                        int maxWarmUp,
+                        const double *const inputs[],
+                        const double optIn[],
+                        int   *outBegIdx,
+                        int   *outNBElement,
+                        void  *const outputs[] );
+
+#ifdef __cplusplus
+}
+#endif
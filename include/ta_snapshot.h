@@ -0,0 +1,94 @@
+#pragma once
+
+#include <stddef.h>
+
+#include "ta_defs.h"
+#include "ta_stream.h"
+
+/* This header contains the snapshot of streaming states.
+ *
+ * A snapshot is a portable binary copy of the global settings and of
+ * an array of TA_StreamState (see ta_stream.h). A live process can
+ * save its states periodically, and after a restart load them instead
+ * of replaying the history to warm up every indicator.
+ *
+ * Example:
+ *     size_t size;
+ *
+ *     retCode = TA_SnapshotSave( states, nbStates, NULL, 0, &size );
+ *     buffer = malloc( size );
+ *     retCode = TA_SnapshotSave( states, nbStates, buffer, size, &size );
+ *     ... write the buffer in a file ...
+ *
+ *     ... after the restart, with the same settings ...
+ *     retCode = TA_SnapshotLoad( states, nbStates, buffer, size );
+ *     ... continue with TA_StreamUpdate(), TA_StreamFree() when done ...
+ *
+ * A state continues exactly as if it never stopped: the values are
+ * identical to the ones of the saved state.
+ *
+ * The values of a state depend of the settings (compatibility,
+ * precision, unstable periods) captured by TA_StreamInit(). The
+ * snapshot is refused with TA_SETTINGS_MISMATCH when the current
+ * global settings (including the candle settings), or the settings
+ * captured by a state, differ from the ones saved.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Layout (version 1)
+ * ------------------
+ * All integers are 32 bits and all doubles are IEEE 754 64 bits, both
+ * little-endian whatever the host.
+ *
+ *    Size  Description
+ *    ----  ---------------------------------------------
+ *       8  Magic "TASNAPSH"
+ *       4  Version (TA_SNAPSHOT_VERSION)
+ *       4  Number of states
+ *       4  Compatibility
+ *       4  Precision
+ *       4  Number of unstable periods, followed by their value
+ *       4  Number of candle settings, followed by each one
+ *          (setting type, range type, average period, factor)
+ *
+ * Then for each state: the function id, the period, the captured
+ * settings, the number of bars consumed, the circular window and the
+ * members of the function (see ta_snapshot.c).
+ */
+#define TA_SNAPSHOT_MAGIC   "TASNAPSH"
+#define TA_SNAPSHOT_VERSION 1
+
+/* Write the snapshot of nbStates states.
+ *
+ * *outSize is set to the size of the snapshot. When buffer is NULL,
+ * only *outSize is set. Returns TA_BAD_PARAM when bufferSize is too
+ * small.
+ */
+TA_RetCode TA_SnapshotSave( const TA_StreamState states[],
+                            int                  nbStates,
+                            void                *buffer,
+                            size_t               bufferSize,
+                            size_t              *outSize );
+
+/* Number of states in a snapshot, -1 when the header is invalid. */
+int TA_SnapshotNbStates( const void *buffer, size_t size );
+
+/* Initialize nbStates states from a snapshot, nbStates must be the
+ * number of states saved. Each state must be freed with
+ * TA_StreamFree().
+ *
+ * Returns TA_BAD_FILE_FORMAT when the snapshot is invalid or from
+ * another version, and TA_SETTINGS_MISMATCH when it was saved with
+ * other settings. On error, no state needs to be freed.
+ */
+TA_RetCode TA_SnapshotLoad( TA_StreamState states[],
+                            int            nbStates,
+                            const void    *buffer,
+                            size_t         size );
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,197 @@
+#pragma once
+
+#include "ta_defs.h"
+
+/* This header contains the incremental (streaming) version of
+ * some TA functions.
+ *
+ * A TA_StreamState is fed one price bar at a time and produces
+ * the same values as the equivalent TA function called once over
+ * the whole history (startIdx = 0).
+ *
+ * The unstable period, the compatibility and the precision setting are captured
+ * by TA_StreamInit(), changing them afterward has no effect on an
+ * already initialized state.
+ *
+ * Example:
+ *     TA_StreamState state;
+ *     double value;
+ *     int nbElement;
+ *
+ *     retCode = TA_StreamInit( &state, TA_STREAM_EMA, 20 );
+ *     ...
+ *     for each new bar:
+ *        retCode = TA_StreamUpdate( &state, &bar, &nbElement, &value );
+ *        if( nbElement == 1 ) ... 'value' is valid ...
+ *     ...
+ *     TA_StreamFree( &state );
+ *
+ * TA_StreamRun() consumes a chunk of bars from arrays. Calling it on
+ * consecutive chunks gives exactly the same values as one call of
+ * the TA function on all the history, so a long history can be
+ * processed by fixed-size chunks (for example read from disk) with
+ * no overlap between them: the state is all what is kept from one
+ * chunk to the next.
+ *
+ * TA_StreamRunBlocked() does the same for many states over the same
+ * arrays: the bars are consumed by tiles small enough to stay in the
+ * cache, each tile by all the states before the next one. The inputs
+ * are read from the memory once instead of once per state, and the
+ * SMA and EMA past their lookback are advanced together, bar by bar.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* One price bar. */
+typedef struct {
+   Int64  timestamp;
+   double open;
+   double high;
+   double low;
+   double close;
+   double volume;
+} TA_Bar;
+
+/* Functions having a streaming version.
+ *
+ * The single input functions are using the close of the bar.
+ */
+typedef enum {
+   TA_STREAM_SMA, /* TA_SMA */
+   TA_STREAM_EMA, /* TA_EMA */
+   TA_STREAM_RSI, /* TA_RSI */
+   TA_STREAM_ATR, /* TA_ATR */
+   TA_STREAM_ADX, /* TA_ADX */
+   TA_STREAM_KAMA, /* TA_KAMA */
+   TA_STREAM_MAMA, /* outMAMA of TA_MAMA */
+   TA_STREAM_FAMA, /* outFAMA of TA_MAMA */
+   TA_STREAM_NB_FUNC
+} TA_StreamFuncId;
+
+/* Hilbert transform of TA_MAMA (see HILBERT_VARIABLES in ta_utility.h). */
+typedef struct {
+   double odd[3];
+   double even[3];
+   double prevOdd;
+   double prevEven;
+   double prevInputOdd;
+   double prevInputEven;
+} TA_StreamHilbert;
+
+/* The state is a plain struct so it can be embedded in arrays
+ * owned by the caller. Consider all members as private.
+ */
+typedef struct {
+   TA_StreamFuncId  funcId;
+   int              optInTimePeriod;
+   int              lookback;
+   int              nbBars; /* Bars consumed, stops counting when no longer needed. */
+   TA_Compatibility compatibility;
+   TA_Precision     precision;
+   int              unstablePeriod;
+
+   /* Circular buffer for the functions needing a window. */
+   double          *window;
+   int              windowSize;
+   int              windowIdx;
+
+   union {
+      struct { double periodTotal; double periodComp; } sma;
+      struct { double k; double prevMA; } ema;
+      struct { double prevValue; double prevGain; double prevLoss; } rsi;
+      struct { double prevClose; double prevATR; } atr;
+      struct { double prevHigh; double prevLow; double prevClose;
+               double prevMinusDM; double prevPlusDM; double prevTR;
+               double sumDX; double prevADX; } adx;
+      struct { double prevValue; double trailingValue; double sumROC1; double prevKAMA; } kama;
+      struct { double fastLimit; double slowLimit; double rad2Deg;
+               double price[3]; int priceIdx; int isOdd;
+               double periodWMASub; double periodWMASum; double trailingWMAValue;
+               TA_StreamHilbert detrender, Q1, jI, jQ;
+               int hilbertIdx;
+               double I1ForOddPrev2, I1ForOddPrev3, I1ForEvenPrev2, I1ForEvenPrev3;
+               double prevQ2, prevI2, Re, Im, period, prevPhase;
+               double mama, fama; } mama;
+   } u;
+} TA_StreamState;
+
+/* Prepare a state. Must be followed by TA_StreamFree(). */
+TA_RetCode TA_StreamInit( TA_StreamState *state,
+                          TA_StreamFuncId funcId,
+                          int             optInTimePeriod );
+
+/* TA_STREAM_MAMA and TA_STREAM_FAMA with other limits than the
+ * default of TA_MAMA (TA_StreamInit() must be called with
+ * TA_INTEGER_DEFAULT for them). TA_REAL_DEFAULT is allowed.
+ */
+TA_RetCode TA_StreamInitMAMA( TA_StreamState *state,
+                              TA_StreamFuncId funcId,
+                              double          optInFastLimit, /* From 0.01 to 0.99 */
+                              double          optInSlowLimit  /* From 0.01 to 0.99 */ );
+
+TA_RetCode TA_StreamFree( TA_StreamState *state );
+
+/* Same value as the lookback of the equivalent TA function
+ * when TA_StreamInit() was called.
+ */
+int TA_StreamLookback( const TA_StreamState *state );
+
+/* Consume one bar.
+ *
+ * *outNBElement is set to 1 when *outReal is valid, 0 while the
+ * state is still within its lookback period.
+ */
+TA_RetCode TA_StreamUpdate( TA_StreamState *state,
+                            const TA_Bar   *bar,
+                            int            *outNBElement,
+                            double         *outReal );
+
+/* Consume nbBars bars. The single input functions only need inClose,
+ * inHigh and inLow can then be NULL.
+ *
+ * outReal must hold nbBars elements. *outBegIdx is the index in this
+ * chunk of the bar of outReal[0], *outNBElement the number of values
+ * written (0 while still within the lookback period). outReal can be
+ * the same buffer as one of the inputs.
+ */
+TA_RetCode TA_StreamRun( TA_StreamState *state,
+                         int             nbBars,
+                         const double    inHigh[],
+                         const double    inLow[],
+                         const double    inClose[],
+                         int            *outBegIdx,
+                         int            *outNBElement,
+                         double          outReal[] );
+
+/* Default tile of TA_StreamRunBlocked(): with the high, low and
+ * close, 96KB of inputs stay in a L2 cache while all the states
+ * consume them.
+ */
+#define TA_STREAM_TILE_SIZE 4096
+
+/* Consume nbBars bars with each of the nbStates states, tile by tile.
+ * tileSize is the number of bars of a tile, 0 for TA_STREAM_TILE_SIZE.
+ *
+ * outReal[i] must hold nbBars elements, outBegIdx[i] and
+ * outNBElement[i] are as for TA_StreamRun() of states[i] on all the
+ * bars, and so are the values. outReal[i] can not be one of the
+ * inputs: the other states still need the bars of the tile.
+ *
+ * Returns TA_ALLOC_ERR when the work array can not be allocated.
+ */
+TA_RetCode TA_StreamRunBlocked( TA_StreamState  states[],
+                                int             nbStates,
+                                int             nbBars,
+                                int             tileSize,
+                                const double    inHigh[],
+                                const double    inLow[],
+                                const double    inClose[],
+                                int             outBegIdx[],
+                                int             outNBElement[],
+                                double         *const outReal[] );
+
+#ifdef __cplusplus
+}
+#endif
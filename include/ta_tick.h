@@ -0,0 +1,134 @@
+#pragma once
+
+#include <stddef.h>
+#include "ta_defs.h"
+#include "ta_stream.h"
+
+/* This header contains the tick ingestion and the bar resampling.
+ *
+ * A TA_Resampler builds the OHLCV bars of one or more timeframes in a
+ * single pass over the ticks. Every completed bar is pushed into the
+ * TA_StreamState of its timeframe, so the indicator values are
+ * available without building any intermediate price arrays.
+ *
+ * Example (1 second and 1 minute bars, timestamp in milliseconds):
+ *     TA_StreamState secStates[2], minStates[1];
+ *     double secOut[2], minOut[1];
+ *     int secNb[2], minNb[1];
+ *     TA_Timeframe timeframe[2] = {
+ *        { 1000,  secStates, 2, secOut, secNb },
+ *        { 60000, minStates, 1, minOut, minNb } };
+ *     TA_Resampler *resampler;
+ *
+ *     TA_StreamInit( &secStates[0], TA_STREAM_EMA, 20 );
+ *     ...
+ *     retCode = TA_ResamplerAlloc( timeframe, 2, onBar, NULL, &resampler );
+ *     retCode = TA_TickProcessFile( "ticks.csv", TA_TICK_CSV, resampler, NULL );
+ *     TA_ResamplerFree( resampler );
+ *
+ * onBar() is called for every completed bar after the states of
+ * its timeframe were updated (see TA_BarHandler).
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* One trade. The unit of the timestamp is chosen by the caller
+ * and must be the same as the period of the timeframes.
+ */
+typedef struct {
+   Int64  timestamp;
+   double price;
+   double volume;
+} TA_Tick;
+
+typedef enum {
+   /* Text, one "timestamp,price,volume" per line. The
+    * timestamp is an integer.
+    */
+   TA_TICK_CSV,
+
+   /* Array of TA_Tick as-is (24 bytes per tick, little-endian). */
+   TA_TICK_BINARY
+} TA_TickFormat;
+
+typedef struct {
+   /* Duration of a bar. Bars are aligned on multiple of the period
+    * (a bar starts at floor(timestamp/period)*period).
+    */
+   Int64           period;
+
+   /* Indicators fed with every completed bar. Can be NULL. */
+   TA_StreamState *states;
+   int             nbStates;
+
+   /* Receives the TA_StreamUpdate() output of each state. Valid
+    * only within the TA_BarHandler call.
+    */
+   double         *outReal;
+   int            *outNBElement;
+} TA_Timeframe;
+
+/* Called for every completed bar, in chronological order for a given
+ * timeframe. No bar is produced for a period without tick.
+ */
+typedef void (*TA_BarHandler)( void *opaqueData,
+                               int timeframeIdx,
+                               const TA_Timeframe *timeframe,
+                               const TA_Bar *bar );
+
+typedef struct TA_Resampler TA_Resampler;
+
+/* The timeframe array is copied, but the states and output
+ * arrays it points to must remain valid until TA_ResamplerFree().
+ * The handler can be NULL.
+ */
+TA_RetCode TA_ResamplerAlloc( const TA_Timeframe timeframe[],
+                              int nbTimeframe,
+                              TA_BarHandler handler,
+                              void *opaqueData,
+                              TA_Resampler **resampler );
+
+TA_RetCode TA_ResamplerFree( TA_Resampler *resampler );
+
+/* The ticks must be in chronological order. A tick older than
+ * the previous one is dropped (see TA_ResamplerNbDropped).
+ */
+TA_RetCode TA_ResamplerAddTicks( TA_Resampler *resampler,
+                                 const TA_Tick ticks[],
+                                 int nbTicks );
+
+/* Complete the bars still open (typically at end of stream). */
+TA_RetCode TA_ResamplerFlush( TA_Resampler *resampler );
+
+UInt64 TA_ResamplerNbDropped( const TA_Resampler *resampler );
+
+/* Parse the complete CSV lines found in a buffer.
+ *
+ * Stops at the first incomplete line or when maxTicks are parsed.
+ * *nbBytesUsed indicates where the parsing stopped. Empty lines
+ * are skipped. On an invalid line TA_BAD_FILE_FORMAT is returned
+ * with *nbBytesUsed at the start of that line.
+ */
+TA_RetCode TA_TickParseCSV( const char *buffer,
+                            size_t size,
+                            TA_Tick ticks[],
+                            int maxTicks,
+                            int *nbTicks,
+                            size_t *nbBytesUsed );
+
+/* Read a whole file in large chunks and feed all its ticks to
+ * the resampler, then flush it. A first CSV line that does not
+ * parse is considered a header and is skipped.
+ *
+ * nbTicks can be NULL.
+ */
+TA_RetCode TA_TickProcessFile( const char *path,
+                               TA_TickFormat format,
+                               TA_Resampler *resampler,
+                               UInt64 *nbTicks );
+
+#ifdef __cplusplus
+}
+#endif
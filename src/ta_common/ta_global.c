@@ -21,10 +21,12 @@
 /**** Global variables definitions.    ****/
 
 /* The entry point for all globals */
-TA_LibcPriv ta_theGlobals = {0,(TA_Compatibility)0,{0},{{(TA_CandleSettingType)0,(TA_RangeType)0,0,0}}};
+TA_LibcPriv ta_theGlobals = {0,(TA_Compatibility)0,(TA_Precision)0,(TA_MissingPolicy)0,{0},{{(TA_CandleSettingType)0,(TA_RangeType)0,0,0}}};
 
 TA_LibcPriv *TA_Globals = &ta_theGlobals;
 
+TA_THREAD_LOCAL TA_UnstableExtra TA_ThreadUnstable = { TA_FUNC_UNST_NONE, 0 };
+
 /**** Local declarations.              ****/
 /* None */
 
@@ -166,6 +168,36 @@ TA_Compatibility TA_GetCompatibility(void)
     return TA_Globals->compatibility;
 }
 
+TA_RetCode TA_SetPrecision(TA_Precision value)
+{
+    if( (value != TA_PRECISION_DEFAULT) && (value != TA_PRECISION_COMPENSATED) &&
+        (value != TA_PRECISION_PREFIX_SUM) )
+        return TA_BAD_PARAM;
+
+    TA_Globals->precision = value;
+    return TA_SUCCESS;
+}
+
+TA_Precision TA_GetPrecision(void)
+{
+    return TA_Globals->precision;
+}
+
+TA_RetCode TA_SetMissingPolicy(TA_MissingPolicy value)
+{
+    if( (value != TA_MISSING_NONE) && (value != TA_MISSING_SKIP) &&
+        (value != TA_MISSING_CARRY_FORWARD) && (value != TA_MISSING_RESET) )
+        return TA_BAD_PARAM;
+
+    TA_Globals->missing = value;
+    return TA_SUCCESS;
+}
+
+TA_MissingPolicy TA_GetMissingPolicy(void)
+{
+    return TA_Globals->missing;
+}
+
 /**** Local functions definitions.     ****/
 /* None */
 
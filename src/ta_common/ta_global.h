@@ -2,6 +2,12 @@
 
 #include "ta_common.h"
 
+#if defined(_MSC_VER)
+   #define TA_THREAD_LOCAL __declspec(thread)
+#else
+   #define TA_THREAD_LOCAL _Thread_local
+#endif
+
 /* TA_CandleSetting is the one setting struct */
 typedef struct {
     TA_CandleSettingType    settingType;
@@ -18,6 +24,12 @@ typedef struct
    /* For handling the compatibility with other software */
    TA_Compatibility compatibility;
 
+   /* For handling the precision of the running sums. */
+   TA_Precision precision;
+
+   /* For handling the missing bars (NaN) of the input. */
+   TA_MissingPolicy missing;
+
    /* For handling the unstable period of some TA function. */
    unsigned int unstablePeriod[TA_FUNC_UNST_ALL];
 
@@ -29,3 +41,15 @@ typedef struct
  * and is the entry point for all other globals.
  */
 extern TA_LibcPriv *TA_Globals;
+
+/* Unstable period added to the one of TA_Globals for the calls done
+ * by the current thread, only during TA_FuncTail. The id is
+ * TA_FUNC_UNST_NONE otherwise.
+ */
+typedef struct
+{
+   TA_FuncUnstId id;
+   unsigned int  extra;
+} TA_UnstableExtra;
+
+extern TA_THREAD_LOCAL TA_UnstableExtra TA_ThreadUnstable;
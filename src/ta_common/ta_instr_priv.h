@@ -0,0 +1,56 @@
+#pragma once
+
+#include "ta_common.h"
+
+/* Private side of the instrumentation (see ta_instr.h).
+ *
+ * When TA-Lib is built without TA_INSTRUMENT, all these macros are
+ * empty and the instrumentation has no cost.
+ *
+ * TA_INSTR_PROLOG/TA_INSTR_RETURN are used by the call wrappers of the
+ * registry (ta_registry_table.h), which all have the startIdx, endIdx
+ * and outNBElement parameters:
+ *
+ *    static TA_RetCode call_SMA( ... )
+ *    {
+ *       TA_INSTR_PROLOG( 123 );
+ *       TA_INSTR_RETURN( TA_SMA( startIdx, endIdx, ... ) );
+ *    }
+ *
+ * TA_INSTR_ALLOC is used by the allocations (ta_memory.c), they are
+ * counted for the function being called by the thread, if any.
+ */
+#ifdef TA_INSTRUMENT
+
+typedef struct
+{
+   int   funcIdx;
+   int   prevFuncIdx; /* For the calls within a call. */
+   Int64 start;       /* Nanoseconds. */
+} TA_InstrFrame;
+
+void TA_InstrBegin( TA_InstrFrame *frame, int funcIdx );
+void TA_InstrEnd( const TA_InstrFrame *frame, int startIdx, int endIdx,
+                  TA_RetCode retCode, const int *outNBElement );
+void TA_InstrAlloc( size_t size );
+
+#define TA_INSTR_PROLOG(funcIdx) \
+   TA_InstrFrame instrFrame; \
+   TA_InstrBegin( &instrFrame, funcIdx )
+
+#define TA_INSTR_RETURN(call) \
+   { \
+      TA_RetCode instrRetCode = call; \
+      TA_InstrEnd( &instrFrame, startIdx, endIdx, instrRetCode, outNBElement ); \
+      return instrRetCode; \
+   }
+
+#define TA_INSTR_ALLOC(size) TA_InstrAlloc(size)
+
+#else
+
+#define TA_INSTR_PROLOG(funcIdx)
+#define TA_INSTR_RETURN(call) return call
+#define TA_INSTR_ALLOC(size)
+
+#endif
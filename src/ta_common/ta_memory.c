@@ -0,0 +1,138 @@
+/* Description:
+ *   The allocator used by all the TA-Lib allocations (TA_Malloc,
+ *   TA_Realloc and TA_Free in ta_memory.h).
+ *
+ *   The default allocator calls malloc/realloc/free. The allocator
+ *   and the counters are kept outside of TA_Globals, so TA_Initialize()
+ *   and TA_Shutdown() do not change them.
+ *
+ *   The counters are updated by all the threads calling TA-Lib (OpenMP
+ *   loops, Python releasing the GIL), so with atomic operations.
+ */
+
+/**** Headers ****/
+#include <stdlib.h>
+
+#if defined(_WIN32)
+   #include <windows.h>
+#endif
+
+#include "ta_common.h"
+#include "ta_memory.h"
+#include "ta_instr_priv.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+
+/* Relaxed order: only the counts matter, not when the other threads
+ * see them. An unsigned long is a LONG on Windows.
+ */
+#if defined(_WIN32)
+   #define STATS_INC(counter)   InterlockedIncrement( (volatile LONG *)&(counter) )
+   #define STATS_GET(counter)   ((unsigned long)InterlockedCompareExchange( (volatile LONG *)&(counter), 0, 0 ))
+   #define STATS_RESET(counter) InterlockedExchange( (volatile LONG *)&(counter), 0 )
+#else
+   #define STATS_INC(counter)   __atomic_fetch_add( &(counter), 1, __ATOMIC_RELAXED )
+   #define STATS_GET(counter)   __atomic_load_n( &(counter), __ATOMIC_RELAXED )
+   #define STATS_RESET(counter) __atomic_store_n( &(counter), 0, __ATOMIC_RELAXED )
+#endif
+
+/**** Local functions declarations.    ****/
+static void *defaultAlloc( void *userData, size_t size );
+static void *defaultRealloc( void *userData, void *ptr, size_t size );
+static void  defaultFree( void *userData, void *ptr );
+
+/**** Local variables definitions.     ****/
+static TA_Allocator theAllocator = { defaultAlloc, defaultRealloc, defaultFree, NULL };
+static TA_AllocStats theStats = { 0, 0, 0 };
+
+/**** Global functions definitions.   ****/
+TA_RetCode TA_SetAllocator( const TA_Allocator *allocator )
+{
+   if( !allocator )
+   {
+      theAllocator.alloc    = defaultAlloc;
+      theAllocator.realloc  = defaultRealloc;
+      theAllocator.free     = defaultFree;
+      theAllocator.userData = NULL;
+      return TA_SUCCESS;
+   }
+
+   if( !allocator->alloc || !allocator->realloc || !allocator->free )
+      return TA_BAD_PARAM;
+
+   theAllocator = *allocator;
+   return TA_SUCCESS;
+}
+
+void TA_GetAllocStats( TA_AllocStats *stats )
+{
+   if( !stats )
+      return;
+
+   stats->nbAlloc   = STATS_GET( theStats.nbAlloc );
+   stats->nbRealloc = STATS_GET( theStats.nbRealloc );
+   stats->nbFree    = STATS_GET( theStats.nbFree );
+}
+
+void TA_ResetAllocStats( void )
+{
+   STATS_RESET( theStats.nbAlloc );
+   STATS_RESET( theStats.nbRealloc );
+   STATS_RESET( theStats.nbFree );
+}
+
+void *TA_AllocMem( size_t size )
+{
+   STATS_INC( theStats.nbAlloc );
+   TA_INSTR_ALLOC( size );
+   return theAllocator.alloc( theAllocator.userData, size );
+}
+
+/* Like realloc, a NULL ptr is an allocation. */
+void *TA_ReallocMem( void *ptr, size_t size )
+{
+   if( !ptr )
+      return TA_AllocMem( size );
+
+   STATS_INC( theStats.nbRealloc );
+   TA_INSTR_ALLOC( size );
+   return theAllocator.realloc( theAllocator.userData, ptr, size );
+}
+
+/* Like free, a NULL ptr is ignored (and not counted). */
+void TA_FreeMem( void *ptr )
+{
+   if( !ptr )
+      return;
+
+   STATS_INC( theStats.nbFree );
+   theAllocator.free( theAllocator.userData, ptr );
+}
+
+/**** Local functions definitions.     ****/
+static void *defaultAlloc( void *userData, size_t size )
+{
+   (void)userData;
+   return malloc( size );
+}
+
+static void *defaultRealloc( void *userData, void *ptr, size_t size )
+{
+   (void)userData;
+   return realloc( ptr, size );
+}
+
+static void defaultFree( void *userData, void *ptr )
+{
+   (void)userData;
+   free( ptr );
+}
@@ -5,10 +5,18 @@
 #include "ta_common.h"
 #include "ta_global.h"
 
-/* Interface macros */
-#define TA_Malloc(a)       malloc(a)
-#define TA_Realloc(a,b)    realloc((a),(b))
-#define TA_Free(a)         free(a)
+/* Interface macros
+ *
+ * All the allocations go through the allocator set with
+ * TA_SetAllocator() (see ta_common.h and ta_memory.c).
+ */
+#define TA_Malloc(a)       TA_AllocMem(a)
+#define TA_Realloc(a,b)    TA_ReallocMem((a),(b))
+#define TA_Free(a)         TA_FreeMem(a)
+
+void *TA_AllocMem( size_t size );
+void *TA_ReallocMem( void *ptr, size_t size );
+void  TA_FreeMem( void *ptr );
 
 #define FREE_IF_NOT_NULL(x) { if((x)!=NULL) {TA_Free((void *)(x)); (x)=NULL;} }
 
@@ -58,8 +66,10 @@
  * Depending of the language/platform, the globals might be in reality
  * a private member variable of an object...
  */
-#define TA_GLOBALS_UNSTABLE_PERIOD(x,y) (TA_Globals->unstablePeriod[x])
+#define TA_GLOBALS_UNSTABLE_PERIOD(x,y) (TA_Globals->unstablePeriod[x]+(((x) == TA_ThreadUnstable.id)? TA_ThreadUnstable.extra : 0))
 #define TA_GLOBALS_COMPATIBILITY        (TA_Globals->compatibility)
+#define TA_GLOBALS_PRECISION            (TA_Globals->precision)
+#define TA_GLOBALS_MISSING              (TA_Globals->missing)
 
 
 
@@ -27,6 +27,9 @@ static TA_InternalRetCodeInfo retCodeInfoTable[] = {
          {(TA_RetCode)14,"TA_INVALID_LIST_TYPE","No Info"},
          {(TA_RetCode)15,"TA_BAD_OBJECT","No Info"},
          {(TA_RetCode)16,"TA_NOT_SUPPORTED","No Info"},
+         {(TA_RetCode)17,"TA_IO_ERROR","File access failed"},
+         {(TA_RetCode)18,"TA_BAD_FILE_FORMAT","Invalid or unsupported file content"},
+         {(TA_RetCode)19,"TA_SETTINGS_MISMATCH","Saved with other settings"},
          {(TA_RetCode)5000,"TA_INTERNAL_ERROR","No Info"},
          {(TA_RetCode)0xFFFF,"TA_UNKNOWN_ERR","Unknown Error"}
 };
@@ -32,7 +32,7 @@ TA_RetCode TA_AD( int    startIdx,
    int nbBar, currentBar, outIdx;
 
    double high, low, close, tmp;
-   double ad;
+   double ad, adComp;
 
 #ifndef TA_FUNC_NO_RANGE_CHECK
 
@@ -76,6 +76,34 @@ TA_RetCode TA_AD( int    startIdx,
    outIdx = 0;
    ad = 0.0;
 
+   if( TA_GLOBALS_PRECISION == TA_PRECISION_COMPENSATED )
+   {
+      /* Same calculation with a compensated total
+       * (see TA_SetPrecision).
+       */
+      adComp = 0.0;
+      while( nbBar != 0 )
+      {
+         high  = inHigh[currentBar];
+         low   = inLow[currentBar];
+         tmp   = high-low;
+         close = inClose[currentBar];
+
+         if( tmp > 0.0 )
+         {
+            tmp = (((close-low)-(high-close))/tmp)*((double)inVolume[currentBar]);
+            TA_SUM_ADD( ad, adComp, tmp );
+         }
+
+         outReal[outIdx++] = ad+adComp;
+
+         currentBar++;
+         nbBar--;
+      }
+
+      return TA_SUCCESS;
+   }
+
    while( nbBar != 0 )
    {
       high  = inHigh[currentBar];
@@ -61,6 +61,8 @@ TA_RetCode TA_AVGDEV(	int    startIdx,
 {
    /* insert local variable here */
 	int today, outIdx, lookback;
+	TA_OrdStat window;
+	TA_RetCode retCode;
 
 #ifndef TA_FUNC_NO_RANGE_CHECK
 
@@ -102,6 +104,38 @@ TA_RetCode TA_AVGDEV(	int    startIdx,
 
 	outIdx = 0;
 
+	/* For a long period, keep the window sorted so the deviation
+	 * is O(log period) per output instead of O(period).
+	 */
+	if (optInTimePeriod >= TA_ORDSTAT_MIN_PERIOD) {
+		double theAverage;
+		int i;
+
+		retCode = TA_INT_OrdStatInit(&window, optInTimePeriod);
+		if (retCode != TA_SUCCESS) {
+			(*outBegIdx) = 0;
+			(*outNBElement) = 0;
+			return retCode;
+		}
+
+		for (i = today-lookback; i < today; i++)
+			TA_INT_OrdStatPush(&window, inReal[i]);
+
+		while (today <= endIdx) {
+			TA_INT_OrdStatPush(&window, inReal[today]);
+			theAverage = TA_INT_OrdStatSum(&window)/optInTimePeriod;
+			outReal[outIdx] = TA_INT_OrdStatAbsDev(&window, theAverage)/optInTimePeriod;
+
+			outIdx++;
+			today++;
+		}
+
+		TA_INT_OrdStatFree(&window);
+		(*outNBElement) = outIdx;
+
+		return TA_SUCCESS;
+	}
+
 	while (today <= endIdx) {
 	   	double todaySum, todayDev;
 		int i;
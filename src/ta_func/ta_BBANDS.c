@@ -12,6 +12,7 @@ int TA_BBANDS_Lookback( int           optInTimePeriod, /* From 2 to 100000 */
                       TA_MAType     optInMAType ) 
 {
    /* insert local variable here */
+   int lookbackMA, lookbackStdDev;
 
 #ifndef TA_FUNC_NO_RANGE_CHECK
    /* min/max are checked for optInTimePeriod. */
@@ -41,8 +42,14 @@ int TA_BBANDS_Lookback( int           optInTimePeriod, /* From 2 to 100000 */
    (void)optInNbDevUp;
    (void)optInNbDevDn;
 
-   /* The lookback is driven by the middle band moving average. */
-   return TA_MA_Lookback( optInTimePeriod, optInMAType );                          
+   /* The lookback is driven by the middle band moving average,
+    * or by the standard deviation when the average needs less
+    * bars than the period (MAMA).
+    */
+   lookbackMA     = TA_MA_Lookback( optInTimePeriod, optInMAType );
+   lookbackStdDev = TA_STDDEV_Lookback( optInTimePeriod, 1.0 );
+
+   return (lookbackMA > lookbackStdDev)? lookbackMA : lookbackStdDev;
 }
 
 /*
@@ -82,7 +89,7 @@ TA_RetCode TA_BBANDS( int    startIdx,
 {
    /* Insert local variables here. */
    TA_RetCode retCode;
-   int i;
+   int i, tempInt;
    double tempReal, tempReal2;
    ARRAY_REF(tempBuffer1);
    ARRAY_REF(tempBuffer2);
@@ -130,6 +137,19 @@ TA_RetCode TA_BBANDS( int    startIdx,
 
    /* Insert TA function code here. */
 
+   /* The standard deviation can need more bars than the
+    * middle band (see TA_BBANDS_Lookback).
+    */
+   tempInt = TA_STDDEV_Lookback( optInTimePeriod, 1.0 );
+   if( startIdx < tempInt )
+      startIdx = tempInt;
+   if( startIdx > endIdx )
+   {
+      *outBegIdx = 0;
+      *outNBElement = 0;
+      return TA_SUCCESS;
+   }
+
    /* Identify TWO temporary buffer among the outputs.
     *
     * These temporary buffers allows to perform the
@@ -185,10 +205,11 @@ TA_RetCode TA_BBANDS( int    startIdx,
    }
 
    /* Calculate the standard deviation into tempBuffer2. */
-   if( optInMAType == TA_MAType_SMA )
+   if( (optInMAType == TA_MAType_SMA) && (TA_GLOBALS_MISSING == TA_MISSING_NONE) )
    {
       /* A small speed optimization by re-using the
-       * already calculated SMA.
+       * already calculated SMA (not with missing bars,
+       * handled by TA_STDDEV).
        */
        TA_INT_stddev_using_precalc_ma( inReal, tempBuffer1, 
                                                    (int)(*outBegIdx), (int)(*outNBElement),
@@ -11,6 +11,11 @@ int TA_BBDist_Lookback(int           optInTimePeriod, /* From 2 to 100000 */
 {
     /* insert local variable here */
 
+#ifndef TA_FUNC_NO_RANGE_CHECK
+    if ((optInNbDev < -3.000000e+37) || (optInNbDev > 3.000000e+37))
+        return -1;
+#endif /* TA_FUNC_NO_RANGE_CHECK */
+
     /* insert lookback code here. */
     (void)optInNbDev;
 
@@ -73,14 +78,34 @@ TA_RetCode TA_BBDist(int    startIdx,
 
     /* Insert TA function code here. */
 
+    /* The outputs are used as temporary buffers, except the one
+     * that is also the input: the stddev still needs the input
+     * after the SMA is calculated.
+     */
     tempBuffer1 = outRealUDist;
     tempBuffer2 = outRealLDist;
+    if (tempBuffer1 == inReal)
+        ARRAY_ALLOC(tempBuffer1, endIdx - startIdx + 1);
+    else if (tempBuffer2 == inReal)
+        ARRAY_ALLOC(tempBuffer2, endIdx - startIdx + 1);
+
+    if (!tempBuffer1 || !tempBuffer2)
+    {
+        *outBegIdx = 0;
+        *outNBElement = 0;
+        return TA_ALLOC_ERR;
+    }
 
     retCode = TA_INT_SMA(startIdx, endIdx, inReal,
         optInTimePeriod, outBegIdx, outNBElement, tempBuffer1);
 
     if ((retCode != TA_SUCCESS) || ((*outNBElement) == 0))
     {
+        if (tempBuffer1 != outRealUDist)
+            ARRAY_FREE(tempBuffer1);
+        if (tempBuffer2 != outRealLDist)
+            ARRAY_FREE(tempBuffer2);
+        *outBegIdx = 0;
         *outNBElement = 0;
         return retCode;
     }
@@ -95,9 +120,18 @@ TA_RetCode TA_BBDist(int    startIdx,
         tempClose = inReal[*outBegIdx + i];
         tempWidth = tempBuffer2[i] * optInNbDev;
         tempUp = tempBuffer1[i] + tempWidth;
-        outRealUDist[i] = (tempClose - tempUp) * 50 / tempWidth;
+        /* A flat window has no width: the close is the middle band. */
+        if (TA_IS_ZERO(tempWidth))
+            outRealUDist[i] = -50;
+        else
+            outRealUDist[i] = (tempClose - tempUp) * 50 / tempWidth;
         outRealLDist[i] = 100 + outRealUDist[i];
     }
 
+    if (tempBuffer1 != outRealUDist)
+        ARRAY_FREE(tempBuffer1);
+    if (tempBuffer2 != outRealLDist)
+        ARRAY_FREE(tempBuffer2);
+
     return TA_SUCCESS;
 }
@@ -11,6 +11,11 @@ int TA_BBWidth_Lookback(int           optInTimePeriod, /* From 2 to 100000 */
 {
     /* insert local variable here */
 
+#ifndef TA_FUNC_NO_RANGE_CHECK
+    if ((optInNbDev < -3.000000e+37) || (optInNbDev > 3.000000e+37))
+        return -1;
+#endif /* TA_FUNC_NO_RANGE_CHECK */
+
     /* insert lookback code here. */
     (void)optInNbDev;
 
@@ -72,13 +77,29 @@ TA_RetCode TA_BBWidth(int    startIdx,
 
     /* Insert TA function code here. */
 
+    /* The output is used for the SMA, unless it is also the
+     * input (still needed by the stddev).
+     */
     tempBuffer1 = outRealWidth;
+    if (tempBuffer1 == inReal)
+    {
+        ARRAY_ALLOC(tempBuffer1, endIdx - startIdx + 1);
+        if (!tempBuffer1)
+        {
+            *outBegIdx = 0;
+            *outNBElement = 0;
+            return TA_ALLOC_ERR;
+        }
+    }
 
     retCode = TA_INT_SMA(startIdx, endIdx, inReal,
         optInTimePeriod, outBegIdx, outNBElement, tempBuffer1);
 
     if ((retCode != TA_SUCCESS) || ((*outNBElement) == 0))
     {
+        if (tempBuffer1 != outRealWidth)
+            ARRAY_FREE(tempBuffer1);
+        *outBegIdx = 0;
         *outNBElement = 0;
         return retCode;
     }
@@ -87,6 +108,9 @@ TA_RetCode TA_BBWidth(int    startIdx,
 
     if (!tempBuffer2)
     {
+        if (tempBuffer1 != outRealWidth)
+            ARRAY_FREE(tempBuffer1);
+        *outBegIdx = 0;
         *outNBElement = 0;
         return TA_ALLOC_ERR;
     }
@@ -104,6 +128,8 @@ TA_RetCode TA_BBWidth(int    startIdx,
     }
 
     ARRAY_FREE(tempBuffer2);
+    if (tempBuffer1 != outRealWidth)
+        ARRAY_FREE(tempBuffer1);
 
     return TA_SUCCESS;
 }
@@ -22,6 +22,9 @@ int TA_BETA_Lookback( int           optInTimePeriod )  /* From 1 to 100000 */
    return optInTimePeriod;
 }
 
+/* Change from the previous price, zero when the previous price is zero. */
+#define BETA_CHANGE(price,lastPrice) (!TA_IS_ZERO(lastPrice)? ((price)-(lastPrice))/(lastPrice) : 0.0)
+
 /*
  * TA_BETA - Beta
  * 
@@ -56,6 +59,8 @@ TA_RetCode TA_BETA( int    startIdx,
     double x; /* the 'x' value, which is the last change between values in inReal0 */
     double y; /* the 'y' value, which is the last change between values in inReal1 */
     double n = 0.0f;
+    double comp_xx = 0.0, comp_xy = 0.0, comp_x = 0.0, comp_y = 0.0; /* compensations of the sums, TA_PRECISION_COMPENSATED only */
+    double sum_x;
     int i, outIdx;
     int trailingIdx, nbInitialElementNeeded;
 
@@ -114,6 +119,74 @@ TA_RetCode TA_BETA( int    startIdx,
       return TA_SUCCESS;
    }   
 
+   if( TA_GLOBALS_PRECISION == TA_PRECISION_COMPENSATED )
+   {
+      /* Same calculation with compensated sums and exact
+       * products (see TA_SetPrecision).
+       */
+      trailingIdx = startIdx-nbInitialElementNeeded;
+      last_price_x = trailing_last_price_x = inReal0[trailingIdx];
+      last_price_y = trailing_last_price_y = inReal1[trailingIdx];
+
+      i = ++trailingIdx;
+      while( i < startIdx )
+      {
+         x = BETA_CHANGE( inReal0[i], last_price_x );
+         y = BETA_CHANGE( inReal1[i], last_price_y );
+         last_price_x = inReal0[i];
+         last_price_y = inReal1[i++];
+
+         TA_SUM_ADD_PRODUCT( S_xx, comp_xx, x, x );
+         TA_SUM_ADD_PRODUCT( S_xy, comp_xy, x, y );
+         TA_SUM_ADD( S_x, comp_x, x );
+         TA_SUM_ADD( S_y, comp_y, y );
+      }
+
+      outIdx = 0;
+      n = (double)optInTimePeriod;
+      do
+      {
+         x = BETA_CHANGE( inReal0[i], last_price_x );
+         y = BETA_CHANGE( inReal1[i], last_price_y );
+         last_price_x = inReal0[i];
+         last_price_y = inReal1[i++];
+
+         TA_SUM_ADD_PRODUCT( S_xx, comp_xx, x, x );
+         TA_SUM_ADD_PRODUCT( S_xy, comp_xy, x, y );
+         TA_SUM_ADD( S_x, comp_x, x );
+         TA_SUM_ADD( S_y, comp_y, y );
+
+         /* Always read the trailing before writing the output because the input and output
+          * buffer can be the same.
+          */
+         x = BETA_CHANGE( inReal0[trailingIdx], trailing_last_price_x );
+         y = BETA_CHANGE( inReal1[trailingIdx], trailing_last_price_y );
+         trailing_last_price_x = inReal0[trailingIdx];
+         trailing_last_price_y = inReal1[trailingIdx++];
+
+         /* Write the output */
+         sum_x = S_x+comp_x;
+         tmp_real = (n * (S_xx+comp_xx)) - (sum_x * sum_x);
+         if( !TA_IS_ZERO(tmp_real) )
+            outReal[outIdx++] = ((n * (S_xy+comp_xy)) - (sum_x * (S_y+comp_y))) / tmp_real;
+         else
+            outReal[outIdx++] = 0.0;
+
+         /* Remove the calculation starting with the trailingIdx. */
+         tmp_real = -x;
+         TA_SUM_ADD_PRODUCT( S_xx, comp_xx, tmp_real, x );
+         TA_SUM_ADD_PRODUCT( S_xy, comp_xy, tmp_real, y );
+         TA_SUM_ADD( S_x, comp_x, tmp_real );
+         tmp_real = -y;
+         TA_SUM_ADD( S_y, comp_y, tmp_real );
+      } while( i <= endIdx );
+
+      *outNBElement = outIdx;
+      *outBegIdx = startIdx;
+
+      return TA_SUCCESS;
+   }
+
    /* Consume first input. */
    trailingIdx = startIdx-nbInitialElementNeeded;
    last_price_x = trailing_last_price_x = inReal0[trailingIdx];
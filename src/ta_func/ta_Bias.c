@@ -11,11 +11,17 @@ int TA_Bias_Lookback(int           optInTimePeriod1,
     int           optInTimePeriod2Shift)
 {
     /* insert local variable here */
+    int lookback1, lookback2;
 
     /* insert lookback code here. */
-    (void)optInTimePeriod1;
+    lookback1 = TA_SmaExt_Lookback(optInTimePeriod1, 0);
+    lookback2 = TA_SmaExt_Lookback(optInTimePeriod2, optInTimePeriod2Shift);
 
-    return max(TA_SmaExt_Lookback(optInTimePeriod1, 0), TA_SmaExt_Lookback(optInTimePeriod2, optInTimePeriod2Shift));
+    /* -1 when one of the periods is invalid. */
+    if ((lookback1 < 0) || (lookback2 < 0))
+        return -1;
+
+    return max(lookback1, lookback2);
 }
 
 /*
@@ -83,6 +89,7 @@ TA_RetCode TA_Bias(int    startIdx,
 
     if (!tempBuffer1)
     {
+        *outBegIdx = 0;
         *outNBElement = 0;
         return TA_ALLOC_ERR;
     }
@@ -92,6 +99,7 @@ TA_RetCode TA_Bias(int    startIdx,
     if (!tempBuffer2)
     {
         ARRAY_FREE(tempBuffer1);
+        *outBegIdx = 0;
         *outNBElement = 0;
         return TA_ALLOC_ERR;
     }
@@ -104,6 +112,7 @@ TA_RetCode TA_Bias(int    startIdx,
         ARRAY_FREE(tempBuffer1);
         ARRAY_FREE(tempBuffer2);
 
+        *outBegIdx = 0;
         *outNBElement = 0;
         return retCode;
     }
@@ -116,6 +125,7 @@ TA_RetCode TA_Bias(int    startIdx,
         ARRAY_FREE(tempBuffer1);
         ARRAY_FREE(tempBuffer2);
 
+        *outBegIdx = 0;
         *outNBElement = 0;
         return retCode;
     }
@@ -50,6 +50,8 @@ TA_RetCode TA_CCI( int    startIdx,
 	/* insert local variable here */
    double tempReal, tempReal2, theAverage, lastValue;
    int i, j, outIdx, lookbackTotal;
+   TA_OrdStat window;
+   TA_RetCode retCode;
 
    /* This ptr will points on a circular buffer of
     * at least "optInTimePeriod" element.
@@ -100,6 +102,48 @@ TA_RetCode TA_CCI( int    startIdx,
       return TA_SUCCESS;
    }
 
+   /* For a long period, keep the window sorted so the mean
+    * deviation is O(log period) per output instead of O(period).
+    */
+   if( optInTimePeriod >= TA_ORDSTAT_MIN_PERIOD )
+   {
+      retCode = TA_INT_OrdStatInit( &window, optInTimePeriod );
+      if( retCode != TA_SUCCESS )
+      {
+         *outBegIdx = 0;
+         *outNBElement = 0;
+         return retCode;
+      }
+
+      for( i=startIdx-lookbackTotal; i < startIdx; i++ )
+         TA_INT_OrdStatPush( &window, (inHigh[i]+inLow[i]+inClose[i])/3 );
+
+      outIdx = 0;
+      do
+      {
+         lastValue = (inHigh[i]+inLow[i]+inClose[i])/3;
+         TA_INT_OrdStatPush( &window, lastValue );
+
+         theAverage = TA_INT_OrdStatSum( &window )/optInTimePeriod;
+         tempReal2  = TA_INT_OrdStatAbsDev( &window, theAverage );
+         tempReal   = lastValue-theAverage;
+
+         if( (tempReal != 0.0) && (tempReal2 != 0.0) )
+            outReal[outIdx++] = tempReal/(0.015*(tempReal2/optInTimePeriod));
+         else
+            outReal[outIdx++] = 0.0;
+
+         i++;
+      } while( i <= endIdx );
+
+      TA_INT_OrdStatFree( &window );
+
+      *outNBElement = outIdx;
+      *outBegIdx    = startIdx;
+
+      return TA_SUCCESS;
+   }
+
    /* Allocate a circular buffer equal to the requested
     * period.
     */
@@ -47,7 +47,7 @@ TA_RetCode TA_CORREL( int    startIdx,
 {
 	/* insert local variable here */
     double sumXY, sumX, sumY, sumX2, sumY2, x, y, trailingX, trailingY;
-    double tempReal;
+    double tempReal, compXY, compX, compY, compX2, compY2;
     int lookbackTotal, today, trailingIdx, outIdx;
 
 #ifndef TA_FUNC_NO_RANGE_CHECK
@@ -91,6 +91,70 @@ TA_RetCode TA_CORREL( int    startIdx,
    *outBegIdx  = startIdx;
    trailingIdx = startIdx - lookbackTotal;
 
+   if( TA_GLOBALS_PRECISION == TA_PRECISION_COMPENSATED )
+   {
+      /* Same calculation with compensated sums and exact
+       * products (see TA_SetPrecision).
+       */
+      sumXY = sumX = sumY = sumX2 = sumY2 = 0.0;
+      compXY = compX = compY = compX2 = compY2 = 0.0;
+      for( today=trailingIdx; today <= startIdx; today++ )
+      {
+         x = inReal0[today];
+         TA_SUM_ADD( sumX, compX, x );
+         TA_SUM_ADD_PRODUCT( sumX2, compX2, x, x );
+
+         y = inReal1[today];
+         TA_SUM_ADD_PRODUCT( sumXY, compXY, x, y );
+         TA_SUM_ADD( sumY, compY, y );
+         TA_SUM_ADD_PRODUCT( sumY2, compY2, y, y );
+      }
+
+      outIdx = 0;
+      for( ;; )
+      {
+         /* Save first the trailing values since the input
+          * and output might be the same array,
+          */
+         trailingX = inReal0[trailingIdx];
+         trailingY = inReal1[trailingIdx++];
+         x = sumX+compX;
+         y = sumY+compY;
+         tempReal = ((sumX2+compX2)-((x*x)/optInTimePeriod)) * ((sumY2+compY2)-((y*y)/optInTimePeriod));
+         if( !TA_IS_ZERO_OR_NEG(tempReal) )
+            outReal[outIdx++] = ((sumXY+compXY)-((x*y)/optInTimePeriod)) / std_sqrt(tempReal);
+         else
+            outReal[outIdx++] = 0.0;
+
+         if( today > endIdx )
+            break;
+
+         /* Remove trailing values */
+         x = -trailingX;
+         TA_SUM_ADD( sumX, compX, x );
+         TA_SUM_ADD_PRODUCT( sumX2, compX2, x, trailingX );
+
+         TA_SUM_ADD_PRODUCT( sumXY, compXY, x, trailingY );
+         y = -trailingY;
+         TA_SUM_ADD( sumY, compY, y );
+         TA_SUM_ADD_PRODUCT( sumY2, compY2, y, trailingY );
+
+         /* Add new values */
+         x = inReal0[today];
+         TA_SUM_ADD( sumX, compX, x );
+         TA_SUM_ADD_PRODUCT( sumX2, compX2, x, x );
+
+         y = inReal1[today++];
+         TA_SUM_ADD_PRODUCT( sumXY, compXY, x, y );
+         TA_SUM_ADD( sumY, compY, y );
+         TA_SUM_ADD_PRODUCT( sumY2, compY2, y, y );
+      }
+
+      *outNBElement = outIdx;
+
+      return TA_SUCCESS;
+   }
+
    /* Calculate the initial values. */
    sumXY = sumX = sumY = sumX2 = sumY2 = 0.0;
    for( today=trailingIdx; today <= startIdx; today++ )
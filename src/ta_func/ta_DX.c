@@ -54,7 +54,7 @@ TA_RetCode TA_DX( int    startIdx,
    double prevHigh, prevLow, prevClose;
    double prevMinusDM, prevPlusDM, prevTR;
    double tempReal, tempReal2, diffP, diffM;
-   double minusDI, plusDI;
+   double minusDI, plusDI, prevDX;
 
    int i;
 
@@ -224,6 +224,7 @@ TA_RetCode TA_DX( int    startIdx,
    prevMinusDM = 0.0;
    prevPlusDM  = 0.0;
    prevTR      = 0.0;
+   prevDX      = 0.0;
    today       = startIdx - lookbackTotal;
    prevHigh    = inHigh[today];
    prevLow     = inLow[today];
@@ -258,6 +259,10 @@ TA_RetCode TA_DX( int    startIdx,
 
    /* Skip the unstable period. Note that this loop must be executed
     * at least ONCE to calculate the first DI.
+    *
+    * The DX is tracked here too: when the DI are all zero, the
+    * last DX is repeated, so that value must come from the bars
+    * processed, not from the previous output.
     */
    i = TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_DX,Dx) + 1;
    while( i-- != 0 )
@@ -290,21 +295,19 @@ TA_RetCode TA_DX( int    startIdx,
       TRUE_RANGE(prevHigh,prevLow,prevClose,tempReal);
       prevTR = prevTR - (prevTR/optInTimePeriod) + tempReal;
       prevClose = inClose[today];
+
+      if( !TA_IS_ZERO(prevTR) )
+      {
+         minusDI = round_pos(100.0*(prevMinusDM/prevTR));
+         plusDI  = round_pos(100.0*(prevPlusDM/prevTR));
+         tempReal = minusDI+plusDI;
+         if( !TA_IS_ZERO(tempReal) )
+            prevDX = round_pos( 100.0 * (std_fabs(minusDI-plusDI)/tempReal) );
+      }
    }
 
    /* Write the first DX output */
-   if( !TA_IS_ZERO(prevTR) )
-   {
-      minusDI = round_pos(100.0*(prevMinusDM/prevTR));
-      plusDI  = round_pos(100.0*(prevPlusDM/prevTR));
-      tempReal = minusDI+plusDI;
-      if( !TA_IS_ZERO(tempReal) )
-         outReal[0] = round_pos( 100.0 * (std_fabs(minusDI-plusDI)/tempReal) );
-      else
-         outReal[0] = 0.0;
-   }
-   else
-      outReal[0] = 0.0;
+   outReal[0] = prevDX;
    outIdx = 1;
 
    while( today < endIdx )
@@ -343,16 +346,11 @@ TA_RetCode TA_DX( int    startIdx,
       {
          minusDI = round_pos(100.0*(prevMinusDM/prevTR));
          plusDI  = round_pos(100.0*(prevPlusDM/prevTR));
-         /* This loop is just to accumulate the initial DX */
          tempReal = minusDI+plusDI;
-         if( !TA_IS_ZERO(tempReal))         
-            outReal[outIdx] = round_pos( 100.0 * (std_fabs(minusDI-plusDI)/tempReal) );
-         else
-            outReal[outIdx] = outReal[outIdx-1];
+         if( !TA_IS_ZERO(tempReal) )
+            prevDX = round_pos( 100.0 * (std_fabs(minusDI-plusDI)/tempReal) );
       }
-      else
-         outReal[outIdx] = outReal[outIdx-1];
-      outIdx++;
+      outReal[outIdx++] = prevDX;
    }
 
    *outNBElement = outIdx;
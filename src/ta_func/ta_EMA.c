@@ -68,6 +68,11 @@ TA_RetCode TA_EMA( int    startIdx,
 
    /* Insert TA function code here. */
 
+   if( TA_GLOBALS_MISSING != TA_MISSING_NONE )
+      return TA_INT_EMA_Missing( startIdx, endIdx, inReal, NULL, TA_GLOBALS_MISSING,
+                                 optInTimePeriod, PER_TO_K( optInTimePeriod ),
+                                 outBegIdx, outNBElement, outReal, NULL );
+
    /* Simply call the internal implementation of the EMA. */
    return TA_INT_EMA( startIdx, endIdx, inReal, 
                                   optInTimePeriod,
@@ -109,7 +114,7 @@ TA_RetCode TA_INT_EMA( int               startIdx,
    /* Identify the minimum number of price bar needed
     * to calculate at least one output.
     */
-   lookbackTotal = TA_EMA_Lookback( optInTimePeriod );
+   lookbackTotal = TA_INT_EMA_LOOKBACK( optInTimePeriod );
 
    /* Move up the start index if there is not
     * enough initial data.
@@ -191,3 +196,85 @@ TA_RetCode TA_INT_EMA( int               startIdx,
 
    return TA_SUCCESS;
 }
+
+/* Same as TA_INT_EMA with the missing bars of the policy (see
+ * TA_SetMissingPolicy). After a restart, the EMA is seeded again
+ * like at the start of the input, and the output is valid once
+ * lookbackTotal+1 values entered it, which includes the unstable
+ * period.
+ */
+TA_RetCode TA_INT_EMA_Missing( int                  startIdx,
+                               int                  endIdx,
+                               const double        *inReal,
+                               const unsigned char *inValid,
+                               TA_MissingPolicy     policy,
+                               int                  optInTimePeriod,
+                               double               optInK_1,
+                               int                 *outBegIdx,
+                               int                 *outNBElement,
+                               double              *outReal,
+                               unsigned char       *outValid )
+{
+   TA_Missing missing;
+   double tempReal, periodTotal, prevMA;
+   int today, beginIdx, outIdx, lookbackTotal, nbValue, step;
+
+   lookbackTotal = TA_INT_EMA_LOOKBACK( optInTimePeriod );
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   if( startIdx > endIdx )
+   {
+      *outBegIdx = 0;
+      *outNBElement = 0;
+      return TA_SUCCESS;
+   }
+
+   /* The Metastock seed is the first bar of all the input. */
+   if( TA_GLOBALS_COMPATIBILITY == TA_COMPATIBILITY_DEFAULT )
+      beginIdx = TA_INT_MissingBegin( inReal, inValid, policy, startIdx, lookbackTotal );
+   else
+      beginIdx = 0;
+   TA_INT_MissingInit( &missing, inReal, inValid, policy, beginIdx );
+
+   /* Same operations as TA_INT_EMA when no bar is missing. */
+   tempReal = periodTotal = prevMA = 0.0;
+   nbValue = 0;
+   outIdx = 0;
+   for( today=beginIdx; today <= endIdx; today++ )
+   {
+      TA_MISSING_NEXT( missing, tempReal, step );
+      if( step == TA_MISSING_STEP_RESTART )
+      {
+         periodTotal = 0.0;
+         nbValue = 0;
+      }
+      else if( step == TA_MISSING_STEP_PUSH )
+      {
+         nbValue++;
+         if( TA_GLOBALS_COMPATIBILITY != TA_COMPATIBILITY_DEFAULT )
+            prevMA = (nbValue == 1)? tempReal : ((tempReal-prevMA)*optInK_1) + prevMA;
+         else if( nbValue < optInTimePeriod )
+            periodTotal += tempReal;
+         else if( nbValue == optInTimePeriod )
+         {
+            periodTotal += tempReal;
+            prevMA = periodTotal / optInTimePeriod;
+         }
+         else
+            prevMA = ((tempReal-prevMA)*optInK_1) + prevMA;
+      }
+
+      if( today >= startIdx )
+      {
+         TA_MISSING_OUTPUT( outReal, outValid, outIdx, prevMA,
+                            (step == TA_MISSING_STEP_PUSH) && (nbValue > lookbackTotal) );
+         outIdx++;
+      }
+   }
+
+   *outNBElement = outIdx;
+   *outBegIdx = startIdx;
+
+   return TA_SUCCESS;
+}
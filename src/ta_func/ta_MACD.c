@@ -54,7 +54,7 @@ int TA_MACD_Lookback( int           optInFastPeriod, /* From 2 to 100000 */
    }
 
    return   TA_EMA_Lookback( optInSlowPeriod   )
-          + TA_EMA_Lookback( optInSignalPeriod );
+          + TA_INT_EMA_LOOKBACK( optInSignalPeriod );
 }
 
 /*
@@ -218,7 +218,7 @@ TA_RetCode TA_INT_MACD( int    startIdx,
       k2 = (double)0.15; /* Fix 12 */
    }
 
-   lookbackSignal = TA_EMA_Lookback( optInSignalPeriod_2 ); 
+   lookbackSignal = TA_INT_EMA_LOOKBACK( optInSignalPeriod_2 ); 
 
    /* Move up the start index if there is not
     * enough initial data.
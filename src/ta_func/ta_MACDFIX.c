@@ -27,7 +27,7 @@ int TA_MACDFIX_Lookback( int           optInSignalPeriod )  /* From 1 to 100000
     *  by the fix 26 period EMA).
     */
    return   TA_EMA_Lookback( 26 )
-          + TA_EMA_Lookback( optInSignalPeriod );
+          + TA_INT_EMA_LOOKBACK( optInSignalPeriod );
 }
 
 /*
@@ -32,6 +32,10 @@ int TA_MAVP_Lookback( int           optInMinPeriod, /* From 2 to 100000 */
 
 #endif /* TA_FUNC_NO_RANGE_CHECK */
 
+   /* Same swap as TA_MAVP. */
+   if( optInMaxPeriod < optInMinPeriod )
+      optInMaxPeriod = optInMinPeriod;
+
    return TA_MA_Lookback(optInMaxPeriod, optInMAType);
 }
 
@@ -107,6 +111,16 @@ TA_RetCode TA_MAVP( int    startIdx,
 
    /* Insert TA function code here. */
 
+   /* Make sure max is really bigger than min! if not,
+    * swap... (the lookback is from the max).
+    */
+   if( optInMaxPeriod < optInMinPeriod )
+   {
+      tempInt        = optInMaxPeriod;
+      optInMaxPeriod = optInMinPeriod;
+      optInMinPeriod = tempInt;
+   }
+
    /* Identify the minimum number of price bar needed
     * to calculate at least one output.
     */
@@ -111,10 +111,11 @@ TA_RetCode TA_MAXINDEX( int    startIdx,
         highestIdx = trailingIdx;
         highest = inReal[highestIdx];
         i = highestIdx;
+        /* The last of the equal values, as when a new value is added. */
         while( ++i<=today )
         {
            tmp = inReal[i];
-           if( tmp > highest )
+           if( tmp >= highest )
            {
               highestIdx = i;
               highest = tmp;
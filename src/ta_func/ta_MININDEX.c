@@ -111,10 +111,11 @@ TA_RetCode TA_MININDEX( int    startIdx,
         lowestIdx = trailingIdx;
         lowest = inReal[lowestIdx];
         i = lowestIdx;
+        /* The last of the equal values, as when a new value is added. */
         while( ++i<=today )
         {
            tmp = inReal[i];
-           if( tmp < lowest )
+           if( tmp <= lowest )
            {
               lowestIdx = i;
               lowest = tmp;
@@ -117,10 +117,11 @@ TA_RetCode TA_MINMAXINDEX( int    startIdx,
         highestIdx = trailingIdx;
         highest = inReal[highestIdx];
         i = highestIdx;
+        /* The last of the equal values, as when a new value is added. */
         while( ++i<=today )
         {
            tmpHigh = inReal[i];
-           if( tmpHigh > highest )
+           if( tmpHigh >= highest )
            {
               highestIdx = i;
               highest = tmpHigh;
@@ -138,10 +139,11 @@ TA_RetCode TA_MINMAXINDEX( int    startIdx,
         lowestIdx = trailingIdx;
         lowest = inReal[lowestIdx];
         i = lowestIdx;
+        /* The last of the equal values, as when a new value is added. */
         while( ++i<=today )
         {
            tmpLow = inReal[i];
-           if( tmpLow < lowest )
+           if( tmpLow <= lowest )
            {
               lowestIdx = i;
               lowest = tmpLow;
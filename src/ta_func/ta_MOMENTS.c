@@ -0,0 +1,255 @@
+#include <string.h>
+#include <math.h>
+#include "ta_func.h"
+
+#include "ta_utility.h"
+#include "ta_memory.h"
+
+/* The sums of the moments are done again directly from the window
+ * every max(period,MOMENTS_ANCHOR) bars, so the rounding errors of
+ * the updates do not grow with the number of bars. Also when the
+ * mean moved away from their shift by more than sqrt(MOMENTS_DRIFT)
+ * standard deviations (the cancellation grows with the distance),
+ * and when M2 falls under MOMENTS_DROP times its highest value since
+ * then (the errors are relative to the largest deviations seen).
+ */
+#define MOMENTS_ANCHOR 4096
+#define MOMENTS_DRIFT  4.0
+#define MOMENTS_DROP   1e-2
+
+int TA_MOMENTS_Lookback( int           optInTimePeriod )  /* From 2 to 100000 */
+{
+   /* insert local variable here */
+
+#ifndef TA_FUNC_NO_RANGE_CHECK
+   /* min/max are checked for optInTimePeriod. */
+   if( (int)optInTimePeriod == TA_INTEGER_DEFAULT )
+      optInTimePeriod = 20;
+   else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+      return -1;
+
+#endif /* TA_FUNC_NO_RANGE_CHECK */
+
+   /* insert lookback code here. */
+   return optInTimePeriod-1;
+}
+
+/*
+ * TA_MOMENTS - Rolling Moments (mean, variance, std dev, skewness, kurtosis, z-score)
+ *
+ * Input  = double
+ * Output = double, double, double, double, double, double
+ *
+ * Optional Parameters
+ * -------------------
+ * optInTimePeriod:(From 2 to 100000)
+ *    Number of period
+ *
+ *
+ */
+TA_RetCode TA_MOMENTS( int    startIdx,
+                       int    endIdx,
+                       const double inReal[],
+                       int           optInTimePeriod, /* From 2 to 100000 */
+                       int          *outBegIdx,
+                       int          *outNBElement,
+                       double        outMean[],
+                       double        outVar[],
+                       double        outStdDev[],
+                       double        outSkew[],
+                       double        outKurt[],
+                       double        outZScore[] )
+{
+	/* insert local variable here */
+
+#ifndef TA_FUNC_NO_RANGE_CHECK
+
+   /* Validate the requested output range. */
+   if( startIdx < 0 )
+      return TA_OUT_OF_RANGE_START_INDEX;
+   if( (endIdx < 0) || (endIdx < startIdx))
+      return TA_OUT_OF_RANGE_END_INDEX;
+
+   if( !inReal ) return TA_BAD_PARAM;
+      /* min/max are checked for optInTimePeriod. */
+   if( (int)optInTimePeriod == TA_INTEGER_DEFAULT )
+      optInTimePeriod = 20;
+   else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+      return TA_BAD_PARAM;
+
+   if( !outMean )
+      return TA_BAD_PARAM;
+
+   if( !outVar )
+      return TA_BAD_PARAM;
+
+   if( !outStdDev )
+      return TA_BAD_PARAM;
+
+   if( !outSkew )
+      return TA_BAD_PARAM;
+
+   if( !outKurt )
+      return TA_BAD_PARAM;
+
+   if( !outZScore )
+      return TA_BAD_PARAM;
+
+#endif /* TA_FUNC_NO_RANGE_CHECK */
+
+   /* Insert TA function code here. */
+   return TA_INT_MOMENTS( startIdx, endIdx, inReal, optInTimePeriod,
+                          outBegIdx, outNBElement, outMean, outVar, outStdDev,
+                          outSkew, outKurt, outZScore );
+}
+
+TA_RetCode TA_INT_MOMENTS( int           startIdx,
+                           int           endIdx,
+                           const double *inReal,
+                           int           optInTimePeriod,
+                           int          *outBegIdx,
+                           int          *outNBElement,
+                           double       *outMean,
+                           double       *outVar,
+                           double       *outStdDev,
+                           double       *outSkew,
+                           double       *outKurt,
+                           double       *outZScore )
+{
+   TA_Moments moments;
+   double tempReal, prevReal, mean, variance, stdDev, skew, kurt, zScore;
+   double m2, m3, m4, peakM2, invStdDev, invVar;
+   int today, outIdx, nbInitialElementNeeded, nanIdx, nbSame, syncIdx, anchor;
+
+   /* With n values in the window:
+    *    variance = M2/n              (population, same as TA_VAR)
+    *    skew     = (M3/n)/variance^1.5
+    *    kurt     = (M4/n)/variance^2 - 3  (excess kurtosis)
+    *    zScore   = (value-mean)/stdDev
+    *
+    * The skew, kurt and zScore are 0 when all the values of the
+    * window are equal (counted exactly, not from the moments), and
+    * all the outputs are NaN while a NaN is in the window.
+    */
+   nbInitialElementNeeded = (optInTimePeriod-1);
+
+   /* Move up the start index if there is not
+    * enough initial data.
+    */
+   if( startIdx < nbInitialElementNeeded )
+      startIdx = nbInitialElementNeeded;
+
+   /* Make sure there is still something to evaluate. */
+   if( startIdx > endIdx )
+   {
+      *outBegIdx = 0;
+      *outNBElement = 0;
+      return TA_SUCCESS;
+   }
+
+   anchor = (optInTimePeriod > MOMENTS_ANCHOR)? optInTimePeriod : MOMENTS_ANCHOR;
+
+   /* Last NaN, and nb of equal values up to the bar before startIdx. */
+   nanIdx   = startIdx-optInTimePeriod-1;
+   nbSame   = 0;
+   prevReal = 0.0;
+   for( today=startIdx-nbInitialElementNeeded; today < startIdx; today++ )
+   {
+      tempReal = inReal[today];
+      if( tempReal != tempReal )
+         nanIdx = today;
+      nbSame = (nbSame && (tempReal == prevReal))? nbSame+1 : 1;
+      prevReal = tempReal;
+   }
+
+   /* Proceed with the calculation for the requested range.
+    * All the inputs needed by a bar (and the value leaving the
+    * window at the next one) are read before its outputs are
+    * written, so the input and the outputs can be the same buffers.
+    */
+   memset( &moments, 0, sizeof(moments) );
+   peakM2  = 0.0;
+   syncIdx = startIdx;
+   outIdx  = 0;
+   while( today <= endIdx )
+   {
+      tempReal = inReal[today];
+      if( tempReal != tempReal )
+         nanIdx = today;
+      nbSame = (tempReal == prevReal)? nbSame+1 : 1;
+      prevReal = tempReal;
+
+      if( today-nanIdx < optInTimePeriod )
+      {
+         /* Start again from the window when the NaN leaves it. */
+         mean = variance = stdDev = skew = kurt = zScore = NAN;
+         syncIdx = nanIdx+optInTimePeriod;
+      }
+      else
+      {
+         if( nbSame >= optInTimePeriod )
+         {
+            /* All the values are equal, the moments are exact. */
+            moments.n     = (double)optInTimePeriod;
+            moments.shift = tempReal;
+            moments.s1    = moments.s2 = moments.s3 = moments.s4 = 0.0;
+            TA_INT_MomentsCentral( &moments, &mean, &m2, &m3, &m4 );
+            peakM2 = 0.0;
+         }
+         else
+         {
+            if( today < syncIdx )
+            {
+               TA_INT_MomentsAdd( &moments, tempReal );
+               TA_INT_MomentsCentral( &moments, &mean, &m2, &m3, &m4 );
+               if( m2 > peakM2 )
+                  peakM2 = m2;
+               if( (m2 < MOMENTS_DROP*peakM2) ||
+                   ((mean-moments.shift)*(mean-moments.shift)*optInTimePeriod > MOMENTS_DRIFT*m2) )
+                  syncIdx = today;
+            }
+
+            if( today >= syncIdx )
+            {
+               TA_INT_MomentsSet( &moments, &inReal[today-nbInitialElementNeeded], optInTimePeriod );
+               TA_INT_MomentsCentral( &moments, &mean, &m2, &m3, &m4 );
+               peakM2  = m2;
+               syncIdx = today+anchor;
+            }
+         }
+
+         if( m2 > 0.0 )
+         {
+            variance  = m2/optInTimePeriod;
+            stdDev    = std_sqrt(variance);
+            invStdDev = 1.0/stdDev;
+            invVar    = invStdDev*invStdDev;
+            skew      = (m3/optInTimePeriod)*invVar*invStdDev;
+            kurt      = (m4/optInTimePeriod)*invVar*invVar - 3.0;
+            zScore    = (tempReal-mean)*invStdDev;
+         }
+         else
+            variance = stdDev = skew = kurt = zScore = 0.0;
+
+         /* The oldest value leaves the window at the next bar. */
+         TA_INT_MomentsRemove( &moments, inReal[today-nbInitialElementNeeded] );
+      }
+
+      if( outMean )   outMean[outIdx]   = mean;
+      if( outVar )    outVar[outIdx]    = variance;
+      if( outStdDev ) outStdDev[outIdx] = stdDev;
+      if( outSkew )   outSkew[outIdx]   = skew;
+      if( outKurt )   outKurt[outIdx]   = kurt;
+      if( outZScore ) outZScore[outIdx] = zScore;
+      outIdx++;
+      today++;
+   }
+
+   /* Keep the outBegIdx relative to the
+    * caller input before returning.
+    */
+   *outBegIdx    = startIdx;
+   *outNBElement = outIdx;
+
+   return TA_SUCCESS;
+}
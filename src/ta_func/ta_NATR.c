@@ -188,9 +188,12 @@ TA_RetCode TA_NATR( int    startIdx,
 
    /* Now start to write the final ATR in the caller 
     * provided outReal.
+    *
+    * tempBuffer[today-1] is the TRANGE of the bar startIdx, the
+    * bar of tempBuffer[i] is i+startIdx-lookbackTotal+1.
     */
    outIdx = 1;
-   tempValue = inClose[today];
+   tempValue = inClose[today+startIdx-lookbackTotal];
    if( !TA_IS_ZERO(tempValue) )
       outReal[0] = (prevATR/tempValue)*100.0;
    else
@@ -204,11 +207,11 @@ TA_RetCode TA_NATR( int    startIdx,
       prevATR *= optInTimePeriod - 1;
       prevATR += tempBuffer[today++];
       prevATR /= optInTimePeriod;
-      tempValue = inClose[today];
+      tempValue = inClose[today+startIdx-lookbackTotal];
       if( !TA_IS_ZERO(tempValue) )
          outReal[outIdx] = (prevATR/tempValue)*100.0;
       else
-         outReal[0] = 0.0;
+         outReal[outIdx] = 0.0;
       outIdx++;
    }
 
@@ -29,7 +29,7 @@ TA_RetCode TA_OBV( int    startIdx,
 	/* insert local variable here */
    int i;
    int outIdx;
-   double prevReal, tempReal, prevOBV;
+   double prevReal, tempReal, prevOBV, obvComp;
 
 #ifndef TA_FUNC_NO_RANGE_CHECK
 
@@ -54,6 +54,36 @@ TA_RetCode TA_OBV( int    startIdx,
    prevReal = inReal[startIdx];
    outIdx = 0;
 
+   if( TA_GLOBALS_PRECISION == TA_PRECISION_COMPENSATED )
+   {
+      /* Same calculation with a compensated total
+       * (see TA_SetPrecision).
+       */
+      obvComp = 0.0;
+      for(i=startIdx; i <= endIdx; i++ )
+      {
+         tempReal = inReal[i];
+         if( tempReal > prevReal )
+         {
+            tempReal = inVolume[i];
+            TA_SUM_ADD( prevOBV, obvComp, tempReal );
+         }
+         else if( tempReal < prevReal )
+         {
+            tempReal = -inVolume[i];
+            TA_SUM_ADD( prevOBV, obvComp, tempReal );
+         }
+
+         prevReal = inReal[i];
+         outReal[outIdx++] = prevOBV+obvComp;
+      }
+
+      *outBegIdx = startIdx;
+      *outNBElement = outIdx;
+
+      return TA_SUCCESS;
+   }
+
    for(i=startIdx; i <= endIdx; i++ )
    {
       tempReal = inReal[i];
@@ -0,0 +1,139 @@
+#include <string.h>
+#include <math.h>
+#include "ta_func.h"
+
+#include "ta_utility.h"
+#include "ta_memory.h"
+
+int TA_PCTRANK_Lookback( int           optInTimePeriod )  /* From 2 to 100000 */
+{
+   /* insert local variable here */
+
+#ifndef TA_FUNC_NO_RANGE_CHECK
+   /* min/max are checked for optInTimePeriod. */
+   if( (int)optInTimePeriod == TA_INTEGER_DEFAULT )
+      optInTimePeriod = 14;
+   else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+      return -1;
+
+#endif /* TA_FUNC_NO_RANGE_CHECK */
+
+   /* insert lookback code here. */
+   return (optInTimePeriod-1);
+}
+
+/*
+ * TA_PCTRANK - Percentile Rank over period
+ * 
+ * Input  = double
+ * Output = double
+ * 
+ * Optional Parameters
+ * -------------------
+ * optInTimePeriod:(From 2 to 100000)
+ *    Number of period
+ * 
+ * 
+ */
+TA_RetCode TA_PCTRANK( int    startIdx,
+                       int    endIdx,
+                       const double inReal[],
+                       int           optInTimePeriod, /* From 2 to 100000 */
+                       int          *outBegIdx,
+                       int          *outNBElement,
+                       double        outReal[] )
+{
+	/* insert local variable here */
+   TA_OrdStat window;
+   TA_RetCode retCode;
+   double tempReal;
+   int outIdx, nbInitialElementNeeded, today, nbBelow, nbEqual;
+
+#ifndef TA_FUNC_NO_RANGE_CHECK
+
+   /* Validate the requested output range. */
+   if( startIdx < 0 )
+      return TA_OUT_OF_RANGE_START_INDEX;
+   if( (endIdx < 0) || (endIdx < startIdx))
+      return TA_OUT_OF_RANGE_END_INDEX;
+
+   if( !inReal ) return TA_BAD_PARAM;
+      /* min/max are checked for optInTimePeriod. */
+   if( (int)optInTimePeriod == TA_INTEGER_DEFAULT )
+      optInTimePeriod = 14;
+   else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+      return TA_BAD_PARAM;
+
+   if( !outReal )
+      return TA_BAD_PARAM;
+
+#endif /* TA_FUNC_NO_RANGE_CHECK */
+
+   /* Insert TA function code here. */
+
+   /* Rank of the current value among the other values of the
+    * period, from 0 (lowest) to 100 (highest). A tie with
+    * another value counts for half:
+    *
+    *    PCTRANK = 100 * (nbBelow + (nbEqual-1)/2) / (period-1)
+    *
+    * where nbEqual includes the current value. The window is
+    * kept sorted (TA_OrdStat), so each output is O(log period).
+    * A NaN in the window gives a NaN.
+    */
+   nbInitialElementNeeded = (optInTimePeriod-1);
+
+   /* Move up the start index if there is not
+    * enough initial data.
+    */
+   if( startIdx < nbInitialElementNeeded )
+      startIdx = nbInitialElementNeeded;
+
+   /* Make sure there is still something to evaluate. */
+   if( startIdx > endIdx )
+   {
+      *outBegIdx = 0;
+      *outNBElement = 0;
+      return TA_SUCCESS;
+   }
+
+   retCode = TA_INT_OrdStatInit( &window, optInTimePeriod );
+   if( retCode != TA_SUCCESS )
+   {
+      *outBegIdx = 0;
+      *outNBElement = 0;
+      return retCode;
+   }
+
+   for( today=startIdx-nbInitialElementNeeded; today < startIdx; today++ )
+      TA_INT_OrdStatPush( &window, inReal[today] );
+
+   /* Proceed with the calculation for the requested range.
+    * Note that this algorithm allows the input and
+    * output to be the same buffer.
+    */
+   outIdx = 0;
+   while( today <= endIdx )
+   {
+      tempReal = inReal[today++];
+      TA_INT_OrdStatPush( &window, tempReal );
+
+      if( TA_INT_OrdStatHasNaN( &window ) )
+         outReal[outIdx++] = TA_INT_OrdStatKth( &window, optInTimePeriod-1 ); /* The NaN, always last. */
+      else
+      {
+         TA_INT_OrdStatRank( &window, tempReal, &nbBelow, &nbEqual );
+         outReal[outIdx++] = 100.0*(nbBelow+(nbEqual-1)/2.0)/(optInTimePeriod-1);
+      }
+   }
+
+   TA_INT_OrdStatFree( &window );
+
+   /* Keep the outBegIdx relative to the
+    * caller input before returning.
+    */
+   *outBegIdx    = startIdx;
+   *outNBElement = outIdx;
+
+   return TA_SUCCESS;
+}
@@ -0,0 +1,166 @@
+#include <string.h>
+#include <math.h>
+#include "ta_func.h"
+
+#include "ta_utility.h"
+#include "ta_memory.h"
+
+int TA_QUANTILE_Lookback( int           optInTimePeriod, /* From 2 to 100000 */
+                          double        optInQuantile )  /* From 0 to 1 */
+{
+   /* insert local variable here */
+
+#ifndef TA_FUNC_NO_RANGE_CHECK
+   /* min/max are checked for optInTimePeriod. */
+   if( (int)optInTimePeriod == TA_INTEGER_DEFAULT )
+      optInTimePeriod = 14;
+   else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+      return -1;
+
+   if( optInQuantile == TA_REAL_DEFAULT )
+      optInQuantile = 5.000000e-1;
+   else if( (optInQuantile < 0.000000e+0) || (optInQuantile > 1.000000e+0) )
+      return -1;
+
+#endif /* TA_FUNC_NO_RANGE_CHECK */
+
+   /* insert lookback code here. */
+   (void)optInQuantile;
+   return (optInTimePeriod-1);
+}
+
+/*
+ * TA_QUANTILE - Quantile over period
+ * 
+ * Input  = double
+ * Output = double
+ * 
+ * Optional Parameters
+ * -------------------
+ * optInTimePeriod:(From 2 to 100000)
+ *    Number of period
+ * 
+ * optInQuantile:(From 0 to 1)
+ *    Quantile (0.5 is the median)
+ * 
+ * 
+ */
+TA_RetCode TA_QUANTILE( int    startIdx,
+                        int    endIdx,
+                        const double inReal[],
+                        int           optInTimePeriod, /* From 2 to 100000 */
+                        double        optInQuantile, /* From 0 to 1 */
+                        int          *outBegIdx,
+                        int          *outNBElement,
+                        double        outReal[] )
+{
+	/* insert local variable here */
+   TA_OrdStat window;
+   TA_RetCode retCode;
+   double rank, fraction, lowValue;
+   int outIdx, nbInitialElementNeeded, today, lowRank;
+
+#ifndef TA_FUNC_NO_RANGE_CHECK
+
+   /* Validate the requested output range. */
+   if( startIdx < 0 )
+      return TA_OUT_OF_RANGE_START_INDEX;
+   if( (endIdx < 0) || (endIdx < startIdx))
+      return TA_OUT_OF_RANGE_END_INDEX;
+
+   if( !inReal ) return TA_BAD_PARAM;
+      /* min/max are checked for optInTimePeriod. */
+   if( (int)optInTimePeriod == TA_INTEGER_DEFAULT )
+      optInTimePeriod = 14;
+   else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+      return TA_BAD_PARAM;
+
+   if( optInQuantile == TA_REAL_DEFAULT )
+      optInQuantile = 5.000000e-1;
+   else if( (optInQuantile < 0.000000e+0) || (optInQuantile > 1.000000e+0) )
+      return TA_BAD_PARAM;
+
+   if( !outReal )
+      return TA_BAD_PARAM;
+
+#endif /* TA_FUNC_NO_RANGE_CHECK */
+
+   /* Insert TA function code here. */
+
+   /* Linear interpolation between the two closest ranks of the
+    * sorted window x[0..period-1]:
+    *
+    *    rank     = (period-1) * quantile
+    *    QUANTILE = x[floor(rank)] + fraction * (x[floor(rank)+1] - x[floor(rank)])
+    *
+    * (the default method of numpy.quantile and pandas). The window
+    * is kept sorted (TA_OrdStat), so each output is O(log period).
+    * A NaN in the window gives a NaN.
+    */
+   nbInitialElementNeeded = (optInTimePeriod-1);
+
+   /* Move up the start index if there is not
+    * enough initial data.
+    */
+   if( startIdx < nbInitialElementNeeded )
+      startIdx = nbInitialElementNeeded;
+
+   /* Make sure there is still something to evaluate. */
+   if( startIdx > endIdx )
+   {
+      *outBegIdx = 0;
+      *outNBElement = 0;
+      return TA_SUCCESS;
+   }
+
+   retCode = TA_INT_OrdStatInit( &window, optInTimePeriod );
+   if( retCode != TA_SUCCESS )
+   {
+      *outBegIdx = 0;
+      *outNBElement = 0;
+      return retCode;
+   }
+
+   for( today=startIdx-nbInitialElementNeeded; today < startIdx; today++ )
+      TA_INT_OrdStatPush( &window, inReal[today] );
+
+   rank     = (optInTimePeriod-1)*optInQuantile;
+   lowRank  = (int)std_floor(rank);
+   fraction = rank-lowRank;
+   if( lowRank >= optInTimePeriod-1 )
+   {
+      lowRank  = optInTimePeriod-1;
+      fraction = 0.0;
+   }
+
+   /* Proceed with the calculation for the requested range.
+    * Note that this algorithm allows the input and
+    * output to be the same buffer.
+    */
+   outIdx = 0;
+   while( today <= endIdx )
+   {
+      TA_INT_OrdStatPush( &window, inReal[today++] );
+
+      if( TA_INT_OrdStatHasNaN( &window ) )
+         outReal[outIdx++] = TA_INT_OrdStatKth( &window, optInTimePeriod-1 ); /* The NaN, always last. */
+      else
+      {
+         lowValue = TA_INT_OrdStatKth( &window, lowRank );
+         if( fraction != 0.0 )
+            outReal[outIdx++] = lowValue + fraction*(TA_INT_OrdStatKth( &window, lowRank+1 )-lowValue);
+         else
+            outReal[outIdx++] = lowValue;
+      }
+   }
+
+   TA_INT_OrdStatFree( &window );
+
+   /* Keep the outBegIdx relative to the
+    * caller input before returning.
+    */
+   *outBegIdx    = startIdx;
+   *outNBElement = outIdx;
+
+   return TA_SUCCESS;
+}
@@ -0,0 +1,79 @@
+#include <string.h>
+#include <math.h>
+#include "ta_func.h"
+
+#include "ta_utility.h"
+#include "ta_memory.h"
+
+int TA_SKEW_Lookback( int           optInTimePeriod )  /* From 2 to 100000 */
+{
+   /* insert local variable here */
+
+#ifndef TA_FUNC_NO_RANGE_CHECK
+   /* min/max are checked for optInTimePeriod. */
+   if( (int)optInTimePeriod == TA_INTEGER_DEFAULT )
+      optInTimePeriod = 20;
+   else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+      return -1;
+
+#endif /* TA_FUNC_NO_RANGE_CHECK */
+
+   /* insert lookback code here. */
+   return optInTimePeriod-1;
+}
+
+/*
+ * TA_SKEW - Skewness over period
+ * 
+ * Input  = double
+ * Output = double
+ * 
+ * Optional Parameters
+ * -------------------
+ * optInTimePeriod:(From 2 to 100000)
+ *    Number of period
+ * 
+ * 
+ */
+TA_RetCode TA_SKEW( int    startIdx,
+                    int    endIdx,
+                    const double inReal[],
+                    int           optInTimePeriod, /* From 2 to 100000 */
+                    int          *outBegIdx,
+                    int          *outNBElement,
+                    double        outReal[] )
+{
+	/* insert local variable here */
+
+#ifndef TA_FUNC_NO_RANGE_CHECK
+
+   /* Validate the requested output range. */
+   if( startIdx < 0 )
+      return TA_OUT_OF_RANGE_START_INDEX;
+   if( (endIdx < 0) || (endIdx < startIdx))
+      return TA_OUT_OF_RANGE_END_INDEX;
+
+   if( !inReal ) return TA_BAD_PARAM;
+      /* min/max are checked for optInTimePeriod. */
+   if( (int)optInTimePeriod == TA_INTEGER_DEFAULT )
+      optInTimePeriod = 20;
+   else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+      return TA_BAD_PARAM;
+
+   if( !outReal )
+      return TA_BAD_PARAM;
+
+#endif /* TA_FUNC_NO_RANGE_CHECK */
+
+   /* Insert TA function code here. */
+
+   /* Skewness of the window, (M3/n)/(M2/n)^1.5 with Mk the sum of
+    * the deviations from the mean at the power k (population, no
+    * correction for the sample size). 0 when all the values of the
+    * window are equal.
+    *
+    * Same as the skew output of TA_MOMENTS.
+    */
+   return TA_INT_MOMENTS( startIdx, endIdx, inReal, optInTimePeriod,
+                          outBegIdx, outNBElement, NULL, NULL, NULL, outReal, NULL, NULL );
+}
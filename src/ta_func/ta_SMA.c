@@ -65,6 +65,10 @@ TA_RetCode TA_SMA(int    startIdx,
 
 #endif /* TA_FUNC_NO_RANGE_CHECK */
 
+    if (TA_GLOBALS_MISSING != TA_MISSING_NONE)
+        return TA_INT_SMA_Missing(startIdx, endIdx, inReal, NULL, TA_GLOBALS_MISSING,
+            optInTimePeriod, outBegIdx, outNBElement, outReal, NULL);
+
     return TA_INT_SMA(startIdx, endIdx, inReal, optInTimePeriod,
         outBegIdx, outNBElement, outReal);
 }
@@ -77,7 +81,7 @@ TA_RetCode TA_INT_SMA(int    startIdx,
     int* outNBElement,
     double* outReal)
 {
-    double periodTotal, tempReal;
+    double periodTotal, periodComp, meanValue, tempReal;
     int i, outIdx, trailingIdx, lookbackTotal;
 
     /* Identify the minimum number of price bar needed
@@ -104,6 +108,62 @@ TA_RetCode TA_INT_SMA(int    startIdx,
     periodTotal = 0;
     trailingIdx = startIdx - lookbackTotal;
 
+    if (TA_GLOBALS_PRECISION == TA_PRECISION_COMPENSATED)
+    {
+        /* Same calculation with a compensated total
+         * (see TA_SetPrecision).
+         */
+        periodComp = 0;
+        i = trailingIdx;
+        while (i < startIdx)
+        {
+            tempReal = inReal[i++];
+            TA_SUM_ADD(periodTotal, periodComp, tempReal);
+        }
+
+        outIdx = 0;
+        do
+        {
+            tempReal = inReal[i++];
+            TA_SUM_ADD(periodTotal, periodComp, tempReal);
+            meanValue = (periodTotal + periodComp) / optInTimePeriod;
+
+            /* Remove the trailing value before writing the
+             * output, the input and output might be the same buffer.
+             */
+            tempReal = -inReal[trailingIdx++];
+            TA_SUM_ADD(periodTotal, periodComp, tempReal);
+            TA_SUM_NORM(periodTotal, periodComp);
+            outReal[outIdx++] = meanValue;
+        } while (i <= endIdx);
+
+        *outNBElement = outIdx;
+        *outBegIdx = startIdx;
+
+        return TA_SUCCESS;
+    }
+
+    if (TA_GLOBALS_PRECISION == TA_PRECISION_PREFIX_SUM)
+    {
+        /* Sums of the windows by blocks (see TA_SetPrecision). */
+        TA_WinSum winSum;
+        double sum[TA_WINSUM_BLOCK];
+        int nbSum;
+
+        TA_INT_WinSumInit(&winSum, inReal, startIdx, endIdx, optInTimePeriod);
+        outIdx = 0;
+        while ((nbSum = TA_INT_WinSumNext(&winSum, sum, NULL)) > 0)
+        {
+            for (i = 0; i < nbSum; i++)
+                outReal[outIdx++] = sum[i] / optInTimePeriod;
+        }
+
+        *outNBElement = outIdx;
+        *outBegIdx = startIdx;
+
+        return TA_SUCCESS;
+    }
+
     i = trailingIdx;
     while (i < startIdx)
         periodTotal += inReal[i++];
@@ -127,3 +187,85 @@ TA_RetCode TA_INT_SMA(int    startIdx,
 
     return TA_SUCCESS;
 }
+
+/* Same as TA_INT_SMA with the missing bars of the policy (see
+ * TA_SetMissingPolicy). The values of the window are kept in a
+ * circular buffer, the bars entering and leaving it are not always
+ * 'period' bars apart.
+ */
+TA_RetCode TA_INT_SMA_Missing(int    startIdx,
+    int    endIdx,
+    const double* inReal,
+    const unsigned char* inValid,
+    TA_MissingPolicy policy,
+    int      optInTimePeriod,
+    int* outBegIdx,
+    int* outNBElement,
+    double* outReal,
+    unsigned char* outValid)
+{
+    ARRAY_REF(window);
+    TA_Missing missing;
+    double periodTotal, tempReal;
+    int today, outIdx, lookbackTotal, nbValue, slot, step;
+
+    lookbackTotal = optInTimePeriod - 1;
+    if (startIdx < lookbackTotal)
+        startIdx = lookbackTotal;
+
+    if (startIdx > endIdx)
+    {
+        *outBegIdx = 0;
+        *outNBElement = 0;
+        return TA_SUCCESS;
+    }
+
+    ARRAY_ALLOC(window, optInTimePeriod);
+    if (!window)
+        return TA_ALLOC_ERR;
+
+    TA_INT_MissingInit(&missing, inReal, inValid, policy,
+        TA_INT_MissingBegin(inReal, inValid, policy, startIdx, lookbackTotal));
+
+    /* Same operations as TA_INT_SMA when no bar is missing. */
+    periodTotal = 0.0;
+    tempReal = 0.0;
+    nbValue = slot = 0;
+    outIdx = 0;
+    for (today = missing.nextIdx; today <= endIdx; today++)
+    {
+        TA_MISSING_NEXT(missing, tempReal, step);
+        if (step == TA_MISSING_STEP_RESTART)
+        {
+            periodTotal = 0.0;
+            nbValue = slot = 0;
+        }
+        else if (step == TA_MISSING_STEP_PUSH)
+        {
+            periodTotal += tempReal;
+            window[slot] = tempReal;
+            if (++slot == optInTimePeriod)
+                slot = 0;
+            if (++nbValue >= optInTimePeriod)
+            {
+                /* The oldest value leaves the window. */
+                tempReal = periodTotal / optInTimePeriod;
+                periodTotal -= window[slot];
+            }
+        }
+
+        if (today >= startIdx)
+        {
+            TA_MISSING_OUTPUT(outReal, outValid, outIdx, tempReal,
+                (step == TA_MISSING_STEP_PUSH) && (nbValue >= optInTimePeriod));
+            outIdx++;
+        }
+    }
+
+    ARRAY_FREE(window);
+
+    *outNBElement = outIdx;
+    *outBegIdx = startIdx;
+
+    return TA_SUCCESS;
+}
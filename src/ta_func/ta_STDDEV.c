@@ -89,9 +89,13 @@ TA_RetCode TA_STDDEV(int    startIdx,
     /* Insert TA function code here. */
 
     /* Calculate the variance. */
-    retCode = TA_INT_VAR(startIdx, endIdx,
-        inReal, optInTimePeriod,
-        outBegIdx, outNBElement, outReal);
+    if (TA_GLOBALS_MISSING != TA_MISSING_NONE)
+        retCode = TA_INT_VAR_Missing(startIdx, endIdx, inReal, NULL, TA_GLOBALS_MISSING,
+            optInTimePeriod, outBegIdx, outNBElement, outReal, NULL);
+    else
+        retCode = TA_INT_VAR(startIdx, endIdx,
+            inReal, optInTimePeriod,
+            outBegIdx, outNBElement, outReal);
 
     if (retCode != TA_SUCCESS)
         return retCode;
@@ -154,11 +158,89 @@ void TA_INT_stddev_using_precalc_ma(const double* inReal,
     /* Start/end index for sumation. */
     int startSum, endSum;
 
+    if (TA_GLOBALS_PRECISION == TA_PRECISION_PREFIX_SUM)
+    {
+        /* Sums of the windows by blocks (see TA_SetPrecision). */
+        TA_WinSum winSum;
+        double sumSq[TA_WINSUM_BLOCK];
+        int i, nbSum;
+
+        TA_INT_WinSumInit(&winSum, inReal, inMovAvgBegIdx,
+                          inMovAvgBegIdx + inMovAvgNbElement - 1, timePeriod);
+        outIdx = 0;
+        while ((nbSum = TA_INT_WinSumNext(&winSum, NULL, sumSq)) > 0)
+        {
+            for (i = 0; i < nbSum; i++, outIdx++)
+            {
+                tempReal = inMovAvg[outIdx];
+                meanValue2 = sumSq[i] / timePeriod - tempReal * tempReal;
+
+                if (!TA_IS_ZERO_OR_NEG(meanValue2))
+                    output[outIdx] = std_sqrt(meanValue2);
+                else
+                    output[outIdx] = (double)0.0;
+            }
+        }
+        return;
+    }
+
     startSum = 1 + inMovAvgBegIdx - timePeriod;
     endSum = inMovAvgBegIdx;
 
     periodTotal2 = 0;
 
+    if (TA_GLOBALS_PRECISION == TA_PRECISION_COMPENSATED)
+    {
+        /* Compensated total of the exact squares, folded back each
+         * bar and done again from the window after a large drop
+         * (same as TA_INT_VAR).
+         */
+        double periodComp2, peakTotal2;
+        int i;
+
+        periodComp2 = 0;
+        for (outIdx = startSum; outIdx < endSum; outIdx++)
+        {
+            tempReal = inReal[outIdx];
+            TA_SUM_ADD_PRODUCT(periodTotal2, periodComp2, tempReal, tempReal);
+        }
+        peakTotal2 = 0;
+
+        for (outIdx = 0; outIdx < inMovAvgNbElement; outIdx++, startSum++, endSum++)
+        {
+            tempReal = inReal[endSum];
+            TA_SUM_ADD_PRODUCT(periodTotal2, periodComp2, tempReal, tempReal);
+
+            if (periodTotal2 > peakTotal2)
+                peakTotal2 = periodTotal2;
+            else if (periodTotal2 < TA_SUM_DROP * peakTotal2)
+            {
+                periodTotal2 = periodComp2 = 0;
+                for (i = startSum; i <= endSum; i++)
+                {
+                    tempReal = inReal[i];
+                    TA_SUM_ADD_PRODUCT(periodTotal2, periodComp2, tempReal, tempReal);
+                }
+                peakTotal2 = periodTotal2;
+            }
+
+            meanValue2 = (periodTotal2 + periodComp2) / timePeriod;
+
+            tempReal = -inReal[startSum];
+            TA_SUM_ADD_PRODUCT(periodTotal2, periodComp2, tempReal, inReal[startSum]);
+            TA_SUM_NORM(periodTotal2, periodComp2);
+
+            tempReal = inMovAvg[outIdx];
+            meanValue2 -= tempReal * tempReal;
+
+            if (!TA_IS_ZERO_OR_NEG(meanValue2))
+                output[outIdx] = std_sqrt(meanValue2);
+            else
+                output[outIdx] = (double)0.0;
+        }
+        return;
+    }
+
     for (outIdx = startSum; outIdx < endSum; outIdx++)
     {
         tempReal = inReal[outIdx];
@@ -261,14 +261,12 @@ TA_RetCode TA_STOCH( int    startIdx,
       {
          tempBuffer = outSlowK;
       }
-      else if( (outSlowD == inHigh) ||
-               (outSlowD == inLow)  ||
-               (outSlowD == inClose) )
-      {
-         tempBuffer = outSlowD;
-      }
       else
       {
+         /* outSlowD is not used as the temporary buffer even when
+          * it is an input: the D calculation would overwrite the K
+          * values before they are copied into outSlowK.
+          */
          #if !defined( _MANAGED ) && !defined(_JAVA)
             bufferIsAllocated = 1;
          #endif
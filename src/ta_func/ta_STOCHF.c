@@ -226,14 +226,12 @@ TA_RetCode TA_STOCHF( int    startIdx,
       {
          tempBuffer = outFastK;
       }
-      else if( (outFastD == inHigh) ||
-               (outFastD == inLow)  ||
-               (outFastD == inClose) )
-      {
-         tempBuffer = outFastD;
-      }
       else
       {
+         /* outFastD is not used as the temporary buffer even when
+          * it is an input: the D calculation would overwrite the K
+          * values before they are copied into outFastK.
+          */
          #if !defined( _MANAGED ) && !defined( _JAVA )
             bufferIsAllocated = 1;
          #endif
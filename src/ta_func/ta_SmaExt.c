@@ -16,7 +16,7 @@ int TA_SmaExt_Lookback(int           optInTimePeriod,
     if ((optInTimePeriod < 1) || (optInTimePeriod > 100000))
         return -1;
 
-    if ((optInTimePeriodShift < 0) || (optInTimePeriod > 100000))
+    if ((optInTimePeriodShift < 0) || (optInTimePeriodShift > 100000))
         return -1;
 #endif /* TA_FUNC_NO_RANGE_CHECK */
 
@@ -66,19 +66,30 @@ TA_RetCode TA_SmaExt(int    startIdx,
     if ((optInTimePeriod < 1) || (optInTimePeriod > 100000))
         return TA_BAD_PARAM;
 
-    if ((optInTimePeriodShift < 0) || (optInTimePeriod > 100000))
-        return -1;
+    if ((optInTimePeriodShift < 0) || (optInTimePeriodShift > 100000))
+        return TA_BAD_PARAM;
 
     if (!outReal)
         return TA_BAD_PARAM;
 
 #endif /* TA_FUNC_NO_RANGE_CHECK */
 
+    /* The value at a bar is the input optInTimePeriodShift bars before. */
     if (optInTimePeriod == 1) {
-        *outBegIdx = startIdx + optInTimePeriodShift;
-        *outNBElement = endIdx - startIdx + 1 - optInTimePeriodShift;
+        if (startIdx < optInTimePeriodShift)
+            startIdx = optInTimePeriodShift;
+
+        if (startIdx > endIdx)
+        {
+            *outBegIdx = 0;
+            *outNBElement = 0;
+            return TA_SUCCESS;
+        }
 
-        ARRAY_COPY(outReal, inReal + startIdx, *outNBElement);
+        *outBegIdx = startIdx;
+        *outNBElement = endIdx - startIdx + 1;
+
+        ARRAY_COPY(outReal, inReal + startIdx - optInTimePeriodShift, *outNBElement);
 
         return TA_SUCCESS;
     }
@@ -105,6 +116,30 @@ TA_RetCode TA_SmaExt(int    startIdx,
         return TA_SUCCESS;
     }
 
+    if (TA_GLOBALS_PRECISION == TA_PRECISION_PREFIX_SUM)
+    {
+        /* Sums of the windows by blocks (see TA_SetPrecision),
+         * for the windows ending optInTimePeriodShift bars before.
+         */
+        TA_WinSum winSum;
+        double sum[TA_WINSUM_BLOCK];
+        int nbSum;
+
+        TA_INT_WinSumInit(&winSum, inReal, startIdx - optInTimePeriodShift,
+                          endIdx - optInTimePeriodShift, optInTimePeriod);
+        outIdx = 0;
+        while ((nbSum = TA_INT_WinSumNext(&winSum, sum, NULL)) > 0)
+        {
+            for (i = 0; i < nbSum; i++)
+                outReal[outIdx++] = sum[i] / optInTimePeriod;
+        }
+
+        *outNBElement = outIdx;
+        *outBegIdx = startIdx;
+
+        return TA_SUCCESS;
+    }
+
     /* Do the MA calculation using tight loops. */
     /* Add-up the initial period, except for the last value. */
     periodTotal = 0;
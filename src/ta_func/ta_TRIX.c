@@ -21,7 +21,7 @@ int TA_TRIX_Lookback( int           optInTimePeriod )  /* From 1 to 100000 */
 #endif /* TA_FUNC_NO_RANGE_CHECK */
 
    /* insert lookback code here. */
-   emaLookback = TA_EMA_Lookback( optInTimePeriod );
+   emaLookback = TA_INT_EMA_LOOKBACK( optInTimePeriod );
    return (emaLookback*3) + TA_ROCR_Lookback( 1 );
 }
 
@@ -79,7 +79,7 @@ TA_RetCode TA_TRIX( int    startIdx,
    /* Insert TA function code here. */
 
    /* Adjust the startIdx to account for the lookback. */
-   emaLookback   = TA_EMA_Lookback( optInTimePeriod );
+   emaLookback   = TA_INT_EMA_LOOKBACK( optInTimePeriod );
    rocLookback   = TA_ROCR_Lookback( 1 );
    totalLookback = (emaLookback*3) + rocLookback;
 
@@ -111,9 +111,11 @@ TA_RetCode TA_TRIX( int    startIdx,
       }
    #endif
 
-   /* Calculate the first EMA */   
+   /* Calculate the first EMA. Its first output is the input of the
+    * second EMA, its data starts at startIdx-totalLookback.
+    */
    k = PER_TO_K(optInTimePeriod);  
-   retCode = TA_INT_EMA( (startIdx-totalLookback), endIdx, inReal,
+   retCode = TA_INT_EMA( (startIdx-totalLookback)+emaLookback, endIdx, inReal,
                                      optInTimePeriod, k,
                                      &begIdx, &nbElement,
 								     tempBuffer );
@@ -15,6 +15,20 @@ int TA_TrendData_Lookback(int           optInTimePeriod,
 {
     /* insert local variable here */
 
+#ifndef TA_FUNC_NO_RANGE_CHECK
+    if ((optInNbDev < -3.000000e+37) || (optInNbDev > 3.000000e+37))
+        return -1;
+
+    if ((optInDistThres < 0) || (optInDistThres > 30))
+        return -1;
+
+    if ((optInDaysThres < 0) || (optInDaysThres > 100))
+        return -1;
+
+    if ((optInPctThres < 0) || (optInPctThres > 30))
+        return -1;
+#endif /* TA_FUNC_NO_RANGE_CHECK */
+
     /* insert lookback code here. */
     (void)optInNbDev;
 
@@ -110,15 +124,44 @@ TA_RetCode TA_TrendData(int    startIdx,
 
     /* Insert TA function code here. */
 
-    tempBuffer1 = outUpDays;
-    tempBuffer2 = outUpPercent;
-    tempBuffer3 = outDownDays;
+    /* Identify THREE temporary buffers among the outputs,
+     * skipping the one that is also the input (the input is
+     * still needed after TA_BBDist).
+     */
+    if (inReal == outUpDays)
+    {
+        tempBuffer1 = outDownPercent;
+        tempBuffer2 = outUpPercent;
+        tempBuffer3 = outDownDays;
+    }
+    else if (inReal == outUpPercent)
+    {
+        tempBuffer1 = outUpDays;
+        tempBuffer2 = outDownPercent;
+        tempBuffer3 = outDownDays;
+    }
+    else if (inReal == outDownDays)
+    {
+        tempBuffer1 = outUpDays;
+        tempBuffer2 = outUpPercent;
+        tempBuffer3 = outDownPercent;
+    }
+    else
+    {
+        tempBuffer1 = outUpDays;
+        tempBuffer2 = outUpPercent;
+        tempBuffer3 = outDownDays;
+    }
+    /* Check that the caller is not using the input in two outputs. */
+    if ((tempBuffer1 == inReal) || (tempBuffer2 == inReal) || (tempBuffer3 == inReal))
+        return TA_BAD_PARAM;
 
     retCode = TA_BBDist(startIdx, endIdx, inReal,
         optInTimePeriod, optInNbDev, outBegIdx, outNBElement, tempBuffer1, tempBuffer2);
 
     if ((retCode != TA_SUCCESS) || ((*outNBElement) == 0))
     {
+        *outBegIdx = 0;
         *outNBElement = 0;
         return retCode;
     }
@@ -128,6 +171,7 @@ TA_RetCode TA_TrendData(int    startIdx,
 
     if ((retCode != TA_SUCCESS) || ((*outNBElement) == 0))
     {
+        *outBegIdx = 0;
         *outNBElement = 0;
         return retCode;
     }
@@ -34,11 +34,12 @@ int TA_ULTOSC_Lookback( int           optInTimePeriod1, /* From 1 to 100000 */
 
 #endif /* TA_FUNC_NO_RANGE_CHECK */
 
-   /* Lookback for the Ultimate Oscillator is the lookback of the SMA with the longest
-    * time period, plus 1 for the True Range.
+   /* Lookback for the Ultimate Oscillator is the lookback of the sums with the
+    * longest time period (period-1), plus 1 for the True Range. Not from
+    * TA_SMA_Lookback, a period of 1 is valid here.
     */
     maxPeriod = max( max(optInTimePeriod1, optInTimePeriod2), optInTimePeriod3);
-    return TA_SMA_Lookback( maxPeriod ) + 1;
+    return maxPeriod;
 }
 
 /*
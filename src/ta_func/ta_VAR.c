@@ -84,6 +84,10 @@ TA_RetCode TA_VAR( int    startIdx,
 #endif /* TA_FUNC_NO_RANGE_CHECK */
 
    /* Insert TA function code here. */
+   if( TA_GLOBALS_MISSING != TA_MISSING_NONE )
+      return TA_INT_VAR_Missing( startIdx, endIdx, inReal, NULL, TA_GLOBALS_MISSING,
+                                 optInTimePeriod, outBegIdx, outNBElement, outReal, NULL );
+
    return TA_INT_VAR( startIdx, endIdx, inReal,
                                   optInTimePeriod, /* From 1 to TA_INTEGER_MAX */                      
                                   outBegIdx, outNBElement, outReal );
@@ -98,7 +102,8 @@ TA_RetCode TA_INT_VAR( int    startIdx,
                                double      *outReal )
 {
    double tempReal, periodTotal1, periodTotal2, meanValue1, meanValue2;
-   int i, outIdx, trailingIdx, nbInitialElementNeeded;
+   double periodComp1, periodComp2, trailingReal, peakTotal2;
+   int i, j, outIdx, trailingIdx, nbInitialElementNeeded;
 
    /* Validate the calculation method type and
     * identify the minimum number of price bar needed
@@ -126,6 +131,90 @@ TA_RetCode TA_INT_VAR( int    startIdx,
    periodTotal2 = 0;
    trailingIdx = startIdx-nbInitialElementNeeded;
 
+   if( TA_GLOBALS_PRECISION == TA_PRECISION_COMPENSATED )
+   {
+      /* Same calculation with compensated totals and exact
+       * squares (see TA_SetPrecision). The compensations are folded
+       * back each bar, and the totals are done again from the window
+       * when the sum of the squares falls under TA_SUM_DROP times its
+       * highest value since then: the squares of a series changing of
+       * scale span more digits than the totals keep.
+       */
+      periodComp1 = 0;
+      periodComp2 = 0;
+      i=trailingIdx;
+      while( i < startIdx ) {
+         tempReal = inReal[i++];
+         TA_SUM_ADD( periodTotal1, periodComp1, tempReal );
+         TA_SUM_ADD_PRODUCT( periodTotal2, periodComp2, tempReal, tempReal );
+      }
+      peakTotal2 = 0;
+
+      outIdx = 0;
+      do
+      {
+         tempReal = inReal[i++];
+         TA_SUM_ADD( periodTotal1, periodComp1, tempReal );
+         TA_SUM_ADD_PRODUCT( periodTotal2, periodComp2, tempReal, tempReal );
+
+         if( periodTotal2 > peakTotal2 )
+            peakTotal2 = periodTotal2;
+         else if( periodTotal2 < TA_SUM_DROP*peakTotal2 )
+         {
+            periodTotal1 = periodComp1 = 0;
+            periodTotal2 = periodComp2 = 0;
+            for( j=trailingIdx; j < i; j++ ) {
+               tempReal = inReal[j];
+               TA_SUM_ADD( periodTotal1, periodComp1, tempReal );
+               TA_SUM_ADD_PRODUCT( periodTotal2, periodComp2, tempReal, tempReal );
+            }
+            peakTotal2 = periodTotal2;
+         }
+
+         meanValue1 = (periodTotal1+periodComp1) / optInTimePeriod;
+         meanValue2 = (periodTotal2+periodComp2) / optInTimePeriod;
+
+         tempReal = inReal[trailingIdx++];
+         trailingReal = -tempReal;
+         TA_SUM_ADD( periodTotal1, periodComp1, trailingReal );
+         TA_SUM_ADD_PRODUCT( periodTotal2, periodComp2, trailingReal, tempReal );
+         TA_SUM_NORM( periodTotal1, periodComp1 );
+         TA_SUM_NORM( periodTotal2, periodComp2 );
+
+         outReal[outIdx++] = meanValue2-meanValue1*meanValue1;
+      } while( i <= endIdx );
+
+      *outNBElement = outIdx;
+      *outBegIdx = startIdx;
+
+      return TA_SUCCESS;
+   }
+
+   if( TA_GLOBALS_PRECISION == TA_PRECISION_PREFIX_SUM )
+   {
+      /* Sums of the windows by blocks (see TA_SetPrecision). */
+      TA_WinSum winSum;
+      double sum[TA_WINSUM_BLOCK], sumSq[TA_WINSUM_BLOCK];
+      int nbSum;
+
+      TA_INT_WinSumInit( &winSum, inReal, startIdx, endIdx, optInTimePeriod );
+      outIdx = 0;
+      while( (nbSum = TA_INT_WinSumNext( &winSum, sum, sumSq )) > 0 )
+      {
+         for( i=0; i < nbSum; i++ )
+         {
+            meanValue1 = sum[i] / optInTimePeriod;
+            meanValue2 = sumSq[i] / optInTimePeriod;
+            outReal[outIdx++] = meanValue2-meanValue1*meanValue1;
+         }
+      }
+
+      *outNBElement = outIdx;
+      *outBegIdx = startIdx;
+
+      return TA_SUCCESS;
+   }
+
    i=trailingIdx;
    if( optInTimePeriod > 1 )
    {
@@ -175,3 +264,95 @@ TA_RetCode TA_INT_VAR( int    startIdx,
 
    return TA_SUCCESS;
 }
+
+/* Same as TA_INT_VAR with the missing bars of the policy (see
+ * TA_SetMissingPolicy). The values of the window are kept in a
+ * circular buffer.
+ */
+TA_RetCode TA_INT_VAR_Missing( int                  startIdx,
+                               int                  endIdx,
+                               const double        *inReal,
+                               const unsigned char *inValid,
+                               TA_MissingPolicy     policy,
+                               int                  optInTimePeriod,
+                               int                 *outBegIdx,
+                               int                 *outNBElement,
+                               double              *outReal,
+                               unsigned char       *outValid )
+{
+   ARRAY_REF(window);
+   TA_Missing missing;
+   double tempReal, periodTotal1, periodTotal2, meanValue1, meanValue2, outValue;
+   int today, outIdx, nbInitialElementNeeded, nbValue, slot, step;
+
+   nbInitialElementNeeded = (optInTimePeriod-1);
+   if( startIdx < nbInitialElementNeeded )
+      startIdx = nbInitialElementNeeded;
+
+   if( startIdx > endIdx )
+   {
+      *outBegIdx = 0;
+      *outNBElement = 0;
+      return TA_SUCCESS;
+   }
+
+   ARRAY_ALLOC( window, optInTimePeriod );
+   if( !window )
+      return TA_ALLOC_ERR;
+
+   TA_INT_MissingInit( &missing, inReal, inValid, policy,
+                       TA_INT_MissingBegin( inReal, inValid, policy, startIdx, nbInitialElementNeeded ) );
+
+   /* Same operations as TA_INT_VAR when no bar is missing. */
+   periodTotal1 = periodTotal2 = outValue = 0.0;
+   tempReal = 0.0;
+   nbValue = slot = 0;
+   outIdx = 0;
+   for( today=missing.nextIdx; today <= endIdx; today++ )
+   {
+      TA_MISSING_NEXT( missing, tempReal, step );
+      if( step == TA_MISSING_STEP_RESTART )
+      {
+         periodTotal1 = periodTotal2 = 0.0;
+         nbValue = slot = 0;
+      }
+      else if( step == TA_MISSING_STEP_PUSH )
+      {
+         window[slot] = tempReal;
+         if( ++slot == optInTimePeriod )
+            slot = 0;
+
+         periodTotal1 += tempReal;
+         tempReal *= tempReal;
+         periodTotal2 += tempReal;
+
+         if( ++nbValue >= optInTimePeriod )
+         {
+            meanValue1 = periodTotal1 / optInTimePeriod;
+            meanValue2 = periodTotal2 / optInTimePeriod;
+
+            /* The oldest value leaves the window. */
+            tempReal = window[slot];
+            periodTotal1 -= tempReal;
+            tempReal *= tempReal;
+            periodTotal2 -= tempReal;
+
+            outValue = meanValue2-meanValue1*meanValue1;
+         }
+      }
+
+      if( today >= startIdx )
+      {
+         TA_MISSING_OUTPUT( outReal, outValid, outIdx, outValue,
+                            (step == TA_MISSING_STEP_PUSH) && (nbValue >= optInTimePeriod) );
+         outIdx++;
+      }
+   }
+
+   ARRAY_FREE( window );
+
+   *outNBElement = outIdx;
+   *outBegIdx = startIdx;
+
+   return TA_SUCCESS;
+}
@@ -70,6 +70,10 @@ TA_RetCode TA_WMA( int    startIdx,
 #endif /* TA_FUNC_NO_RANGE_CHECK */
 
    /* Insert TA function code here. */
+   if( TA_GLOBALS_MISSING != TA_MISSING_NONE )
+      return TA_INT_WMA_Missing( startIdx, endIdx, inReal, NULL, TA_GLOBALS_MISSING,
+                                 optInTimePeriod, outBegIdx, outNBElement, outReal, NULL );
+
    lookbackTotal = optInTimePeriod-1;
 
    /* Move up the start index if there is not
@@ -185,3 +189,95 @@ TA_RetCode TA_WMA( int    startIdx,
 
    return TA_SUCCESS;
 }
+
+/* Same as TA_WMA with the missing bars of the policy (see
+ * TA_SetMissingPolicy). The trailing value comes from a circular
+ * buffer of the values of the window.
+ */
+TA_RetCode TA_INT_WMA_Missing( int                  startIdx,
+                               int                  endIdx,
+                               const double        *inReal,
+                               const unsigned char *inValid,
+                               TA_MissingPolicy     policy,
+                               int                  optInTimePeriod,
+                               int                 *outBegIdx,
+                               int                 *outNBElement,
+                               double              *outReal,
+                               unsigned char       *outValid )
+{
+   ARRAY_REF(window);
+   TA_Missing missing;
+   double periodSum, periodSub, tempReal, trailingValue, outValue;
+   int today, outIdx, lookbackTotal, nbValue, slot, step, divider;
+
+   lookbackTotal = optInTimePeriod-1;
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   if( startIdx > endIdx )
+   {
+      *outBegIdx = 0;
+      *outNBElement = 0;
+      return TA_SUCCESS;
+   }
+
+   ARRAY_ALLOC( window, optInTimePeriod );
+   if( !window )
+      return TA_ALLOC_ERR;
+
+   TA_INT_MissingInit( &missing, inReal, inValid, policy,
+                       TA_INT_MissingBegin( inReal, inValid, policy, startIdx, lookbackTotal ) );
+
+   /* Same operations as TA_WMA when no bar is missing: the first
+    * period-1 values are added with their weight, then periodSum
+    * and periodSub are carried through the iterations.
+    */
+   divider = (optInTimePeriod*(optInTimePeriod+1))>>1;
+   periodSum = periodSub = trailingValue = outValue = 0.0;
+   tempReal = 0.0;
+   nbValue = slot = 0;
+   outIdx = 0;
+   for( today=missing.nextIdx; today <= endIdx; today++ )
+   {
+      TA_MISSING_NEXT( missing, tempReal, step );
+      if( step == TA_MISSING_STEP_RESTART )
+      {
+         periodSum = periodSub = trailingValue = 0.0;
+         nbValue = slot = 0;
+      }
+      else if( step == TA_MISSING_STEP_PUSH )
+      {
+         window[slot] = tempReal;
+         if( ++slot == optInTimePeriod )
+            slot = 0;
+         if( ++nbValue < optInTimePeriod )
+         {
+            periodSub += tempReal;
+            periodSum += tempReal*nbValue;
+         }
+         else
+         {
+            periodSub += tempReal;
+            periodSub -= trailingValue;
+            periodSum += tempReal*optInTimePeriod;
+            trailingValue = window[slot];
+            outValue = periodSum / divider;
+            periodSum -= periodSub;
+         }
+      }
+
+      if( today >= startIdx )
+      {
+         TA_MISSING_OUTPUT( outReal, outValid, outIdx, outValue,
+                            (step == TA_MISSING_STEP_PUSH) && (nbValue >= optInTimePeriod) );
+         outIdx++;
+      }
+   }
+
+   ARRAY_FREE( window );
+
+   *outNBElement = outIdx;
+   *outBegIdx    = startIdx;
+
+   return TA_SUCCESS;
+}
@@ -0,0 +1,875 @@
+/* Description:
+ *   Indicator graph with sharing of the common intermediates
+ *   (see ta_graph.h).
+ *
+ *   Every series is kept in a buffer indexed by price bar (value
+ *   of bar 'i' is at index 'i'), with its first valid index in
+ *   'begIdx'. A TA function is always called with its inputs
+ *   re-based on their first valid bar and with startIdx = 0, which
+ *   is exactly how the composite TA functions are calling their
+ *   sub-functions. This is what makes the graph output identical
+ *   to the composite functions.
+ *
+ *   The nodes are appended after all their inputs exist, so the
+ *   order of creation is a valid topological order.
+ */
+
+/**** Headers ****/
+#include <string.h>
+#include <math.h>
+#include "ta_func.h"
+#include "ta_graph.h"
+
+#include "ta_utility.h"
+#include "ta_memory.h"
+
+/**** Local declarations.              ****/
+#define TA_GRAPH_NB_SOURCE  5
+#define TA_GRAPH_MAX_INPUT  3
+#define TA_GRAPH_MAX_OPTIN  4
+#define TA_GRAPH_MAX_OUTPUT 2
+
+/* Nodes created only by the decomposition of the composite functions. */
+enum
+{
+   NODE_BBANDS_STDDEV = TA_GRAPH_NB_FUNC, /* real, ma       period, isSMA     -> stddev */
+   NODE_BBANDS_BANDS,                     /* ma, stddev     nbDevUp, nbDevDn  -> upper, lower */
+   NODE_WILDER_ATR,                       /* trange         period, unstId    -> atr */
+   NODE_NATR,                             /* atr, close                       -> natr */
+   NODE_ADXR,                             /* adx            period            -> adxr */
+   NODE_BIAS                              /* sma1, sma2                       -> percent */
+};
+
+typedef struct
+{
+   int    kind;
+   int    nbInput;
+   int    input[TA_GRAPH_MAX_INPUT];
+   int    nbOptIn;
+   double optIn[TA_GRAPH_MAX_OPTIN];
+   int    nbOutput;
+   int    output[TA_GRAPH_MAX_OUTPUT];
+} TA_GraphNode;
+
+typedef struct
+{
+   const double *data;      /* Indexed by price bar. */
+   double       *buffer;    /* From the pool, NULL for the price components. */
+   int           begIdx;
+   int           nbElement;
+   int           nbConsumer;
+   int           remaining; /* Consumers not yet calculated. */
+   int           isRequested;
+} TA_GraphSeriesDef;
+
+struct TA_Graph
+{
+   TA_GraphNode      *nodes;
+   int                nbNodes;
+   int                maxNodes;
+
+   TA_GraphSeriesDef *series;
+   int                nbSeries;
+   int                maxSeries;
+
+   int                nbShared;
+
+   /* Pool of buffers of 'poolSize' elements. */
+   double           **pool;
+   int                nbPool;
+   int                nbFree;
+   double           **freeList;
+   int                poolSize;
+};
+
+/**** Local functions declarations.    ****/
+static TA_RetCode addNode( TA_Graph *graph, int kind,
+                           int nbInput, const int *input,
+                           int nbOptIn, const double *optIn,
+                           int nbOutput, int *output );
+static TA_RetCode addSeries( TA_Graph *graph, int *seriesIdx );
+static int isDefault( int nbOptIn, const double *optIn );
+static TA_RetCode acquireBuffer( TA_Graph *graph, TA_GraphSeriesDef *series );
+static void releaseBuffer( TA_Graph *graph, TA_GraphSeriesDef *series );
+static void freePool( TA_Graph *graph );
+static TA_RetCode runNode( TA_Graph *graph, const TA_GraphNode *node, int nbBars );
+static TA_RetCode runLeaf( TA_Graph *graph, const TA_GraphNode *node, int nbBars );
+
+/**** Global functions definitions.   ****/
+TA_RetCode TA_GraphAlloc( TA_Graph **graph )
+{
+   TA_Graph *newGraph;
+   int i, seriesIdx;
+   TA_RetCode retCode;
+
+   if( !graph )
+      return TA_BAD_PARAM;
+
+   *graph = NULL;
+
+   newGraph = (TA_Graph *)TA_Malloc( sizeof(TA_Graph) );
+   if( !newGraph )
+      return TA_ALLOC_ERR;
+   memset( newGraph, 0, sizeof(TA_Graph) );
+
+   /* The price components are always the first series. */
+   for( i=0; i < TA_GRAPH_NB_SOURCE; i++ )
+   {
+      retCode = addSeries( newGraph, &seriesIdx );
+      if( retCode != TA_SUCCESS )
+      {
+         TA_GraphFree( newGraph );
+         return retCode;
+      }
+   }
+
+   *graph = newGraph;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_GraphFree( TA_Graph *graph )
+{
+   if( !graph )
+      return TA_BAD_PARAM;
+
+   freePool( graph );
+   FREE_IF_NOT_NULL( graph->nodes );
+   FREE_IF_NOT_NULL( graph->series );
+   TA_Free( graph );
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_GraphAdd( TA_Graph *graph,
+                        TA_GraphFuncId funcId,
+                        const TA_GraphSeries inputs[],
+                        const double optIn[],
+                        TA_GraphSeries outputs[] )
+{
+   int node1[TA_GRAPH_MAX_OUTPUT], node2[TA_GRAPH_MAX_OUTPUT];
+   int in[TA_GRAPH_MAX_INPUT];
+   double opt[TA_GRAPH_MAX_OPTIN];
+   int i, nbInput, nbOptIn, nbOutput, period;
+   TA_RetCode retCode;
+
+   if( !graph || !inputs || !outputs )
+      return TA_BAD_PARAM;
+
+   switch( funcId )
+   {
+   case TA_GRAPH_MA:       nbInput = 1; nbOptIn = 2; nbOutput = 1; break;
+   case TA_GRAPH_SMA:      nbInput = 1; nbOptIn = 1; nbOutput = 1; break;
+   case TA_GRAPH_EMA:      nbInput = 1; nbOptIn = 1; nbOutput = 1; break;
+   case TA_GRAPH_STDDEV:   nbInput = 1; nbOptIn = 2; nbOutput = 1; break;
+   case TA_GRAPH_BBANDS:   nbInput = 1; nbOptIn = 4; nbOutput = 3; break;
+   case TA_GRAPH_TRANGE:   nbInput = 3; nbOptIn = 0; nbOutput = 1; break;
+   case TA_GRAPH_ATR:      nbInput = 3; nbOptIn = 1; nbOutput = 1; break;
+   case TA_GRAPH_NATR:     nbInput = 3; nbOptIn = 1; nbOutput = 1; break;
+   case TA_GRAPH_RSI:      nbInput = 1; nbOptIn = 1; nbOutput = 1; break;
+   case TA_GRAPH_STOCHF:   nbInput = 3; nbOptIn = 3; nbOutput = 2; break;
+   case TA_GRAPH_STOCHRSI: nbInput = 1; nbOptIn = 4; nbOutput = 2; break;
+   case TA_GRAPH_ADX:      nbInput = 3; nbOptIn = 1; nbOutput = 1; break;
+   case TA_GRAPH_ADXR:     nbInput = 3; nbOptIn = 1; nbOutput = 1; break;
+   case TA_GRAPH_SMAEXT:   nbInput = 1; nbOptIn = 2; nbOutput = 1; break;
+   case TA_GRAPH_BIAS:     nbInput = 1; nbOptIn = 3; nbOutput = 1; break;
+   default:
+      return TA_BAD_PARAM;
+   }
+
+   if( (nbOptIn > 0) && (!optIn || isDefault( nbOptIn, optIn )) )
+      return TA_BAD_PARAM;
+
+   for( i=0; i < nbInput; i++ )
+   {
+      if( (inputs[i] < 0) || (inputs[i] >= graph->nbSeries) )
+         return TA_BAD_PARAM;
+      in[i] = inputs[i];
+   }
+   for( i=0; i < nbOptIn; i++ )
+      opt[i] = optIn[i];
+
+   /* Validate the parameters with the lookback of the TA function. */
+   period = nbOptIn? (int)opt[0] : 0;
+   switch( funcId )
+   {
+   case TA_GRAPH_MA:       i = TA_MA_Lookback( period, (TA_MAType)(int)opt[1] ); break;
+   case TA_GRAPH_SMA:      i = TA_SMA_Lookback( period ); break;
+   case TA_GRAPH_EMA:      i = TA_EMA_Lookback( period ); break;
+   case TA_GRAPH_STDDEV:   i = TA_STDDEV_Lookback( period, opt[1] ); break;
+   case TA_GRAPH_BBANDS:   i = TA_BBANDS_Lookback( period, opt[1], opt[2], (TA_MAType)(int)opt[3] ); break;
+   case TA_GRAPH_TRANGE:   i = TA_TRANGE_Lookback(); break;
+   case TA_GRAPH_ATR:      i = TA_ATR_Lookback( period ); break;
+   case TA_GRAPH_NATR:     i = TA_NATR_Lookback( period ); break;
+   case TA_GRAPH_RSI:      i = TA_RSI_Lookback( period ); break;
+   case TA_GRAPH_STOCHF:   i = TA_STOCHF_Lookback( period, (int)opt[1], (TA_MAType)(int)opt[2] ); break;
+   case TA_GRAPH_STOCHRSI: i = TA_STOCHRSI_Lookback( period, (int)opt[1], (int)opt[2], (TA_MAType)(int)opt[3] ); break;
+   case TA_GRAPH_ADX:      i = TA_ADX_Lookback( period ); break;
+   case TA_GRAPH_ADXR:     i = TA_ADXR_Lookback( period ); break;
+   case TA_GRAPH_SMAEXT:   i = TA_SmaExt_Lookback( period, (int)opt[1] ); break;
+   case TA_GRAPH_BIAS:
+      i = TA_Bias_Lookback( period, (int)opt[1], (int)opt[2] );
+      if( (period < 1) || (period > 100000) || ((int)opt[1] < 1) || ((int)opt[1] > 100000) )
+         i = -1;
+      break;
+   default:
+      i = -1;
+   }
+   if( i < 0 )
+      return TA_BAD_PARAM;
+
+   /* Decompose the composite functions. */
+   switch( funcId )
+   {
+   case TA_GRAPH_SMA:
+   case TA_GRAPH_EMA:
+      /* Same calculation as TA_MA with the corresponding type. */
+      opt[1] = (funcId == TA_GRAPH_SMA)? TA_MAType_SMA : TA_MAType_EMA;
+      retCode = addNode( graph, TA_GRAPH_MA, 1, in, 2, opt, 1, outputs );
+      break;
+
+   case TA_GRAPH_BBANDS:
+      /* Middle band. */
+      opt[1] = (int)optIn[3];
+      retCode = addNode( graph, TA_GRAPH_MA, 1, in, 2, opt, 1, node1 );
+      if( retCode != TA_SUCCESS )
+         return retCode;
+
+      /* Standard deviation around the middle band. */
+      in[1] = node1[0];
+      opt[1] = ((int)optIn[3] == TA_MAType_SMA)? 1 : 0;
+      retCode = addNode( graph, NODE_BBANDS_STDDEV, 2, in, 2, opt, 1, node2 );
+      if( retCode != TA_SUCCESS )
+         return retCode;
+
+      in[0] = node1[0];
+      in[1] = node2[0];
+      opt[0] = optIn[1];
+      opt[1] = optIn[2];
+      retCode = addNode( graph, NODE_BBANDS_BANDS, 2, in, 2, opt, 2, node2 );
+
+      outputs[0] = node2[0];
+      outputs[1] = node1[0];
+      outputs[2] = node2[1];
+      break;
+
+   case TA_GRAPH_ATR:
+   case TA_GRAPH_NATR:
+      retCode = addNode( graph, TA_GRAPH_TRANGE, 3, in, 0, NULL, 1, node1 );
+      if( retCode != TA_SUCCESS )
+         return retCode;
+
+      /* Wilder smoothing of the TRANGE. Each function has its own
+       * unstable period. The close (in[2]) is still needed by NATR.
+       */
+      in[0] = node1[0];
+      opt[1] = (funcId == TA_GRAPH_ATR)? TA_FUNC_UNST_ATR : TA_FUNC_UNST_NATR;
+      if( (funcId == TA_GRAPH_ATR) || (period <= 1) )
+      {
+         /* NATR is not normalized when there is no smoothing. */
+         retCode = addNode( graph, NODE_WILDER_ATR, 1, in, 2, opt, 1, outputs );
+         break;
+      }
+
+      retCode = addNode( graph, NODE_WILDER_ATR, 1, in, 2, opt, 1, node2 );
+      if( retCode != TA_SUCCESS )
+         return retCode;
+
+      in[0] = node2[0];
+      in[1] = in[2];
+      retCode = addNode( graph, NODE_NATR, 2, in, 0, NULL, 1, outputs );
+      break;
+
+   case TA_GRAPH_STOCHRSI:
+      retCode = addNode( graph, TA_GRAPH_RSI, 1, in, 1, opt, 1, node1 );
+      if( retCode != TA_SUCCESS )
+         return retCode;
+
+      in[0] = in[1] = in[2] = node1[0];
+      opt[0] = optIn[1];
+      opt[1] = optIn[2];
+      opt[2] = optIn[3];
+      retCode = addNode( graph, TA_GRAPH_STOCHF, 3, in, 3, opt, 2, outputs );
+      break;
+
+   case TA_GRAPH_ADXR:
+      retCode = addNode( graph, TA_GRAPH_ADX, 3, in, 1, opt, 1, node1 );
+      if( retCode != TA_SUCCESS )
+         return retCode;
+      retCode = addNode( graph, NODE_ADXR, 1, node1, 1, opt, 1, outputs );
+      break;
+
+   case TA_GRAPH_BIAS:
+      opt[1] = 0;
+      retCode = addNode( graph, TA_GRAPH_SMAEXT, 1, in, 2, opt, 1, node1 );
+      if( retCode != TA_SUCCESS )
+         return retCode;
+
+      opt[0] = optIn[1];
+      opt[1] = optIn[2];
+      retCode = addNode( graph, TA_GRAPH_SMAEXT, 1, in, 2, opt, 1, node2 );
+      if( retCode != TA_SUCCESS )
+         return retCode;
+
+      in[0] = node1[0];
+      in[1] = node2[0];
+      retCode = addNode( graph, NODE_BIAS, 2, in, 0, NULL, 1, outputs );
+      break;
+
+   default:
+      /* Not a composite. */
+      retCode = addNode( graph, funcId, nbInput, in, nbOptIn, opt, nbOutput, outputs );
+   }
+
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   /* Only the series returned to the caller are kept until the
+    * end of TA_GraphCompute().
+    */
+   for( i=0; i < nbOutput; i++ )
+      graph->series[outputs[i]].isRequested = 1;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_GraphCompute( TA_Graph *graph,
+                            int nbBars,
+                            const double open[],
+                            const double high[],
+                            const double low[],
+                            const double close[],
+                            const double volume[] )
+{
+   const double *source[TA_GRAPH_NB_SOURCE];
+   TA_GraphSeriesDef *series;
+   const TA_GraphNode *node;
+   TA_RetCode retCode;
+   int i, j;
+
+   if( !graph || (nbBars < 0) )
+      return TA_BAD_PARAM;
+
+   source[TA_GRAPH_OPEN]   = open;
+   source[TA_GRAPH_HIGH]   = high;
+   source[TA_GRAPH_LOW]    = low;
+   source[TA_GRAPH_CLOSE]  = close;
+   source[TA_GRAPH_VOLUME] = volume;
+
+   /* A missing price component is allowed only if not used. */
+   for( i=0; i < TA_GRAPH_NB_SOURCE; i++ )
+   {
+      if( !source[i] && graph->series[i].nbConsumer )
+         return TA_BAD_PARAM;
+   }
+
+   /* Buffers from a previous calculation go back to the pool. */
+   if( nbBars > graph->poolSize )
+   {
+      freePool( graph );
+      graph->poolSize = nbBars;
+   }
+   for( i=0; i < graph->nbSeries; i++ )
+   {
+      series = &graph->series[i];
+      if( series->buffer )
+         releaseBuffer( graph, series );
+      series->data      = NULL;
+      series->begIdx    = 0;
+      series->nbElement = 0;
+      series->remaining = series->nbConsumer;
+   }
+
+   for( i=0; i < TA_GRAPH_NB_SOURCE; i++ )
+   {
+      graph->series[i].data      = source[i];
+      graph->series[i].nbElement = source[i]? nbBars : 0;
+   }
+
+   for( i=0; i < graph->nbNodes; i++ )
+   {
+      node = &graph->nodes[i];
+
+      for( j=0; j < node->nbOutput; j++ )
+      {
+         retCode = acquireBuffer( graph, &graph->series[node->output[j]] );
+         if( retCode != TA_SUCCESS )
+            return retCode;
+      }
+
+      retCode = runNode( graph, node, nbBars );
+      if( retCode != TA_SUCCESS )
+         return retCode;
+
+      /* Recycle the intermediates no longer needed. */
+      for( j=0; j < node->nbInput; j++ )
+      {
+         series = &graph->series[node->input[j]];
+         if( (--series->remaining == 0) && series->buffer && !series->isRequested )
+            releaseBuffer( graph, series );
+      }
+      for( j=0; j < node->nbOutput; j++ )
+      {
+         series = &graph->series[node->output[j]];
+         if( (series->nbConsumer == 0) && !series->isRequested )
+            releaseBuffer( graph, series );
+      }
+   }
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_GraphGetSeries( const TA_Graph *graph,
+                              TA_GraphSeries series,
+                              int *outBegIdx,
+                              int *outNBElement,
+                              const double **outReal )
+{
+   const TA_GraphSeriesDef *def;
+
+   if( !graph || !outBegIdx || !outNBElement || !outReal )
+      return TA_BAD_PARAM;
+
+   if( (series < TA_GRAPH_NB_SOURCE) || (series >= graph->nbSeries) ||
+       !graph->series[series].isRequested )
+      return TA_BAD_PARAM;
+
+   def = &graph->series[series];
+   if( !def->data || (def->nbElement == 0) )
+   {
+      *outBegIdx    = 0;
+      *outNBElement = 0;
+      *outReal      = NULL;
+      return TA_SUCCESS;
+   }
+
+   *outBegIdx    = def->begIdx;
+   *outNBElement = def->nbElement;
+   *outReal      = &def->data[def->begIdx];
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_GraphGetInfo( const TA_Graph *graph, TA_GraphInfo *info )
+{
+   if( !graph || !info )
+      return TA_BAD_PARAM;
+
+   info->nbNodes   = graph->nbNodes;
+   info->nbShared  = graph->nbShared;
+   info->nbBuffers = graph->nbPool;
+
+   return TA_SUCCESS;
+}
+
+/**** Local functions definitions.     ****/
+static TA_RetCode addNode( TA_Graph *graph, int kind,
+                           int nbInput, const int *input,
+                           int nbOptIn, const double *optIn,
+                           int nbOutput, int *output )
+{
+   TA_GraphNode *node, *newNodes;
+   TA_RetCode retCode;
+   int i, newMax;
+
+   /* Re-use an identical node. The arrays can be NULL when empty,
+    * which memcmp() does not accept even for 0 bytes.
+    */
+   for( i=0; i < graph->nbNodes; i++ )
+   {
+      node = &graph->nodes[i];
+      if( (node->kind == kind) &&
+          ((nbInput == 0) || (memcmp( node->input, input, sizeof(int)*nbInput ) == 0)) &&
+          ((nbOptIn == 0) || (memcmp( node->optIn, optIn, sizeof(double)*nbOptIn ) == 0)) )
+      {
+         memcpy( output, node->output, sizeof(int)*nbOutput );
+         graph->nbShared++;
+         return TA_SUCCESS;
+      }
+   }
+
+   if( graph->nbNodes == graph->maxNodes )
+   {
+      newMax = graph->maxNodes? graph->maxNodes*2 : 32;
+      newNodes = (TA_GraphNode *)TA_Realloc( graph->nodes, sizeof(TA_GraphNode)*newMax );
+      if( !newNodes )
+         return TA_ALLOC_ERR;
+      graph->nodes = newNodes;
+      graph->maxNodes = newMax;
+   }
+
+   node = &graph->nodes[graph->nbNodes];
+   memset( node, 0, sizeof(TA_GraphNode) );
+   node->kind     = kind;
+   node->nbInput  = nbInput;
+   node->nbOptIn  = nbOptIn;
+   node->nbOutput = nbOutput;
+   if( nbInput )
+      memcpy( node->input, input, sizeof(int)*nbInput );
+   if( nbOptIn )
+      memcpy( node->optIn, optIn, sizeof(double)*nbOptIn );
+
+   for( i=0; i < nbOutput; i++ )
+   {
+      retCode = addSeries( graph, &node->output[i] );
+      if( retCode != TA_SUCCESS )
+         return retCode;
+      output[i] = node->output[i];
+   }
+
+   for( i=0; i < nbInput; i++ )
+      graph->series[input[i]].nbConsumer++;
+
+   graph->nbNodes++;
+
+   return TA_SUCCESS;
+}
+
+static TA_RetCode addSeries( TA_Graph *graph, int *seriesIdx )
+{
+   TA_GraphSeriesDef *newSeries;
+   int newMax;
+
+   if( graph->nbSeries == graph->maxSeries )
+   {
+      newMax = graph->maxSeries? graph->maxSeries*2 : 64;
+      newSeries = (TA_GraphSeriesDef *)TA_Realloc( graph->series, sizeof(TA_GraphSeriesDef)*newMax );
+      if( !newSeries )
+         return TA_ALLOC_ERR;
+      graph->series = newSeries;
+      graph->maxSeries = newMax;
+   }
+
+   memset( &graph->series[graph->nbSeries], 0, sizeof(TA_GraphSeriesDef) );
+   *seriesIdx = graph->nbSeries++;
+
+   return TA_SUCCESS;
+}
+
+static int isDefault( int nbOptIn, const double *optIn )
+{
+   int i;
+
+   for( i=0; i < nbOptIn; i++ )
+   {
+      if( (optIn[i] == (double)TA_INTEGER_DEFAULT) || (optIn[i] == TA_REAL_DEFAULT) )
+         return 1;
+   }
+
+   return 0;
+}
+
+static TA_RetCode acquireBuffer( TA_Graph *graph, TA_GraphSeriesDef *series )
+{
+   double **newPool;
+   double *buffer;
+
+   if( graph->nbFree > 0 )
+      buffer = graph->freeList[--graph->nbFree];
+   else
+   {
+      /* The free list is sized as the pool, so it can
+       * always receive all the buffers.
+       */
+      newPool = (double **)TA_Realloc( graph->pool, sizeof(double *)*(graph->nbPool+1) );
+      if( !newPool )
+         return TA_ALLOC_ERR;
+      graph->pool = newPool;
+
+      newPool = (double **)TA_Realloc( graph->freeList, sizeof(double *)*(graph->nbPool+1) );
+      if( !newPool )
+         return TA_ALLOC_ERR;
+      graph->freeList = newPool;
+
+      buffer = (double *)TA_Malloc( sizeof(double)*(graph->poolSize? graph->poolSize : 1) );
+      if( !buffer )
+         return TA_ALLOC_ERR;
+      graph->pool[graph->nbPool++] = buffer;
+   }
+
+   series->buffer    = buffer;
+   series->data      = buffer;
+   series->begIdx    = 0;
+   series->nbElement = 0;
+
+   return TA_SUCCESS;
+}
+
+static void releaseBuffer( TA_Graph *graph, TA_GraphSeriesDef *series )
+{
+   if( series->buffer )
+      graph->freeList[graph->nbFree++] = series->buffer;
+
+   series->buffer = NULL;
+   series->data   = NULL;
+}
+
+static void freePool( TA_Graph *graph )
+{
+   int i;
+
+   for( i=0; i < graph->nbSeries; i++ )
+   {
+      graph->series[i].buffer = NULL;
+      if( i >= TA_GRAPH_NB_SOURCE )
+         graph->series[i].data = NULL;
+   }
+
+   for( i=0; i < graph->nbPool; i++ )
+      TA_Free( graph->pool[i] );
+
+   FREE_IF_NOT_NULL( graph->pool );
+   FREE_IF_NOT_NULL( graph->freeList );
+   graph->nbPool = 0;
+   graph->nbFree = 0;
+   graph->poolSize = 0;
+}
+
+static TA_RetCode runNode( TA_Graph *graph, const TA_GraphNode *node, int nbBars )
+{
+   const TA_GraphSeriesDef *in0, *in1;
+   TA_GraphSeriesDef *out0, *out1;
+   int i, begIdx, period, unstablePeriod, today, outIdx, outBegIdx1, outNbElement1;
+   double prevATR, tempReal, tempReal2;
+   double *outData;
+
+   if( node->kind < TA_GRAPH_NB_FUNC )
+      return runLeaf( graph, node, nbBars );
+
+   in0  = &graph->series[node->input[0]];
+   in1  = node->nbInput > 1? &graph->series[node->input[1]] : NULL;
+   out0 = &graph->series[node->output[0]];
+   out1 = node->nbOutput > 1? &graph->series[node->output[1]] : NULL;
+
+   /* Nothing to calculate when an input is empty. */
+   if( (in0->nbElement == 0) || (in1 && (in1->nbElement == 0)) )
+      return TA_SUCCESS;
+
+   outData = out0->buffer;
+   period = (int)node->optIn[0];
+
+   switch( node->kind )
+   {
+   case NODE_BBANDS_STDDEV:
+      /* Same as TA_BBANDS. in0 is the price, in1 the middle band. */
+      if( node->optIn[1] != 0.0 )
+      {
+         TA_INT_stddev_using_precalc_ma( &in0->data[in0->begIdx],
+                                         &in1->data[in1->begIdx],
+                                         in1->begIdx - in0->begIdx,
+                                         in1->nbElement, period,
+                                         &outData[in1->begIdx] );
+         out0->begIdx    = in1->begIdx;
+         out0->nbElement = in1->nbElement;
+         return TA_SUCCESS;
+      }
+
+      /* The stddev starts after the middle band when the MA has a
+       * lookback shorter than period-1 (see TA_BBANDS_Lookback).
+       */
+      begIdx = in1->begIdx - in0->begIdx;
+      if( TA_STDDEV_Lookback( period, 1.0 ) > begIdx )
+         begIdx = TA_STDDEV_Lookback( period, 1.0 );
+      if( begIdx > nbBars-1-in0->begIdx )
+         return TA_SUCCESS;
+
+      if( TA_STDDEV( begIdx, nbBars-1-in0->begIdx, &in0->data[in0->begIdx],
+                     period, 1.0, &outBegIdx1, &outNbElement1,
+                     &outData[in0->begIdx+begIdx] ) != TA_SUCCESS )
+         return TA_INTERNAL_ERROR;
+
+      out0->begIdx    = in0->begIdx+outBegIdx1;
+      out0->nbElement = outNbElement1;
+      return TA_SUCCESS;
+
+   case NODE_BBANDS_BANDS:
+      /* Same as TA_BBANDS. in0 is the middle band, in1 the stddev. */
+      begIdx = in0->begIdx > in1->begIdx? in0->begIdx : in1->begIdx;
+      for( i=begIdx; i < nbBars; i++ )
+      {
+         tempReal  = in1->data[i];
+         tempReal2 = in0->data[i];
+         out0->buffer[i] = tempReal2 + (tempReal * node->optIn[0]);
+         out1->buffer[i] = tempReal2 - (tempReal * node->optIn[1]);
+      }
+      out0->begIdx = out1->begIdx = begIdx;
+      out0->nbElement = out1->nbElement = nbBars-begIdx;
+      return TA_SUCCESS;
+
+   case NODE_WILDER_ATR:
+      /* Same as TA_ATR/TA_NATR, in0 is the TRANGE. */
+      unstablePeriod = TA_GLOBALS_UNSTABLE_PERIOD( (int)node->optIn[1], Atr );
+      if( in0->nbElement < period+unstablePeriod )
+         return TA_SUCCESS;
+
+      if( period <= 1 )
+      {
+         begIdx = in0->begIdx+unstablePeriod;
+         memcpy( &outData[begIdx], &in0->data[begIdx], sizeof(double)*(nbBars-begIdx) );
+         out0->begIdx    = begIdx;
+         out0->nbElement = nbBars-begIdx;
+         return TA_SUCCESS;
+      }
+
+      TA_INT_SMA( period-1, period-1, &in0->data[in0->begIdx], period,
+                  &outBegIdx1, &outNbElement1, &prevATR );
+
+      today = in0->begIdx+period;
+      for( i=unstablePeriod; i != 0; i-- )
+      {
+         prevATR *= period - 1;
+         prevATR += in0->data[today++];
+         prevATR /= period;
+      }
+
+      outIdx = today-1;
+      out0->begIdx = outIdx;
+      outData[outIdx++] = prevATR;
+      while( today < nbBars )
+      {
+         prevATR *= period - 1;
+         prevATR += in0->data[today++];
+         prevATR /= period;
+         outData[outIdx++] = prevATR;
+      }
+      out0->nbElement = outIdx-out0->begIdx;
+      return TA_SUCCESS;
+
+   case NODE_NATR:
+      /* Same as TA_NATR. in0 is the smoothed TRANGE, in1 the close. */
+      begIdx = in0->begIdx > in1->begIdx? in0->begIdx : in1->begIdx;
+      for( i=begIdx; i < nbBars; i++ )
+      {
+         tempReal = in1->data[i];
+         if( !TA_IS_ZERO(tempReal) )
+            outData[i] = (in0->data[i]/tempReal)*100.0;
+         else
+            outData[i] = 0.0;
+      }
+      out0->begIdx = begIdx;
+      out0->nbElement = nbBars-begIdx;
+      return TA_SUCCESS;
+
+   case NODE_ADXR:
+      /* Same as TA_ADXR. */
+      begIdx = in0->begIdx+period-1;
+      if( begIdx >= nbBars )
+         return TA_SUCCESS;
+      for( i=begIdx; i < nbBars; i++ )
+         outData[i] = (in0->data[i]+in0->data[i-(period-1)])/2.0;
+      out0->begIdx = begIdx;
+      out0->nbElement = nbBars-begIdx;
+      return TA_SUCCESS;
+
+   case NODE_BIAS:
+      /* Same as TA_Bias. */
+      begIdx = in0->begIdx > in1->begIdx? in0->begIdx : in1->begIdx;
+      for( i=begIdx; i < nbBars; i++ )
+      {
+         tempReal  = in0->data[i];
+         tempReal2 = in1->data[i];
+         outData[i] = (tempReal - tempReal2) * 100 / tempReal2;
+      }
+      out0->begIdx = begIdx;
+      out0->nbElement = nbBars-begIdx;
+      return TA_SUCCESS;
+   }
+
+   return TA_INTERNAL_ERROR;
+}
+
+/* Call the TA function of a node on its inputs re-based on
+ * their first common valid bar.
+ */
+static TA_RetCode runLeaf( TA_Graph *graph, const TA_GraphNode *node, int nbBars )
+{
+   const double *in[TA_GRAPH_MAX_INPUT];
+   double *out[TA_GRAPH_MAX_OUTPUT];
+   const TA_GraphSeriesDef *series;
+   TA_RetCode retCode;
+   int i, base, endIdx, lookback, outBegIdx, outNBElement, period;
+   const double *opt = node->optIn;
+
+   base = 0;
+   for( i=0; i < node->nbInput; i++ )
+   {
+      series = &graph->series[node->input[i]];
+      if( series->nbElement == 0 )
+         return TA_SUCCESS;
+      if( series->begIdx > base )
+         base = series->begIdx;
+   }
+
+   period = node->nbOptIn? (int)opt[0] : 0;
+   switch( node->kind )
+   {
+   case TA_GRAPH_MA:     lookback = TA_MA_Lookback( period, (TA_MAType)(int)opt[1] ); break;
+   case TA_GRAPH_STDDEV: lookback = TA_STDDEV_Lookback( period, opt[1] ); break;
+   case TA_GRAPH_TRANGE: lookback = TA_TRANGE_Lookback(); break;
+   case TA_GRAPH_RSI:    lookback = TA_RSI_Lookback( period ); break;
+   case TA_GRAPH_STOCHF: lookback = TA_STOCHF_Lookback( period, (int)opt[1], (TA_MAType)(int)opt[2] ); break;
+   case TA_GRAPH_ADX:    lookback = TA_ADX_Lookback( period ); break;
+   case TA_GRAPH_SMAEXT: lookback = TA_SmaExt_Lookback( period, (int)opt[1] ); break;
+   default:
+      return TA_INTERNAL_ERROR;
+   }
+
+   endIdx = nbBars-1-base;
+   if( (lookback < 0) || (endIdx < lookback) )
+      return TA_SUCCESS;
+
+   for( i=0; i < node->nbInput; i++ )
+      in[i] = &graph->series[node->input[i]].data[base];
+   for( i=0; i < node->nbOutput; i++ )
+      out[i] = &graph->series[node->output[i]].buffer[base+lookback];
+
+   switch( node->kind )
+   {
+   case TA_GRAPH_MA:
+      retCode = TA_MA( 0, endIdx, in[0], period, (TA_MAType)(int)opt[1],
+                       &outBegIdx, &outNBElement, out[0] );
+      break;
+   case TA_GRAPH_STDDEV:
+      retCode = TA_STDDEV( 0, endIdx, in[0], period, opt[1],
+                           &outBegIdx, &outNBElement, out[0] );
+      break;
+   case TA_GRAPH_TRANGE:
+      retCode = TA_TRANGE( 0, endIdx, in[0], in[1], in[2],
+                           &outBegIdx, &outNBElement, out[0] );
+      break;
+   case TA_GRAPH_RSI:
+      retCode = TA_RSI( 0, endIdx, in[0], period,
+                        &outBegIdx, &outNBElement, out[0] );
+      break;
+   case TA_GRAPH_STOCHF:
+      retCode = TA_STOCHF( 0, endIdx, in[0], in[1], in[2], period, (int)opt[1],
+                           (TA_MAType)(int)opt[2], &outBegIdx, &outNBElement,
+                           out[0], out[1] );
+      break;
+   case TA_GRAPH_ADX:
+      retCode = TA_ADX( 0, endIdx, in[0], in[1], in[2], period,
+                        &outBegIdx, &outNBElement, out[0] );
+      break;
+   case TA_GRAPH_SMAEXT:
+      retCode = TA_SmaExt( 0, endIdx, in[0], period, (int)opt[1],
+                           &outBegIdx, &outNBElement, out[0] );
+      break;
+   default:
+      return TA_INTERNAL_ERROR;
+   }
+
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   /* The output was written assuming it starts at the lookback. */
+   if( (outNBElement > 0) && (outBegIdx != lookback) )
+      return TA_INTERNAL_ERROR;
+
+   for( i=0; i < node->nbOutput; i++ )
+   {
+      graph->series[node->output[i]].begIdx    = base+lookback;
+      graph->series[node->output[i]].nbElement = outNBElement;
+   }
+
+   return TA_SUCCESS;
+}
@@ -0,0 +1,335 @@
+/* Description:
+ *   Instrumentation of the calls through the function registry
+ *   (see ta_instr.h and ta_instr_priv.h).
+ *
+ *   Each thread has its own counters (thread-local storage), so the
+ *   counting needs no lock. The exporters are always available, to
+ *   format a snapshot received from an instrumented build.
+ */
+
+/**** Headers ****/
+#include <string.h>
+
+#if defined(TA_INSTRUMENT)
+   #if defined(_WIN32)
+      #include <windows.h>
+   #else
+      #include <time.h>
+   #endif
+#endif
+
+#include "ta_func.h"
+#include "ta_utility.h"
+#include "ta_registry.h"
+#include "ta_instr.h"
+#include "ta_instr_priv.h"
+
+/**** Local declarations.              ****/
+/* Text written by the exporters. Only the size is counted when
+ * there is no buffer, or when it is too small.
+ */
+typedef struct
+{
+   char  *buffer;
+   size_t size;
+   size_t used;
+} TA_InstrWriter;
+
+/* One counter of the exporters. */
+typedef struct
+{
+   const char *jsonName;
+   const char *metricName;
+   const char *help;
+} TA_InstrMetric;
+
+#define NB_METRIC 6
+
+/**** Local functions declarations.    ****/
+static Int64 counterValue( const TA_InstrCounters *counters, int metric );
+static void putText( TA_InstrWriter *writer, const char *text );
+static void putInt64( TA_InstrWriter *writer, Int64 value );
+static void exportJSON( const TA_InstrSnapshot *snapshot, TA_InstrWriter *writer );
+static void exportPrometheus( const TA_InstrSnapshot *snapshot, TA_InstrWriter *writer );
+
+#if defined(TA_INSTRUMENT)
+static Int64 nowNanoseconds( void );
+#endif
+
+/**** Local variables definitions.     ****/
+static const TA_InstrMetric metrics[NB_METRIC] =
+{
+   { "calls",       "ta_calls_total",           "Number of calls." },
+   { "inputBars",   "ta_input_bars_total",      "Bars of the requested ranges." },
+   { "outputBars",  "ta_output_bars_total",     "Elements written in the outputs." },
+   { "nanoseconds", "ta_nanoseconds_total",     "Time spent in the function." },
+   { "allocations", "ta_allocations_total",     "Allocations during the calls." },
+   { "bytes",       "ta_allocated_bytes_total", "Bytes allocated during the calls." }
+};
+
+#if defined(TA_INSTRUMENT)
+static TA_THREAD_LOCAL TA_InstrCounters threadCounters[TA_INSTR_MAX_FUNC];
+static TA_THREAD_LOCAL int threadFuncIdx = -1; /* Function being called, -1 for none. */
+#endif
+
+/**** Global functions definitions.   ****/
+int TA_InstrEnabled( void )
+{
+#if defined(TA_INSTRUMENT)
+   return 1;
+#else
+   return 0;
+#endif
+}
+
+TA_RetCode TA_InstrGetSnapshot( TA_InstrSnapshot *snapshot )
+{
+   if( !snapshot )
+      return TA_BAD_PARAM;
+
+   memset( snapshot, 0, sizeof(TA_InstrSnapshot) );
+#if defined(TA_INSTRUMENT)
+   snapshot->nbFunc = min( TA_FuncCount(), TA_INSTR_MAX_FUNC );
+   memcpy( snapshot->func, threadCounters, sizeof(TA_InstrCounters)*snapshot->nbFunc );
+   return TA_SUCCESS;
+#else
+   return TA_NOT_SUPPORTED;
+#endif
+}
+
+TA_RetCode TA_InstrReset( void )
+{
+#if defined(TA_INSTRUMENT)
+   memset( threadCounters, 0, sizeof(threadCounters) );
+   return TA_SUCCESS;
+#else
+   return TA_NOT_SUPPORTED;
+#endif
+}
+
+TA_RetCode TA_InstrMerge( TA_InstrSnapshot *dest, const TA_InstrSnapshot *src )
+{
+   TA_InstrCounters *to;
+   const TA_InstrCounters *from;
+   int i;
+
+   if( !dest || !src || (src->nbFunc < 0) || (src->nbFunc > TA_INSTR_MAX_FUNC) )
+      return TA_BAD_PARAM;
+
+   for( i=0; i < src->nbFunc; i++ )
+   {
+      to   = &dest->func[i];
+      from = &src->func[i];
+      to->nbCalls       += from->nbCalls;
+      to->nbInputBars   += from->nbInputBars;
+      to->nbOutputBars  += from->nbOutputBars;
+      to->nbNanoseconds += from->nbNanoseconds;
+      to->nbAlloc       += from->nbAlloc;
+      to->nbBytes       += from->nbBytes;
+   }
+
+   dest->nbFunc = max( dest->nbFunc, src->nbFunc );
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_InstrExport( const TA_InstrSnapshot *snapshot,
+                           TA_InstrFormat          format,
+                           char                   *buffer,
+                           size_t                  bufferSize,
+                           size_t                 *outSize )
+{
+   TA_InstrWriter writer;
+
+   if( !snapshot || !outSize || (snapshot->nbFunc < 0) || (snapshot->nbFunc > TA_INSTR_MAX_FUNC) )
+      return TA_BAD_PARAM;
+
+   writer.buffer = buffer;
+   writer.size   = bufferSize;
+   writer.used   = 0;
+
+   switch( format )
+   {
+   case TA_INSTR_JSON:
+      exportJSON( snapshot, &writer );
+      break;
+   case TA_INSTR_PROMETHEUS:
+      exportPrometheus( snapshot, &writer );
+      break;
+   default:
+      return TA_BAD_PARAM;
+   }
+
+   *outSize = writer.used;
+   if( !buffer )
+      return TA_SUCCESS;
+   if( writer.used >= bufferSize )
+      return TA_BAD_PARAM;
+
+   buffer[writer.used] = '\0';
+   return TA_SUCCESS;
+}
+
+#if defined(TA_INSTRUMENT)
+void TA_InstrBegin( TA_InstrFrame *frame, int funcIdx )
+{
+   frame->funcIdx     = funcIdx;
+   frame->prevFuncIdx = threadFuncIdx;
+   threadFuncIdx = funcIdx;
+   frame->start = nowNanoseconds();
+}
+
+void TA_InstrEnd( const TA_InstrFrame *frame, int startIdx, int endIdx,
+                  TA_RetCode retCode, const int *outNBElement )
+{
+   TA_InstrCounters *counters;
+   Int64 end;
+
+   end = nowNanoseconds();
+   threadFuncIdx = frame->prevFuncIdx;
+   if( (frame->funcIdx < 0) || (frame->funcIdx >= TA_INSTR_MAX_FUNC) )
+      return;
+
+   counters = &threadCounters[frame->funcIdx];
+   counters->nbCalls++;
+   counters->nbNanoseconds += end-frame->start;
+   if( retCode != TA_SUCCESS )
+      return;
+
+   if( endIdx >= startIdx )
+      counters->nbInputBars += endIdx-startIdx+1;
+   if( outNBElement )
+      counters->nbOutputBars += *outNBElement;
+}
+
+void TA_InstrAlloc( size_t size )
+{
+   TA_InstrCounters *counters;
+
+   if( (threadFuncIdx < 0) || (threadFuncIdx >= TA_INSTR_MAX_FUNC) )
+      return;
+
+   counters = &threadCounters[threadFuncIdx];
+   counters->nbAlloc++;
+   counters->nbBytes += (Int64)size;
+}
+#endif
+
+/**** Local functions definitions.     ****/
+static Int64 counterValue( const TA_InstrCounters *counters, int metric )
+{
+   switch( metric )
+   {
+   case 0:  return counters->nbCalls;
+   case 1:  return counters->nbInputBars;
+   case 2:  return counters->nbOutputBars;
+   case 3:  return counters->nbNanoseconds;
+   case 4:  return counters->nbAlloc;
+   default: return counters->nbBytes;
+   }
+}
+
+static void exportJSON( const TA_InstrSnapshot *snapshot, TA_InstrWriter *writer )
+{
+   int i, metric, isFirst;
+
+   putText( writer, "{\"functions\":[" );
+   isFirst = 1;
+   for( i=0; (i < snapshot->nbFunc) && (i < TA_FuncCount()); i++ )
+   {
+      if( snapshot->func[i].nbCalls == 0 )
+         continue;
+
+      putText( writer, isFirst? "\n{\"name\":\"" : ",\n{\"name\":\"" );
+      putText( writer, TA_FuncAt( i )->name );
+      putText( writer, "\"" );
+      for( metric=0; metric < NB_METRIC; metric++ )
+      {
+         putText( writer, ",\"" );
+         putText( writer, metrics[metric].jsonName );
+         putText( writer, "\":" );
+         putInt64( writer, counterValue( &snapshot->func[i], metric ) );
+      }
+      putText( writer, "}" );
+      isFirst = 0;
+   }
+   putText( writer, "\n]}\n" );
+}
+
+static void exportPrometheus( const TA_InstrSnapshot *snapshot, TA_InstrWriter *writer )
+{
+   int i, metric;
+
+   for( metric=0; metric < NB_METRIC; metric++ )
+   {
+      putText( writer, "# HELP " );
+      putText( writer, metrics[metric].metricName );
+      putText( writer, " " );
+      putText( writer, metrics[metric].help );
+      putText( writer, "\n# TYPE " );
+      putText( writer, metrics[metric].metricName );
+      putText( writer, " counter\n" );
+
+      for( i=0; (i < snapshot->nbFunc) && (i < TA_FuncCount()); i++ )
+      {
+         if( snapshot->func[i].nbCalls == 0 )
+            continue;
+
+         putText( writer, metrics[metric].metricName );
+         putText( writer, "{function=\"" );
+         putText( writer, TA_FuncAt( i )->name );
+         putText( writer, "\"} " );
+         putInt64( writer, counterValue( &snapshot->func[i], metric ) );
+         putText( writer, "\n" );
+      }
+   }
+}
+
+/* Always keep room for the final null. */
+static void putText( TA_InstrWriter *writer, const char *text )
+{
+   size_t length = strlen( text );
+
+   if( writer->buffer && (writer->used+length < writer->size) )
+      memcpy( writer->buffer+writer->used, text, length );
+   writer->used += length;
+}
+
+static void putInt64( TA_InstrWriter *writer, Int64 value )
+{
+   char digits[24];
+   int i = (int)sizeof(digits)-1;
+   int isNegative = value < 0;
+   UInt64 magnitude = isNegative? (UInt64)0-(UInt64)value : (UInt64)value;
+
+   digits[i] = '\0';
+   do
+   {
+      digits[--i] = (char)('0'+(int)(magnitude%10));
+      magnitude /= 10;
+   } while( magnitude );
+   if( isNegative )
+      digits[--i] = '-';
+
+   putText( writer, &digits[i] );
+}
+
+#if defined(TA_INSTRUMENT)
+static Int64 nowNanoseconds( void )
+{
+#if defined(_WIN32)
+   LARGE_INTEGER frequency, counter;
+
+   QueryPerformanceFrequency( &frequency );
+   QueryPerformanceCounter( &counter );
+
+   return (Int64)((double)counter.QuadPart*1e9/(double)frequency.QuadPart);
+#else
+   struct timespec ts;
+
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+
+   return (Int64)ts.tv_sec*1000000000 + (Int64)ts.tv_nsec;
+#endif
+}
+#endif
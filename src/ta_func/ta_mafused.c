@@ -0,0 +1,743 @@
+/* Description:
+ *   Fused calculation of several moving averages of the same
+ *   input (see ta_mafused.h).
+ *
+ *   Each average keeps the state of its TA function between the
+ *   chunks of bars, and updates it with the same sequence of
+ *   operations, so the outputs are identical to TA_MA.
+ */
+
+/**** Headers ****/
+#include <string.h>
+#include <math.h>
+#include "ta_func.h"
+#include "ta_mafused.h"
+
+#include "ta_utility.h"
+#include "ta_memory.h"
+
+/**** Local declarations.              ****/
+
+/* Nb of bars processed by all the averages before the next chunk. */
+#define FUSED_CHUNK 256
+
+/* EMA, and the 2 EMA of DEMA and 3 EMA of TEMA when not shared. */
+#define FUSED_MAX_EMA 6
+
+typedef struct
+{
+   int    parent;    /* Stage giving the input, -1 for inReal. */
+   int    firstIdx;  /* First bar used. */
+   int    seedIdx;   /* Bar where prevMA gets its first value. */
+   int    begIdx;    /* First output (startIdx of TA_INT_EMA). */
+   double sum;
+   double prevMA;
+   double value[FUSED_CHUNK]; /* prevMA of each bar of the chunk. */
+} TA_FusedEMA;
+
+typedef struct
+{
+   int    begIdx[TA_MA_NB_TYPE];
+   int    endIdx;
+   int    period;
+   int    fusedMask;  /* The averages calculated in the sweep. */
+   const double *inReal;
+   double *const *outReal;
+
+   /* EMA, DEMA and TEMA. */
+   double k;
+   int    nbEMA;
+   TA_FusedEMA ema[FUSED_MAX_EMA];
+   int    emaStage;
+   int    demaStage[2];
+   int    temaStage[3];
+
+   /* SMA */
+   double smaTotal;
+
+   /* WMA */
+   double wmaSum;
+   double wmaSub;
+   double wmaTrailing;
+
+   /* TRIMA */
+   double trimaNumerator;
+   double trimaSub;
+   double trimaAdd;
+   double trimaFactor;
+
+   /* KAMA */
+   int    kamaFirstIdx;
+   double kamaSumROC1;
+   double kamaPrev;
+   double kamaTrailing;
+
+   /* T3 */
+   int    t3FirstIdx;
+   int    t3Phase;
+   int    t3Count;
+   double t3Sum;
+   double t3Ema[6];
+   double t3Coef[4];
+} TA_FusedState;
+
+/**** Local functions declarations.    ****/
+static int  addEMA( TA_FusedState *state, int parent, int begIdx );
+static void calcEMA( TA_FusedState *state, int t0, int t1 );
+static void calcSMA( TA_FusedState *state, int t0, int t1 );
+static void calcWMA( TA_FusedState *state, int t0, int t1 );
+static void calcTRIMA( TA_FusedState *state, int t0, int t1 );
+static void calcKAMA( TA_FusedState *state, int t0, int t1 );
+static void calcT3( TA_FusedState *state, int t0, int t1 );
+
+/**** Global functions definitions.   ****/
+TA_RetCode TA_MAFused( int    startIdx,
+                       int    endIdx,
+                       const double inReal[],
+                       int    optInTimePeriod,
+                       int    maTypeMask,
+                       int    outBegIdx[],
+                       int    outNBElement[],
+                       double *const outReal[] )
+{
+   TA_FusedState *state;
+   TA_RetCode retCode;
+   ARRAY_REF(dummyBuffer);
+   double tempReal, vFactor;
+   int i, j, t0, t1, firstIdx, lookbackEMA, lookbackTotal;
+
+#ifndef TA_FUNC_NO_RANGE_CHECK
+
+   /* Validate the requested output range. */
+   if( startIdx < 0 )
+      return TA_OUT_OF_RANGE_START_INDEX;
+   if( (endIdx < 0) || (endIdx < startIdx))
+      return TA_OUT_OF_RANGE_END_INDEX;
+
+   if( !inReal ) return TA_BAD_PARAM;
+
+   /* min/max are checked for optInTimePeriod. */
+   if( (int)optInTimePeriod == TA_INTEGER_DEFAULT )
+      optInTimePeriod = 30;
+   else if( ((int)optInTimePeriod < 1) || ((int)optInTimePeriod > 100000) )
+      return TA_BAD_PARAM;
+
+   if( (maTypeMask == 0) || (maTypeMask & ~TA_MA_MASK_ALL) )
+      return TA_BAD_PARAM;
+
+   if( !outBegIdx || !outNBElement || !outReal )
+      return TA_BAD_PARAM;
+
+   /* Each requested output must be a distinct array. */
+   for( i=0; i < TA_MA_NB_TYPE; i++ )
+   {
+      if( !(maTypeMask & TA_MA_MASK(i)) )
+         continue;
+      if( !outReal[i] || (outReal[i] == inReal) )
+         return TA_BAD_PARAM;
+      for( j=0; j < i; j++ )
+      {
+         if( (maTypeMask & TA_MA_MASK(j)) && (outReal[j] == outReal[i]) )
+            return TA_BAD_PARAM;
+      }
+   }
+
+#endif /* TA_FUNC_NO_RANGE_CHECK */
+
+   /* A period of 1 is the input for all the types (see TA_MA). */
+   if( optInTimePeriod == 1 )
+   {
+      for( i=0; i < TA_MA_NB_TYPE; i++ )
+      {
+         if( !(maTypeMask & TA_MA_MASK(i)) )
+            continue;
+         outBegIdx[i]    = startIdx;
+         outNBElement[i] = endIdx-startIdx+1;
+         memcpy( outReal[i], &inReal[startIdx], sizeof(double)*outNBElement[i] );
+      }
+      return TA_SUCCESS;
+   }
+
+   state = (TA_FusedState *)TA_Malloc( sizeof(TA_FusedState) );
+   if( !state )
+      return TA_ALLOC_ERR;
+   memset( state, 0, sizeof(TA_FusedState) );
+
+   state->endIdx  = endIdx;
+   state->period  = optInTimePeriod;
+   state->inReal  = inReal;
+   state->outReal = outReal;
+
+   /* Move up the start index of each output if there is not
+    * enough initial data.
+    */
+   for( i=0; i < TA_MA_NB_TYPE; i++ )
+   {
+      if( !(maTypeMask & TA_MA_MASK(i)) )
+         continue;
+
+      lookbackTotal = TA_MA_Lookback( optInTimePeriod, (TA_MAType)i );
+      state->begIdx[i] = startIdx < lookbackTotal? lookbackTotal : startIdx;
+      if( state->begIdx[i] > endIdx )
+      {
+         /* Nothing to evaluate for this one. */
+         outBegIdx[i] = 0;
+         outNBElement[i] = 0;
+         continue;
+      }
+
+      outBegIdx[i]    = state->begIdx[i];
+      outNBElement[i] = endIdx-state->begIdx[i]+1;
+      state->fusedMask |= TA_MA_MASK(i);
+   }
+
+   /* MAMA has its own algorithm, and the compensated SMA
+    * another sequence of operations: both are calculated
+    * by their TA function.
+    */
+   if( state->fusedMask & TA_MA_MASK(TA_MAType_MAMA) )
+   {
+      state->fusedMask &= ~TA_MA_MASK(TA_MAType_MAMA);
+      ARRAY_ALLOC(dummyBuffer, (endIdx-startIdx+1) );
+      if( !dummyBuffer )
+      {
+         TA_Free( state );
+         return TA_ALLOC_ERR;
+      }
+      retCode = TA_MAMA( startIdx, endIdx, inReal, 0.5, 0.05,
+                         &outBegIdx[TA_MAType_MAMA], &outNBElement[TA_MAType_MAMA],
+                         outReal[TA_MAType_MAMA], dummyBuffer );
+      ARRAY_FREE( dummyBuffer );
+      if( retCode != TA_SUCCESS )
+      {
+         TA_Free( state );
+         return retCode;
+      }
+   }
+
+   if( (state->fusedMask & TA_MA_MASK(TA_MAType_SMA)) &&
+       (TA_GLOBALS_PRECISION != TA_PRECISION_DEFAULT) )
+   {
+      state->fusedMask &= ~TA_MA_MASK(TA_MAType_SMA);
+      retCode = TA_SMA( startIdx, endIdx, inReal, optInTimePeriod,
+                        &outBegIdx[TA_MAType_SMA], &outNBElement[TA_MAType_SMA],
+                        outReal[TA_MAType_SMA] );
+      if( retCode != TA_SUCCESS )
+      {
+         TA_Free( state );
+         return retCode;
+      }
+   }
+
+   /* Build the EMA stages, each stage is identified by its input
+    * and its first output, same as the calls to TA_INT_EMA done
+    * by TA_EMA, TA_DEMA and TA_TEMA.
+    */
+   state->k = PER_TO_K( optInTimePeriod );
+   lookbackEMA = TA_EMA_Lookback( optInTimePeriod );
+   firstIdx = endIdx+1;
+
+   if( state->fusedMask & TA_MA_MASK(TA_MAType_EMA) )
+      state->emaStage = addEMA( state, -1, state->begIdx[TA_MAType_EMA] );
+
+   if( state->fusedMask & TA_MA_MASK(TA_MAType_DEMA) )
+   {
+      state->demaStage[0] = addEMA( state, -1, state->begIdx[TA_MAType_DEMA]-lookbackEMA );
+      state->demaStage[1] = addEMA( state, state->demaStage[0], state->begIdx[TA_MAType_DEMA] );
+   }
+
+   if( state->fusedMask & TA_MA_MASK(TA_MAType_TEMA) )
+   {
+      state->temaStage[0] = addEMA( state, -1, state->begIdx[TA_MAType_TEMA]-(2*lookbackEMA) );
+      state->temaStage[1] = addEMA( state, state->temaStage[0], state->begIdx[TA_MAType_TEMA]-lookbackEMA );
+      state->temaStage[2] = addEMA( state, state->temaStage[1], state->begIdx[TA_MAType_TEMA] );
+   }
+
+   for( i=0; i < state->nbEMA; i++ )
+   {
+      if( state->ema[i].firstIdx < firstIdx )
+         firstIdx = state->ema[i].firstIdx;
+   }
+
+   /* SMA, WMA and TRIMA need the last period before their first output. */
+   for( i=0; i < 3; i++ )
+   {
+      j = i == 0? TA_MAType_SMA : (i == 1? TA_MAType_WMA : TA_MAType_TRIMA);
+      if( (state->fusedMask & TA_MA_MASK(j)) && (state->begIdx[j]-(optInTimePeriod-1) < firstIdx) )
+         firstIdx = state->begIdx[j]-(optInTimePeriod-1);
+   }
+
+   if( state->fusedMask & TA_MA_MASK(TA_MAType_TRIMA) )
+   {
+      i = optInTimePeriod>>1;
+      if( (optInTimePeriod % 2) == 1 )
+         tempReal = (i+1)*(i+1);
+      else
+         tempReal = i*(i+1);
+      state->trimaFactor = 1.0/tempReal;
+   }
+
+   if( state->fusedMask & TA_MA_MASK(TA_MAType_KAMA) )
+   {
+      /* The first KAMA is calculated on the bar after the first period. */
+      state->kamaFirstIdx = state->begIdx[TA_MAType_KAMA]-TA_KAMA_Lookback( optInTimePeriod )+optInTimePeriod;
+      if( state->kamaFirstIdx-optInTimePeriod < firstIdx )
+         firstIdx = state->kamaFirstIdx-optInTimePeriod;
+   }
+
+   if( state->fusedMask & TA_MA_MASK(TA_MAType_T3) )
+   {
+      state->t3FirstIdx = state->begIdx[TA_MAType_T3]-TA_T3_Lookback( optInTimePeriod, 0.7 );
+      if( state->t3FirstIdx < firstIdx )
+         firstIdx = state->t3FirstIdx;
+
+      vFactor  = 0.7;
+      tempReal = vFactor * vFactor;
+      state->t3Coef[0] = -(tempReal * vFactor);
+      state->t3Coef[1] = 3.0 * (tempReal - state->t3Coef[0]);
+      state->t3Coef[2] = -6.0 * tempReal - 3.0 * (vFactor-state->t3Coef[0]);
+      state->t3Coef[3] = 1.0 + 3.0 * vFactor - state->t3Coef[0] + 3.0 * tempReal;
+   }
+
+   /* The sweep: every average is advanced over a chunk of bars
+    * while the chunk is still in the cache.
+    */
+   if( state->fusedMask )
+   {
+      for( t0=firstIdx; t0 <= endIdx; t0 += FUSED_CHUNK )
+      {
+         t1 = t0+FUSED_CHUNK-1;
+         if( t1 > endIdx )
+            t1 = endIdx;
+
+         if( state->nbEMA )
+            calcEMA( state, t0, t1 );
+         if( state->fusedMask & TA_MA_MASK(TA_MAType_SMA) )
+            calcSMA( state, t0, t1 );
+         if( state->fusedMask & TA_MA_MASK(TA_MAType_WMA) )
+            calcWMA( state, t0, t1 );
+         if( state->fusedMask & TA_MA_MASK(TA_MAType_TRIMA) )
+            calcTRIMA( state, t0, t1 );
+         if( state->fusedMask & TA_MA_MASK(TA_MAType_KAMA) )
+            calcKAMA( state, t0, t1 );
+         if( state->fusedMask & TA_MA_MASK(TA_MAType_T3) )
+            calcT3( state, t0, t1 );
+      }
+   }
+
+   TA_Free( state );
+
+   return TA_SUCCESS;
+}
+
+/**** Local functions definitions.     ****/
+
+/* Return the stage calculating the EMA of 'parent' with
+ * this first output, creating it when needed.
+ */
+static int addEMA( TA_FusedState *state, int parent, int begIdx )
+{
+   TA_FusedEMA *ema;
+   int i, lookbackTotal;
+
+   for( i=0; i < state->nbEMA; i++ )
+   {
+      if( (state->ema[i].parent == parent) && (state->ema[i].begIdx == begIdx) )
+         return i;
+   }
+
+   ema = &state->ema[state->nbEMA];
+   ema->parent = parent;
+   ema->begIdx = begIdx;
+
+   if( TA_GLOBALS_COMPATIBILITY == TA_COMPATIBILITY_DEFAULT )
+   {
+      /* Seeded with the SMA of the first period. */
+      lookbackTotal = TA_EMA_Lookback( state->period );
+      ema->firstIdx = begIdx-lookbackTotal;
+      ema->seedIdx  = ema->firstIdx+state->period-1;
+   }
+   else
+   {
+      /* Seeded with the first value of the input. */
+      ema->firstIdx = parent < 0? 0 : state->ema[parent].begIdx;
+      ema->seedIdx  = ema->firstIdx;
+   }
+
+   return state->nbEMA++;
+}
+
+static void calcEMA( TA_FusedState *state, int t0, int t1 )
+{
+   TA_FusedEMA *ema;
+   const double *first, *second, *third;
+   double *outReal;
+   double tempReal, prevMA, k;
+   int i, t, begIdx, isDefault;
+
+   k = state->k;
+   isDefault = (TA_GLOBALS_COMPATIBILITY == TA_COMPATIBILITY_DEFAULT);
+
+   /* The parents are always before their child. */
+   for( i=0; i < state->nbEMA; i++ )
+   {
+      ema = &state->ema[i];
+      t = ema->firstIdx > t0? ema->firstIdx : t0;
+      prevMA = ema->prevMA;
+      for( ; t <= t1; t++ )
+      {
+         if( ema->parent < 0 )
+            tempReal = state->inReal[t];
+         else
+            tempReal = state->ema[ema->parent].value[t-t0];
+
+         if( t < ema->seedIdx )
+         {
+            ema->sum += tempReal;
+            continue;
+         }
+
+         if( t > ema->seedIdx )
+            prevMA = ((tempReal-prevMA)*k)+prevMA;
+         else if( isDefault )
+         {
+            ema->sum += tempReal;
+            prevMA = ema->sum / state->period;
+         }
+         else
+            prevMA = tempReal;
+
+         ema->value[t-t0] = prevMA;
+      }
+      ema->prevMA = prevMA;
+   }
+
+   if( state->fusedMask & TA_MA_MASK(TA_MAType_EMA) )
+   {
+      begIdx  = state->begIdx[TA_MAType_EMA];
+      outReal = state->outReal[TA_MAType_EMA];
+      first   = state->ema[state->emaStage].value;
+      for( t=begIdx > t0? begIdx : t0; t <= t1; t++ )
+         outReal[t-begIdx] = first[t-t0];
+   }
+
+   if( state->fusedMask & TA_MA_MASK(TA_MAType_DEMA) )
+   {
+      begIdx  = state->begIdx[TA_MAType_DEMA];
+      outReal = state->outReal[TA_MAType_DEMA];
+      first   = state->ema[state->demaStage[0]].value;
+      second  = state->ema[state->demaStage[1]].value;
+      for( t=begIdx > t0? begIdx : t0; t <= t1; t++ )
+         outReal[t-begIdx] = (2.0*first[t-t0]) - second[t-t0];
+   }
+
+   if( state->fusedMask & TA_MA_MASK(TA_MAType_TEMA) )
+   {
+      begIdx  = state->begIdx[TA_MAType_TEMA];
+      outReal = state->outReal[TA_MAType_TEMA];
+      first   = state->ema[state->temaStage[0]].value;
+      second  = state->ema[state->temaStage[1]].value;
+      third   = state->ema[state->temaStage[2]].value;
+      for( t=begIdx > t0? begIdx : t0; t <= t1; t++ )
+      {
+         outReal[t-begIdx]  = third[t-t0];
+         outReal[t-begIdx] += (3.0*first[t-t0]) - (3.0*second[t-t0]);
+      }
+   }
+}
+
+static void calcSMA( TA_FusedState *state, int t0, int t1 )
+{
+   const double *inReal = state->inReal;
+   double *outReal;
+   double periodTotal, tempReal;
+   int t, begIdx, lookbackTotal;
+
+   begIdx  = state->begIdx[TA_MAType_SMA];
+   outReal = state->outReal[TA_MAType_SMA];
+   lookbackTotal = state->period-1;
+   periodTotal = state->smaTotal;
+
+   t = begIdx-lookbackTotal;
+   if( t < t0 )
+      t = t0;
+   for( ; (t < begIdx) && (t <= t1); t++ )
+      periodTotal += inReal[t];
+   for( ; t <= t1; t++ )
+   {
+      periodTotal += inReal[t];
+      tempReal = periodTotal;
+      periodTotal -= inReal[t-lookbackTotal];
+      outReal[t-begIdx] = tempReal / state->period;
+   }
+
+   state->smaTotal = periodTotal;
+}
+
+static void calcWMA( TA_FusedState *state, int t0, int t1 )
+{
+   const double *inReal = state->inReal;
+   double *outReal;
+   double periodSum, periodSub, trailingValue, tempReal;
+   int t, begIdx, trailingIdx, lookbackTotal, divider;
+
+   begIdx  = state->begIdx[TA_MAType_WMA];
+   outReal = state->outReal[TA_MAType_WMA];
+   lookbackTotal = state->period-1;
+   trailingIdx = begIdx-lookbackTotal;
+   divider = (state->period*(state->period+1))>>1;
+
+   periodSum = state->wmaSum;
+   periodSub = state->wmaSub;
+   trailingValue = state->wmaTrailing;
+
+   t = trailingIdx > t0? trailingIdx : t0;
+   for( ; (t < begIdx) && (t <= t1); t++ )
+   {
+      tempReal = inReal[t];
+      periodSub += tempReal;
+      periodSum += tempReal*(t-trailingIdx+1);
+   }
+   for( ; t <= t1; t++ )
+   {
+      tempReal = inReal[t];
+      periodSub += tempReal;
+      periodSub -= trailingValue;
+      periodSum += tempReal*state->period;
+      trailingValue = inReal[t-lookbackTotal];
+      outReal[t-begIdx] = periodSum / divider;
+      periodSum -= periodSub;
+   }
+
+   state->wmaSum = periodSum;
+   state->wmaSub = periodSub;
+   state->wmaTrailing = trailingValue;
+}
+
+static void calcTRIMA( TA_FusedState *state, int t0, int t1 )
+{
+   const double *inReal = state->inReal;
+   double *outReal;
+   double numerator, numeratorSub, numeratorAdd, tempReal, factor;
+   int i, t, begIdx, half, isOdd, trailingIdx, middleIdx, lookbackTotal;
+
+   begIdx  = state->begIdx[TA_MAType_TRIMA];
+   if( t1 < begIdx )
+      return;
+
+   outReal = state->outReal[TA_MAType_TRIMA];
+   lookbackTotal = state->period-1;
+   half   = state->period>>1;
+   isOdd  = (state->period % 2) == 1;
+   factor = state->trimaFactor;
+
+   t = t0;
+   if( t <= begIdx )
+   {
+      /* First output: the two halves of the first window, the
+       * first one added backward.
+       */
+      trailingIdx = begIdx-lookbackTotal;
+      middleIdx   = isOdd? trailingIdx+half : trailingIdx+half-1;
+      numerator   = 0.0;
+      numeratorSub = 0.0;
+      for( i=middleIdx; i >= trailingIdx; i-- )
+      {
+         tempReal      = inReal[i];
+         numeratorSub += tempReal;
+         numerator    += numeratorSub;
+      }
+      numeratorAdd = 0.0;
+      for( i=middleIdx+1; i <= begIdx; i++ )
+      {
+         tempReal      = inReal[i];
+         numeratorAdd += tempReal;
+         numerator    += numeratorAdd;
+      }
+      outReal[0] = numerator * factor;
+      t = begIdx+1;
+   }
+   else
+   {
+      numerator    = state->trimaNumerator;
+      numeratorSub = state->trimaSub;
+      numeratorAdd = state->trimaAdd;
+   }
+
+   if( isOdd )
+   {
+      for( ; t <= t1; t++ )
+      {
+         numerator    -= numeratorSub;
+         numeratorSub -= inReal[t-1-lookbackTotal];
+         tempReal      = inReal[t-half];
+         numeratorSub += tempReal;
+         numerator    += numeratorAdd;
+         numeratorAdd -= tempReal;
+         tempReal      = inReal[t];
+         numeratorAdd += tempReal;
+         numerator    += tempReal;
+         outReal[t-begIdx] = numerator * factor;
+      }
+   }
+   else
+   {
+      for( ; t <= t1; t++ )
+      {
+         numerator    -= numeratorSub;
+         numeratorSub -= inReal[t-1-lookbackTotal];
+         tempReal      = inReal[t-half];
+         numeratorSub += tempReal;
+         numeratorAdd -= tempReal;
+         numerator    += numeratorAdd;
+         tempReal      = inReal[t];
+         numeratorAdd += tempReal;
+         numerator    += tempReal;
+         outReal[t-begIdx] = numerator * factor;
+      }
+   }
+
+   state->trimaNumerator = numerator;
+   state->trimaSub = numeratorSub;
+   state->trimaAdd = numeratorAdd;
+}
+
+static void calcKAMA( TA_FusedState *state, int t0, int t1 )
+{
+   const double constMax  = 2.0/(30.0+1.0);
+   const double constDiff = 2.0/(2.0+1.0) - constMax;
+   const double *inReal = state->inReal;
+   double *outReal;
+   double sumROC1, prevKAMA, trailingValue, periodROC, tempReal, tempReal2;
+   int i, t, begIdx, firstIdx, period;
+
+   firstIdx = state->kamaFirstIdx;
+   if( t1 < firstIdx )
+      return;
+
+   begIdx  = state->begIdx[TA_MAType_KAMA];
+   outReal = state->outReal[TA_MAType_KAMA];
+   period  = state->period;
+
+   t = t0;
+   if( t <= firstIdx )
+   {
+      /* Sum of the absolute changes of the first period. */
+      sumROC1 = 0.0;
+      for( i=firstIdx-period; i < firstIdx; i++ )
+      {
+         tempReal  = inReal[i];
+         tempReal -= inReal[i+1];
+         sumROC1  += std_fabs(tempReal);
+      }
+
+      prevKAMA  = inReal[firstIdx-1];
+      tempReal  = inReal[firstIdx];
+      tempReal2 = inReal[firstIdx-period];
+      periodROC = tempReal-tempReal2;
+      trailingValue = tempReal2;
+      if( (sumROC1 <= periodROC) || TA_IS_ZERO(sumROC1))
+         tempReal = 1.0;
+      else
+         tempReal = std_fabs(periodROC/sumROC1);
+      tempReal  = (tempReal*constDiff)+constMax;
+      tempReal *= tempReal;
+      prevKAMA = ((inReal[firstIdx]-prevKAMA)*tempReal) + prevKAMA;
+      if( firstIdx >= begIdx )
+         outReal[firstIdx-begIdx] = prevKAMA;
+      t = firstIdx+1;
+   }
+   else
+   {
+      sumROC1  = state->kamaSumROC1;
+      prevKAMA = state->kamaPrev;
+      trailingValue = state->kamaTrailing;
+   }
+
+   for( ; t <= t1; t++ )
+   {
+      tempReal  = inReal[t];
+      tempReal2 = inReal[t-period];
+      periodROC = tempReal-tempReal2;
+      sumROC1 -= std_fabs(trailingValue-tempReal2);
+      sumROC1 += std_fabs(tempReal-inReal[t-1]);
+      trailingValue = tempReal2;
+      if( (sumROC1 <= periodROC) || TA_IS_ZERO(sumROC1) )
+         tempReal = 1.0;
+      else
+         tempReal = std_fabs(periodROC/sumROC1);
+      tempReal  = (tempReal*constDiff)+constMax;
+      tempReal *= tempReal;
+      prevKAMA = ((inReal[t]-prevKAMA)*tempReal) + prevKAMA;
+      if( t >= begIdx )
+         outReal[t-begIdx] = prevKAMA;
+   }
+
+   state->kamaSumROC1  = sumROC1;
+   state->kamaPrev     = prevKAMA;
+   state->kamaTrailing = trailingValue;
+}
+
+/* The 6 EMA of T3 are seeded one after the other: the first with the
+ * SMA of the first period, each following one with the SMA of the
+ * previous EMA over the next period-1 bars (t3Phase is the number of
+ * EMA seeded).
+ */
+static void calcT3( TA_FusedState *state, int t0, int t1 )
+{
+   const double *inReal = state->inReal;
+   double *e = state->t3Ema;
+   const double *c = state->t3Coef;
+   double *outReal;
+   double k, one_minus_k;
+   int j, t, begIdx, period;
+
+   begIdx  = state->begIdx[TA_MAType_T3];
+   outReal = state->outReal[TA_MAType_T3];
+   period  = state->period;
+   k = 2.0/(period+1.0);
+   one_minus_k = 1.0-k;
+
+   t = state->t3FirstIdx > t0? state->t3FirstIdx : t0;
+   for( ; (t <= t1) && (state->t3Phase < 6); t++ )
+   {
+      if( state->t3Phase == 0 )
+      {
+         if( t == state->t3FirstIdx )
+            state->t3Sum = inReal[t];
+         else
+            state->t3Sum += inReal[t];
+         if( ++state->t3Count < period )
+            continue;
+      }
+      else
+      {
+         e[0] = (k*inReal[t])+(one_minus_k*e[0]);
+         for( j=1; j < state->t3Phase; j++ )
+            e[j] = (k*e[j-1])+(one_minus_k*e[j]);
+         state->t3Sum += e[state->t3Phase-1];
+         if( ++state->t3Count < period-1 )
+            continue;
+      }
+
+      e[state->t3Phase] = state->t3Sum / period;
+      state->t3Sum = e[state->t3Phase];
+      state->t3Phase++;
+      state->t3Count = 0;
+
+      if( (state->t3Phase == 6) && (t >= begIdx) )
+         outReal[t-begIdx] = c[0]*e[5]+c[1]*e[4]+c[2]*e[3]+c[3]*e[2];
+   }
+
+   for( ; t <= t1; t++ )
+   {
+      e[0] = (k*inReal[t])+(one_minus_k*e[0]);
+      e[1] = (k*e[0])+(one_minus_k*e[1]);
+      e[2] = (k*e[1])+(one_minus_k*e[2]);
+      e[3] = (k*e[2])+(one_minus_k*e[3]);
+      e[4] = (k*e[3])+(one_minus_k*e[4]);
+      e[5] = (k*e[4])+(one_minus_k*e[5]);
+      if( t >= begIdx )
+         outReal[t-begIdx] = c[0]*e[5]+c[1]*e[4]+c[2]*e[3]+c[3]*e[2];
+   }
+}
@@ -0,0 +1,385 @@
+/* Description:
+ *   Rolling correlation/covariance matrix and beta vector of a
+ *   universe of series (see ta_matrix.h).
+ *
+ *   The sums of each pair are updated with the same sequence of
+ *   operations than TA_CORREL, so the correlations are identical.
+ */
+
+/**** Headers ****/
+#include <string.h>
+#include <math.h>
+#include "ta_func.h"
+#include "ta_matrix.h"
+
+#include "ta_utility.h"
+#include "ta_memory.h"
+
+/**** Local declarations.              ****/
+
+/* Nb of bars copied at once in the tile buffers. */
+#define MATRIX_CHUNK 16
+
+typedef struct
+{
+   int    startIdx;     /* Already moved up by the lookback. */
+   int    endIdx;
+   int    trailingIdx;  /* First bar of the first window. */
+   int    nbSeries;
+   int    period;
+   const double *const *inReal;
+   double *outCorrel;
+   double *outCovar;
+} TA_MatrixParam;
+
+typedef struct
+{
+   double sumXY[TA_MATRIX_TILE*TA_MATRIX_TILE];
+   double sumX[TA_MATRIX_TILE];
+   double sumX2[TA_MATRIX_TILE];
+   double sumY[TA_MATRIX_TILE];
+   double sumY2[TA_MATRIX_TILE];
+
+   /* [bar-t0][series-i0], new and trailing values of the chunk. */
+   double x[MATRIX_CHUNK][TA_MATRIX_TILE];
+   double y[MATRIX_CHUNK][TA_MATRIX_TILE];
+   double trailingX[MATRIX_CHUNK][TA_MATRIX_TILE];
+   double trailingY[MATRIX_CHUNK][TA_MATRIX_TILE];
+} TA_MatrixTile;
+
+/**** Local functions declarations.    ****/
+static void calcTile( const TA_MatrixParam *param, int blockRow, int blockCol );
+static void loadChunk( const TA_MatrixParam *param, int first, int nbSeries,
+                       int t0, int nbBar, double chunk[][TA_MATRIX_TILE],
+                       int isTrailing );
+
+/**** Global functions definitions.   ****/
+TA_RetCode TA_CorrelMatrix( int    startIdx,
+                            int    endIdx,
+                            int    nbSeries,
+                            const double *const inReal[],
+                            int    optInTimePeriod,
+                            int    nbThread,
+                            int   *outBegIdx,
+                            int   *outNBElement,
+                            double outCorrel[],
+                            double outCovar[] )
+{
+   TA_MatrixParam param;
+   int i, lookbackTotal, nbBlock, nbTile, tile, blockRow, blockCol;
+
+#ifndef TA_FUNC_NO_RANGE_CHECK
+
+   /* Validate the requested output range. */
+   if( startIdx < 0 )
+      return TA_OUT_OF_RANGE_START_INDEX;
+   if( (endIdx < 0) || (endIdx < startIdx))
+      return TA_OUT_OF_RANGE_END_INDEX;
+
+   if( (nbSeries < 1) || !inReal )
+      return TA_BAD_PARAM;
+   for( i=0; i < nbSeries; i++ )
+      if( !inReal[i] ) return TA_BAD_PARAM;
+
+   /* min/max are checked for optInTimePeriod. */
+   if( (int)optInTimePeriod == TA_INTEGER_DEFAULT )
+      optInTimePeriod = 30;
+   else if( ((int)optInTimePeriod < 1) || ((int)optInTimePeriod > 100000) )
+      return TA_BAD_PARAM;
+
+   if( !outCorrel && !outCovar )
+      return TA_BAD_PARAM;
+
+#endif /* TA_FUNC_NO_RANGE_CHECK */
+
+   /* Move up the start index if there is not
+    * enough initial data.
+    */
+   lookbackTotal = optInTimePeriod-1;
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   /* Make sure there is still something to evaluate. */
+   if( startIdx > endIdx )
+   {
+      *outBegIdx = 0;
+      *outNBElement = 0;
+      return TA_SUCCESS;
+   }
+
+   param.startIdx    = startIdx;
+   param.endIdx      = endIdx;
+   param.trailingIdx = startIdx-lookbackTotal;
+   param.nbSeries    = nbSeries;
+   param.period      = optInTimePeriod;
+   param.inReal      = inReal;
+   param.outCorrel   = outCorrel;
+   param.outCovar    = outCovar;
+
+   /* Only the tiles on and above the diagonal are calculated,
+    * the other half of the matrix is written by symmetry.
+    */
+   nbBlock = (nbSeries+TA_MATRIX_TILE-1)/TA_MATRIX_TILE;
+   nbTile  = nbBlock*(nbBlock+1)/2;
+
+#ifdef _OPENMP
+   #pragma omp parallel for num_threads(nbThread > 1? nbThread : 1) private(blockRow,blockCol) schedule(dynamic)
+#else
+   (void)nbThread;
+#endif
+   for( tile=0; tile < nbTile; tile++ )
+   {
+      /* Find the tile (blockRow,blockCol) with blockRow <= blockCol. */
+      blockRow = 0;
+      blockCol = tile;
+      while( blockCol >= nbBlock-blockRow )
+      {
+         blockCol -= nbBlock-blockRow;
+         blockRow++;
+      }
+      calcTile( &param, blockRow, blockRow+blockCol );
+   }
+
+   *outBegIdx    = startIdx;
+   *outNBElement = endIdx-startIdx+1;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_BetaVector( int    startIdx,
+                          int    endIdx,
+                          int    nbSeries,
+                          const double *const inReal[],
+                          const double inBenchmark[],
+                          int    optInTimePeriod,
+                          int    nbThread,
+                          int   *outBegIdx,
+                          int   *outNBElement,
+                          double outBeta[] )
+{
+   TA_RetCode retCode;
+   int i, lookbackTotal, nbOut;
+
+#ifndef TA_FUNC_NO_RANGE_CHECK
+
+   /* Validate the requested output range. */
+   if( startIdx < 0 )
+      return TA_OUT_OF_RANGE_START_INDEX;
+   if( (endIdx < 0) || (endIdx < startIdx))
+      return TA_OUT_OF_RANGE_END_INDEX;
+
+   if( (nbSeries < 1) || !inReal || !inBenchmark )
+      return TA_BAD_PARAM;
+   for( i=0; i < nbSeries; i++ )
+      if( !inReal[i] ) return TA_BAD_PARAM;
+
+   /* min/max are checked for optInTimePeriod. */
+   if( (int)optInTimePeriod == TA_INTEGER_DEFAULT )
+      optInTimePeriod = 5;
+   else if( ((int)optInTimePeriod < 1) || ((int)optInTimePeriod > 100000) )
+      return TA_BAD_PARAM;
+
+   if( !outBeta )
+      return TA_BAD_PARAM;
+
+#endif /* TA_FUNC_NO_RANGE_CHECK */
+
+   lookbackTotal = TA_BETA_Lookback( optInTimePeriod );
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   if( startIdx > endIdx )
+   {
+      *outBegIdx = 0;
+      *outNBElement = 0;
+      return TA_SUCCESS;
+   }
+   nbOut = endIdx-startIdx+1;
+
+   /* Each series is independent. The beta is calculated by
+    * TA_BETA in a temporary buffer, then interleaved in the
+    * output (one row per bar).
+    */
+   retCode = TA_SUCCESS;
+
+#ifdef _OPENMP
+   #pragma omp parallel for num_threads(nbThread > 1? nbThread : 1) schedule(dynamic)
+#else
+   (void)nbThread;
+#endif
+   for( i=0; i < nbSeries; i++ )
+   {
+      ARRAY_REF(tempBuffer);
+      TA_RetCode seriesRetCode;
+      int j, begIdx, nbElement;
+
+      ARRAY_ALLOC( tempBuffer, nbOut );
+      if( !tempBuffer )
+         seriesRetCode = TA_ALLOC_ERR;
+      else
+      {
+         seriesRetCode = TA_BETA( startIdx, endIdx, inBenchmark, inReal[i],
+                                  optInTimePeriod, &begIdx, &nbElement, tempBuffer );
+         if( (seriesRetCode == TA_SUCCESS) && ((begIdx != startIdx) || (nbElement != nbOut)) )
+            seriesRetCode = TA_INTERNAL_ERROR(180);
+         if( seriesRetCode == TA_SUCCESS )
+         {
+            for( j=0; j < nbOut; j++ )
+               outBeta[(size_t)j*nbSeries+i] = tempBuffer[j];
+         }
+         ARRAY_FREE( tempBuffer );
+      }
+
+      if( seriesRetCode != TA_SUCCESS )
+      {
+#ifdef _OPENMP
+         #pragma omp critical
+#endif
+         retCode = seriesRetCode;
+      }
+   }
+
+   if( retCode != TA_SUCCESS )
+   {
+      *outBegIdx = 0;
+      *outNBElement = 0;
+      return retCode;
+   }
+
+   *outBegIdx    = startIdx;
+   *outNBElement = nbOut;
+
+   return TA_SUCCESS;
+}
+
+/**** Local functions definitions.     ****/
+
+/* Calculate all the pairs of the series [blockRow*TILE..] x
+ * [blockCol*TILE..] for all the bars. Only (i,j) with i <= j
+ * is calculated in a tile on the diagonal.
+ */
+static void calcTile( const TA_MatrixParam *param, int blockRow, int blockCol )
+{
+   TA_MatrixTile tile;
+   const int n = param->nbSeries;
+   const int firstRow = blockRow*TA_MATRIX_TILE;
+   const int firstCol = blockCol*TA_MATRIX_TILE;
+   const int nbRow = min( TA_MATRIX_TILE, n-firstRow );
+   const int nbCol = min( TA_MATRIX_TILE, n-firstCol );
+   int a, b, t, t0, nbBar, today, i, j, jStart;
+   double *sumXY, x, tempReal, numerator;
+   size_t outRow;
+
+   memset( tile.sumXY, 0, sizeof(tile.sumXY) );
+   memset( tile.sumX,  0, sizeof(tile.sumX) );
+   memset( tile.sumX2, 0, sizeof(tile.sumX2) );
+   memset( tile.sumY,  0, sizeof(tile.sumY) );
+   memset( tile.sumY2, 0, sizeof(tile.sumY2) );
+
+   for( t0=param->trailingIdx; t0 <= param->endIdx; t0 += MATRIX_CHUNK )
+   {
+      nbBar = min( MATRIX_CHUNK, param->endIdx-t0+1 );
+      loadChunk( param, firstRow, nbRow, t0, nbBar, tile.x, 0 );
+      loadChunk( param, firstCol, nbCol, t0, nbBar, tile.y, 0 );
+      loadChunk( param, firstRow, nbRow, t0, nbBar, tile.trailingX, 1 );
+      loadChunk( param, firstCol, nbCol, t0, nbBar, tile.trailingY, 1 );
+
+      for( t=0; t < nbBar; t++ )
+      {
+         today = t0+t;
+
+         /* Remove trailing values, once the first window is complete. */
+         if( today > param->startIdx )
+         {
+            for( a=0; a < nbRow; a++ )
+            {
+               x = tile.trailingX[t][a];
+               tile.sumX[a]  -= x;
+               tile.sumX2[a] -= x*x;
+               sumXY = &tile.sumXY[a*TA_MATRIX_TILE];
+               for( b=0; b < nbCol; b++ )
+                  sumXY[b] -= x*tile.trailingY[t][b];
+            }
+            for( b=0; b < nbCol; b++ )
+            {
+               x = tile.trailingY[t][b];
+               tile.sumY[b]  -= x;
+               tile.sumY2[b] -= x*x;
+            }
+         }
+
+         /* Add new values */
+         for( a=0; a < nbRow; a++ )
+         {
+            x = tile.x[t][a];
+            tile.sumX[a]  += x;
+            tile.sumX2[a] += x*x;
+            sumXY = &tile.sumXY[a*TA_MATRIX_TILE];
+            for( b=0; b < nbCol; b++ )
+               sumXY[b] += x*tile.y[t][b];
+         }
+         for( b=0; b < nbCol; b++ )
+         {
+            x = tile.y[t][b];
+            tile.sumY[b]  += x;
+            tile.sumY2[b] += x*x;
+         }
+
+         if( today < param->startIdx )
+            continue;
+
+         /* Output, with the same expressions than TA_CORREL. */
+         outRow = (size_t)(today-param->startIdx)*n;
+         for( a=0; a < nbRow; a++ )
+         {
+            i = firstRow+a;
+            jStart = (blockRow == blockCol)? a : 0;
+            for( b=jStart; b < nbCol; b++ )
+            {
+               j = firstCol+b;
+               numerator = tile.sumXY[a*TA_MATRIX_TILE+b]-((tile.sumX[a]*tile.sumY[b])/param->period);
+               if( param->outCorrel )
+               {
+                  tempReal = (tile.sumX2[a]-((tile.sumX[a]*tile.sumX[a])/param->period)) *
+                             (tile.sumY2[b]-((tile.sumY[b]*tile.sumY[b])/param->period));
+                  if( !TA_IS_ZERO_OR_NEG(tempReal) )
+                     tempReal = numerator / std_sqrt(tempReal);
+                  else
+                     tempReal = 0.0;
+                  param->outCorrel[(outRow+i)*n+j] = tempReal;
+                  param->outCorrel[(outRow+j)*n+i] = tempReal;
+               }
+               if( param->outCovar )
+               {
+                  tempReal = numerator/param->period;
+                  param->outCovar[(outRow+i)*n+j] = tempReal;
+                  param->outCovar[(outRow+j)*n+i] = tempReal;
+               }
+            }
+         }
+      }
+   }
+}
+
+/* Copy nbBar bars of the series [first,first+nbSeries[ starting at
+ * t0 (or at t0-period for the trailing values) in chunk[bar][series].
+ * The trailing values before the first window are not needed.
+ */
+static void loadChunk( const TA_MatrixParam *param, int first, int nbSeries,
+                       int t0, int nbBar, double chunk[][TA_MATRIX_TILE],
+                       int isTrailing )
+{
+   const double *in;
+   int s, t, offset;
+
+   offset = isTrailing? param->period : 0;
+   for( s=0; s < nbSeries; s++ )
+   {
+      in = param->inReal[first+s];
+      for( t=0; t < nbBar; t++ )
+      {
+         if( t0+t-offset >= param->trailingIdx )
+            chunk[t][s] = in[t0+t-offset];
+      }
+   }
+}
@@ -0,0 +1,222 @@
+/* Description:
+ *   Moving averages and variance with a validity bitmap (see
+ *   ta_missing.h).
+ *
+ *   The parameters are checked like the functions without bitmap,
+ *   then the kernels handling the missing bars (TA_INT_SMA_Missing...)
+ *   are called with the bitmaps and the current policy. TA_SMA and
+ *   the others call the same kernels with no bitmap, the missing bars
+ *   being then the NaN.
+ */
+
+/**** Headers ****/
+#include <string.h>
+#include <math.h>
+#include "ta_func.h"
+#include "ta_missing.h"
+
+#include "ta_utility.h"
+#include "ta_memory.h"
+
+/**** Global functions definitions.   ****/
+TA_RetCode TA_MaskedSMA( int    startIdx,
+                         int    endIdx,
+                         const double inReal[],
+                         const unsigned char inValid[],
+                         int           optInTimePeriod,
+                         int          *outBegIdx,
+                         int          *outNBElement,
+                         double        outReal[],
+                         unsigned char outValid[] )
+{
+#ifndef TA_FUNC_NO_RANGE_CHECK
+
+   /* Validate the requested output range. */
+   if( startIdx < 0 )
+      return TA_OUT_OF_RANGE_START_INDEX;
+   if( (endIdx < 0) || (endIdx < startIdx))
+      return TA_OUT_OF_RANGE_END_INDEX;
+
+   if( !inReal || !inValid ) return TA_BAD_PARAM;
+   /* min/max are checked for optInTimePeriod. */
+   if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+      return TA_BAD_PARAM;
+
+   if( !outBegIdx || !outNBElement || !outReal )
+      return TA_BAD_PARAM;
+
+#endif /* TA_FUNC_NO_RANGE_CHECK */
+
+   return TA_INT_SMA_Missing( startIdx, endIdx, inReal, inValid, TA_GLOBALS_MISSING,
+                              optInTimePeriod, outBegIdx, outNBElement, outReal, outValid );
+}
+
+TA_RetCode TA_MaskedEMA( int    startIdx,
+                         int    endIdx,
+                         const double inReal[],
+                         const unsigned char inValid[],
+                         int           optInTimePeriod,
+                         int          *outBegIdx,
+                         int          *outNBElement,
+                         double        outReal[],
+                         unsigned char outValid[] )
+{
+#ifndef TA_FUNC_NO_RANGE_CHECK
+
+   /* Validate the requested output range. */
+   if( startIdx < 0 )
+      return TA_OUT_OF_RANGE_START_INDEX;
+   if( (endIdx < 0) || (endIdx < startIdx))
+      return TA_OUT_OF_RANGE_END_INDEX;
+
+   if( !inReal || !inValid ) return TA_BAD_PARAM;
+   /* min/max are checked for optInTimePeriod. */
+   if( (int)optInTimePeriod == TA_INTEGER_DEFAULT )
+      optInTimePeriod = 30;
+   else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+      return TA_BAD_PARAM;
+
+   if( !outBegIdx || !outNBElement || !outReal )
+      return TA_BAD_PARAM;
+
+#endif /* TA_FUNC_NO_RANGE_CHECK */
+
+   return TA_INT_EMA_Missing( startIdx, endIdx, inReal, inValid, TA_GLOBALS_MISSING,
+                              optInTimePeriod, PER_TO_K( optInTimePeriod ),
+                              outBegIdx, outNBElement, outReal, outValid );
+}
+
+TA_RetCode TA_MaskedWMA( int    startIdx,
+                         int    endIdx,
+                         const double inReal[],
+                         const unsigned char inValid[],
+                         int           optInTimePeriod,
+                         int          *outBegIdx,
+                         int          *outNBElement,
+                         double        outReal[],
+                         unsigned char outValid[] )
+{
+#ifndef TA_FUNC_NO_RANGE_CHECK
+
+   /* Validate the requested output range. */
+   if( startIdx < 0 )
+      return TA_OUT_OF_RANGE_START_INDEX;
+   if( (endIdx < 0) || (endIdx < startIdx))
+      return TA_OUT_OF_RANGE_END_INDEX;
+
+   if( !inReal || !inValid ) return TA_BAD_PARAM;
+   /* min/max are checked for optInTimePeriod. */
+   if( (int)optInTimePeriod == TA_INTEGER_DEFAULT )
+      optInTimePeriod = 30;
+   else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+      return TA_BAD_PARAM;
+
+   if( !outBegIdx || !outNBElement || !outReal )
+      return TA_BAD_PARAM;
+
+#endif /* TA_FUNC_NO_RANGE_CHECK */
+
+   return TA_INT_WMA_Missing( startIdx, endIdx, inReal, inValid, TA_GLOBALS_MISSING,
+                              optInTimePeriod, outBegIdx, outNBElement, outReal, outValid );
+}
+
+TA_RetCode TA_MaskedVAR( int    startIdx,
+                         int    endIdx,
+                         const double inReal[],
+                         const unsigned char inValid[],
+                         int           optInTimePeriod,
+                         double        optInNbDev,
+                         int          *outBegIdx,
+                         int          *outNBElement,
+                         double        outReal[],
+                         unsigned char outValid[] )
+{
+#ifndef TA_FUNC_NO_RANGE_CHECK
+
+   /* Validate the requested output range. */
+   if( startIdx < 0 )
+      return TA_OUT_OF_RANGE_START_INDEX;
+   if( (endIdx < 0) || (endIdx < startIdx))
+      return TA_OUT_OF_RANGE_END_INDEX;
+
+   if( !inReal || !inValid ) return TA_BAD_PARAM;
+   /* min/max are checked for optInTimePeriod. */
+   if( (int)optInTimePeriod == TA_INTEGER_DEFAULT )
+      optInTimePeriod = 5;
+   else if( ((int)optInTimePeriod < 1) || ((int)optInTimePeriod > 100000) )
+      return TA_BAD_PARAM;
+
+   if( optInNbDev == TA_REAL_DEFAULT )
+      optInNbDev = 1.000000e+0;
+   else if( (optInNbDev < -3.000000e+37) || (optInNbDev > 3.000000e+37) )
+      return TA_BAD_PARAM;
+
+   if( !outBegIdx || !outNBElement || !outReal )
+      return TA_BAD_PARAM;
+
+#endif /* TA_FUNC_NO_RANGE_CHECK */
+
+   /* Like TA_VAR, optInNbDev is not used. */
+   (void)optInNbDev;
+
+   return TA_INT_VAR_Missing( startIdx, endIdx, inReal, inValid, TA_GLOBALS_MISSING,
+                              optInTimePeriod, outBegIdx, outNBElement, outReal, outValid );
+}
+
+TA_RetCode TA_MaskedSTDDEV( int    startIdx,
+                            int    endIdx,
+                            const double inReal[],
+                            const unsigned char inValid[],
+                            int           optInTimePeriod,
+                            double        optInNbDev,
+                            int          *outBegIdx,
+                            int          *outNBElement,
+                            double        outReal[],
+                            unsigned char outValid[] )
+{
+   TA_RetCode retCode;
+   double tempReal;
+   int i;
+
+#ifndef TA_FUNC_NO_RANGE_CHECK
+
+   /* Validate the requested output range. */
+   if( startIdx < 0 )
+      return TA_OUT_OF_RANGE_START_INDEX;
+   if( (endIdx < 0) || (endIdx < startIdx))
+      return TA_OUT_OF_RANGE_END_INDEX;
+
+   if( !inReal || !inValid ) return TA_BAD_PARAM;
+   /* min/max are checked for optInTimePeriod. */
+   if( (int)optInTimePeriod == TA_INTEGER_DEFAULT )
+      optInTimePeriod = 5;
+   else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+      return TA_BAD_PARAM;
+
+   if( optInNbDev == TA_REAL_DEFAULT )
+      optInNbDev = 1.000000e+0;
+   else if( (optInNbDev < -3.000000e+37) || (optInNbDev > 3.000000e+37) )
+      return TA_BAD_PARAM;
+
+   if( !outBegIdx || !outNBElement || !outReal )
+      return TA_BAD_PARAM;
+
+#endif /* TA_FUNC_NO_RANGE_CHECK */
+
+   retCode = TA_INT_VAR_Missing( startIdx, endIdx, inReal, inValid, TA_GLOBALS_MISSING,
+                                 optInTimePeriod, outBegIdx, outNBElement, outReal, outValid );
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   /* Same as TA_STDDEV, the NaN of the outputs not valid stay NaN. */
+   for( i=0; i < *outNBElement; i++ )
+   {
+      tempReal = outReal[i];
+      if( !TA_IS_ZERO_OR_NEG(tempReal) )
+         outReal[i] = (optInNbDev != 1.0)? std_sqrt(tempReal) * optInNbDev : std_sqrt(tempReal);
+      else
+         outReal[i] = (double)0.0;
+   }
+
+   return TA_SUCCESS;
+}
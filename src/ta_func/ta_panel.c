@@ -0,0 +1,1071 @@
+/* Description:
+ *   EMA, RSI, ATR, KAMA and T3 of a panel of symbols, up to PANEL_WIDTH
+ *   symbols at a time (see ta_panel.h).
+ *
+ *   Each kernel is the code of the function with every variable
+ *   replaced by an array of 'width' values (the lanes), and every
+ *   statement by a loop on the lanes. All the lanes share the same
+ *   range and parameters, so the control flow is the same for all of
+ *   them; the conditions on the values are written as selections
+ *   ( cond? a : b ) which give the same values as the branches.
+ *
+ *   A selection is done in its own loop on the lanes, on values already
+ *   calculated: otherwise the compiler moves the operations used by
+ *   only one side under the condition, and does not vectorize a loop
+ *   with a floating-point operation that is not always done.
+ *
+ *   The outputs of a bar are stored by a separate loop, after all the
+ *   inputs of the bar are read: the output can be the input, and the
+ *   loops on the lanes have no store that could alias a load.
+ */
+
+/**** Headers ****/
+#include <string.h>
+#include <math.h>
+#include "ta_func.h"
+#include "ta_panel.h"
+
+#include "ta_utility.h"
+#include "ta_memory.h"
+
+/**** Local declarations.              ****/
+
+/* Symbols advanced together by a kernel, a multiple of TA_PANEL_LANES.
+ * Their state (a few arrays of PANEL_WIDTH values) stays in the L1
+ * cache, and the values of a bar are read in long contiguous runs.
+ */
+#define PANEL_WIDTH (16*TA_PANEL_LANES)
+
+/* One block of 'width' symbols. The values of the lane l for the bar
+ * t are in[t*stride+l], the outputs out[outIdx*stride+l].
+ */
+typedef struct
+{
+   int    startIdx;      /* Already moved up by the lookback. */
+   int    endIdx;
+   int    lookbackTotal;
+   int    period;
+   double vFactor;
+   int    width;         /* Multiple of TA_PANEL_LANES, at most PANEL_WIDTH. */
+   size_t stride;
+   const double *in[3];  /* inReal, or inHigh/inLow/inClose. */
+   double *out;
+} TA_PanelBlock;
+
+/* Same as TA_IS_ZERO with a single comparison, so the compiler can
+ * select the result without a branch.
+ */
+#define PANEL_IS_ZERO(v) (std_fabs(v)<0.00000001)
+
+/* Loop on the lanes 0 to width-1 of a kernel, TA_PANEL_LANES at a
+ * time: the inner loops have a constant count and are vectorized.
+ */
+#define PANEL_FOR_LANES(l) \
+   for( b=0; b < width; b += TA_PANEL_LANES ) \
+      for( l=b; l < b+TA_PANEL_LANES; l++ )
+
+typedef void (*TA_PanelKernel)( const TA_PanelBlock *block );
+
+/**** Local functions declarations.    ****/
+static TA_RetCode runPanel( TA_PanelBlock *block, int nbSymbols, int nbInput,
+                            TA_PanelKernel kernel, int *outBegIdx, int *outNBElement );
+static void emaBlock( const TA_PanelBlock *block );
+static void rsiBlock( const TA_PanelBlock *block );
+static void atrBlock( const TA_PanelBlock *block );
+static void kamaBlock( const TA_PanelBlock *block );
+static void t3Block( const TA_PanelBlock *block );
+static void trueRange( const TA_PanelBlock *block, int today, double tr[] );
+
+/**** Global functions definitions.   ****/
+TA_RetCode TA_PanelEMA( int    startIdx,
+                        int    endIdx,
+                        int    nbSymbols,
+                        const double inReal[],
+                        int    optInTimePeriod,
+                        int   *outBegIdx,
+                        int   *outNBElement,
+                        double outReal[] )
+{
+   TA_PanelBlock block;
+
+#ifndef TA_FUNC_NO_RANGE_CHECK
+
+   /* Validate the requested output range. */
+   if( startIdx < 0 )
+      return TA_OUT_OF_RANGE_START_INDEX;
+   if( (endIdx < 0) || (endIdx < startIdx))
+      return TA_OUT_OF_RANGE_END_INDEX;
+
+   if( (nbSymbols < 1) || !inReal ) return TA_BAD_PARAM;
+   /* min/max are checked for optInTimePeriod. */
+   if( (int)optInTimePeriod == TA_INTEGER_DEFAULT )
+      optInTimePeriod = 30;
+   else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+      return TA_BAD_PARAM;
+
+   if( !outBegIdx || !outNBElement || !outReal )
+      return TA_BAD_PARAM;
+
+#endif /* TA_FUNC_NO_RANGE_CHECK */
+
+   block.startIdx      = startIdx;
+   block.endIdx        = endIdx;
+   block.lookbackTotal = TA_INT_EMA_LOOKBACK( optInTimePeriod );
+   block.period        = optInTimePeriod;
+   block.in[0]         = inReal;
+   block.out           = outReal;
+
+   return runPanel( &block, nbSymbols, 1, emaBlock, outBegIdx, outNBElement );
+}
+
+TA_RetCode TA_PanelRSI( int    startIdx,
+                        int    endIdx,
+                        int    nbSymbols,
+                        const double inReal[],
+                        int    optInTimePeriod,
+                        int   *outBegIdx,
+                        int   *outNBElement,
+                        double outReal[] )
+{
+   TA_PanelBlock block;
+
+#ifndef TA_FUNC_NO_RANGE_CHECK
+
+   /* Validate the requested output range. */
+   if( startIdx < 0 )
+      return TA_OUT_OF_RANGE_START_INDEX;
+   if( (endIdx < 0) || (endIdx < startIdx))
+      return TA_OUT_OF_RANGE_END_INDEX;
+
+   if( (nbSymbols < 1) || !inReal ) return TA_BAD_PARAM;
+   /* min/max are checked for optInTimePeriod. */
+   if( (int)optInTimePeriod == TA_INTEGER_DEFAULT )
+      optInTimePeriod = 14;
+   else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+      return TA_BAD_PARAM;
+
+   if( !outBegIdx || !outNBElement || !outReal )
+      return TA_BAD_PARAM;
+
+#endif /* TA_FUNC_NO_RANGE_CHECK */
+
+   block.startIdx      = startIdx;
+   block.endIdx        = endIdx;
+   block.lookbackTotal = TA_RSI_Lookback( optInTimePeriod );
+   block.period        = optInTimePeriod;
+   block.in[0]         = inReal;
+   block.out           = outReal;
+
+   return runPanel( &block, nbSymbols, 1, rsiBlock, outBegIdx, outNBElement );
+}
+
+TA_RetCode TA_PanelATR( int    startIdx,
+                        int    endIdx,
+                        int    nbSymbols,
+                        const double inHigh[],
+                        const double inLow[],
+                        const double inClose[],
+                        int    optInTimePeriod,
+                        int   *outBegIdx,
+                        int   *outNBElement,
+                        double outReal[] )
+{
+   TA_PanelBlock block;
+
+#ifndef TA_FUNC_NO_RANGE_CHECK
+
+   /* Validate the requested output range. */
+   if( startIdx < 0 )
+      return TA_OUT_OF_RANGE_START_INDEX;
+   if( (endIdx < 0) || (endIdx < startIdx))
+      return TA_OUT_OF_RANGE_END_INDEX;
+
+   /* Verify required price component. */
+   if( (nbSymbols < 1) || !inHigh || !inLow || !inClose )
+      return TA_BAD_PARAM;
+
+   /* min/max are checked for optInTimePeriod. */
+   if( (int)optInTimePeriod == TA_INTEGER_DEFAULT )
+      optInTimePeriod = 14;
+   else if( ((int)optInTimePeriod < 1) || ((int)optInTimePeriod > 100000) )
+      return TA_BAD_PARAM;
+
+   if( !outBegIdx || !outNBElement || !outReal )
+      return TA_BAD_PARAM;
+
+#endif /* TA_FUNC_NO_RANGE_CHECK */
+
+   block.startIdx      = startIdx;
+   block.endIdx        = endIdx;
+   block.lookbackTotal = TA_ATR_Lookback( optInTimePeriod );
+   block.period        = optInTimePeriod;
+   block.in[0]         = inHigh;
+   block.in[1]         = inLow;
+   block.in[2]         = inClose;
+   block.out           = outReal;
+
+   return runPanel( &block, nbSymbols, 3, atrBlock, outBegIdx, outNBElement );
+}
+
+TA_RetCode TA_PanelKAMA( int    startIdx,
+                         int    endIdx,
+                         int    nbSymbols,
+                         const double inReal[],
+                         int    optInTimePeriod,
+                         int   *outBegIdx,
+                         int   *outNBElement,
+                         double outReal[] )
+{
+   TA_PanelBlock block;
+
+#ifndef TA_FUNC_NO_RANGE_CHECK
+
+   /* Validate the requested output range. */
+   if( startIdx < 0 )
+      return TA_OUT_OF_RANGE_START_INDEX;
+   if( (endIdx < 0) || (endIdx < startIdx))
+      return TA_OUT_OF_RANGE_END_INDEX;
+
+   if( (nbSymbols < 1) || !inReal ) return TA_BAD_PARAM;
+   /* min/max are checked for optInTimePeriod. */
+   if( (int)optInTimePeriod == TA_INTEGER_DEFAULT )
+      optInTimePeriod = 30;
+   else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+      return TA_BAD_PARAM;
+
+   if( !outBegIdx || !outNBElement || !outReal )
+      return TA_BAD_PARAM;
+
+#endif /* TA_FUNC_NO_RANGE_CHECK */
+
+   block.startIdx      = startIdx;
+   block.endIdx        = endIdx;
+   block.lookbackTotal = TA_KAMA_Lookback( optInTimePeriod );
+   block.period        = optInTimePeriod;
+   block.in[0]         = inReal;
+   block.out           = outReal;
+
+   return runPanel( &block, nbSymbols, 1, kamaBlock, outBegIdx, outNBElement );
+}
+
+TA_RetCode TA_PanelT3( int    startIdx,
+                       int    endIdx,
+                       int    nbSymbols,
+                       const double inReal[],
+                       int    optInTimePeriod,
+                       double optInVFactor,
+                       int   *outBegIdx,
+                       int   *outNBElement,
+                       double outReal[] )
+{
+   TA_PanelBlock block;
+
+#ifndef TA_FUNC_NO_RANGE_CHECK
+
+   /* Validate the requested output range. */
+   if( startIdx < 0 )
+      return TA_OUT_OF_RANGE_START_INDEX;
+   if( (endIdx < 0) || (endIdx < startIdx))
+      return TA_OUT_OF_RANGE_END_INDEX;
+
+   if( (nbSymbols < 1) || !inReal ) return TA_BAD_PARAM;
+   /* min/max are checked for optInTimePeriod. */
+   if( (int)optInTimePeriod == TA_INTEGER_DEFAULT )
+      optInTimePeriod = 5;
+   else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+      return TA_BAD_PARAM;
+
+   if( optInVFactor == TA_REAL_DEFAULT )
+      optInVFactor = 7.000000e-1;
+   else if( (optInVFactor < 0.000000e+0) || (optInVFactor > 1.000000e+0) )
+      return TA_BAD_PARAM;
+
+   if( !outBegIdx || !outNBElement || !outReal )
+      return TA_BAD_PARAM;
+
+#endif /* TA_FUNC_NO_RANGE_CHECK */
+
+   block.startIdx      = startIdx;
+   block.endIdx        = endIdx;
+   block.lookbackTotal = TA_T3_Lookback( optInTimePeriod, optInVFactor );
+   block.period        = optInTimePeriod;
+   block.vFactor       = optInVFactor;
+   block.in[0]         = inReal;
+   block.out           = outReal;
+
+   return runPanel( &block, nbSymbols, 1, t3Block, outBegIdx, outNBElement );
+}
+
+TA_RetCode TA_PanelPack( int    nbSymbols,
+                         int    nbBars,
+                         const double *const inSeries[],
+                         double outPanel[] )
+{
+   int i, t;
+
+#ifndef TA_FUNC_NO_RANGE_CHECK
+   if( (nbSymbols < 1) || (nbBars < 0) || !inSeries || !outPanel )
+      return TA_BAD_PARAM;
+   for( i=0; i < nbSymbols; i++ )
+      if( !inSeries[i] ) return TA_BAD_PARAM;
+#endif /* TA_FUNC_NO_RANGE_CHECK */
+
+   for( t=0; t < nbBars; t++ )
+   {
+      for( i=0; i < nbSymbols; i++ )
+         outPanel[(size_t)t*nbSymbols+i] = inSeries[i][t];
+   }
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_PanelUnpack( int    nbSymbols,
+                           int    nbBars,
+                           const double inPanel[],
+                           double *const outSeries[] )
+{
+   int i, t;
+
+#ifndef TA_FUNC_NO_RANGE_CHECK
+   if( (nbSymbols < 1) || (nbBars < 0) || !inPanel || !outSeries )
+      return TA_BAD_PARAM;
+   for( i=0; i < nbSymbols; i++ )
+      if( !outSeries[i] ) return TA_BAD_PARAM;
+#endif /* TA_FUNC_NO_RANGE_CHECK */
+
+   for( t=0; t < nbBars; t++ )
+   {
+      for( i=0; i < nbSymbols; i++ )
+         outSeries[i][t] = inPanel[(size_t)t*nbSymbols+i];
+   }
+
+   return TA_SUCCESS;
+}
+
+/**** Local functions definitions.     ****/
+
+/* Call the kernel for each block of symbols. block has the range, the
+ * parameters and the panels, the start is moved up by the lookback here.
+ */
+static TA_RetCode runPanel( TA_PanelBlock *block, int nbSymbols, int nbInput,
+                            TA_PanelKernel kernel, int *outBegIdx, int *outNBElement )
+{
+   TA_PanelBlock tail;
+   const double *in[3];
+   double *out, *buffer;
+   int i, j, l, t, first, nbLane, nbBars, nbOut;
+
+   *outBegIdx    = 0;
+   *outNBElement = 0;
+
+   /* Move up the start index if there is not
+    * enough initial data.
+    */
+   if( block->startIdx < block->lookbackTotal )
+      block->startIdx = block->lookbackTotal;
+
+   /* Make sure there is still something to evaluate. */
+   if( block->startIdx > block->endIdx )
+      return TA_SUCCESS;
+
+   for( j=0; j < nbInput; j++ )
+      in[j] = block->in[j];
+   out = block->out;
+   block->stride = (size_t)nbSymbols;
+
+   first = 0;
+   while( nbSymbols-first >= TA_PANEL_LANES )
+   {
+      block->width = nbSymbols-first;
+      block->width -= block->width%TA_PANEL_LANES;
+      if( block->width > PANEL_WIDTH )
+         block->width = PANEL_WIDTH;
+      for( j=0; j < nbInput; j++ )
+         block->in[j] = &in[j][first];
+      block->out = &out[first];
+      kernel( block );
+      first += block->width;
+   }
+
+   /* The last symbols are copied in a block of TA_PANEL_LANES lanes,
+    * the unused lanes repeat the last symbol.
+    */
+   nbLane = nbSymbols-first;
+   if( nbLane > 0 )
+   {
+      nbBars = block->endIdx+1;
+      nbOut  = block->endIdx-block->startIdx+1;
+      buffer = (double *)TA_Malloc( sizeof(double)*TA_PANEL_LANES*((size_t)nbBars*nbInput+nbOut) );
+      if( !buffer )
+         return TA_ALLOC_ERR;
+
+      tail = *block;
+      tail.width  = TA_PANEL_LANES;
+      tail.stride = TA_PANEL_LANES;
+      for( j=0; j < nbInput; j++ )
+      {
+         for( t=0; t < nbBars; t++ )
+         {
+            for( l=0; l < TA_PANEL_LANES; l++ )
+            {
+               i = first+((l < nbLane)? l : nbLane-1);
+               buffer[((size_t)j*nbBars+t)*TA_PANEL_LANES+l] = in[j][(size_t)t*nbSymbols+i];
+            }
+         }
+         tail.in[j] = &buffer[(size_t)j*nbBars*TA_PANEL_LANES];
+      }
+      tail.out = &buffer[(size_t)nbInput*nbBars*TA_PANEL_LANES];
+      kernel( &tail );
+
+      for( t=0; t < nbOut; t++ )
+      {
+         for( l=0; l < nbLane; l++ )
+            out[(size_t)t*nbSymbols+first+l] = tail.out[(size_t)t*TA_PANEL_LANES+l];
+      }
+      TA_Free( buffer );
+   }
+
+   *outBegIdx    = block->startIdx;
+   *outNBElement = block->endIdx-block->startIdx+1;
+
+   return TA_SUCCESS;
+}
+
+/* Same as TA_INT_EMA. */
+static void emaBlock( const TA_PanelBlock *block )
+{
+   const double *in = block->in[0];
+   double *out = block->out;
+   size_t stride = block->stride;
+   int width = block->width;
+   int period = block->period;
+   double k = PER_TO_K( period );
+   double prevMA[PANEL_WIDTH], tempReal[PANEL_WIDTH];
+   int i, b, l, today, outIdx;
+
+   if( TA_GLOBALS_COMPATIBILITY == TA_COMPATIBILITY_DEFAULT )
+   {
+      today = block->startIdx-block->lookbackTotal;
+      PANEL_FOR_LANES( l )
+         tempReal[l] = 0.0;
+      for( i=period; i > 0; i-- )
+      {
+         PANEL_FOR_LANES( l )
+            tempReal[l] += in[today*stride+l];
+         today++;
+      }
+      PANEL_FOR_LANES( l )
+         prevMA[l] = tempReal[l] / period;
+   }
+   else
+   {
+      PANEL_FOR_LANES( l )
+         prevMA[l] = in[l];
+      today = 1;
+   }
+
+   /* Skip the unstable period. */
+   while( today <= block->startIdx )
+   {
+      PANEL_FOR_LANES( l )
+         prevMA[l] = ((in[today*stride+l]-prevMA[l])*k) + prevMA[l];
+      today++;
+   }
+
+   PANEL_FOR_LANES( l )
+      out[l] = prevMA[l];
+   outIdx = 1;
+
+   while( today <= block->endIdx )
+   {
+      PANEL_FOR_LANES( l )
+         prevMA[l] = ((in[today*stride+l]-prevMA[l])*k) + prevMA[l];
+      PANEL_FOR_LANES( l )
+         out[outIdx*stride+l] = prevMA[l];
+      today++;
+      outIdx++;
+   }
+}
+
+/* Same as TA_RSI.
+ *
+ * The gain or the loss of each lane is selected in a first loop, and
+ * added in a second one: 'prevLoss -= 0.0' and 'prevGain += 0.0' leave
+ * the averages unchanged (they are never -0.0).
+ */
+static void rsiBlock( const TA_PanelBlock *block )
+{
+   const double *in = block->in[0];
+   double *out = block->out;
+   size_t stride = block->stride;
+   int width = block->width;
+   int period = block->period;
+   double prevGain[PANEL_WIDTH], prevLoss[PANEL_WIDTH];
+   double prevValue[PANEL_WIDTH], savePrevValue[PANEL_WIDTH];
+   double gain[PANEL_WIDTH], loss[PANEL_WIDTH], total[PANEL_WIDTH];
+   double tempValue1, tempValue2;
+   int i, b, l, today, outIdx;
+
+   outIdx = 0;
+
+   /* Period 1 only without the range check. */
+   if( period == 1 )
+   {
+      for( today=block->startIdx; today <= block->endIdx; today++ )
+      {
+         PANEL_FOR_LANES( l )
+            out[outIdx*stride+l] = in[today*stride+l];
+         outIdx++;
+      }
+      return;
+   }
+
+   today = block->startIdx-block->lookbackTotal;
+   PANEL_FOR_LANES( l )
+      prevValue[l] = in[today*stride+l];
+
+   /* Output particular to Metastock, see TA_RSI. */
+   if( (TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_RSI,Rsi) == 0) &&
+       (TA_GLOBALS_COMPATIBILITY == TA_COMPATIBILITY_METASTOCK) )
+   {
+      PANEL_FOR_LANES( l )
+      {
+         savePrevValue[l] = prevValue[l];
+         prevGain[l] = 0.0;
+         prevLoss[l] = 0.0;
+      }
+      for( i=period; i > 0; i-- )
+      {
+         PANEL_FOR_LANES( l )
+         {
+            tempValue1   = in[today*stride+l];
+            tempValue2   = tempValue1 - prevValue[l];
+            prevValue[l] = tempValue1;
+            loss[l] = (tempValue2 < 0)? tempValue2 : 0.0;
+            gain[l] = (tempValue2 < 0)? 0.0 : tempValue2;
+         }
+         PANEL_FOR_LANES( l )
+         {
+            prevLoss[l] -= loss[l];
+            prevGain[l] += gain[l];
+         }
+         today++;
+      }
+
+      PANEL_FOR_LANES( l )
+      {
+         tempValue1 = prevLoss[l]/period;
+         tempValue2 = prevGain[l]/period;
+         total[l]   = tempValue2+tempValue1;
+         gain[l]    = 100*(tempValue2/total[l]);
+      }
+      PANEL_FOR_LANES( l )
+         out[l] = !PANEL_IS_ZERO(total[l])? gain[l] : 0.0;
+      outIdx++;
+
+      if( today > block->endIdx )
+         return;
+
+      today -= period;
+      PANEL_FOR_LANES( l )
+         prevValue[l] = savePrevValue[l];
+   }
+
+   PANEL_FOR_LANES( l )
+   {
+      prevGain[l] = 0.0;
+      prevLoss[l] = 0.0;
+   }
+   today++;
+   for( i=period; i > 0; i-- )
+   {
+      PANEL_FOR_LANES( l )
+      {
+         tempValue1   = in[today*stride+l];
+         tempValue2   = tempValue1 - prevValue[l];
+         prevValue[l] = tempValue1;
+         loss[l] = (tempValue2 < 0)? tempValue2 : 0.0;
+         gain[l] = (tempValue2 < 0)? 0.0 : tempValue2;
+      }
+      PANEL_FOR_LANES( l )
+      {
+         prevLoss[l] -= loss[l];
+         prevGain[l] += gain[l];
+      }
+      today++;
+   }
+
+   PANEL_FOR_LANES( l )
+   {
+      prevLoss[l] /= period;
+      prevGain[l] /= period;
+   }
+
+   if( today > block->startIdx )
+   {
+      PANEL_FOR_LANES( l )
+      {
+         total[l] = prevGain[l]+prevLoss[l];
+         gain[l]  = 100.0*(prevGain[l]/total[l]);
+      }
+      PANEL_FOR_LANES( l )
+         out[outIdx*stride+l] = !PANEL_IS_ZERO(total[l])? gain[l] : 0.0;
+      outIdx++;
+   }
+   else
+   {
+      /* Skip the unstable period. */
+      while( today < block->startIdx )
+      {
+         PANEL_FOR_LANES( l )
+         {
+            tempValue1   = in[today*stride+l];
+            tempValue2   = tempValue1 - prevValue[l];
+            prevValue[l] = tempValue1;
+            loss[l] = (tempValue2 < 0)? tempValue2 : 0.0;
+            gain[l] = (tempValue2 < 0)? 0.0 : tempValue2;
+         }
+         PANEL_FOR_LANES( l )
+         {
+            prevLoss[l] *= (period-1);
+            prevGain[l] *= (period-1);
+            prevLoss[l] -= loss[l];
+            prevGain[l] += gain[l];
+            prevLoss[l] /= period;
+            prevGain[l] /= period;
+         }
+         today++;
+      }
+   }
+
+   while( today <= block->endIdx )
+   {
+      PANEL_FOR_LANES( l )
+      {
+         tempValue1   = in[today*stride+l];
+         tempValue2   = tempValue1 - prevValue[l];
+         prevValue[l] = tempValue1;
+         loss[l] = (tempValue2 < 0)? tempValue2 : 0.0;
+         gain[l] = (tempValue2 < 0)? 0.0 : tempValue2;
+      }
+      PANEL_FOR_LANES( l )
+      {
+         prevLoss[l] *= (period-1);
+         prevGain[l] *= (period-1);
+         prevLoss[l] -= loss[l];
+         prevGain[l] += gain[l];
+         prevLoss[l] /= period;
+         prevGain[l] /= period;
+         total[l] = prevGain[l]+prevLoss[l];
+         gain[l]  = 100.0*(prevGain[l]/total[l]);
+      }
+      PANEL_FOR_LANES( l )
+         out[outIdx*stride+l] = !PANEL_IS_ZERO(total[l])? gain[l] : 0.0;
+      today++;
+      outIdx++;
+   }
+}
+
+/* Same as TA_ATR. The true ranges are calculated as they are needed,
+ * the output of a bar is written after its inputs are read.
+ */
+static void atrBlock( const TA_PanelBlock *block )
+{
+   double *out = block->out;
+   size_t stride = block->stride;
+   int width = block->width;
+   int period = block->period;
+   const double *inHigh, *inLow, *inClose;
+   double prevATR[PANEL_WIDTH], periodComp[PANEL_WIDTH], tr[PANEL_WIDTH];
+   double val2[PANEL_WIDTH], val3[PANEL_WIDTH], greatest;
+   int i, b, l, today, outIdx;
+
+   today = block->startIdx;
+
+   /* No smoothing needed, same as TA_TRANGE. */
+   if( period <= 1 )
+   {
+      for( outIdx=0; today <= block->endIdx; outIdx++ )
+      {
+         trueRange( block, today++, tr );
+         PANEL_FOR_LANES( l )
+            out[outIdx*stride+l] = tr[l];
+      }
+      return;
+   }
+
+   /* First value is a simple average of the true
+    * ranges, same as TA_INT_SMA.
+    */
+   today = block->startIdx-block->lookbackTotal+1;
+   PANEL_FOR_LANES( l )
+   {
+      prevATR[l]    = 0.0;
+      periodComp[l] = 0.0;
+   }
+   if( TA_GLOBALS_PRECISION == TA_PRECISION_COMPENSATED )
+   {
+      for( i=period; i > 0; i-- )
+      {
+         trueRange( block, today++, tr );
+         PANEL_FOR_LANES( l )
+            TA_SUM_ADD( prevATR[l], periodComp[l], tr[l] );
+      }
+      PANEL_FOR_LANES( l )
+         prevATR[l] = (prevATR[l] + periodComp[l]) / period;
+   }
+   else
+   {
+      for( i=period; i > 0; i-- )
+      {
+         trueRange( block, today++, tr );
+         PANEL_FOR_LANES( l )
+            prevATR[l] += tr[l];
+      }
+      PANEL_FOR_LANES( l )
+         prevATR[l] = prevATR[l] / period;
+   }
+
+   /* Skip the unstable period. */
+   while( today <= block->startIdx )
+   {
+      trueRange( block, today++, tr );
+      PANEL_FOR_LANES( l )
+      {
+         prevATR[l] *= period - 1;
+         prevATR[l] += tr[l];
+         prevATR[l] /= period;
+      }
+   }
+
+   PANEL_FOR_LANES( l )
+      out[l] = prevATR[l];
+   outIdx = 1;
+
+   /* Same as trueRange(), in the loop so it is vectorized with it. */
+   inHigh  = block->in[0];
+   inLow   = block->in[1];
+   inClose = block->in[2];
+   while( today <= block->endIdx )
+   {
+      PANEL_FOR_LANES( l )
+      {
+         greatest = inHigh[today*stride+l] - inLow[today*stride+l];
+         val2[l]  = std_fabs( inClose[(today-1)*stride+l] - inHigh[today*stride+l] );
+         val3[l]  = std_fabs( inClose[(today-1)*stride+l] - inLow[today*stride+l] );
+         tr[l]    = (val2[l] > greatest)? val2[l] : greatest;
+      }
+      PANEL_FOR_LANES( l )
+         tr[l] = (val3[l] > tr[l])? val3[l] : tr[l];
+      today++;
+
+      PANEL_FOR_LANES( l )
+      {
+         prevATR[l] *= period - 1;
+         prevATR[l] += tr[l];
+         prevATR[l] /= period;
+      }
+      PANEL_FOR_LANES( l )
+         out[outIdx*stride+l] = prevATR[l];
+      outIdx++;
+   }
+}
+
+/* Same as TA_TRANGE for the bar 'today'. */
+static void trueRange( const TA_PanelBlock *block, int today, double tr[] )
+{
+   const double *inHigh  = &block->in[0][today*block->stride];
+   const double *inLow   = &block->in[1][today*block->stride];
+   const double *inClose = &block->in[2][(today-1)*block->stride];
+   int width = block->width;
+   double val2, val3, greatest;
+   int b, l;
+
+   PANEL_FOR_LANES( l )
+   {
+      greatest = inHigh[l] - inLow[l];
+      val2 = std_fabs( inClose[l] - inHigh[l] );
+      greatest = (val2 > greatest)? val2 : greatest;
+      val3 = std_fabs( inClose[l] - inLow[l] );
+      tr[l] = (val3 > greatest)? val3 : greatest;
+   }
+}
+
+/* Same as TA_KAMA. */
+static void kamaBlock( const TA_PanelBlock *block )
+{
+   const double constMax  = 2.0/(30.0+1.0);
+   const double constDiff = 2.0/(2.0+1.0) - constMax;
+   const double *in = block->in[0];
+   double *out = block->out;
+   size_t stride = block->stride;
+   int width = block->width;
+   double sumROC1[PANEL_WIDTH], prevKAMA[PANEL_WIDTH], trailingValue[PANEL_WIDTH];
+   double periodROC[PANEL_WIDTH], ratio[PANEL_WIDTH];
+   double tempReal, tempReal2;
+   int i, b, l, today, trailingIdx, outIdx;
+
+   today = block->startIdx-block->lookbackTotal;
+   trailingIdx = today;
+   PANEL_FOR_LANES( l )
+      sumROC1[l] = 0.0;
+   for( i=block->period; i > 0; i-- )
+   {
+      PANEL_FOR_LANES( l )
+      {
+         tempReal    = in[today*stride+l];
+         tempReal   -= in[(today+1)*stride+l];
+         sumROC1[l] += std_fabs(tempReal);
+      }
+      today++;
+   }
+
+   /* The yesterday price is used here as the previous KAMA. */
+   PANEL_FOR_LANES( l )
+   {
+      prevKAMA[l]  = in[(today-1)*stride+l];
+      tempReal     = in[today*stride+l];
+      tempReal2    = in[trailingIdx*stride+l];
+      periodROC[l] = tempReal-tempReal2;
+      trailingValue[l] = tempReal2;
+      ratio[l] = std_fabs(periodROC[l]/sumROC1[l]);
+   }
+   PANEL_FOR_LANES( l )
+      ratio[l] = ((sumROC1[l] <= periodROC[l]) || PANEL_IS_ZERO(sumROC1[l]))? 1.0 : ratio[l];
+   PANEL_FOR_LANES( l )
+   {
+      tempReal  = (ratio[l]*constDiff)+constMax;
+      tempReal *= tempReal;
+      prevKAMA[l] = ((in[today*stride+l]-prevKAMA[l])*tempReal) + prevKAMA[l];
+   }
+   trailingIdx++;
+   today++;
+
+   /* Skip the unstable period. */
+   while( today <= block->startIdx )
+   {
+      PANEL_FOR_LANES( l )
+      {
+         tempReal  = in[today*stride+l];
+         tempReal2 = in[trailingIdx*stride+l];
+         periodROC[l] = tempReal-tempReal2;
+         sumROC1[l] -= std_fabs(trailingValue[l]-tempReal2);
+         sumROC1[l] += std_fabs(tempReal-in[(today-1)*stride+l]);
+         trailingValue[l] = tempReal2;
+         ratio[l] = std_fabs(periodROC[l]/sumROC1[l]);
+      }
+
+      /* Efficiency ratio. */
+      PANEL_FOR_LANES( l )
+         ratio[l] = ((sumROC1[l] <= periodROC[l]) || PANEL_IS_ZERO(sumROC1[l]))? 1.0 : ratio[l];
+
+      PANEL_FOR_LANES( l )
+      {
+         tempReal  = (ratio[l]*constDiff)+constMax;
+         tempReal *= tempReal;
+         prevKAMA[l] = ((in[today*stride+l]-prevKAMA[l])*tempReal) + prevKAMA[l];
+      }
+      trailingIdx++;
+      today++;
+   }
+
+   PANEL_FOR_LANES( l )
+      out[l] = prevKAMA[l];
+   outIdx = 1;
+
+   while( today <= block->endIdx )
+   {
+      PANEL_FOR_LANES( l )
+      {
+         tempReal  = in[today*stride+l];
+         tempReal2 = in[trailingIdx*stride+l];
+         periodROC[l] = tempReal-tempReal2;
+         sumROC1[l] -= std_fabs(trailingValue[l]-tempReal2);
+         sumROC1[l] += std_fabs(tempReal-in[(today-1)*stride+l]);
+         trailingValue[l] = tempReal2;
+         ratio[l] = std_fabs(periodROC[l]/sumROC1[l]);
+      }
+
+      /* Efficiency ratio. */
+      PANEL_FOR_LANES( l )
+         ratio[l] = ((sumROC1[l] <= periodROC[l]) || PANEL_IS_ZERO(sumROC1[l]))? 1.0 : ratio[l];
+
+      PANEL_FOR_LANES( l )
+      {
+         tempReal  = (ratio[l]*constDiff)+constMax;
+         tempReal *= tempReal;
+         prevKAMA[l] = ((in[today*stride+l]-prevKAMA[l])*tempReal) + prevKAMA[l];
+      }
+      PANEL_FOR_LANES( l )
+         out[outIdx*stride+l] = prevKAMA[l];
+      trailingIdx++;
+      today++;
+      outIdx++;
+   }
+}
+
+/* Same as TA_T3. */
+static void t3Block( const TA_PanelBlock *block )
+{
+   const double *in = block->in[0];
+   double *out = block->out;
+   size_t stride = block->stride;
+   int width = block->width;
+   int period = block->period;
+   double k, one_minus_k, c1, c2, c3, c4, vFactor, tempReal;
+   double e1[PANEL_WIDTH], e2[PANEL_WIDTH], e3[PANEL_WIDTH];
+   double e4[PANEL_WIDTH], e5[PANEL_WIDTH], e6[PANEL_WIDTH];
+   double sum[PANEL_WIDTH];
+   int i, b, l, today, outIdx;
+
+   today = block->startIdx-block->lookbackTotal;
+   k = 2.0/(period+1.0);
+   one_minus_k = 1.0-k;
+
+   /* Initialize e1 */
+   PANEL_FOR_LANES( l )
+      sum[l] = in[today*stride+l];
+   today++;
+   for( i=period-1; i > 0; i-- )
+   {
+      PANEL_FOR_LANES( l )
+         sum[l] += in[today*stride+l];
+      today++;
+   }
+   PANEL_FOR_LANES( l )
+   {
+      e1[l]  = sum[l] / period;
+      sum[l] = e1[l];
+   }
+
+   /* Initialize e2 */
+   for( i=period-1; i > 0; i-- )
+   {
+      PANEL_FOR_LANES( l )
+      {
+         e1[l] = (k*in[today*stride+l])+(one_minus_k*e1[l]);
+         sum[l] += e1[l];
+      }
+      today++;
+   }
+   PANEL_FOR_LANES( l )
+   {
+      e2[l]  = sum[l] / period;
+      sum[l] = e2[l];
+   }
+
+   /* Initialize e3 */
+   for( i=period-1; i > 0; i-- )
+   {
+      PANEL_FOR_LANES( l )
+      {
+         e1[l] = (k*in[today*stride+l])+(one_minus_k*e1[l]);
+         e2[l] = (k*e1[l])+(one_minus_k*e2[l]);
+         sum[l] += e2[l];
+      }
+      today++;
+   }
+   PANEL_FOR_LANES( l )
+   {
+      e3[l]  = sum[l] / period;
+      sum[l] = e3[l];
+   }
+
+   /* Initialize e4 */
+   for( i=period-1; i > 0; i-- )
+   {
+      PANEL_FOR_LANES( l )
+      {
+         e1[l] = (k*in[today*stride+l])+(one_minus_k*e1[l]);
+         e2[l] = (k*e1[l])+(one_minus_k*e2[l]);
+         e3[l] = (k*e2[l])+(one_minus_k*e3[l]);
+         sum[l] += e3[l];
+      }
+      today++;
+   }
+   PANEL_FOR_LANES( l )
+   {
+      e4[l]  = sum[l] / period;
+      sum[l] = e4[l];
+   }
+
+   /* Initialize e5 */
+   for( i=period-1; i > 0; i-- )
+   {
+      PANEL_FOR_LANES( l )
+      {
+         e1[l] = (k*in[today*stride+l])+(one_minus_k*e1[l]);
+         e2[l] = (k*e1[l])+(one_minus_k*e2[l]);
+         e3[l] = (k*e2[l])+(one_minus_k*e3[l]);
+         e4[l] = (k*e3[l])+(one_minus_k*e4[l]);
+         sum[l] += e4[l];
+      }
+      today++;
+   }
+   PANEL_FOR_LANES( l )
+   {
+      e5[l]  = sum[l] / period;
+      sum[l] = e5[l];
+   }
+
+   /* Initialize e6 */
+   for( i=period-1; i > 0; i-- )
+   {
+      PANEL_FOR_LANES( l )
+      {
+         e1[l] = (k*in[today*stride+l])+(one_minus_k*e1[l]);
+         e2[l] = (k*e1[l])+(one_minus_k*e2[l]);
+         e3[l] = (k*e2[l])+(one_minus_k*e3[l]);
+         e4[l] = (k*e3[l])+(one_minus_k*e4[l]);
+         e5[l] = (k*e4[l])+(one_minus_k*e5[l]);
+         sum[l] += e5[l];
+      }
+      today++;
+   }
+   PANEL_FOR_LANES( l )
+      e6[l] = sum[l] / period;
+
+   /* Skip the unstable period */
+   while( today <= block->startIdx )
+   {
+      PANEL_FOR_LANES( l )
+      {
+         e1[l] = (k*in[today*stride+l])+(one_minus_k*e1[l]);
+         e2[l] = (k*e1[l])+(one_minus_k*e2[l]);
+         e3[l] = (k*e2[l])+(one_minus_k*e3[l]);
+         e4[l] = (k*e3[l])+(one_minus_k*e4[l]);
+         e5[l] = (k*e4[l])+(one_minus_k*e5[l]);
+         e6[l] = (k*e5[l])+(one_minus_k*e6[l]);
+      }
+      today++;
+   }
+
+   /* Calculate the constants */
+   vFactor  = block->vFactor;
+   tempReal = vFactor * vFactor;
+   c1 = -(tempReal * vFactor);
+   c2 = 3.0 * (tempReal - c1);
+   c3 = -6.0 * tempReal - 3.0 * (vFactor-c1);
+   c4 = 1.0 + 3.0 * vFactor - c1 + 3.0 * tempReal;
+
+   PANEL_FOR_LANES( l )
+      out[l] = c1*e6[l]+c2*e5[l]+c3*e4[l]+c4*e3[l];
+   outIdx = 1;
+
+   while( today <= block->endIdx )
+   {
+      PANEL_FOR_LANES( l )
+      {
+         e1[l] = (k*in[today*stride+l])+(one_minus_k*e1[l]);
+         e2[l] = (k*e1[l])+(one_minus_k*e2[l]);
+         e3[l] = (k*e2[l])+(one_minus_k*e3[l]);
+         e4[l] = (k*e3[l])+(one_minus_k*e4[l]);
+         e5[l] = (k*e4[l])+(one_minus_k*e5[l]);
+         e6[l] = (k*e5[l])+(one_minus_k*e6[l]);
+      }
+      PANEL_FOR_LANES( l )
+         out[outIdx*stride+l] = c1*e6[l]+c2*e5[l]+c3*e4[l]+c4*e3[l];
+      today++;
+      outIdx++;
+   }
+}
@@ -0,0 +1,249 @@
+/* Description:
+ *   Registry of all the TA functions (see ta_registry.h).
+ *
+ *   The table and the wrappers are in ta_registry_table.h, generated
+ *   from ta_func.h by ta_gen_registry.
+ */
+
+/**** Headers ****/
+#include <string.h>
+#include "ta_func.h"
+#include "ta_registry.h"
+#include "ta_memory.h"
+#include "ta_instr_priv.h"
+
+/**** Local declarations.              ****/
+#include "ta_registry_table.h"
+
+#define NB_FUNC ((int)(sizeof(funcTable)/sizeof(TA_FuncDef)))
+
+/**** Local functions declarations.    ****/
+static TA_TailMode tailMode( const TA_FuncDef *func,
+                             const double optIn[],
+                             TA_FuncUnstId *unstId );
+static TA_TailMode unstableMode( TA_FuncUnstId unstId );
+
+/**** Local variables definitions.     ****/
+
+/* Each value depends of all the previous bars (cumulative sum, SAR
+ * position, EMA of an EMA without an unstable period, trend state...).
+ * Sorted by name.
+ */
+static const char *const tailHistoryName[] =
+{
+   "AD", "ADOSC", "DEMA", "MACD", "MACDFIX", "OBV", "SAR", "SAREXT", "TEMA", "TRIX", "TrendData"
+};
+
+#define NB_TAIL_HISTORY ((int)(sizeof(tailHistoryName)/sizeof(const char *)))
+
+/**** Global functions definitions.   ****/
+int TA_FuncCount( void )
+{
+   return NB_FUNC;
+}
+
+const TA_FuncDef *TA_FuncAt( int idx )
+{
+   if( (idx < 0) || (idx >= NB_FUNC) )
+      return NULL;
+
+   return &funcTable[idx];
+}
+
+const TA_FuncDef *TA_FuncFind( const char *name )
+{
+   int low, high, mid, cmp;
+
+   if( !name )
+      return NULL;
+
+   if( strncmp( name, "TA_", 3 ) == 0 )
+      name += 3;
+
+   low  = 0;
+   high = NB_FUNC-1;
+   while( low <= high )
+   {
+      mid = (low+high)/2;
+      cmp = strcmp( name, funcTable[mid].name );
+      if( cmp == 0 )
+         return &funcTable[mid];
+      if( cmp < 0 )
+         high = mid-1;
+      else
+         low = mid+1;
+   }
+
+   return NULL;
+}
+
+int TA_FuncOutputSize( const TA_FuncDef *func,
+                       int startIdx,
+                       int endIdx,
+                       const double optIn[] )
+{
+   int lookback;
+
+   if( !func || (startIdx < 0) || (endIdx < startIdx) )
+      return -1;
+
+   lookback = func->lookback( optIn );
+   if( lookback < 0 )
+      return -1;
+
+   if( startIdx < lookback )
+      startIdx = lookback;
+
+   if( startIdx > endIdx )
+      return 0;
+
+   return endIdx-startIdx+1;
+}
+
+TA_TailMode TA_FuncTailMode( const TA_FuncDef *func,
+                             const double optIn[] )
+{
+   TA_FuncUnstId unstId;
+
+   if( !func )
+      return TA_TAIL_HISTORY;
+
+   return tailMode( func, optIn, &unstId );
+}
+
+TA_RetCode TA_FuncTail( const TA_FuncDef *func,
+                        int endIdx,
+                        int nbTail,
+                        int maxWarmUp,
+                        const double *const inputs[],
+                        const double optIn[],
+                        int   *outBegIdx,
+                        int   *outNBElement,
+                        void  *const outputs[] )
+{
+   TA_RetCode retCode;
+   TA_FuncUnstId unstId;
+   TA_UnstableExtra saved;
+   int startIdx, lookback, warmUp;
+
+   if( !func || !outBegIdx || !outNBElement || (nbTail < 1) )
+      return TA_BAD_PARAM;
+
+   if( endIdx < 0 )
+      return TA_OUT_OF_RANGE_END_INDEX;
+
+   lookback = func->lookback( optIn );
+   if( lookback < 0 )
+      return TA_BAD_PARAM;
+
+   switch( tailMode( func, optIn, &unstId ) )
+   {
+   case TA_TAIL_WINDOW:
+      break;
+
+   case TA_TAIL_UNSTABLE:
+      startIdx = endIdx-nbTail+1;
+      if( startIdx <= lookback )
+         break;
+
+      /* The bars skipped by the warm-up become part of the unstable
+       * period of this call only. TA_Globals is not modified.
+       */
+      if( (maxWarmUp < 0) || (maxWarmUp > startIdx) )
+         warmUp = startIdx;
+      else
+         warmUp = (maxWarmUp > lookback)? maxWarmUp : lookback;
+
+      saved = TA_ThreadUnstable;
+      TA_ThreadUnstable.id    = unstId;
+      TA_ThreadUnstable.extra = (unsigned int)(warmUp-lookback);
+      retCode = func->call( startIdx, endIdx, inputs, optIn,
+                            outBegIdx, outNBElement, outputs );
+      TA_ThreadUnstable = saved;
+      return retCode;
+
+   default:
+      return TA_NOT_SUPPORTED;
+   }
+
+   /* Called directly. Before the lookback, the outputs of [0,endIdx]
+    * are not more than nbTail.
+    */
+   startIdx = endIdx-nbTail+1;
+   if( startIdx < 0 )
+      startIdx = 0;
+
+   return func->call( startIdx, endIdx, inputs, optIn,
+                      outBegIdx, outNBElement, outputs );
+}
+
+/**** Local functions definitions.     ****/
+static TA_TailMode tailMode( const TA_FuncDef *func,
+                             const double optIn[],
+                             TA_FuncUnstId *unstId )
+{
+   int i, maType;
+
+   for( i=0; i < NB_TAIL_HISTORY; i++ )
+   {
+      if( strcmp( func->name, tailHistoryName[i] ) == 0 )
+         return TA_TAIL_HISTORY;
+   }
+
+   /* A moving average used inside the function. Only SMA, WMA and
+    * TRIMA are on a fixed window. TA_MA alone can use the unstable
+    * period of the type.
+    */
+   for( i=0; i < func->nbOptInput; i++ )
+   {
+      if( func->optInputs[i].type != TA_OPTIN_MATYPE )
+         continue;
+
+      maType = (optIn[i] == (double)TA_INTEGER_DEFAULT)? TA_MAType_SMA : (int)optIn[i];
+      if( (maType == TA_MAType_SMA) || (maType == TA_MAType_WMA) || (maType == TA_MAType_TRIMA) )
+         continue;
+
+      if( strcmp( func->name, "MA" ) != 0 )
+         return TA_TAIL_HISTORY;
+
+      switch( maType )
+      {
+      case TA_MAType_EMA:  *unstId = TA_FUNC_UNST_EMA;  break;
+      case TA_MAType_KAMA: *unstId = TA_FUNC_UNST_KAMA; break;
+      case TA_MAType_MAMA: *unstId = TA_FUNC_UNST_MAMA; break;
+      case TA_MAType_T3:   *unstId = TA_FUNC_UNST_T3;   break;
+      default:             return TA_TAIL_HISTORY;
+      }
+
+      return unstableMode( *unstId );
+   }
+
+   /* The unstable period used by the calculation is not always the
+    * one of the function: ADXR is from the ADX and STOCHRSI from the
+    * RSI. The unstable period of IMI is part of its window.
+    */
+   if( strcmp( func->name, "ADXR" ) == 0 )
+      *unstId = TA_FUNC_UNST_ADX;
+   else if( strcmp( func->name, "STOCHRSI" ) == 0 )
+      *unstId = TA_FUNC_UNST_RSI;
+   else if( strcmp( func->name, "IMI" ) == 0 )
+      *unstId = TA_FUNC_UNST_NONE;
+   else
+      *unstId = func->unstId;
+
+   if( *unstId == TA_FUNC_UNST_NONE )
+      return TA_TAIL_WINDOW;
+
+   return unstableMode( *unstId );
+}
+
+/* In the METASTOCK compatibility, the EMA is seeded by the first bar
+ * of the input, whatever the unstable period.
+ */
+static TA_TailMode unstableMode( TA_FuncUnstId unstId )
+{
+   if( (unstId == TA_FUNC_UNST_EMA) && (TA_GLOBALS_COMPATIBILITY == TA_COMPATIBILITY_METASTOCK) )
+      return TA_TAIL_HISTORY;
+
+   return TA_TAIL_UNSTABLE;
+}
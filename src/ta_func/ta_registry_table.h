@@ -0,0 +1,4519 @@
+/* Generated by ta_gen_registry from include/ta_func.h, do not edit.
+ *
+ * To regenerate: ta_gen_registry <root of the repository>
+ */
+
+/* TA_ACCBANDS */
+static const TA_InputDef inputs_ACCBANDS[] = {
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OptInputDef optInputs_ACCBANDS[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_ACCBANDS[] = {
+   { TA_OUTPUT_REAL, "outRealUpperBand" },
+   { TA_OUTPUT_REAL, "outRealMiddleBand" },
+   { TA_OUTPUT_REAL, "outRealLowerBand" }
+};
+
+static int lookback_ACCBANDS( const double optIn[] )
+{
+   return TA_ACCBANDS_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_ACCBANDS( int startIdx, int endIdx,
+                                 const double *const inputs[], const double optIn[],
+                                 int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 0 );
+   TA_INSTR_RETURN( TA_ACCBANDS( startIdx, endIdx, inputs[0], inputs[1], inputs[2], (int)optIn[0],
+                                 outBegIdx, outNBElement, (double *)outputs[0], (double *)outputs[1], (double *)outputs[2] ) );
+}
+
+/* TA_AD */
+static const TA_InputDef inputs_AD[] = {
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" },
+   { TA_INPUT_VOLUME, "inVolume" }
+};
+static const TA_OutputDef outputs_AD[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_AD( const double optIn[] )
+{
+   (void)optIn;
+   return TA_AD_Lookback();
+}
+
+static TA_RetCode call_AD( int startIdx, int endIdx,
+                           const double *const inputs[], const double optIn[],
+                           int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 1 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_AD( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                           outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_ADOSC */
+static const TA_InputDef inputs_ADOSC[] = {
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" },
+   { TA_INPUT_VOLUME, "inVolume" }
+};
+static const TA_OptInputDef optInputs_ADOSC[] = {
+   { TA_OPTIN_INTEGER, "optInFastPeriod", 2, 100000 },
+   { TA_OPTIN_INTEGER, "optInSlowPeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_ADOSC[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_ADOSC( const double optIn[] )
+{
+   return TA_ADOSC_Lookback( (int)optIn[0], (int)optIn[1] );
+}
+
+static TA_RetCode call_ADOSC( int startIdx, int endIdx,
+                              const double *const inputs[], const double optIn[],
+                              int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 2 );
+   TA_INSTR_RETURN( TA_ADOSC( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3], (int)optIn[0], (int)optIn[1],
+                              outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_ADX */
+static const TA_InputDef inputs_ADX[] = {
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OptInputDef optInputs_ADX[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_ADX[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_ADX( const double optIn[] )
+{
+   return TA_ADX_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_ADX( int startIdx, int endIdx,
+                            const double *const inputs[], const double optIn[],
+                            int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 3 );
+   TA_INSTR_RETURN( TA_ADX( startIdx, endIdx, inputs[0], inputs[1], inputs[2], (int)optIn[0],
+                            outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_ADXR */
+static const TA_InputDef inputs_ADXR[] = {
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OptInputDef optInputs_ADXR[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_ADXR[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_ADXR( const double optIn[] )
+{
+   return TA_ADXR_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_ADXR( int startIdx, int endIdx,
+                             const double *const inputs[], const double optIn[],
+                             int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 4 );
+   TA_INSTR_RETURN( TA_ADXR( startIdx, endIdx, inputs[0], inputs[1], inputs[2], (int)optIn[0],
+                             outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_APO */
+static const TA_InputDef inputs_APO[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_APO[] = {
+   { TA_OPTIN_INTEGER, "optInFastPeriod", 2, 100000 },
+   { TA_OPTIN_INTEGER, "optInSlowPeriod", 2, 100000 },
+   { TA_OPTIN_MATYPE, "optInMAType", TA_MAType_SMA, TA_MAType_T3 }
+};
+static const TA_OutputDef outputs_APO[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_APO( const double optIn[] )
+{
+   return TA_APO_Lookback( (int)optIn[0], (int)optIn[1], (TA_MAType)(int)optIn[2] );
+}
+
+static TA_RetCode call_APO( int startIdx, int endIdx,
+                            const double *const inputs[], const double optIn[],
+                            int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 5 );
+   TA_INSTR_RETURN( TA_APO( startIdx, endIdx, inputs[0], (int)optIn[0], (int)optIn[1], (TA_MAType)(int)optIn[2],
+                            outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_AROON */
+static const TA_InputDef inputs_AROON[] = {
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" }
+};
+static const TA_OptInputDef optInputs_AROON[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_AROON[] = {
+   { TA_OUTPUT_REAL, "outAroonDown" },
+   { TA_OUTPUT_REAL, "outAroonUp" }
+};
+
+static int lookback_AROON( const double optIn[] )
+{
+   return TA_AROON_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_AROON( int startIdx, int endIdx,
+                              const double *const inputs[], const double optIn[],
+                              int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 6 );
+   TA_INSTR_RETURN( TA_AROON( startIdx, endIdx, inputs[0], inputs[1], (int)optIn[0],
+                              outBegIdx, outNBElement, (double *)outputs[0], (double *)outputs[1] ) );
+}
+
+/* TA_AROONOSC */
+static const TA_InputDef inputs_AROONOSC[] = {
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" }
+};
+static const TA_OptInputDef optInputs_AROONOSC[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_AROONOSC[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_AROONOSC( const double optIn[] )
+{
+   return TA_AROONOSC_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_AROONOSC( int startIdx, int endIdx,
+                                 const double *const inputs[], const double optIn[],
+                                 int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 7 );
+   TA_INSTR_RETURN( TA_AROONOSC( startIdx, endIdx, inputs[0], inputs[1], (int)optIn[0],
+                                 outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_ATR */
+static const TA_InputDef inputs_ATR[] = {
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OptInputDef optInputs_ATR[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 1, 100000 }
+};
+static const TA_OutputDef outputs_ATR[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_ATR( const double optIn[] )
+{
+   return TA_ATR_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_ATR( int startIdx, int endIdx,
+                            const double *const inputs[], const double optIn[],
+                            int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 8 );
+   TA_INSTR_RETURN( TA_ATR( startIdx, endIdx, inputs[0], inputs[1], inputs[2], (int)optIn[0],
+                            outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_AVGDEV */
+static const TA_InputDef inputs_AVGDEV[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_AVGDEV[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_AVGDEV[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_AVGDEV( const double optIn[] )
+{
+   return TA_AVGDEV_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_AVGDEV( int startIdx, int endIdx,
+                               const double *const inputs[], const double optIn[],
+                               int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 9 );
+   TA_INSTR_RETURN( TA_AVGDEV( startIdx, endIdx, inputs[0], (int)optIn[0],
+                               outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_BBANDS */
+static const TA_InputDef inputs_BBANDS[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_BBANDS[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 },
+   { TA_OPTIN_REAL, "optInNbDevUp", TA_REAL_MIN, TA_REAL_MAX },
+   { TA_OPTIN_REAL, "optInNbDevDn", TA_REAL_MIN, TA_REAL_MAX },
+   { TA_OPTIN_MATYPE, "optInMAType", TA_MAType_SMA, TA_MAType_T3 }
+};
+static const TA_OutputDef outputs_BBANDS[] = {
+   { TA_OUTPUT_REAL, "outRealUpperBand" },
+   { TA_OUTPUT_REAL, "outRealMiddleBand" },
+   { TA_OUTPUT_REAL, "outRealLowerBand" }
+};
+
+static int lookback_BBANDS( const double optIn[] )
+{
+   return TA_BBANDS_Lookback( (int)optIn[0], optIn[1], optIn[2], (TA_MAType)(int)optIn[3] );
+}
+
+static TA_RetCode call_BBANDS( int startIdx, int endIdx,
+                               const double *const inputs[], const double optIn[],
+                               int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 10 );
+   TA_INSTR_RETURN( TA_BBANDS( startIdx, endIdx, inputs[0], (int)optIn[0], optIn[1], optIn[2], (TA_MAType)(int)optIn[3],
+                               outBegIdx, outNBElement, (double *)outputs[0], (double *)outputs[1], (double *)outputs[2] ) );
+}
+
+/* TA_BBDist */
+static const TA_InputDef inputs_BBDist[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_BBDist[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 },
+   { TA_OPTIN_REAL, "optInNbDev", TA_REAL_MIN, TA_REAL_MAX }
+};
+static const TA_OutputDef outputs_BBDist[] = {
+   { TA_OUTPUT_REAL, "outRealUDist" },
+   { TA_OUTPUT_REAL, "outRealLDist" }
+};
+
+static int lookback_BBDist( const double optIn[] )
+{
+   return TA_BBDist_Lookback( (int)optIn[0], optIn[1] );
+}
+
+static TA_RetCode call_BBDist( int startIdx, int endIdx,
+                               const double *const inputs[], const double optIn[],
+                               int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 11 );
+   TA_INSTR_RETURN( TA_BBDist( startIdx, endIdx, inputs[0], (int)optIn[0], optIn[1],
+                               outBegIdx, outNBElement, (double *)outputs[0], (double *)outputs[1] ) );
+}
+
+/* TA_BBWidth */
+static const TA_InputDef inputs_BBWidth[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_BBWidth[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 },
+   { TA_OPTIN_REAL, "optInNbDev", TA_REAL_MIN, TA_REAL_MAX }
+};
+static const TA_OutputDef outputs_BBWidth[] = {
+   { TA_OUTPUT_REAL, "outRealWidth" }
+};
+
+static int lookback_BBWidth( const double optIn[] )
+{
+   return TA_BBWidth_Lookback( (int)optIn[0], optIn[1] );
+}
+
+static TA_RetCode call_BBWidth( int startIdx, int endIdx,
+                                const double *const inputs[], const double optIn[],
+                                int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 12 );
+   TA_INSTR_RETURN( TA_BBWidth( startIdx, endIdx, inputs[0], (int)optIn[0], optIn[1],
+                                outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_BETA */
+static const TA_InputDef inputs_BETA[] = {
+   { TA_INPUT_REAL, "inReal0" },
+   { TA_INPUT_REAL, "inReal1" }
+};
+static const TA_OptInputDef optInputs_BETA[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 1, 100000 }
+};
+static const TA_OutputDef outputs_BETA[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_BETA( const double optIn[] )
+{
+   return TA_BETA_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_BETA( int startIdx, int endIdx,
+                             const double *const inputs[], const double optIn[],
+                             int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 13 );
+   TA_INSTR_RETURN( TA_BETA( startIdx, endIdx, inputs[0], inputs[1], (int)optIn[0],
+                             outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_BOP */
+static const TA_InputDef inputs_BOP[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_BOP[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_BOP( const double optIn[] )
+{
+   (void)optIn;
+   return TA_BOP_Lookback();
+}
+
+static TA_RetCode call_BOP( int startIdx, int endIdx,
+                            const double *const inputs[], const double optIn[],
+                            int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 14 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_BOP( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                            outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_Bias */
+static const TA_InputDef inputs_Bias[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_Bias[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod1", 1, 100000 },
+   { TA_OPTIN_INTEGER, "optInTimePeriod2", 1, 100000 },
+   { TA_OPTIN_INTEGER, "optInTimePeriod2Shift", 0, 100000 }
+};
+static const TA_OutputDef outputs_Bias[] = {
+   { TA_OUTPUT_REAL, "outPercent" }
+};
+
+static int lookback_Bias( const double optIn[] )
+{
+   return TA_Bias_Lookback( (int)optIn[0], (int)optIn[1], (int)optIn[2] );
+}
+
+static TA_RetCode call_Bias( int startIdx, int endIdx,
+                             const double *const inputs[], const double optIn[],
+                             int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 15 );
+   TA_INSTR_RETURN( TA_Bias( startIdx, endIdx, inputs[0], (int)optIn[0], (int)optIn[1], (int)optIn[2],
+                             outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_CCI */
+static const TA_InputDef inputs_CCI[] = {
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OptInputDef optInputs_CCI[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_CCI[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_CCI( const double optIn[] )
+{
+   return TA_CCI_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_CCI( int startIdx, int endIdx,
+                            const double *const inputs[], const double optIn[],
+                            int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 16 );
+   TA_INSTR_RETURN( TA_CCI( startIdx, endIdx, inputs[0], inputs[1], inputs[2], (int)optIn[0],
+                            outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_CDL2CROWS */
+static const TA_InputDef inputs_CDL2CROWS[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDL2CROWS[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDL2CROWS( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDL2CROWS_Lookback();
+}
+
+static TA_RetCode call_CDL2CROWS( int startIdx, int endIdx,
+                                  const double *const inputs[], const double optIn[],
+                                  int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 17 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDL2CROWS( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                  outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDL3BLACKCROWS */
+static const TA_InputDef inputs_CDL3BLACKCROWS[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDL3BLACKCROWS[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDL3BLACKCROWS( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDL3BLACKCROWS_Lookback();
+}
+
+static TA_RetCode call_CDL3BLACKCROWS( int startIdx, int endIdx,
+                                       const double *const inputs[], const double optIn[],
+                                       int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 18 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDL3BLACKCROWS( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                       outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDL3INSIDE */
+static const TA_InputDef inputs_CDL3INSIDE[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDL3INSIDE[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDL3INSIDE( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDL3INSIDE_Lookback();
+}
+
+static TA_RetCode call_CDL3INSIDE( int startIdx, int endIdx,
+                                   const double *const inputs[], const double optIn[],
+                                   int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 19 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDL3INSIDE( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                   outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDL3LINESTRIKE */
+static const TA_InputDef inputs_CDL3LINESTRIKE[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDL3LINESTRIKE[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDL3LINESTRIKE( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDL3LINESTRIKE_Lookback();
+}
+
+static TA_RetCode call_CDL3LINESTRIKE( int startIdx, int endIdx,
+                                       const double *const inputs[], const double optIn[],
+                                       int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 20 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDL3LINESTRIKE( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                       outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDL3OUTSIDE */
+static const TA_InputDef inputs_CDL3OUTSIDE[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDL3OUTSIDE[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDL3OUTSIDE( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDL3OUTSIDE_Lookback();
+}
+
+static TA_RetCode call_CDL3OUTSIDE( int startIdx, int endIdx,
+                                    const double *const inputs[], const double optIn[],
+                                    int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 21 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDL3OUTSIDE( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                    outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDL3STARSINSOUTH */
+static const TA_InputDef inputs_CDL3STARSINSOUTH[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDL3STARSINSOUTH[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDL3STARSINSOUTH( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDL3STARSINSOUTH_Lookback();
+}
+
+static TA_RetCode call_CDL3STARSINSOUTH( int startIdx, int endIdx,
+                                         const double *const inputs[], const double optIn[],
+                                         int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 22 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDL3STARSINSOUTH( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                         outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDL3WHITESOLDIERS */
+static const TA_InputDef inputs_CDL3WHITESOLDIERS[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDL3WHITESOLDIERS[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDL3WHITESOLDIERS( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDL3WHITESOLDIERS_Lookback();
+}
+
+static TA_RetCode call_CDL3WHITESOLDIERS( int startIdx, int endIdx,
+                                          const double *const inputs[], const double optIn[],
+                                          int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 23 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDL3WHITESOLDIERS( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                          outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLABANDONEDBABY */
+static const TA_InputDef inputs_CDLABANDONEDBABY[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OptInputDef optInputs_CDLABANDONEDBABY[] = {
+   { TA_OPTIN_REAL, "optInPenetration", 0, TA_REAL_MAX }
+};
+static const TA_OutputDef outputs_CDLABANDONEDBABY[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLABANDONEDBABY( const double optIn[] )
+{
+   return TA_CDLABANDONEDBABY_Lookback( optIn[0] );
+}
+
+static TA_RetCode call_CDLABANDONEDBABY( int startIdx, int endIdx,
+                                         const double *const inputs[], const double optIn[],
+                                         int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 24 );
+   TA_INSTR_RETURN( TA_CDLABANDONEDBABY( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3], optIn[0],
+                                         outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLADVANCEBLOCK */
+static const TA_InputDef inputs_CDLADVANCEBLOCK[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLADVANCEBLOCK[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLADVANCEBLOCK( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLADVANCEBLOCK_Lookback();
+}
+
+static TA_RetCode call_CDLADVANCEBLOCK( int startIdx, int endIdx,
+                                        const double *const inputs[], const double optIn[],
+                                        int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 25 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLADVANCEBLOCK( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                        outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLBELTHOLD */
+static const TA_InputDef inputs_CDLBELTHOLD[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLBELTHOLD[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLBELTHOLD( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLBELTHOLD_Lookback();
+}
+
+static TA_RetCode call_CDLBELTHOLD( int startIdx, int endIdx,
+                                    const double *const inputs[], const double optIn[],
+                                    int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 26 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLBELTHOLD( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                    outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLBREAKAWAY */
+static const TA_InputDef inputs_CDLBREAKAWAY[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLBREAKAWAY[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLBREAKAWAY( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLBREAKAWAY_Lookback();
+}
+
+static TA_RetCode call_CDLBREAKAWAY( int startIdx, int endIdx,
+                                     const double *const inputs[], const double optIn[],
+                                     int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 27 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLBREAKAWAY( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                     outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLCLOSINGMARUBOZU */
+static const TA_InputDef inputs_CDLCLOSINGMARUBOZU[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLCLOSINGMARUBOZU[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLCLOSINGMARUBOZU( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLCLOSINGMARUBOZU_Lookback();
+}
+
+static TA_RetCode call_CDLCLOSINGMARUBOZU( int startIdx, int endIdx,
+                                           const double *const inputs[], const double optIn[],
+                                           int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 28 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLCLOSINGMARUBOZU( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                           outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLCONCEALBABYSWALL */
+static const TA_InputDef inputs_CDLCONCEALBABYSWALL[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLCONCEALBABYSWALL[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLCONCEALBABYSWALL( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLCONCEALBABYSWALL_Lookback();
+}
+
+static TA_RetCode call_CDLCONCEALBABYSWALL( int startIdx, int endIdx,
+                                            const double *const inputs[], const double optIn[],
+                                            int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 29 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLCONCEALBABYSWALL( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                            outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLCOUNTERATTACK */
+static const TA_InputDef inputs_CDLCOUNTERATTACK[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLCOUNTERATTACK[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLCOUNTERATTACK( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLCOUNTERATTACK_Lookback();
+}
+
+static TA_RetCode call_CDLCOUNTERATTACK( int startIdx, int endIdx,
+                                         const double *const inputs[], const double optIn[],
+                                         int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 30 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLCOUNTERATTACK( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                         outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLDARKCLOUDCOVER */
+static const TA_InputDef inputs_CDLDARKCLOUDCOVER[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OptInputDef optInputs_CDLDARKCLOUDCOVER[] = {
+   { TA_OPTIN_REAL, "optInPenetration", 0, TA_REAL_MAX }
+};
+static const TA_OutputDef outputs_CDLDARKCLOUDCOVER[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLDARKCLOUDCOVER( const double optIn[] )
+{
+   return TA_CDLDARKCLOUDCOVER_Lookback( optIn[0] );
+}
+
+static TA_RetCode call_CDLDARKCLOUDCOVER( int startIdx, int endIdx,
+                                          const double *const inputs[], const double optIn[],
+                                          int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 31 );
+   TA_INSTR_RETURN( TA_CDLDARKCLOUDCOVER( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3], optIn[0],
+                                          outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLDOJI */
+static const TA_InputDef inputs_CDLDOJI[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLDOJI[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLDOJI( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLDOJI_Lookback();
+}
+
+static TA_RetCode call_CDLDOJI( int startIdx, int endIdx,
+                                const double *const inputs[], const double optIn[],
+                                int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 32 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLDOJI( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLDOJISTAR */
+static const TA_InputDef inputs_CDLDOJISTAR[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLDOJISTAR[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLDOJISTAR( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLDOJISTAR_Lookback();
+}
+
+static TA_RetCode call_CDLDOJISTAR( int startIdx, int endIdx,
+                                    const double *const inputs[], const double optIn[],
+                                    int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 33 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLDOJISTAR( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                    outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLDRAGONFLYDOJI */
+static const TA_InputDef inputs_CDLDRAGONFLYDOJI[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLDRAGONFLYDOJI[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLDRAGONFLYDOJI( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLDRAGONFLYDOJI_Lookback();
+}
+
+static TA_RetCode call_CDLDRAGONFLYDOJI( int startIdx, int endIdx,
+                                         const double *const inputs[], const double optIn[],
+                                         int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 34 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLDRAGONFLYDOJI( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                         outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLENGULFING */
+static const TA_InputDef inputs_CDLENGULFING[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLENGULFING[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLENGULFING( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLENGULFING_Lookback();
+}
+
+static TA_RetCode call_CDLENGULFING( int startIdx, int endIdx,
+                                     const double *const inputs[], const double optIn[],
+                                     int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 35 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLENGULFING( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                     outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLEVENINGDOJISTAR */
+static const TA_InputDef inputs_CDLEVENINGDOJISTAR[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OptInputDef optInputs_CDLEVENINGDOJISTAR[] = {
+   { TA_OPTIN_REAL, "optInPenetration", 0, TA_REAL_MAX }
+};
+static const TA_OutputDef outputs_CDLEVENINGDOJISTAR[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLEVENINGDOJISTAR( const double optIn[] )
+{
+   return TA_CDLEVENINGDOJISTAR_Lookback( optIn[0] );
+}
+
+static TA_RetCode call_CDLEVENINGDOJISTAR( int startIdx, int endIdx,
+                                           const double *const inputs[], const double optIn[],
+                                           int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 36 );
+   TA_INSTR_RETURN( TA_CDLEVENINGDOJISTAR( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3], optIn[0],
+                                           outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLEVENINGSTAR */
+static const TA_InputDef inputs_CDLEVENINGSTAR[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OptInputDef optInputs_CDLEVENINGSTAR[] = {
+   { TA_OPTIN_REAL, "optInPenetration", 0, TA_REAL_MAX }
+};
+static const TA_OutputDef outputs_CDLEVENINGSTAR[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLEVENINGSTAR( const double optIn[] )
+{
+   return TA_CDLEVENINGSTAR_Lookback( optIn[0] );
+}
+
+static TA_RetCode call_CDLEVENINGSTAR( int startIdx, int endIdx,
+                                       const double *const inputs[], const double optIn[],
+                                       int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 37 );
+   TA_INSTR_RETURN( TA_CDLEVENINGSTAR( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3], optIn[0],
+                                       outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLGAPSIDESIDEWHITE */
+static const TA_InputDef inputs_CDLGAPSIDESIDEWHITE[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLGAPSIDESIDEWHITE[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLGAPSIDESIDEWHITE( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLGAPSIDESIDEWHITE_Lookback();
+}
+
+static TA_RetCode call_CDLGAPSIDESIDEWHITE( int startIdx, int endIdx,
+                                            const double *const inputs[], const double optIn[],
+                                            int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 38 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLGAPSIDESIDEWHITE( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                            outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLGRAVESTONEDOJI */
+static const TA_InputDef inputs_CDLGRAVESTONEDOJI[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLGRAVESTONEDOJI[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLGRAVESTONEDOJI( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLGRAVESTONEDOJI_Lookback();
+}
+
+static TA_RetCode call_CDLGRAVESTONEDOJI( int startIdx, int endIdx,
+                                          const double *const inputs[], const double optIn[],
+                                          int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 39 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLGRAVESTONEDOJI( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                          outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLHAMMER */
+static const TA_InputDef inputs_CDLHAMMER[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLHAMMER[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLHAMMER( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLHAMMER_Lookback();
+}
+
+static TA_RetCode call_CDLHAMMER( int startIdx, int endIdx,
+                                  const double *const inputs[], const double optIn[],
+                                  int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 40 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLHAMMER( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                  outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLHANGINGMAN */
+static const TA_InputDef inputs_CDLHANGINGMAN[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLHANGINGMAN[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLHANGINGMAN( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLHANGINGMAN_Lookback();
+}
+
+static TA_RetCode call_CDLHANGINGMAN( int startIdx, int endIdx,
+                                      const double *const inputs[], const double optIn[],
+                                      int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 41 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLHANGINGMAN( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                      outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLHARAMI */
+static const TA_InputDef inputs_CDLHARAMI[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLHARAMI[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLHARAMI( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLHARAMI_Lookback();
+}
+
+static TA_RetCode call_CDLHARAMI( int startIdx, int endIdx,
+                                  const double *const inputs[], const double optIn[],
+                                  int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 42 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLHARAMI( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                  outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLHARAMICROSS */
+static const TA_InputDef inputs_CDLHARAMICROSS[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLHARAMICROSS[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLHARAMICROSS( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLHARAMICROSS_Lookback();
+}
+
+static TA_RetCode call_CDLHARAMICROSS( int startIdx, int endIdx,
+                                       const double *const inputs[], const double optIn[],
+                                       int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 43 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLHARAMICROSS( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                       outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLHIGHWAVE */
+static const TA_InputDef inputs_CDLHIGHWAVE[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLHIGHWAVE[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLHIGHWAVE( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLHIGHWAVE_Lookback();
+}
+
+static TA_RetCode call_CDLHIGHWAVE( int startIdx, int endIdx,
+                                    const double *const inputs[], const double optIn[],
+                                    int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 44 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLHIGHWAVE( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                    outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLHIKKAKE */
+static const TA_InputDef inputs_CDLHIKKAKE[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLHIKKAKE[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLHIKKAKE( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLHIKKAKE_Lookback();
+}
+
+static TA_RetCode call_CDLHIKKAKE( int startIdx, int endIdx,
+                                   const double *const inputs[], const double optIn[],
+                                   int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 45 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLHIKKAKE( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                   outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLHIKKAKEMOD */
+static const TA_InputDef inputs_CDLHIKKAKEMOD[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLHIKKAKEMOD[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLHIKKAKEMOD( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLHIKKAKEMOD_Lookback();
+}
+
+static TA_RetCode call_CDLHIKKAKEMOD( int startIdx, int endIdx,
+                                      const double *const inputs[], const double optIn[],
+                                      int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 46 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLHIKKAKEMOD( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                      outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLHOMINGPIGEON */
+static const TA_InputDef inputs_CDLHOMINGPIGEON[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLHOMINGPIGEON[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLHOMINGPIGEON( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLHOMINGPIGEON_Lookback();
+}
+
+static TA_RetCode call_CDLHOMINGPIGEON( int startIdx, int endIdx,
+                                        const double *const inputs[], const double optIn[],
+                                        int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 47 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLHOMINGPIGEON( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                        outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLIDENTICAL3CROWS */
+static const TA_InputDef inputs_CDLIDENTICAL3CROWS[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLIDENTICAL3CROWS[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLIDENTICAL3CROWS( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLIDENTICAL3CROWS_Lookback();
+}
+
+static TA_RetCode call_CDLIDENTICAL3CROWS( int startIdx, int endIdx,
+                                           const double *const inputs[], const double optIn[],
+                                           int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 48 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLIDENTICAL3CROWS( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                           outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLINNECK */
+static const TA_InputDef inputs_CDLINNECK[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLINNECK[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLINNECK( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLINNECK_Lookback();
+}
+
+static TA_RetCode call_CDLINNECK( int startIdx, int endIdx,
+                                  const double *const inputs[], const double optIn[],
+                                  int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 49 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLINNECK( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                  outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLINVERTEDHAMMER */
+static const TA_InputDef inputs_CDLINVERTEDHAMMER[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLINVERTEDHAMMER[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLINVERTEDHAMMER( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLINVERTEDHAMMER_Lookback();
+}
+
+static TA_RetCode call_CDLINVERTEDHAMMER( int startIdx, int endIdx,
+                                          const double *const inputs[], const double optIn[],
+                                          int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 50 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLINVERTEDHAMMER( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                          outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLKICKING */
+static const TA_InputDef inputs_CDLKICKING[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLKICKING[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLKICKING( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLKICKING_Lookback();
+}
+
+static TA_RetCode call_CDLKICKING( int startIdx, int endIdx,
+                                   const double *const inputs[], const double optIn[],
+                                   int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 51 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLKICKING( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                   outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLKICKINGBYLENGTH */
+static const TA_InputDef inputs_CDLKICKINGBYLENGTH[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLKICKINGBYLENGTH[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLKICKINGBYLENGTH( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLKICKINGBYLENGTH_Lookback();
+}
+
+static TA_RetCode call_CDLKICKINGBYLENGTH( int startIdx, int endIdx,
+                                           const double *const inputs[], const double optIn[],
+                                           int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 52 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLKICKINGBYLENGTH( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                           outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLLADDERBOTTOM */
+static const TA_InputDef inputs_CDLLADDERBOTTOM[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLLADDERBOTTOM[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLLADDERBOTTOM( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLLADDERBOTTOM_Lookback();
+}
+
+static TA_RetCode call_CDLLADDERBOTTOM( int startIdx, int endIdx,
+                                        const double *const inputs[], const double optIn[],
+                                        int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 53 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLLADDERBOTTOM( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                        outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLLONGLEGGEDDOJI */
+static const TA_InputDef inputs_CDLLONGLEGGEDDOJI[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLLONGLEGGEDDOJI[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLLONGLEGGEDDOJI( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLLONGLEGGEDDOJI_Lookback();
+}
+
+static TA_RetCode call_CDLLONGLEGGEDDOJI( int startIdx, int endIdx,
+                                          const double *const inputs[], const double optIn[],
+                                          int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 54 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLLONGLEGGEDDOJI( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                          outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLLONGLINE */
+static const TA_InputDef inputs_CDLLONGLINE[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLLONGLINE[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLLONGLINE( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLLONGLINE_Lookback();
+}
+
+static TA_RetCode call_CDLLONGLINE( int startIdx, int endIdx,
+                                    const double *const inputs[], const double optIn[],
+                                    int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 55 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLLONGLINE( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                    outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLMARUBOZU */
+static const TA_InputDef inputs_CDLMARUBOZU[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLMARUBOZU[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLMARUBOZU( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLMARUBOZU_Lookback();
+}
+
+static TA_RetCode call_CDLMARUBOZU( int startIdx, int endIdx,
+                                    const double *const inputs[], const double optIn[],
+                                    int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 56 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLMARUBOZU( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                    outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLMATCHINGLOW */
+static const TA_InputDef inputs_CDLMATCHINGLOW[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLMATCHINGLOW[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLMATCHINGLOW( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLMATCHINGLOW_Lookback();
+}
+
+static TA_RetCode call_CDLMATCHINGLOW( int startIdx, int endIdx,
+                                       const double *const inputs[], const double optIn[],
+                                       int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 57 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLMATCHINGLOW( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                       outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLMATHOLD */
+static const TA_InputDef inputs_CDLMATHOLD[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OptInputDef optInputs_CDLMATHOLD[] = {
+   { TA_OPTIN_REAL, "optInPenetration", 0, TA_REAL_MAX }
+};
+static const TA_OutputDef outputs_CDLMATHOLD[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLMATHOLD( const double optIn[] )
+{
+   return TA_CDLMATHOLD_Lookback( optIn[0] );
+}
+
+static TA_RetCode call_CDLMATHOLD( int startIdx, int endIdx,
+                                   const double *const inputs[], const double optIn[],
+                                   int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 58 );
+   TA_INSTR_RETURN( TA_CDLMATHOLD( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3], optIn[0],
+                                   outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLMORNINGDOJISTAR */
+static const TA_InputDef inputs_CDLMORNINGDOJISTAR[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OptInputDef optInputs_CDLMORNINGDOJISTAR[] = {
+   { TA_OPTIN_REAL, "optInPenetration", 0, TA_REAL_MAX }
+};
+static const TA_OutputDef outputs_CDLMORNINGDOJISTAR[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLMORNINGDOJISTAR( const double optIn[] )
+{
+   return TA_CDLMORNINGDOJISTAR_Lookback( optIn[0] );
+}
+
+static TA_RetCode call_CDLMORNINGDOJISTAR( int startIdx, int endIdx,
+                                           const double *const inputs[], const double optIn[],
+                                           int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 59 );
+   TA_INSTR_RETURN( TA_CDLMORNINGDOJISTAR( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3], optIn[0],
+                                           outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLMORNINGSTAR */
+static const TA_InputDef inputs_CDLMORNINGSTAR[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OptInputDef optInputs_CDLMORNINGSTAR[] = {
+   { TA_OPTIN_REAL, "optInPenetration", 0, TA_REAL_MAX }
+};
+static const TA_OutputDef outputs_CDLMORNINGSTAR[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLMORNINGSTAR( const double optIn[] )
+{
+   return TA_CDLMORNINGSTAR_Lookback( optIn[0] );
+}
+
+static TA_RetCode call_CDLMORNINGSTAR( int startIdx, int endIdx,
+                                       const double *const inputs[], const double optIn[],
+                                       int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 60 );
+   TA_INSTR_RETURN( TA_CDLMORNINGSTAR( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3], optIn[0],
+                                       outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLONNECK */
+static const TA_InputDef inputs_CDLONNECK[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLONNECK[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLONNECK( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLONNECK_Lookback();
+}
+
+static TA_RetCode call_CDLONNECK( int startIdx, int endIdx,
+                                  const double *const inputs[], const double optIn[],
+                                  int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 61 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLONNECK( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                  outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLPIERCING */
+static const TA_InputDef inputs_CDLPIERCING[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLPIERCING[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLPIERCING( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLPIERCING_Lookback();
+}
+
+static TA_RetCode call_CDLPIERCING( int startIdx, int endIdx,
+                                    const double *const inputs[], const double optIn[],
+                                    int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 62 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLPIERCING( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                    outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLRICKSHAWMAN */
+static const TA_InputDef inputs_CDLRICKSHAWMAN[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLRICKSHAWMAN[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLRICKSHAWMAN( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLRICKSHAWMAN_Lookback();
+}
+
+static TA_RetCode call_CDLRICKSHAWMAN( int startIdx, int endIdx,
+                                       const double *const inputs[], const double optIn[],
+                                       int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 63 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLRICKSHAWMAN( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                       outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLRISEFALL3METHODS */
+static const TA_InputDef inputs_CDLRISEFALL3METHODS[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLRISEFALL3METHODS[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLRISEFALL3METHODS( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLRISEFALL3METHODS_Lookback();
+}
+
+static TA_RetCode call_CDLRISEFALL3METHODS( int startIdx, int endIdx,
+                                            const double *const inputs[], const double optIn[],
+                                            int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 64 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLRISEFALL3METHODS( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                            outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLSEPARATINGLINES */
+static const TA_InputDef inputs_CDLSEPARATINGLINES[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLSEPARATINGLINES[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLSEPARATINGLINES( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLSEPARATINGLINES_Lookback();
+}
+
+static TA_RetCode call_CDLSEPARATINGLINES( int startIdx, int endIdx,
+                                           const double *const inputs[], const double optIn[],
+                                           int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 65 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLSEPARATINGLINES( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                           outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLSHOOTINGSTAR */
+static const TA_InputDef inputs_CDLSHOOTINGSTAR[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLSHOOTINGSTAR[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLSHOOTINGSTAR( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLSHOOTINGSTAR_Lookback();
+}
+
+static TA_RetCode call_CDLSHOOTINGSTAR( int startIdx, int endIdx,
+                                        const double *const inputs[], const double optIn[],
+                                        int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 66 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLSHOOTINGSTAR( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                        outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLSHORTLINE */
+static const TA_InputDef inputs_CDLSHORTLINE[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLSHORTLINE[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLSHORTLINE( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLSHORTLINE_Lookback();
+}
+
+static TA_RetCode call_CDLSHORTLINE( int startIdx, int endIdx,
+                                     const double *const inputs[], const double optIn[],
+                                     int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 67 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLSHORTLINE( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                     outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLSPINNINGTOP */
+static const TA_InputDef inputs_CDLSPINNINGTOP[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLSPINNINGTOP[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLSPINNINGTOP( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLSPINNINGTOP_Lookback();
+}
+
+static TA_RetCode call_CDLSPINNINGTOP( int startIdx, int endIdx,
+                                       const double *const inputs[], const double optIn[],
+                                       int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 68 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLSPINNINGTOP( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                       outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLSTALLEDPATTERN */
+static const TA_InputDef inputs_CDLSTALLEDPATTERN[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLSTALLEDPATTERN[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLSTALLEDPATTERN( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLSTALLEDPATTERN_Lookback();
+}
+
+static TA_RetCode call_CDLSTALLEDPATTERN( int startIdx, int endIdx,
+                                          const double *const inputs[], const double optIn[],
+                                          int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 69 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLSTALLEDPATTERN( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                          outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLSTICKSANDWICH */
+static const TA_InputDef inputs_CDLSTICKSANDWICH[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLSTICKSANDWICH[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLSTICKSANDWICH( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLSTICKSANDWICH_Lookback();
+}
+
+static TA_RetCode call_CDLSTICKSANDWICH( int startIdx, int endIdx,
+                                         const double *const inputs[], const double optIn[],
+                                         int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 70 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLSTICKSANDWICH( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                         outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLTAKURI */
+static const TA_InputDef inputs_CDLTAKURI[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLTAKURI[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLTAKURI( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLTAKURI_Lookback();
+}
+
+static TA_RetCode call_CDLTAKURI( int startIdx, int endIdx,
+                                  const double *const inputs[], const double optIn[],
+                                  int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 71 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLTAKURI( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                  outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLTASUKIGAP */
+static const TA_InputDef inputs_CDLTASUKIGAP[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLTASUKIGAP[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLTASUKIGAP( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLTASUKIGAP_Lookback();
+}
+
+static TA_RetCode call_CDLTASUKIGAP( int startIdx, int endIdx,
+                                     const double *const inputs[], const double optIn[],
+                                     int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 72 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLTASUKIGAP( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                     outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLTHRUSTING */
+static const TA_InputDef inputs_CDLTHRUSTING[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLTHRUSTING[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLTHRUSTING( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLTHRUSTING_Lookback();
+}
+
+static TA_RetCode call_CDLTHRUSTING( int startIdx, int endIdx,
+                                     const double *const inputs[], const double optIn[],
+                                     int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 73 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLTHRUSTING( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                     outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLTRISTAR */
+static const TA_InputDef inputs_CDLTRISTAR[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLTRISTAR[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLTRISTAR( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLTRISTAR_Lookback();
+}
+
+static TA_RetCode call_CDLTRISTAR( int startIdx, int endIdx,
+                                   const double *const inputs[], const double optIn[],
+                                   int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 74 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLTRISTAR( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                   outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLUNIQUE3RIVER */
+static const TA_InputDef inputs_CDLUNIQUE3RIVER[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLUNIQUE3RIVER[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLUNIQUE3RIVER( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLUNIQUE3RIVER_Lookback();
+}
+
+static TA_RetCode call_CDLUNIQUE3RIVER( int startIdx, int endIdx,
+                                        const double *const inputs[], const double optIn[],
+                                        int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 75 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLUNIQUE3RIVER( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                        outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLUPSIDEGAP2CROWS */
+static const TA_InputDef inputs_CDLUPSIDEGAP2CROWS[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLUPSIDEGAP2CROWS[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLUPSIDEGAP2CROWS( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLUPSIDEGAP2CROWS_Lookback();
+}
+
+static TA_RetCode call_CDLUPSIDEGAP2CROWS( int startIdx, int endIdx,
+                                           const double *const inputs[], const double optIn[],
+                                           int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 76 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLUPSIDEGAP2CROWS( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                           outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CDLXSIDEGAP3METHODS */
+static const TA_InputDef inputs_CDLXSIDEGAP3METHODS[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_CDLXSIDEGAP3METHODS[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_CDLXSIDEGAP3METHODS( const double optIn[] )
+{
+   (void)optIn;
+   return TA_CDLXSIDEGAP3METHODS_Lookback();
+}
+
+static TA_RetCode call_CDLXSIDEGAP3METHODS( int startIdx, int endIdx,
+                                            const double *const inputs[], const double optIn[],
+                                            int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 77 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_CDLXSIDEGAP3METHODS( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3],
+                                            outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_CMO */
+static const TA_InputDef inputs_CMO[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_CMO[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_CMO[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_CMO( const double optIn[] )
+{
+   return TA_CMO_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_CMO( int startIdx, int endIdx,
+                            const double *const inputs[], const double optIn[],
+                            int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 78 );
+   TA_INSTR_RETURN( TA_CMO( startIdx, endIdx, inputs[0], (int)optIn[0],
+                            outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_CORREL */
+static const TA_InputDef inputs_CORREL[] = {
+   { TA_INPUT_REAL, "inReal0" },
+   { TA_INPUT_REAL, "inReal1" }
+};
+static const TA_OptInputDef optInputs_CORREL[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 1, 100000 }
+};
+static const TA_OutputDef outputs_CORREL[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_CORREL( const double optIn[] )
+{
+   return TA_CORREL_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_CORREL( int startIdx, int endIdx,
+                               const double *const inputs[], const double optIn[],
+                               int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 79 );
+   TA_INSTR_RETURN( TA_CORREL( startIdx, endIdx, inputs[0], inputs[1], (int)optIn[0],
+                               outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_DEMA */
+static const TA_InputDef inputs_DEMA[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_DEMA[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_DEMA[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_DEMA( const double optIn[] )
+{
+   return TA_DEMA_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_DEMA( int startIdx, int endIdx,
+                             const double *const inputs[], const double optIn[],
+                             int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 80 );
+   TA_INSTR_RETURN( TA_DEMA( startIdx, endIdx, inputs[0], (int)optIn[0],
+                             outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_DX */
+static const TA_InputDef inputs_DX[] = {
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OptInputDef optInputs_DX[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_DX[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_DX( const double optIn[] )
+{
+   return TA_DX_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_DX( int startIdx, int endIdx,
+                           const double *const inputs[], const double optIn[],
+                           int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 81 );
+   TA_INSTR_RETURN( TA_DX( startIdx, endIdx, inputs[0], inputs[1], inputs[2], (int)optIn[0],
+                           outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_EMA */
+static const TA_InputDef inputs_EMA[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_EMA[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_EMA[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_EMA( const double optIn[] )
+{
+   return TA_EMA_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_EMA( int startIdx, int endIdx,
+                            const double *const inputs[], const double optIn[],
+                            int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 82 );
+   TA_INSTR_RETURN( TA_EMA( startIdx, endIdx, inputs[0], (int)optIn[0],
+                            outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_HT_DCPERIOD */
+static const TA_InputDef inputs_HT_DCPERIOD[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OutputDef outputs_HT_DCPERIOD[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_HT_DCPERIOD( const double optIn[] )
+{
+   (void)optIn;
+   return TA_HT_DCPERIOD_Lookback();
+}
+
+static TA_RetCode call_HT_DCPERIOD( int startIdx, int endIdx,
+                                    const double *const inputs[], const double optIn[],
+                                    int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 83 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_HT_DCPERIOD( startIdx, endIdx, inputs[0],
+                                    outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_HT_DCPHASE */
+static const TA_InputDef inputs_HT_DCPHASE[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OutputDef outputs_HT_DCPHASE[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_HT_DCPHASE( const double optIn[] )
+{
+   (void)optIn;
+   return TA_HT_DCPHASE_Lookback();
+}
+
+static TA_RetCode call_HT_DCPHASE( int startIdx, int endIdx,
+                                   const double *const inputs[], const double optIn[],
+                                   int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 84 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_HT_DCPHASE( startIdx, endIdx, inputs[0],
+                                   outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_HT_PHASOR */
+static const TA_InputDef inputs_HT_PHASOR[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OutputDef outputs_HT_PHASOR[] = {
+   { TA_OUTPUT_REAL, "outInPhase" },
+   { TA_OUTPUT_REAL, "outQuadrature" }
+};
+
+static int lookback_HT_PHASOR( const double optIn[] )
+{
+   (void)optIn;
+   return TA_HT_PHASOR_Lookback();
+}
+
+static TA_RetCode call_HT_PHASOR( int startIdx, int endIdx,
+                                  const double *const inputs[], const double optIn[],
+                                  int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 85 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_HT_PHASOR( startIdx, endIdx, inputs[0],
+                                  outBegIdx, outNBElement, (double *)outputs[0], (double *)outputs[1] ) );
+}
+
+/* TA_HT_SINE */
+static const TA_InputDef inputs_HT_SINE[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OutputDef outputs_HT_SINE[] = {
+   { TA_OUTPUT_REAL, "outSine" },
+   { TA_OUTPUT_REAL, "outLeadSine" }
+};
+
+static int lookback_HT_SINE( const double optIn[] )
+{
+   (void)optIn;
+   return TA_HT_SINE_Lookback();
+}
+
+static TA_RetCode call_HT_SINE( int startIdx, int endIdx,
+                                const double *const inputs[], const double optIn[],
+                                int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 86 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_HT_SINE( startIdx, endIdx, inputs[0],
+                                outBegIdx, outNBElement, (double *)outputs[0], (double *)outputs[1] ) );
+}
+
+/* TA_HT_TRENDLINE */
+static const TA_InputDef inputs_HT_TRENDLINE[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OutputDef outputs_HT_TRENDLINE[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_HT_TRENDLINE( const double optIn[] )
+{
+   (void)optIn;
+   return TA_HT_TRENDLINE_Lookback();
+}
+
+static TA_RetCode call_HT_TRENDLINE( int startIdx, int endIdx,
+                                     const double *const inputs[], const double optIn[],
+                                     int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 87 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_HT_TRENDLINE( startIdx, endIdx, inputs[0],
+                                     outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_HT_TRENDMODE */
+static const TA_InputDef inputs_HT_TRENDMODE[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OutputDef outputs_HT_TRENDMODE[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_HT_TRENDMODE( const double optIn[] )
+{
+   (void)optIn;
+   return TA_HT_TRENDMODE_Lookback();
+}
+
+static TA_RetCode call_HT_TRENDMODE( int startIdx, int endIdx,
+                                     const double *const inputs[], const double optIn[],
+                                     int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 88 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_HT_TRENDMODE( startIdx, endIdx, inputs[0],
+                                     outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_IMI */
+static const TA_InputDef inputs_IMI[] = {
+   { TA_INPUT_OPEN, "inOpen" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OptInputDef optInputs_IMI[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_IMI[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_IMI( const double optIn[] )
+{
+   return TA_IMI_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_IMI( int startIdx, int endIdx,
+                            const double *const inputs[], const double optIn[],
+                            int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 89 );
+   TA_INSTR_RETURN( TA_IMI( startIdx, endIdx, inputs[0], inputs[1], (int)optIn[0],
+                            outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_KAMA */
+static const TA_InputDef inputs_KAMA[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_KAMA[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_KAMA[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_KAMA( const double optIn[] )
+{
+   return TA_KAMA_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_KAMA( int startIdx, int endIdx,
+                             const double *const inputs[], const double optIn[],
+                             int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 90 );
+   TA_INSTR_RETURN( TA_KAMA( startIdx, endIdx, inputs[0], (int)optIn[0],
+                             outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_KURT */
+static const TA_InputDef inputs_KURT[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_KURT[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_KURT[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_KURT( const double optIn[] )
+{
+   return TA_KURT_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_KURT( int startIdx, int endIdx,
+                             const double *const inputs[], const double optIn[],
+                             int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 91 );
+   TA_INSTR_RETURN( TA_KURT( startIdx, endIdx, inputs[0], (int)optIn[0],
+                             outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_LINEARREG */
+static const TA_InputDef inputs_LINEARREG[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_LINEARREG[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_LINEARREG[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_LINEARREG( const double optIn[] )
+{
+   return TA_LINEARREG_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_LINEARREG( int startIdx, int endIdx,
+                                  const double *const inputs[], const double optIn[],
+                                  int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 92 );
+   TA_INSTR_RETURN( TA_LINEARREG( startIdx, endIdx, inputs[0], (int)optIn[0],
+                                  outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_LINEARREG_ANGLE */
+static const TA_InputDef inputs_LINEARREG_ANGLE[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_LINEARREG_ANGLE[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_LINEARREG_ANGLE[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_LINEARREG_ANGLE( const double optIn[] )
+{
+   return TA_LINEARREG_ANGLE_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_LINEARREG_ANGLE( int startIdx, int endIdx,
+                                        const double *const inputs[], const double optIn[],
+                                        int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 93 );
+   TA_INSTR_RETURN( TA_LINEARREG_ANGLE( startIdx, endIdx, inputs[0], (int)optIn[0],
+                                        outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_LINEARREG_INTERCEPT */
+static const TA_InputDef inputs_LINEARREG_INTERCEPT[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_LINEARREG_INTERCEPT[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_LINEARREG_INTERCEPT[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_LINEARREG_INTERCEPT( const double optIn[] )
+{
+   return TA_LINEARREG_INTERCEPT_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_LINEARREG_INTERCEPT( int startIdx, int endIdx,
+                                            const double *const inputs[], const double optIn[],
+                                            int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 94 );
+   TA_INSTR_RETURN( TA_LINEARREG_INTERCEPT( startIdx, endIdx, inputs[0], (int)optIn[0],
+                                            outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_LINEARREG_SLOPE */
+static const TA_InputDef inputs_LINEARREG_SLOPE[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_LINEARREG_SLOPE[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_LINEARREG_SLOPE[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_LINEARREG_SLOPE( const double optIn[] )
+{
+   return TA_LINEARREG_SLOPE_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_LINEARREG_SLOPE( int startIdx, int endIdx,
+                                        const double *const inputs[], const double optIn[],
+                                        int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 95 );
+   TA_INSTR_RETURN( TA_LINEARREG_SLOPE( startIdx, endIdx, inputs[0], (int)optIn[0],
+                                        outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_MA */
+static const TA_InputDef inputs_MA[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_MA[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 1, 100000 },
+   { TA_OPTIN_MATYPE, "optInMAType", TA_MAType_SMA, TA_MAType_T3 }
+};
+static const TA_OutputDef outputs_MA[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_MA( const double optIn[] )
+{
+   return TA_MA_Lookback( (int)optIn[0], (TA_MAType)(int)optIn[1] );
+}
+
+static TA_RetCode call_MA( int startIdx, int endIdx,
+                           const double *const inputs[], const double optIn[],
+                           int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 96 );
+   TA_INSTR_RETURN( TA_MA( startIdx, endIdx, inputs[0], (int)optIn[0], (TA_MAType)(int)optIn[1],
+                           outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_MACD */
+static const TA_InputDef inputs_MACD[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_MACD[] = {
+   { TA_OPTIN_INTEGER, "optInFastPeriod", 2, 100000 },
+   { TA_OPTIN_INTEGER, "optInSlowPeriod", 2, 100000 },
+   { TA_OPTIN_INTEGER, "optInSignalPeriod", 1, 100000 }
+};
+static const TA_OutputDef outputs_MACD[] = {
+   { TA_OUTPUT_REAL, "outMACD" },
+   { TA_OUTPUT_REAL, "outMACDSignal" },
+   { TA_OUTPUT_REAL, "outMACDHist" }
+};
+
+static int lookback_MACD( const double optIn[] )
+{
+   return TA_MACD_Lookback( (int)optIn[0], (int)optIn[1], (int)optIn[2] );
+}
+
+static TA_RetCode call_MACD( int startIdx, int endIdx,
+                             const double *const inputs[], const double optIn[],
+                             int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 97 );
+   TA_INSTR_RETURN( TA_MACD( startIdx, endIdx, inputs[0], (int)optIn[0], (int)optIn[1], (int)optIn[2],
+                             outBegIdx, outNBElement, (double *)outputs[0], (double *)outputs[1], (double *)outputs[2] ) );
+}
+
+/* TA_MACDEXT */
+static const TA_InputDef inputs_MACDEXT[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_MACDEXT[] = {
+   { TA_OPTIN_INTEGER, "optInFastPeriod", 2, 100000 },
+   { TA_OPTIN_MATYPE, "optInFastMAType", TA_MAType_SMA, TA_MAType_T3 },
+   { TA_OPTIN_INTEGER, "optInSlowPeriod", 2, 100000 },
+   { TA_OPTIN_MATYPE, "optInSlowMAType", TA_MAType_SMA, TA_MAType_T3 },
+   { TA_OPTIN_INTEGER, "optInSignalPeriod", 1, 100000 },
+   { TA_OPTIN_MATYPE, "optInSignalMAType", TA_MAType_SMA, TA_MAType_T3 }
+};
+static const TA_OutputDef outputs_MACDEXT[] = {
+   { TA_OUTPUT_REAL, "outMACD" },
+   { TA_OUTPUT_REAL, "outMACDSignal" },
+   { TA_OUTPUT_REAL, "outMACDHist" }
+};
+
+static int lookback_MACDEXT( const double optIn[] )
+{
+   return TA_MACDEXT_Lookback( (int)optIn[0], (TA_MAType)(int)optIn[1], (int)optIn[2], (TA_MAType)(int)optIn[3], (int)optIn[4], (TA_MAType)(int)optIn[5] );
+}
+
+static TA_RetCode call_MACDEXT( int startIdx, int endIdx,
+                                const double *const inputs[], const double optIn[],
+                                int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 98 );
+   TA_INSTR_RETURN( TA_MACDEXT( startIdx, endIdx, inputs[0], (int)optIn[0], (TA_MAType)(int)optIn[1], (int)optIn[2], (TA_MAType)(int)optIn[3], (int)optIn[4], (TA_MAType)(int)optIn[5],
+                                outBegIdx, outNBElement, (double *)outputs[0], (double *)outputs[1], (double *)outputs[2] ) );
+}
+
+/* TA_MACDFIX */
+static const TA_InputDef inputs_MACDFIX[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_MACDFIX[] = {
+   { TA_OPTIN_INTEGER, "optInSignalPeriod", 1, 100000 }
+};
+static const TA_OutputDef outputs_MACDFIX[] = {
+   { TA_OUTPUT_REAL, "outMACD" },
+   { TA_OUTPUT_REAL, "outMACDSignal" },
+   { TA_OUTPUT_REAL, "outMACDHist" }
+};
+
+static int lookback_MACDFIX( const double optIn[] )
+{
+   return TA_MACDFIX_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_MACDFIX( int startIdx, int endIdx,
+                                const double *const inputs[], const double optIn[],
+                                int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 99 );
+   TA_INSTR_RETURN( TA_MACDFIX( startIdx, endIdx, inputs[0], (int)optIn[0],
+                                outBegIdx, outNBElement, (double *)outputs[0], (double *)outputs[1], (double *)outputs[2] ) );
+}
+
+/* TA_MAMA */
+static const TA_InputDef inputs_MAMA[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_MAMA[] = {
+   { TA_OPTIN_REAL, "optInFastLimit", 0.01, 0.99 },
+   { TA_OPTIN_REAL, "optInSlowLimit", 0.01, 0.99 }
+};
+static const TA_OutputDef outputs_MAMA[] = {
+   { TA_OUTPUT_REAL, "outMAMA" },
+   { TA_OUTPUT_REAL, "outFAMA" }
+};
+
+static int lookback_MAMA( const double optIn[] )
+{
+   return TA_MAMA_Lookback( optIn[0], optIn[1] );
+}
+
+static TA_RetCode call_MAMA( int startIdx, int endIdx,
+                             const double *const inputs[], const double optIn[],
+                             int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 100 );
+   TA_INSTR_RETURN( TA_MAMA( startIdx, endIdx, inputs[0], optIn[0], optIn[1],
+                             outBegIdx, outNBElement, (double *)outputs[0], (double *)outputs[1] ) );
+}
+
+/* TA_MAVP */
+static const TA_InputDef inputs_MAVP[] = {
+   { TA_INPUT_REAL, "inReal" },
+   { TA_INPUT_REAL, "inPeriods" }
+};
+static const TA_OptInputDef optInputs_MAVP[] = {
+   { TA_OPTIN_INTEGER, "optInMinPeriod", 2, 100000 },
+   { TA_OPTIN_INTEGER, "optInMaxPeriod", 2, 100000 },
+   { TA_OPTIN_MATYPE, "optInMAType", TA_MAType_SMA, TA_MAType_T3 }
+};
+static const TA_OutputDef outputs_MAVP[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_MAVP( const double optIn[] )
+{
+   return TA_MAVP_Lookback( (int)optIn[0], (int)optIn[1], (TA_MAType)(int)optIn[2] );
+}
+
+static TA_RetCode call_MAVP( int startIdx, int endIdx,
+                             const double *const inputs[], const double optIn[],
+                             int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 101 );
+   TA_INSTR_RETURN( TA_MAVP( startIdx, endIdx, inputs[0], inputs[1], (int)optIn[0], (int)optIn[1], (TA_MAType)(int)optIn[2],
+                             outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_MAX */
+static const TA_InputDef inputs_MAX[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_MAX[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_MAX[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_MAX( const double optIn[] )
+{
+   return TA_MAX_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_MAX( int startIdx, int endIdx,
+                            const double *const inputs[], const double optIn[],
+                            int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 102 );
+   TA_INSTR_RETURN( TA_MAX( startIdx, endIdx, inputs[0], (int)optIn[0],
+                            outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_MAXINDEX */
+static const TA_InputDef inputs_MAXINDEX[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_MAXINDEX[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_MAXINDEX[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_MAXINDEX( const double optIn[] )
+{
+   return TA_MAXINDEX_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_MAXINDEX( int startIdx, int endIdx,
+                                 const double *const inputs[], const double optIn[],
+                                 int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 103 );
+   TA_INSTR_RETURN( TA_MAXINDEX( startIdx, endIdx, inputs[0], (int)optIn[0],
+                                 outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_MEDIAN */
+static const TA_InputDef inputs_MEDIAN[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_MEDIAN[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_MEDIAN[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_MEDIAN( const double optIn[] )
+{
+   return TA_MEDIAN_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_MEDIAN( int startIdx, int endIdx,
+                               const double *const inputs[], const double optIn[],
+                               int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 104 );
+   TA_INSTR_RETURN( TA_MEDIAN( startIdx, endIdx, inputs[0], (int)optIn[0],
+                               outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_MEDPRICE */
+static const TA_InputDef inputs_MEDPRICE[] = {
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" }
+};
+static const TA_OutputDef outputs_MEDPRICE[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_MEDPRICE( const double optIn[] )
+{
+   (void)optIn;
+   return TA_MEDPRICE_Lookback();
+}
+
+static TA_RetCode call_MEDPRICE( int startIdx, int endIdx,
+                                 const double *const inputs[], const double optIn[],
+                                 int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 105 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_MEDPRICE( startIdx, endIdx, inputs[0], inputs[1],
+                                 outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_MFI */
+static const TA_InputDef inputs_MFI[] = {
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" },
+   { TA_INPUT_VOLUME, "inVolume" }
+};
+static const TA_OptInputDef optInputs_MFI[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_MFI[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_MFI( const double optIn[] )
+{
+   return TA_MFI_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_MFI( int startIdx, int endIdx,
+                            const double *const inputs[], const double optIn[],
+                            int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 106 );
+   TA_INSTR_RETURN( TA_MFI( startIdx, endIdx, inputs[0], inputs[1], inputs[2], inputs[3], (int)optIn[0],
+                            outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_MIDPOINT */
+static const TA_InputDef inputs_MIDPOINT[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_MIDPOINT[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_MIDPOINT[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_MIDPOINT( const double optIn[] )
+{
+   return TA_MIDPOINT_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_MIDPOINT( int startIdx, int endIdx,
+                                 const double *const inputs[], const double optIn[],
+                                 int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 107 );
+   TA_INSTR_RETURN( TA_MIDPOINT( startIdx, endIdx, inputs[0], (int)optIn[0],
+                                 outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_MIDPRICE */
+static const TA_InputDef inputs_MIDPRICE[] = {
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" }
+};
+static const TA_OptInputDef optInputs_MIDPRICE[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_MIDPRICE[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_MIDPRICE( const double optIn[] )
+{
+   return TA_MIDPRICE_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_MIDPRICE( int startIdx, int endIdx,
+                                 const double *const inputs[], const double optIn[],
+                                 int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 108 );
+   TA_INSTR_RETURN( TA_MIDPRICE( startIdx, endIdx, inputs[0], inputs[1], (int)optIn[0],
+                                 outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_MIN */
+static const TA_InputDef inputs_MIN[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_MIN[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_MIN[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_MIN( const double optIn[] )
+{
+   return TA_MIN_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_MIN( int startIdx, int endIdx,
+                            const double *const inputs[], const double optIn[],
+                            int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 109 );
+   TA_INSTR_RETURN( TA_MIN( startIdx, endIdx, inputs[0], (int)optIn[0],
+                            outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_MININDEX */
+static const TA_InputDef inputs_MININDEX[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_MININDEX[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_MININDEX[] = {
+   { TA_OUTPUT_INTEGER, "outInteger" }
+};
+
+static int lookback_MININDEX( const double optIn[] )
+{
+   return TA_MININDEX_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_MININDEX( int startIdx, int endIdx,
+                                 const double *const inputs[], const double optIn[],
+                                 int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 110 );
+   TA_INSTR_RETURN( TA_MININDEX( startIdx, endIdx, inputs[0], (int)optIn[0],
+                                 outBegIdx, outNBElement, (int *)outputs[0] ) );
+}
+
+/* TA_MINMAX */
+static const TA_InputDef inputs_MINMAX[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_MINMAX[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_MINMAX[] = {
+   { TA_OUTPUT_REAL, "outMin" },
+   { TA_OUTPUT_REAL, "outMax" }
+};
+
+static int lookback_MINMAX( const double optIn[] )
+{
+   return TA_MINMAX_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_MINMAX( int startIdx, int endIdx,
+                               const double *const inputs[], const double optIn[],
+                               int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 111 );
+   TA_INSTR_RETURN( TA_MINMAX( startIdx, endIdx, inputs[0], (int)optIn[0],
+                               outBegIdx, outNBElement, (double *)outputs[0], (double *)outputs[1] ) );
+}
+
+/* TA_MINMAXINDEX */
+static const TA_InputDef inputs_MINMAXINDEX[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_MINMAXINDEX[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_MINMAXINDEX[] = {
+   { TA_OUTPUT_INTEGER, "outMinIdx" },
+   { TA_OUTPUT_INTEGER, "outMaxIdx" }
+};
+
+static int lookback_MINMAXINDEX( const double optIn[] )
+{
+   return TA_MINMAXINDEX_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_MINMAXINDEX( int startIdx, int endIdx,
+                                    const double *const inputs[], const double optIn[],
+                                    int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 112 );
+   TA_INSTR_RETURN( TA_MINMAXINDEX( startIdx, endIdx, inputs[0], (int)optIn[0],
+                                    outBegIdx, outNBElement, (int *)outputs[0], (int *)outputs[1] ) );
+}
+
+/* TA_MINUS_DI */
+static const TA_InputDef inputs_MINUS_DI[] = {
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OptInputDef optInputs_MINUS_DI[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 1, 100000 }
+};
+static const TA_OutputDef outputs_MINUS_DI[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_MINUS_DI( const double optIn[] )
+{
+   return TA_MINUS_DI_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_MINUS_DI( int startIdx, int endIdx,
+                                 const double *const inputs[], const double optIn[],
+                                 int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 113 );
+   TA_INSTR_RETURN( TA_MINUS_DI( startIdx, endIdx, inputs[0], inputs[1], inputs[2], (int)optIn[0],
+                                 outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_MINUS_DM */
+static const TA_InputDef inputs_MINUS_DM[] = {
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" }
+};
+static const TA_OptInputDef optInputs_MINUS_DM[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 1, 100000 }
+};
+static const TA_OutputDef outputs_MINUS_DM[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_MINUS_DM( const double optIn[] )
+{
+   return TA_MINUS_DM_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_MINUS_DM( int startIdx, int endIdx,
+                                 const double *const inputs[], const double optIn[],
+                                 int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 114 );
+   TA_INSTR_RETURN( TA_MINUS_DM( startIdx, endIdx, inputs[0], inputs[1], (int)optIn[0],
+                                 outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_MOM */
+static const TA_InputDef inputs_MOM[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_MOM[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 1, 100000 }
+};
+static const TA_OutputDef outputs_MOM[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_MOM( const double optIn[] )
+{
+   return TA_MOM_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_MOM( int startIdx, int endIdx,
+                            const double *const inputs[], const double optIn[],
+                            int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 115 );
+   TA_INSTR_RETURN( TA_MOM( startIdx, endIdx, inputs[0], (int)optIn[0],
+                            outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_MOMENTS */
+static const TA_InputDef inputs_MOMENTS[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_MOMENTS[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_MOMENTS[] = {
+   { TA_OUTPUT_REAL, "outMean" },
+   { TA_OUTPUT_REAL, "outVar" },
+   { TA_OUTPUT_REAL, "outStdDev" },
+   { TA_OUTPUT_REAL, "outSkew" },
+   { TA_OUTPUT_REAL, "outKurt" },
+   { TA_OUTPUT_REAL, "outZScore" }
+};
+
+static int lookback_MOMENTS( const double optIn[] )
+{
+   return TA_MOMENTS_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_MOMENTS( int startIdx, int endIdx,
+                                const double *const inputs[], const double optIn[],
+                                int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 116 );
+   TA_INSTR_RETURN( TA_MOMENTS( startIdx, endIdx, inputs[0], (int)optIn[0],
+                                outBegIdx, outNBElement, (double *)outputs[0], (double *)outputs[1], (double *)outputs[2], (double *)outputs[3], (double *)outputs[4], (double *)outputs[5] ) );
+}
+
+/* TA_NATR */
+static const TA_InputDef inputs_NATR[] = {
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OptInputDef optInputs_NATR[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 1, 100000 }
+};
+static const TA_OutputDef outputs_NATR[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_NATR( const double optIn[] )
+{
+   return TA_NATR_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_NATR( int startIdx, int endIdx,
+                             const double *const inputs[], const double optIn[],
+                             int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 117 );
+   TA_INSTR_RETURN( TA_NATR( startIdx, endIdx, inputs[0], inputs[1], inputs[2], (int)optIn[0],
+                             outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_OBV */
+static const TA_InputDef inputs_OBV[] = {
+   { TA_INPUT_REAL, "inReal" },
+   { TA_INPUT_VOLUME, "inVolume" }
+};
+static const TA_OutputDef outputs_OBV[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_OBV( const double optIn[] )
+{
+   (void)optIn;
+   return TA_OBV_Lookback();
+}
+
+static TA_RetCode call_OBV( int startIdx, int endIdx,
+                            const double *const inputs[], const double optIn[],
+                            int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 118 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_OBV( startIdx, endIdx, inputs[0], inputs[1],
+                            outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_PCTRANK */
+static const TA_InputDef inputs_PCTRANK[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_PCTRANK[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_PCTRANK[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_PCTRANK( const double optIn[] )
+{
+   return TA_PCTRANK_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_PCTRANK( int startIdx, int endIdx,
+                                const double *const inputs[], const double optIn[],
+                                int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 119 );
+   TA_INSTR_RETURN( TA_PCTRANK( startIdx, endIdx, inputs[0], (int)optIn[0],
+                                outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_PLUS_DI */
+static const TA_InputDef inputs_PLUS_DI[] = {
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OptInputDef optInputs_PLUS_DI[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 1, 100000 }
+};
+static const TA_OutputDef outputs_PLUS_DI[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_PLUS_DI( const double optIn[] )
+{
+   return TA_PLUS_DI_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_PLUS_DI( int startIdx, int endIdx,
+                                const double *const inputs[], const double optIn[],
+                                int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 120 );
+   TA_INSTR_RETURN( TA_PLUS_DI( startIdx, endIdx, inputs[0], inputs[1], inputs[2], (int)optIn[0],
+                                outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_PLUS_DM */
+static const TA_InputDef inputs_PLUS_DM[] = {
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" }
+};
+static const TA_OptInputDef optInputs_PLUS_DM[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 1, 100000 }
+};
+static const TA_OutputDef outputs_PLUS_DM[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_PLUS_DM( const double optIn[] )
+{
+   return TA_PLUS_DM_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_PLUS_DM( int startIdx, int endIdx,
+                                const double *const inputs[], const double optIn[],
+                                int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 121 );
+   TA_INSTR_RETURN( TA_PLUS_DM( startIdx, endIdx, inputs[0], inputs[1], (int)optIn[0],
+                                outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_PPO */
+static const TA_InputDef inputs_PPO[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_PPO[] = {
+   { TA_OPTIN_INTEGER, "optInFastPeriod", 2, 100000 },
+   { TA_OPTIN_INTEGER, "optInSlowPeriod", 2, 100000 },
+   { TA_OPTIN_MATYPE, "optInMAType", TA_MAType_SMA, TA_MAType_T3 }
+};
+static const TA_OutputDef outputs_PPO[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_PPO( const double optIn[] )
+{
+   return TA_PPO_Lookback( (int)optIn[0], (int)optIn[1], (TA_MAType)(int)optIn[2] );
+}
+
+static TA_RetCode call_PPO( int startIdx, int endIdx,
+                            const double *const inputs[], const double optIn[],
+                            int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 122 );
+   TA_INSTR_RETURN( TA_PPO( startIdx, endIdx, inputs[0], (int)optIn[0], (int)optIn[1], (TA_MAType)(int)optIn[2],
+                            outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_QUANTILE */
+static const TA_InputDef inputs_QUANTILE[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_QUANTILE[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 },
+   { TA_OPTIN_REAL, "optInQuantile", 0, 1 }
+};
+static const TA_OutputDef outputs_QUANTILE[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_QUANTILE( const double optIn[] )
+{
+   return TA_QUANTILE_Lookback( (int)optIn[0], optIn[1] );
+}
+
+static TA_RetCode call_QUANTILE( int startIdx, int endIdx,
+                                 const double *const inputs[], const double optIn[],
+                                 int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 123 );
+   TA_INSTR_RETURN( TA_QUANTILE( startIdx, endIdx, inputs[0], (int)optIn[0], optIn[1],
+                                 outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_ROC */
+static const TA_InputDef inputs_ROC[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_ROC[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 1, 100000 }
+};
+static const TA_OutputDef outputs_ROC[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_ROC( const double optIn[] )
+{
+   return TA_ROC_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_ROC( int startIdx, int endIdx,
+                            const double *const inputs[], const double optIn[],
+                            int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 124 );
+   TA_INSTR_RETURN( TA_ROC( startIdx, endIdx, inputs[0], (int)optIn[0],
+                            outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_ROCP */
+static const TA_InputDef inputs_ROCP[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_ROCP[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 1, 100000 }
+};
+static const TA_OutputDef outputs_ROCP[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_ROCP( const double optIn[] )
+{
+   return TA_ROCP_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_ROCP( int startIdx, int endIdx,
+                             const double *const inputs[], const double optIn[],
+                             int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 125 );
+   TA_INSTR_RETURN( TA_ROCP( startIdx, endIdx, inputs[0], (int)optIn[0],
+                             outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_ROCR */
+static const TA_InputDef inputs_ROCR[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_ROCR[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 1, 100000 }
+};
+static const TA_OutputDef outputs_ROCR[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_ROCR( const double optIn[] )
+{
+   return TA_ROCR_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_ROCR( int startIdx, int endIdx,
+                             const double *const inputs[], const double optIn[],
+                             int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 126 );
+   TA_INSTR_RETURN( TA_ROCR( startIdx, endIdx, inputs[0], (int)optIn[0],
+                             outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_ROCR100 */
+static const TA_InputDef inputs_ROCR100[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_ROCR100[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 1, 100000 }
+};
+static const TA_OutputDef outputs_ROCR100[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_ROCR100( const double optIn[] )
+{
+   return TA_ROCR100_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_ROCR100( int startIdx, int endIdx,
+                                const double *const inputs[], const double optIn[],
+                                int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 127 );
+   TA_INSTR_RETURN( TA_ROCR100( startIdx, endIdx, inputs[0], (int)optIn[0],
+                                outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_RSI */
+static const TA_InputDef inputs_RSI[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_RSI[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_RSI[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_RSI( const double optIn[] )
+{
+   return TA_RSI_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_RSI( int startIdx, int endIdx,
+                            const double *const inputs[], const double optIn[],
+                            int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 128 );
+   TA_INSTR_RETURN( TA_RSI( startIdx, endIdx, inputs[0], (int)optIn[0],
+                            outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_SAR */
+static const TA_InputDef inputs_SAR[] = {
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" }
+};
+static const TA_OptInputDef optInputs_SAR[] = {
+   { TA_OPTIN_REAL, "optInAcceleration", 0, TA_REAL_MAX },
+   { TA_OPTIN_REAL, "optInMaximum", 0, TA_REAL_MAX }
+};
+static const TA_OutputDef outputs_SAR[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_SAR( const double optIn[] )
+{
+   return TA_SAR_Lookback( optIn[0], optIn[1] );
+}
+
+static TA_RetCode call_SAR( int startIdx, int endIdx,
+                            const double *const inputs[], const double optIn[],
+                            int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 129 );
+   TA_INSTR_RETURN( TA_SAR( startIdx, endIdx, inputs[0], inputs[1], optIn[0], optIn[1],
+                            outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_SAREXT */
+static const TA_InputDef inputs_SAREXT[] = {
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" }
+};
+static const TA_OptInputDef optInputs_SAREXT[] = {
+   { TA_OPTIN_REAL, "optInStartValue", TA_REAL_MIN, TA_REAL_MAX },
+   { TA_OPTIN_REAL, "optInOffsetOnReverse", 0, TA_REAL_MAX },
+   { TA_OPTIN_REAL, "optInAccelerationInitLong", 0, TA_REAL_MAX },
+   { TA_OPTIN_REAL, "optInAccelerationLong", 0, TA_REAL_MAX },
+   { TA_OPTIN_REAL, "optInAccelerationMaxLong", 0, TA_REAL_MAX },
+   { TA_OPTIN_REAL, "optInAccelerationInitShort", 0, TA_REAL_MAX },
+   { TA_OPTIN_REAL, "optInAccelerationShort", 0, TA_REAL_MAX },
+   { TA_OPTIN_REAL, "optInAccelerationMaxShort", 0, TA_REAL_MAX }
+};
+static const TA_OutputDef outputs_SAREXT[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_SAREXT( const double optIn[] )
+{
+   return TA_SAREXT_Lookback( optIn[0], optIn[1], optIn[2], optIn[3], optIn[4], optIn[5], optIn[6], optIn[7] );
+}
+
+static TA_RetCode call_SAREXT( int startIdx, int endIdx,
+                               const double *const inputs[], const double optIn[],
+                               int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 130 );
+   TA_INSTR_RETURN( TA_SAREXT( startIdx, endIdx, inputs[0], inputs[1], optIn[0], optIn[1], optIn[2], optIn[3], optIn[4], optIn[5], optIn[6], optIn[7],
+                               outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_SKEW */
+static const TA_InputDef inputs_SKEW[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_SKEW[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_SKEW[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_SKEW( const double optIn[] )
+{
+   return TA_SKEW_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_SKEW( int startIdx, int endIdx,
+                             const double *const inputs[], const double optIn[],
+                             int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 131 );
+   TA_INSTR_RETURN( TA_SKEW( startIdx, endIdx, inputs[0], (int)optIn[0],
+                             outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_SMA */
+static const TA_InputDef inputs_SMA[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_SMA[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_SMA[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_SMA( const double optIn[] )
+{
+   return TA_SMA_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_SMA( int startIdx, int endIdx,
+                            const double *const inputs[], const double optIn[],
+                            int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 132 );
+   TA_INSTR_RETURN( TA_SMA( startIdx, endIdx, inputs[0], (int)optIn[0],
+                            outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_STDDEV */
+static const TA_InputDef inputs_STDDEV[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_STDDEV[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 },
+   { TA_OPTIN_REAL, "optInNbDev", TA_REAL_MIN, TA_REAL_MAX }
+};
+static const TA_OutputDef outputs_STDDEV[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_STDDEV( const double optIn[] )
+{
+   return TA_STDDEV_Lookback( (int)optIn[0], optIn[1] );
+}
+
+static TA_RetCode call_STDDEV( int startIdx, int endIdx,
+                               const double *const inputs[], const double optIn[],
+                               int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 133 );
+   TA_INSTR_RETURN( TA_STDDEV( startIdx, endIdx, inputs[0], (int)optIn[0], optIn[1],
+                               outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_STOCH */
+static const TA_InputDef inputs_STOCH[] = {
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OptInputDef optInputs_STOCH[] = {
+   { TA_OPTIN_INTEGER, "optInFastK_Period", 1, 100000 },
+   { TA_OPTIN_INTEGER, "optInSlowK_Period", 1, 100000 },
+   { TA_OPTIN_MATYPE, "optInSlowK_MAType", TA_MAType_SMA, TA_MAType_T3 },
+   { TA_OPTIN_INTEGER, "optInSlowD_Period", 1, 100000 },
+   { TA_OPTIN_MATYPE, "optInSlowD_MAType", TA_MAType_SMA, TA_MAType_T3 }
+};
+static const TA_OutputDef outputs_STOCH[] = {
+   { TA_OUTPUT_REAL, "outSlowK" },
+   { TA_OUTPUT_REAL, "outSlowD" }
+};
+
+static int lookback_STOCH( const double optIn[] )
+{
+   return TA_STOCH_Lookback( (int)optIn[0], (int)optIn[1], (TA_MAType)(int)optIn[2], (int)optIn[3], (TA_MAType)(int)optIn[4] );
+}
+
+static TA_RetCode call_STOCH( int startIdx, int endIdx,
+                              const double *const inputs[], const double optIn[],
+                              int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 134 );
+   TA_INSTR_RETURN( TA_STOCH( startIdx, endIdx, inputs[0], inputs[1], inputs[2], (int)optIn[0], (int)optIn[1], (TA_MAType)(int)optIn[2], (int)optIn[3], (TA_MAType)(int)optIn[4],
+                              outBegIdx, outNBElement, (double *)outputs[0], (double *)outputs[1] ) );
+}
+
+/* TA_STOCHF */
+static const TA_InputDef inputs_STOCHF[] = {
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OptInputDef optInputs_STOCHF[] = {
+   { TA_OPTIN_INTEGER, "optInFastK_Period", 1, 100000 },
+   { TA_OPTIN_INTEGER, "optInFastD_Period", 1, 100000 },
+   { TA_OPTIN_MATYPE, "optInFastD_MAType", TA_MAType_SMA, TA_MAType_T3 }
+};
+static const TA_OutputDef outputs_STOCHF[] = {
+   { TA_OUTPUT_REAL, "outFastK" },
+   { TA_OUTPUT_REAL, "outFastD" }
+};
+
+static int lookback_STOCHF( const double optIn[] )
+{
+   return TA_STOCHF_Lookback( (int)optIn[0], (int)optIn[1], (TA_MAType)(int)optIn[2] );
+}
+
+static TA_RetCode call_STOCHF( int startIdx, int endIdx,
+                               const double *const inputs[], const double optIn[],
+                               int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 135 );
+   TA_INSTR_RETURN( TA_STOCHF( startIdx, endIdx, inputs[0], inputs[1], inputs[2], (int)optIn[0], (int)optIn[1], (TA_MAType)(int)optIn[2],
+                               outBegIdx, outNBElement, (double *)outputs[0], (double *)outputs[1] ) );
+}
+
+/* TA_STOCHRSI */
+static const TA_InputDef inputs_STOCHRSI[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_STOCHRSI[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 },
+   { TA_OPTIN_INTEGER, "optInFastK_Period", 1, 100000 },
+   { TA_OPTIN_INTEGER, "optInFastD_Period", 1, 100000 },
+   { TA_OPTIN_MATYPE, "optInFastD_MAType", TA_MAType_SMA, TA_MAType_T3 }
+};
+static const TA_OutputDef outputs_STOCHRSI[] = {
+   { TA_OUTPUT_REAL, "outFastK" },
+   { TA_OUTPUT_REAL, "outFastD" }
+};
+
+static int lookback_STOCHRSI( const double optIn[] )
+{
+   return TA_STOCHRSI_Lookback( (int)optIn[0], (int)optIn[1], (int)optIn[2], (TA_MAType)(int)optIn[3] );
+}
+
+static TA_RetCode call_STOCHRSI( int startIdx, int endIdx,
+                                 const double *const inputs[], const double optIn[],
+                                 int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 136 );
+   TA_INSTR_RETURN( TA_STOCHRSI( startIdx, endIdx, inputs[0], (int)optIn[0], (int)optIn[1], (int)optIn[2], (TA_MAType)(int)optIn[3],
+                                 outBegIdx, outNBElement, (double *)outputs[0], (double *)outputs[1] ) );
+}
+
+/* TA_SmaExt */
+static const TA_InputDef inputs_SmaExt[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_SmaExt[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 1, 100000 },
+   { TA_OPTIN_INTEGER, "optInTimePeriodShift", 0, 100000 }
+};
+static const TA_OutputDef outputs_SmaExt[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_SmaExt( const double optIn[] )
+{
+   return TA_SmaExt_Lookback( (int)optIn[0], (int)optIn[1] );
+}
+
+static TA_RetCode call_SmaExt( int startIdx, int endIdx,
+                               const double *const inputs[], const double optIn[],
+                               int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 137 );
+   TA_INSTR_RETURN( TA_SmaExt( startIdx, endIdx, inputs[0], (int)optIn[0], (int)optIn[1],
+                               outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_T3 */
+static const TA_InputDef inputs_T3[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_T3[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 },
+   { TA_OPTIN_REAL, "optInVFactor", 0, 1 }
+};
+static const TA_OutputDef outputs_T3[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_T3( const double optIn[] )
+{
+   return TA_T3_Lookback( (int)optIn[0], optIn[1] );
+}
+
+static TA_RetCode call_T3( int startIdx, int endIdx,
+                           const double *const inputs[], const double optIn[],
+                           int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 138 );
+   TA_INSTR_RETURN( TA_T3( startIdx, endIdx, inputs[0], (int)optIn[0], optIn[1],
+                           outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_TEMA */
+static const TA_InputDef inputs_TEMA[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_TEMA[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_TEMA[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_TEMA( const double optIn[] )
+{
+   return TA_TEMA_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_TEMA( int startIdx, int endIdx,
+                             const double *const inputs[], const double optIn[],
+                             int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 139 );
+   TA_INSTR_RETURN( TA_TEMA( startIdx, endIdx, inputs[0], (int)optIn[0],
+                             outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_TRANGE */
+static const TA_InputDef inputs_TRANGE[] = {
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_TRANGE[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_TRANGE( const double optIn[] )
+{
+   (void)optIn;
+   return TA_TRANGE_Lookback();
+}
+
+static TA_RetCode call_TRANGE( int startIdx, int endIdx,
+                               const double *const inputs[], const double optIn[],
+                               int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 140 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_TRANGE( startIdx, endIdx, inputs[0], inputs[1], inputs[2],
+                               outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_TRIMA */
+static const TA_InputDef inputs_TRIMA[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_TRIMA[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_TRIMA[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_TRIMA( const double optIn[] )
+{
+   return TA_TRIMA_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_TRIMA( int startIdx, int endIdx,
+                              const double *const inputs[], const double optIn[],
+                              int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 141 );
+   TA_INSTR_RETURN( TA_TRIMA( startIdx, endIdx, inputs[0], (int)optIn[0],
+                              outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_TRIX */
+static const TA_InputDef inputs_TRIX[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_TRIX[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 1, 100000 }
+};
+static const TA_OutputDef outputs_TRIX[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_TRIX( const double optIn[] )
+{
+   return TA_TRIX_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_TRIX( int startIdx, int endIdx,
+                             const double *const inputs[], const double optIn[],
+                             int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 142 );
+   TA_INSTR_RETURN( TA_TRIX( startIdx, endIdx, inputs[0], (int)optIn[0],
+                             outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_TSF */
+static const TA_InputDef inputs_TSF[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_TSF[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_TSF[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_TSF( const double optIn[] )
+{
+   return TA_TSF_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_TSF( int startIdx, int endIdx,
+                            const double *const inputs[], const double optIn[],
+                            int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 143 );
+   TA_INSTR_RETURN( TA_TSF( startIdx, endIdx, inputs[0], (int)optIn[0],
+                            outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_TYPPRICE */
+static const TA_InputDef inputs_TYPPRICE[] = {
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_TYPPRICE[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_TYPPRICE( const double optIn[] )
+{
+   (void)optIn;
+   return TA_TYPPRICE_Lookback();
+}
+
+static TA_RetCode call_TYPPRICE( int startIdx, int endIdx,
+                                 const double *const inputs[], const double optIn[],
+                                 int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 144 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_TYPPRICE( startIdx, endIdx, inputs[0], inputs[1], inputs[2],
+                                 outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_TrendData */
+static const TA_InputDef inputs_TrendData[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_TrendData[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 },
+   { TA_OPTIN_REAL, "optInNbDev", TA_REAL_MIN, TA_REAL_MAX },
+   { TA_OPTIN_REAL, "optInWidthThres", 10, 60 },
+   { TA_OPTIN_REAL, "optInDistThres", 0, 30 },
+   { TA_OPTIN_REAL, "optInDaysThres", 0, 100 },
+   { TA_OPTIN_REAL, "optInPctThres", 0, 30 }
+};
+static const TA_OutputDef outputs_TrendData[] = {
+   { TA_OUTPUT_REAL, "outUpDays" },
+   { TA_OUTPUT_REAL, "outUpPercent" },
+   { TA_OUTPUT_REAL, "outDownDays" },
+   { TA_OUTPUT_REAL, "outDownPercent" }
+};
+
+static int lookback_TrendData( const double optIn[] )
+{
+   return TA_TrendData_Lookback( (int)optIn[0], optIn[1], optIn[2], optIn[3], optIn[4], optIn[5] );
+}
+
+static TA_RetCode call_TrendData( int startIdx, int endIdx,
+                                  const double *const inputs[], const double optIn[],
+                                  int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 145 );
+   TA_INSTR_RETURN( TA_TrendData( startIdx, endIdx, inputs[0], (int)optIn[0], optIn[1], optIn[2], optIn[3], optIn[4], optIn[5],
+                                  outBegIdx, outNBElement, (double *)outputs[0], (double *)outputs[1], (double *)outputs[2], (double *)outputs[3] ) );
+}
+
+/* TA_ULTOSC */
+static const TA_InputDef inputs_ULTOSC[] = {
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OptInputDef optInputs_ULTOSC[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod1", 1, 100000 },
+   { TA_OPTIN_INTEGER, "optInTimePeriod2", 1, 100000 },
+   { TA_OPTIN_INTEGER, "optInTimePeriod3", 1, 100000 }
+};
+static const TA_OutputDef outputs_ULTOSC[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_ULTOSC( const double optIn[] )
+{
+   return TA_ULTOSC_Lookback( (int)optIn[0], (int)optIn[1], (int)optIn[2] );
+}
+
+static TA_RetCode call_ULTOSC( int startIdx, int endIdx,
+                               const double *const inputs[], const double optIn[],
+                               int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 146 );
+   TA_INSTR_RETURN( TA_ULTOSC( startIdx, endIdx, inputs[0], inputs[1], inputs[2], (int)optIn[0], (int)optIn[1], (int)optIn[2],
+                               outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_VAR */
+static const TA_InputDef inputs_VAR[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_VAR[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 1, 100000 },
+   { TA_OPTIN_REAL, "optInNbDev", TA_REAL_MIN, TA_REAL_MAX }
+};
+static const TA_OutputDef outputs_VAR[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_VAR( const double optIn[] )
+{
+   return TA_VAR_Lookback( (int)optIn[0], optIn[1] );
+}
+
+static TA_RetCode call_VAR( int startIdx, int endIdx,
+                            const double *const inputs[], const double optIn[],
+                            int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 147 );
+   TA_INSTR_RETURN( TA_VAR( startIdx, endIdx, inputs[0], (int)optIn[0], optIn[1],
+                            outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_WCLPRICE */
+static const TA_InputDef inputs_WCLPRICE[] = {
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OutputDef outputs_WCLPRICE[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_WCLPRICE( const double optIn[] )
+{
+   (void)optIn;
+   return TA_WCLPRICE_Lookback();
+}
+
+static TA_RetCode call_WCLPRICE( int startIdx, int endIdx,
+                                 const double *const inputs[], const double optIn[],
+                                 int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 148 );
+   (void)optIn;
+   TA_INSTR_RETURN( TA_WCLPRICE( startIdx, endIdx, inputs[0], inputs[1], inputs[2],
+                                 outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_WILLR */
+static const TA_InputDef inputs_WILLR[] = {
+   { TA_INPUT_HIGH, "inHigh" },
+   { TA_INPUT_LOW, "inLow" },
+   { TA_INPUT_CLOSE, "inClose" }
+};
+static const TA_OptInputDef optInputs_WILLR[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_WILLR[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_WILLR( const double optIn[] )
+{
+   return TA_WILLR_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_WILLR( int startIdx, int endIdx,
+                              const double *const inputs[], const double optIn[],
+                              int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 149 );
+   TA_INSTR_RETURN( TA_WILLR( startIdx, endIdx, inputs[0], inputs[1], inputs[2], (int)optIn[0],
+                              outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_WMA */
+static const TA_InputDef inputs_WMA[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_WMA[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_WMA[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_WMA( const double optIn[] )
+{
+   return TA_WMA_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_WMA( int startIdx, int endIdx,
+                            const double *const inputs[], const double optIn[],
+                            int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 150 );
+   TA_INSTR_RETURN( TA_WMA( startIdx, endIdx, inputs[0], (int)optIn[0],
+                            outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+/* TA_ZSCORE */
+static const TA_InputDef inputs_ZSCORE[] = {
+   { TA_INPUT_REAL, "inReal" }
+};
+static const TA_OptInputDef optInputs_ZSCORE[] = {
+   { TA_OPTIN_INTEGER, "optInTimePeriod", 2, 100000 }
+};
+static const TA_OutputDef outputs_ZSCORE[] = {
+   { TA_OUTPUT_REAL, "outReal" }
+};
+
+static int lookback_ZSCORE( const double optIn[] )
+{
+   return TA_ZSCORE_Lookback( (int)optIn[0] );
+}
+
+static TA_RetCode call_ZSCORE( int startIdx, int endIdx,
+                               const double *const inputs[], const double optIn[],
+                               int *outBegIdx, int *outNBElement, void *const outputs[] )
+{
+   TA_INSTR_PROLOG( 151 );
+   TA_INSTR_RETURN( TA_ZSCORE( startIdx, endIdx, inputs[0], (int)optIn[0],
+                               outBegIdx, outNBElement, (double *)outputs[0] ) );
+}
+
+static const TA_FuncDef funcTable[] = {
+   { "ACCBANDS", "Acceleration Bands",
+     3, inputs_ACCBANDS, 1, optInputs_ACCBANDS, 3, outputs_ACCBANDS,
+     TA_FUNC_UNST_NONE, lookback_ACCBANDS, call_ACCBANDS },
+   { "AD", "Chaikin A/D Line",
+     4, inputs_AD, 0, NULL, 1, outputs_AD,
+     TA_FUNC_UNST_NONE, lookback_AD, call_AD },
+   { "ADOSC", "Chaikin A/D Oscillator",
+     4, inputs_ADOSC, 2, optInputs_ADOSC, 1, outputs_ADOSC,
+     TA_FUNC_UNST_NONE, lookback_ADOSC, call_ADOSC },
+   { "ADX", "Average Directional Movement Index",
+     3, inputs_ADX, 1, optInputs_ADX, 1, outputs_ADX,
+     TA_FUNC_UNST_ADX, lookback_ADX, call_ADX },
+   { "ADXR", "Average Directional Movement Index Rating",
+     3, inputs_ADXR, 1, optInputs_ADXR, 1, outputs_ADXR,
+     TA_FUNC_UNST_ADXR, lookback_ADXR, call_ADXR },
+   { "APO", "Absolute Price Oscillator",
+     1, inputs_APO, 3, optInputs_APO, 1, outputs_APO,
+     TA_FUNC_UNST_NONE, lookback_APO, call_APO },
+   { "AROON", "Aroon",
+     2, inputs_AROON, 1, optInputs_AROON, 2, outputs_AROON,
+     TA_FUNC_UNST_NONE, lookback_AROON, call_AROON },
+   { "AROONOSC", "Aroon Oscillator",
+     2, inputs_AROONOSC, 1, optInputs_AROONOSC, 1, outputs_AROONOSC,
+     TA_FUNC_UNST_NONE, lookback_AROONOSC, call_AROONOSC },
+   { "ATR", "Average True Range",
+     3, inputs_ATR, 1, optInputs_ATR, 1, outputs_ATR,
+     TA_FUNC_UNST_ATR, lookback_ATR, call_ATR },
+   { "AVGDEV", "Average Deviation",
+     1, inputs_AVGDEV, 1, optInputs_AVGDEV, 1, outputs_AVGDEV,
+     TA_FUNC_UNST_NONE, lookback_AVGDEV, call_AVGDEV },
+   { "BBANDS", "Bollinger Bands",
+     1, inputs_BBANDS, 4, optInputs_BBANDS, 3, outputs_BBANDS,
+     TA_FUNC_UNST_NONE, lookback_BBANDS, call_BBANDS },
+   { "BBDist", "Bollinger Bands Dist",
+     1, inputs_BBDist, 2, optInputs_BBDist, 2, outputs_BBDist,
+     TA_FUNC_UNST_NONE, lookback_BBDist, call_BBDist },
+   { "BBWidth", "Bollinger Bands Width",
+     1, inputs_BBWidth, 2, optInputs_BBWidth, 1, outputs_BBWidth,
+     TA_FUNC_UNST_NONE, lookback_BBWidth, call_BBWidth },
+   { "BETA", "Beta",
+     2, inputs_BETA, 1, optInputs_BETA, 1, outputs_BETA,
+     TA_FUNC_UNST_NONE, lookback_BETA, call_BETA },
+   { "BOP", "Balance Of Power",
+     4, inputs_BOP, 0, NULL, 1, outputs_BOP,
+     TA_FUNC_UNST_NONE, lookback_BOP, call_BOP },
+   { "Bias", "Bias",
+     1, inputs_Bias, 3, optInputs_Bias, 1, outputs_Bias,
+     TA_FUNC_UNST_NONE, lookback_Bias, call_Bias },
+   { "CCI", "Commodity Channel Index",
+     3, inputs_CCI, 1, optInputs_CCI, 1, outputs_CCI,
+     TA_FUNC_UNST_NONE, lookback_CCI, call_CCI },
+   { "CDL2CROWS", "Two Crows",
+     4, inputs_CDL2CROWS, 0, NULL, 1, outputs_CDL2CROWS,
+     TA_FUNC_UNST_NONE, lookback_CDL2CROWS, call_CDL2CROWS },
+   { "CDL3BLACKCROWS", "Three Black Crows",
+     4, inputs_CDL3BLACKCROWS, 0, NULL, 1, outputs_CDL3BLACKCROWS,
+     TA_FUNC_UNST_NONE, lookback_CDL3BLACKCROWS, call_CDL3BLACKCROWS },
+   { "CDL3INSIDE", "Three Inside Up/Down",
+     4, inputs_CDL3INSIDE, 0, NULL, 1, outputs_CDL3INSIDE,
+     TA_FUNC_UNST_NONE, lookback_CDL3INSIDE, call_CDL3INSIDE },
+   { "CDL3LINESTRIKE", "Three-Line Strike",
+     4, inputs_CDL3LINESTRIKE, 0, NULL, 1, outputs_CDL3LINESTRIKE,
+     TA_FUNC_UNST_NONE, lookback_CDL3LINESTRIKE, call_CDL3LINESTRIKE },
+   { "CDL3OUTSIDE", "Three Outside Up/Down",
+     4, inputs_CDL3OUTSIDE, 0, NULL, 1, outputs_CDL3OUTSIDE,
+     TA_FUNC_UNST_NONE, lookback_CDL3OUTSIDE, call_CDL3OUTSIDE },
+   { "CDL3STARSINSOUTH", "Three Stars In The South",
+     4, inputs_CDL3STARSINSOUTH, 0, NULL, 1, outputs_CDL3STARSINSOUTH,
+     TA_FUNC_UNST_NONE, lookback_CDL3STARSINSOUTH, call_CDL3STARSINSOUTH },
+   { "CDL3WHITESOLDIERS", "Three Advancing White Soldiers",
+     4, inputs_CDL3WHITESOLDIERS, 0, NULL, 1, outputs_CDL3WHITESOLDIERS,
+     TA_FUNC_UNST_NONE, lookback_CDL3WHITESOLDIERS, call_CDL3WHITESOLDIERS },
+   { "CDLABANDONEDBABY", "Abandoned Baby",
+     4, inputs_CDLABANDONEDBABY, 1, optInputs_CDLABANDONEDBABY, 1, outputs_CDLABANDONEDBABY,
+     TA_FUNC_UNST_NONE, lookback_CDLABANDONEDBABY, call_CDLABANDONEDBABY },
+   { "CDLADVANCEBLOCK", "Advance Block",
+     4, inputs_CDLADVANCEBLOCK, 0, NULL, 1, outputs_CDLADVANCEBLOCK,
+     TA_FUNC_UNST_NONE, lookback_CDLADVANCEBLOCK, call_CDLADVANCEBLOCK },
+   { "CDLBELTHOLD", "Belt-hold",
+     4, inputs_CDLBELTHOLD, 0, NULL, 1, outputs_CDLBELTHOLD,
+     TA_FUNC_UNST_NONE, lookback_CDLBELTHOLD, call_CDLBELTHOLD },
+   { "CDLBREAKAWAY", "Breakaway",
+     4, inputs_CDLBREAKAWAY, 0, NULL, 1, outputs_CDLBREAKAWAY,
+     TA_FUNC_UNST_NONE, lookback_CDLBREAKAWAY, call_CDLBREAKAWAY },
+   { "CDLCLOSINGMARUBOZU", "Closing Marubozu",
+     4, inputs_CDLCLOSINGMARUBOZU, 0, NULL, 1, outputs_CDLCLOSINGMARUBOZU,
+     TA_FUNC_UNST_NONE, lookback_CDLCLOSINGMARUBOZU, call_CDLCLOSINGMARUBOZU },
+   { "CDLCONCEALBABYSWALL", "Concealing Baby Swallow",
+     4, inputs_CDLCONCEALBABYSWALL, 0, NULL, 1, outputs_CDLCONCEALBABYSWALL,
+     TA_FUNC_UNST_NONE, lookback_CDLCONCEALBABYSWALL, call_CDLCONCEALBABYSWALL },
+   { "CDLCOUNTERATTACK", "Counterattack",
+     4, inputs_CDLCOUNTERATTACK, 0, NULL, 1, outputs_CDLCOUNTERATTACK,
+     TA_FUNC_UNST_NONE, lookback_CDLCOUNTERATTACK, call_CDLCOUNTERATTACK },
+   { "CDLDARKCLOUDCOVER", "Dark Cloud Cover",
+     4, inputs_CDLDARKCLOUDCOVER, 1, optInputs_CDLDARKCLOUDCOVER, 1, outputs_CDLDARKCLOUDCOVER,
+     TA_FUNC_UNST_NONE, lookback_CDLDARKCLOUDCOVER, call_CDLDARKCLOUDCOVER },
+   { "CDLDOJI", "Doji",
+     4, inputs_CDLDOJI, 0, NULL, 1, outputs_CDLDOJI,
+     TA_FUNC_UNST_NONE, lookback_CDLDOJI, call_CDLDOJI },
+   { "CDLDOJISTAR", "Doji Star",
+     4, inputs_CDLDOJISTAR, 0, NULL, 1, outputs_CDLDOJISTAR,
+     TA_FUNC_UNST_NONE, lookback_CDLDOJISTAR, call_CDLDOJISTAR },
+   { "CDLDRAGONFLYDOJI", "Dragonfly Doji",
+     4, inputs_CDLDRAGONFLYDOJI, 0, NULL, 1, outputs_CDLDRAGONFLYDOJI,
+     TA_FUNC_UNST_NONE, lookback_CDLDRAGONFLYDOJI, call_CDLDRAGONFLYDOJI },
+   { "CDLENGULFING", "Engulfing Pattern",
+     4, inputs_CDLENGULFING, 0, NULL, 1, outputs_CDLENGULFING,
+     TA_FUNC_UNST_NONE, lookback_CDLENGULFING, call_CDLENGULFING },
+   { "CDLEVENINGDOJISTAR", "Evening Doji Star",
+     4, inputs_CDLEVENINGDOJISTAR, 1, optInputs_CDLEVENINGDOJISTAR, 1, outputs_CDLEVENINGDOJISTAR,
+     TA_FUNC_UNST_NONE, lookback_CDLEVENINGDOJISTAR, call_CDLEVENINGDOJISTAR },
+   { "CDLEVENINGSTAR", "Evening Star",
+     4, inputs_CDLEVENINGSTAR, 1, optInputs_CDLEVENINGSTAR, 1, outputs_CDLEVENINGSTAR,
+     TA_FUNC_UNST_NONE, lookback_CDLEVENINGSTAR, call_CDLEVENINGSTAR },
+   { "CDLGAPSIDESIDEWHITE", "Up/Down-gap side-by-side white lines",
+     4, inputs_CDLGAPSIDESIDEWHITE, 0, NULL, 1, outputs_CDLGAPSIDESIDEWHITE,
+     TA_FUNC_UNST_NONE, lookback_CDLGAPSIDESIDEWHITE, call_CDLGAPSIDESIDEWHITE },
+   { "CDLGRAVESTONEDOJI", "Gravestone Doji",
+     4, inputs_CDLGRAVESTONEDOJI, 0, NULL, 1, outputs_CDLGRAVESTONEDOJI,
+     TA_FUNC_UNST_NONE, lookback_CDLGRAVESTONEDOJI, call_CDLGRAVESTONEDOJI },
+   { "CDLHAMMER", "Hammer",
+     4, inputs_CDLHAMMER, 0, NULL, 1, outputs_CDLHAMMER,
+     TA_FUNC_UNST_NONE, lookback_CDLHAMMER, call_CDLHAMMER },
+   { "CDLHANGINGMAN", "Hanging Man",
+     4, inputs_CDLHANGINGMAN, 0, NULL, 1, outputs_CDLHANGINGMAN,
+     TA_FUNC_UNST_NONE, lookback_CDLHANGINGMAN, call_CDLHANGINGMAN },
+   { "CDLHARAMI", "Harami Pattern",
+     4, inputs_CDLHARAMI, 0, NULL, 1, outputs_CDLHARAMI,
+     TA_FUNC_UNST_NONE, lookback_CDLHARAMI, call_CDLHARAMI },
+   { "CDLHARAMICROSS", "Harami Cross Pattern",
+     4, inputs_CDLHARAMICROSS, 0, NULL, 1, outputs_CDLHARAMICROSS,
+     TA_FUNC_UNST_NONE, lookback_CDLHARAMICROSS, call_CDLHARAMICROSS },
+   { "CDLHIGHWAVE", "High-Wave Candle",
+     4, inputs_CDLHIGHWAVE, 0, NULL, 1, outputs_CDLHIGHWAVE,
+     TA_FUNC_UNST_NONE, lookback_CDLHIGHWAVE, call_CDLHIGHWAVE },
+   { "CDLHIKKAKE", "Hikkake Pattern",
+     4, inputs_CDLHIKKAKE, 0, NULL, 1, outputs_CDLHIKKAKE,
+     TA_FUNC_UNST_NONE, lookback_CDLHIKKAKE, call_CDLHIKKAKE },
+   { "CDLHIKKAKEMOD", "Modified Hikkake Pattern",
+     4, inputs_CDLHIKKAKEMOD, 0, NULL, 1, outputs_CDLHIKKAKEMOD,
+     TA_FUNC_UNST_NONE, lookback_CDLHIKKAKEMOD, call_CDLHIKKAKEMOD },
+   { "CDLHOMINGPIGEON", "Homing Pigeon",
+     4, inputs_CDLHOMINGPIGEON, 0, NULL, 1, outputs_CDLHOMINGPIGEON,
+     TA_FUNC_UNST_NONE, lookback_CDLHOMINGPIGEON, call_CDLHOMINGPIGEON },
+   { "CDLIDENTICAL3CROWS", "Identical Three Crows",
+     4, inputs_CDLIDENTICAL3CROWS, 0, NULL, 1, outputs_CDLIDENTICAL3CROWS,
+     TA_FUNC_UNST_NONE, lookback_CDLIDENTICAL3CROWS, call_CDLIDENTICAL3CROWS },
+   { "CDLINNECK", "In-Neck Pattern",
+     4, inputs_CDLINNECK, 0, NULL, 1, outputs_CDLINNECK,
+     TA_FUNC_UNST_NONE, lookback_CDLINNECK, call_CDLINNECK },
+   { "CDLINVERTEDHAMMER", "Inverted Hammer",
+     4, inputs_CDLINVERTEDHAMMER, 0, NULL, 1, outputs_CDLINVERTEDHAMMER,
+     TA_FUNC_UNST_NONE, lookback_CDLINVERTEDHAMMER, call_CDLINVERTEDHAMMER },
+   { "CDLKICKING", "Kicking",
+     4, inputs_CDLKICKING, 0, NULL, 1, outputs_CDLKICKING,
+     TA_FUNC_UNST_NONE, lookback_CDLKICKING, call_CDLKICKING },
+   { "CDLKICKINGBYLENGTH", "Kicking - bull/bear determined by the longer marubozu",
+     4, inputs_CDLKICKINGBYLENGTH, 0, NULL, 1, outputs_CDLKICKINGBYLENGTH,
+     TA_FUNC_UNST_NONE, lookback_CDLKICKINGBYLENGTH, call_CDLKICKINGBYLENGTH },
+   { "CDLLADDERBOTTOM", "Ladder Bottom",
+     4, inputs_CDLLADDERBOTTOM, 0, NULL, 1, outputs_CDLLADDERBOTTOM,
+     TA_FUNC_UNST_NONE, lookback_CDLLADDERBOTTOM, call_CDLLADDERBOTTOM },
+   { "CDLLONGLEGGEDDOJI", "Long Legged Doji",
+     4, inputs_CDLLONGLEGGEDDOJI, 0, NULL, 1, outputs_CDLLONGLEGGEDDOJI,
+     TA_FUNC_UNST_NONE, lookback_CDLLONGLEGGEDDOJI, call_CDLLONGLEGGEDDOJI },
+   { "CDLLONGLINE", "Long Line Candle",
+     4, inputs_CDLLONGLINE, 0, NULL, 1, outputs_CDLLONGLINE,
+     TA_FUNC_UNST_NONE, lookback_CDLLONGLINE, call_CDLLONGLINE },
+   { "CDLMARUBOZU", "Marubozu",
+     4, inputs_CDLMARUBOZU, 0, NULL, 1, outputs_CDLMARUBOZU,
+     TA_FUNC_UNST_NONE, lookback_CDLMARUBOZU, call_CDLMARUBOZU },
+   { "CDLMATCHINGLOW", "Matching Low",
+     4, inputs_CDLMATCHINGLOW, 0, NULL, 1, outputs_CDLMATCHINGLOW,
+     TA_FUNC_UNST_NONE, lookback_CDLMATCHINGLOW, call_CDLMATCHINGLOW },
+   { "CDLMATHOLD", "Mat Hold",
+     4, inputs_CDLMATHOLD, 1, optInputs_CDLMATHOLD, 1, outputs_CDLMATHOLD,
+     TA_FUNC_UNST_NONE, lookback_CDLMATHOLD, call_CDLMATHOLD },
+   { "CDLMORNINGDOJISTAR", "Morning Doji Star",
+     4, inputs_CDLMORNINGDOJISTAR, 1, optInputs_CDLMORNINGDOJISTAR, 1, outputs_CDLMORNINGDOJISTAR,
+     TA_FUNC_UNST_NONE, lookback_CDLMORNINGDOJISTAR, call_CDLMORNINGDOJISTAR },
+   { "CDLMORNINGSTAR", "Morning Star",
+     4, inputs_CDLMORNINGSTAR, 1, optInputs_CDLMORNINGSTAR, 1, outputs_CDLMORNINGSTAR,
+     TA_FUNC_UNST_NONE, lookback_CDLMORNINGSTAR, call_CDLMORNINGSTAR },
+   { "CDLONNECK", "On-Neck Pattern",
+     4, inputs_CDLONNECK, 0, NULL, 1, outputs_CDLONNECK,
+     TA_FUNC_UNST_NONE, lookback_CDLONNECK, call_CDLONNECK },
+   { "CDLPIERCING", "Piercing Pattern",
+     4, inputs_CDLPIERCING, 0, NULL, 1, outputs_CDLPIERCING,
+     TA_FUNC_UNST_NONE, lookback_CDLPIERCING, call_CDLPIERCING },
+   { "CDLRICKSHAWMAN", "Rickshaw Man",
+     4, inputs_CDLRICKSHAWMAN, 0, NULL, 1, outputs_CDLRICKSHAWMAN,
+     TA_FUNC_UNST_NONE, lookback_CDLRICKSHAWMAN, call_CDLRICKSHAWMAN },
+   { "CDLRISEFALL3METHODS", "Rising/Falling Three Methods",
+     4, inputs_CDLRISEFALL3METHODS, 0, NULL, 1, outputs_CDLRISEFALL3METHODS,
+     TA_FUNC_UNST_NONE, lookback_CDLRISEFALL3METHODS, call_CDLRISEFALL3METHODS },
+   { "CDLSEPARATINGLINES", "Separating Lines",
+     4, inputs_CDLSEPARATINGLINES, 0, NULL, 1, outputs_CDLSEPARATINGLINES,
+     TA_FUNC_UNST_NONE, lookback_CDLSEPARATINGLINES, call_CDLSEPARATINGLINES },
+   { "CDLSHOOTINGSTAR", "Shooting Star",
+     4, inputs_CDLSHOOTINGSTAR, 0, NULL, 1, outputs_CDLSHOOTINGSTAR,
+     TA_FUNC_UNST_NONE, lookback_CDLSHOOTINGSTAR, call_CDLSHOOTINGSTAR },
+   { "CDLSHORTLINE", "Short Line Candle",
+     4, inputs_CDLSHORTLINE, 0, NULL, 1, outputs_CDLSHORTLINE,
+     TA_FUNC_UNST_NONE, lookback_CDLSHORTLINE, call_CDLSHORTLINE },
+   { "CDLSPINNINGTOP", "Spinning Top",
+     4, inputs_CDLSPINNINGTOP, 0, NULL, 1, outputs_CDLSPINNINGTOP,
+     TA_FUNC_UNST_NONE, lookback_CDLSPINNINGTOP, call_CDLSPINNINGTOP },
+   { "CDLSTALLEDPATTERN", "Stalled Pattern",
+     4, inputs_CDLSTALLEDPATTERN, 0, NULL, 1, outputs_CDLSTALLEDPATTERN,
+     TA_FUNC_UNST_NONE, lookback_CDLSTALLEDPATTERN, call_CDLSTALLEDPATTERN },
+   { "CDLSTICKSANDWICH", "Stick Sandwich",
+     4, inputs_CDLSTICKSANDWICH, 0, NULL, 1, outputs_CDLSTICKSANDWICH,
+     TA_FUNC_UNST_NONE, lookback_CDLSTICKSANDWICH, call_CDLSTICKSANDWICH },
+   { "CDLTAKURI", "Takuri (Dragonfly Doji with very long lower shadow)",
+     4, inputs_CDLTAKURI, 0, NULL, 1, outputs_CDLTAKURI,
+     TA_FUNC_UNST_NONE, lookback_CDLTAKURI, call_CDLTAKURI },
+   { "CDLTASUKIGAP", "Tasuki Gap",
+     4, inputs_CDLTASUKIGAP, 0, NULL, 1, outputs_CDLTASUKIGAP,
+     TA_FUNC_UNST_NONE, lookback_CDLTASUKIGAP, call_CDLTASUKIGAP },
+   { "CDLTHRUSTING", "Thrusting Pattern",
+     4, inputs_CDLTHRUSTING, 0, NULL, 1, outputs_CDLTHRUSTING,
+     TA_FUNC_UNST_NONE, lookback_CDLTHRUSTING, call_CDLTHRUSTING },
+   { "CDLTRISTAR", "Tristar Pattern",
+     4, inputs_CDLTRISTAR, 0, NULL, 1, outputs_CDLTRISTAR,
+     TA_FUNC_UNST_NONE, lookback_CDLTRISTAR, call_CDLTRISTAR },
+   { "CDLUNIQUE3RIVER", "Unique 3 River",
+     4, inputs_CDLUNIQUE3RIVER, 0, NULL, 1, outputs_CDLUNIQUE3RIVER,
+     TA_FUNC_UNST_NONE, lookback_CDLUNIQUE3RIVER, call_CDLUNIQUE3RIVER },
+   { "CDLUPSIDEGAP2CROWS", "Upside Gap Two Crows",
+     4, inputs_CDLUPSIDEGAP2CROWS, 0, NULL, 1, outputs_CDLUPSIDEGAP2CROWS,
+     TA_FUNC_UNST_NONE, lookback_CDLUPSIDEGAP2CROWS, call_CDLUPSIDEGAP2CROWS },
+   { "CDLXSIDEGAP3METHODS", "Upside/Downside Gap Three Methods",
+     4, inputs_CDLXSIDEGAP3METHODS, 0, NULL, 1, outputs_CDLXSIDEGAP3METHODS,
+     TA_FUNC_UNST_NONE, lookback_CDLXSIDEGAP3METHODS, call_CDLXSIDEGAP3METHODS },
+   { "CMO", "Chande Momentum Oscillator",
+     1, inputs_CMO, 1, optInputs_CMO, 1, outputs_CMO,
+     TA_FUNC_UNST_CMO, lookback_CMO, call_CMO },
+   { "CORREL", "Pearson's Correlation Coefficient (r)",
+     2, inputs_CORREL, 1, optInputs_CORREL, 1, outputs_CORREL,
+     TA_FUNC_UNST_NONE, lookback_CORREL, call_CORREL },
+   { "DEMA", "Double Exponential Moving Average",
+     1, inputs_DEMA, 1, optInputs_DEMA, 1, outputs_DEMA,
+     TA_FUNC_UNST_NONE, lookback_DEMA, call_DEMA },
+   { "DX", "Directional Movement Index",
+     3, inputs_DX, 1, optInputs_DX, 1, outputs_DX,
+     TA_FUNC_UNST_DX, lookback_DX, call_DX },
+   { "EMA", "Exponential Moving Average",
+     1, inputs_EMA, 1, optInputs_EMA, 1, outputs_EMA,
+     TA_FUNC_UNST_EMA, lookback_EMA, call_EMA },
+   { "HT_DCPERIOD", "Hilbert Transform - Dominant Cycle Period",
+     1, inputs_HT_DCPERIOD, 0, NULL, 1, outputs_HT_DCPERIOD,
+     TA_FUNC_UNST_HT_DCPERIOD, lookback_HT_DCPERIOD, call_HT_DCPERIOD },
+   { "HT_DCPHASE", "Hilbert Transform - Dominant Cycle Phase",
+     1, inputs_HT_DCPHASE, 0, NULL, 1, outputs_HT_DCPHASE,
+     TA_FUNC_UNST_HT_DCPHASE, lookback_HT_DCPHASE, call_HT_DCPHASE },
+   { "HT_PHASOR", "Hilbert Transform - Phasor Components",
+     1, inputs_HT_PHASOR, 0, NULL, 2, outputs_HT_PHASOR,
+     TA_FUNC_UNST_HT_PHASOR, lookback_HT_PHASOR, call_HT_PHASOR },
+   { "HT_SINE", "Hilbert Transform - SineWave",
+     1, inputs_HT_SINE, 0, NULL, 2, outputs_HT_SINE,
+     TA_FUNC_UNST_HT_SINE, lookback_HT_SINE, call_HT_SINE },
+   { "HT_TRENDLINE", "Hilbert Transform - Instantaneous Trendline",
+     1, inputs_HT_TRENDLINE, 0, NULL, 1, outputs_HT_TRENDLINE,
+     TA_FUNC_UNST_HT_TRENDLINE, lookback_HT_TRENDLINE, call_HT_TRENDLINE },
+   { "HT_TRENDMODE", "Hilbert Transform - Trend vs Cycle Mode",
+     1, inputs_HT_TRENDMODE, 0, NULL, 1, outputs_HT_TRENDMODE,
+     TA_FUNC_UNST_HT_TRENDMODE, lookback_HT_TRENDMODE, call_HT_TRENDMODE },
+   { "IMI", "Intraday Momentum Index",
+     2, inputs_IMI, 1, optInputs_IMI, 1, outputs_IMI,
+     TA_FUNC_UNST_IMI, lookback_IMI, call_IMI },
+   { "KAMA", "Kaufman Adaptive Moving Average",
+     1, inputs_KAMA, 1, optInputs_KAMA, 1, outputs_KAMA,
+     TA_FUNC_UNST_KAMA, lookback_KAMA, call_KAMA },
+   { "KURT", "Kurtosis over period",
+     1, inputs_KURT, 1, optInputs_KURT, 1, outputs_KURT,
+     TA_FUNC_UNST_NONE, lookback_KURT, call_KURT },
+   { "LINEARREG", "Linear Regression",
+     1, inputs_LINEARREG, 1, optInputs_LINEARREG, 1, outputs_LINEARREG,
+     TA_FUNC_UNST_NONE, lookback_LINEARREG, call_LINEARREG },
+   { "LINEARREG_ANGLE", "Linear Regression Angle",
+     1, inputs_LINEARREG_ANGLE, 1, optInputs_LINEARREG_ANGLE, 1, outputs_LINEARREG_ANGLE,
+     TA_FUNC_UNST_NONE, lookback_LINEARREG_ANGLE, call_LINEARREG_ANGLE },
+   { "LINEARREG_INTERCEPT", "Linear Regression Intercept",
+     1, inputs_LINEARREG_INTERCEPT, 1, optInputs_LINEARREG_INTERCEPT, 1, outputs_LINEARREG_INTERCEPT,
+     TA_FUNC_UNST_NONE, lookback_LINEARREG_INTERCEPT, call_LINEARREG_INTERCEPT },
+   { "LINEARREG_SLOPE", "Linear Regression Slope",
+     1, inputs_LINEARREG_SLOPE, 1, optInputs_LINEARREG_SLOPE, 1, outputs_LINEARREG_SLOPE,
+     TA_FUNC_UNST_NONE, lookback_LINEARREG_SLOPE, call_LINEARREG_SLOPE },
+   { "MA", "Moving average",
+     1, inputs_MA, 2, optInputs_MA, 1, outputs_MA,
+     TA_FUNC_UNST_NONE, lookback_MA, call_MA },
+   { "MACD", "Moving Average Convergence/Divergence",
+     1, inputs_MACD, 3, optInputs_MACD, 3, outputs_MACD,
+     TA_FUNC_UNST_NONE, lookback_MACD, call_MACD },
+   { "MACDEXT", "MACD with controllable MA type",
+     1, inputs_MACDEXT, 6, optInputs_MACDEXT, 3, outputs_MACDEXT,
+     TA_FUNC_UNST_NONE, lookback_MACDEXT, call_MACDEXT },
+   { "MACDFIX", "Moving Average Convergence/Divergence Fix 12/26",
+     1, inputs_MACDFIX, 1, optInputs_MACDFIX, 3, outputs_MACDFIX,
+     TA_FUNC_UNST_NONE, lookback_MACDFIX, call_MACDFIX },
+   { "MAMA", "MESA Adaptive Moving Average",
+     1, inputs_MAMA, 2, optInputs_MAMA, 2, outputs_MAMA,
+     TA_FUNC_UNST_MAMA, lookback_MAMA, call_MAMA },
+   { "MAVP", "Moving average with variable period",
+     2, inputs_MAVP, 3, optInputs_MAVP, 1, outputs_MAVP,
+     TA_FUNC_UNST_NONE, lookback_MAVP, call_MAVP },
+   { "MAX", "Highest value over a specified period",
+     1, inputs_MAX, 1, optInputs_MAX, 1, outputs_MAX,
+     TA_FUNC_UNST_NONE, lookback_MAX, call_MAX },
+   { "MAXINDEX", "Index of highest value over a specified period",
+     1, inputs_MAXINDEX, 1, optInputs_MAXINDEX, 1, outputs_MAXINDEX,
+     TA_FUNC_UNST_NONE, lookback_MAXINDEX, call_MAXINDEX },
+   { "MEDIAN", "Median over period",
+     1, inputs_MEDIAN, 1, optInputs_MEDIAN, 1, outputs_MEDIAN,
+     TA_FUNC_UNST_NONE, lookback_MEDIAN, call_MEDIAN },
+   { "MEDPRICE", "Median Price",
+     2, inputs_MEDPRICE, 0, NULL, 1, outputs_MEDPRICE,
+     TA_FUNC_UNST_NONE, lookback_MEDPRICE, call_MEDPRICE },
+   { "MFI", "Money Flow Index",
+     4, inputs_MFI, 1, optInputs_MFI, 1, outputs_MFI,
+     TA_FUNC_UNST_MFI, lookback_MFI, call_MFI },
+   { "MIDPOINT", "MidPoint over period",
+     1, inputs_MIDPOINT, 1, optInputs_MIDPOINT, 1, outputs_MIDPOINT,
+     TA_FUNC_UNST_NONE, lookback_MIDPOINT, call_MIDPOINT },
+   { "MIDPRICE", "Midpoint Price over period",
+     2, inputs_MIDPRICE, 1, optInputs_MIDPRICE, 1, outputs_MIDPRICE,
+     TA_FUNC_UNST_NONE, lookback_MIDPRICE, call_MIDPRICE },
+   { "MIN", "Lowest value over a specified period",
+     1, inputs_MIN, 1, optInputs_MIN, 1, outputs_MIN,
+     TA_FUNC_UNST_NONE, lookback_MIN, call_MIN },
+   { "MININDEX", "Index of lowest value over a specified period",
+     1, inputs_MININDEX, 1, optInputs_MININDEX, 1, outputs_MININDEX,
+     TA_FUNC_UNST_NONE, lookback_MININDEX, call_MININDEX },
+   { "MINMAX", "Lowest and highest values over a specified period",
+     1, inputs_MINMAX, 1, optInputs_MINMAX, 2, outputs_MINMAX,
+     TA_FUNC_UNST_NONE, lookback_MINMAX, call_MINMAX },
+   { "MINMAXINDEX", "Indexes of lowest and highest values over a specified period",
+     1, inputs_MINMAXINDEX, 1, optInputs_MINMAXINDEX, 2, outputs_MINMAXINDEX,
+     TA_FUNC_UNST_NONE, lookback_MINMAXINDEX, call_MINMAXINDEX },
+   { "MINUS_DI", "Minus Directional Indicator",
+     3, inputs_MINUS_DI, 1, optInputs_MINUS_DI, 1, outputs_MINUS_DI,
+     TA_FUNC_UNST_MINUS_DI, lookback_MINUS_DI, call_MINUS_DI },
+   { "MINUS_DM", "Minus Directional Movement",
+     2, inputs_MINUS_DM, 1, optInputs_MINUS_DM, 1, outputs_MINUS_DM,
+     TA_FUNC_UNST_MINUS_DM, lookback_MINUS_DM, call_MINUS_DM },
+   { "MOM", "Momentum",
+     1, inputs_MOM, 1, optInputs_MOM, 1, outputs_MOM,
+     TA_FUNC_UNST_NONE, lookback_MOM, call_MOM },
+   { "MOMENTS", "Rolling Moments (mean, variance, std dev, skewness, kurtosis, z-score)",
+     1, inputs_MOMENTS, 1, optInputs_MOMENTS, 6, outputs_MOMENTS,
+     TA_FUNC_UNST_NONE, lookback_MOMENTS, call_MOMENTS },
+   { "NATR", "Normalized Average True Range",
+     3, inputs_NATR, 1, optInputs_NATR, 1, outputs_NATR,
+     TA_FUNC_UNST_NATR, lookback_NATR, call_NATR },
+   { "OBV", "On Balance Volume",
+     2, inputs_OBV, 0, NULL, 1, outputs_OBV,
+     TA_FUNC_UNST_NONE, lookback_OBV, call_OBV },
+   { "PCTRANK", "Percentile Rank over period",
+     1, inputs_PCTRANK, 1, optInputs_PCTRANK, 1, outputs_PCTRANK,
+     TA_FUNC_UNST_NONE, lookback_PCTRANK, call_PCTRANK },
+   { "PLUS_DI", "Plus Directional Indicator",
+     3, inputs_PLUS_DI, 1, optInputs_PLUS_DI, 1, outputs_PLUS_DI,
+     TA_FUNC_UNST_PLUS_DI, lookback_PLUS_DI, call_PLUS_DI },
+   { "PLUS_DM", "Plus Directional Movement",
+     2, inputs_PLUS_DM, 1, optInputs_PLUS_DM, 1, outputs_PLUS_DM,
+     TA_FUNC_UNST_PLUS_DM, lookback_PLUS_DM, call_PLUS_DM },
+   { "PPO", "Percentage Price Oscillator",
+     1, inputs_PPO, 3, optInputs_PPO, 1, outputs_PPO,
+     TA_FUNC_UNST_NONE, lookback_PPO, call_PPO },
+   { "QUANTILE", "Quantile over period",
+     1, inputs_QUANTILE, 2, optInputs_QUANTILE, 1, outputs_QUANTILE,
+     TA_FUNC_UNST_NONE, lookback_QUANTILE, call_QUANTILE },
+   { "ROC", "Rate of change : ((price/prevPrice)-1)*100",
+     1, inputs_ROC, 1, optInputs_ROC, 1, outputs_ROC,
+     TA_FUNC_UNST_NONE, lookback_ROC, call_ROC },
+   { "ROCP", "Rate of change Percentage: (price-prevPrice)/prevPrice",
+     1, inputs_ROCP, 1, optInputs_ROCP, 1, outputs_ROCP,
+     TA_FUNC_UNST_NONE, lookback_ROCP, call_ROCP },
+   { "ROCR", "Rate of change ratio: (price/prevPrice)",
+     1, inputs_ROCR, 1, optInputs_ROCR, 1, outputs_ROCR,
+     TA_FUNC_UNST_NONE, lookback_ROCR, call_ROCR },
+   { "ROCR100", "Rate of change ratio 100 scale: (price/prevPrice)*100",
+     1, inputs_ROCR100, 1, optInputs_ROCR100, 1, outputs_ROCR100,
+     TA_FUNC_UNST_NONE, lookback_ROCR100, call_ROCR100 },
+   { "RSI", "Relative Strength Index",
+     1, inputs_RSI, 1, optInputs_RSI, 1, outputs_RSI,
+     TA_FUNC_UNST_RSI, lookback_RSI, call_RSI },
+   { "SAR", "Parabolic SAR",
+     2, inputs_SAR, 2, optInputs_SAR, 1, outputs_SAR,
+     TA_FUNC_UNST_NONE, lookback_SAR, call_SAR },
+   { "SAREXT", "Parabolic SAR - Extended",
+     2, inputs_SAREXT, 8, optInputs_SAREXT, 1, outputs_SAREXT,
+     TA_FUNC_UNST_NONE, lookback_SAREXT, call_SAREXT },
+   { "SKEW", "Skewness over period",
+     1, inputs_SKEW, 1, optInputs_SKEW, 1, outputs_SKEW,
+     TA_FUNC_UNST_NONE, lookback_SKEW, call_SKEW },
+   { "SMA", "Simple Moving Average",
+     1, inputs_SMA, 1, optInputs_SMA, 1, outputs_SMA,
+     TA_FUNC_UNST_NONE, lookback_SMA, call_SMA },
+   { "STDDEV", "Standard Deviation",
+     1, inputs_STDDEV, 2, optInputs_STDDEV, 1, outputs_STDDEV,
+     TA_FUNC_UNST_NONE, lookback_STDDEV, call_STDDEV },
+   { "STOCH", "Stochastic",
+     3, inputs_STOCH, 5, optInputs_STOCH, 2, outputs_STOCH,
+     TA_FUNC_UNST_NONE, lookback_STOCH, call_STOCH },
+   { "STOCHF", "Stochastic Fast",
+     3, inputs_STOCHF, 3, optInputs_STOCHF, 2, outputs_STOCHF,
+     TA_FUNC_UNST_NONE, lookback_STOCHF, call_STOCHF },
+   { "STOCHRSI", "Stochastic Relative Strength Index",
+     1, inputs_STOCHRSI, 4, optInputs_STOCHRSI, 2, outputs_STOCHRSI,
+     TA_FUNC_UNST_STOCHRSI, lookback_STOCHRSI, call_STOCHRSI },
+   { "SmaExt", "Simple Moving Average Ext",
+     1, inputs_SmaExt, 2, optInputs_SmaExt, 1, outputs_SmaExt,
+     TA_FUNC_UNST_NONE, lookback_SmaExt, call_SmaExt },
+   { "T3", "Triple Exponential Moving Average (T3)",
+     1, inputs_T3, 2, optInputs_T3, 1, outputs_T3,
+     TA_FUNC_UNST_T3, lookback_T3, call_T3 },
+   { "TEMA", "Triple Exponential Moving Average",
+     1, inputs_TEMA, 1, optInputs_TEMA, 1, outputs_TEMA,
+     TA_FUNC_UNST_NONE, lookback_TEMA, call_TEMA },
+   { "TRANGE", "True Range",
+     3, inputs_TRANGE, 0, NULL, 1, outputs_TRANGE,
+     TA_FUNC_UNST_NONE, lookback_TRANGE, call_TRANGE },
+   { "TRIMA", "Triangular Moving Average",
+     1, inputs_TRIMA, 1, optInputs_TRIMA, 1, outputs_TRIMA,
+     TA_FUNC_UNST_NONE, lookback_TRIMA, call_TRIMA },
+   { "TRIX", "1-day Rate-Of-Change (ROC) of a Triple Smooth EMA",
+     1, inputs_TRIX, 1, optInputs_TRIX, 1, outputs_TRIX,
+     TA_FUNC_UNST_NONE, lookback_TRIX, call_TRIX },
+   { "TSF", "Time Series Forecast",
+     1, inputs_TSF, 1, optInputs_TSF, 1, outputs_TSF,
+     TA_FUNC_UNST_NONE, lookback_TSF, call_TSF },
+   { "TYPPRICE", "Typical Price",
+     3, inputs_TYPPRICE, 0, NULL, 1, outputs_TYPPRICE,
+     TA_FUNC_UNST_NONE, lookback_TYPPRICE, call_TYPPRICE },
+   { "TrendData", "Trend Data",
+     1, inputs_TrendData, 6, optInputs_TrendData, 4, outputs_TrendData,
+     TA_FUNC_UNST_NONE, lookback_TrendData, call_TrendData },
+   { "ULTOSC", "Ultimate Oscillator",
+     3, inputs_ULTOSC, 3, optInputs_ULTOSC, 1, outputs_ULTOSC,
+     TA_FUNC_UNST_NONE, lookback_ULTOSC, call_ULTOSC },
+   { "VAR", "Variance",
+     1, inputs_VAR, 2, optInputs_VAR, 1, outputs_VAR,
+     TA_FUNC_UNST_NONE, lookback_VAR, call_VAR },
+   { "WCLPRICE", "Weighted Close Price",
+     3, inputs_WCLPRICE, 0, NULL, 1, outputs_WCLPRICE,
+     TA_FUNC_UNST_NONE, lookback_WCLPRICE, call_WCLPRICE },
+   { "WILLR", "Williams' %R",
+     3, inputs_WILLR, 1, optInputs_WILLR, 1, outputs_WILLR,
+     TA_FUNC_UNST_NONE, lookback_WILLR, call_WILLR },
+   { "WMA", "Weighted Moving Average",
+     1, inputs_WMA, 1, optInputs_WMA, 1, outputs_WMA,
+     TA_FUNC_UNST_NONE, lookback_WMA, call_WMA },
+   { "ZSCORE", "Z-Score over period",
+     1, inputs_ZSCORE, 1, optInputs_ZSCORE, 1, outputs_ZSCORE,
+     TA_FUNC_UNST_NONE, lookback_ZSCORE, call_ZSCORE }
+};
+
+/* The most outputs of a function of the table. */
+#define FUNC_MAX_OUTPUT 6
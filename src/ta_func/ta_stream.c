@@ -0,0 +1,1048 @@
+/* Description:
+ *   Incremental version of some TA functions (see ta_stream.h).
+ *
+ *   Each update replicates the exact sequence of floating point
+ *   operations done by the batch function when called with
+ *   startIdx = 0. Keep both in sync when changing either one.
+ */
+
+/**** Headers ****/
+#include <string.h>
+#include <math.h>
+#include "ta_func.h"
+#include "ta_stream.h"
+
+#include "ta_utility.h"
+#include "ta_memory.h"
+
+/**** Local declarations.              ****/
+typedef struct
+{
+   int minPeriod;
+   int defaultPeriod; /* TA_INTEGER_DEFAULT is rejected when 0. */
+} TA_StreamFuncDef;
+
+static const TA_StreamFuncDef streamFuncDef[TA_STREAM_NB_FUNC] =
+{
+   { 2, 0  }, /* TA_STREAM_SMA */
+   { 2, 30 }, /* TA_STREAM_EMA */
+   { 2, 14 }, /* TA_STREAM_RSI */
+   { 1, 14 }, /* TA_STREAM_ATR */
+   { 2, 14 }, /* TA_STREAM_ADX */
+   { 2, 30 }, /* TA_STREAM_KAMA */
+   { 0, 0  }, /* TA_STREAM_MAMA, see TA_StreamInitMAMA */
+   { 0, 0  }  /* TA_STREAM_FAMA */
+};
+
+/* Bars before the main loop of TA_MAMA: 3 to initialize the price
+ * smoother, then 9 more smoothed prices.
+ */
+#define MAMA_NB_INIT_WMA 3
+#define MAMA_NB_INIT     12
+
+/* The most steady states advanced together by runSteady. */
+#define STEADY_GROUP 8
+
+/**** Local functions declarations.    ****/
+static int updateSMA( TA_StreamState *state, double value, double *outReal );
+static int updateEMA( TA_StreamState *state, double value, double *outReal );
+static int updateRSI( TA_StreamState *state, double value, double *outReal );
+static int updateATR( TA_StreamState *state, const TA_Bar *bar, double *outReal );
+static int updateADX( TA_StreamState *state, const TA_Bar *bar, double *outReal );
+static int updateKAMA( TA_StreamState *state, double value, double *outReal );
+static int updateMAMA( TA_StreamState *state, double value, double *outReal );
+static double hilbertTransform( TA_StreamHilbert *hilbert, int isOdd, int hilbertIdx,
+                                double input, double adjustedPrevPeriod );
+static int updateState( TA_StreamState *state, const TA_Bar *bar, double *outReal );
+static int isSteady( const TA_StreamState *state );
+static void runSteady( TA_StreamState *const group[], int nbGroup, int nbBars,
+                       const double inClose[], double *const outReal[] );
+static TA_RetCode initState( TA_StreamState *state, TA_StreamFuncId funcId,
+                             int optInTimePeriod, double optInFastLimit,
+                             double optInSlowLimit );
+
+/**** Global functions definitions.   ****/
+TA_RetCode TA_StreamInit( TA_StreamState *state,
+                          TA_StreamFuncId funcId,
+                          int             optInTimePeriod )
+{
+   return initState( state, funcId, optInTimePeriod, TA_REAL_DEFAULT, TA_REAL_DEFAULT );
+}
+
+TA_RetCode TA_StreamInitMAMA( TA_StreamState *state,
+                              TA_StreamFuncId funcId,
+                              double          optInFastLimit,
+                              double          optInSlowLimit )
+{
+   if( (funcId != TA_STREAM_MAMA) && (funcId != TA_STREAM_FAMA) )
+   {
+      if( state )
+         memset( state, 0, sizeof(TA_StreamState) );
+      return TA_BAD_PARAM;
+   }
+
+   return initState( state, funcId, TA_INTEGER_DEFAULT, optInFastLimit, optInSlowLimit );
+}
+
+TA_RetCode TA_StreamFree( TA_StreamState *state )
+{
+   if( !state )
+      return TA_BAD_PARAM;
+
+   FREE_IF_NOT_NULL( state->window );
+   state->windowSize = 0;
+
+   return TA_SUCCESS;
+}
+
+int TA_StreamLookback( const TA_StreamState *state )
+{
+   if( !state )
+      return -1;
+
+   return state->lookback;
+}
+
+TA_RetCode TA_StreamUpdate( TA_StreamState *state,
+                            const TA_Bar   *bar,
+                            int            *outNBElement,
+                            double         *outReal )
+{
+   int nbElement;
+
+#ifndef TA_FUNC_NO_RANGE_CHECK
+   if( !state || !bar || !outNBElement || !outReal )
+      return TA_BAD_PARAM;
+
+   if( (state->windowSize > 0) && !state->window )
+      return TA_BAD_PARAM;
+#endif /* TA_FUNC_NO_RANGE_CHECK */
+
+   nbElement = updateState( state, bar, outReal );
+   if( nbElement < 0 )
+      return TA_BAD_PARAM;
+
+   *outNBElement = nbElement;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_StreamRun( TA_StreamState *state,
+                         int             nbBars,
+                         const double    inHigh[],
+                         const double    inLow[],
+                         const double    inClose[],
+                         int            *outBegIdx,
+                         int            *outNBElement,
+                         double          outReal[] )
+{
+   TA_Bar bar;
+   double *steadyOut;
+   int i, outIdx, nbElement;
+
+#ifndef TA_FUNC_NO_RANGE_CHECK
+   if( !state || (nbBars < 0) || !inClose || !outBegIdx || !outNBElement || !outReal )
+      return TA_BAD_PARAM;
+
+   if( ((state->funcId == TA_STREAM_ATR) || (state->funcId == TA_STREAM_ADX)) &&
+       (!inHigh || !inLow) )
+      return TA_BAD_PARAM;
+
+   if( (state->windowSize > 0) && !state->window )
+      return TA_BAD_PARAM;
+#endif /* TA_FUNC_NO_RANGE_CHECK */
+
+   *outBegIdx    = 0;
+   *outNBElement = 0;
+
+   memset( &bar, 0, sizeof(TA_Bar) );
+   outIdx = 0;
+   for( i=0; i < nbBars; i++ )
+   {
+      /* Past its lookback, a SMA or an EMA consumes the rest of the
+       * chunk in a tight loop.
+       */
+      if( isSteady( state ) )
+      {
+         steadyOut = &outReal[outIdx];
+         runSteady( &state, 1, nbBars-i, &inClose[i], &steadyOut );
+         if( outIdx == 0 )
+            *outBegIdx = i;
+         outIdx += nbBars-i;
+         break;
+      }
+
+      /* Read the bar before writing the output, which can be
+       * one of the inputs.
+       */
+      if( inHigh )
+         bar.high = inHigh[i];
+      if( inLow )
+         bar.low = inLow[i];
+      bar.close = inClose[i];
+
+      nbElement = updateState( state, &bar, &outReal[outIdx] );
+      if( nbElement < 0 )
+         return TA_BAD_PARAM;
+      if( nbElement )
+      {
+         if( outIdx == 0 )
+            *outBegIdx = i;
+         outIdx++;
+      }
+   }
+
+   *outNBElement = outIdx;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_StreamRunBlocked( TA_StreamState  states[],
+                                int             nbStates,
+                                int             nbBars,
+                                int             tileSize,
+                                const double    inHigh[],
+                                const double    inLow[],
+                                const double    inClose[],
+                                int             outBegIdx[],
+                                int             outNBElement[],
+                                double         *const outReal[] )
+{
+   TA_RetCode retCode;
+   TA_StreamState *group[STEADY_GROUP];
+   double *groupOut[STEADY_GROUP];
+   int i, j, g, nbGroup, tileIdx, size, tileBegIdx, tileNBElement;
+   char *done;
+
+#ifndef TA_FUNC_NO_RANGE_CHECK
+   if( !states || (nbStates < 0) || (nbBars < 0) || (tileSize < 0) ||
+       !inClose || !outBegIdx || !outNBElement || !outReal )
+      return TA_BAD_PARAM;
+
+   for( i=0; i < nbStates; i++ )
+   {
+      if( !outReal[i] || (outReal[i] == inHigh) || (outReal[i] == inLow) || (outReal[i] == inClose) )
+         return TA_BAD_PARAM;
+   }
+#endif /* TA_FUNC_NO_RANGE_CHECK */
+
+   if( tileSize == 0 )
+      tileSize = TA_STREAM_TILE_SIZE;
+
+   for( i=0; i < nbStates; i++ )
+   {
+      outBegIdx[i]    = 0;
+      outNBElement[i] = 0;
+   }
+
+   done = (char *)TA_Malloc( nbStates+1 );
+   if( !done )
+      return TA_ALLOC_ERR;
+
+   /* The state keeps the lookback of the previous tiles (window,
+    * previous values...), so the tiles do not overlap.
+    */
+   retCode = TA_SUCCESS;
+   for( tileIdx=0; (tileIdx < nbBars) && (retCode == TA_SUCCESS); tileIdx += size )
+   {
+      size = min( tileSize, nbBars-tileIdx );
+      memset( done, 0, nbStates );
+
+      /* The steady SMA and EMA are advanced by groups of the same
+       * function, on the whole tile.
+       */
+      for( i=0; i < nbStates; i++ )
+      {
+         if( done[i] || !isSteady( &states[i] ) )
+            continue;
+
+         nbGroup = 0;
+         for( j=i; (j < nbStates) && (nbGroup < STEADY_GROUP); j++ )
+         {
+            if( done[j] || (states[j].funcId != states[i].funcId) || !isSteady( &states[j] ) )
+               continue;
+            group[nbGroup]    = &states[j];
+            groupOut[nbGroup] = &outReal[j][outNBElement[j]];
+            nbGroup++;
+            done[j] = 1;
+         }
+         runSteady( group, nbGroup, size, &inClose[tileIdx], groupOut );
+
+         for( g=0; g < nbGroup; g++ )
+         {
+            j = (int)(group[g]-states);
+            if( outNBElement[j] == 0 )
+               outBegIdx[j] = tileIdx;
+            outNBElement[j] += size;
+         }
+      }
+
+      for( i=0; i < nbStates; i++ )
+      {
+         if( done[i] )
+            continue;
+
+         retCode = TA_StreamRun( &states[i], size,
+                                 inHigh? &inHigh[tileIdx] : NULL,
+                                 inLow?  &inLow[tileIdx]  : NULL,
+                                 &inClose[tileIdx],
+                                 &tileBegIdx, &tileNBElement,
+                                 &outReal[i][outNBElement[i]] );
+         if( retCode != TA_SUCCESS )
+            break;
+
+         if( tileNBElement && (outNBElement[i] == 0) )
+            outBegIdx[i] = tileIdx+tileBegIdx;
+         outNBElement[i] += tileNBElement;
+      }
+   }
+
+   TA_Free( done );
+
+   return retCode;
+}
+
+/**** Local functions definitions.     ****/
+static TA_RetCode initState( TA_StreamState *state, TA_StreamFuncId funcId,
+                             int optInTimePeriod, double optInFastLimit,
+                             double optInSlowLimit )
+{
+   if( !state )
+      return TA_BAD_PARAM;
+
+   memset( state, 0, sizeof(TA_StreamState) );
+
+   if( ((int)funcId < 0) || (funcId >= TA_STREAM_NB_FUNC) )
+      return TA_BAD_PARAM;
+
+   if( (funcId == TA_STREAM_MAMA) || (funcId == TA_STREAM_FAMA) )
+   {
+      /* No period, only the limits. */
+      if( optInTimePeriod != TA_INTEGER_DEFAULT )
+         return TA_BAD_PARAM;
+      if( optInFastLimit == TA_REAL_DEFAULT )
+         optInFastLimit = 5.000000e-1;
+      else if( (optInFastLimit < 1.000000e-2) || (optInFastLimit > 9.900000e-1) )
+         return TA_BAD_PARAM;
+      if( optInSlowLimit == TA_REAL_DEFAULT )
+         optInSlowLimit = 5.000000e-2;
+      else if( (optInSlowLimit < 1.000000e-2) || (optInSlowLimit > 9.900000e-1) )
+         return TA_BAD_PARAM;
+      optInTimePeriod = 0;
+   }
+   else
+   {
+      if( optInTimePeriod == TA_INTEGER_DEFAULT )
+         optInTimePeriod = streamFuncDef[funcId].defaultPeriod;
+      if( (optInTimePeriod < streamFuncDef[funcId].minPeriod) || (optInTimePeriod > 100000) )
+         return TA_BAD_PARAM;
+   }
+
+   state->funcId          = funcId;
+   state->optInTimePeriod = optInTimePeriod;
+   state->compatibility   = TA_GLOBALS_COMPATIBILITY;
+   state->precision       = TA_GLOBALS_PRECISION;
+
+   switch( funcId )
+   {
+   case TA_STREAM_SMA:
+      state->lookback = TA_SMA_Lookback( optInTimePeriod );
+      state->windowSize = optInTimePeriod;
+      break;
+   case TA_STREAM_EMA:
+      state->lookback = TA_EMA_Lookback( optInTimePeriod );
+      state->unstablePeriod = TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_EMA,Ema);
+      state->u.ema.k = PER_TO_K( optInTimePeriod );
+      break;
+   case TA_STREAM_RSI:
+      state->lookback = TA_RSI_Lookback( optInTimePeriod );
+      state->unstablePeriod = TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_RSI,Rsi);
+      break;
+   case TA_STREAM_ATR:
+      state->lookback = TA_ATR_Lookback( optInTimePeriod );
+      state->unstablePeriod = TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_ATR,Atr);
+      break;
+   case TA_STREAM_ADX:
+      state->lookback = TA_ADX_Lookback( optInTimePeriod );
+      state->unstablePeriod = TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_ADX,Adx);
+      break;
+   case TA_STREAM_KAMA:
+      state->lookback = TA_KAMA_Lookback( optInTimePeriod );
+      state->unstablePeriod = TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_KAMA,Kama);
+      state->windowSize = optInTimePeriod;
+      break;
+   case TA_STREAM_MAMA:
+   case TA_STREAM_FAMA:
+      state->lookback = TA_MAMA_Lookback( optInFastLimit, optInSlowLimit );
+      state->unstablePeriod = TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_MAMA,Mama);
+      state->u.mama.fastLimit = optInFastLimit;
+      state->u.mama.slowLimit = optInSlowLimit;
+      state->u.mama.rad2Deg   = 180.0 / (4.0 * std_atan(1));
+      break;
+   default:
+      return TA_BAD_PARAM;
+   }
+
+   if( state->lookback < 0 )
+      return TA_BAD_PARAM;
+
+   if( state->windowSize > 0 )
+   {
+      state->window = (double *)TA_Malloc( sizeof(double)*state->windowSize );
+      if( !state->window )
+      {
+         state->windowSize = 0;
+         return TA_ALLOC_ERR;
+      }
+   }
+
+   return TA_SUCCESS;
+}
+
+/* Consume one bar, return 1 when *outReal was written or -1 when
+ * the state is not initialized.
+ */
+static int updateState( TA_StreamState *state, const TA_Bar *bar, double *outReal )
+{
+   int nbElement;
+
+   switch( state->funcId )
+   {
+   case TA_STREAM_SMA:
+      nbElement = updateSMA( state, bar->close, outReal );
+      break;
+   case TA_STREAM_EMA:
+      nbElement = updateEMA( state, bar->close, outReal );
+      break;
+   case TA_STREAM_RSI:
+      nbElement = updateRSI( state, bar->close, outReal );
+      break;
+   case TA_STREAM_ATR:
+      nbElement = updateATR( state, bar, outReal );
+      break;
+   case TA_STREAM_ADX:
+      nbElement = updateADX( state, bar, outReal );
+      break;
+   case TA_STREAM_KAMA:
+      nbElement = updateKAMA( state, bar->close, outReal );
+      break;
+   case TA_STREAM_MAMA:
+   case TA_STREAM_FAMA:
+      nbElement = updateMAMA( state, bar->close, outReal );
+      break;
+   default:
+      return -1;
+   }
+
+   /* Stop counting once past both the lookback and the initial
+    * period, this is all what is needed and avoid overflow on
+    * long stream.
+    */
+   if( (state->nbBars <= state->lookback) || (state->nbBars <= state->optInTimePeriod) )
+      state->nbBars++;
+
+   return nbElement;
+}
+
+/* A SMA (not compensated) or an EMA which no longer counts the bars
+ * (past the lookback and the period) can skip updateState.
+ */
+static int isSteady( const TA_StreamState *state )
+{
+   if( (state->nbBars <= state->lookback) || (state->nbBars <= state->optInTimePeriod) )
+      return 0;
+
+   return (state->funcId == TA_STREAM_EMA) ||
+          ((state->funcId == TA_STREAM_SMA) && (state->precision != TA_PRECISION_COMPENSATED));
+}
+
+/* Same operations as updateSMA and updateEMA for the nbGroup steady
+ * states of the group (at most STEADY_GROUP), all of the same
+ * function, on the same bars.
+ *
+ * The states are advanced together bar by bar: their recurrences are
+ * independent, so the processor overlaps them instead of waiting for
+ * the previous value of a single state. The values are kept in local
+ * variables, the outputs can not alias them.
+ *
+ * outReal[g][i] is written after inClose[i] is read, an output can be
+ * the input when there is a single state.
+ */
+static void runSteady( TA_StreamState *const group[], int nbGroup, int nbBars,
+                       const double inClose[], double *const outReal[] )
+{
+   double prevMA[STEADY_GROUP], k[STEADY_GROUP], periodTotal[STEADY_GROUP];
+   double *window[STEADY_GROUP], value, tempReal, total, ma, *out;
+   int windowIdx[STEADY_GROUP], windowSize[STEADY_GROUP], period[STEADY_GROUP];
+   int i, g, idx;
+
+   if( group[0]->funcId == TA_STREAM_EMA )
+   {
+      for( g=0; g < nbGroup; g++ )
+      {
+         prevMA[g] = group[g]->u.ema.prevMA;
+         k[g]      = group[g]->u.ema.k;
+      }
+
+      if( nbGroup == 1 )
+      {
+         ma  = prevMA[0];
+         out = outReal[0];
+         for( i=0; i < nbBars; i++ )
+         {
+            ma = ((inClose[i]-ma)*k[0]) + ma;
+            out[i] = ma;
+         }
+         prevMA[0] = ma;
+      }
+      else
+      {
+         for( i=0; i < nbBars; i++ )
+         {
+            value = inClose[i];
+            for( g=0; g < nbGroup; g++ )
+            {
+               prevMA[g] = ((value-prevMA[g])*k[g]) + prevMA[g];
+               outReal[g][i] = prevMA[g];
+            }
+         }
+      }
+
+      for( g=0; g < nbGroup; g++ )
+         group[g]->u.ema.prevMA = prevMA[g];
+      return;
+   }
+
+   for( g=0; g < nbGroup; g++ )
+   {
+      periodTotal[g] = group[g]->u.sma.periodTotal;
+      window[g]      = group[g]->window;
+      windowIdx[g]   = group[g]->windowIdx;
+      windowSize[g]  = group[g]->windowSize;
+      period[g]      = group[g]->optInTimePeriod;
+   }
+
+   if( nbGroup == 1 )
+   {
+      total = periodTotal[0];
+      idx   = windowIdx[0];
+      out   = outReal[0];
+      for( i=0; i < nbBars; i++ )
+      {
+         value = inClose[i];
+         total += value;
+         window[0][idx] = value;
+         if( ++idx == windowSize[0] )
+            idx = 0;
+         tempReal = total;
+         total -= window[0][idx];
+         out[i] = tempReal / period[0];
+      }
+      periodTotal[0] = total;
+      windowIdx[0]   = idx;
+   }
+   else
+   {
+      for( i=0; i < nbBars; i++ )
+      {
+         value = inClose[i];
+         for( g=0; g < nbGroup; g++ )
+         {
+            periodTotal[g] += value;
+            window[g][windowIdx[g]] = value;
+            if( ++windowIdx[g] == windowSize[g] )
+               windowIdx[g] = 0;
+            tempReal = periodTotal[g];
+            periodTotal[g] -= window[g][windowIdx[g]];
+            outReal[g][i] = tempReal / period[g];
+         }
+      }
+   }
+
+   for( g=0; g < nbGroup; g++ )
+   {
+      group[g]->u.sma.periodTotal = periodTotal[g];
+      group[g]->windowIdx         = windowIdx[g];
+   }
+}
+
+/* Each update function returns 1 when *outReal was written.
+ * state->nbBars is the index of the bar being consumed (saturated
+ * past the lookback and the period).
+ */
+static int updateSMA( TA_StreamState *state, double value, double *outReal )
+{
+   double tempReal;
+
+   if( state->precision == TA_PRECISION_COMPENSATED )
+   {
+      TA_SUM_ADD( state->u.sma.periodTotal, state->u.sma.periodComp, value );
+   }
+   else
+      state->u.sma.periodTotal += value;
+   state->window[state->windowIdx] = value;
+   if( ++state->windowIdx == state->windowSize )
+      state->windowIdx = 0;
+
+   if( state->nbBars < state->lookback )
+      return 0;
+
+   /* The window slot following the newest one is the oldest. */
+   if( state->precision == TA_PRECISION_COMPENSATED )
+   {
+      tempReal = state->u.sma.periodTotal + state->u.sma.periodComp;
+      value = -state->window[state->windowIdx];
+      TA_SUM_ADD( state->u.sma.periodTotal, state->u.sma.periodComp, value );
+      TA_SUM_NORM( state->u.sma.periodTotal, state->u.sma.periodComp );
+   }
+   else
+   {
+      tempReal = state->u.sma.periodTotal;
+      state->u.sma.periodTotal -= state->window[state->windowIdx];
+   }
+   *outReal = tempReal / state->optInTimePeriod;
+
+   return 1;
+}
+
+static int updateEMA( TA_StreamState *state, double value, double *outReal )
+{
+   int period = state->optInTimePeriod;
+
+   if( state->compatibility == TA_COMPATIBILITY_DEFAULT )
+   {
+      /* The seed is a simple average of the first period. */
+      if( state->nbBars < period )
+      {
+         state->u.ema.prevMA += value;
+         if( state->nbBars < period-1 )
+            return 0;
+         state->u.ema.prevMA /= period;
+      }
+      else
+         state->u.ema.prevMA = ((value-state->u.ema.prevMA)*state->u.ema.k) + state->u.ema.prevMA;
+   }
+   else
+   {
+      /* Metastock use the first price bar as the seed. */
+      if( state->nbBars == 0 )
+         state->u.ema.prevMA = value;
+      else
+         state->u.ema.prevMA = ((value-state->u.ema.prevMA)*state->u.ema.k) + state->u.ema.prevMA;
+   }
+
+   if( state->nbBars < state->lookback )
+      return 0;
+
+   *outReal = state->u.ema.prevMA;
+
+   return 1;
+}
+
+static int updateRSI( TA_StreamState *state, double value, double *outReal )
+{
+   int period = state->optInTimePeriod;
+   double tempValue1, tempValue2;
+
+   if( state->nbBars == 0 )
+   {
+      state->u.rsi.prevValue = value;
+      return 0;
+   }
+
+   tempValue2 = value - state->u.rsi.prevValue;
+   state->u.rsi.prevValue = value;
+
+   if( state->nbBars <= period )
+   {
+      /* Accumulate the initial period. */
+      if( tempValue2 < 0 )
+         state->u.rsi.prevLoss -= tempValue2;
+      else
+         state->u.rsi.prevGain += tempValue2;
+
+      if( state->nbBars < period )
+      {
+         /* The additional price bar particular to Metastock (see TA_RSI).
+          * The first bar is assumed identical to the previous one, so
+          * the accumulation so far is already the one needed.
+          */
+         if( (state->nbBars == period-1) &&
+             (state->unstablePeriod == 0) &&
+             (state->compatibility == TA_COMPATIBILITY_METASTOCK) )
+         {
+            tempValue1 = state->u.rsi.prevLoss/period;
+            tempValue2 = state->u.rsi.prevGain/period;
+            tempValue1 = tempValue2+tempValue1;
+            if( !TA_IS_ZERO(tempValue1) )
+               *outReal = 100*(tempValue2/tempValue1);
+            else
+               *outReal = 0.0;
+            return 1;
+         }
+         return 0;
+      }
+
+      state->u.rsi.prevLoss /= period;
+      state->u.rsi.prevGain /= period;
+   }
+   else
+   {
+      /* Wilder's smoothing. */
+      state->u.rsi.prevLoss *= (period-1);
+      state->u.rsi.prevGain *= (period-1);
+      if( tempValue2 < 0 )
+         state->u.rsi.prevLoss -= tempValue2;
+      else
+         state->u.rsi.prevGain += tempValue2;
+
+      state->u.rsi.prevLoss /= period;
+      state->u.rsi.prevGain /= period;
+   }
+
+   if( state->nbBars < state->lookback )
+      return 0;
+
+   tempValue1 = state->u.rsi.prevGain+state->u.rsi.prevLoss;
+   if( !TA_IS_ZERO(tempValue1) )
+      *outReal = 100.0*(state->u.rsi.prevGain/tempValue1);
+   else
+      *outReal = 0.0;
+
+   return 1;
+}
+
+static int updateATR( TA_StreamState *state, const TA_Bar *bar, double *outReal )
+{
+   int period = state->optInTimePeriod;
+   double val2, val3, greatest;
+
+   if( state->nbBars == 0 )
+   {
+      state->u.atr.prevClose = bar->close;
+      return 0;
+   }
+
+   /* Same as TA_TRANGE. */
+   greatest = bar->high - bar->low;
+   val2 = std_fabs( state->u.atr.prevClose - bar->high );
+   if( val2 > greatest )
+      greatest = val2;
+   val3 = std_fabs( state->u.atr.prevClose - bar->low );
+   if( val3 > greatest )
+      greatest = val3;
+   state->u.atr.prevClose = bar->close;
+
+   if( period <= 1 )
+      state->u.atr.prevATR = greatest;
+   else if( state->nbBars <= period )
+   {
+      /* First value is a simple average of the TRANGE. */
+      state->u.atr.prevATR += greatest;
+      if( state->nbBars < period )
+         return 0;
+      state->u.atr.prevATR /= period;
+   }
+   else
+   {
+      /* Wilder's smoothing. */
+      state->u.atr.prevATR *= period - 1;
+      state->u.atr.prevATR += greatest;
+      state->u.atr.prevATR /= period;
+   }
+
+   if( state->nbBars < state->lookback )
+      return 0;
+
+   *outReal = state->u.atr.prevATR;
+
+   return 1;
+}
+
+static int updateADX( TA_StreamState *state, const TA_Bar *bar, double *outReal )
+{
+   int period = state->optInTimePeriod;
+   double diffP, diffM, trueRange, tempReal, minusDI, plusDI;
+
+   if( state->nbBars == 0 )
+   {
+      state->u.adx.prevHigh  = bar->high;
+      state->u.adx.prevLow   = bar->low;
+      state->u.adx.prevClose = bar->close;
+      return 0;
+   }
+
+   diffP = bar->high-state->u.adx.prevHigh; /* Plus Delta */
+   state->u.adx.prevHigh = bar->high;
+   diffM = state->u.adx.prevLow-bar->low;   /* Minus Delta */
+   state->u.adx.prevLow = bar->low;
+
+   /* The first DM and TR are a sum, then Wilder's smoothing. */
+   if( state->nbBars >= period )
+   {
+      state->u.adx.prevMinusDM -= state->u.adx.prevMinusDM/period;
+      state->u.adx.prevPlusDM  -= state->u.adx.prevPlusDM/period;
+   }
+
+   if( (diffM > 0) && (diffP < diffM) )
+      state->u.adx.prevMinusDM += diffM;
+   else if( (diffP > 0) && (diffP > diffM) )
+      state->u.adx.prevPlusDM += diffP;
+
+   /* Same as TA_TRANGE. */
+   trueRange = bar->high-bar->low;
+   tempReal = std_fabs( bar->high-state->u.adx.prevClose );
+   if( tempReal > trueRange )
+      trueRange = tempReal;
+   tempReal = std_fabs( bar->low-state->u.adx.prevClose );
+   if( tempReal > trueRange )
+      trueRange = tempReal;
+   state->u.adx.prevClose = bar->close;
+
+   if( state->nbBars < period )
+   {
+      state->u.adx.prevTR += trueRange;
+      return 0;
+   }
+   state->u.adx.prevTR = state->u.adx.prevTR - (state->u.adx.prevTR/period) + trueRange;
+
+   if( !TA_IS_ZERO(state->u.adx.prevTR) )
+   {
+      minusDI  = 100.0*(state->u.adx.prevMinusDM/state->u.adx.prevTR);
+      plusDI   = 100.0*(state->u.adx.prevPlusDM/state->u.adx.prevTR);
+      tempReal = minusDI+plusDI;
+      if( !TA_IS_ZERO(tempReal) )
+      {
+         tempReal = 100.0*(std_fabs(minusDI-plusDI)/tempReal);
+         if( state->nbBars < 2*period )
+            state->u.adx.sumDX += tempReal;
+         else
+            state->u.adx.prevADX = ((state->u.adx.prevADX*(period-1))+tempReal)/period;
+      }
+   }
+
+   /* The first ADX is the average of the first period of DX. */
+   if( state->nbBars == 2*period-1 )
+      state->u.adx.prevADX = state->u.adx.sumDX/period;
+
+   if( state->nbBars < state->lookback )
+      return 0;
+
+   *outReal = state->u.adx.prevADX;
+
+   return 1;
+}
+
+static int updateKAMA( TA_StreamState *state, double value, double *outReal )
+{
+   const double constMax = 2.0/(30.0+1.0);
+   const double constDiff = 2.0/(2.0+1.0) - constMax;
+   int period = state->optInTimePeriod;
+   double tempReal, trailing, periodROC;
+
+   /* The window holds the last 'period' values, the slot of
+    * windowIdx is the value of 'period' bars ago.
+    */
+   if( state->nbBars < period )
+   {
+      if( state->nbBars > 0 )
+         state->u.kama.sumROC1 += std_fabs(state->u.kama.prevValue-value);
+      state->u.kama.prevValue = value;
+      state->window[state->windowIdx] = value;
+      if( ++state->windowIdx == state->windowSize )
+         state->windowIdx = 0;
+      return 0;
+   }
+
+   trailing = state->window[state->windowIdx];
+   state->window[state->windowIdx] = value;
+   if( ++state->windowIdx == state->windowSize )
+      state->windowIdx = 0;
+
+   if( state->nbBars == period )
+   {
+      /* The first KAMA uses the yesterday price as the previous KAMA. */
+      state->u.kama.sumROC1 += std_fabs(state->u.kama.prevValue-value);
+      state->u.kama.prevKAMA = state->u.kama.prevValue;
+   }
+   else
+   {
+      state->u.kama.sumROC1 -= std_fabs(state->u.kama.trailingValue-trailing);
+      state->u.kama.sumROC1 += std_fabs(value-state->u.kama.prevValue);
+   }
+   periodROC = value-trailing;
+   state->u.kama.trailingValue = trailing;
+   state->u.kama.prevValue = value;
+
+   /* Calculate the efficiency ratio */
+   if( (state->u.kama.sumROC1 <= periodROC) || TA_IS_ZERO(state->u.kama.sumROC1) )
+      tempReal = 1.0;
+   else
+      tempReal = std_fabs(periodROC/state->u.kama.sumROC1);
+
+   /* Calculate the smoothing constant */
+   tempReal  = (tempReal*constDiff)+constMax;
+   tempReal *= tempReal;
+
+   state->u.kama.prevKAMA = ((value-state->u.kama.prevKAMA)*tempReal) + state->u.kama.prevKAMA;
+
+   if( state->nbBars < state->lookback )
+      return 0;
+
+   *outReal = state->u.kama.prevKAMA;
+
+   return 1;
+}
+
+static int updateMAMA( TA_StreamState *state, double value, double *outReal )
+{
+   double tempReal, tempReal2, smoothedValue, adjustedPrevPeriod;
+   double detrender, Q1, jI, jQ, Q2, I2;
+   int isLookback;
+
+   isLookback = (state->nbBars < state->lookback);
+
+   if( state->nbBars < MAMA_NB_INIT_WMA )
+   {
+      /* Initialization of the price smoother (a WMA). */
+      state->u.mama.periodWMASub += value;
+      state->u.mama.periodWMASum += value*(state->nbBars+1);
+      state->u.mama.price[state->nbBars] = value;
+      state->u.mama.isOdd = state->nbBars & 1;
+      return 0;
+   }
+
+   adjustedPrevPeriod = (0.075*state->u.mama.period)+0.54;
+
+   /* Same as DO_PRICE_WMA in TA_MAMA, the trailing value is the
+    * price of 3 bars ago.
+    */
+   state->u.mama.periodWMASub += value;
+   state->u.mama.periodWMASub -= state->u.mama.trailingWMAValue;
+   state->u.mama.periodWMASum += value*4.0;
+   state->u.mama.trailingWMAValue = state->u.mama.price[state->u.mama.priceIdx];
+   state->u.mama.price[state->u.mama.priceIdx] = value;
+   if( ++state->u.mama.priceIdx == 3 )
+      state->u.mama.priceIdx = 0;
+   smoothedValue = state->u.mama.periodWMASum*0.1;
+   state->u.mama.periodWMASum -= state->u.mama.periodWMASub;
+
+   /* The parity of the bar index is kept apart, nbBars stops
+    * counting after the lookback.
+    */
+   state->u.mama.isOdd = !state->u.mama.isOdd;
+   if( state->nbBars < MAMA_NB_INIT )
+      return 0;
+
+   if( !state->u.mama.isOdd )
+   {
+      detrender = hilbertTransform( &state->u.mama.detrender, 0, state->u.mama.hilbertIdx, smoothedValue, adjustedPrevPeriod );
+      Q1 = hilbertTransform( &state->u.mama.Q1, 0, state->u.mama.hilbertIdx, detrender, adjustedPrevPeriod );
+      jI = hilbertTransform( &state->u.mama.jI, 0, state->u.mama.hilbertIdx, state->u.mama.I1ForEvenPrev3, adjustedPrevPeriod );
+      jQ = hilbertTransform( &state->u.mama.jQ, 0, state->u.mama.hilbertIdx, Q1, adjustedPrevPeriod );
+      if( ++state->u.mama.hilbertIdx == 3 )
+         state->u.mama.hilbertIdx = 0;
+
+      Q2 = (0.2*(Q1 + jI)) + (0.8*state->u.mama.prevQ2);
+      I2 = (0.2*(state->u.mama.I1ForEvenPrev3 - jQ)) + (0.8*state->u.mama.prevI2);
+
+      state->u.mama.I1ForOddPrev3 = state->u.mama.I1ForOddPrev2;
+      state->u.mama.I1ForOddPrev2 = detrender;
+
+      if( state->u.mama.I1ForEvenPrev3 != 0.0 )
+         tempReal2 = (std_atan(Q1/state->u.mama.I1ForEvenPrev3)*state->u.mama.rad2Deg);
+      else
+         tempReal2 = 0.0;
+   }
+   else
+   {
+      detrender = hilbertTransform( &state->u.mama.detrender, 1, state->u.mama.hilbertIdx, smoothedValue, adjustedPrevPeriod );
+      Q1 = hilbertTransform( &state->u.mama.Q1, 1, state->u.mama.hilbertIdx, detrender, adjustedPrevPeriod );
+      jI = hilbertTransform( &state->u.mama.jI, 1, state->u.mama.hilbertIdx, state->u.mama.I1ForOddPrev3, adjustedPrevPeriod );
+      jQ = hilbertTransform( &state->u.mama.jQ, 1, state->u.mama.hilbertIdx, Q1, adjustedPrevPeriod );
+
+      Q2 = (0.2*(Q1 + jI)) + (0.8*state->u.mama.prevQ2);
+      I2 = (0.2*(state->u.mama.I1ForOddPrev3 - jQ)) + (0.8*state->u.mama.prevI2);
+
+      state->u.mama.I1ForEvenPrev3 = state->u.mama.I1ForEvenPrev2;
+      state->u.mama.I1ForEvenPrev2 = detrender;
+
+      if( state->u.mama.I1ForOddPrev3 != 0.0 )
+         tempReal2 = (std_atan(Q1/state->u.mama.I1ForOddPrev3)*state->u.mama.rad2Deg);
+      else
+         tempReal2 = 0.0;
+   }
+
+   /* Put Delta Phase into tempReal */
+   tempReal = state->u.mama.prevPhase - tempReal2;
+   state->u.mama.prevPhase = tempReal2;
+   if( tempReal < 1.0 )
+      tempReal = 1.0;
+
+   /* Put Alpha into tempReal */
+   if( tempReal > 1.0 )
+   {
+      tempReal = state->u.mama.fastLimit/tempReal;
+      if( tempReal < state->u.mama.slowLimit )
+         tempReal = state->u.mama.slowLimit;
+   }
+   else
+      tempReal = state->u.mama.fastLimit;
+
+   state->u.mama.mama = (tempReal*value)+((1-tempReal)*state->u.mama.mama);
+   tempReal *= 0.5;
+   state->u.mama.fama = (tempReal*state->u.mama.mama)+((1-tempReal)*state->u.mama.fama);
+
+   /* Adjust the period for next price bar */
+   state->u.mama.Re = (0.2*((I2*state->u.mama.prevI2)+(Q2*state->u.mama.prevQ2)))+(0.8*state->u.mama.Re);
+   state->u.mama.Im = (0.2*((I2*state->u.mama.prevQ2)-(Q2*state->u.mama.prevI2)))+(0.8*state->u.mama.Im);
+   state->u.mama.prevQ2 = Q2;
+   state->u.mama.prevI2 = I2;
+   tempReal = state->u.mama.period;
+   if( (state->u.mama.Im != 0.0) && (state->u.mama.Re != 0.0) )
+      state->u.mama.period = 360.0 / (std_atan(state->u.mama.Im/state->u.mama.Re)*state->u.mama.rad2Deg);
+   tempReal2 = 1.5*tempReal;
+   if( state->u.mama.period > tempReal2 )
+      state->u.mama.period = tempReal2;
+   tempReal2 = 0.67*tempReal;
+   if( state->u.mama.period < tempReal2 )
+      state->u.mama.period = tempReal2;
+   if( state->u.mama.period < 6 )
+      state->u.mama.period = 6;
+   else if( state->u.mama.period > 50 )
+      state->u.mama.period = 50;
+   state->u.mama.period = (0.2*state->u.mama.period) + (0.8 * tempReal);
+
+   if( isLookback )
+      return 0;
+
+   *outReal = (state->funcId == TA_STREAM_MAMA)? state->u.mama.mama : state->u.mama.fama;
+
+   return 1;
+}
+
+/* Same sequence of operations as DO_HILBERT_TRANSFORM, returns the
+ * transformed value.
+ */
+static double hilbertTransform( TA_StreamHilbert *hilbert, int isOdd, int hilbertIdx,
+                                double input, double adjustedPrevPeriod )
+{
+   const double a = 0.0962;
+   const double b = 0.5769;
+   double hilbertTempReal, value;
+   double *buffer = isOdd? hilbert->odd : hilbert->even;
+   double *prev = isOdd? &hilbert->prevOdd : &hilbert->prevEven;
+   double *prevInput = isOdd? &hilbert->prevInputOdd : &hilbert->prevInputEven;
+
+   hilbertTempReal = a * input;
+   value = -buffer[hilbertIdx];
+   buffer[hilbertIdx] = hilbertTempReal;
+   value += hilbertTempReal;
+   value -= *prev;
+   *prev = b * (*prevInput);
+   value += *prev;
+   *prevInput = input;
+   value *= adjustedPrevPeriod;
+
+   return value;
+}
@@ -0,0 +1,653 @@
+/* Description:
+ *   Internal helpers shared by the TA functions (see ta_utility.h).
+ *
+ *   TA_OrdStat: rolling window of values kept in a treap, each node
+ *   with the count and the sum of its subtree. The node of a value is
+ *   its slot in the window, so no allocation is done after the init.
+ *   The order is (value, slot): all the keys are distinct, and a NaN
+ *   is after all the other values.
+ *
+ *   The node 'period' is an empty sentinel (size and sum at 0) used
+ *   for the missing children, which avoids most of the tests in the
+ *   loops.
+ *
+ *   TA_WinSum: the sum of the window ending at a bar is the sum at the
+ *   previous bar plus the difference in[t]-in[t-period]. Instead of a
+ *   running total (each sum waits for the previous one), the
+ *   differences of a block are calculated together and added by a
+ *   prefix sum (scanBlock), WINSUM_LANES parts of the block at a time,
+ *   so the additions are independent and vectorized.
+ *
+ *   The rounding errors of the differences add up like in a running
+ *   total, so the sum of a window is calculated again directly at the
+ *   start of a block every max(period,WINSUM_ANCHOR) bars: the error
+ *   does not grow with the number of bars.
+ *
+ *   TA_Missing: reads the bars one by one for the kernels handling the
+ *   missing bars, so they need no pass to clean the input and can
+ *   still write their output over it.
+ *
+ *   TA_Moments: the sums of the powers of x, x^2... lose all their
+ *   precision in the central moments when the mean is large compared
+ *   to the deviations (prices). The sums are of the deviations from a
+ *   shift instead, the mean of the window when they were last done
+ *   directly: as long as the mean stays close to it, the cancellation
+ *   in TA_INT_MomentsCentral() is small and the rounding errors of
+ *   the updates are relative to the moments themselves.
+ *
+ *   (The updates of Welford/Pebay are stable when values are only
+ *   added; done backward to remove the oldest value, their errors
+ *   compound from one window to the next.)
+ */
+
+/**** Headers ****/
+#include <string.h>
+#include "ta_utility.h"
+
+/**** Local declarations.              ****/
+#define NODE(idx) (os->node[idx])
+#define NIL       (os->period)
+
+#define WINSUM_LANES  8
+#define WINSUM_ANCHOR 4096
+
+/**** Local functions declarations.    ****/
+static int  isBefore( const TA_OrdStat *os, double value, int slot, int idx );
+static void update( TA_OrdStat *os, int idx );
+static int  rotateRight( TA_OrdStat *os, int idx );
+static int  rotateLeft( TA_OrdStat *os, int idx );
+static int  insertNode( TA_OrdStat *os, int idx, int slot );
+static int  removeNode( TA_OrdStat *os, int idx, int slot );
+static void directSums( TA_WinSum *ws, int idx );
+static void scanBlock( double v[], int n );
+
+/**** Global functions definitions.   ****/
+TA_RetCode TA_INT_OrdStatInit( TA_OrdStat *os, int period )
+{
+   memset( os, 0, sizeof(TA_OrdStat) );
+
+   if( period < 1 )
+      return TA_BAD_PARAM;
+
+   os->node = (TA_OrdStatNode *)TA_Malloc( sizeof(TA_OrdStatNode)*(period+1) );
+   if( !os->node )
+      return TA_ALLOC_ERR;
+
+   os->period = period;
+   os->root   = NIL;
+   os->seed   = 2463534242u; /* Fixed, for reproducible results. */
+
+   memset( &NODE(NIL), 0, sizeof(TA_OrdStatNode) );
+   NODE(NIL).left  = NIL;
+   NODE(NIL).right = NIL;
+
+   return TA_SUCCESS;
+}
+
+void TA_INT_OrdStatFree( TA_OrdStat *os )
+{
+   FREE_IF_NOT_NULL( os->node );
+   os->period  = 0;
+   os->nbValue = 0;
+   os->root    = 0;
+}
+
+void TA_INT_OrdStatPush( TA_OrdStat *os, double value )
+{
+   int slot;
+
+   if( os->nbValue == os->period )
+   {
+      /* Re-use the slot of the oldest value. */
+      slot = os->oldest;
+      os->root = removeNode( os, os->root, slot );
+      if( ++os->oldest == os->period )
+         os->oldest = 0;
+   }
+   else
+   {
+      /* Filling up, the oldest is still the slot 0. */
+      slot = os->nbValue++;
+   }
+
+   /* xorshift32 */
+   os->seed ^= os->seed << 13;
+   os->seed ^= os->seed >> 17;
+   os->seed ^= os->seed << 5;
+
+   NODE(slot).value = value;
+   NODE(slot).prio  = os->seed;
+   NODE(slot).left  = NIL;
+   NODE(slot).right = NIL;
+   update( os, slot );
+   os->root = insertNode( os, os->root, slot );
+}
+
+double TA_INT_OrdStatSum( const TA_OrdStat *os )
+{
+   return NODE(os->root).sum;
+}
+
+void TA_INT_OrdStatBelow( const TA_OrdStat *os, double x, int *nbBelow, double *sumBelow )
+{
+   const TA_OrdStatNode *node;
+   int idx, nb;
+   double sum;
+
+   /* When a node is below, the node and its left subtree are
+    * counted and the search continues on the right.
+    */
+   nb  = 0;
+   sum = 0.0;
+   idx = os->root;
+   while( idx != NIL )
+   {
+      node = &NODE(idx);
+      if( node->value < x )
+      {
+         nb  += NODE(node->left).size + 1;
+         sum += NODE(node->left).sum + node->value;
+         idx  = node->right;
+      }
+      else
+         idx = node->left;
+   }
+
+   *nbBelow  = nb;
+   *sumBelow = sum;
+}
+
+double TA_INT_OrdStatAbsDev( const TA_OrdStat *os, double center )
+{
+   int nbBelow;
+   double sumBelow, sumAbove;
+
+   TA_INT_OrdStatBelow( os, center, &nbBelow, &sumBelow );
+   sumAbove = TA_INT_OrdStatSum( os ) - sumBelow;
+
+   return (center*nbBelow - sumBelow) + (sumAbove - center*(os->nbValue-nbBelow));
+}
+
+int TA_INT_OrdStatHasNaN( const TA_OrdStat *os )
+{
+   int idx;
+   double value;
+
+   if( os->root == NIL )
+      return 0;
+
+   /* Only the last value can be a NaN. */
+   idx = os->root;
+   while( NODE(idx).right != NIL )
+      idx = NODE(idx).right;
+   value = NODE(idx).value;
+
+   return value != value;
+}
+
+double TA_INT_OrdStatKth( const TA_OrdStat *os, int k )
+{
+   int idx, nbLeft;
+
+   idx = os->root;
+   while( idx != NIL )
+   {
+      nbLeft = NODE(NODE(idx).left).size;
+      if( k < nbLeft )
+         idx = NODE(idx).left;
+      else if( k == nbLeft )
+         return NODE(idx).value;
+      else
+      {
+         k  -= nbLeft+1;
+         idx = NODE(idx).right;
+      }
+   }
+
+   /* k out of range. */
+   return 0.0;
+}
+
+void TA_INT_OrdStatRank( const TA_OrdStat *os, double x, int *nbBelow, int *nbEqual )
+{
+   const TA_OrdStatNode *node;
+   int idx, nbNotAbove;
+
+   *nbBelow = 0;
+   idx = os->root;
+   while( idx != NIL )
+   {
+      node = &NODE(idx);
+      if( node->value < x )
+      {
+         *nbBelow += NODE(node->left).size + 1;
+         idx = node->right;
+      }
+      else
+         idx = node->left;
+   }
+
+   nbNotAbove = 0;
+   idx = os->root;
+   while( idx != NIL )
+   {
+      node = &NODE(idx);
+      if( node->value <= x )
+      {
+         nbNotAbove += NODE(node->left).size + 1;
+         idx = node->right;
+      }
+      else
+         idx = node->left;
+   }
+
+   *nbEqual = nbNotAbove - *nbBelow;
+}
+
+void TA_INT_WinSumInit( TA_WinSum *ws, const double *inReal,
+                        int firstIdx, int lastIdx, int period )
+{
+   ws->inReal  = inReal;
+   ws->period  = period;
+   ws->nextIdx = firstIdx;
+   ws->lastIdx = lastIdx;
+   if( firstIdx <= lastIdx )
+      directSums( ws, firstIdx );
+}
+
+int TA_INT_WinSumNext( TA_WinSum *ws, double sum[], double sumSq[] )
+{
+   const double *in = ws->inReal;
+   int period = ws->period;
+   int idx = ws->nextIdx;
+   double head, tail;
+   int k, n;
+
+   n = ws->lastIdx-idx+1;
+   if( n <= 0 )
+      return 0;
+   if( n > TA_WINSUM_BLOCK )
+      n = TA_WINSUM_BLOCK;
+
+   /* The sum at the first bar, then the differences from one
+    * bar to the next.
+    */
+   if( sum )
+   {
+      sum[0] = ws->sum;
+      for( k=1; k < n; k++ )
+         sum[k] = in[idx+k]-in[idx+k-period];
+      scanBlock( sum, n );
+   }
+   if( sumSq )
+   {
+      sumSq[0] = ws->sumSq;
+      for( k=1; k < n; k++ )
+      {
+         head = in[idx+k];
+         tail = in[idx+k-period];
+         sumSq[k] = head*head-tail*tail;
+      }
+      scanBlock( sumSq, n );
+   }
+
+   /* The sums at the start of the next block, before the caller
+    * writes the outputs of this one.
+    */
+   idx += n;
+   ws->nextIdx = idx;
+   if( idx <= ws->lastIdx )
+   {
+      if( (idx-ws->anchorIdx >= period) && (idx-ws->anchorIdx >= WINSUM_ANCHOR) )
+         directSums( ws, idx );
+      else
+      {
+         head = in[idx];
+         tail = in[idx-period];
+         if( sum )
+            ws->sum = sum[n-1]+(head-tail);
+         if( sumSq )
+            ws->sumSq = sumSq[n-1]+(head*head-tail*tail);
+      }
+   }
+
+   return n;
+}
+
+int TA_INT_MissingBegin( const double *inReal, const unsigned char *inValid,
+                         TA_MissingPolicy policy, int startIdx, int nbBack )
+{
+   int beginIdx, nbFound;
+
+   beginIdx = startIdx-nbBack;
+   switch( policy )
+   {
+   case TA_MISSING_SKIP:
+      /* nbBack bars not missing before startIdx. */
+      beginIdx = startIdx;
+      nbFound = 0;
+      while( (nbFound < nbBack) && (beginIdx > 0) )
+      {
+         beginIdx--;
+         if( !TA_IS_MISSING( inReal, inValid, beginIdx ) )
+            nbFound++;
+      }
+      break;
+   case TA_MISSING_CARRY_FORWARD:
+      /* Down to the bar carried to the first one. */
+      while( (beginIdx > 0) && TA_IS_MISSING( inReal, inValid, beginIdx ) )
+         beginIdx--;
+      break;
+   default:
+      break;
+   }
+
+   return beginIdx < 0? 0 : beginIdx;
+}
+
+void TA_INT_MissingInit( TA_Missing *m, const double *inReal, const unsigned char *inValid,
+                         TA_MissingPolicy policy, int beginIdx )
+{
+   memset( m, 0, sizeof(TA_Missing) );
+   m->inReal  = inReal;
+   m->inValid = inValid;
+   m->policy  = policy;
+   m->nextIdx = beginIdx;
+}
+
+int TA_INT_MissingNext( TA_Missing *m, double *value )
+{
+   int idx = m->nextIdx++;
+
+   if( !TA_IS_MISSING( m->inReal, m->inValid, idx ) )
+   {
+      *value = m->inReal[idx];
+      m->lastValue = *value;
+      m->hasLast   = 1;
+      return m->stopped? TA_MISSING_STEP_HOLD : TA_MISSING_STEP_PUSH;
+   }
+
+   switch( m->policy )
+   {
+   case TA_MISSING_SKIP:
+      return TA_MISSING_STEP_HOLD;
+   case TA_MISSING_CARRY_FORWARD:
+      if( !m->hasLast )
+         return TA_MISSING_STEP_HOLD;
+      *value = m->lastValue;
+      return TA_MISSING_STEP_PUSH;
+   case TA_MISSING_RESET:
+      return TA_MISSING_STEP_RESTART;
+   default:
+      if( m->stopped )
+         return TA_MISSING_STEP_HOLD;
+      m->stopped = 1;
+      return TA_MISSING_STEP_RESTART;
+   }
+}
+
+void TA_INT_MomentsSet( TA_Moments *m, const double *inReal, int n )
+{
+   double shift, delta, delta2, s1, s2, s3, s4;
+   int i;
+
+   /* Two passes: the mean, then the deviations from it. */
+   shift = 0.0;
+   for( i=0; i < n; i++ )
+      shift += inReal[i];
+   shift /= n;
+
+   s1 = s2 = s3 = s4 = 0.0;
+   for( i=0; i < n; i++ )
+   {
+      delta  = inReal[i]-shift;
+      delta2 = delta*delta;
+      s1 += delta;
+      s2 += delta2;
+      s3 += delta2*delta;
+      s4 += delta2*delta2;
+   }
+
+   m->n     = (double)n;
+   m->shift = shift;
+   m->s1    = s1;
+   m->s2    = s2;
+   m->s3    = s3;
+   m->s4    = s4;
+}
+
+void TA_INT_MomentsAdd( TA_Moments *m, double x )
+{
+   double delta, delta2;
+
+   delta  = x-m->shift;
+   delta2 = delta*delta;
+   m->n  += 1.0;
+   m->s1 += delta;
+   m->s2 += delta2;
+   m->s3 += delta2*delta;
+   m->s4 += delta2*delta2;
+}
+
+void TA_INT_MomentsRemove( TA_Moments *m, double x )
+{
+   double delta, delta2;
+
+   delta  = x-m->shift;
+   delta2 = delta*delta;
+   m->n  -= 1.0;
+   m->s1 -= delta;
+   m->s2 -= delta2;
+   m->s3 -= delta2*delta;
+   m->s4 -= delta2*delta2;
+}
+
+void TA_INT_MomentsCentral( const TA_Moments *m, double *mean,
+                            double *m2, double *m3, double *m4 )
+{
+   double mu, mu2;
+
+   /* mu is the mean minus the shift. */
+   mu  = m->s1/m->n;
+   mu2 = mu*mu;
+
+   *mean = m->shift+mu;
+   *m2   = m->s2 - mu*m->s1;
+   *m3   = m->s3 - 3.0*mu*m->s2 + 2.0*mu2*m->s1;
+   *m4   = m->s4 - 4.0*mu*m->s3 + 6.0*mu2*m->s2 - 3.0*mu2*mu*m->s1;
+}
+
+/**** Local functions definitions.     ****/
+
+/* Return true if (value,slot) is before the node idx. */
+static int isBefore( const TA_OrdStat *os, double value, int slot, int idx )
+{
+   double nodeValue = NODE(idx).value;
+   int isNaN, nodeIsNaN;
+
+   if( value < nodeValue )
+      return 1;
+   if( value > nodeValue )
+      return 0;
+
+   /* Equal, or at least one NaN. */
+   isNaN     = (value != value);
+   nodeIsNaN = (nodeValue != nodeValue);
+   if( isNaN != nodeIsNaN )
+      return nodeIsNaN;
+
+   return slot < idx;
+}
+
+static void update( TA_OrdStat *os, int idx )
+{
+   TA_OrdStatNode *node = &NODE(idx);
+
+   node->size = NODE(node->left).size + 1 + NODE(node->right).size;
+   node->sum  = NODE(node->left).sum + node->value + NODE(node->right).sum;
+}
+
+static int rotateRight( TA_OrdStat *os, int idx )
+{
+   int left = NODE(idx).left;
+
+   NODE(idx).left   = NODE(left).right;
+   NODE(left).right = idx;
+   update( os, idx );
+   update( os, left );
+
+   return left;
+}
+
+static int rotateLeft( TA_OrdStat *os, int idx )
+{
+   int right = NODE(idx).right;
+
+   NODE(idx).right  = NODE(right).left;
+   NODE(right).left = idx;
+   update( os, idx );
+   update( os, right );
+
+   return right;
+}
+
+/* Insert the node 'slot' in the subtree idx, return its new root. */
+static int insertNode( TA_OrdStat *os, int idx, int slot )
+{
+   if( idx == NIL )
+      return slot;
+
+   if( isBefore( os, NODE(slot).value, slot, idx ) )
+   {
+      NODE(idx).left = insertNode( os, NODE(idx).left, slot );
+      if( NODE(NODE(idx).left).prio > NODE(idx).prio )
+         return rotateRight( os, idx );
+   }
+   else
+   {
+      NODE(idx).right = insertNode( os, NODE(idx).right, slot );
+      if( NODE(NODE(idx).right).prio > NODE(idx).prio )
+         return rotateLeft( os, idx );
+   }
+
+   update( os, idx );
+   return idx;
+}
+
+/* Remove the node 'slot' from the subtree idx, return its new root. */
+static int removeNode( TA_OrdStat *os, int idx, int slot )
+{
+   int left, right;
+
+   if( idx == NIL )
+      return NIL;
+
+   if( idx == slot )
+   {
+      left  = NODE(idx).left;
+      right = NODE(idx).right;
+      if( left == NIL )
+         return right;
+      if( right == NIL )
+         return left;
+
+      /* Rotate the node down until it has only one child. */
+      if( NODE(left).prio > NODE(right).prio )
+      {
+         idx = rotateRight( os, idx );
+         NODE(idx).right = removeNode( os, NODE(idx).right, slot );
+      }
+      else
+      {
+         idx = rotateLeft( os, idx );
+         NODE(idx).left = removeNode( os, NODE(idx).left, slot );
+      }
+   }
+   else if( isBefore( os, NODE(slot).value, slot, idx ) )
+      NODE(idx).left = removeNode( os, NODE(idx).left, slot );
+   else
+      NODE(idx).right = removeNode( os, NODE(idx).right, slot );
+
+   update( os, idx );
+   return idx;
+}
+
+/* Sums of the window ending at 'idx', WINSUM_LANES partial sums
+ * added together at the end.
+ */
+static void directSums( TA_WinSum *ws, int idx )
+{
+   const double *in = &ws->inReal[idx-ws->period+1];
+   double sum[WINSUM_LANES], sumSq[WINSUM_LANES];
+   int i, l, nbFull;
+
+   for( l=0; l < WINSUM_LANES; l++ )
+   {
+      sum[l]   = 0.0;
+      sumSq[l] = 0.0;
+   }
+
+   nbFull = ws->period-(ws->period%WINSUM_LANES);
+   for( i=0; i < nbFull; i += WINSUM_LANES )
+   {
+      for( l=0; l < WINSUM_LANES; l++ )
+      {
+         sum[l]   += in[i+l];
+         sumSq[l] += in[i+l]*in[i+l];
+      }
+   }
+   for( l=0; i < ws->period; i++, l++ )
+   {
+      sum[l]   += in[i];
+      sumSq[l] += in[i]*in[i];
+   }
+
+   for( l=1; l < WINSUM_LANES; l++ )
+   {
+      sum[0]   += sum[l];
+      sumSq[0] += sumSq[l];
+   }
+
+   ws->sum       = sum[0];
+   ws->sumSq     = sumSq[0];
+   ws->anchorIdx = idx;
+}
+
+/* Inclusive prefix sum of v[0..n-1]. The block is cut in WINSUM_LANES
+ * parts scanned together, then each part is moved up by the total of
+ * the parts before it.
+ */
+static void scanBlock( double v[], int n )
+{
+   double total[WINSUM_LANES], carry[WINSUM_LANES];
+   int k, l, seg, first;
+
+   seg = n/WINSUM_LANES;
+   first = 1;
+   if( seg > 1 )
+   {
+      for( l=0; l < WINSUM_LANES; l++ )
+         total[l] = v[l*seg];
+      for( k=1; k < seg; k++ )
+      {
+         for( l=0; l < WINSUM_LANES; l++ )
+         {
+            total[l] += v[l*seg+k];
+            v[l*seg+k] = total[l];
+         }
+      }
+
+      carry[0] = 0.0;
+      for( l=1; l < WINSUM_LANES; l++ )
+         carry[l] = carry[l-1]+total[l-1];
+      for( l=1; l < WINSUM_LANES; l++ )
+      {
+         for( k=0; k < seg; k++ )
+            v[l*seg+k] += carry[l];
+      }
+      first = WINSUM_LANES*seg;
+   }
+
+   for( k=first; k < n; k++ )
+      v[k] += v[k-1];
+}
@@ -10,6 +10,25 @@
 #include "ta_memory.h"
 #include "ta_global.h"
 
+/* No contraction of a*b+c into an fma in the functions of TA-Lib.
+ *
+ * The streaming states, the panels, the correlation matrix and the
+ * missing-bar policies repeat the operations of the TA functions and
+ * promise the same bits. A compiler allowed to contract (gcc
+ * -ffp-contract=fast, the default of the GNU dialects, with FMA
+ * instructions like -march=haswell or any aarch64; clang on aarch64)
+ * chooses differently in each loop, so it is turned off here for all
+ * the functions including this header. The explicit fma() calls are
+ * not affected.
+ */
+#if defined(__clang__)
+   #pragma STDC FP_CONTRACT OFF
+#elif defined(__GNUC__)
+   #pragma GCC optimize ("fp-contract=off")
+#elif defined(_MSC_VER)
+   #pragma fp_contract (off)
+#endif
+
 /* Calculate a Simple Moving Average.
  * This is an internal version, parameter are assumed validated.
  * (startIdx and endIdx cannot be -1).
@@ -89,6 +108,257 @@ void TA_INT_stddev_using_precalc_ma( const double *inReal,
                                      int           timePeriod,
                                      double       *output );
 
+/* Rolling order statistics over the last 'period' values
+ * (see ta_utility.c).
+ *
+ * The window is a treap ordered by value, each node keeping the
+ * count and the sum of its subtree. Pushing a value (which removes
+ * the oldest one when the window is full) and querying the values
+ * below a threshold are O(log period).
+ *
+ * For a small period the direct loops are faster (measured
+ * crossover around 200 for AVGDEV), so the functions use the
+ * window only when period >= TA_ORDSTAT_MIN_PERIOD.
+ */
+#define TA_ORDSTAT_MIN_PERIOD 200
+
+typedef struct
+{
+   double       value;
+   double       sum;    /* Of the subtree. */
+   int          size;   /* Nb of nodes in the subtree. */
+   int          left;   /* 'period' (empty sentinel) when none. */
+   int          right;
+   unsigned int prio;
+} TA_OrdStatNode;
+
+typedef struct
+{
+   int             period;
+   int             nbValue;
+   int             oldest; /* Node (slot) of the oldest value. */
+   int             root;
+   unsigned int    seed;
+   TA_OrdStatNode *node;   /* One node per slot, then the sentinel. */
+} TA_OrdStat;
+
+TA_RetCode TA_INT_OrdStatInit( TA_OrdStat *os, int period );
+void       TA_INT_OrdStatFree( TA_OrdStat *os );
+
+/* Add a value, removing the oldest one when the window is full. */
+void TA_INT_OrdStatPush( TA_OrdStat *os, double value );
+
+/* Sum of all the values in the window. */
+double TA_INT_OrdStatSum( const TA_OrdStat *os );
+
+/* Count and sum of the values strictly below 'x'. */
+void TA_INT_OrdStatBelow( const TA_OrdStat *os, double x, int *nbBelow, double *sumBelow );
+
+/* Sum of ABS(value-center) for all the values in the window. */
+double TA_INT_OrdStatAbsDev( const TA_OrdStat *os, double center );
+
+/* True when the window contains a NaN (sorted after all the values). */
+int TA_INT_OrdStatHasNaN( const TA_OrdStat *os );
+
+/* The k-th smallest value of the window (k from 0 to nbValue-1). */
+double TA_INT_OrdStatKth( const TA_OrdStat *os, int k );
+
+/* Nb of values strictly below 'x', and equal to 'x'. */
+void TA_INT_OrdStatRank( const TA_OrdStat *os, double x, int *nbBelow, int *nbEqual );
+
+/* Sums of the windows of 'period' values, by blocks of bars, used
+ * by TA_SMA, TA_VAR and their callers when TA_GLOBALS_PRECISION is
+ * TA_PRECISION_PREFIX_SUM (see ta_utility.c).
+ *
+ * TA_INT_WinSumNext() gives the sums (and the sums of the squares) of
+ * the windows ending at the next bars, at most TA_WINSUM_BLOCK, and
+ * returns how many (0 when done). All the inputs used by a block, and
+ * by the start of the next one, are read before it returns: the
+ * caller can then write the outputs of the block over the input, as
+ * long as the first window ends at or after the bar period-1.
+ */
+#define TA_WINSUM_BLOCK 512
+
+typedef struct
+{
+   const double *inReal;
+   int           period;
+   int           nextIdx;   /* Bar where the next window ends. */
+   int           lastIdx;
+   int           anchorIdx; /* Bar of the last sum done directly. */
+   double        sum;       /* Sums of the window ending at nextIdx. */
+   double        sumSq;
+} TA_WinSum;
+
+/* Windows ending at the bars firstIdx to lastIdx, firstIdx >= period-1. */
+void TA_INT_WinSumInit( TA_WinSum *ws, const double *inReal,
+                        int firstIdx, int lastIdx, int period );
+
+/* sum or sumSq can be NULL when not needed. */
+int TA_INT_WinSumNext( TA_WinSum *ws, double sum[], double sumSq[] );
+
+/* Missing bars, used by the kernels of TA_SMA, TA_EMA, TA_WMA and
+ * TA_VAR when TA_GLOBALS_MISSING is not TA_MISSING_NONE, and by the
+ * functions of ta_missing.h (see ta_utility.c).
+ *
+ * A bar is missing when its bit of inValid is 0 or, when inValid is
+ * NULL, when its value is NaN. TA_INT_MissingNext() reads the next bar
+ * and tells the kernel what to do with it:
+ *    TA_MISSING_STEP_PUSH     *value enters the window.
+ *    TA_MISSING_STEP_HOLD     nothing, the bar has no output.
+ *    TA_MISSING_STEP_RESTART  the window restarts empty, the bar has
+ *                             no output.
+ * With TA_MISSING_NONE (only with a bitmap), the first missing bar
+ * restarts the window and all the following bars are held, like a
+ * NaN in a running sum.
+ */
+#define TA_MISSING_STEP_PUSH    0
+#define TA_MISSING_STEP_HOLD    1
+#define TA_MISSING_STEP_RESTART 2
+
+#define TA_IS_MISSING(inReal,inValid,idx) \
+   ((inValid)? !((inValid)[(idx)>>3] & (1<<((idx)&7))) : ((inReal)[idx] != (inReal)[idx]))
+
+typedef struct
+{
+   const double        *inReal;
+   const unsigned char *inValid;
+   TA_MissingPolicy     policy;
+   int                  nextIdx;
+   int                  stopped;   /* TA_MISSING_NONE, after a missing bar. */
+   int                  hasLast;   /* TA_MISSING_CARRY_FORWARD. */
+   double               lastValue;
+} TA_Missing;
+
+/* First bar to read for the output of startIdx, when the kernel
+ * reads nbBack bars before it: more with TA_MISSING_SKIP, and with
+ * TA_MISSING_CARRY_FORWARD up to the bar carried.
+ */
+int TA_INT_MissingBegin( const double *inReal, const unsigned char *inValid,
+                         TA_MissingPolicy policy, int startIdx, int nbBack );
+
+void TA_INT_MissingInit( TA_Missing *m, const double *inReal, const unsigned char *inValid,
+                         TA_MissingPolicy policy, int beginIdx );
+
+int TA_INT_MissingNext( TA_Missing *m, double *value );
+
+/* Same as step = TA_INT_MissingNext( &m, &value ), the bars not
+ * missing without a call.
+ */
+#define TA_MISSING_NEXT(m,value,step) { \
+      if( !(m).stopped && !TA_IS_MISSING( (m).inReal, (m).inValid, (m).nextIdx ) ) { \
+         (value) = (m).inReal[(m).nextIdx++]; \
+         (m).lastValue = (value); \
+         (m).hasLast = 1; \
+         (step) = TA_MISSING_STEP_PUSH; \
+      } else \
+         (step) = TA_INT_MissingNext( &(m), &(value) ); }
+
+/* Write the output outIdx: the value, or NaN when it is not valid,
+ * and its bit of outValid (when not NULL).
+ */
+#define TA_MISSING_OUTPUT(outReal,outValid,outIdx,value,isValid) { \
+      if( isValid ) { \
+         (outReal)[outIdx] = (value); \
+         if( outValid ) (outValid)[(outIdx)>>3] |= (unsigned char)(1<<((outIdx)&7)); \
+      } else { \
+         (outReal)[outIdx] = NAN; \
+         if( outValid ) (outValid)[(outIdx)>>3] &= (unsigned char)~(1<<((outIdx)&7)); \
+      } }
+
+/* Same as TA_INT_SMA, TA_INT_EMA, TA_WMA and TA_INT_VAR with the
+ * missing bars of the policy. inValid and outValid can be NULL; else
+ * the bit i of outValid is the validity of outReal[i].
+ */
+TA_RetCode TA_INT_SMA_Missing( int                  startIdx,
+                               int                  endIdx,
+                               const double        *inReal,
+                               const unsigned char *inValid,
+                               TA_MissingPolicy     policy,
+                               int                  optInTimePeriod,
+                               int                 *outBegIdx,
+                               int                 *outNBElement,
+                               double              *outReal,
+                               unsigned char       *outValid );
+
+TA_RetCode TA_INT_EMA_Missing( int                  startIdx,
+                               int                  endIdx,
+                               const double        *inReal,
+                               const unsigned char *inValid,
+                               TA_MissingPolicy     policy,
+                               int                  optInTimePeriod,
+                               double               optInK_1,
+                               int                 *outBegIdx,
+                               int                 *outNBElement,
+                               double              *outReal,
+                               unsigned char       *outValid );
+
+TA_RetCode TA_INT_WMA_Missing( int                  startIdx,
+                               int                  endIdx,
+                               const double        *inReal,
+                               const unsigned char *inValid,
+                               TA_MissingPolicy     policy,
+                               int                  optInTimePeriod,
+                               int                 *outBegIdx,
+                               int                 *outNBElement,
+                               double              *outReal,
+                               unsigned char       *outValid );
+
+TA_RetCode TA_INT_VAR_Missing( int                  startIdx,
+                               int                  endIdx,
+                               const double        *inReal,
+                               const unsigned char *inValid,
+                               TA_MissingPolicy     policy,
+                               int                  optInTimePeriod,
+                               int                 *outBegIdx,
+                               int                 *outNBElement,
+                               double              *outReal,
+                               unsigned char       *outValid );
+
+/* Moments of a rolling window, used by TA_MOMENTS, TA_ZSCORE, TA_SKEW
+ * and TA_KURT (see ta_utility.c).
+ *
+ * The sums of the powers 1 to 4 of the deviations from a shift close
+ * to the mean, updated when a value enters or leaves the window.
+ * TA_INT_MomentsSet() does them again directly from the window, with
+ * its mean as the new shift.
+ */
+typedef struct
+{
+   double n;
+   double shift;
+   double s1;   /* Sum of (x-shift). */
+   double s2;   /* Sum of (x-shift)^2. */
+   double s3;
+   double s4;
+} TA_Moments;
+
+void TA_INT_MomentsSet( TA_Moments *m, const double *inReal, int n );
+void TA_INT_MomentsAdd( TA_Moments *m, double x );
+void TA_INT_MomentsRemove( TA_Moments *m, double x );
+
+/* The mean, and the sums of the powers 2 to 4 of the deviations from
+ * the mean (central moments times n).
+ */
+void TA_INT_MomentsCentral( const TA_Moments *m, double *mean,
+                            double *m2, double *m3, double *m4 );
+
+/* Mean, variance, standard deviation, skewness, kurtosis and z-score
+ * of the windows of 'period' bars, in one pass. Any output can be NULL.
+ */
+TA_RetCode TA_INT_MOMENTS( int           startIdx,
+                           int           endIdx,
+                           const double *inReal,
+                           int           optInTimePeriod,
+                           int          *outBegIdx,
+                           int          *outNBElement,
+                           double       *outMean,
+                           double       *outVar,
+                           double       *outStdDev,
+                           double       *outSkew,
+                           double       *outKurt,
+                           double       *outZScore );
+
 /* Provides an equivalent to standard "math.h" functions. */
 #define std_floor floor
 #define std_ceil  ceil
@@ -141,6 +411,51 @@ void TA_INT_stddev_using_precalc_ma( const double *inReal,
 #define TA_IS_ZERO(v)        (((-0.00000001)<v)&&(v<0.00000001))
 #define TA_IS_ZERO_OR_NEG(v) (v<0.00000001)
 
+/* Compensated summation (Neumaier), used when TA_GLOBALS_PRECISION
+ * is TA_PRECISION_COMPENSATED. The low-order bits lost when adding
+ * 'value' to 'sum' are accumulated in 'comp', so sum+comp stays
+ * accurate no matter how many values are added and removed.
+ *
+ * The parameters are evaluated more than once, pass variables.
+ */
+#define TA_SUM_ADD(sum,comp,value) { \
+   double sumTmp_ = (sum)+(value); \
+   if( std_fabs(sum) >= std_fabs(value) ) \
+      (comp) += ((sum)-sumTmp_)+(value); \
+   else \
+      (comp) += ((value)-sumTmp_)+(sum); \
+   (sum) = sumTmp_; }
+
+/* Fold 'comp' back into 'sum', exactly. Without it, 'comp' keeps
+ * the scale of the values added long ago and its own rounding stays
+ * when the values of the window get much smaller. Done once per bar
+ * by a running total (TA_SMA), it costs less than in TA_SUM_ADD.
+ */
+#define TA_SUM_NORM(sum,comp) { \
+   double sumTmp_ = (sum)+(comp); \
+   if( std_fabs(sum) >= std_fabs(comp) ) \
+      (comp) = ((sum)-sumTmp_)+(comp); \
+   else \
+      (comp) = ((comp)-sumTmp_)+(sum); \
+   (sum) = sumTmp_; }
+
+/* A compensated sum keeps about 32 significant digits, relative to
+ * the largest values it held: a running total of squares is done
+ * again from its window when it falls under TA_SUM_DROP times its
+ * highest value (the errors left are then under 1e-24 of the total
+ * per bar).
+ */
+#define TA_SUM_DROP 1e-8
+
+/* Add the exact product x*y to a compensated sum: the rounding
+ * error of the product is recovered with fma() and goes in 'comp'.
+ */
+#define TA_SUM_ADD_PRODUCT(sum,comp,x,y) { \
+   double prodTmp_ = (x)*(y); \
+   double prodErr_ = fma((x),(y),-prodTmp_); \
+   TA_SUM_ADD(sum,comp,prodTmp_); \
+   (comp) += prodErr_; }
+
 /* The following macros are being used to do
  * the Hilbert Transform logic as documented
  * in John Ehlers books "Rocket Science For Traders".
@@ -191,6 +506,11 @@ void TA_INT_stddev_using_precalc_ma( const double *inReal,
  */
 #define PER_TO_K( per ) ((double)2.0 / ((double)(per + 1)))
 
+/* Lookback of TA_INT_EMA(). Unlike TA_EMA_Lookback(), a period of 1
+ * is valid (the signal line of MACD and MACDFIX).
+ */
+#define TA_INT_EMA_LOOKBACK( per ) ((per) - 1 + TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_EMA,Ema))
+
 /* Math Constants and Functions */
 #define PI 3.14159265358979323846
 
@@ -0,0 +1,374 @@
+/* Description:
+ *   Adapters between the Arrow C data interface and the TA functions
+ *   (see ta_arrow.h).
+ *
+ *   An output is a single allocation: the array of the two buffer
+ *   pointers, the validity bitmap and the values, each starting on a
+ *   64 bytes boundary as recommended by Arrow. The release callback
+ *   frees it.
+ */
+
+/**** Headers ****/
+#include <string.h>
+#include <math.h>
+
+#include "ta_common.h"
+#include "ta_memory.h"
+#include "ta_arrow.h"
+
+/**** Local declarations.              ****/
+typedef struct
+{
+   const double *values;    /* Value of the first row of the batch. */
+   double       *converted; /* When the column is not float64. */
+} TA_ArrowInput;
+
+#define ARROW_ALIGNMENT 64
+#define ARROW_ALIGN(size) (((size)+ARROW_ALIGNMENT-1) & ~(size_t)(ARROW_ALIGNMENT-1))
+
+/* More than the inputs and outputs of any function. */
+#define ARROW_MAX_ARG 16
+
+/**** Local functions declarations.    ****/
+static TA_RetCode getInput( const struct ArrowSchema *schema, const struct ArrowArray *batch,
+                            const char *name, TA_ArrowInput *input );
+static int hasNull( const struct ArrowArray *array, int64_t offset, int64_t length );
+static TA_RetCode newOutput( int64_t length, int isInteger, struct ArrowArray *out );
+static void setValidity( struct ArrowArray *out, int isInteger, int outBegIdx, int outNBElement );
+static void exportSchema( const char *name, int isInteger, struct ArrowSchema *out );
+static void releaseArray( struct ArrowArray *array );
+static void releaseSchema( struct ArrowSchema *schema );
+static const char *defaultColumn( TA_InputType type );
+
+/**** Global functions definitions.   ****/
+TA_RetCode TA_ArrowCall( const TA_FuncDef         *func,
+                         const double              optIn[],
+                         const struct ArrowSchema *schema,
+                         const struct ArrowArray  *batch,
+                         const char *const         columns[],
+                         struct ArrowArray         outArrays[],
+                         struct ArrowSchema        outSchemas[] )
+{
+   TA_ArrowInput input[ARROW_MAX_ARG];
+   const double *inputs[ARROW_MAX_ARG];
+   void *outputs[ARROW_MAX_ARG];
+   const char *name;
+   TA_RetCode retCode;
+   size_t elementSize;
+   int i, isInteger, lookback, outBegIdx, outNBElement;
+
+   if( !func || !schema || !batch || !outArrays || (!optIn && (func->nbOptInput > 0)) ||
+       (func->nbInput > ARROW_MAX_ARG) || (func->nbOutput > ARROW_MAX_ARG) )
+      return TA_BAD_PARAM;
+
+   memset( outArrays, 0, sizeof(struct ArrowArray)*func->nbOutput );
+   if( outSchemas )
+      memset( outSchemas, 0, sizeof(struct ArrowSchema)*func->nbOutput );
+   memset( input, 0, sizeof(input) );
+
+   /* A single column only for a function with one input. */
+   retCode = TA_SUCCESS;
+   if( schema->format && (strcmp( schema->format, "+s" ) != 0) && (func->nbInput != 1) )
+      retCode = TA_BAD_PARAM;
+   for( i=0; (i < func->nbInput) && (retCode == TA_SUCCESS); i++ )
+   {
+      name = (columns && columns[i])? columns[i] : defaultColumn( func->inputs[i].type );
+      retCode = getInput( schema, batch, name, &input[i] );
+      inputs[i] = input[i].converted? input[i].converted : input[i].values;
+   }
+   for( i=0; (i < func->nbOutput) && (retCode == TA_SUCCESS); i++ )
+      retCode = newOutput( batch->length, func->outputs[i].type == TA_OUTPUT_INTEGER, &outArrays[i] );
+
+   /* The function writes the value of its first row, the lookback,
+    * at outputs[i][0]: it is given the address of this row directly.
+    */
+   outBegIdx = outNBElement = 0;
+   lookback = func->lookback( optIn );
+   for( i=0; (i < func->nbOutput) && (retCode == TA_SUCCESS); i++ )
+   {
+      elementSize = func->outputs[i].type == TA_OUTPUT_INTEGER? sizeof(int) : sizeof(double);
+      outputs[i] = (void *)outArrays[i].buffers[1];
+      if( (lookback > 0) && (lookback < batch->length) )
+         outputs[i] = (char *)outputs[i] + (size_t)lookback*elementSize;
+   }
+   if( (retCode == TA_SUCCESS) && (batch->length > 0) )
+      retCode = func->call( 0, (int)batch->length-1, inputs, optIn, &outBegIdx, &outNBElement, outputs );
+
+   for( i=0; (i < func->nbOutput) && (retCode == TA_SUCCESS); i++ )
+   {
+      isInteger = func->outputs[i].type == TA_OUTPUT_INTEGER;
+      elementSize = isInteger? sizeof(int) : sizeof(double);
+      if( (outNBElement > 0) && ((char *)outputs[i] != (char *)outArrays[i].buffers[1] + (size_t)outBegIdx*elementSize) )
+      {
+         /* Not expected: with startIdx 0, the first row is the lookback. */
+         memmove( (char *)outArrays[i].buffers[1] + (size_t)outBegIdx*elementSize,
+                  outputs[i], (size_t)outNBElement*elementSize );
+      }
+      setValidity( &outArrays[i], isInteger, outBegIdx, outNBElement );
+      if( outSchemas )
+         exportSchema( func->outputs[i].name, isInteger, &outSchemas[i] );
+   }
+
+   for( i=0; i < func->nbInput; i++ )
+      FREE_IF_NOT_NULL( input[i].converted );
+
+   if( retCode != TA_SUCCESS )
+   {
+      for( i=0; i < func->nbOutput; i++ )
+      {
+         if( outArrays[i].release )
+            outArrays[i].release( &outArrays[i] );
+      }
+   }
+
+   return retCode;
+}
+
+TA_RetCode TA_ArrowStreamRun( TA_StreamState           *state,
+                              const struct ArrowSchema *schema,
+                              const struct ArrowArray  *batch,
+                              const char *const         columns[],
+                              struct ArrowArray        *outArray,
+                              struct ArrowSchema       *outSchema )
+{
+   static const char *defaultName[3] = { "high", "low", "close" };
+   TA_ArrowInput input[3];
+   const char *name;
+   TA_RetCode retCode;
+   double *outReal;
+   int i, first, outBegIdx, outNBElement;
+
+   if( !state || !schema || !batch || !outArray )
+      return TA_BAD_PARAM;
+
+   memset( outArray, 0, sizeof(struct ArrowArray) );
+   if( outSchema )
+      memset( outSchema, 0, sizeof(struct ArrowSchema) );
+   memset( input, 0, sizeof(input) );
+
+   /* The high and the low only for the functions using them, which
+    * can not take a single column.
+    */
+   first = ((state->funcId == TA_STREAM_ATR) || (state->funcId == TA_STREAM_ADX))? 0 : 2;
+   retCode = TA_SUCCESS;
+   if( (first == 0) && schema->format && (strcmp( schema->format, "+s" ) != 0) )
+      retCode = TA_BAD_PARAM;
+   for( i=first; (i < 3) && (retCode == TA_SUCCESS); i++ )
+   {
+      name = (columns && columns[i])? columns[i] : defaultName[i];
+      retCode = getInput( schema, batch, name, &input[i] );
+   }
+   if( retCode == TA_SUCCESS )
+      retCode = newOutput( batch->length, 0, outArray );
+
+   outBegIdx = outNBElement = 0;
+   if( (retCode == TA_SUCCESS) && (batch->length > 0) )
+   {
+      outReal = (double *)outArray->buffers[1];
+      retCode = TA_StreamRun( state, (int)batch->length,
+                              input[0].converted? input[0].converted : input[0].values,
+                              input[1].converted? input[1].converted : input[1].values,
+                              input[2].converted? input[2].converted : input[2].values,
+                              &outBegIdx, &outNBElement, outReal );
+
+      /* Only in the batch where the lookback ends. */
+      if( (retCode == TA_SUCCESS) && (outBegIdx > 0) && (outNBElement > 0) )
+         memmove( &outReal[outBegIdx], outReal, sizeof(double)*outNBElement );
+   }
+
+   for( i=0; i < 3; i++ )
+      FREE_IF_NOT_NULL( input[i].converted );
+
+   if( retCode != TA_SUCCESS )
+   {
+      if( outArray->release )
+         outArray->release( outArray );
+      return retCode;
+   }
+
+   setValidity( outArray, 0, outBegIdx, outNBElement );
+   if( outSchema )
+      exportSchema( "outReal", 0, outSchema );
+
+   return TA_SUCCESS;
+}
+
+/**** Local functions definitions.     ****/
+static const char *defaultColumn( TA_InputType type )
+{
+   switch( type )
+   {
+   case TA_INPUT_OPEN:   return "open";
+   case TA_INPUT_HIGH:   return "high";
+   case TA_INPUT_LOW:    return "low";
+   case TA_INPUT_VOLUME: return "volume";
+   default:              return "close";
+   }
+}
+
+/* The column of a batch, or the batch itself when it is a single column. */
+static TA_RetCode getInput( const struct ArrowSchema *schema, const struct ArrowArray *batch,
+                            const char *name, TA_ArrowInput *input )
+{
+   const struct ArrowSchema *colSchema;
+   const struct ArrowArray *column;
+   const void *values;
+   int64_t offset, length, i;
+
+   if( !batch->release || !schema->format || (batch->length < 0) || (batch->length > INT_MAX) )
+      return TA_BAD_PARAM;
+   length = batch->length;
+
+   if( strcmp( schema->format, "+s" ) == 0 )
+   {
+      if( (batch->n_children != schema->n_children) || hasNull( batch, batch->offset, length ) )
+         return TA_BAD_PARAM;
+      for( i=0; i < schema->n_children; i++ )
+      {
+         if( schema->children[i]->name && (strcmp( schema->children[i]->name, name ) == 0) )
+            break;
+      }
+      if( i == schema->n_children )
+         return TA_BAD_PARAM;
+
+      colSchema = schema->children[i];
+      column = batch->children[i];
+      offset = batch->offset+column->offset;
+      if( column->length < batch->offset+length )
+         return TA_BAD_PARAM;
+   }
+   else
+   {
+      colSchema = schema;
+      column = batch;
+      offset = batch->offset;
+   }
+
+   if( !colSchema->format || (colSchema->format[0] == '\0') || (colSchema->format[1] != '\0') ||
+       (column->n_buffers != 2) || !column->buffers || ((length > 0) && !column->buffers[1]) ||
+       hasNull( column, offset, length ) )
+      return TA_BAD_PARAM;
+
+   values = column->buffers[1];
+   switch( colSchema->format[0] )
+   {
+   case 'g':
+      input->values = (const double *)values + offset;
+      return TA_SUCCESS;
+   case 'f':
+   case 'i':
+   case 'l':
+      break;
+   default:
+      return TA_BAD_PARAM;
+   }
+
+   input->converted = (double *)TA_Malloc( sizeof(double)*(size_t)(length+1) );
+   if( !input->converted )
+      return TA_ALLOC_ERR;
+   for( i=0; i < length; i++ )
+   {
+      switch( colSchema->format[0] )
+      {
+      case 'f': input->converted[i] = ((const float *)values)[offset+i]; break;
+      case 'i': input->converted[i] = ((const int32_t *)values)[offset+i]; break;
+      default:  input->converted[i] = (double)((const int64_t *)values)[offset+i]; break;
+      }
+   }
+
+   return TA_SUCCESS;
+}
+
+static int hasNull( const struct ArrowArray *array, int64_t offset, int64_t length )
+{
+   const unsigned char *bitmap;
+   int64_t i;
+
+   if( (array->null_count == 0) || (array->n_buffers < 1) || !array->buffers || !array->buffers[0] )
+      return 0;
+
+   bitmap = (const unsigned char *)array->buffers[0];
+   for( i=offset; i < offset+length; i++ )
+   {
+      if( !(bitmap[i >> 3] & (1 << (i & 7))) )
+         return 1;
+   }
+   return 0;
+}
+
+static TA_RetCode newOutput( int64_t length, int isInteger, struct ArrowArray *out )
+{
+   const void **buffers;
+   size_t bitmapSize, valueSize;
+   void *memory;
+   char *block;
+
+   bitmapSize = ARROW_ALIGN( (size_t)(length+7)/8 );
+   valueSize = (size_t)length*(isInteger? sizeof(int) : sizeof(double));
+   memory = TA_Malloc( 2*ARROW_ALIGNMENT+bitmapSize+valueSize );
+   if( !memory )
+      return TA_ALLOC_ERR;
+
+   block = (char *)ARROW_ALIGN( (size_t)memory );
+   buffers = (const void **)block;
+   buffers[0] = block+ARROW_ALIGNMENT;
+   buffers[1] = block+ARROW_ALIGNMENT+bitmapSize;
+
+   memset( out, 0, sizeof(struct ArrowArray) );
+   out->length       = length;
+   out->n_buffers    = 2;
+   out->buffers      = buffers;
+   out->release      = releaseArray;
+   out->private_data = memory;
+
+   return TA_SUCCESS;
+}
+
+/* The rows [outBegIdx,outBegIdx+outNBElement) are valid, the others
+ * are null (NaN or 0).
+ */
+static void setValidity( struct ArrowArray *out, int isInteger, int outBegIdx, int outNBElement )
+{
+   unsigned char *bitmap;
+   int64_t i, endIdx;
+
+   if( outNBElement <= 0 )
+      outBegIdx = outNBElement = 0;
+   endIdx = (int64_t)outBegIdx+outNBElement;
+
+   bitmap = (unsigned char *)out->buffers[0];
+   memset( bitmap, 0, (size_t)(out->length+7)/8 );
+   for( i=0; i < out->length; i++ )
+   {
+      if( (i >= outBegIdx) && (i < endIdx) )
+         bitmap[i >> 3] |= (unsigned char)(1 << (i & 7));
+      else if( isInteger )
+         ((int *)out->buffers[1])[i] = 0;
+      else
+         ((double *)out->buffers[1])[i] = NAN;
+   }
+
+   out->null_count = out->length-outNBElement;
+   if( out->null_count == 0 )
+      out->buffers[0] = NULL;
+}
+
+static void exportSchema( const char *name, int isInteger, struct ArrowSchema *out )
+{
+   memset( out, 0, sizeof(struct ArrowSchema) );
+   out->format  = isInteger? "i" : "g";
+   out->name    = name;
+   out->flags   = ARROW_FLAG_NULLABLE;
+   out->release = releaseSchema;
+}
+
+static void releaseArray( struct ArrowArray *array )
+{
+   TA_Free( array->private_data );
+   array->release = NULL;
+}
+
+static void releaseSchema( struct ArrowSchema *schema )
+{
+   schema->release = NULL;
+}
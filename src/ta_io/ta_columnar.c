@@ -0,0 +1,494 @@
+/* Description:
+ *   Memory-mapped loader and writer for the columnar OHLCV file
+ *   format (see ta_columnar.h for the layout).
+ */
+
+/**** Headers ****/
+#if defined(_MSC_VER)
+   #define _CRT_SECURE_NO_WARNINGS
+#endif
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef _WIN32
+   #include "windows.h"
+#else
+   #include <sys/mman.h>
+   #include <sys/stat.h>
+   #include <fcntl.h>
+   #include <unistd.h>
+#endif
+
+#include "ta_common.h"
+#include "ta_columnar.h"
+#include "ta_memory.h"
+
+/**** Local declarations.              ****/
+struct TA_ColFile
+{
+   const unsigned char     *base;
+   UInt64                   size;
+   const TA_ColFileHeader  *header;
+   const TA_ColSymbolEntry *entries;
+
+#ifdef _WIN32
+   HANDLE fileHandle;
+   HANDLE mappingHandle;
+#else
+   int fd;
+#endif
+};
+
+struct TA_ColWriter
+{
+   FILE              *out;
+   UInt64             pos;
+   TA_ColSymbolEntry *entries;
+   int                nbEntries;
+   int                maxEntries;
+};
+
+/**** Local functions declarations.    ****/
+static int isLittleEndian( void );
+static TA_RetCode validateFile( TA_ColFile *file );
+static TA_RetCode writeBytes( TA_ColWriter *writer, const void *data, UInt64 size );
+static TA_RetCode writePadding( TA_ColWriter *writer );
+static TA_RetCode writeColumn( TA_ColWriter *writer, const void *data,
+                               UInt64 size, UInt64 *offset );
+static void unmapFile( TA_ColFile *file );
+
+/**** Global functions definitions.   ****/
+TA_RetCode TA_ColFileOpen( const char *path, TA_ColFile **file )
+{
+   TA_ColFile *newFile;
+   TA_RetCode retCode;
+#ifdef _WIN32
+   LARGE_INTEGER fileSize;
+#else
+   struct stat st;
+   void *mapped;
+#endif
+
+   if( !path || !file )
+      return TA_BAD_PARAM;
+
+   *file = NULL;
+
+   /* The columns are handed out as-is, so the host must
+    * match the on-disk byte order.
+    */
+   if( !isLittleEndian() )
+      return TA_NOT_SUPPORTED;
+
+   newFile = (TA_ColFile *)TA_Malloc( sizeof(TA_ColFile) );
+   if( !newFile )
+      return TA_ALLOC_ERR;
+   memset( newFile, 0, sizeof(TA_ColFile) );
+
+#ifdef _WIN32
+   newFile->fileHandle = CreateFileA( path, GENERIC_READ, FILE_SHARE_READ, NULL,
+                                      OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL );
+   if( newFile->fileHandle == INVALID_HANDLE_VALUE )
+   {
+      TA_Free( newFile );
+      return TA_IO_ERROR;
+   }
+
+   if( !GetFileSizeEx( newFile->fileHandle, &fileSize ) )
+   {
+      CloseHandle( newFile->fileHandle );
+      TA_Free( newFile );
+      return TA_IO_ERROR;
+   }
+
+   if( fileSize.QuadPart <= 0 )
+   {
+      CloseHandle( newFile->fileHandle );
+      TA_Free( newFile );
+      return TA_BAD_FILE_FORMAT;
+   }
+   newFile->size = (UInt64)fileSize.QuadPart;
+
+   newFile->mappingHandle = CreateFileMappingA( newFile->fileHandle, NULL,
+                                                PAGE_READONLY, 0, 0, NULL );
+   if( !newFile->mappingHandle )
+   {
+      CloseHandle( newFile->fileHandle );
+      TA_Free( newFile );
+      return TA_IO_ERROR;
+   }
+
+   newFile->base = (const unsigned char *)MapViewOfFile( newFile->mappingHandle,
+                                                         FILE_MAP_READ, 0, 0, 0 );
+   if( !newFile->base )
+   {
+      CloseHandle( newFile->mappingHandle );
+      CloseHandle( newFile->fileHandle );
+      TA_Free( newFile );
+      return TA_IO_ERROR;
+   }
+#else
+   newFile->fd = open( path, O_RDONLY );
+   if( newFile->fd < 0 )
+   {
+      TA_Free( newFile );
+      return TA_IO_ERROR;
+   }
+
+   if( (fstat( newFile->fd, &st ) != 0) || (st.st_size <= 0) )
+   {
+      close( newFile->fd );
+      TA_Free( newFile );
+      return TA_BAD_FILE_FORMAT;
+   }
+   newFile->size = (UInt64)st.st_size;
+
+   mapped = mmap( NULL, (size_t)newFile->size, PROT_READ, MAP_SHARED, newFile->fd, 0 );
+   if( mapped == MAP_FAILED )
+   {
+      close( newFile->fd );
+      TA_Free( newFile );
+      return TA_IO_ERROR;
+   }
+   newFile->base = (const unsigned char *)mapped;
+#endif
+
+   retCode = validateFile( newFile );
+   if( retCode != TA_SUCCESS )
+   {
+      unmapFile( newFile );
+      TA_Free( newFile );
+      return retCode;
+   }
+
+   *file = newFile;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_ColFileClose( TA_ColFile *file )
+{
+   if( !file )
+      return TA_BAD_PARAM;
+
+   unmapFile( file );
+   TA_Free( file );
+
+   return TA_SUCCESS;
+}
+
+int TA_ColFileNbSymbols( const TA_ColFile *file )
+{
+   if( !file )
+      return 0;
+
+   return (int)file->header->nbSymbols;
+}
+
+TA_RetCode TA_ColFileGetSeries( const TA_ColFile *file,
+                                int               symbolIdx,
+                                TA_ColSeries     *series )
+{
+   const TA_ColSymbolEntry *entry;
+   const UInt64 *offset;
+
+   if( !file || !series )
+      return TA_BAD_PARAM;
+
+   if( (symbolIdx < 0) || (symbolIdx >= (int)file->header->nbSymbols) )
+      return TA_BAD_PARAM;
+
+   entry  = &file->entries[symbolIdx];
+   offset = entry->columnOffset;
+
+   #define COLUMN_PTR(type,id) (offset[id]? (const type *)(file->base+offset[id]) : NULL)
+   series->symbol    = entry->symbol;
+   series->nbBars    = (int)entry->nbBars;
+   series->open      = COLUMN_PTR(double,TA_COL_OPEN);
+   series->high      = COLUMN_PTR(double,TA_COL_HIGH);
+   series->low       = COLUMN_PTR(double,TA_COL_LOW);
+   series->close     = COLUMN_PTR(double,TA_COL_CLOSE);
+   series->volume    = COLUMN_PTR(double,TA_COL_VOLUME);
+   series->timestamp = COLUMN_PTR(Int64,TA_COL_TIMESTAMP);
+   #undef COLUMN_PTR
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_ColFileFindSeries( const TA_ColFile *file,
+                                 const char       *symbol,
+                                 TA_ColSeries     *series )
+{
+   int i;
+
+   if( !file || !symbol || !series )
+      return TA_BAD_PARAM;
+
+   for( i=0; i < (int)file->header->nbSymbols; i++ )
+   {
+      if( strncmp( file->entries[i].symbol, symbol, TA_COL_SYMBOL_LEN ) == 0 )
+         return TA_ColFileGetSeries( file, i, series );
+   }
+
+   return TA_BAD_PARAM;
+}
+
+TA_RetCode TA_ColWriterOpen( const char *path, TA_ColWriter **writer )
+{
+   TA_ColWriter *newWriter;
+   TA_ColFileHeader header;
+   TA_RetCode retCode;
+
+   if( !path || !writer )
+      return TA_BAD_PARAM;
+
+   *writer = NULL;
+
+   if( !isLittleEndian() )
+      return TA_NOT_SUPPORTED;
+
+   newWriter = (TA_ColWriter *)TA_Malloc( sizeof(TA_ColWriter) );
+   if( !newWriter )
+      return TA_ALLOC_ERR;
+   memset( newWriter, 0, sizeof(TA_ColWriter) );
+
+   newWriter->out = fopen( path, "wb" );
+   if( !newWriter->out )
+   {
+      TA_Free( newWriter );
+      return TA_IO_ERROR;
+   }
+
+   /* Reserve the header, it is re-written on close. */
+   memset( &header, 0, sizeof(header) );
+   retCode = writeBytes( newWriter, &header, sizeof(header) );
+   if( retCode != TA_SUCCESS )
+   {
+      fclose( newWriter->out );
+      TA_Free( newWriter );
+      return retCode;
+   }
+
+   *writer = newWriter;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_ColWriterAddSeries( TA_ColWriter *writer,
+                                  const char   *symbol,
+                                  int           nbBars,
+                                  const double  open[],
+                                  const double  high[],
+                                  const double  low[],
+                                  const double  close[],
+                                  const double  volume[],
+                                  const Int64   timestamp[] )
+{
+   TA_ColSymbolEntry *entry;
+   TA_ColSymbolEntry *newEntries;
+   const void *columns[TA_COL_NB_COLUMN];
+   TA_RetCode retCode;
+   int i;
+
+   if( !writer || !symbol || (nbBars < 0) )
+      return TA_BAD_PARAM;
+
+   if( strlen(symbol) >= TA_COL_SYMBOL_LEN )
+      return TA_BAD_PARAM;
+
+   if( writer->nbEntries == writer->maxEntries )
+   {
+      i = writer->maxEntries? writer->maxEntries*2 : 64;
+      newEntries = (TA_ColSymbolEntry *)TA_Realloc( writer->entries,
+                                                    sizeof(TA_ColSymbolEntry)*i );
+      if( !newEntries )
+         return TA_ALLOC_ERR;
+      writer->entries    = newEntries;
+      writer->maxEntries = i;
+   }
+
+   entry = &writer->entries[writer->nbEntries];
+   memset( entry, 0, sizeof(TA_ColSymbolEntry) );
+   strcpy( entry->symbol, symbol );
+   entry->nbBars = (UInt64)nbBars;
+
+   columns[TA_COL_OPEN]      = open;
+   columns[TA_COL_HIGH]      = high;
+   columns[TA_COL_LOW]       = low;
+   columns[TA_COL_CLOSE]     = close;
+   columns[TA_COL_VOLUME]    = volume;
+   columns[TA_COL_TIMESTAMP] = timestamp;
+
+   for( i=0; i < TA_COL_NB_COLUMN; i++ )
+   {
+      if( !columns[i] )
+         continue;
+
+      /* Both double and Int64 are 8 bytes. */
+      retCode = writeColumn( writer, columns[i], (UInt64)nbBars*8,
+                             &entry->columnOffset[i] );
+      if( retCode != TA_SUCCESS )
+         return retCode;
+   }
+
+   writer->nbEntries++;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_ColWriterClose( TA_ColWriter *writer )
+{
+   TA_ColFileHeader header;
+   TA_RetCode retCode;
+
+   if( !writer )
+      return TA_BAD_PARAM;
+
+   memset( &header, 0, sizeof(header) );
+   memcpy( header.magic, TA_COL_MAGIC, sizeof(header.magic) );
+   header.version    = TA_COL_VERSION;
+   header.headerSize = TA_COL_HEADER_SIZE;
+   header.nbSymbols  = (UInt32)writer->nbEntries;
+
+   retCode = writePadding( writer );
+   if( retCode == TA_SUCCESS )
+   {
+      header.symbolTableOffset = writer->pos;
+      retCode = writeBytes( writer, writer->entries,
+                            sizeof(TA_ColSymbolEntry)*(UInt64)writer->nbEntries );
+   }
+
+   if( retCode == TA_SUCCESS )
+   {
+      header.fileSize = writer->pos;
+      if( (fseek( writer->out, 0, SEEK_SET ) != 0) ||
+          (fwrite( &header, sizeof(header), 1, writer->out ) != 1) )
+         retCode = TA_IO_ERROR;
+   }
+
+   if( (fclose( writer->out ) != 0) && (retCode == TA_SUCCESS) )
+      retCode = TA_IO_ERROR;
+
+   FREE_IF_NOT_NULL( writer->entries );
+   TA_Free( writer );
+
+   return retCode;
+}
+
+/**** Local functions definitions.     ****/
+static int isLittleEndian( void )
+{
+   const UInt32 value = 1;
+   return *((const unsigned char *)&value) == 1;
+}
+
+static TA_RetCode validateFile( TA_ColFile *file )
+{
+   const TA_ColFileHeader *header;
+   const TA_ColSymbolEntry *entry;
+   UInt64 tableSize;
+   UInt32 i;
+   int j;
+
+   if( file->size < sizeof(TA_ColFileHeader) )
+      return TA_BAD_FILE_FORMAT;
+
+   header = (const TA_ColFileHeader *)file->base;
+
+   if( (memcmp( header->magic, TA_COL_MAGIC, sizeof(header->magic) ) != 0) ||
+       (header->version != TA_COL_VERSION) ||
+       (header->headerSize != TA_COL_HEADER_SIZE) ||
+       (header->flags != 0) ||
+       (header->fileSize != file->size) )
+      return TA_BAD_FILE_FORMAT;
+
+   tableSize = (UInt64)header->nbSymbols * sizeof(TA_ColSymbolEntry);
+   if( (header->symbolTableOffset < TA_COL_HEADER_SIZE) ||
+       (header->symbolTableOffset % TA_COL_ALIGNMENT) ||
+       (header->symbolTableOffset > file->size) ||
+       (tableSize > file->size - header->symbolTableOffset) )
+      return TA_BAD_FILE_FORMAT;
+
+   file->header  = header;
+   file->entries = (const TA_ColSymbolEntry *)(file->base + header->symbolTableOffset);
+
+   for( i=0; i < header->nbSymbols; i++ )
+   {
+      entry = &file->entries[i];
+
+      if( (entry->nbBars > (UInt64)TA_INTEGER_MAX) ||
+          (memchr( entry->symbol, 0, TA_COL_SYMBOL_LEN ) == NULL) )
+         return TA_BAD_FILE_FORMAT;
+
+      for( j=0; j < TA_COL_NB_COLUMN; j++ )
+      {
+         if( entry->columnOffset[j] == 0 )
+            continue;
+
+         /* Compared without adding to the offset, which can wrap. */
+         if( (entry->columnOffset[j] % TA_COL_ALIGNMENT) ||
+             (entry->columnOffset[j] < TA_COL_HEADER_SIZE) ||
+             (entry->columnOffset[j] > file->size) ||
+             (entry->nbBars > (file->size - entry->columnOffset[j])/8) )
+            return TA_BAD_FILE_FORMAT;
+      }
+   }
+
+   return TA_SUCCESS;
+}
+
+static TA_RetCode writeBytes( TA_ColWriter *writer, const void *data, UInt64 size )
+{
+   if( size == 0 )
+      return TA_SUCCESS;
+
+   if( fwrite( data, 1, (size_t)size, writer->out ) != (size_t)size )
+      return TA_IO_ERROR;
+
+   writer->pos += size;
+
+   return TA_SUCCESS;
+}
+
+static TA_RetCode writePadding( TA_ColWriter *writer )
+{
+   static const unsigned char zeros[TA_COL_ALIGNMENT] = {0};
+   UInt64 rest;
+
+   rest = writer->pos % TA_COL_ALIGNMENT;
+   if( rest == 0 )
+      return TA_SUCCESS;
+
+   return writeBytes( writer, zeros, TA_COL_ALIGNMENT-rest );
+}
+
+static TA_RetCode writeColumn( TA_ColWriter *writer, const void *data,
+                               UInt64 size, UInt64 *offset )
+{
+   TA_RetCode retCode;
+
+   retCode = writePadding( writer );
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   *offset = writer->pos;
+
+   return writeBytes( writer, data, size );
+}
+
+static void unmapFile( TA_ColFile *file )
+{
+#ifdef _WIN32
+   UnmapViewOfFile( (LPCVOID)file->base );
+   CloseHandle( file->mappingHandle );
+   CloseHandle( file->fileHandle );
+#else
+   munmap( (void *)file->base, (size_t)file->size );
+   close( file->fd );
+#endif
+}
+
+/***************/
+/* End of File */
+/***************/
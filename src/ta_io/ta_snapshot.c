@@ -0,0 +1,503 @@
+/* Description:
+ *   Portable binary snapshot of the streaming states and of the
+ *   global settings (see ta_snapshot.h for the layout).
+ *
+ *   The same functions are used to write and to read a snapshot,
+ *   so both always follow the same layout. When a streaming function
+ *   is added to ta_stream.h, its members must be added in
+ *   codecMembers() and TA_SNAPSHOT_VERSION incremented if the layout
+ *   of an existing function changes.
+ */
+
+/**** Headers ****/
+#include <string.h>
+
+#include "ta_common.h"
+#include "ta_global.h"
+#include "ta_snapshot.h"
+#include "ta_memory.h"
+
+/**** Local declarations.              ****/
+
+/* Read or write the snapshot. When writing without buffer, only the
+ * size is calculated.
+ */
+typedef struct
+{
+   int                  isLoad;
+   unsigned char       *out;
+   const unsigned char *in;
+   size_t               size;
+   size_t               pos;
+   int                  isError; /* Reading past the end. */
+} TA_Codec;
+
+/**** Local functions declarations.    ****/
+static void codecBytes( TA_Codec *codec, void *data, size_t size );
+static void codecInt( TA_Codec *codec, int *value );
+static void codecDouble( TA_Codec *codec, double *value );
+static void codecHilbert( TA_Codec *codec, TA_StreamHilbert *hilbert );
+static void codecSettings( TA_Codec *codec, int *nbStates, TA_LibcPriv *settings );
+static void codecMembers( TA_Codec *codec, TA_StreamState *state );
+static void codecState( TA_Codec *codec, TA_StreamState *state,
+                        int *optInTimePeriod, double *optInFastLimit, double *optInSlowLimit );
+static int sameSettings( const TA_LibcPriv *settings );
+static TA_RetCode loadState( TA_Codec *codec, TA_StreamState *state );
+
+/**** Global functions definitions.   ****/
+TA_RetCode TA_SnapshotSave( const TA_StreamState states[],
+                            int                  nbStates,
+                            void                *buffer,
+                            size_t               bufferSize,
+                            size_t              *outSize )
+{
+   TA_Codec codec;
+   TA_LibcPriv settings;
+   TA_StreamState state;
+   int i, optInTimePeriod;
+   double optInFastLimit, optInSlowLimit;
+
+   if( !outSize || (nbStates < 0) || (nbStates && !states) )
+      return TA_BAD_PARAM;
+
+   for( i=0; i < nbStates; i++ )
+   {
+      if( ((int)states[i].funcId < 0) || (states[i].funcId >= TA_STREAM_NB_FUNC) ||
+          ((states[i].windowSize > 0) && !states[i].window) )
+         return TA_BAD_PARAM;
+   }
+
+   /* A first pass for the size, a second one to write. */
+   settings = *TA_Globals;
+   memset( &codec, 0, sizeof(TA_Codec) );
+   codecSettings( &codec, &nbStates, &settings );
+   for( i=0; i < nbStates; i++ )
+   {
+      state = states[i];
+      codecState( &codec, &state, &optInTimePeriod, &optInFastLimit, &optInSlowLimit );
+   }
+   *outSize = codec.pos;
+
+   if( !buffer )
+      return TA_SUCCESS;
+
+   if( bufferSize < *outSize )
+      return TA_BAD_PARAM;
+
+   memset( &codec, 0, sizeof(TA_Codec) );
+   codec.out  = (unsigned char *)buffer;
+   codec.size = bufferSize;
+   codecSettings( &codec, &nbStates, &settings );
+   for( i=0; i < nbStates; i++ )
+   {
+      state = states[i];
+      codecState( &codec, &state, &optInTimePeriod, &optInFastLimit, &optInSlowLimit );
+   }
+
+   return TA_SUCCESS;
+}
+
+int TA_SnapshotNbStates( const void *buffer, size_t size )
+{
+   TA_Codec codec;
+   TA_LibcPriv settings;
+   int nbStates;
+
+   if( !buffer )
+      return -1;
+
+   memset( &settings, 0, sizeof(TA_LibcPriv) );
+   memset( &codec, 0, sizeof(TA_Codec) );
+   codec.isLoad = 1;
+   codec.in     = (const unsigned char *)buffer;
+   codec.size   = size;
+   codecSettings( &codec, &nbStates, &settings );
+   if( codec.isError || (nbStates < 0) )
+      return -1;
+
+   return nbStates;
+}
+
+TA_RetCode TA_SnapshotLoad( TA_StreamState states[],
+                            int            nbStates,
+                            const void    *buffer,
+                            size_t         size )
+{
+   TA_Codec codec;
+   TA_LibcPriv settings;
+   TA_RetCode retCode;
+   int i, nbSaved;
+
+   if( !buffer || (nbStates < 0) || (nbStates && !states) )
+      return TA_BAD_PARAM;
+
+   memset( &settings, 0, sizeof(TA_LibcPriv) );
+   memset( &codec, 0, sizeof(TA_Codec) );
+   codec.isLoad = 1;
+   codec.in     = (const unsigned char *)buffer;
+   codec.size   = size;
+   codecSettings( &codec, &nbSaved, &settings );
+   if( codec.isError || (nbSaved < 0) )
+      return TA_BAD_FILE_FORMAT;
+
+   if( nbSaved != nbStates )
+      return TA_BAD_PARAM;
+
+   if( !sameSettings( &settings ) )
+      return TA_SETTINGS_MISMATCH;
+
+   for( i=0; i < nbStates; i++ )
+   {
+      retCode = loadState( &codec, &states[i] );
+      if( (retCode == TA_SUCCESS) && (i == nbStates-1) && (codec.pos != codec.size) )
+         retCode = TA_BAD_FILE_FORMAT;
+      if( retCode != TA_SUCCESS )
+      {
+         while( i >= 0 )
+            TA_StreamFree( &states[i--] );
+         return retCode;
+      }
+   }
+
+   if( (nbStates == 0) && (codec.pos != codec.size) )
+      return TA_BAD_FILE_FORMAT;
+
+   return TA_SUCCESS;
+}
+
+/**** Local functions definitions.     ****/
+static void codecBytes( TA_Codec *codec, void *data, size_t size )
+{
+   if( codec->isLoad )
+   {
+      if( codec->isError || (size > codec->size-codec->pos) )
+      {
+         codec->isError = 1;
+         memset( data, 0, size );
+         return;
+      }
+      memcpy( data, codec->in+codec->pos, size );
+   }
+   else if( codec->out )
+      memcpy( codec->out+codec->pos, data, size );
+
+   codec->pos += size;
+}
+
+static void codecInt( TA_Codec *codec, int *value )
+{
+   unsigned char bytes[4];
+   UInt32 tmp;
+   int i;
+
+   tmp = (UInt32)*value;
+   for( i=0; i < 4; i++ )
+      bytes[i] = (unsigned char)(tmp >> (8*i));
+
+   codecBytes( codec, bytes, 4 );
+
+   if( codec->isLoad )
+   {
+      tmp = 0;
+      for( i=0; i < 4; i++ )
+         tmp |= (UInt32)bytes[i] << (8*i);
+      *value = (int)tmp;
+   }
+}
+
+/* The bits of the double, so the values are restored exactly. */
+static void codecDouble( TA_Codec *codec, double *value )
+{
+   unsigned char bytes[8];
+   UInt64 tmp;
+   int i;
+
+   memcpy( &tmp, value, 8 );
+   for( i=0; i < 8; i++ )
+      bytes[i] = (unsigned char)(tmp >> (8*i));
+
+   codecBytes( codec, bytes, 8 );
+
+   if( codec->isLoad )
+   {
+      tmp = 0;
+      for( i=0; i < 8; i++ )
+         tmp |= (UInt64)bytes[i] << (8*i);
+      memcpy( value, &tmp, 8 );
+   }
+}
+
+static void codecHilbert( TA_Codec *codec, TA_StreamHilbert *hilbert )
+{
+   int i;
+
+   for( i=0; i < 3; i++ )
+   {
+      codecDouble( codec, &hilbert->odd[i] );
+      codecDouble( codec, &hilbert->even[i] );
+   }
+   codecDouble( codec, &hilbert->prevOdd );
+   codecDouble( codec, &hilbert->prevEven );
+   codecDouble( codec, &hilbert->prevInputOdd );
+   codecDouble( codec, &hilbert->prevInputEven );
+}
+
+/* The header. When loading, a wrong magic, version or number of
+ * settings sets codec->isError.
+ */
+static void codecSettings( TA_Codec *codec, int *nbStates, TA_LibcPriv *settings )
+{
+   char magic[8];
+   int i, version, nb, value;
+
+   memcpy( magic, TA_SNAPSHOT_MAGIC, 8 );
+   codecBytes( codec, magic, 8 );
+   version = TA_SNAPSHOT_VERSION;
+   codecInt( codec, &version );
+   if( codec->isLoad && ((memcmp( magic, TA_SNAPSHOT_MAGIC, 8 ) != 0) || (version != TA_SNAPSHOT_VERSION)) )
+      codec->isError = 1;
+
+   codecInt( codec, nbStates );
+
+   value = (int)settings->compatibility;
+   codecInt( codec, &value );
+   settings->compatibility = (TA_Compatibility)value;
+   value = (int)settings->precision;
+   codecInt( codec, &value );
+   settings->precision = (TA_Precision)value;
+
+   nb = TA_FUNC_UNST_ALL;
+   codecInt( codec, &nb );
+   if( nb != TA_FUNC_UNST_ALL )
+      codec->isError = 1;
+   for( i=0; (i < TA_FUNC_UNST_ALL) && !codec->isError; i++ )
+   {
+      value = (int)settings->unstablePeriod[i];
+      codecInt( codec, &value );
+      settings->unstablePeriod[i] = (unsigned int)value;
+   }
+
+   nb = TA_AllCandleSettings;
+   codecInt( codec, &nb );
+   if( nb != TA_AllCandleSettings )
+      codec->isError = 1;
+   for( i=0; (i < TA_AllCandleSettings) && !codec->isError; i++ )
+   {
+      value = (int)settings->candleSettings[i].settingType;
+      codecInt( codec, &value );
+      settings->candleSettings[i].settingType = (TA_CandleSettingType)value;
+      value = (int)settings->candleSettings[i].rangeType;
+      codecInt( codec, &value );
+      settings->candleSettings[i].rangeType = (TA_RangeType)value;
+      codecInt( codec, &settings->candleSettings[i].avgPeriod );
+      codecDouble( codec, &settings->candleSettings[i].factor );
+   }
+}
+
+/* The members of the union of each function. The members derived
+ * from the parameters (like the k of the EMA) are set again by
+ * TA_StreamInit() when loading.
+ */
+static void codecMembers( TA_Codec *codec, TA_StreamState *state )
+{
+   int i;
+
+   switch( state->funcId )
+   {
+   case TA_STREAM_SMA:
+      codecDouble( codec, &state->u.sma.periodTotal );
+      codecDouble( codec, &state->u.sma.periodComp );
+      break;
+   case TA_STREAM_EMA:
+      codecDouble( codec, &state->u.ema.prevMA );
+      break;
+   case TA_STREAM_RSI:
+      codecDouble( codec, &state->u.rsi.prevValue );
+      codecDouble( codec, &state->u.rsi.prevGain );
+      codecDouble( codec, &state->u.rsi.prevLoss );
+      break;
+   case TA_STREAM_ATR:
+      codecDouble( codec, &state->u.atr.prevClose );
+      codecDouble( codec, &state->u.atr.prevATR );
+      break;
+   case TA_STREAM_ADX:
+      codecDouble( codec, &state->u.adx.prevHigh );
+      codecDouble( codec, &state->u.adx.prevLow );
+      codecDouble( codec, &state->u.adx.prevClose );
+      codecDouble( codec, &state->u.adx.prevMinusDM );
+      codecDouble( codec, &state->u.adx.prevPlusDM );
+      codecDouble( codec, &state->u.adx.prevTR );
+      codecDouble( codec, &state->u.adx.sumDX );
+      codecDouble( codec, &state->u.adx.prevADX );
+      break;
+   case TA_STREAM_KAMA:
+      codecDouble( codec, &state->u.kama.prevValue );
+      codecDouble( codec, &state->u.kama.trailingValue );
+      codecDouble( codec, &state->u.kama.sumROC1 );
+      codecDouble( codec, &state->u.kama.prevKAMA );
+      break;
+   case TA_STREAM_MAMA:
+   case TA_STREAM_FAMA:
+      for( i=0; i < 3; i++ )
+         codecDouble( codec, &state->u.mama.price[i] );
+      codecInt( codec, &state->u.mama.priceIdx );
+      codecInt( codec, &state->u.mama.isOdd );
+      codecDouble( codec, &state->u.mama.periodWMASub );
+      codecDouble( codec, &state->u.mama.periodWMASum );
+      codecDouble( codec, &state->u.mama.trailingWMAValue );
+      codecHilbert( codec, &state->u.mama.detrender );
+      codecHilbert( codec, &state->u.mama.Q1 );
+      codecHilbert( codec, &state->u.mama.jI );
+      codecHilbert( codec, &state->u.mama.jQ );
+      codecInt( codec, &state->u.mama.hilbertIdx );
+      codecDouble( codec, &state->u.mama.I1ForOddPrev2 );
+      codecDouble( codec, &state->u.mama.I1ForOddPrev3 );
+      codecDouble( codec, &state->u.mama.I1ForEvenPrev2 );
+      codecDouble( codec, &state->u.mama.I1ForEvenPrev3 );
+      codecDouble( codec, &state->u.mama.prevQ2 );
+      codecDouble( codec, &state->u.mama.prevI2 );
+      codecDouble( codec, &state->u.mama.Re );
+      codecDouble( codec, &state->u.mama.Im );
+      codecDouble( codec, &state->u.mama.period );
+      codecDouble( codec, &state->u.mama.prevPhase );
+      codecDouble( codec, &state->u.mama.mama );
+      codecDouble( codec, &state->u.mama.fama );
+      if( (state->u.mama.priceIdx < 0) || (state->u.mama.priceIdx > 2) ||
+          (state->u.mama.hilbertIdx < 0) || (state->u.mama.hilbertIdx > 2) )
+         codec->isError = 1;
+      break;
+   default:
+      codec->isError = 1;
+   }
+}
+
+/* A state, the parameters come first so the state can be
+ * initialized before its members are read.
+ */
+static void codecState( TA_Codec *codec, TA_StreamState *state,
+                        int *optInTimePeriod, double *optInFastLimit, double *optInSlowLimit )
+{
+   int i, value;
+
+   value = (int)state->funcId;
+   codecInt( codec, &value );
+   state->funcId = (TA_StreamFuncId)value;
+
+   *optInTimePeriod = state->optInTimePeriod;
+   codecInt( codec, optInTimePeriod );
+   if( (state->funcId == TA_STREAM_MAMA) || (state->funcId == TA_STREAM_FAMA) )
+   {
+      *optInFastLimit = state->u.mama.fastLimit;
+      *optInSlowLimit = state->u.mama.slowLimit;
+      codecDouble( codec, optInFastLimit );
+      codecDouble( codec, optInSlowLimit );
+   }
+
+   value = (int)state->compatibility;
+   codecInt( codec, &value );
+   state->compatibility = (TA_Compatibility)value;
+   value = (int)state->precision;
+   codecInt( codec, &value );
+   state->precision = (TA_Precision)value;
+   codecInt( codec, &state->unstablePeriod );
+
+   /* Stop here when loading, the state is initialized first. */
+   if( codec->isLoad )
+      return;
+
+   codecInt( codec, &state->nbBars );
+   codecInt( codec, &state->windowSize );
+   codecInt( codec, &state->windowIdx );
+   for( i=0; i < state->windowSize; i++ )
+      codecDouble( codec, &state->window[i] );
+   codecMembers( codec, state );
+}
+
+static int sameSettings( const TA_LibcPriv *settings )
+{
+   int i;
+
+   if( (settings->compatibility != TA_Globals->compatibility) ||
+       (settings->precision != TA_Globals->precision) )
+      return 0;
+
+   for( i=0; i < TA_FUNC_UNST_ALL; i++ )
+   {
+      if( settings->unstablePeriod[i] != TA_Globals->unstablePeriod[i] )
+         return 0;
+   }
+
+   for( i=0; i < TA_AllCandleSettings; i++ )
+   {
+      if( (settings->candleSettings[i].settingType != TA_Globals->candleSettings[i].settingType) ||
+          (settings->candleSettings[i].rangeType != TA_Globals->candleSettings[i].rangeType) ||
+          (settings->candleSettings[i].avgPeriod != TA_Globals->candleSettings[i].avgPeriod) ||
+          (settings->candleSettings[i].factor != TA_Globals->candleSettings[i].factor) )
+         return 0;
+   }
+
+   return 1;
+}
+
+static TA_RetCode loadState( TA_Codec *codec, TA_StreamState *state )
+{
+   TA_StreamState saved;
+   TA_RetCode retCode;
+   int i, optInTimePeriod, windowSize, maxBars;
+   double optInFastLimit, optInSlowLimit;
+
+   memset( state, 0, sizeof(TA_StreamState) );
+   memset( &saved, 0, sizeof(TA_StreamState) );
+   codecState( codec, &saved, &optInTimePeriod, &optInFastLimit, &optInSlowLimit );
+   if( codec->isError )
+      return TA_BAD_FILE_FORMAT;
+
+   /* The parameters and the settings are validated by the
+    * initialization, which also allocates the window.
+    */
+   if( (saved.funcId == TA_STREAM_MAMA) || (saved.funcId == TA_STREAM_FAMA) )
+      retCode = TA_StreamInitMAMA( state, saved.funcId, optInFastLimit, optInSlowLimit );
+   else
+      retCode = TA_StreamInit( state, saved.funcId, optInTimePeriod );
+   if( retCode == TA_ALLOC_ERR )
+      return retCode;
+   if( (retCode != TA_SUCCESS) || (state->optInTimePeriod != optInTimePeriod) )
+   {
+      TA_StreamFree( state );
+      return TA_BAD_FILE_FORMAT;
+   }
+
+   if( (state->compatibility != saved.compatibility) ||
+       (state->precision != saved.precision) ||
+       (state->unstablePeriod != saved.unstablePeriod) )
+   {
+      TA_StreamFree( state );
+      return TA_SETTINGS_MISMATCH;
+   }
+
+   codecInt( codec, &state->nbBars );
+   codecInt( codec, &windowSize );
+   codecInt( codec, &state->windowIdx );
+
+   /* nbBars stops counting after the lookback and the period. */
+   maxBars = state->lookback > state->optInTimePeriod? state->lookback : state->optInTimePeriod;
+   if( codec->isError || (windowSize != state->windowSize) ||
+       (state->nbBars < 0) || (state->nbBars > maxBars+1) ||
+       (state->windowIdx < 0) || (windowSize && (state->windowIdx >= windowSize)) ||
+       (!windowSize && state->windowIdx) )
+   {
+      TA_StreamFree( state );
+      return TA_BAD_FILE_FORMAT;
+   }
+
+   for( i=0; i < windowSize; i++ )
+      codecDouble( codec, &state->window[i] );
+   codecMembers( codec, state );
+   if( codec->isError )
+   {
+      TA_StreamFree( state );
+      return TA_BAD_FILE_FORMAT;
+   }
+
+   return TA_SUCCESS;
+}
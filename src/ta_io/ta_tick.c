@@ -0,0 +1,595 @@
+/* Description:
+ *   Tick ingestion and multi-timeframe bar resampling feeding
+ *   the streaming indicators (see ta_tick.h).
+ */
+
+/**** Headers ****/
+#if defined(_MSC_VER)
+   #define _CRT_SECURE_NO_WARNINGS
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ta_common.h"
+#include "ta_tick.h"
+#include "ta_memory.h"
+
+/**** Local declarations.              ****/
+
+/* The file is read in chunks of this size. The CSV lines must be
+ * shorter than a chunk.
+ */
+#define TA_TICK_CHUNK_SIZE   (4*1024*1024)
+
+/* Number of CSV ticks parsed before feeding the resampler. */
+#define TA_TICK_BATCH_SIZE   (64*1024)
+
+/* Longest numeric field handled (longer are rejected). */
+#define TA_TICK_MAX_FIELD    64
+
+typedef struct
+{
+   TA_Timeframe timeframe;
+   TA_Bar       bar;
+   Int64        barEnd;
+   int          isOpen;
+} TA_TimeframeState;
+
+struct TA_Resampler
+{
+   TA_TimeframeState *tf;
+   int                nbTimeframe;
+   TA_BarHandler      handler;
+   void              *opaqueData;
+   Int64              lastTimestamp;
+   int                hasTick;
+   UInt64             nbDropped;
+};
+
+/**** Local functions declarations.    ****/
+static int isLittleEndian( void );
+static TA_RetCode completeBar( TA_Resampler *resampler, int idx );
+static const char *parseInt64( const char *ptr, const char *end, Int64 *value );
+static const char *parseDouble( const char *ptr, const char *end, double *value );
+static TA_RetCode processCSV( FILE *in, TA_Resampler *resampler, UInt64 *nbTicks );
+static TA_RetCode processBinary( FILE *in, TA_Resampler *resampler, UInt64 *nbTicks );
+
+/**** Global functions definitions.   ****/
+TA_RetCode TA_ResamplerAlloc( const TA_Timeframe timeframe[],
+                              int nbTimeframe,
+                              TA_BarHandler handler,
+                              void *opaqueData,
+                              TA_Resampler **resampler )
+{
+   TA_Resampler *newResampler;
+   int i;
+
+   if( !resampler )
+      return TA_BAD_PARAM;
+
+   *resampler = NULL;
+
+   if( !timeframe || (nbTimeframe <= 0) )
+      return TA_BAD_PARAM;
+
+   for( i=0; i < nbTimeframe; i++ )
+   {
+      if( (timeframe[i].period <= 0) || (timeframe[i].nbStates < 0) )
+         return TA_BAD_PARAM;
+
+      if( (timeframe[i].nbStates > 0) &&
+          (!timeframe[i].states || !timeframe[i].outReal || !timeframe[i].outNBElement) )
+         return TA_BAD_PARAM;
+   }
+
+   newResampler = (TA_Resampler *)TA_Malloc( sizeof(TA_Resampler) );
+   if( !newResampler )
+      return TA_ALLOC_ERR;
+   memset( newResampler, 0, sizeof(TA_Resampler) );
+
+   newResampler->tf = (TA_TimeframeState *)TA_Malloc( sizeof(TA_TimeframeState)*nbTimeframe );
+   if( !newResampler->tf )
+   {
+      TA_Free( newResampler );
+      return TA_ALLOC_ERR;
+   }
+   memset( newResampler->tf, 0, sizeof(TA_TimeframeState)*nbTimeframe );
+
+   for( i=0; i < nbTimeframe; i++ )
+      newResampler->tf[i].timeframe = timeframe[i];
+
+   newResampler->nbTimeframe = nbTimeframe;
+   newResampler->handler     = handler;
+   newResampler->opaqueData  = opaqueData;
+
+   *resampler = newResampler;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_ResamplerFree( TA_Resampler *resampler )
+{
+   if( !resampler )
+      return TA_BAD_PARAM;
+
+   TA_Free( resampler->tf );
+   TA_Free( resampler );
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_ResamplerAddTicks( TA_Resampler *resampler,
+                                 const TA_Tick ticks[],
+                                 int nbTicks )
+{
+   TA_TimeframeState *tf;
+   TA_RetCode retCode;
+   const TA_Tick *tick;
+   Int64 period, rem;
+   int i, j;
+
+   if( !resampler || (nbTicks < 0) || (!ticks && (nbTicks > 0)) )
+      return TA_BAD_PARAM;
+
+   for( i=0; i < nbTicks; i++ )
+   {
+      tick = &ticks[i];
+
+      if( resampler->hasTick && (tick->timestamp < resampler->lastTimestamp) )
+      {
+         resampler->nbDropped++;
+         continue;
+      }
+      resampler->lastTimestamp = tick->timestamp;
+      resampler->hasTick = 1;
+
+      for( j=0; j < resampler->nbTimeframe; j++ )
+      {
+         tf = &resampler->tf[j];
+
+         /* Most ticks fall in the bar already open. */
+         if( tf->isOpen && (tick->timestamp < tf->barEnd) )
+         {
+            if( tick->price > tf->bar.high )
+               tf->bar.high = tick->price;
+            else if( tick->price < tf->bar.low )
+               tf->bar.low = tick->price;
+            tf->bar.close   = tick->price;
+            tf->bar.volume += tick->volume;
+            continue;
+         }
+
+         if( tf->isOpen )
+         {
+            retCode = completeBar( resampler, j );
+            if( retCode != TA_SUCCESS )
+               return retCode;
+         }
+
+         /* Start of the period, rounded toward negative infinity. */
+         period = tf->timeframe.period;
+         rem = tick->timestamp % period;
+         if( rem < 0 )
+            rem += period;
+
+         tf->bar.timestamp = tick->timestamp - rem;
+         tf->bar.open      = tick->price;
+         tf->bar.high      = tick->price;
+         tf->bar.low       = tick->price;
+         tf->bar.close     = tick->price;
+         tf->bar.volume    = tick->volume;
+         tf->barEnd        = tf->bar.timestamp + period;
+         tf->isOpen        = 1;
+      }
+   }
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_ResamplerFlush( TA_Resampler *resampler )
+{
+   TA_RetCode retCode;
+   int i;
+
+   if( !resampler )
+      return TA_BAD_PARAM;
+
+   for( i=0; i < resampler->nbTimeframe; i++ )
+   {
+      if( resampler->tf[i].isOpen )
+      {
+         retCode = completeBar( resampler, i );
+         if( retCode != TA_SUCCESS )
+            return retCode;
+      }
+   }
+
+   return TA_SUCCESS;
+}
+
+UInt64 TA_ResamplerNbDropped( const TA_Resampler *resampler )
+{
+   if( !resampler )
+      return 0;
+
+   return resampler->nbDropped;
+}
+
+TA_RetCode TA_TickParseCSV( const char *buffer,
+                            size_t size,
+                            TA_Tick ticks[],
+                            int maxTicks,
+                            int *nbTicks,
+                            size_t *nbBytesUsed )
+{
+   const char *ptr, *end, *lineEnd, *fieldEnd;
+   TA_Tick *tick;
+   int nbParsed;
+
+   if( !nbTicks || !nbBytesUsed )
+      return TA_BAD_PARAM;
+
+   *nbTicks = 0;
+   *nbBytesUsed = 0;
+
+   if( (!buffer && (size > 0)) || !ticks || (maxTicks <= 0) )
+      return TA_BAD_PARAM;
+
+   ptr = buffer;
+   end = buffer + size;
+   nbParsed = 0;
+
+   while( nbParsed < maxTicks )
+   {
+      lineEnd = (const char *)memchr( ptr, '\n', (size_t)(end-ptr) );
+      if( !lineEnd )
+         break;
+
+      /* Ignore the '\r' of a "\r\n" end of line. */
+      fieldEnd = lineEnd;
+      if( (fieldEnd > ptr) && (fieldEnd[-1] == '\r') )
+         fieldEnd--;
+
+      if( fieldEnd != ptr )
+      {
+         tick = &ticks[nbParsed];
+
+         ptr = parseInt64( ptr, fieldEnd, &tick->timestamp );
+         if( ptr && (ptr < fieldEnd) && (*ptr == ',') )
+            ptr = parseDouble( ptr+1, fieldEnd, &tick->price );
+         else
+            ptr = NULL;
+         if( ptr && (ptr < fieldEnd) && (*ptr == ',') )
+            ptr = parseDouble( ptr+1, fieldEnd, &tick->volume );
+         else
+            ptr = NULL;
+
+         if( ptr != fieldEnd )
+         {
+            *nbTicks = nbParsed;
+            return TA_BAD_FILE_FORMAT;
+         }
+
+         nbParsed++;
+      }
+
+      ptr = lineEnd+1;
+      *nbBytesUsed = (size_t)(ptr-buffer);
+   }
+
+   *nbTicks = nbParsed;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_TickProcessFile( const char *path,
+                               TA_TickFormat format,
+                               TA_Resampler *resampler,
+                               UInt64 *nbTicks )
+{
+   FILE *in;
+   TA_RetCode retCode;
+   UInt64 nbProcessed;
+
+   if( nbTicks )
+      *nbTicks = 0;
+
+   if( !path || !resampler )
+      return TA_BAD_PARAM;
+
+   in = fopen( path, "rb" );
+   if( !in )
+      return TA_IO_ERROR;
+
+   nbProcessed = 0;
+   switch( format )
+   {
+   case TA_TICK_CSV:
+      retCode = processCSV( in, resampler, &nbProcessed );
+      break;
+   case TA_TICK_BINARY:
+      retCode = processBinary( in, resampler, &nbProcessed );
+      break;
+   default:
+      retCode = TA_BAD_PARAM;
+   }
+
+   fclose( in );
+
+   if( retCode == TA_SUCCESS )
+      retCode = TA_ResamplerFlush( resampler );
+
+   if( nbTicks )
+      *nbTicks = nbProcessed;
+
+   return retCode;
+}
+
+/**** Local functions definitions.     ****/
+static int isLittleEndian( void )
+{
+   const UInt32 value = 1;
+   return *((const unsigned char *)&value) == 1;
+}
+
+static TA_RetCode completeBar( TA_Resampler *resampler, int idx )
+{
+   TA_TimeframeState *tf;
+   TA_RetCode retCode;
+   int i;
+
+   tf = &resampler->tf[idx];
+
+   for( i=0; i < tf->timeframe.nbStates; i++ )
+   {
+      retCode = TA_StreamUpdate( &tf->timeframe.states[i], &tf->bar,
+                                 &tf->timeframe.outNBElement[i],
+                                 &tf->timeframe.outReal[i] );
+      if( retCode != TA_SUCCESS )
+         return retCode;
+   }
+
+   tf->isOpen = 0;
+
+   if( resampler->handler )
+      resampler->handler( resampler->opaqueData, idx, &tf->timeframe, &tf->bar );
+
+   return TA_SUCCESS;
+}
+
+/* Return the position following the number, NULL if there is
+ * no valid number.
+ */
+static const char *parseInt64( const char *ptr, const char *end, Int64 *value )
+{
+   UInt64 result;
+   const char *start;
+   int isNegative;
+
+   isNegative = 0;
+   if( (ptr < end) && ((*ptr == '-') || (*ptr == '+')) )
+      isNegative = (*ptr++ == '-');
+
+   /* 19 digits cannot overflow an UInt64. */
+   start = ptr;
+   result = 0;
+   while( (ptr < end) && (*ptr >= '0') && (*ptr <= '9') )
+   {
+      if( ptr-start == 19 )
+         return NULL;
+      result = result*10 + (UInt64)(*ptr++ - '0');
+   }
+
+   if( (ptr == start) || (result > (UInt64)0x7FFFFFFFFFFFFFFF) )
+      return NULL;
+
+   *value = isNegative? -(Int64)result : (Int64)result;
+
+   return ptr;
+}
+
+static const char *parseDouble( const char *ptr, const char *end, double *value )
+{
+   /* Exactly representable power of 10. */
+   static const double pow10[] = {
+      1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10,
+      1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+   char field[TA_TICK_MAX_FIELD];
+   const char *start, *fieldEnd;
+   char *strtodEnd;
+   UInt64 mantissa;
+   int nbDigits, nbDecimals, isNegative;
+
+   start = ptr;
+   isNegative = 0;
+   if( (ptr < end) && ((*ptr == '-') || (*ptr == '+')) )
+      isNegative = (*ptr++ == '-');
+
+   /* Fast path: up to 15 significant digits and no exponent. The
+    * mantissa and the power of 10 are then both exact, so the single
+    * division is correctly rounded (same result as strtod).
+    */
+   mantissa = 0;
+   nbDigits = 0;
+   nbDecimals = 0;
+   while( (ptr < end) && (*ptr >= '0') && (*ptr <= '9') )
+   {
+      mantissa = mantissa*10 + (UInt64)(*ptr++ - '0');
+      nbDigits++;
+   }
+   if( (ptr < end) && (*ptr == '.') )
+   {
+      ptr++;
+      while( (ptr < end) && (*ptr >= '0') && (*ptr <= '9') )
+      {
+         mantissa = mantissa*10 + (UInt64)(*ptr++ - '0');
+         nbDigits++;
+         nbDecimals++;
+      }
+   }
+
+   if( nbDigits == 0 )
+      return NULL;
+
+   if( (nbDigits <= 15) && ((ptr == end) || ((*ptr != 'e') && (*ptr != 'E'))) )
+   {
+      *value = (double)mantissa / pow10[nbDecimals];
+      if( isNegative )
+         *value = -*value;
+      return ptr;
+   }
+
+   /* Slow path: let strtod handle it on a NULL terminated copy. */
+   fieldEnd = (const char *)memchr( start, ',', (size_t)(end-start) );
+   if( !fieldEnd )
+      fieldEnd = end;
+   if( fieldEnd-start >= TA_TICK_MAX_FIELD )
+      return NULL;
+
+   memcpy( field, start, (size_t)(fieldEnd-start) );
+   field[fieldEnd-start] = '\0';
+   *value = strtod( field, &strtodEnd );
+   if( strtodEnd == field )
+      return NULL;
+
+   return start + (strtodEnd-field);
+}
+
+static TA_RetCode processCSV( FILE *in, TA_Resampler *resampler, UInt64 *nbTicks )
+{
+   TA_RetCode retCode;
+   TA_Tick *ticks;
+   char *chunk;
+   size_t chunkUsed, nbRead, pos, nbBytesUsed;
+   int nbParsed, isFirstLine, isEOF;
+
+   chunk = (char *)TA_Malloc( TA_TICK_CHUNK_SIZE+1 );
+   ticks = (TA_Tick *)TA_Malloc( sizeof(TA_Tick)*TA_TICK_BATCH_SIZE );
+   if( !chunk || !ticks )
+   {
+      FREE_IF_NOT_NULL( chunk );
+      FREE_IF_NOT_NULL( ticks );
+      return TA_ALLOC_ERR;
+   }
+
+   retCode = TA_SUCCESS;
+   isFirstLine = 1;
+   isEOF = 0;
+   chunkUsed = 0;
+
+   while( !isEOF && (retCode == TA_SUCCESS) )
+   {
+      nbRead = fread( chunk+chunkUsed, 1, TA_TICK_CHUNK_SIZE-chunkUsed, in );
+      chunkUsed += nbRead;
+
+      if( ferror( in ) )
+      {
+         retCode = TA_IO_ERROR;
+         break;
+      }
+
+      if( feof( in ) )
+      {
+         /* Terminate the last line if needed. */
+         isEOF = 1;
+         if( (chunkUsed > 0) && (chunk[chunkUsed-1] != '\n') )
+            chunk[chunkUsed++] = '\n';
+      }
+
+      pos = 0;
+      while( pos < chunkUsed )
+      {
+         retCode = TA_TickParseCSV( chunk+pos, chunkUsed-pos,
+                                    ticks, TA_TICK_BATCH_SIZE,
+                                    &nbParsed, &nbBytesUsed );
+
+         if( (retCode == TA_BAD_FILE_FORMAT) && isFirstLine && (nbParsed == 0) && (pos+nbBytesUsed == 0) )
+         {
+            /* Skip the header. */
+            nbBytesUsed = (size_t)((const char *)memchr( chunk, '\n', chunkUsed ) - chunk) + 1;
+            retCode = TA_SUCCESS;
+         }
+         isFirstLine = 0;
+
+         if( retCode != TA_SUCCESS )
+            break;
+
+         if( nbParsed > 0 )
+         {
+            *nbTicks += (UInt64)nbParsed;
+            retCode = TA_ResamplerAddTicks( resampler, ticks, nbParsed );
+            if( retCode != TA_SUCCESS )
+               break;
+         }
+
+         if( nbBytesUsed == 0 )
+            break; /* Incomplete line. */
+
+         pos += nbBytesUsed;
+      }
+
+      if( retCode != TA_SUCCESS )
+         break;
+
+      /* Move the incomplete line at the beginning of the chunk. */
+      chunkUsed -= pos;
+      if( chunkUsed >= TA_TICK_CHUNK_SIZE )
+      {
+         retCode = TA_BAD_FILE_FORMAT; /* Line too long. */
+         break;
+      }
+      memmove( chunk, chunk+pos, chunkUsed );
+   }
+
+   TA_Free( chunk );
+   TA_Free( ticks );
+
+   return retCode;
+}
+
+static TA_RetCode processBinary( FILE *in, TA_Resampler *resampler, UInt64 *nbTicks )
+{
+   TA_RetCode retCode;
+   TA_Tick *ticks;
+   size_t maxBytes, nbRead;
+
+   /* The records are read as-is. */
+   if( !isLittleEndian() || (sizeof(TA_Tick) != 24) )
+      return TA_NOT_SUPPORTED;
+
+   maxBytes = (TA_TICK_CHUNK_SIZE/sizeof(TA_Tick))*sizeof(TA_Tick);
+   ticks = (TA_Tick *)TA_Malloc( maxBytes );
+   if( !ticks )
+      return TA_ALLOC_ERR;
+
+   retCode = TA_SUCCESS;
+   do
+   {
+      nbRead = fread( ticks, 1, maxBytes, in );
+      if( (nbRead < maxBytes) && ferror( in ) )
+      {
+         retCode = TA_IO_ERROR;
+         break;
+      }
+
+      /* A partial record means a truncated file. */
+      if( nbRead % sizeof(TA_Tick) )
+      {
+         retCode = TA_BAD_FILE_FORMAT;
+         break;
+      }
+
+      if( nbRead > 0 )
+      {
+         *nbTicks += (UInt64)(nbRead/sizeof(TA_Tick));
+         retCode = TA_ResamplerAddTicks( resampler, ticks, (int)(nbRead/sizeof(TA_Tick)) );
+      }
+   } while( (nbRead == maxBytes) && (retCode == TA_SUCCESS) );
+
+   TA_Free( ticks );
+
+   return retCode;
+}
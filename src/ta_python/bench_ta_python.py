@@ -0,0 +1,121 @@
+"""Per-call cost of the ta_lib module against a naive wrapper.
+
+The naive wrapper is what a hand-written binding usually does: copy
+the input in a new C array, call the TA function through ctypes while
+holding the GIL, then build the result with the NaN of the lookback
+followed by a copy of the output. The copies are done with memcpy.
+
+    python bench_ta_python.py [-repeat <seconds>] [-threads <n>]
+
+ta_lib must be importable (built module in the current directory or in
+PYTHONPATH).
+"""
+
+import array
+import ctypes
+import math
+import sys
+import threading
+import time
+
+import ta_lib
+
+LENGTHS = (10, 100, 1000, 10000, 100000, 1000000)
+
+_lib = ctypes.PyDLL(ta_lib.__file__)  # PyDLL: the GIL is held during the call.
+_lib.TA_SMA.argtypes = (ctypes.c_int, ctypes.c_int, ctypes.POINTER(ctypes.c_double), ctypes.c_int,
+                        ctypes.POINTER(ctypes.c_int), ctypes.POINTER(ctypes.c_int),
+                        ctypes.POINTER(ctypes.c_double))
+_lib.TA_RSI.argtypes = _lib.TA_SMA.argtypes
+
+
+def naive_call(func, values, period):
+    nb = len(values)
+    inp = (ctypes.c_double * nb).from_buffer_copy(values)
+    out = (ctypes.c_double * nb)()
+    beg = ctypes.c_int()
+    nb_element = ctypes.c_int()
+    ret_code = func(0, nb - 1, inp, period, ctypes.byref(beg), ctypes.byref(nb_element), out)
+    if ret_code != 0:
+        raise RuntimeError("TA error %d" % ret_code)
+    result = array.array('d', [math.nan]) * beg.value
+    result.frombytes(memoryview(out).cast('B')[:nb_element.value * 8])
+    result.extend(array.array('d', [math.nan]) * (nb - beg.value - nb_element.value))
+    return result
+
+
+def naive_sma(values, period):
+    return naive_call(_lib.TA_SMA, values, period)
+
+
+def naive_rsi(values, period):
+    return naive_call(_lib.TA_RSI, values, period)
+
+
+def series(nb):
+    return array.array('d', (100.0 + math.sin(i * 0.01) * 10.0 + (i % 7) * 0.1 for i in range(nb)))
+
+
+def same(a, b):
+    return all((x == y) or (math.isnan(x) and math.isnan(y)) for x, y in zip(a, b)) and len(a) == len(b)
+
+
+def per_call(func, values, period, seconds):
+    nb_call = 0
+    start = time.perf_counter()
+    elapsed = 0.0
+    while elapsed < seconds:
+        func(values, period)
+        nb_call += 1
+        elapsed = time.perf_counter() - start
+    return elapsed / nb_call
+
+
+def threaded(func, values, period, nb_thread, nb_call):
+    def work():
+        for _ in range(nb_call):
+            func(values, period)
+    threads = [threading.Thread(target=work) for _ in range(nb_thread)]
+    start = time.perf_counter()
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    return time.perf_counter() - start
+
+
+def option(name, default):
+    if name in sys.argv:
+        return type(default)(sys.argv[sys.argv.index(name) + 1])
+    return default
+
+
+def main():
+    seconds = option("-repeat", 0.2)
+    nb_thread = option("-threads", 4)
+    period = 14
+
+    print("%-6s %9s %14s %14s %8s" % ("Func", "Bars", "ta_lib(us)", "naive(us)", "Ratio"))
+    for name, func, naive in (("SMA", ta_lib.SMA, naive_sma), ("RSI", ta_lib.RSI, naive_rsi)):
+        for nb in LENGTHS:
+            values = series(nb)
+            if not same(func(values, period), naive(values, period)):
+                print("%s: different results for %d bars" % (name, nb))
+                return 1
+            fast = per_call(func, values, period, seconds)
+            slow = per_call(naive, values, period, seconds)
+            print("%-6s %9d %14.2f %14.2f %8.1f" % (name, nb, fast * 1e6, slow * 1e6, slow / fast))
+
+    # The same total work by 1 thread, then split between nb_thread threads.
+    values = series(1000000)
+    nb_call = 8 * nb_thread
+    print("\nRSI on %d bars, %d calls, 1 thread against %d threads" % (len(values), nb_call, nb_thread))
+    for name, func in (("ta_lib", ta_lib.RSI), ("naive", naive_rsi)):
+        one = threaded(func, values, period, 1, nb_call)
+        many = threaded(func, values, period, nb_thread, nb_call // nb_thread)
+        print("%-6s %8.3fs %8.3fs  speedup %.2f" % (name, one, many, one / many))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
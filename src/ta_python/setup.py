@@ -0,0 +1,37 @@
+# Build of the ta_lib extension module (see docs/220-python.md).
+#
+# The library is compiled into the module, so there is nothing else to
+# install:
+#
+#    pip install ./src/ta_python
+#    python src/ta_python/setup.py build_ext --inplace
+
+import glob
+import os
+
+from setuptools import Extension, setup
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+ROOT = os.path.relpath(os.path.join(HERE, '..', '..'), HERE)
+
+
+def sources(*dirs):
+    files = []
+    for d in dirs:
+        files += sorted(glob.glob(os.path.join(HERE, ROOT, 'src', d, '*.c')))
+    return [os.path.relpath(f, HERE) for f in files]
+
+
+os.chdir(HERE)
+
+setup(
+    ext_modules=[
+        Extension(
+            'ta_lib',
+            sources=['ta_python.c'] + sources('ta_common', 'ta_func', 'ta_io'),
+            include_dirs=[os.path.join(ROOT, 'include'),
+                          os.path.join(ROOT, 'src', 'ta_common'),
+                          os.path.join(ROOT, 'src', 'ta_func')],
+        )
+    ],
+)
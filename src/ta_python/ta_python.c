@@ -0,0 +1,959 @@
+/* Description:
+ *   Python module "ta_lib".
+ *
+ *   Each function of the registry (ta_registry.h) is a callable of the
+ *   module, like ta_lib.SMA( close, 30 ). The inputs are any object
+ *   exporting a contiguous 1-D buffer of float64 (NumPy array,
+ *   array.array, memoryview...) and are used without copy. float32
+ *   inputs are converted once in a temporary buffer.
+ *
+ *   Each output is allocated once with the length of the inputs, and
+ *   the function writes directly at the index of its first bar: the
+ *   output i corresponds to the input i, and the bars of the lookback
+ *   are NaN (0 for the integer outputs). The outputs are NumPy arrays
+ *   when numpy can be imported, array.array otherwise.
+ *
+ *   The GIL is released while the function runs, so several Python
+ *   threads can calculate at the same time.
+ *
+ *   ta_lib.Stream wraps a TA_StreamState (ta_stream.h) and
+ *   ta_lib.stream_run_blocked() calls TA_StreamRunBlocked() on a list
+ *   of them.
+ *
+ *   An error code of the library raises ta_lib.Error.
+ */
+
+/**** Headers ****/
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include <math.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "ta_libc.h"
+#include "ta_registry.h"
+#include "ta_stream.h"
+
+/**** Local declarations.              ****/
+typedef struct
+{
+   Py_buffer view;
+   int       hasView;
+   const double *values;    /* NULL for a float32 input. */
+   double   *converted;     /* float32 input, converted while the GIL is released. */
+} PyInput;
+
+typedef struct
+{
+   PyObject *array;
+   Py_buffer view;
+   int       hasView;
+} PyOutput;
+
+typedef struct
+{
+   PyObject_HEAD
+   const TA_FuncDef *func;
+} PyFunction;
+
+typedef struct
+{
+   PyObject_HEAD
+   TA_StreamState state;
+   int            isInit;
+   int            isBusy; /* Used by a thread having released the GIL. */
+} PyStream;
+
+/* More than the inputs, optional parameters and outputs of any function. */
+#define MAX_NB_ARG 16
+
+/**** Local functions declarations.    ****/
+static int getInput( PyObject *obj, const char *name, PyInput *input, Py_ssize_t *nbBars );
+static void convertInput( PyInput *input, Py_ssize_t nbBars );
+static const double *inputValues( const PyInput *input );
+static void releaseInput( PyInput *input );
+static int newOutput( Py_ssize_t nbBars, int isInteger, PyOutput *output );
+static void releaseOutput( PyOutput *output );
+static void fillLookback( void *output, int isInteger, Py_ssize_t nbBars, int outBegIdx, int outNBElement );
+static PyObject *raiseRetCode( TA_RetCode retCode );
+static int parseOptIn( const TA_FuncDef *func, PyObject *args, Py_ssize_t firstArg,
+                       PyObject *kwargs, double optIn[] );
+static int parseStreamInputs( PyObject *args, PyObject *kwargs, const char *funcName,
+                              PyInput input[3], Py_ssize_t *nbBars );
+static Py_ssize_t findStream( PyObject *streamList, Py_ssize_t nbStates, PyObject *stream );
+
+/**** Local variables definitions.     ****/
+static PyObject *taError;
+static PyObject *numpyEmpty; /* numpy.empty, NULL without numpy. */
+static PyObject *arrayType;  /* array.array */
+
+static const char *streamName[TA_STREAM_NB_FUNC] =
+   { "SMA", "EMA", "RSI", "ATR", "ADX", "KAMA", "MAMA", "FAMA" };
+
+/**** ta_lib.<function>                ****/
+static PyObject *function_call( PyObject *self, PyObject *args, PyObject *kwargs )
+{
+   const TA_FuncDef *func = ((PyFunction *)self)->func;
+   PyInput input[MAX_NB_ARG];
+   PyOutput output[MAX_NB_ARG];
+   const double *inputs[MAX_NB_ARG];
+   void *outputs[MAX_NB_ARG];
+   double optIn[MAX_NB_ARG];
+   TA_RetCode retCode;
+   PyObject *result;
+   Py_ssize_t nbBars;
+   size_t elementSize;
+   int i, lookback, outBegIdx, outNBElement;
+
+   if( PyTuple_GET_SIZE(args) < func->nbInput )
+   {
+      PyErr_Format( PyExc_TypeError, "%s() takes %d input(s)", func->name, func->nbInput );
+      return NULL;
+   }
+   if( parseOptIn( func, args, func->nbInput, kwargs, optIn ) < 0 )
+      return NULL;
+
+   memset( input, 0, sizeof(input) );
+   memset( output, 0, sizeof(output) );
+   result = NULL;
+   nbBars = -1;
+
+   for( i=0; i < func->nbInput; i++ )
+   {
+      if( getInput( PyTuple_GET_ITEM(args,i), func->inputs[i].name, &input[i], &nbBars ) < 0 )
+         goto done;
+   }
+   for( i=0; i < func->nbOutput; i++ )
+   {
+      if( newOutput( nbBars, func->outputs[i].type == TA_OUTPUT_INTEGER, &output[i] ) < 0 )
+         goto done;
+   }
+
+   retCode = TA_SUCCESS;
+   outBegIdx = outNBElement = 0;
+   lookback = func->lookback( optIn );
+
+   Py_BEGIN_ALLOW_THREADS
+   for( i=0; i < func->nbInput; i++ )
+   {
+      convertInput( &input[i], nbBars );
+      inputs[i] = inputValues( &input[i] );
+   }
+
+   /* The function writes the value of its first bar at outputs[i][0],
+    * and this bar is the lookback: the function is given the address
+    * of this bar in the output directly.
+    */
+   for( i=0; i < func->nbOutput; i++ )
+   {
+      elementSize = func->outputs[i].type == TA_OUTPUT_INTEGER? sizeof(int) : sizeof(double);
+      outputs[i] = output[i].view.buf;
+      if( (lookback > 0) && (lookback < nbBars) )
+         outputs[i] = (char *)outputs[i] + (size_t)lookback*elementSize;
+   }
+   if( nbBars > 0 )
+      retCode = func->call( 0, (int)nbBars-1, inputs, optIn, &outBegIdx, &outNBElement, outputs );
+   if( retCode == TA_SUCCESS )
+   {
+      for( i=0; i < func->nbOutput; i++ )
+      {
+         elementSize = func->outputs[i].type == TA_OUTPUT_INTEGER? sizeof(int) : sizeof(double);
+         if( (outNBElement > 0) &&
+             ((char *)outputs[i] != (char *)output[i].view.buf + (size_t)outBegIdx*elementSize) )
+         {
+            /* Not expected: with startIdx 0, the first bar is the lookback. */
+            memmove( (char *)output[i].view.buf + (size_t)outBegIdx*elementSize,
+                     outputs[i], (size_t)outNBElement*elementSize );
+         }
+         fillLookback( output[i].view.buf, func->outputs[i].type == TA_OUTPUT_INTEGER,
+                       nbBars, outBegIdx, outNBElement );
+      }
+   }
+   Py_END_ALLOW_THREADS
+
+   if( retCode != TA_SUCCESS )
+   {
+      raiseRetCode( retCode );
+      goto done;
+   }
+
+   if( func->nbOutput == 1 )
+   {
+      result = output[0].array;
+      Py_INCREF( result );
+   }
+   else if( (result = PyTuple_New( func->nbOutput )) != NULL )
+   {
+      for( i=0; i < func->nbOutput; i++ )
+      {
+         Py_INCREF( output[i].array );
+         PyTuple_SET_ITEM( result, i, output[i].array );
+      }
+   }
+
+done:
+   for( i=0; i < func->nbInput; i++ )
+      releaseInput( &input[i] );
+   for( i=0; i < func->nbOutput; i++ )
+      releaseOutput( &output[i] );
+   return result;
+}
+
+static PyObject *function_lookback( PyObject *self, PyObject *args, PyObject *kwargs )
+{
+   const TA_FuncDef *func = ((PyFunction *)self)->func;
+   double optIn[MAX_NB_ARG];
+   int lookback;
+
+   if( parseOptIn( func, args, 0, kwargs, optIn ) < 0 )
+      return NULL;
+   lookback = func->lookback( optIn );
+   if( lookback < 0 )
+      return raiseRetCode( TA_BAD_PARAM );
+   return PyLong_FromLong( lookback );
+}
+
+static PyObject *namesToTuple( int nb, const void *defs, size_t defSize, size_t nameOffset )
+{
+   PyObject *tuple;
+   const char *name;
+   int i;
+
+   tuple = PyTuple_New( nb );
+   for( i=0; tuple && (i < nb); i++ )
+   {
+      name = *(const char *const *)((const char *)defs + i*defSize + nameOffset);
+      PyTuple_SET_ITEM( tuple, i, PyUnicode_FromString( name ) );
+   }
+   return tuple;
+}
+
+static PyObject *function_get( PyObject *self, void *closure )
+{
+   const TA_FuncDef *func = ((PyFunction *)self)->func;
+
+   switch( (int)(size_t)closure )
+   {
+   case 0:
+      return PyUnicode_FromString( func->name );
+   case 1:
+      return PyUnicode_FromString( func->hint );
+   case 2:
+      return namesToTuple( func->nbInput, func->inputs, sizeof(TA_InputDef),
+                           offsetof(TA_InputDef,name) );
+   case 3:
+      return namesToTuple( func->nbOptInput, func->optInputs, sizeof(TA_OptInputDef),
+                           offsetof(TA_OptInputDef,name) );
+   default:
+      return namesToTuple( func->nbOutput, func->outputs, sizeof(TA_OutputDef),
+                           offsetof(TA_OutputDef,name) );
+   }
+}
+
+static PyObject *function_repr( PyObject *self )
+{
+   return PyUnicode_FromFormat( "<ta_lib function %s>", ((PyFunction *)self)->func->name );
+}
+
+static PyMethodDef functionMethods[] =
+{
+   { "lookback", (PyCFunction)(void(*)(void))function_lookback, METH_VARARGS|METH_KEYWORDS,
+     "lookback(*optIn) -> number of NaN at the start of the outputs." },
+   { NULL, NULL, 0, NULL }
+};
+
+static PyGetSetDef functionGetSet[] =
+{
+   { "name",        function_get, NULL, "Name without the TA_ prefix.", (void *)0 },
+   { "hint",        function_get, NULL, "Description.", (void *)1 },
+   { "inputs",      function_get, NULL, "Names of the inputs.", (void *)2 },
+   { "opt_inputs",  function_get, NULL, "Names of the optional parameters.", (void *)3 },
+   { "outputs",     function_get, NULL, "Names of the outputs.", (void *)4 },
+   { NULL, NULL, NULL, NULL, NULL }
+};
+
+static PyTypeObject functionType =
+{
+   PyVarObject_HEAD_INIT(NULL, 0)
+   .tp_name      = "ta_lib.Function",
+   .tp_basicsize = sizeof(PyFunction),
+   .tp_flags     = Py_TPFLAGS_DEFAULT,
+   .tp_doc       = "A function of the registry. Call it with the inputs, then the optional\n"
+                   "parameters (by position or by name, like optInTimePeriod=30).",
+   .tp_call      = function_call,
+   .tp_repr      = function_repr,
+   .tp_methods   = functionMethods,
+   .tp_getset    = functionGetSet,
+};
+
+/**** ta_lib.Stream                    ****/
+static int stream_init( PyObject *self, PyObject *args, PyObject *kwargs )
+{
+   static char *keywords[] = { "func", "period", "fast_limit", "slow_limit", NULL };
+   PyStream *stream = (PyStream *)self;
+   const char *name;
+   TA_RetCode retCode;
+   double fastLimit, slowLimit;
+   int funcId, period;
+
+   period = TA_INTEGER_DEFAULT;
+   fastLimit = slowLimit = TA_REAL_DEFAULT;
+   if( !PyArg_ParseTupleAndKeywords( args, kwargs, "s|idd", keywords,
+                                     &name, &period, &fastLimit, &slowLimit ) )
+      return -1;
+   if( stream->isBusy )
+   {
+      PyErr_SetString( PyExc_RuntimeError, "stream in use by another thread" );
+      return -1;
+   }
+
+   for( funcId=0; funcId < TA_STREAM_NB_FUNC; funcId++ )
+   {
+      if( strcmp( name, streamName[funcId] ) == 0 )
+         break;
+   }
+   if( funcId == TA_STREAM_NB_FUNC )
+   {
+      PyErr_Format( PyExc_ValueError, "no stream for %s", name );
+      return -1;
+   }
+
+   if( stream->isInit )
+   {
+      TA_StreamFree( &stream->state );
+      stream->isInit = 0;
+   }
+   if( ((funcId == TA_STREAM_MAMA) || (funcId == TA_STREAM_FAMA)) &&
+       ((fastLimit != TA_REAL_DEFAULT) || (slowLimit != TA_REAL_DEFAULT)) )
+      retCode = TA_StreamInitMAMA( &stream->state, (TA_StreamFuncId)funcId, fastLimit, slowLimit );
+   else
+      retCode = TA_StreamInit( &stream->state, (TA_StreamFuncId)funcId, period );
+   if( retCode != TA_SUCCESS )
+   {
+      raiseRetCode( retCode );
+      return -1;
+   }
+   stream->isInit = 1;
+   return 0;
+}
+
+static void stream_dealloc( PyObject *self )
+{
+   PyStream *stream = (PyStream *)self;
+
+   if( stream->isInit )
+      TA_StreamFree( &stream->state );
+   Py_TYPE(self)->tp_free( self );
+}
+
+static int streamReady( PyStream *stream )
+{
+   if( !stream->isInit )
+   {
+      PyErr_SetString( PyExc_RuntimeError, "stream not initialized" );
+      return 0;
+   }
+   if( stream->isBusy )
+   {
+      PyErr_SetString( PyExc_RuntimeError, "stream in use by another thread" );
+      return 0;
+   }
+   return 1;
+}
+
+static PyObject *stream_update( PyObject *self, PyObject *args )
+{
+   PyStream *stream = (PyStream *)self;
+   TA_RetCode retCode;
+   TA_Bar bar;
+   double outReal;
+   int outNBElement;
+
+   if( !streamReady( stream ) )
+      return NULL;
+   memset( &bar, 0, sizeof(bar) );
+   if( (PyTuple_GET_SIZE(args) == 1) &&
+       (stream->state.funcId != TA_STREAM_ATR) && (stream->state.funcId != TA_STREAM_ADX) )
+   {
+      if( !PyArg_ParseTuple( args, "d", &bar.close ) )
+         return NULL;
+      bar.open = bar.high = bar.low = bar.close;
+   }
+   else if( !PyArg_ParseTuple( args, "ddd", &bar.high, &bar.low, &bar.close ) )
+      return NULL;
+
+   retCode = TA_StreamUpdate( &stream->state, &bar, &outNBElement, &outReal );
+   if( retCode != TA_SUCCESS )
+      return raiseRetCode( retCode );
+   return PyFloat_FromDouble( outNBElement? outReal : Py_NAN );
+}
+
+static PyObject *stream_run( PyObject *self, PyObject *args, PyObject *kwargs )
+{
+   PyStream *stream = (PyStream *)self;
+   PyInput input[3];
+   PyOutput output;
+   TA_RetCode retCode;
+   PyObject *result;
+   Py_ssize_t nbBars;
+   double *outReal;
+   int i, outBegIdx, outNBElement;
+
+   if( !streamReady( stream ) )
+      return NULL;
+   memset( &output, 0, sizeof(output) );
+   if( parseStreamInputs( args, kwargs, "run", input, &nbBars ) < 0 )
+      return NULL;
+   result = NULL;
+   if( newOutput( nbBars, 0, &output ) < 0 )
+      goto done;
+
+   stream->isBusy = 1;
+   Py_BEGIN_ALLOW_THREADS
+   for( i=0; i < 3; i++ )
+      convertInput( &input[i], nbBars );
+   outReal = (double *)output.view.buf;
+   retCode = TA_StreamRun( &stream->state, (int)nbBars, inputValues( &input[0] ),
+                           inputValues( &input[1] ), inputValues( &input[2] ),
+                           &outBegIdx, &outNBElement, outReal );
+   if( retCode == TA_SUCCESS )
+   {
+      /* Only in the chunk where the lookback ends. */
+      if( (outBegIdx > 0) && (outNBElement > 0) )
+         memmove( &outReal[outBegIdx], outReal, sizeof(double)*(size_t)outNBElement );
+      fillLookback( outReal, 0, nbBars, outBegIdx, outNBElement );
+   }
+   Py_END_ALLOW_THREADS
+   stream->isBusy = 0;
+
+   if( retCode != TA_SUCCESS )
+      raiseRetCode( retCode );
+   else
+   {
+      result = output.array;
+      Py_INCREF( result );
+   }
+
+done:
+   for( i=0; i < 3; i++ )
+      releaseInput( &input[i] );
+   releaseOutput( &output );
+   return result;
+}
+
+static PyObject *stream_get_lookback( PyObject *self, void *closure )
+{
+   PyStream *stream = (PyStream *)self;
+
+   (void)closure;
+
+   if( !stream->isInit )
+   {
+      PyErr_SetString( PyExc_RuntimeError, "stream not initialized" );
+      return NULL;
+   }
+   return PyLong_FromLong( TA_StreamLookback( &stream->state ) );
+}
+
+static PyMethodDef streamMethods[] =
+{
+   { "update", stream_update, METH_VARARGS,
+     "update(close) or update(high, low, close) -> value of the bar, NaN within the lookback." },
+   { "run", (PyCFunction)(void(*)(void))stream_run, METH_VARARGS|METH_KEYWORDS,
+     "run(close) or run(high, low, close) -> one value per bar of the chunk, NaN within the lookback." },
+   { NULL, NULL, 0, NULL }
+};
+
+static PyGetSetDef streamGetSet[] =
+{
+   { "lookback", stream_get_lookback, NULL, "Lookback of the equivalent function.", NULL },
+   { NULL, NULL, NULL, NULL, NULL }
+};
+
+static PyTypeObject streamType =
+{
+   PyVarObject_HEAD_INIT(NULL, 0)
+   .tp_name      = "ta_lib.Stream",
+   .tp_basicsize = sizeof(PyStream),
+   .tp_flags     = Py_TPFLAGS_DEFAULT,
+   .tp_doc       = "Stream(func, period=default, fast_limit=default, slow_limit=default)\n"
+                   "Incremental state of SMA, EMA, RSI, ATR, ADX, KAMA, MAMA or FAMA.",
+   .tp_new       = PyType_GenericNew,
+   .tp_init      = stream_init,
+   .tp_dealloc   = stream_dealloc,
+   .tp_methods   = streamMethods,
+   .tp_getset    = streamGetSet,
+};
+
+/**** Module functions.                ****/
+static PyObject *module_stream_run_blocked( PyObject *module, PyObject *args, PyObject *kwargs )
+{
+   PyObject *streamList, *result, *item;
+   TA_StreamState *states;
+   PyInput input[3];
+   PyOutput *output;
+   double **outReal;
+   int *outBegIdx, *outNBElement;
+   TA_RetCode retCode;
+   Py_ssize_t nbBars, nbStates, nbBusy;
+   int i, tileSize;
+
+   (void)module;
+   if( PyTuple_GET_SIZE(args) < 1 )
+   {
+      PyErr_SetString( PyExc_TypeError, "stream_run_blocked(streams, close) or "
+                                        "stream_run_blocked(streams, high, low, close)" );
+      return NULL;
+   }
+   streamList = PySequence_Fast( PyTuple_GET_ITEM(args,0), "streams must be a sequence" );
+   if( !streamList )
+      return NULL;
+   nbStates = PySequence_Fast_GET_SIZE( streamList );
+
+   /* Each stream is marked busy as soon as it is checked, so a stream
+    * given twice is rejected: its state would be copied twice and
+    * written back twice.
+    */
+   result = NULL;
+   states = NULL;
+   output = NULL;
+   outReal = NULL;
+   outBegIdx = NULL;
+   memset( input, 0, sizeof(input) );
+   for( nbBusy=0; nbBusy < nbStates; nbBusy++ )
+   {
+      item = PySequence_Fast_GET_ITEM( streamList, nbBusy );
+      if( !PyObject_TypeCheck( item, &streamType ) )
+      {
+         PyErr_SetString( PyExc_TypeError, "streams must be ta_lib.Stream" );
+         goto done;
+      }
+      if( ((PyStream *)item)->isBusy && (findStream( streamList, nbBusy, item ) >= 0) )
+      {
+         PyErr_SetString( PyExc_ValueError, "the same stream is given twice" );
+         goto done;
+      }
+      if( !streamReady( (PyStream *)item ) )
+         goto done;
+      ((PyStream *)item)->isBusy = 1;
+   }
+
+   tileSize = 0;
+   if( kwargs && (PyDict_GET_SIZE(kwargs) > 0) )
+   {
+      item = PyDict_GetItemString( kwargs, "tile" );
+      if( !item || (PyDict_GET_SIZE(kwargs) != 1) )
+         PyErr_SetString( PyExc_TypeError, "stream_run_blocked() only takes the keyword tile" );
+      else
+         tileSize = (int)PyLong_AsLong( item );
+      if( PyErr_Occurred() )
+         goto done;
+   }
+
+   item = PyTuple_GetSlice( args, 1, PyTuple_GET_SIZE(args) );
+   i = item? parseStreamInputs( item, NULL, "stream_run_blocked", input, &nbBars ) : -1;
+   Py_XDECREF( item );
+   if( i < 0 )
+      goto done;
+
+   states = (TA_StreamState *)PyMem_Calloc( (size_t)nbStates+1, sizeof(TA_StreamState) );
+   output = (PyOutput *)PyMem_Calloc( (size_t)nbStates+1, sizeof(PyOutput) );
+   outReal = (double **)PyMem_Calloc( (size_t)nbStates+1, sizeof(double *) );
+   outBegIdx = (int *)PyMem_Calloc( (size_t)nbStates+1, sizeof(int)*2 );
+   if( !states || !output || !outReal || !outBegIdx )
+   {
+      PyErr_NoMemory();
+      goto done;
+   }
+   outNBElement = outBegIdx+nbStates+1;
+   for( i=0; i < nbStates; i++ )
+   {
+      if( newOutput( nbBars, 0, &output[i] ) < 0 )
+         goto done;
+      outReal[i] = (double *)output[i].view.buf;
+   }
+
+   /* The states are advanced in a copy: their window is not moved. */
+   for( i=0; i < nbStates; i++ )
+   {
+      item = PySequence_Fast_GET_ITEM( streamList, i );
+      states[i] = ((PyStream *)item)->state;
+   }
+
+   Py_BEGIN_ALLOW_THREADS
+   for( i=0; i < 3; i++ )
+      convertInput( &input[i], nbBars );
+   retCode = TA_StreamRunBlocked( states, (int)nbStates, (int)nbBars, tileSize,
+                                  inputValues( &input[0] ), inputValues( &input[1] ),
+                                  inputValues( &input[2] ), outBegIdx, outNBElement, outReal );
+   if( retCode == TA_SUCCESS )
+   {
+      for( i=0; i < nbStates; i++ )
+      {
+         if( (outBegIdx[i] > 0) && (outNBElement[i] > 0) )
+            memmove( &outReal[i][outBegIdx[i]], outReal[i], sizeof(double)*(size_t)outNBElement[i] );
+         fillLookback( outReal[i], 0, nbBars, outBegIdx[i], outNBElement[i] );
+      }
+   }
+   Py_END_ALLOW_THREADS
+
+   if( retCode == TA_SUCCESS )
+   {
+      for( i=0; i < nbStates; i++ )
+      {
+         item = PySequence_Fast_GET_ITEM( streamList, i );
+         ((PyStream *)item)->state = states[i];
+      }
+   }
+
+   if( retCode != TA_SUCCESS )
+      raiseRetCode( retCode );
+   else if( (result = PyList_New( nbStates )) != NULL )
+   {
+      for( i=0; i < nbStates; i++ )
+      {
+         Py_INCREF( output[i].array );
+         PyList_SET_ITEM( result, i, output[i].array );
+      }
+   }
+
+done:
+   for( i=0; i < nbBusy; i++ )
+      ((PyStream *)PySequence_Fast_GET_ITEM( streamList, i ))->isBusy = 0;
+   for( i=0; i < 3; i++ )
+      releaseInput( &input[i] );
+   if( output )
+   {
+      for( i=0; i < nbStates; i++ )
+         releaseOutput( &output[i] );
+   }
+   PyMem_Free( states );
+   PyMem_Free( output );
+   PyMem_Free( outReal );
+   PyMem_Free( outBegIdx );
+   Py_DECREF( streamList );
+   return result;
+}
+
+static PyObject *module_functions( PyObject *module, PyObject *unused )
+{
+   PyObject *list;
+   int i;
+
+   (void)module;
+   (void)unused;
+
+   list = PyList_New( TA_FuncCount() );
+   for( i=0; list && (i < TA_FuncCount()); i++ )
+      PyList_SET_ITEM( list, i, PyUnicode_FromString( TA_FuncAt(i)->name ) );
+   return list;
+}
+
+static PyMethodDef moduleMethods[] =
+{
+   { "stream_run_blocked", (PyCFunction)(void(*)(void))module_stream_run_blocked, METH_VARARGS|METH_KEYWORDS,
+     "stream_run_blocked(streams, close) or stream_run_blocked(streams, high, low, close, tile=0)\n"
+     "Advance all the streams on the same bars (TA_StreamRunBlocked), return one array per stream." },
+   { "functions", module_functions, METH_NOARGS,
+     "functions() -> names of all the functions, sorted." },
+   { NULL, NULL, 0, NULL }
+};
+
+static void module_free( void *module )
+{
+   (void)module;
+   Py_CLEAR( numpyEmpty );
+   Py_CLEAR( arrayType );
+   TA_Shutdown();
+}
+
+static struct PyModuleDef taModule =
+{
+   PyModuleDef_HEAD_INIT,
+   "ta_lib",
+   "TA-Lib functions on NumPy arrays (or any buffer of float64).",
+   -1,
+   moduleMethods,
+   NULL, NULL, NULL,
+   module_free
+};
+
+PyMODINIT_FUNC PyInit_ta_lib( void )
+{
+   PyObject *module, *imported, *function;
+   TA_RetCode retCode;
+   int i;
+
+   retCode = TA_Initialize();
+   if( retCode != TA_SUCCESS )
+      return raiseRetCode( retCode );
+
+   if( (PyType_Ready( &functionType ) < 0) || (PyType_Ready( &streamType ) < 0) )
+      return NULL;
+   module = PyModule_Create( &taModule );
+   if( !module )
+      return NULL;
+
+   imported = PyImport_ImportModule( "array" );
+   if( imported )
+   {
+      arrayType = PyObject_GetAttrString( imported, "array" );
+      Py_DECREF( imported );
+   }
+   if( !arrayType )
+      goto error;
+   imported = PyImport_ImportModule( "numpy" );
+   if( imported )
+   {
+      numpyEmpty = PyObject_GetAttrString( imported, "empty" );
+      Py_DECREF( imported );
+   }
+   PyErr_Clear();
+
+   taError = PyErr_NewException( "ta_lib.Error", NULL, NULL );
+   if( !taError || (PyModule_AddObjectRef( module, "Error", taError ) < 0) )
+      goto error;
+   if( PyModule_AddObjectRef( module, "Stream", (PyObject *)&streamType ) < 0 )
+      goto error;
+
+   for( i=0; i < TA_FuncCount(); i++ )
+   {
+      function = (PyObject *)PyObject_New( PyFunction, &functionType );
+      if( !function )
+         goto error;
+      ((PyFunction *)function)->func = TA_FuncAt( i );
+      if( PyModule_AddObject( module, TA_FuncAt(i)->name, function ) < 0 )
+      {
+         Py_DECREF( function );
+         goto error;
+      }
+   }
+
+   return module;
+
+error:
+   Py_DECREF( module );
+   return NULL;
+}
+
+/**** Local functions definitions.     ****/
+static int getInput( PyObject *obj, const char *name, PyInput *input, Py_ssize_t *nbBars )
+{
+   const char *format;
+
+   if( PyObject_GetBuffer( obj, &input->view, PyBUF_C_CONTIGUOUS|PyBUF_FORMAT ) < 0 )
+   {
+      PyErr_Format( PyExc_TypeError, "%s must be a contiguous buffer of float64 or float32", name );
+      return -1;
+   }
+   input->hasView = 1;
+
+   /* Native or little endian on a little endian machine. */
+   format = input->view.format? input->view.format : "B";
+   if( (*format == '@') || (*format == '=') || (!PY_BIG_ENDIAN && (*format == '<')) )
+      format++;
+   if( (input->view.ndim != 1) || (format[1] != '\0') ||
+       !(((*format == 'd') && (input->view.itemsize == sizeof(double))) ||
+         ((*format == 'f') && (input->view.itemsize == sizeof(float)))) )
+   {
+      PyErr_Format( PyExc_TypeError, "%s must be a 1-D array of float64 or float32", name );
+      return -1;
+   }
+   if( (*nbBars >= 0) && (input->view.shape[0] != *nbBars) )
+   {
+      PyErr_Format( PyExc_ValueError, "%s has %zd elements instead of %zd", name,
+                    input->view.shape[0], *nbBars );
+      return -1;
+   }
+   if( input->view.shape[0] > INT_MAX )
+   {
+      PyErr_Format( PyExc_ValueError, "%s has too many elements", name );
+      return -1;
+   }
+   *nbBars = input->view.shape[0];
+
+   if( *format == 'd' )
+      input->values = (const double *)input->view.buf;
+   else
+   {
+      input->converted = (double *)PyMem_RawMalloc( sizeof(double)*((size_t)*nbBars+1) );
+      if( !input->converted )
+      {
+         PyErr_NoMemory();
+         return -1;
+      }
+   }
+
+   return 0;
+}
+
+/* Called without the GIL. */
+static void convertInput( PyInput *input, Py_ssize_t nbBars )
+{
+   const float *values;
+   Py_ssize_t i;
+
+   if( !input->converted )
+      return;
+   values = (const float *)input->view.buf;
+   for( i=0; i < nbBars; i++ )
+      input->converted[i] = values[i];
+}
+
+static const double *inputValues( const PyInput *input )
+{
+   return input->converted? input->converted : input->values;
+}
+
+static void releaseInput( PyInput *input )
+{
+   if( input->hasView )
+      PyBuffer_Release( &input->view );
+   PyMem_RawFree( input->converted );
+   memset( input, 0, sizeof(*input) );
+}
+
+static int newOutput( Py_ssize_t nbBars, int isInteger, PyOutput *output )
+{
+   PyObject *first;
+
+   if( numpyEmpty )
+      output->array = PyObject_CallFunction( numpyEmpty, "ns", nbBars, isInteger? "int32" : "float64" );
+   else
+   {
+      first = PyObject_CallFunction( arrayType, "s(i)", isInteger? "i" : "d", 0 );
+      output->array = first? PySequence_Repeat( first, nbBars ) : NULL;
+      Py_XDECREF( first );
+   }
+   if( !output->array )
+      return -1;
+
+   if( PyObject_GetBuffer( output->array, &output->view, PyBUF_WRITABLE|PyBUF_C_CONTIGUOUS ) < 0 )
+      return -1;
+   output->hasView = 1;
+   return 0;
+}
+
+static void releaseOutput( PyOutput *output )
+{
+   if( output->hasView )
+      PyBuffer_Release( &output->view );
+   Py_CLEAR( output->array );
+   output->hasView = 0;
+}
+
+/* Called without the GIL. */
+static void fillLookback( void *output, int isInteger, Py_ssize_t nbBars, int outBegIdx, int outNBElement )
+{
+   Py_ssize_t i;
+
+   if( outNBElement <= 0 )
+      outBegIdx = outNBElement = 0;
+   for( i=0; i < nbBars; i++ )
+   {
+      if( i == outBegIdx )
+         i += outNBElement;
+      if( i >= nbBars )
+         break;
+      if( isInteger )
+         ((int *)output)[i] = 0;
+      else
+         ((double *)output)[i] = Py_NAN;
+   }
+}
+
+static PyObject *raiseRetCode( TA_RetCode retCode )
+{
+   TA_RetCodeInfo info;
+
+   TA_SetRetCodeInfo( retCode, &info );
+   PyErr_Format( taError? taError : PyExc_RuntimeError, "%s: %s", info.enumStr, info.infoStr );
+   return NULL;
+}
+
+/* The positional arguments from firstArg, then the keywords by the
+ * name of the optional parameter. The missing ones are the default.
+ */
+static int parseOptIn( const TA_FuncDef *func, PyObject *args, Py_ssize_t firstArg,
+                       PyObject *kwargs, double optIn[] )
+{
+   PyObject *value;
+   Py_ssize_t nbArg, nbUsed;
+   int i;
+
+   nbArg = PyTuple_GET_SIZE(args)-firstArg;
+   if( nbArg > func->nbOptInput )
+   {
+      PyErr_Format( PyExc_TypeError, "%s() takes %d optional parameter(s)", func->name, func->nbOptInput );
+      return -1;
+   }
+
+   nbUsed = 0;
+   for( i=0; i < func->nbOptInput; i++ )
+   {
+      value = NULL;
+      if( i < nbArg )
+         value = PyTuple_GET_ITEM( args, firstArg+i );
+      else if( kwargs && (value = PyDict_GetItemString( kwargs, func->optInputs[i].name )) != NULL )
+         nbUsed++;
+
+      if( !value )
+         optIn[i] = func->optInputs[i].type == TA_OPTIN_REAL? TA_REAL_DEFAULT : TA_INTEGER_DEFAULT;
+      else
+      {
+         optIn[i] = PyFloat_AsDouble( value );
+         if( (optIn[i] == -1.0) && PyErr_Occurred() )
+            return -1;
+      }
+   }
+
+   if( kwargs && (PyDict_GET_SIZE(kwargs) != nbUsed) )
+   {
+      PyErr_Format( PyExc_TypeError, "%s() got an unexpected or repeated keyword", func->name );
+      return -1;
+   }
+   return 0;
+}
+
+/* (close) or (high, low, close), for the functions of ta_stream.h. */
+static int parseStreamInputs( PyObject *args, PyObject *kwargs, const char *funcName,
+                              PyInput input[3], Py_ssize_t *nbBars )
+{
+   static const char *name[3] = { "high", "low", "close" };
+   Py_ssize_t nbArg;
+   int i;
+
+   memset( input, 0, sizeof(PyInput)*3 );
+   nbArg = PyTuple_GET_SIZE(args);
+   if( ((nbArg != 1) && (nbArg != 3)) || (kwargs && (PyDict_GET_SIZE(kwargs) != 0)) )
+   {
+      PyErr_Format( PyExc_TypeError, "%s() takes (close) or (high, low, close)", funcName );
+      return -1;
+   }
+
+   *nbBars = -1;
+   for( i=3-(int)nbArg; i < 3; i++ )
+   {
+      if( getInput( PyTuple_GET_ITEM(args,i-(3-nbArg)), name[i], &input[i], nbBars ) < 0 )
+      {
+         for( i=0; i < 3; i++ )
+            releaseInput( &input[i] );
+         return -1;
+      }
+   }
+   return 0;
+}
+
+/* Index of the stream in the first nbStates items, -1 if not found. */
+static Py_ssize_t findStream( PyObject *streamList, Py_ssize_t nbStates, PyObject *stream )
+{
+   Py_ssize_t i;
+
+   for( i=0; i < nbStates; i++ )
+   {
+      if( PySequence_Fast_GET_ITEM( streamList, i ) == stream )
+         return i;
+   }
+   return -1;
+}
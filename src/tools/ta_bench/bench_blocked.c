@@ -0,0 +1,240 @@
+/* Description:
+ *   TA_StreamRunBlocked against one TA_StreamRun per state over all
+ *   the bars (see ta_stream.h).
+ *
+ *   Typical feature set of one symbol: moving averages, RSI, ATR, ADX
+ *   and KAMA of several periods, 30 states in total. One at a time,
+ *   each state reads the whole high/low/close from the memory; by
+ *   tiles, the inputs are read once and stay in the cache for all the
+ *   states. The outputs must be identical.
+ */
+
+/**** Headers ****/
+#if defined(_MSC_VER)
+   #define _CRT_SECURE_NO_WARNINGS
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "ta_libc.h"
+#include "ta_stream.h"
+#include "ta_bench.h"
+
+/**** Local declarations.              ****/
+typedef struct
+{
+   TA_StreamFuncId funcId;
+   int             optInTimePeriod;
+} BenchState;
+
+/**** Local functions declarations.    ****/
+static int initStates( TA_StreamState *states, int nbStates );
+static void freeStates( TA_StreamState *states, int nbStates );
+static unsigned int checksum( const double *values, int nbElement );
+static double nextRandom( unsigned int *seed );
+
+/**** Local variables definitions.     ****/
+static const BenchState benchState[] =
+{
+   { TA_STREAM_SMA, 5 }, { TA_STREAM_SMA, 10 }, { TA_STREAM_SMA, 20 },
+   { TA_STREAM_SMA, 50 }, { TA_STREAM_SMA, 100 }, { TA_STREAM_SMA, 200 },
+   { TA_STREAM_EMA, 5 }, { TA_STREAM_EMA, 10 }, { TA_STREAM_EMA, 12 },
+   { TA_STREAM_EMA, 20 }, { TA_STREAM_EMA, 26 }, { TA_STREAM_EMA, 50 },
+   { TA_STREAM_EMA, 100 }, { TA_STREAM_EMA, 200 },
+   { TA_STREAM_RSI, 7 }, { TA_STREAM_RSI, 14 }, { TA_STREAM_RSI, 21 },
+   { TA_STREAM_ATR, 7 }, { TA_STREAM_ATR, 14 }, { TA_STREAM_ATR, 21 },
+   { TA_STREAM_ADX, 7 }, { TA_STREAM_ADX, 14 }, { TA_STREAM_ADX, 21 },
+   { TA_STREAM_KAMA, 10 }, { TA_STREAM_KAMA, 20 }, { TA_STREAM_KAMA, 30 },
+   { TA_STREAM_SMA, 2 }, { TA_STREAM_EMA, 2 },
+   { TA_STREAM_MAMA, TA_INTEGER_DEFAULT }, { TA_STREAM_FAMA, TA_INTEGER_DEFAULT }
+};
+
+#define NB_BENCH_STATE ((int)(sizeof(benchState)/sizeof(BenchState)))
+
+/**** Global functions definitions.   ****/
+int bench_blocked( int argc, char **argv )
+{
+   TA_RetCode retCode;
+   const char *option;
+   TA_StreamState states[NB_BENCH_STATE];
+   double *buffer, *inHigh, *inLow, *inClose, *outReal[NB_BENCH_STATE];
+   double start, elapsed, separate, blocked, noise, price;
+   unsigned int seed, sum[NB_BENCH_STATE];
+   int nbBars, nbStates, tileSize, nbRepeat, repeat, i;
+   int outBegIdx[NB_BENCH_STATE], outNBElement[NB_BENCH_STATE];
+
+   option = benchOption( argc, argv, "-bars" );
+   nbBars = (int)((option? atof( option ) : 10.0)*1000000.0);
+   option = benchOption( argc, argv, "-states" );
+   nbStates = option? atoi( option ) : NB_BENCH_STATE;
+   option = benchOption( argc, argv, "-tile" );
+   tileSize = option? atoi( option ) : TA_STREAM_TILE_SIZE;
+   option = benchOption( argc, argv, "-repeat" );
+   nbRepeat = option? atoi( option ) : 3;
+   if( (nbBars < 1000) || (nbStates < 1) || (nbStates > NB_BENCH_STATE) ||
+       (tileSize < 1) || (nbRepeat < 1) )
+   {
+      printf( "Invalid -bars, -states, -tile or -repeat (at most %d states)\n", NB_BENCH_STATE );
+      return 3;
+   }
+
+   buffer = (double *)malloc( sizeof(double)*(size_t)nbBars*(3+nbStates) );
+   if( !buffer )
+   {
+      printf( "Not enough memory for %d bars and %d states\n", nbBars, nbStates );
+      return 4;
+   }
+
+   /* Touch all the outputs once, so page faults are not in the timing. */
+   memset( buffer, 0, sizeof(double)*(size_t)nbBars*(3+nbStates) );
+   inHigh  = buffer;
+   inLow   = buffer+(size_t)nbBars;
+   inClose = buffer+(size_t)nbBars*2;
+   for( i=0; i < nbStates; i++ )
+      outReal[i] = buffer+(size_t)nbBars*(3+i);
+
+   printf( "Generating %d bars...\n", nbBars );
+   seed  = 1234;
+   noise = 0.0;
+   for( i=0; i < nbBars; i++ )
+   {
+      noise = 0.99*noise + 0.01*(nextRandom(&seed)-0.5);
+      price = 100.0*exp( noise+0.1*sin( i/1000.0 ) );
+      inClose[i] = price;
+      inHigh[i]  = price*(1.0+0.01*nextRandom(&seed));
+      inLow[i]   = price*(1.0-0.01*nextRandom(&seed));
+   }
+
+   /* Each state alone on all the bars. */
+   separate = 0.0;
+   for( repeat=0; repeat < nbRepeat; repeat++ )
+   {
+      if( !initStates( states, nbStates ) )
+      {
+         free( buffer );
+         return 5;
+      }
+      start = benchTime();
+      for( i=0; i < nbStates; i++ )
+      {
+         retCode = TA_StreamRun( &states[i], nbBars, inHigh, inLow, inClose,
+                                 &outBegIdx[i], &outNBElement[i], outReal[i] );
+         if( retCode != TA_SUCCESS )
+            break;
+      }
+      elapsed = benchTime() - start;
+      freeStates( states, nbStates );
+      if( retCode != TA_SUCCESS )
+      {
+         printf( "TA_StreamRun failed (retCode=%d)\n", retCode );
+         free( buffer );
+         return 5;
+      }
+      if( (repeat == 0) || (elapsed < separate) )
+         separate = elapsed;
+   }
+
+   for( i=0; i < nbStates; i++ )
+      sum[i] = checksum( outReal[i], outNBElement[i] );
+   memset( outReal[0], 0, sizeof(double)*(size_t)nbBars*nbStates );
+
+   blocked = 0.0;
+   for( repeat=0; repeat < nbRepeat; repeat++ )
+   {
+      if( !initStates( states, nbStates ) )
+      {
+         free( buffer );
+         return 5;
+      }
+      start = benchTime();
+      retCode = TA_StreamRunBlocked( states, nbStates, nbBars, tileSize, inHigh, inLow, inClose,
+                                     outBegIdx, outNBElement, outReal );
+      elapsed = benchTime() - start;
+      freeStates( states, nbStates );
+      if( retCode != TA_SUCCESS )
+      {
+         printf( "TA_StreamRunBlocked failed (retCode=%d)\n", retCode );
+         free( buffer );
+         return 5;
+      }
+      if( (repeat == 0) || (elapsed < blocked) )
+         blocked = elapsed;
+   }
+
+   for( i=0; i < nbStates; i++ )
+   {
+      if( checksum( outReal[i], outNBElement[i] ) != sum[i] )
+      {
+         printf( "TA_StreamRunBlocked state %d is not identical to TA_StreamRun\n", i );
+         free( buffer );
+         return 6;
+      }
+   }
+
+   printf( "%d states, tiles of %d bars\n", nbStates, tileSize );
+   printf( "%-10s %10s %12s\n", "Mode", "Time(s)", "ns/bar/state" );
+   printf( "%-10s %10.3f %12.2f\n", "Separate", separate, separate*1e9/((double)nbBars*nbStates) );
+   printf( "%-10s %10.3f %12.2f  (%.2fx)\n", "Blocked", blocked,
+           blocked*1e9/((double)nbBars*nbStates), separate/blocked );
+
+   free( buffer );
+
+   return 0;
+}
+
+/**** Local functions definitions.     ****/
+static int initStates( TA_StreamState *states, int nbStates )
+{
+   TA_RetCode retCode;
+   int i;
+
+   for( i=0; i < nbStates; i++ )
+   {
+      retCode = TA_StreamInit( &states[i], benchState[i].funcId, benchState[i].optInTimePeriod );
+      if( retCode != TA_SUCCESS )
+      {
+         printf( "TA_StreamInit failed (retCode=%d)\n", retCode );
+         freeStates( states, i );
+         return 0;
+      }
+   }
+
+   return 1;
+}
+
+static void freeStates( TA_StreamState *states, int nbStates )
+{
+   int i;
+
+   for( i=0; i < nbStates; i++ )
+      TA_StreamFree( &states[i] );
+}
+
+/* FNV-1a of the bytes of the values. */
+static unsigned int checksum( const double *values, int nbElement )
+{
+   const unsigned char *bytes = (const unsigned char *)values;
+   unsigned int hash = 2166136261u;
+   size_t i;
+
+   for( i=0; i < sizeof(double)*(size_t)nbElement; i++ )
+      hash = (hash^bytes[i])*16777619u;
+
+   return hash;
+}
+
+/* Uniform in [0,1), xorshift32. */
+static double nextRandom( unsigned int *seed )
+{
+   unsigned int x = *seed;
+
+   x ^= x << 13;
+   x ^= x >> 17;
+   x ^= x << 5;
+   *seed = x;
+
+   return x/4294967296.0;
+}
@@ -0,0 +1,170 @@
+/* Description:
+ *   TA_MAFused against one call to TA_MA per type (see ta_mafused.h).
+ *
+ *   All the moving averages are calculated over a long synthetic
+ *   series, with TA_MA for each type and with TA_MAFused. Each call
+ *   is repeated and the best time is kept (the first call to touch
+ *   an output is slowed down by the memory of the system). The
+ *   outputs are compared, they must be identical.
+ */
+
+/**** Headers ****/
+#if defined(_MSC_VER)
+   #define _CRT_SECURE_NO_WARNINGS
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "ta_libc.h"
+#include "ta_mafused.h"
+#include "ta_bench.h"
+
+/**** Local declarations.              ****/
+/* None */
+
+/**** Local functions declarations.    ****/
+static double nextRandom( unsigned int *seed );
+
+/**** Local variables definitions.     ****/
+static const char *typeName[TA_MA_NB_TYPE] =
+{ "SMA", "EMA", "WMA", "DEMA", "TEMA", "TRIMA", "KAMA", "MAMA", "T3" };
+
+/**** Global functions definitions.   ****/
+int bench_mafused( int argc, char **argv )
+{
+   TA_RetCode retCode;
+   const char *option;
+   double *buffer, *inReal, *outSeparate[TA_MA_NB_TYPE], *outFused[TA_MA_NB_TYPE];
+   double start, elapsed, best, totalSeparate, noise;
+   int nbBars, period, mask, type, t, nbType, nbRepeat, repeat;
+   int begIdx, nbElement, outBegIdx[TA_MA_NB_TYPE], outNBElement[TA_MA_NB_TYPE];
+   unsigned int seed;
+
+   option = benchOption( argc, argv, "-bars" );
+   nbBars = (int)((option? atof( option ) : 10.0)*1000000.0);
+   option = benchOption( argc, argv, "-period" );
+   period = option? atoi( option ) : 30;
+   option = benchOption( argc, argv, "-repeat" );
+   nbRepeat = option? atoi( option ) : 3;
+   mask = TA_MA_MASK_ALL;
+   if( benchFlag( argc, argv, "-nomama" ) )
+      mask &= ~TA_MA_MASK(TA_MAType_MAMA);
+   if( (period < 2) || (nbBars <= TA_MA_Lookback( period, TA_MAType_T3 )) || (nbRepeat < 1) )
+   {
+      printf( "Invalid -bars, -period or -repeat\n" );
+      return 3;
+   }
+
+   nbType = 0;
+   for( type=0; type < TA_MA_NB_TYPE; type++ )
+      nbType += (mask & TA_MA_MASK(type))? 1 : 0;
+
+   buffer = (double *)malloc( sizeof(double)*(size_t)nbBars*(1+2*nbType) );
+   if( !buffer )
+   {
+      printf( "Not enough memory for %d bars\n", nbBars );
+      return 4;
+   }
+
+   /* Touch all the outputs once, so page faults are not in the timing. */
+   memset( buffer, 0, sizeof(double)*(size_t)nbBars*(1+2*nbType) );
+   inReal = buffer;
+   t = 1;
+   for( type=0; type < TA_MA_NB_TYPE; type++ )
+   {
+      outSeparate[type] = outFused[type] = NULL;
+      if( !(mask & TA_MA_MASK(type)) )
+         continue;
+      outSeparate[type] = buffer+(size_t)nbBars*t++;
+      outFused[type]    = buffer+(size_t)nbBars*t++;
+   }
+
+   printf( "Generating %d bars...\n", nbBars );
+   seed  = 1234;
+   noise = 0.0;
+   for( t=0; t < nbBars; t++ )
+   {
+      noise = 0.99*noise + 0.01*(nextRandom(&seed)-0.5);
+      inReal[t] = 100.0*exp( noise+0.1*sin( t/1000.0 ) );
+   }
+
+   printf( "%-8s %12s\n", "Type", "TA_MA(s)" );
+   totalSeparate = 0.0;
+   for( type=0; type < TA_MA_NB_TYPE; type++ )
+   {
+      if( !(mask & TA_MA_MASK(type)) )
+         continue;
+      best = 0.0;
+      for( repeat=0; repeat < nbRepeat; repeat++ )
+      {
+         start = benchTime();
+         retCode = TA_MA( 0, nbBars-1, inReal, period, (TA_MAType)type,
+                          &begIdx, &nbElement, outSeparate[type] );
+         elapsed = benchTime() - start;
+         if( retCode != TA_SUCCESS )
+         {
+            printf( "TA_MA %s failed (retCode=%d)\n", typeName[type], retCode );
+            free( buffer );
+            return 5;
+         }
+         if( (repeat == 0) || (elapsed < best) )
+            best = elapsed;
+      }
+      totalSeparate += best;
+      printf( "%-8s %12.3f\n", typeName[type], best );
+   }
+
+   best = 0.0;
+   for( repeat=0; repeat < nbRepeat; repeat++ )
+   {
+      start = benchTime();
+      retCode = TA_MAFused( 0, nbBars-1, inReal, period, mask,
+                            outBegIdx, outNBElement, outFused );
+      elapsed = benchTime() - start;
+      if( retCode != TA_SUCCESS )
+      {
+         printf( "TA_MAFused failed (retCode=%d)\n", retCode );
+         free( buffer );
+         return 5;
+      }
+      if( (repeat == 0) || (elapsed < best) )
+         best = elapsed;
+   }
+
+   for( type=0; type < TA_MA_NB_TYPE; type++ )
+   {
+      if( !(mask & TA_MA_MASK(type)) )
+         continue;
+      if( memcmp( outSeparate[type], outFused[type], sizeof(double)*outNBElement[type] ) != 0 )
+      {
+         printf( "TA_MAFused %s is not identical to TA_MA\n", typeName[type] );
+         free( buffer );
+         return 6;
+      }
+   }
+
+   printf( "%-8s %12.3f\n", "Total", totalSeparate );
+   printf( "%-8s %12.3f  (%.2fx)\n", "Fused", best, totalSeparate/best );
+
+   free( buffer );
+
+   return 0;
+}
+
+/**** Local functions definitions.     ****/
+
+/* Uniform in [0,1), xorshift32. */
+static double nextRandom( unsigned int *seed )
+{
+   unsigned int x = *seed;
+
+   x ^= x << 13;
+   x ^= x >> 17;
+   x ^= x << 5;
+   *seed = x;
+
+   return x/4294967296.0;
+}
@@ -0,0 +1,241 @@
+/* Description:
+ *   Cost of the missing bars policies (see TA_SetMissingPolicy) against
+ *   cleaning the input before the call.
+ *
+ *   The series has a fraction of its bars missing (NaN), by gaps of 1
+ *   to 20 bars. "Fill+call" is the usual way: forward-fill a copy of
+ *   the series, then call the function. The policies are done by the
+ *   function itself on the series with its NaN, and "Masked" gives the
+ *   missing bars by a bitmap (ta_missing.h, carry forward). "No gap"
+ *   is the function on the series without missing bar, for reference.
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "ta_libc.h"
+#include "ta_missing.h"
+#include "ta_bench.h"
+
+/**** Local declarations.              ****/
+typedef enum
+{
+   MISS_SMA,
+   MISS_EMA,
+   MISS_WMA,
+   MISS_STDDEV,
+   NB_MISS_FUNC
+} MissFuncId;
+
+typedef enum
+{
+   RUN_NO_GAP,
+   RUN_FILL,
+   RUN_SKIP,
+   RUN_CARRY,
+   RUN_RESET,
+   RUN_MASKED,
+   NB_RUN
+} MissRunId;
+
+typedef struct
+{
+   int            nbBars;
+   int            period;
+   double        *full;      /* Without missing bar. */
+   double        *gaps;      /* With NaN. */
+   double        *filled;
+   unsigned char *valid;
+   double        *outReal;
+   unsigned char *outValid;
+} MissData;
+
+/**** Local functions declarations.    ****/
+static void generateSeries( MissData *data, double fraction );
+static TA_RetCode run( MissFuncId id, MissRunId runId, MissData *data );
+static TA_RetCode callFunc( MissFuncId id, const MissData *data, const double *in );
+
+/**** Local variables definitions.     ****/
+static const char *funcName[NB_MISS_FUNC] = { "SMA", "EMA", "WMA", "STDDEV" };
+
+/**** Global functions definitions.   ****/
+int bench_missing( int argc, char **argv )
+{
+   MissData data;
+   TA_RetCode retCode;
+   const char *option;
+   double *buffer, start, elapsed, best[NB_RUN], fraction;
+   int id, runId, repeat, i;
+
+   option = benchOption( argc, argv, "-bars" );
+   data.nbBars = (int)((option? atof( option ) : 10.0)*1000000.0);
+   option = benchOption( argc, argv, "-period" );
+   data.period = option? atoi( option ) : 30;
+   option = benchOption( argc, argv, "-missing" );
+   fraction = (option? atof( option ) : 1.0)/100.0;
+   option = benchOption( argc, argv, "-repeat" );
+   repeat = option? atoi( option ) : 3;
+   if( (data.nbBars <= data.period+1) || (data.period < 2) || (fraction < 0.0) || (fraction > 0.5) || (repeat < 1) )
+   {
+      printf( "Invalid -bars, -period, -missing or -repeat\n" );
+      return 3;
+   }
+
+   buffer = (double *)malloc( sizeof(double)*(size_t)data.nbBars*4 + (size_t)(data.nbBars/8+1)*2 );
+   if( !buffer )
+   {
+      printf( "Not enough memory for %d bars\n", data.nbBars );
+      return 4;
+   }
+   data.full     = buffer;
+   data.gaps     = buffer+(size_t)data.nbBars;
+   data.filled   = buffer+(size_t)data.nbBars*2;
+   data.outReal  = buffer+(size_t)data.nbBars*3;
+   data.valid    = (unsigned char *)(buffer+(size_t)data.nbBars*4);
+   data.outValid = data.valid+(data.nbBars/8+1);
+
+   printf( "Generating %d bars, %.1f%% missing...\n", data.nbBars, fraction*100.0 );
+   generateSeries( &data, fraction );
+
+   /* Touch the outputs once, so page faults are not in the timing. */
+   memset( data.outReal, 0, sizeof(double)*(size_t)data.nbBars );
+   memset( data.filled, 0, sizeof(double)*(size_t)data.nbBars );
+
+   printf( "%-8s %10s %10s %10s %10s %10s %10s\n", "Function", "No gap(s)", "Fill+call",
+           "Skip(s)", "Carry(s)", "Reset(s)", "Masked(s)" );
+   for( id=0; id < NB_MISS_FUNC; id++ )
+   {
+      for( runId=0; runId < NB_RUN; runId++ )
+      {
+         best[runId] = 0.0;
+         for( i=0; i < repeat; i++ )
+         {
+            start = benchTime();
+            retCode = run( (MissFuncId)id, (MissRunId)runId, &data );
+            elapsed = benchTime() - start;
+            TA_SetMissingPolicy( TA_MISSING_NONE );
+            if( retCode != TA_SUCCESS )
+            {
+               printf( "%s failed (retCode=%d)\n", funcName[id], retCode );
+               free( buffer );
+               return 5;
+            }
+            if( (i == 0) || (elapsed < best[runId]) )
+               best[runId] = elapsed;
+         }
+      }
+
+      printf( "%-8s %10.3f %10.3f %10.3f %10.3f %10.3f %10.3f\n", funcName[id],
+              best[RUN_NO_GAP], best[RUN_FILL], best[RUN_SKIP], best[RUN_CARRY],
+              best[RUN_RESET], best[RUN_MASKED] );
+   }
+
+   free( buffer );
+
+   return 0;
+}
+
+/**** Local functions definitions.     ****/
+
+/* A random walk, with gaps of 1 to 20 bars. */
+static void generateSeries( MissData *data, double fraction )
+{
+   unsigned int seed;
+   double price;
+   int t, gap;
+
+   seed = 1234;
+   price = 100.0;
+   gap = 0;
+   memset( data->valid, 0, (size_t)(data->nbBars/8+1) );
+   for( t=0; t < data->nbBars; t++ )
+   {
+      seed = seed*1103515245u + 12345u;
+      price *= 1.0 + 0.001*(((seed >> 8) & 0xFFFF)/32768.0-1.0);
+      data->full[t] = price;
+
+      /* A gap starts with a probability giving the fraction missing. */
+      seed = seed*1103515245u + 12345u;
+      if( (gap == 0) && (t > 0) && (((seed >> 8) & 0xFFFFF)/1048576.0 < fraction/10.5) )
+         gap = 1+(int)((seed >> 4) % 20);
+      if( gap > 0 )
+      {
+         data->gaps[t] = NAN;
+         gap--;
+      }
+      else
+      {
+         data->gaps[t] = price;
+         data->valid[t >> 3] |= (unsigned char)(1 << (t & 7));
+      }
+   }
+}
+
+static TA_RetCode run( MissFuncId id, MissRunId runId, MissData *data )
+{
+   int endIdx = data->nbBars-1;
+   int t, outBegIdx, outNBElement;
+   double last;
+
+   switch( runId )
+   {
+   case RUN_NO_GAP:
+      return callFunc( id, data, data->full );
+   case RUN_FILL:
+      last = NAN;
+      for( t=0; t <= endIdx; t++ )
+      {
+         if( data->gaps[t] == data->gaps[t] )
+            last = data->gaps[t];
+         data->filled[t] = last;
+      }
+      return callFunc( id, data, data->filled );
+   case RUN_SKIP:
+      TA_SetMissingPolicy( TA_MISSING_SKIP );
+      return callFunc( id, data, data->gaps );
+   case RUN_CARRY:
+      TA_SetMissingPolicy( TA_MISSING_CARRY_FORWARD );
+      return callFunc( id, data, data->gaps );
+   case RUN_RESET:
+      TA_SetMissingPolicy( TA_MISSING_RESET );
+      return callFunc( id, data, data->gaps );
+   default:
+      TA_SetMissingPolicy( TA_MISSING_CARRY_FORWARD );
+      switch( id )
+      {
+      case MISS_SMA:
+         return TA_MaskedSMA( 0, endIdx, data->full, data->valid, data->period,
+                              &outBegIdx, &outNBElement, data->outReal, data->outValid );
+      case MISS_EMA:
+         return TA_MaskedEMA( 0, endIdx, data->full, data->valid, data->period,
+                              &outBegIdx, &outNBElement, data->outReal, data->outValid );
+      case MISS_WMA:
+         return TA_MaskedWMA( 0, endIdx, data->full, data->valid, data->period,
+                              &outBegIdx, &outNBElement, data->outReal, data->outValid );
+      default:
+         return TA_MaskedSTDDEV( 0, endIdx, data->full, data->valid, data->period, 1.0,
+                                 &outBegIdx, &outNBElement, data->outReal, data->outValid );
+      }
+   }
+}
+
+static TA_RetCode callFunc( MissFuncId id, const MissData *data, const double *in )
+{
+   int endIdx = data->nbBars-1;
+   int outBegIdx, outNBElement;
+
+   switch( id )
+   {
+   case MISS_SMA:
+      return TA_SMA( 0, endIdx, in, data->period, &outBegIdx, &outNBElement, data->outReal );
+   case MISS_EMA:
+      return TA_EMA( 0, endIdx, in, data->period, &outBegIdx, &outNBElement, data->outReal );
+   case MISS_WMA:
+      return TA_WMA( 0, endIdx, in, data->period, &outBegIdx, &outNBElement, data->outReal );
+   default:
+      return TA_STDDEV( 0, endIdx, in, data->period, 1.0, &outBegIdx, &outNBElement, data->outReal );
+   }
+}
@@ -0,0 +1,198 @@
+/* Description:
+ *   TA_MOMENTS against the calls it replaces.
+ *
+ *   "Separate" is the way without the moments: TA_SMA, TA_VAR and
+ *   TA_STDDEV, a pass for the z-score, and the skewness and kurtosis
+ *   done directly on each window (two passes on 'period' values per
+ *   bar). "Z+SKEW+KURT" is the three functions, each calculating all
+ *   the moments, and "MOMENTS" all the outputs in one pass. The
+ *   largest differences with the direct calculation are shown.
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "ta_libc.h"
+#include "ta_bench.h"
+
+/**** Local declarations.              ****/
+typedef enum
+{
+   MOM_MEAN,
+   MOM_VAR,
+   MOM_STDDEV,
+   MOM_SKEW,
+   MOM_KURT,
+   MOM_ZSCORE,
+   NB_MOM_OUT
+} MomOutput;
+
+typedef enum
+{
+   RUN_BASIC,     /* SMA, VAR and STDDEV only, for reference. */
+   RUN_SEPARATE,
+   RUN_SINGLE,
+   RUN_FUSED,
+   NB_RUN
+} MomRunId;
+
+/**** Local functions declarations.    ****/
+static TA_RetCode run( MomRunId runId, const double *inReal, int nbBars, int period,
+                       double *out[NB_MOM_OUT] );
+static void directMoments( const double *inReal, int today, int period,
+                           double *skew, double *kurt );
+
+/**** Local variables definitions.     ****/
+static const char *runName[NB_RUN] = { "SMA+VAR+STDDEV", "Separate", "Z+SKEW+KURT", "MOMENTS" };
+
+/**** Global functions definitions.   ****/
+int bench_moments( int argc, char **argv )
+{
+   TA_RetCode retCode;
+   const char *option;
+   double *buffer, *inReal, *out[NB_RUN][NB_MOM_OUT];
+   double start, elapsed, best, diffSkew, diffKurt;
+   int nbBars, period, nbRepeat, repeat, runId, i, t;
+   unsigned int seed;
+
+   option = benchOption( argc, argv, "-bars" );
+   nbBars = (int)((option? atof( option ) : 1.0)*1000000.0);
+   option = benchOption( argc, argv, "-period" );
+   period = option? atoi( option ) : 30;
+   option = benchOption( argc, argv, "-repeat" );
+   nbRepeat = option? atoi( option ) : 3;
+   if( (period < 2) || (nbBars <= period) || (nbRepeat < 1) )
+   {
+      printf( "Invalid -bars, -period or -repeat\n" );
+      return 3;
+   }
+
+   buffer = (double *)malloc( sizeof(double)*(size_t)nbBars*(1+NB_RUN*NB_MOM_OUT) );
+   if( !buffer )
+   {
+      printf( "Not enough memory for %d bars\n", nbBars );
+      return 4;
+   }
+
+   /* Touch all the outputs once, so page faults are not in the timing. */
+   memset( buffer, 0, sizeof(double)*(size_t)nbBars*(1+NB_RUN*NB_MOM_OUT) );
+   inReal = buffer;
+   for( runId=0; runId < NB_RUN; runId++ )
+      for( i=0; i < NB_MOM_OUT; i++ )
+         out[runId][i] = buffer+(size_t)nbBars*(1+runId*NB_MOM_OUT+i);
+
+   /* A random walk around 100. */
+   seed = 1234;
+   inReal[0] = 100.0;
+   for( t=1; t < nbBars; t++ )
+   {
+      seed = seed*1103515245u + 12345u;
+      inReal[t] = inReal[t-1]*(1.0+0.001*(((seed >> 8) & 0xFFFF)/32768.0-1.0));
+   }
+
+   printf( "%d bars, period %d\n", nbBars, period );
+   for( runId=0; runId < NB_RUN; runId++ )
+   {
+      best = 0.0;
+      for( repeat=0; repeat < nbRepeat; repeat++ )
+      {
+         start = benchTime();
+         retCode = run( (MomRunId)runId, inReal, nbBars, period, out[runId] );
+         elapsed = benchTime() - start;
+         if( retCode != TA_SUCCESS )
+         {
+            printf( "%s failed (retCode=%d)\n", runName[runId], retCode );
+            free( buffer );
+            return 5;
+         }
+         if( (repeat == 0) || (elapsed < best) )
+            best = elapsed;
+      }
+      printf( "%-16s %10.3f s\n", runName[runId], best );
+   }
+
+   diffSkew = diffKurt = 0.0;
+   for( t=0; t < nbBars-period+1; t++ )
+   {
+      diffSkew = fmax( diffSkew, fabs( out[RUN_FUSED][MOM_SKEW][t]-out[RUN_SEPARATE][MOM_SKEW][t] ) );
+      diffKurt = fmax( diffKurt, fabs( out[RUN_FUSED][MOM_KURT][t]-out[RUN_SEPARATE][MOM_KURT][t] ) );
+   }
+   printf( "Largest difference with the direct calculation: skew %.3g, kurt %.3g\n", diffSkew, diffKurt );
+
+   free( buffer );
+
+   return 0;
+}
+
+/**** Local functions definitions.     ****/
+static TA_RetCode run( MomRunId runId, const double *inReal, int nbBars, int period,
+                       double *out[NB_MOM_OUT] )
+{
+   TA_RetCode retCode;
+   int outBegIdx, outNBElement, t;
+
+   switch( runId )
+   {
+   case RUN_BASIC:
+   case RUN_SEPARATE:
+      retCode = TA_SMA( 0, nbBars-1, inReal, period, &outBegIdx, &outNBElement, out[MOM_MEAN] );
+      if( retCode == TA_SUCCESS )
+         retCode = TA_VAR( 0, nbBars-1, inReal, period, 1.0, &outBegIdx, &outNBElement, out[MOM_VAR] );
+      if( retCode == TA_SUCCESS )
+         retCode = TA_STDDEV( 0, nbBars-1, inReal, period, 1.0, &outBegIdx, &outNBElement, out[MOM_STDDEV] );
+      if( (retCode != TA_SUCCESS) || (runId == RUN_BASIC) )
+         return retCode;
+      for( t=0; t < outNBElement; t++ )
+      {
+         out[MOM_ZSCORE][t] = (out[MOM_STDDEV][t] > 0.0)?
+            (inReal[outBegIdx+t]-out[MOM_MEAN][t])/out[MOM_STDDEV][t] : 0.0;
+         directMoments( inReal, outBegIdx+t, period, &out[MOM_SKEW][t], &out[MOM_KURT][t] );
+      }
+      return TA_SUCCESS;
+
+   case RUN_SINGLE:
+      retCode = TA_ZSCORE( 0, nbBars-1, inReal, period, &outBegIdx, &outNBElement, out[MOM_ZSCORE] );
+      if( retCode == TA_SUCCESS )
+         retCode = TA_SKEW( 0, nbBars-1, inReal, period, &outBegIdx, &outNBElement, out[MOM_SKEW] );
+      if( retCode == TA_SUCCESS )
+         retCode = TA_KURT( 0, nbBars-1, inReal, period, &outBegIdx, &outNBElement, out[MOM_KURT] );
+      return retCode;
+
+   default:
+      return TA_MOMENTS( 0, nbBars-1, inReal, period, &outBegIdx, &outNBElement,
+                         out[MOM_MEAN], out[MOM_VAR], out[MOM_STDDEV],
+                         out[MOM_SKEW], out[MOM_KURT], out[MOM_ZSCORE] );
+   }
+}
+
+static void directMoments( const double *inReal, int today, int period,
+                           double *skew, double *kurt )
+{
+   double mean, delta, m2, m3, m4;
+   int i;
+
+   mean = 0.0;
+   for( i=today-period+1; i <= today; i++ )
+      mean += inReal[i];
+   mean /= period;
+
+   m2 = m3 = m4 = 0.0;
+   for( i=today-period+1; i <= today; i++ )
+   {
+      delta = inReal[i]-mean;
+      m2 += delta*delta;
+      m3 += delta*delta*delta;
+      m4 += delta*delta*delta*delta;
+   }
+
+   if( m2 > 0.0 )
+   {
+      *skew = (m3/period)/pow( m2/period, 1.5 );
+      *kurt = (m4/period)/((m2/period)*(m2/period)) - 3.0;
+   }
+   else
+      *skew = *kurt = 0.0;
+}
@@ -0,0 +1,289 @@
+/* Description:
+ *   TA_PanelEMA/RSI/ATR/KAMA/T3 against one call of the scalar
+ *   function per symbol (see ta_panel.h).
+ *
+ *   The series of the symbols are generated one array per symbol, and
+ *   packed once in a panel (the packing is timed apart). The outputs
+ *   of the panel, unpacked, must be identical to the scalar outputs.
+ */
+
+/**** Headers ****/
+#if defined(_MSC_VER)
+   #define _CRT_SECURE_NO_WARNINGS
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "ta_libc.h"
+#include "ta_panel.h"
+#include "ta_bench.h"
+
+/**** Local declarations.              ****/
+typedef enum
+{
+   BENCH_EMA,
+   BENCH_RSI,
+   BENCH_ATR,
+   BENCH_KAMA,
+   BENCH_T3
+} BenchFunc;
+
+typedef struct
+{
+   BenchFunc   func;
+   const char *name;
+} BenchPanelDef;
+
+/**** Local functions declarations.    ****/
+static TA_RetCode callScalar( BenchFunc func, int nbBars, int period,
+                              const double *inHigh, const double *inLow, const double *inClose,
+                              int *outBegIdx, int *outNBElement, double *outReal );
+static TA_RetCode callPanel( BenchFunc func, int nbBars, int nbSymbols, int period,
+                             const double *inHigh, const double *inLow, const double *inClose,
+                             int *outBegIdx, int *outNBElement, double *outReal );
+static double nextRandom( unsigned int *seed );
+
+/**** Local variables definitions.     ****/
+static const BenchPanelDef benchPanel[] =
+{
+   { BENCH_EMA, "EMA" }, { BENCH_RSI, "RSI" }, { BENCH_ATR, "ATR" },
+   { BENCH_KAMA, "KAMA" }, { BENCH_T3, "T3" }
+};
+
+#define NB_BENCH_PANEL ((int)(sizeof(benchPanel)/sizeof(BenchPanelDef)))
+
+/**** Global functions definitions.   ****/
+int bench_panel( int argc, char **argv )
+{
+   TA_RetCode retCode;
+   const char *option;
+   double *buffer, *series, *panel, *outSeries, *outPanel, *unpacked;
+   double *seriesHigh, *seriesLow, *seriesClose, *panelHigh, *panelLow, *panelClose;
+   double **seriesPtr;
+   double start, elapsed, scalar, vector, packing, noise, price;
+   unsigned int seed;
+   size_t size;
+   int nbSymbols, nbBars, period, nbRepeat, repeat, symbol, i, f;
+   int outBegIdx, outNBElement, panelBegIdx, panelNBElement;
+
+   option = benchOption( argc, argv, "-symbols" );
+   nbSymbols = option? atoi( option ) : 1000;
+   option = benchOption( argc, argv, "-bars" );
+   nbBars = option? atoi( option ) : 5000;
+   option = benchOption( argc, argv, "-period" );
+   period = option? atoi( option ) : 14;
+   option = benchOption( argc, argv, "-repeat" );
+   nbRepeat = option? atoi( option ) : 3;
+   if( (nbSymbols < 1) || (nbBars < 1000) || (period < 2) || (period > 100) || (nbRepeat < 1) )
+   {
+      printf( "Invalid -symbols, -bars, -period or -repeat\n" );
+      return 3;
+   }
+
+   /* High, low, close and output, one array per symbol and one panel,
+    * and the unpacked outputs of the panel.
+    */
+   size   = (size_t)nbSymbols*nbBars;
+   buffer = (double *)malloc( sizeof(double)*size*9 );
+   seriesPtr = (double **)malloc( sizeof(double *)*nbSymbols );
+   if( !buffer || !seriesPtr )
+   {
+      printf( "Not enough memory for %d symbols of %d bars\n", nbSymbols, nbBars );
+      free( buffer );
+      free( seriesPtr );
+      return 4;
+   }
+   memset( buffer, 0, sizeof(double)*size*9 );
+   series      = buffer;
+   seriesHigh  = series;
+   seriesLow   = series+size;
+   seriesClose = series+size*2;
+   outSeries   = series+size*3;
+   panel       = buffer+size*4;
+   panelHigh   = panel;
+   panelLow    = panel+size;
+   panelClose  = panel+size*2;
+   outPanel    = panel+size*3;
+   unpacked    = buffer+size*8;
+
+   printf( "Generating %d symbols of %d bars...\n", nbSymbols, nbBars );
+   seed = 1234;
+   for( symbol=0; symbol < nbSymbols; symbol++ )
+   {
+      noise = 0.0;
+      for( i=0; i < nbBars; i++ )
+      {
+         noise = 0.99*noise + 0.01*(nextRandom(&seed)-0.5);
+         price = (50.0+symbol%100)*exp( noise+0.1*sin( (i+symbol)/500.0 ) );
+         seriesClose[(size_t)symbol*nbBars+i] = price;
+         seriesHigh[(size_t)symbol*nbBars+i]  = price*(1.0+0.01*nextRandom(&seed));
+         seriesLow[(size_t)symbol*nbBars+i]   = price*(1.0-0.01*nextRandom(&seed));
+      }
+   }
+
+   packing = 0.0;
+   for( repeat=0; repeat < nbRepeat; repeat++ )
+   {
+      start = benchTime();
+      for( symbol=0; symbol < nbSymbols; symbol++ )
+         seriesPtr[symbol] = seriesClose+(size_t)symbol*nbBars;
+      TA_PanelPack( nbSymbols, nbBars, (const double *const *)seriesPtr, panelClose );
+      elapsed = benchTime() - start;
+      if( (repeat == 0) || (elapsed < packing) )
+         packing = elapsed;
+   }
+   for( symbol=0; symbol < nbSymbols; symbol++ )
+      seriesPtr[symbol] = seriesHigh+(size_t)symbol*nbBars;
+   TA_PanelPack( nbSymbols, nbBars, (const double *const *)seriesPtr, panelHigh );
+   for( symbol=0; symbol < nbSymbols; symbol++ )
+      seriesPtr[symbol] = seriesLow+(size_t)symbol*nbBars;
+   TA_PanelPack( nbSymbols, nbBars, (const double *const *)seriesPtr, panelLow );
+
+   printf( "%d symbols, %d bars, period %d, %d lanes\n", nbSymbols, nbBars, period, TA_PANEL_LANES );
+   printf( "Pack of one series: %.3f s (%.2f ns/value)\n", packing, packing*1e9/(double)size );
+   printf( "%-6s %10s %10s %16s\n", "Func", "Scalar(s)", "Panel(s)", "ns/value(panel)" );
+
+   for( f=0; f < NB_BENCH_PANEL; f++ )
+   {
+      /* One call per symbol. */
+      scalar = 0.0;
+      outBegIdx = outNBElement = 0;
+      for( repeat=0; repeat < nbRepeat; repeat++ )
+      {
+         start = benchTime();
+         for( symbol=0; symbol < nbSymbols; symbol++ )
+         {
+            retCode = callScalar( benchPanel[f].func, nbBars, period,
+                                  seriesHigh+(size_t)symbol*nbBars,
+                                  seriesLow+(size_t)symbol*nbBars,
+                                  seriesClose+(size_t)symbol*nbBars,
+                                  &outBegIdx, &outNBElement,
+                                  outSeries+(size_t)symbol*nbBars );
+            if( retCode != TA_SUCCESS )
+               break;
+         }
+         elapsed = benchTime() - start;
+         if( retCode != TA_SUCCESS )
+         {
+            printf( "TA_%s failed (retCode=%d)\n", benchPanel[f].name, retCode );
+            free( buffer );
+            free( seriesPtr );
+            return 5;
+         }
+         if( (repeat == 0) || (elapsed < scalar) )
+            scalar = elapsed;
+      }
+
+      /* One call for the panel. */
+      vector = 0.0;
+      for( repeat=0; repeat < nbRepeat; repeat++ )
+      {
+         start = benchTime();
+         retCode = callPanel( benchPanel[f].func, nbBars, nbSymbols, period,
+                              panelHigh, panelLow, panelClose,
+                              &panelBegIdx, &panelNBElement, outPanel );
+         elapsed = benchTime() - start;
+         if( retCode != TA_SUCCESS )
+         {
+            printf( "TA_Panel%s failed (retCode=%d)\n", benchPanel[f].name, retCode );
+            free( buffer );
+            free( seriesPtr );
+            return 5;
+         }
+         if( (repeat == 0) || (elapsed < vector) )
+            vector = elapsed;
+      }
+
+      if( (panelBegIdx != outBegIdx) || (panelNBElement != outNBElement) )
+      {
+         printf( "TA_Panel%s range is not identical to TA_%s\n", benchPanel[f].name, benchPanel[f].name );
+         free( buffer );
+         free( seriesPtr );
+         return 6;
+      }
+
+      for( symbol=0; symbol < nbSymbols; symbol++ )
+         seriesPtr[symbol] = unpacked+(size_t)symbol*nbBars;
+      TA_PanelUnpack( nbSymbols, outNBElement, outPanel, seriesPtr );
+      for( symbol=0; symbol < nbSymbols; symbol++ )
+      {
+         if( memcmp( seriesPtr[symbol], outSeries+(size_t)symbol*nbBars,
+                     sizeof(double)*outNBElement ) != 0 )
+         {
+            printf( "TA_Panel%s symbol %d is not identical to TA_%s\n",
+                    benchPanel[f].name, symbol, benchPanel[f].name );
+            free( buffer );
+            free( seriesPtr );
+            return 6;
+         }
+      }
+
+      printf( "%-6s %10.3f %10.3f %16.2f  (%.2fx)\n", benchPanel[f].name, scalar, vector,
+              vector*1e9/(double)size, scalar/vector );
+   }
+
+   free( buffer );
+   free( seriesPtr );
+
+   return 0;
+}
+
+/**** Local functions definitions.     ****/
+static TA_RetCode callScalar( BenchFunc func, int nbBars, int period,
+                              const double *inHigh, const double *inLow, const double *inClose,
+                              int *outBegIdx, int *outNBElement, double *outReal )
+{
+   switch( func )
+   {
+   case BENCH_EMA:
+      return TA_EMA( 0, nbBars-1, inClose, period, outBegIdx, outNBElement, outReal );
+   case BENCH_RSI:
+      return TA_RSI( 0, nbBars-1, inClose, period, outBegIdx, outNBElement, outReal );
+   case BENCH_ATR:
+      return TA_ATR( 0, nbBars-1, inHigh, inLow, inClose, period, outBegIdx, outNBElement, outReal );
+   case BENCH_KAMA:
+      return TA_KAMA( 0, nbBars-1, inClose, period, outBegIdx, outNBElement, outReal );
+   case BENCH_T3:
+      return TA_T3( 0, nbBars-1, inClose, period, 0.7, outBegIdx, outNBElement, outReal );
+   }
+
+   return TA_BAD_PARAM;
+}
+
+static TA_RetCode callPanel( BenchFunc func, int nbBars, int nbSymbols, int period,
+                             const double *inHigh, const double *inLow, const double *inClose,
+                             int *outBegIdx, int *outNBElement, double *outReal )
+{
+   switch( func )
+   {
+   case BENCH_EMA:
+      return TA_PanelEMA( 0, nbBars-1, nbSymbols, inClose, period, outBegIdx, outNBElement, outReal );
+   case BENCH_RSI:
+      return TA_PanelRSI( 0, nbBars-1, nbSymbols, inClose, period, outBegIdx, outNBElement, outReal );
+   case BENCH_ATR:
+      return TA_PanelATR( 0, nbBars-1, nbSymbols, inHigh, inLow, inClose, period,
+                          outBegIdx, outNBElement, outReal );
+   case BENCH_KAMA:
+      return TA_PanelKAMA( 0, nbBars-1, nbSymbols, inClose, period, outBegIdx, outNBElement, outReal );
+   case BENCH_T3:
+      return TA_PanelT3( 0, nbBars-1, nbSymbols, inClose, period, 0.7, outBegIdx, outNBElement, outReal );
+   }
+
+   return TA_BAD_PARAM;
+}
+
+/* Uniform in [0,1), xorshift32. */
+static double nextRandom( unsigned int *seed )
+{
+   unsigned int x = *seed;
+
+   x ^= x << 13;
+   x ^= x >> 17;
+   x ^= x << 5;
+   *seed = x;
+
+   return x/4294967296.0;
+}
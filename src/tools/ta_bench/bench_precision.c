@@ -0,0 +1,324 @@
+/* Description:
+ *   Cost and accuracy of TA_PRECISION_COMPENSATED and
+ *   TA_PRECISION_PREFIX_SUM (see TA_SetPrecision).
+ *
+ *   The functions having a compensated version are called once over a
+ *   long synthetic series, in the three precision modes (only SMA and
+ *   VAR have a prefix sum version, the others are calculated as with
+ *   the default). The prices go from
+ *   1000000 down to 1, so the rounding errors accumulated while the
+ *   values were large are significative at the end of the series.
+ *
+ *   The error is measured on a sample of outputs against an exact
+ *   calculation of their window (double-double sums), relative to the
+ *   magnitude of the values in the window.
+ */
+
+/**** Headers ****/
+#if defined(_MSC_VER)
+   #define _CRT_SECURE_NO_WARNINGS
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "ta_libc.h"
+#include "ta_bench.h"
+
+/**** Local declarations.              ****/
+typedef enum
+{
+   PREC_SMA,
+   PREC_VAR,
+   PREC_CORREL,
+   PREC_BETA,
+   PREC_OBV,
+   PREC_AD,
+   NB_PREC_FUNC
+} PrecFuncId;
+
+typedef struct
+{
+   int     nbBars;
+   int     period;
+   double *close;
+   double *close2;
+   double *high;
+   double *low;
+   double *volume;
+   double *outReal;
+} PrecData;
+
+typedef struct
+{
+   double hi;
+   double lo;
+} ExactSum;
+
+#define SAMPLE_STEP 9973
+
+/**** Local functions declarations.    ****/
+static void generateSeries( PrecData *data );
+static TA_RetCode callFunc( PrecFuncId id, const PrecData *data, int *outBegIdx );
+static double maxError( PrecFuncId id, const PrecData *data, int outBegIdx );
+static double windowError( PrecFuncId id, const PrecData *data, int outBegIdx, int today );
+static void exactAdd( ExactSum *sum, double value );
+static double nextRandom( unsigned int *seed );
+
+/**** Local variables definitions.     ****/
+static const char *funcName[NB_PREC_FUNC] = { "SMA", "VAR", "CORREL", "BETA", "OBV", "AD" };
+
+/**** Global functions definitions.   ****/
+int bench_precision( int argc, char **argv )
+{
+   static const TA_Precision precision[3] = { TA_PRECISION_DEFAULT,
+                                              TA_PRECISION_COMPENSATED,
+                                              TA_PRECISION_PREFIX_SUM };
+
+   PrecData data;
+   TA_RetCode retCode;
+   const char *option;
+   double *buffer, start, elapsed[3], error[3];
+   int id, mode, outBegIdx;
+
+   option = benchOption( argc, argv, "-bars" );
+   data.nbBars = (int)((option? atof( option ) : 50.0)*1000000.0);
+   option = benchOption( argc, argv, "-period" );
+   data.period = option? atoi( option ) : 30;
+   if( (data.nbBars <= data.period+1) || (data.period < 2) )
+   {
+      printf( "Invalid -bars or -period\n" );
+      return 3;
+   }
+
+   buffer = (double *)malloc( sizeof(double)*(size_t)data.nbBars*6 );
+   if( !buffer )
+   {
+      printf( "Not enough memory for %d bars\n", data.nbBars );
+      return 4;
+   }
+   data.close   = buffer;
+   data.close2  = buffer+(size_t)data.nbBars;
+   data.high    = buffer+(size_t)data.nbBars*2;
+   data.low     = buffer+(size_t)data.nbBars*3;
+   data.volume  = buffer+(size_t)data.nbBars*4;
+   data.outReal = buffer+(size_t)data.nbBars*5;
+
+   printf( "Generating %d bars...\n", data.nbBars );
+   generateSeries( &data );
+
+   /* Touch the output once, so page faults are not in the timing. */
+   memset( data.outReal, 0, sizeof(double)*(size_t)data.nbBars );
+
+   printf( "%-8s %11s %11s %11s %11s %11s %11s\n", "Function", "Default(s)",
+           "Compens.(s)", "Prefix(s)", "Default err", "Compens.err", "Prefix err" );
+   for( id=0; id < NB_PREC_FUNC; id++ )
+   {
+      for( mode=0; mode < 3; mode++ )
+      {
+         TA_SetPrecision( precision[mode] );
+         start = benchTime();
+         retCode = callFunc( (PrecFuncId)id, &data, &outBegIdx );
+         elapsed[mode] = benchTime() - start;
+         if( retCode != TA_SUCCESS )
+         {
+            printf( "%s failed (retCode=%d)\n", funcName[id], retCode );
+            TA_SetPrecision( TA_PRECISION_DEFAULT );
+            free( buffer );
+            return 5;
+         }
+         error[mode] = maxError( (PrecFuncId)id, &data, outBegIdx );
+      }
+
+      printf( "%-8s %11.3f %11.3f %11.3f %11.3g %11.3g %11.3g\n", funcName[id],
+              elapsed[0], elapsed[1], elapsed[2], error[0], error[1], error[2] );
+   }
+
+   TA_SetPrecision( TA_PRECISION_DEFAULT );
+   free( buffer );
+
+   return 0;
+}
+
+/**** Local functions definitions.     ****/
+
+/* Prices going down from 1000000 to 1 with some noise. */
+static void generateSeries( PrecData *data )
+{
+   unsigned int seed;
+   double trend, noise;
+   int t;
+
+   seed = 1234;
+   noise = 0.0;
+   for( t=0; t < data->nbBars; t++ )
+   {
+      trend = log(1000000.0)*(1.0-(double)t/data->nbBars);
+      noise = 0.99*noise + 0.01*(nextRandom(&seed)-0.5);
+      data->close[t]  = exp( trend+noise );
+      data->close2[t] = exp( trend+0.5*noise+0.005*(nextRandom(&seed)-0.5) );
+      data->high[t]   = data->close[t]*(1.0+0.01*nextRandom(&seed));
+      data->low[t]    = data->close[t]*(1.0-0.01*nextRandom(&seed));
+      data->volume[t] = 1000.0+10000000.0*nextRandom(&seed);
+   }
+}
+
+static TA_RetCode callFunc( PrecFuncId id, const PrecData *data, int *outBegIdx )
+{
+   int endIdx = data->nbBars-1;
+   int outNBElement;
+
+   switch( id )
+   {
+   case PREC_SMA:
+      return TA_SMA( 0, endIdx, data->close, data->period, outBegIdx, &outNBElement, data->outReal );
+   case PREC_VAR:
+      return TA_VAR( 0, endIdx, data->close, data->period, 1.0, outBegIdx, &outNBElement, data->outReal );
+   case PREC_CORREL:
+      return TA_CORREL( 0, endIdx, data->close, data->close2, data->period, outBegIdx, &outNBElement, data->outReal );
+   case PREC_BETA:
+      return TA_BETA( 0, endIdx, data->close2, data->close, data->period, outBegIdx, &outNBElement, data->outReal );
+   case PREC_OBV:
+      return TA_OBV( 0, endIdx, data->close, data->volume, outBegIdx, &outNBElement, data->outReal );
+   default:
+      return TA_AD( 0, endIdx, data->high, data->low, data->close, data->volume,
+                    outBegIdx, &outNBElement, data->outReal );
+   }
+}
+
+static double maxError( PrecFuncId id, const PrecData *data, int outBegIdx )
+{
+   ExactSum sum;
+   double error, maxErr, value;
+   int t;
+
+   maxErr = 0.0;
+
+   if( (id == PREC_OBV) || (id == PREC_AD) )
+   {
+      /* Cumulative, relative to the largest volume of a bar. */
+      memset( &sum, 0, sizeof(sum) );
+      if( id == PREC_OBV )
+         exactAdd( &sum, data->volume[0] );
+      for( t=0; t < data->nbBars; t++ )
+      {
+         if( id == PREC_OBV )
+         {
+            if( (t > 0) && (data->close[t] > data->close[t-1]) )
+               exactAdd( &sum, data->volume[t] );
+            else if( (t > 0) && (data->close[t] < data->close[t-1]) )
+               exactAdd( &sum, -data->volume[t] );
+         }
+         else if( data->high[t] > data->low[t] )
+         {
+            value = ((data->close[t]-data->low[t])-(data->high[t]-data->close[t]))/(data->high[t]-data->low[t]);
+            exactAdd( &sum, value*data->volume[t] );
+         }
+
+         if( (t % SAMPLE_STEP == 0) || (t == data->nbBars-1) )
+         {
+            error = fabs( data->outReal[t-outBegIdx]-(sum.hi+sum.lo) )/10000000.0;
+            if( error > maxErr )
+               maxErr = error;
+         }
+      }
+      return maxErr;
+   }
+
+   for( t=data->nbBars-1; t >= outBegIdx+data->period; t -= SAMPLE_STEP )
+   {
+      error = windowError( id, data, outBegIdx, t );
+      if( error > maxErr )
+         maxErr = error;
+   }
+
+   return maxErr;
+}
+
+static double windowError( PrecFuncId id, const PrecData *data, int outBegIdx, int today )
+{
+   ExactSum sumX, sumY, sumXX, sumXY, sumYY;
+   double x, y, meanX, meanY, expected, *changeX, *changeY;
+   int k, period;
+
+   period = data->period;
+   changeX = (double *)malloc( sizeof(double)*period*2 );
+   if( !changeX )
+      return -1.0;
+   changeY = changeX+period;
+
+   memset( &sumX, 0, sizeof(sumX) );
+   memset( &sumY, 0, sizeof(sumY) );
+   for( k=0; k < period; k++ )
+   {
+      if( id == PREC_BETA )
+      {
+         x = (data->close2[today-k]-data->close2[today-k-1])/data->close2[today-k-1];
+         y = (data->close[today-k]-data->close[today-k-1])/data->close[today-k-1];
+      }
+      else
+      {
+         x = data->close[today-k];
+         y = data->close2[today-k];
+      }
+      changeX[k] = x;
+      changeY[k] = y;
+      exactAdd( &sumX, x );
+      exactAdd( &sumY, y );
+   }
+   meanX = (sumX.hi+sumX.lo)/period;
+   meanY = (sumY.hi+sumY.lo)/period;
+
+   memset( &sumXX, 0, sizeof(sumXX) );
+   memset( &sumXY, 0, sizeof(sumXY) );
+   memset( &sumYY, 0, sizeof(sumYY) );
+   for( k=0; k < period; k++ )
+   {
+      exactAdd( &sumXX, (changeX[k]-meanX)*(changeX[k]-meanX) );
+      exactAdd( &sumXY, (changeX[k]-meanX)*(changeY[k]-meanY) );
+      exactAdd( &sumYY, (changeY[k]-meanY)*(changeY[k]-meanY) );
+   }
+   free( changeX );
+
+   x = data->outReal[today-outBegIdx];
+   switch( id )
+   {
+   case PREC_SMA:
+      return fabs( x-meanX )/meanX;
+   case PREC_VAR:
+      expected = (sumXX.hi+sumXX.lo)/period;
+      return fabs( x-expected )/(meanX*meanX);
+   case PREC_CORREL:
+      expected = (sumXY.hi+sumXY.lo)/sqrt( (sumXX.hi+sumXX.lo)*(sumYY.hi+sumYY.lo) );
+      return fabs( x-expected );
+   default:
+      expected = (sumXY.hi+sumXY.lo)/(sumXX.hi+sumXX.lo);
+      return fabs( x-expected )/(fabs(expected)+1.0);
+   }
+}
+
+/* Error-free addition (Knuth's TwoSum) in a double-double. */
+static void exactAdd( ExactSum *sum, double value )
+{
+   double newHi, virtualValue;
+
+   newHi = sum->hi+value;
+   virtualValue = newHi-sum->hi;
+   sum->lo += (sum->hi-(newHi-virtualValue))+(value-virtualValue);
+   sum->hi = newHi;
+}
+
+/* Uniform in [0,1), xorshift32. */
+static double nextRandom( unsigned int *seed )
+{
+   unsigned int x = *seed;
+
+   x ^= x << 13;
+   x ^= x >> 17;
+   x ^= x << 5;
+   *seed = x;
+
+   return x/4294967296.0;
+}
@@ -0,0 +1,276 @@
+/* Description:
+ *   End-to-end benchmark of the tick pipeline: a synthetic tick
+ *   file is parsed in chunks, resampled in 1 second, 1 minute and
+ *   5 minutes bars, and every bar is pushed into SMA, EMA, RSI and
+ *   ATR streaming states.
+ *
+ *   The generation of the file is not included in the timing.
+ */
+
+/**** Headers ****/
+#if defined(_MSC_VER)
+   #define _CRT_SECURE_NO_WARNINGS
+#else
+   /* fseeko() and ftello() are POSIX, not declared by a strict -std=c17,
+    * and their off_t must be 64 bits on a 32 bits system.
+    */
+   #define _POSIX_C_SOURCE 200112L
+   #define _FILE_OFFSET_BITS 64
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ta_libc.h"
+#include "ta_tick.h"
+#include "ta_bench.h"
+
+/**** Local declarations.              ****/
+#define NB_TIMEFRAME     3
+#define NB_INDICATOR     4
+#define WRITE_BUFFER     (4*1024*1024)
+
+typedef struct
+{
+   UInt64 nbBars[NB_TIMEFRAME];
+   double checksum;
+} BenchData;
+
+/**** Local functions declarations.    ****/
+static int generateFile( const char *path, TA_TickFormat format, UInt64 size );
+static void nextTick( UInt64 *seed, TA_Tick *tick );
+static double getFileSize( const char *path );
+static void onBar( void *opaqueData, int timeframeIdx,
+                   const TA_Timeframe *timeframe, const TA_Bar *bar );
+
+/**** Global functions definitions.   ****/
+int bench_ticks( int argc, char **argv )
+{
+   static const Int64 period[NB_TIMEFRAME] = { 1000, 60000, 300000 };
+   static const char *periodName[NB_TIMEFRAME] = { "1s", "1m", "5m" };
+
+   TA_StreamState states[NB_TIMEFRAME][NB_INDICATOR];
+   double outReal[NB_TIMEFRAME][NB_INDICATOR];
+   int outNBElement[NB_TIMEFRAME][NB_INDICATOR];
+   TA_Timeframe timeframe[NB_TIMEFRAME];
+   TA_Resampler *resampler;
+   TA_TickFormat format;
+   TA_RetCode retCode;
+   BenchData data;
+   const char *path, *option;
+   UInt64 size, nbTicks;
+   FILE *file;
+   double start, elapsed, fileSize;
+   int i, j, keep, retValue;
+
+   option = benchOption( argc, argv, "-size" );
+   size = (UInt64)((option? atof( option ) : 2048.0)*1024*1024);
+
+   option = benchOption( argc, argv, "-format" );
+   format = (option && (strcmp( option, "binary" ) == 0))? TA_TICK_BINARY : TA_TICK_CSV;
+
+   path = benchOption( argc, argv, "-file" );
+   if( !path )
+      path = "ta_bench_ticks.tmp";
+
+   keep = benchFlag( argc, argv, "-keep" );
+
+   /* Generate the file unless re-using an existing one. */
+   file = keep? fopen( path, "rb" ) : NULL;
+   if( file )
+      fclose( file );
+   else
+   {
+      printf( "Generating %.0f MB of %s ticks in [%s]...\n",
+              (double)size/(1024*1024), format == TA_TICK_CSV? "csv" : "binary", path );
+      if( !generateFile( path, format, size ) )
+      {
+         printf( "Failed to generate [%s]\n", path );
+         remove( path );
+         return 3;
+      }
+   }
+
+   /* Same indicators on all timeframes. */
+   memset( &data, 0, sizeof(data) );
+   memset( timeframe, 0, sizeof(timeframe) );
+   retCode = TA_SUCCESS;
+   for( i=0; i < NB_TIMEFRAME; i++ )
+   {
+      if( retCode == TA_SUCCESS )
+         retCode = TA_StreamInit( &states[i][0], TA_STREAM_SMA, 20 );
+      if( retCode == TA_SUCCESS )
+         retCode = TA_StreamInit( &states[i][1], TA_STREAM_EMA, 20 );
+      if( retCode == TA_SUCCESS )
+         retCode = TA_StreamInit( &states[i][2], TA_STREAM_RSI, 14 );
+      if( retCode == TA_SUCCESS )
+         retCode = TA_StreamInit( &states[i][3], TA_STREAM_ATR, 14 );
+
+      timeframe[i].period       = period[i];
+      timeframe[i].states       = states[i];
+      timeframe[i].nbStates     = NB_INDICATOR;
+      timeframe[i].outReal      = outReal[i];
+      timeframe[i].outNBElement = outNBElement[i];
+   }
+
+   if( retCode == TA_SUCCESS )
+      retCode = TA_ResamplerAlloc( timeframe, NB_TIMEFRAME, onBar, &data, &resampler );
+
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Initialization failed (retCode=%d)\n", retCode );
+      retValue = 4;
+   }
+   else
+   {
+      start = benchTime();
+      retCode = TA_TickProcessFile( path, format, resampler, &nbTicks );
+      elapsed = benchTime() - start;
+
+      if( retCode != TA_SUCCESS )
+      {
+         printf( "Processing failed (retCode=%d)\n", retCode );
+         retValue = 5;
+      }
+      else
+      {
+         fileSize = getFileSize( path );
+
+         printf( "%.0f ticks (%.0f MB) in %.3f sec\n",
+                 (double)nbTicks, fileSize/(1024*1024), elapsed );
+         printf( "%.0f ticks/sec, %.1f MB/sec\n",
+                 (double)nbTicks/elapsed, fileSize/(1024*1024)/elapsed );
+         for( i=0; i < NB_TIMEFRAME; i++ )
+            printf( "%s bars: %.0f\n", periodName[i], (double)data.nbBars[i] );
+         printf( "Dropped ticks: %.0f, checksum: %g\n",
+                 (double)TA_ResamplerNbDropped( resampler ), data.checksum );
+         retValue = 0;
+      }
+
+      TA_ResamplerFree( resampler );
+   }
+
+   for( i=0; i < NB_TIMEFRAME; i++ )
+      for( j=0; j < NB_INDICATOR; j++ )
+         TA_StreamFree( &states[i][j] );
+
+   if( !keep )
+      remove( path );
+
+   return retValue;
+}
+
+/**** Local functions definitions.     ****/
+static int generateFile( const char *path, TA_TickFormat format, UInt64 size )
+{
+   FILE *out;
+   char *buffer;
+   size_t used;
+   UInt64 written, seed;
+   TA_Tick tick;
+   int ok;
+
+   out = fopen( path, "wb" );
+   buffer = (char *)malloc( WRITE_BUFFER );
+   if( !out || !buffer )
+   {
+      if( out )
+         fclose( out );
+      free( buffer );
+      return 0;
+   }
+
+   seed = 42;
+   tick.timestamp = (Int64)1700000000000; /* Milliseconds. */
+   tick.price = 100.0;
+   tick.volume = 0.0;
+
+   ok = 1;
+   written = 0;
+   used = 0;
+   while( ok && (written+used < size) )
+   {
+      nextTick( &seed, &tick );
+
+      if( format == TA_TICK_CSV )
+         used += (size_t)sprintf( buffer+used, "%lld,%.2f,%.0f\n",
+                                  (long long)tick.timestamp, tick.price, tick.volume );
+      else
+      {
+         memcpy( buffer+used, &tick, sizeof(tick) );
+         used += sizeof(tick);
+      }
+
+      if( used > WRITE_BUFFER-128 )
+      {
+         ok = (fwrite( buffer, 1, used, out ) == used);
+         written += used;
+         used = 0;
+      }
+   }
+
+   if( ok && used )
+      ok = (fwrite( buffer, 1, used, out ) == used);
+
+   if( fclose( out ) != 0 )
+      ok = 0;
+   free( buffer );
+
+   return ok;
+}
+
+static double getFileSize( const char *path )
+{
+   FILE *file;
+   double size;
+
+   file = fopen( path, "rb" );
+   if( !file )
+      return 0.0;
+
+   /* Can exceed the range of a long. */
+#ifdef _WIN32
+   _fseeki64( file, 0, SEEK_END );
+   size = (double)_ftelli64( file );
+#else
+   fseeko( file, 0, SEEK_END );
+   size = (double)ftello( file );
+#endif
+   fclose( file );
+
+   return size;
+}
+
+/* Random walk with 1 to 250 milliseconds between ticks. */
+static void nextTick( UInt64 *seed, TA_Tick *tick )
+{
+   UInt64 r;
+
+   *seed = *seed * 6364136223846793005ULL + 1442695040888963407ULL;
+   r = *seed >> 33;
+
+   tick->timestamp += (Int64)(1 + (r % 250));
+   tick->price += ((double)((r >> 8) % 21) - 10.0)*0.01;
+   if( tick->price < 1.0 )
+      tick->price = 1.0;
+   tick->price = (double)(Int64)(tick->price*100.0+0.5)/100.0;
+   tick->volume = (double)(1 + ((r >> 16) % 500));
+}
+
+static void onBar( void *opaqueData, int timeframeIdx,
+                   const TA_Timeframe *timeframe, const TA_Bar *bar )
+{
+   BenchData *data;
+   int i;
+
+   data = (BenchData *)opaqueData;
+   data->nbBars[timeframeIdx]++;
+
+   for( i=0; i < timeframe->nbStates; i++ )
+   {
+      if( timeframe->outNBElement[i] )
+         data->checksum += timeframe->outReal[i];
+   }
+   (void)bar;
+}
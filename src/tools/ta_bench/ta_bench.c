@@ -0,0 +1,172 @@
+/* Description:
+ *   Performance benchmarks of the library.
+ *
+ *   Usage: ta_bench <benchmark> [options]
+ *
+ *   Run without parameter for the list of benchmarks.
+ */
+
+/**** Headers ****/
+#if defined(_MSC_VER)
+   #define _CRT_SECURE_NO_WARNINGS
+#else
+   /* clock_gettime() is POSIX, not declared by a strict -std=c17. */
+   #define _POSIX_C_SOURCE 200112L
+#endif
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef _WIN32
+   #include "windows.h"
+#endif
+
+#include "ta_libc.h"
+#include "ta_bench.h"
+
+/**** Local declarations.              ****/
+typedef struct
+{
+   const char   *name;
+   BenchFunction function;
+   const char   *description;
+} BenchDef;
+
+static const BenchDef benchTable[] =
+{
+   { "ticks", bench_ticks, "Ticks to bars to indicators, end-to-end ticks/sec.\n"
+                           "     -size <MB>       Size of the synthetic file (default 2048)\n"
+                           "     -format <csv|binary> (default csv)\n"
+                           "     -file <path>     (default ta_bench_ticks.tmp)\n"
+                           "     -keep            Keep and re-use the file" },
+   { "precision", bench_precision, "Cost and error of the precision settings on a long series.\n"
+                                   "     -bars <M>        Millions of bars (default 50)\n"
+                                   "     -period <n>      (default 30)" },
+   { "mafused", bench_mafused, "TA_MAFused against one TA_MA per moving average type.\n"
+                               "     -bars <M>        Millions of bars (default 10)\n"
+                               "     -period <n>      (default 30)\n"
+                               "     -repeat <n>      Best time of n calls (default 3)\n"
+                               "     -nomama          Without MAMA (not fused)" },
+   { "blocked", bench_blocked, "TA_StreamRunBlocked against one TA_StreamRun per state.\n"
+                               "     -bars <M>        Millions of bars (default 10)\n"
+                               "     -states <n>      Number of states (default and at most 30)\n"
+                               "     -tile <n>        Bars per tile (default TA_STREAM_TILE_SIZE)\n"
+                               "     -repeat <n>      Best time of n runs (default 3)" },
+   { "panel", bench_panel, "TA_PanelEMA/RSI/ATR/KAMA/T3 against one call per symbol.\n"
+                           "     -symbols <n>     Number of symbols (default 1000)\n"
+                           "     -bars <n>        Bars per symbol (default 5000)\n"
+                           "     -period <n>      (default 14)\n"
+                           "     -repeat <n>      Best time of n calls (default 3)" },
+   { "missing", bench_missing, "Missing bars policies against forward-filling the input first.\n"
+                               "     -bars <M>        Millions of bars (default 10)\n"
+                               "     -period <n>      (default 30)\n"
+                               "     -missing <pct>   Percent of bars missing (default 1)\n"
+                               "     -repeat <n>      Best time of n calls (default 3)" },
+   { "moments", bench_moments, "TA_MOMENTS against SMA/VAR/STDDEV and direct skewness/kurtosis.\n"
+                               "     -bars <M>        Millions of bars (default 1)\n"
+                               "     -period <n>      (default 30)\n"
+                               "     -repeat <n>      Best time of n calls (default 3)" }
+};
+
+#define NB_BENCH (sizeof(benchTable)/sizeof(BenchDef))
+
+/**** Local functions declarations.    ****/
+static void printUsage( void );
+
+/**** Global functions definitions.   ****/
+int main( int argc, char **argv )
+{
+   TA_RetCode retCode;
+   unsigned int i;
+   int retValue;
+
+   if( argc < 2 )
+   {
+      printUsage();
+      return 1;
+   }
+
+   for( i=0; i < NB_BENCH; i++ )
+   {
+      if( strcmp( argv[1], benchTable[i].name ) == 0 )
+         break;
+   }
+
+   if( i == NB_BENCH )
+   {
+      printUsage();
+      return 1;
+   }
+
+   retCode = TA_Initialize();
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "TA_Initialize failed (retCode=%d)\n", retCode );
+      return 2;
+   }
+
+   retValue = benchTable[i].function( argc-2, argv+2 );
+
+   TA_Shutdown();
+
+   return retValue;
+}
+
+double benchTime( void )
+{
+#ifdef _WIN32
+   LARGE_INTEGER frequency, counter;
+
+   QueryPerformanceFrequency( &frequency );
+   QueryPerformanceCounter( &counter );
+
+   return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+   struct timespec ts;
+
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+
+   return (double)ts.tv_sec + (double)ts.tv_nsec*1e-9;
+#endif
+}
+
+const char *benchOption( int argc, char **argv, const char *name )
+{
+   int i;
+
+   for( i=0; i < argc-1; i++ )
+   {
+      if( strcmp( argv[i], name ) == 0 )
+         return argv[i+1];
+   }
+
+   return NULL;
+}
+
+int benchFlag( int argc, char **argv, const char *name )
+{
+   int i;
+
+   for( i=0; i < argc; i++ )
+   {
+      if( strcmp( argv[i], name ) == 0 )
+         return 1;
+   }
+
+   return 0;
+}
+
+/**** Local functions definitions.     ****/
+static void printUsage( void )
+{
+   unsigned int i;
+
+   printf( "Usage: ta_bench <benchmark> [options]\n" );
+   printf( "\n" );
+   printf( "   Benchmarks:\n" );
+   for( i=0; i < NB_BENCH; i++ )
+      printf( "   %s\n     %s\n", benchTable[i].name, benchTable[i].description );
+   printf( "\n" );
+   printf( "   Build in release mode for meaningful numbers.\n" );
+}
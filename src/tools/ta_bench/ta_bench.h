@@ -0,0 +1,23 @@
+#pragma once
+
+/* Each benchmark receives the arguments following its name and
+ * returns the exit code of ta_bench.
+ */
+typedef int (*BenchFunction)( int argc, char **argv );
+
+/* Monotonic time in seconds. */
+double benchTime( void );
+
+/* Parse "-name value" options. Return the value, or NULL when
+ * the option is absent.
+ */
+const char *benchOption( int argc, char **argv, const char *name );
+int benchFlag( int argc, char **argv, const char *name );
+
+int bench_ticks( int argc, char **argv );
+int bench_precision( int argc, char **argv );
+int bench_mafused( int argc, char **argv );
+int bench_blocked( int argc, char **argv );
+int bench_panel( int argc, char **argv );
+int bench_missing( int argc, char **argv );
+int bench_moments( int argc, char **argv );
@@ -0,0 +1,367 @@
+/* Description:
+ *   Convert a CSV file of price bars into the columnar file
+ *   format read by TA_ColFileOpen() (see ta_columnar.h).
+ *
+ *   Each line of the CSV is:
+ *      symbol,timestamp,open,high,low,close,volume
+ *
+ *   The timestamp is either an integer (written as-is) or a date
+ *   "YYYY-MM-DD" optionally followed by " HH:MM:SS" or "THH:MM:SS"
+ *   (converted to seconds since 1970-01-01 UTC). A first line that
+ *   does not parse is considered a header and is skipped.
+ *
+ *   The lines of a symbol must be in chronological order, but the
+ *   lines of different symbols can be interleaved.
+ */
+
+/**** Headers ****/
+#if defined(_MSC_VER)
+   #define _CRT_SECURE_NO_WARNINGS
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ta_libc.h"
+#include "ta_columnar.h"
+
+/**** Local declarations.              ****/
+#define MAX_LINE_LENGTH  1024
+#define HASH_TABLE_SIZE  (1<<16)
+
+typedef struct
+{
+   char    symbol[TA_COL_SYMBOL_LEN];
+   int     nbBars;
+   int     maxBars;
+   double *column[TA_COL_NB_COLUMN-1];
+   Int64  *timestamp;
+} SymbolBuffer;
+
+typedef struct
+{
+   SymbolBuffer **symbols;
+   int            nbSymbols;
+   int            maxSymbols;
+   int           *hashTable; /* Index in symbols, -1 when empty. */
+} SymbolSet;
+
+/**** Local functions declarations.    ****/
+static void printUsage( void );
+static int parseLine( char *line, char **symbol, Int64 *timestamp, double *values );
+static int parseTimestamp( const char *str, Int64 *timestamp );
+static Int64 daysFromCivil( Int64 y, unsigned int m, unsigned int d );
+static unsigned int hashSymbol( const char *symbol );
+static SymbolBuffer *findOrAddSymbol( SymbolSet *set, const char *symbol );
+static int appendBar( SymbolBuffer *buffer, Int64 timestamp, const double *values );
+static void freeSymbolSet( SymbolSet *set );
+
+/**** Global functions definitions.   ****/
+int main( int argc, char **argv )
+{
+   FILE *in;
+   char line[MAX_LINE_LENGTH];
+   char *symbol;
+   Int64 timestamp;
+   double values[TA_COL_NB_COLUMN-1];
+   SymbolSet set;
+   SymbolBuffer *buffer;
+   TA_ColWriter *writer;
+   TA_RetCode retCode;
+   long lineNb, nbBars;
+   int i;
+
+   if( argc != 3 )
+   {
+      printUsage();
+      return 1;
+   }
+
+   in = fopen( argv[1], "r" );
+   if( !in )
+   {
+      printf( "Failed to open [%s]\n", argv[1] );
+      return 2;
+   }
+
+   memset( &set, 0, sizeof(set) );
+   set.hashTable = (int *)malloc( sizeof(int)*HASH_TABLE_SIZE );
+   if( !set.hashTable )
+   {
+      fclose( in );
+      return 3;
+   }
+   for( i=0; i < HASH_TABLE_SIZE; i++ )
+      set.hashTable[i] = -1;
+
+   lineNb = 0;
+   nbBars = 0;
+   while( fgets( line, sizeof(line), in ) )
+   {
+      lineNb++;
+
+      if( !parseLine( line, &symbol, &timestamp, values ) )
+      {
+         /* Ignore the header and empty lines. */
+         if( (lineNb == 1) || (line[0] == '\0') )
+            continue;
+
+         printf( "Invalid line %ld in [%s]\n", lineNb, argv[1] );
+         fclose( in );
+         freeSymbolSet( &set );
+         return 4;
+      }
+
+      buffer = findOrAddSymbol( &set, symbol );
+      if( !buffer || !appendBar( buffer, timestamp, values ) )
+      {
+         printf( "Out of memory at line %ld\n", lineNb );
+         fclose( in );
+         freeSymbolSet( &set );
+         return 3;
+      }
+      nbBars++;
+   }
+   fclose( in );
+
+   retCode = TA_ColWriterOpen( argv[2], &writer );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Failed to create [%s] (retCode=%d)\n", argv[2], retCode );
+      freeSymbolSet( &set );
+      return 5;
+   }
+
+   for( i=0; (i < set.nbSymbols) && (retCode == TA_SUCCESS); i++ )
+   {
+      buffer = set.symbols[i];
+      retCode = TA_ColWriterAddSeries( writer, buffer->symbol, buffer->nbBars,
+                                       buffer->column[TA_COL_OPEN],
+                                       buffer->column[TA_COL_HIGH],
+                                       buffer->column[TA_COL_LOW],
+                                       buffer->column[TA_COL_CLOSE],
+                                       buffer->column[TA_COL_VOLUME],
+                                       buffer->timestamp );
+   }
+
+   if( retCode != TA_SUCCESS )
+   {
+      TA_ColWriterClose( writer );
+      printf( "Failed to write [%s] (retCode=%d)\n", argv[2], retCode );
+      freeSymbolSet( &set );
+      return 5;
+   }
+
+   retCode = TA_ColWriterClose( writer );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Failed to close [%s] (retCode=%d)\n", argv[2], retCode );
+      freeSymbolSet( &set );
+      return 5;
+   }
+
+   printf( "%d symbols, %ld bars written to [%s]\n", set.nbSymbols, nbBars, argv[2] );
+
+   freeSymbolSet( &set );
+
+   return 0;
+}
+
+/**** Local functions definitions.     ****/
+static void printUsage( void )
+{
+   printf( "Usage: ta_csv2col <input.csv> <output.tacol>\n" );
+   printf( "\n" );
+   printf( "   Each line of the input is:\n" );
+   printf( "      symbol,timestamp,open,high,low,close,volume\n" );
+   printf( "\n" );
+   printf( "   The timestamp is an integer or a date like\n" );
+   printf( "   \"2023-01-31\" or \"2023-01-31 09:30:00\" (UTC).\n" );
+}
+
+static int parseLine( char *line, char **symbol, Int64 *timestamp, double *values )
+{
+   char *field[7];
+   char *end;
+   char *ptr;
+   int i, nbField;
+
+   /* Strip the end of line. */
+   line[strcspn( line, "\r\n" )] = '\0';
+
+   nbField = 0;
+   ptr = line;
+   field[nbField++] = ptr;
+   while( (ptr = strchr( ptr, ',' )) != NULL )
+   {
+      if( nbField == 7 )
+         return 0;
+      *ptr++ = '\0';
+      field[nbField++] = ptr;
+   }
+
+   if( (nbField != 7) || (field[0][0] == '\0') ||
+       (strlen(field[0]) >= TA_COL_SYMBOL_LEN) )
+      return 0;
+
+   if( !parseTimestamp( field[1], timestamp ) )
+      return 0;
+
+   for( i=0; i < TA_COL_NB_COLUMN-1; i++ )
+   {
+      values[i] = strtod( field[i+2], &end );
+      if( end == field[i+2] )
+         return 0;
+   }
+
+   *symbol = field[0];
+
+   return 1;
+}
+
+static int parseTimestamp( const char *str, Int64 *timestamp )
+{
+   int y, m, d, hh, mm, ss, nbRead;
+   char *end;
+
+   if( strchr( str, '-' ) == NULL )
+   {
+      *timestamp = (Int64)strtoll( str, &end, 10 );
+      return (end != str) && (*end == '\0');
+   }
+
+   hh = mm = ss = 0;
+   nbRead = sscanf( str, "%d-%d-%d%*c%d:%d:%d", &y, &m, &d, &hh, &mm, &ss );
+   if( (nbRead != 3) && (nbRead != 6) )
+      return 0;
+
+   if( (m < 1) || (m > 12) || (d < 1) || (d > 31) ||
+       (hh < 0) || (hh > 23) || (mm < 0) || (mm > 59) || (ss < 0) || (ss > 60) )
+      return 0;
+
+   *timestamp = daysFromCivil( y, (unsigned int)m, (unsigned int)d )*86400 +
+                hh*3600 + mm*60 + ss;
+
+   return 1;
+}
+
+/* Number of days since 1970-01-01 for a date of the proleptic
+ * gregorian calendar.
+ */
+static Int64 daysFromCivil( Int64 y, unsigned int m, unsigned int d )
+{
+   Int64 era;
+   unsigned int yoe, doy, doe;
+
+   y -= (m <= 2);
+   era = (y >= 0 ? y : y-399) / 400;
+   yoe = (unsigned int)(y - era * 400);
+   doy = (153*(m > 2 ? m-3 : m+9) + 2)/5 + d-1;
+   doe = yoe * 365 + yoe/4 - yoe/100 + doy;
+
+   return era * 146097 + (Int64)doe - 719468;
+}
+
+static unsigned int hashSymbol( const char *symbol )
+{
+   unsigned int hash = 2166136261u;
+
+   while( *symbol )
+   {
+      hash ^= (unsigned char)*symbol++;
+      hash *= 16777619u;
+   }
+
+   return hash & (HASH_TABLE_SIZE-1);
+}
+
+static SymbolBuffer *findOrAddSymbol( SymbolSet *set, const char *symbol )
+{
+   SymbolBuffer *buffer;
+   SymbolBuffer **newSymbols;
+   unsigned int slot;
+   int idx;
+
+   slot = hashSymbol( symbol );
+   while( (idx = set->hashTable[slot]) != -1 )
+   {
+      if( strcmp( set->symbols[idx]->symbol, symbol ) == 0 )
+         return set->symbols[idx];
+      slot = (slot+1) & (HASH_TABLE_SIZE-1);
+   }
+
+   /* Keep the table at most half full. */
+   if( set->nbSymbols >= HASH_TABLE_SIZE/2 )
+      return NULL;
+
+   if( set->nbSymbols == set->maxSymbols )
+   {
+      idx = set->maxSymbols? set->maxSymbols*2 : 256;
+      newSymbols = (SymbolBuffer **)realloc( set->symbols, sizeof(SymbolBuffer *)*idx );
+      if( !newSymbols )
+         return NULL;
+      set->symbols    = newSymbols;
+      set->maxSymbols = idx;
+   }
+
+   buffer = (SymbolBuffer *)calloc( 1, sizeof(SymbolBuffer) );
+   if( !buffer )
+      return NULL;
+   strcpy( buffer->symbol, symbol );
+
+   set->hashTable[slot] = set->nbSymbols;
+   set->symbols[set->nbSymbols++] = buffer;
+
+   return buffer;
+}
+
+static int appendBar( SymbolBuffer *buffer, Int64 timestamp, const double *values )
+{
+   double *newColumn;
+   Int64 *newTimestamp;
+   int i, newMax;
+
+   if( buffer->nbBars == buffer->maxBars )
+   {
+      newMax = buffer->maxBars? buffer->maxBars*2 : 1024;
+
+      for( i=0; i < TA_COL_NB_COLUMN-1; i++ )
+      {
+         newColumn = (double *)realloc( buffer->column[i], sizeof(double)*newMax );
+         if( !newColumn )
+            return 0;
+         buffer->column[i] = newColumn;
+      }
+
+      newTimestamp = (Int64 *)realloc( buffer->timestamp, sizeof(Int64)*newMax );
+      if( !newTimestamp )
+         return 0;
+      buffer->timestamp = newTimestamp;
+
+      buffer->maxBars = newMax;
+   }
+
+   for( i=0; i < TA_COL_NB_COLUMN-1; i++ )
+      buffer->column[i][buffer->nbBars] = values[i];
+   buffer->timestamp[buffer->nbBars] = timestamp;
+   buffer->nbBars++;
+
+   return 1;
+}
+
+static void freeSymbolSet( SymbolSet *set )
+{
+   int i, j;
+
+   for( i=0; i < set->nbSymbols; i++ )
+   {
+      for( j=0; j < TA_COL_NB_COLUMN-1; j++ )
+         free( set->symbols[i]->column[j] );
+      free( set->symbols[i]->timestamp );
+      free( set->symbols[i] );
+   }
+
+   free( set->symbols );
+   free( set->hashTable );
+}
@@ -0,0 +1,673 @@
+/* Description:
+ *   The variants compared by ta_difftest, each one with its reference:
+ *
+ *      stream      - TA_StreamRun() by chunks against the TA function.
+ *      fused       - TA_MAFused() (all the types) against TA_MA().
+ *      matrix      - TA_CorrelMatrix() against TA_CORREL() on each pair.
+ *      compensated - TA_PRECISION_COMPENSATED against the sums of each
+ *                    window in long double.
+ *      default     - TA_PRECISION_DEFAULT against the same reference,
+ *                    the errors relative to all the bars before (the
+ *                    running sums drift).
+ *      prefix      - TA_PRECISION_PREFIX_SUM against the same reference,
+ *                    the errors relative to the last DIFF_PREFIX_SPAN
+ *                    bars.
+ *      tail        - TA_FuncTail() against the call on all the bars,
+ *                    for every function of the registry with a tail
+ *                    mode. Identical with an unstable period. On a
+ *                    fixed window, the errors relative to all the
+ *                    values before (the full call carries the drift
+ *                    of its running sums), only reported when the
+ *                    output is not proportional to the sums.
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+
+#include "ta_difftest.h"
+#include "ta_stream.h"
+#include "ta_mafused.h"
+#include "ta_matrix.h"
+
+/**** Local declarations.              ****/
+#define DIFF_PERIOD       30
+#define DIFF_STREAM_CHUNK 4096
+#define DIFF_MATRIX_CHUNK 65536
+#define DIFF_MATRIX_NB    3
+#define DIFF_NB_TAIL      1000
+#define DIFF_TAIL_WINDOW  1e-6
+#define DIFF_MAX_INPUT    8
+#define DIFF_MAX_OPTIN    16
+#define DIFF_MAX_OUTPUT   8
+
+/* Bars a prefix sum can carry its rounding from: the anchor of
+ * TA_WinSum (4096) plus a block (512) and the window.
+ */
+#define DIFF_PREFIX_SPAN  8192
+
+/* Largest |value| of the current and of the previous block of 'size'
+ * values, the scale of the relative errors.
+ */
+typedef struct
+{
+   int    size;
+   int    count;
+   double current;
+   double previous;
+} DiffScale;
+
+/**** Local functions declarations.    ****/
+static void diffStream( const DiffCase *diffCase, const DiffSeries *series, DiffError *error );
+static void diffFused( const DiffCase *diffCase, const DiffSeries *series, DiffError *error );
+static void diffMatrix( const DiffCase *diffCase, const DiffSeries *series, DiffError *error );
+static void diffPrecision( const DiffCase *diffCase, const DiffSeries *series, DiffError *error );
+static void diffTail( const DiffCase *diffCase, const DiffSeries *series, DiffError *error );
+
+static void diffValue( DiffError *error, int idx, double ref, double value, double scale );
+static void diffScaleInit( DiffScale *scale, int size );
+static double diffScaleNext( DiffScale *scale, double value );
+static int diffRange( DiffError *error, int sameRange,
+                      int refBegIdx, int refNBElement, int begIdx, int nbElement );
+static void setOptIn( const TA_FuncDef *func, double *optIn );
+static void setInputs( const TA_FuncDef *func, const DiffSeries *series, const double **inputs );
+
+/**** Local variables definitions.     ****/
+static const struct
+{
+   const char     *name;
+   TA_StreamFuncId funcId;
+} streamTable[] =
+{
+   { "SMA",  TA_STREAM_SMA  },
+   { "EMA",  TA_STREAM_EMA  },
+   { "RSI",  TA_STREAM_RSI  },
+   { "ATR",  TA_STREAM_ATR  },
+   { "ADX",  TA_STREAM_ADX  },
+   { "KAMA", TA_STREAM_KAMA },
+   { "MAMA", TA_STREAM_MAMA },
+   { "FAMA", TA_STREAM_FAMA }
+};
+
+#define NB_STREAM ((int)(sizeof(streamTable)/sizeof(streamTable[0])))
+
+static const struct
+{
+   const char  *name;
+   const char  *variant;
+   TA_Precision precision;
+   double       tolerance;
+} precisionTable[] =
+{
+   { "SMA", "compensated", TA_PRECISION_COMPENSATED, 1e-10 },
+   { "SMA", "default",     TA_PRECISION_DEFAULT,     1e-12 },
+   { "SMA", "prefix",      TA_PRECISION_PREFIX_SUM,  1e-12 },
+   { "VAR", "compensated", TA_PRECISION_COMPENSATED, 1e-12 },
+   { "VAR", "default",     TA_PRECISION_DEFAULT,     1e-12 },
+   { "VAR", "prefix",      TA_PRECISION_PREFIX_SUM,  1e-12 }
+};
+
+#define NB_PRECISION ((int)(sizeof(precisionTable)/sizeof(precisionTable[0])))
+
+/* Tail variant on a fixed window: the output is a square, a square
+ * root, a ratio of the running sums, or a threshold on them for the
+ * candlesticks ("CDL"). The drift of the full call has no bound
+ * relative to the output, these are only reported. STOCHRSI has an
+ * unstable period, but its %D is a moving average of the RSI.
+ */
+static const char *const tailReportName[] =
+{ "BBDist", "BBWidth", "BETA", "Bias", "CORREL", "STDDEV", "VAR" };
+
+#define NB_TAIL_REPORT ((int)(sizeof(tailReportName)/sizeof(const char *)))
+
+static const char *const maName[TA_MA_NB_TYPE] =
+{ "SMA", "EMA", "WMA", "DEMA", "TEMA", "TRIMA", "KAMA", "MAMA", "T3" };
+
+/**** Global functions definitions.   ****/
+int diffCases( DiffCase *cases, int maxCases )
+{
+   DiffCase *diffCase;
+   const TA_FuncDef *func;
+   double optIn[DIFF_MAX_OPTIN];
+   TA_TailMode mode;
+   int i, j, nbCases = 0;
+
+   memset( cases, 0, sizeof(DiffCase)*maxCases );
+
+   for( i=0; (i < NB_STREAM) && (nbCases < maxCases); i++ )
+   {
+      diffCase = &cases[nbCases++];
+      strcpy( diffCase->name, streamTable[i].name );
+      diffCase->variant   = "stream";
+      diffCase->function  = diffStream;
+      diffCase->param     = streamTable[i].funcId;
+   }
+
+   for( i=0; (i < TA_MA_NB_TYPE) && (nbCases < maxCases); i++ )
+   {
+      diffCase = &cases[nbCases++];
+      strcpy( diffCase->name, maName[i] );
+      diffCase->variant   = "fused";
+      diffCase->function  = diffFused;
+      diffCase->param     = i;
+   }
+
+   if( nbCases < maxCases )
+   {
+      diffCase = &cases[nbCases++];
+      strcpy( diffCase->name, "CORREL" );
+      diffCase->variant  = "matrix";
+      diffCase->function = diffMatrix;
+   }
+
+   /* The precision is a global setting. */
+   for( i=0; (i < NB_PRECISION) && (nbCases < maxCases); i++ )
+   {
+      diffCase = &cases[nbCases++];
+      strcpy( diffCase->name, precisionTable[i].name );
+      diffCase->variant   = precisionTable[i].variant;
+      diffCase->function  = diffPrecision;
+      diffCase->param     = precisionTable[i].precision;
+      diffCase->tolerance = precisionTable[i].tolerance;
+      diffCase->isSerial  = 1;
+   }
+
+   /* The functions depending on all the history have no tail mode. */
+   for( i=0; (i < TA_FuncCount()) && (nbCases < maxCases); i++ )
+   {
+      func = TA_FuncAt( i );
+      setOptIn( func, optIn );
+      mode = TA_FuncTailMode( func, optIn );
+      if( mode == TA_TAIL_HISTORY )
+         continue;
+
+      diffCase = &cases[nbCases++];
+      diffCase->func = func;
+      strncpy( diffCase->name, func->name, sizeof(diffCase->name)-1 );
+      diffCase->variant   = "tail";
+      diffCase->function  = diffTail;
+      if( strcmp( func->name, "STOCHRSI" ) == 0 )
+         mode = TA_TAIL_WINDOW;
+      diffCase->param     = mode;
+      diffCase->tolerance = (mode == TA_TAIL_UNSTABLE)? 0.0 : DIFF_TAIL_WINDOW;
+      if( strncmp( func->name, "CDL", 3 ) == 0 )
+         diffCase->tolerance = -1.0;
+      for( j=0; j < NB_TAIL_REPORT; j++ )
+      {
+         if( strcmp( func->name, tailReportName[j] ) == 0 )
+            diffCase->tolerance = -1.0;
+      }
+   }
+
+   return nbCases;
+}
+
+void diffInit( DiffError *error )
+{
+   memset( error, 0, sizeof(DiffError) );
+   error->absIdx   = -1;
+   error->worstIdx = -1;
+}
+
+void diffOutputs( DiffError *error, int sameRange,
+                  const double *ref, int refBegIdx, int refNBElement,
+                  const double *value, int begIdx, int nbElement )
+{
+   DiffScale scale;
+   int i, skip;
+
+   if( !diffRange( error, sameRange, refBegIdx, refNBElement, begIdx, nbElement ) )
+      return;
+
+   diffScaleInit( &scale, DIFF_PERIOD );
+   skip = begIdx-refBegIdx;
+   for( i=(skip < 2*DIFF_PERIOD)? 0 : skip-2*DIFF_PERIOD; i < skip; i++ )
+      diffScaleNext( &scale, ref[i] );
+   for( i=0; i < nbElement; i++ )
+      diffValue( error, begIdx+i, ref[skip+i], value[i], diffScaleNext( &scale, ref[skip+i] ) );
+}
+
+void diffIntOutputs( DiffError *error, int sameRange,
+                     const int *ref, int refBegIdx, int refNBElement,
+                     const int *value, int begIdx, int nbElement )
+{
+   DiffScale scale;
+   int i, skip;
+
+   if( !diffRange( error, sameRange, refBegIdx, refNBElement, begIdx, nbElement ) )
+      return;
+
+   diffScaleInit( &scale, DIFF_PERIOD );
+   skip = begIdx-refBegIdx;
+   for( i=(skip < 2*DIFF_PERIOD)? 0 : skip-2*DIFF_PERIOD; i < skip; i++ )
+      diffScaleNext( &scale, (double)ref[i] );
+   for( i=0; i < nbElement; i++ )
+      diffValue( error, begIdx+i, (double)ref[skip+i], (double)value[i],
+                 diffScaleNext( &scale, (double)ref[skip+i] ) );
+}
+
+/**** Local functions definitions.     ****/
+static void diffStream( const DiffCase *diffCase, const DiffSeries *series, DiffError *error )
+{
+   TA_StreamFuncId funcId = (TA_StreamFuncId)diffCase->param;
+   TA_StreamState state;
+   TA_RetCode retCode;
+   double *ref, *value, *other;
+   int i, size, begIdx, nbElement, chunkBegIdx, chunkNBElement, refBegIdx, refNBElement;
+   int nbBars = series->nbBars;
+
+   ref   = (double *)malloc( sizeof(double)*(size_t)nbBars*3 );
+   if( !ref )
+   {
+      error->failure = "out of memory";
+      return;
+   }
+   value = ref+(size_t)nbBars;
+   other = ref+(size_t)nbBars*2;
+
+   switch( funcId )
+   {
+   case TA_STREAM_SMA:  retCode = TA_SMA( 0, nbBars-1, series->close, DIFF_PERIOD, &refBegIdx, &refNBElement, ref ); break;
+   case TA_STREAM_EMA:  retCode = TA_EMA( 0, nbBars-1, series->close, DIFF_PERIOD, &refBegIdx, &refNBElement, ref ); break;
+   case TA_STREAM_RSI:  retCode = TA_RSI( 0, nbBars-1, series->close, DIFF_PERIOD, &refBegIdx, &refNBElement, ref ); break;
+   case TA_STREAM_KAMA: retCode = TA_KAMA( 0, nbBars-1, series->close, DIFF_PERIOD, &refBegIdx, &refNBElement, ref ); break;
+   case TA_STREAM_ATR:
+      retCode = TA_ATR( 0, nbBars-1, series->high, series->low, series->close, DIFF_PERIOD,
+                        &refBegIdx, &refNBElement, ref );
+      break;
+   case TA_STREAM_ADX:
+      retCode = TA_ADX( 0, nbBars-1, series->high, series->low, series->close, DIFF_PERIOD,
+                        &refBegIdx, &refNBElement, ref );
+      break;
+   default:
+      retCode = TA_MAMA( 0, nbBars-1, series->close, 0.5, 0.05, &refBegIdx, &refNBElement,
+                         (funcId == TA_STREAM_MAMA)? ref : other,
+                         (funcId == TA_STREAM_MAMA)? other : ref );
+   }
+
+   if( (funcId == TA_STREAM_MAMA) || (funcId == TA_STREAM_FAMA) )
+      retCode = (retCode != TA_SUCCESS)? retCode : TA_StreamInitMAMA( &state, funcId, 0.5, 0.05 );
+   else
+      retCode = (retCode != TA_SUCCESS)? retCode : TA_StreamInit( &state, funcId, DIFF_PERIOD );
+   if( retCode != TA_SUCCESS )
+   {
+      error->failure = "call failed";
+      free( ref );
+      return;
+   }
+
+   /* The values of each chunk are appended. */
+   begIdx    = -1;
+   nbElement = 0;
+   for( i=0; (i < nbBars) && (retCode == TA_SUCCESS); i += DIFF_STREAM_CHUNK )
+   {
+      size = (nbBars-i < DIFF_STREAM_CHUNK)? nbBars-i : DIFF_STREAM_CHUNK;
+      retCode = TA_StreamRun( &state, size, series->high+i, series->low+i, series->close+i,
+                              &chunkBegIdx, &chunkNBElement, value+nbElement );
+      if( (retCode == TA_SUCCESS) && chunkNBElement && (begIdx < 0) )
+         begIdx = i+chunkBegIdx;
+      nbElement += chunkNBElement;
+   }
+   TA_StreamFree( &state );
+
+   if( retCode != TA_SUCCESS )
+      error->failure = "stream failed";
+   else
+      diffOutputs( error, 1, ref, refBegIdx, refNBElement, value, begIdx < 0? 0 : begIdx, nbElement );
+
+   free( ref );
+}
+
+static void diffFused( const DiffCase *diffCase, const DiffSeries *series, DiffError *error )
+{
+   TA_RetCode retCode;
+   double *buffer, *ref, *outReal[TA_MA_NB_TYPE];
+   int type, refBegIdx, refNBElement, outBegIdx[TA_MA_NB_TYPE], outNBElement[TA_MA_NB_TYPE];
+   int nbBars = series->nbBars;
+
+   buffer = (double *)malloc( sizeof(double)*(size_t)nbBars*(TA_MA_NB_TYPE+1) );
+   if( !buffer )
+   {
+      error->failure = "out of memory";
+      return;
+   }
+   ref = buffer;
+   for( type=0; type < TA_MA_NB_TYPE; type++ )
+      outReal[type] = buffer+(size_t)nbBars*(type+1);
+
+   /* All the types at once, as it shares the EMAs. */
+   retCode = TA_MA( 0, nbBars-1, series->close, DIFF_PERIOD, (TA_MAType)diffCase->param,
+                    &refBegIdx, &refNBElement, ref );
+   if( retCode == TA_SUCCESS )
+      retCode = TA_MAFused( 0, nbBars-1, series->close, DIFF_PERIOD, TA_MA_MASK_ALL,
+                            outBegIdx, outNBElement, outReal );
+
+   if( retCode != TA_SUCCESS )
+      error->failure = "call failed";
+   else
+      diffOutputs( error, 1, ref, refBegIdx, refNBElement, outReal[diffCase->param],
+                   outBegIdx[diffCase->param], outNBElement[diffCase->param] );
+
+   free( buffer );
+}
+
+static void diffMatrix( const DiffCase *diffCase, const DiffSeries *series, DiffError *error )
+{
+   const double *inReal[DIFF_MATRIX_NB];
+   TA_RetCode retCode;
+   double *ref, *correl, *value;
+   int i, j, t, startIdx, endIdx, begIdx, nbElement, refBegIdx, refNBElement;
+
+   (void)diffCase;
+   inReal[0] = series->close;
+   inReal[1] = series->high;
+   inReal[2] = series->volume;
+
+   ref    = (double *)malloc( sizeof(double)*DIFF_MATRIX_CHUNK*(DIFF_MATRIX_NB*DIFF_MATRIX_NB+2) );
+   if( !ref )
+   {
+      error->failure = "out of memory";
+      return;
+   }
+   value  = ref+DIFF_MATRIX_CHUNK;
+   correl = ref+DIFF_MATRIX_CHUNK*2;
+
+   /* By chunks, the output holds a matrix per bar. */
+   retCode = TA_SUCCESS;
+   for( startIdx=0; (startIdx < series->nbBars) && !error->failure; startIdx += DIFF_MATRIX_CHUNK )
+   {
+      endIdx = startIdx+DIFF_MATRIX_CHUNK-1;
+      if( endIdx >= series->nbBars )
+         endIdx = series->nbBars-1;
+
+      retCode = TA_CorrelMatrix( startIdx, endIdx, DIFF_MATRIX_NB, inReal, DIFF_PERIOD, 1,
+                                 &begIdx, &nbElement, correl, NULL );
+      for( i=0; (i < DIFF_MATRIX_NB) && (retCode == TA_SUCCESS); i++ )
+      {
+         for( j=i+1; (j < DIFF_MATRIX_NB) && (retCode == TA_SUCCESS); j++ )
+         {
+            retCode = TA_CORREL( startIdx, endIdx, inReal[i], inReal[j], DIFF_PERIOD,
+                                 &refBegIdx, &refNBElement, ref );
+            for( t=0; t < nbElement; t++ )
+               value[t] = correl[(t*DIFF_MATRIX_NB+i)*DIFF_MATRIX_NB+j];
+            if( retCode == TA_SUCCESS )
+               diffOutputs( error, 1, ref, refBegIdx, refNBElement, value, begIdx, nbElement );
+         }
+      }
+      if( retCode != TA_SUCCESS )
+         error->failure = "call failed";
+   }
+
+   free( ref );
+}
+
+static void diffPrecision( const DiffCase *diffCase, const DiffSeries *series, DiffError *error )
+{
+   TA_RetCode retCode;
+   const double *inReal = series->close;
+   long double sum, mean, delta, var;
+   DiffScale inScale;
+   double *ref, *value, *scale;
+   int i, k, begIdx, nbElement;
+   int isVar = (strcmp( diffCase->name, "VAR" ) == 0);
+   int nbBars = series->nbBars;
+
+   ref = (double *)malloc( sizeof(double)*(size_t)nbBars*3 );
+   if( !ref )
+   {
+      error->failure = "out of memory";
+      return;
+   }
+   value = ref+(size_t)nbBars;
+   scale = ref+(size_t)nbBars*2;
+
+   TA_SetPrecision( (TA_Precision)diffCase->param );
+   if( isVar )
+      retCode = TA_VAR( 0, nbBars-1, inReal, DIFF_PERIOD, 1.0, &begIdx, &nbElement, value );
+   else
+      retCode = TA_SMA( 0, nbBars-1, inReal, DIFF_PERIOD, &begIdx, &nbElement, value );
+   TA_SetPrecision( TA_PRECISION_DEFAULT );
+
+   if( retCode != TA_SUCCESS )
+   {
+      error->failure = "call failed";
+      free( ref );
+      return;
+   }
+
+   /* The rounding of the sums is relative to the largest |value| the
+    * running sums went through (its square for the variance), which is
+    * the scale of the errors instead of the output, as the variance can
+    * be near 0: the window when compensated, the bars since the last
+    * direct sum for the prefix sums, all the bars by default.
+    */
+   switch( diffCase->param )
+   {
+   case TA_PRECISION_COMPENSATED: diffScaleInit( &inScale, DIFF_PERIOD ); break;
+   case TA_PRECISION_PREFIX_SUM:  diffScaleInit( &inScale, DIFF_PREFIX_SPAN ); break;
+   default:                       diffScaleInit( &inScale, nbBars );
+   }
+
+   /* Each window again, in long double (two passes for the variance). */
+   for( i=0; i < nbBars; i++ )
+   {
+      scale[i] = diffScaleNext( &inScale, inReal[i] );
+      if( isVar )
+         scale[i] *= scale[i];
+      if( i < DIFF_PERIOD-1 )
+         continue;
+
+      sum = 0.0L;
+      for( k=i-DIFF_PERIOD+1; k <= i; k++ )
+         sum += inReal[k];
+      mean = sum/DIFF_PERIOD;
+      if( isVar )
+      {
+         var = 0.0L;
+         for( k=i-DIFF_PERIOD+1; k <= i; k++ )
+         {
+            delta = inReal[k]-mean;
+            var += delta*delta;
+         }
+         mean = var/DIFF_PERIOD;
+      }
+      ref[i-(DIFF_PERIOD-1)] = (double)mean;
+   }
+
+   if( diffRange( error, 1, DIFF_PERIOD-1, nbBars-(DIFF_PERIOD-1), begIdx, nbElement ) )
+   {
+      for( i=0; i < nbElement; i++ )
+         diffValue( error, begIdx+i, ref[begIdx+i-(DIFF_PERIOD-1)], value[i], scale[begIdx+i] );
+   }
+   free( ref );
+}
+
+static void diffTail( const DiffCase *diffCase, const DiffSeries *series, DiffError *error )
+{
+   const TA_FuncDef *func = diffCase->func;
+   const double *inputs[DIFF_MAX_INPUT];
+   double optIn[DIFF_MAX_OPTIN];
+   void *refOutputs[DIFF_MAX_OUTPUT], *outputs[DIFF_MAX_OUTPUT];
+   TA_RetCode retCode;
+   DiffScale scale;
+   const double *ref, *value;
+   double *buffer;
+   int i, j, skip, refBegIdx, refNBElement, begIdx, nbElement;
+   int nbBars = series->nbBars;
+
+   buffer = (double *)malloc( sizeof(double)*((size_t)nbBars+DIFF_NB_TAIL)*func->nbOutput );
+   if( !buffer )
+   {
+      error->failure = "out of memory";
+      return;
+   }
+
+   for( i=0; i < func->nbOutput; i++ )
+   {
+      refOutputs[i] = buffer+(size_t)nbBars*i;
+      outputs[i]    = buffer+(size_t)nbBars*func->nbOutput+(size_t)DIFF_NB_TAIL*i;
+   }
+   setOptIn( func, optIn );
+   setInputs( func, series, inputs );
+
+   retCode = func->call( 0, nbBars-1, inputs, optIn, &refBegIdx, &refNBElement, refOutputs );
+   if( retCode == TA_SUCCESS )
+      retCode = TA_FuncTail( func, nbBars-1, DIFF_NB_TAIL, TA_TAIL_ALL_HISTORY, inputs, optIn,
+                             &begIdx, &nbElement, outputs );
+   if( retCode != TA_SUCCESS )
+   {
+      error->failure = "call failed";
+      free( buffer );
+      return;
+   }
+
+   for( i=0; i < func->nbOutput; i++ )
+   {
+      if( func->outputs[i].type == TA_OUTPUT_INTEGER )
+      {
+         diffIntOutputs( error, 0, (const int *)refOutputs[i], refBegIdx, refNBElement,
+                         (const int *)outputs[i], begIdx, nbElement );
+         continue;
+      }
+
+      if( diffCase->param == TA_TAIL_UNSTABLE )
+      {
+         diffOutputs( error, 0, (const double *)refOutputs[i], refBegIdx, refNBElement,
+                      (const double *)outputs[i], begIdx, nbElement );
+         continue;
+      }
+
+      if( !diffRange( error, 0, refBegIdx, refNBElement, begIdx, nbElement ) )
+         continue;
+
+      /* The rounding carried by the running sums of the full call is
+       * relative to the largest |value| of all the bars before.
+       */
+      ref   = (const double *)refOutputs[i];
+      value = (const double *)outputs[i];
+      skip  = begIdx-refBegIdx;
+      diffScaleInit( &scale, nbBars );
+      for( j=0; j < skip; j++ )
+         diffScaleNext( &scale, ref[j] );
+      for( j=0; j < nbElement; j++ )
+         diffValue( error, begIdx+j, ref[skip+j], value[j], diffScaleNext( &scale, ref[skip+j] ) );
+   }
+
+   free( buffer );
+}
+
+/* Any difference involving a non-finite value is infinite, except
+ * between two NaN.
+ */
+static void diffValue( DiffError *error, int idx, double ref, double value, double scale )
+{
+   double absErr, relErr;
+
+   error->nbValues++;
+   if( (value == ref) || (isnan( value ) && isnan( ref )) )
+      return;
+
+   absErr = fabs( value-ref );
+   scale += fabs(ref);
+   relErr = (scale > 0.0)? absErr/scale : absErr;
+   if( !(absErr <= DBL_MAX) || !(relErr <= DBL_MAX) )
+      absErr = relErr = HUGE_VAL;
+
+   if( (error->absIdx < 0) || (absErr > error->maxAbs) )
+   {
+      error->maxAbs = absErr;
+      error->absIdx = idx;
+   }
+   if( (error->worstIdx < 0) || (relErr > error->maxRel) )
+   {
+      error->maxRel   = relErr;
+      error->worstIdx = idx;
+   }
+}
+
+static void diffScaleInit( DiffScale *scale, int size )
+{
+   memset( scale, 0, sizeof(DiffScale) );
+   scale->size = size;
+}
+
+/* The non-finite values are left out of the scale. */
+static double diffScaleNext( DiffScale *scale, double value )
+{
+   if( scale->count == scale->size )
+   {
+      scale->previous = scale->current;
+      scale->current  = 0.0;
+      scale->count    = 0;
+   }
+   if( (fabs(value) <= DBL_MAX) && (fabs(value) > scale->current) )
+      scale->current = fabs(value);
+   scale->count++;
+
+   return (scale->current > scale->previous)? scale->current : scale->previous;
+}
+
+static int diffRange( DiffError *error, int sameRange,
+                      int refBegIdx, int refNBElement, int begIdx, int nbElement )
+{
+   if( (nbElement == 0) && (refNBElement == 0) )
+      return 1;
+
+   if( (begIdx+nbElement != refBegIdx+refNBElement) ||
+       (begIdx < refBegIdx) ||
+       (sameRange && (begIdx != refBegIdx)) )
+   {
+      error->failure = "other range";
+      return 0;
+   }
+
+   return 1;
+}
+
+/* A valid value for each optional parameter. */
+static void setOptIn( const TA_FuncDef *func, double *optIn )
+{
+   const TA_OptInputDef *def;
+   int i;
+
+   for( i=0; i < func->nbOptInput; i++ )
+   {
+      def = &func->optInputs[i];
+      switch( def->type )
+      {
+      case TA_OPTIN_MATYPE:
+         optIn[i] = TA_MAType_SMA;
+         break;
+      case TA_OPTIN_INTEGER:
+         optIn[i] = (def->min > 14)? def->min : ((def->max < 14)? def->max : 14);
+         break;
+      default:
+         if( (def->min > TA_REAL_MIN) && (def->max < TA_REAL_MAX) )
+            optIn[i] = (def->min+def->max)/2.0;
+         else
+            optIn[i] = (def->min > 1.0)? def->min : ((def->max < 1.0)? def->max : 1.0);
+      }
+   }
+}
+
+static void setInputs( const TA_FuncDef *func, const DiffSeries *series, const double **inputs )
+{
+   int i;
+
+   for( i=0; i < func->nbInput; i++ )
+   {
+      switch( func->inputs[i].type )
+      {
+      case TA_INPUT_OPEN:   inputs[i] = series->open;   break;
+      case TA_INPUT_HIGH:   inputs[i] = series->high;   break;
+      case TA_INPUT_LOW:    inputs[i] = series->low;    break;
+      case TA_INPUT_VOLUME: inputs[i] = series->volume; break;
+      case TA_INPUT_CLOSE:  inputs[i] = series->close;  break;
+      default:
+         inputs[i] = (i == 0)? series->close : series->open;
+      }
+   }
+}
@@ -0,0 +1,153 @@
+/* Description:
+ *   Synthetic series of ta_difftest.
+ *
+ *   Each kind stresses the algorithms differently:
+ *      walk     - Geometric random walk.
+ *      gaps     - Random walk with large opening gaps.
+ *      constant - Alternate runs of constant bars (open=high=low=close)
+ *                 and of random walk.
+ *      extreme  - Random walk with its scale jumping between 1e-6 and
+ *                 1e12 (always finite, no NaN).
+ *      trend    - Strictly increasing, then strictly decreasing.
+ */
+
+/**** Headers ****/
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "ta_difftest.h"
+
+/**** Local declarations.              ****/
+/* None */
+
+/**** Local functions declarations.    ****/
+static double nextRandom( unsigned int *seed );
+static void makeBars( DiffSeries *series, int idx, double open, double close,
+                      unsigned int *seed );
+
+/**** Local variables definitions.     ****/
+static const char *seriesName[DIFF_NB_SERIES] =
+{ "walk", "gaps", "constant", "extreme", "trend" };
+
+static const double extremeScale[] = { 1e-6, 1.0, 1e6, 1e12, 1e-3, 1e9 };
+
+#define NB_EXTREME_SCALE ((int)(sizeof(extremeScale)/sizeof(double)))
+
+/**** Global functions definitions.   ****/
+int diffMakeSeries( DiffSeries *series, int kind, int nbBars, unsigned int seed )
+{
+   double *buffer, price, prevClose, open, scale, rate;
+   int i, runEnd, isConstant;
+
+   memset( series, 0, sizeof(DiffSeries) );
+   if( (kind < 0) || (kind >= DIFF_NB_SERIES) || (nbBars < 2) )
+      return 0;
+
+   buffer = (double *)malloc( sizeof(double)*(size_t)nbBars*5 );
+   if( !buffer )
+      return 0;
+
+   series->name   = seriesName[kind];
+   series->nbBars = nbBars;
+   series->open   = buffer;
+   series->high   = buffer+(size_t)nbBars;
+   series->low    = buffer+(size_t)nbBars*2;
+   series->close  = buffer+(size_t)nbBars*3;
+   series->volume = buffer+(size_t)nbBars*4;
+
+   seed = seed*(unsigned int)(kind+1) + 0x9E3779B9;
+   price = prevClose = 100.0;
+   runEnd = 0;
+   isConstant = 0;
+   scale = 1.0;
+
+   for( i=0; i < nbBars; i++ )
+   {
+      open = prevClose;
+      switch( kind )
+      {
+      case 1: /* gaps */
+         if( nextRandom( &seed ) < 0.002 )
+         {
+            open  = prevClose*(nextRandom( &seed ) < 0.5? 0.7 : 1.3);
+            price = open;
+         }
+         price *= exp( 0.02*(nextRandom( &seed )-0.5) );
+         break;
+
+      case 2: /* constant */
+         if( i >= runEnd )
+         {
+            runEnd = i+1+(int)(nextRandom( &seed )*2000.0);
+            isConstant = !isConstant;
+         }
+         if( isConstant )
+         {
+            series->open[i] = series->high[i] = series->low[i] = series->close[i] = prevClose;
+            series->volume[i] = 1000.0;
+            continue;
+         }
+         price *= exp( 0.02*(nextRandom( &seed )-0.5) );
+         break;
+
+      case 3: /* extreme */
+         if( (i%10000) == 0 )
+         {
+            scale = extremeScale[(i/10000)%NB_EXTREME_SCALE];
+            price = open = 100.0*scale;
+         }
+         price *= exp( 0.02*(nextRandom( &seed )-0.5) );
+         break;
+
+      case 4: /* trend */
+         rate  = 1e-6*(1.0+nextRandom( &seed ));
+         price *= (i < nbBars/2)? 1.0+rate : 1.0-rate;
+         break;
+
+      default: /* walk */
+         price *= exp( 0.02*(nextRandom( &seed )-0.5) );
+      }
+
+      makeBars( series, i, open, price, &seed );
+      prevClose = price;
+   }
+
+   return 1;
+}
+
+void diffFreeSeries( DiffSeries *series )
+{
+   if( series->open )
+      free( series->open );
+   memset( series, 0, sizeof(DiffSeries) );
+}
+
+/**** Local functions definitions.     ****/
+
+/* The high and low surround the open and the close. */
+static void makeBars( DiffSeries *series, int idx, double open, double close,
+                      unsigned int *seed )
+{
+   double top    = open > close? open : close;
+   double bottom = open < close? open : close;
+
+   series->open[idx]   = open;
+   series->close[idx]  = close;
+   series->high[idx]   = top*(1.0+0.005*nextRandom( seed ));
+   series->low[idx]    = bottom*(1.0-0.005*nextRandom( seed ));
+   series->volume[idx] = 1000.0+10000.0*nextRandom( seed );
+}
+
+/* Uniform in [0,1), xorshift32. */
+static double nextRandom( unsigned int *seed )
+{
+   unsigned int x = *seed;
+
+   x ^= x << 13;
+   x ^= x >> 17;
+   x ^= x << 5;
+   *seed = x;
+
+   return x/4294967296.0;
+}
@@ -0,0 +1,259 @@
+/* Description:
+ *   Differential test of the optimized variants of the library
+ *   (streaming, fused, matrix, compensated, tail) against the
+ *   reference TA functions, on long synthetic series.
+ *
+ *   Usage: ta_difftest [options]
+ *
+ *      -bars <M>        Millions of bars of each series (default 2)
+ *      -threads <n>     Threads when built with OpenMP (default all)
+ *      -seed <n>        Seed of the series (default 1)
+ *      -case <name>     Only the cases of this function or variant
+ *      -series <name>   Only this series
+ *      -verbose         One line per series
+ *
+ *   For each case, the largest absolute and relative errors over all
+ *   the series are reported, each one with its series and bar. The
+ *   relative error is floored by the scale of the window (see
+ *   ta_difftest.h). The exit code is non-zero when a case is above its
+ *   tolerance, or cannot be compared.
+ *
+ *   The series are independent of the number of threads: the same
+ *   seed always gives the same results.
+ */
+
+/**** Headers ****/
+#if defined(_MSC_VER)
+   #define _CRT_SECURE_NO_WARNINGS
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _OPENMP
+   #include <omp.h>
+#endif
+
+#include "ta_difftest.h"
+
+/**** Local declarations.              ****/
+#define MAX_CASE 512
+
+/**** Local functions declarations.    ****/
+static const char *option( int argc, char **argv, const char *name );
+static int flag( int argc, char **argv, const char *name );
+static int isSelected( const DiffCase *diffCase, const char *filter );
+static int report( const DiffCase *diffCase, const DiffError *errors,
+                   const DiffSeries *series, int verbose );
+static void where( char *buffer, const char *seriesName, int idx );
+
+/**** Local variables definitions.     ****/
+static DiffCase cases[MAX_CASE];
+static DiffSeries series[DIFF_NB_SERIES];
+
+/**** Global functions definitions.   ****/
+int main( int argc, char **argv )
+{
+   TA_RetCode retCode;
+   const char *caseFilter, *seriesFilter;
+   DiffError *errors;
+   int *tasks;
+   int nbBars, nbThread, nbCases, nbSeries, nbTasks, nbParallel, nbFailed;
+   int i, s, task, verbose;
+   unsigned int seed;
+
+   caseFilter   = option( argc, argv, "-case" );
+   seriesFilter = option( argc, argv, "-series" );
+   nbBars   = option( argc, argv, "-bars" )? (int)(atof( option( argc, argv, "-bars" ) )*1000000.0) : 2000000;
+   nbThread = option( argc, argv, "-threads" )? atoi( option( argc, argv, "-threads" ) ) : 0;
+   seed     = option( argc, argv, "-seed" )? (unsigned int)atoi( option( argc, argv, "-seed" ) ) : 1;
+   verbose  = flag( argc, argv, "-verbose" );
+   if( nbBars < 10000 )
+   {
+      printf( "Invalid -bars, at least 0.01\n" );
+      return 3;
+   }
+
+   retCode = TA_Initialize();
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "TA_Initialize failed (retCode=%d)\n", retCode );
+      return 2;
+   }
+
+   printf( "Generating %d series of %d bars...\n", DIFF_NB_SERIES, nbBars );
+   nbSeries = 0;
+   for( s=0; s < DIFF_NB_SERIES; s++ )
+   {
+      if( !diffMakeSeries( &series[nbSeries], s, nbBars, seed ) )
+      {
+         printf( "Not enough memory for %d bars\n", nbBars );
+         return 4;
+      }
+      if( seriesFilter && (strcmp( series[nbSeries].name, seriesFilter ) != 0) )
+         diffFreeSeries( &series[nbSeries] );
+      else
+         nbSeries++;
+   }
+
+   nbCases = 0;
+   for( i=diffCases( cases, MAX_CASE ), task=0; task < i; task++ )
+   {
+      if( isSelected( &cases[task], caseFilter ) )
+         cases[nbCases++] = cases[task];
+   }
+   if( (nbCases == 0) || (nbSeries == 0) )
+   {
+      printf( "Nothing selected by -case or -series\n" );
+      return 1;
+   }
+
+   /* Task = case*nbSeries+series, the parallel tasks first. */
+   nbTasks = nbCases*nbSeries;
+   errors  = (DiffError *)malloc( sizeof(DiffError)*nbTasks );
+   tasks   = (int *)malloc( sizeof(int)*nbTasks );
+   if( !errors || !tasks )
+   {
+      printf( "Not enough memory\n" );
+      return 4;
+   }
+
+   nbParallel = 0;
+   for( task=0; task < nbTasks; task++ )
+   {
+      diffInit( &errors[task] );
+      if( !cases[task/nbSeries].isSerial )
+         tasks[nbParallel++] = task;
+   }
+   i = nbParallel;
+   for( task=0; task < nbTasks; task++ )
+   {
+      if( cases[task/nbSeries].isSerial )
+         tasks[i++] = task;
+   }
+
+#ifdef _OPENMP
+   if( nbThread <= 0 )
+      nbThread = omp_get_max_threads();
+   printf( "Comparing %d cases with %d threads...\n", nbCases, nbThread );
+   #pragma omp parallel for num_threads(nbThread) schedule(dynamic)
+#else
+   (void)nbThread;
+   printf( "Comparing %d cases (no OpenMP, one thread)...\n", nbCases );
+#endif
+   for( i=0; i < nbParallel; i++ )
+   {
+      task = tasks[i];
+      cases[task/nbSeries].function( &cases[task/nbSeries], &series[task%nbSeries], &errors[task] );
+   }
+
+   /* These change the global settings. */
+   for( i=nbParallel; i < nbTasks; i++ )
+   {
+      task = tasks[i];
+      cases[task/nbSeries].function( &cases[task/nbSeries], &series[task%nbSeries], &errors[task] );
+   }
+
+   printf( "\n%-12s %-12s %12s  %-18s %12s  %-18s %s\n", "Function", "Variant",
+           "Max abs", "At", "Max rel", "At", "Status" );
+   nbFailed = 0;
+   for( i=0; i < nbCases; i++ )
+      nbFailed += report( &cases[i], &errors[i*nbSeries], series, verbose );
+
+   printf( "\n%d case(s) compared on %d series, %d failed.\n", nbCases, nbSeries, nbFailed );
+
+   free( tasks );
+   free( errors );
+   for( s=0; s < nbSeries; s++ )
+      diffFreeSeries( &series[s] );
+   TA_Shutdown();
+
+   return nbFailed? 5 : 0;
+}
+
+/**** Local functions definitions.     ****/
+
+/* One line for the case (the worst series for each error), returns 1
+ * when failed.
+ */
+static int report( const DiffCase *diffCase, const DiffError *errors,
+                   const DiffSeries *series, int verbose )
+{
+   const DiffError *worstAbs, *worstRel;
+   const char *failure, *status;
+   char absWhere[64], relWhere[64];
+   int s, isFailed;
+
+   worstAbs = worstRel = &errors[0];
+   failure  = NULL;
+   for( s=0; s < DIFF_NB_SERIES && series[s].name; s++ )
+   {
+      if( errors[s].failure && !failure )
+         failure = errors[s].failure;
+      if( errors[s].maxAbs > worstAbs->maxAbs )
+         worstAbs = &errors[s];
+      if( errors[s].maxRel > worstRel->maxRel )
+         worstRel = &errors[s];
+   }
+
+   isFailed = (failure != NULL) || ((diffCase->tolerance >= 0.0) && (worstRel->maxRel > diffCase->tolerance));
+   status   = failure? failure : (isFailed? "FAIL" : ((diffCase->tolerance < 0.0)? "-" : "ok"));
+
+   where( absWhere, series[worstAbs-errors].name, worstAbs->absIdx );
+   where( relWhere, series[worstRel-errors].name, worstRel->worstIdx );
+   printf( "%-12s %-12s %12.3e  %-18s %12.3e  %-18s %s\n", diffCase->name, diffCase->variant,
+           worstAbs->maxAbs, absWhere, worstRel->maxRel, relWhere, status );
+
+   for( s=0; verbose && (s < DIFF_NB_SERIES) && series[s].name; s++ )
+   {
+      printf( "   %-22s %12.3e  %-18d %12.3e  %-18d %s\n", series[s].name,
+              errors[s].maxAbs, errors[s].absIdx, errors[s].maxRel, errors[s].worstIdx,
+              errors[s].failure? errors[s].failure : "" );
+   }
+
+   return isFailed;
+}
+
+static void where( char *buffer, const char *seriesName, int idx )
+{
+   if( idx < 0 )
+      strcpy( buffer, "identical" );
+   else
+      sprintf( buffer, "%s@%d", seriesName, idx );
+}
+
+/* A case is selected by its function name or its variant. */
+static int isSelected( const DiffCase *diffCase, const char *filter )
+{
+   return !filter ||
+          (strcmp( diffCase->name, filter ) == 0) ||
+          (strcmp( diffCase->variant, filter ) == 0);
+}
+
+/* Parse "-name value" options. */
+static const char *option( int argc, char **argv, const char *name )
+{
+   int i;
+
+   for( i=1; i < argc-1; i++ )
+   {
+      if( strcmp( argv[i], name ) == 0 )
+         return argv[i+1];
+   }
+
+   return NULL;
+}
+
+static int flag( int argc, char **argv, const char *name )
+{
+   int i;
+
+   for( i=1; i < argc; i++ )
+   {
+      if( strcmp( argv[i], name ) == 0 )
+         return 1;
+   }
+
+   return 0;
+}
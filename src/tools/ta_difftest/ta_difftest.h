@@ -0,0 +1,73 @@
+#pragma once
+
+#include "ta_libc.h"
+#include "ta_registry.h"
+
+/* One synthetic series, all the arrays have nbBars elements. */
+typedef struct
+{
+   const char *name;
+   int     nbBars;
+   double *open;
+   double *high;
+   double *low;
+   double *close;
+   double *volume;
+} DiffSeries;
+
+#define DIFF_NB_SERIES 5
+
+/* Largest differences between a variant and its reference.
+ *
+ * The relative error is |value-ref|/(|ref|+scale), where the scale is
+ * the magnitude of the values around the bar, so a reference crossing
+ * or near 0 does not make any rounding a large error.
+ */
+typedef struct
+{
+   double      maxAbs;
+   double      maxRel;
+   int         absIdx;   /* Bar of maxAbs, -1 when no difference. */
+   int         worstIdx; /* Bar of maxRel, -1 when no difference. */
+   Int64       nbValues;
+   const char *failure;  /* Set when the outputs cannot be compared. */
+} DiffError;
+
+typedef struct DiffCase DiffCase;
+
+typedef void (*DiffFunction)( const DiffCase *diffCase,
+                              const DiffSeries *series,
+                              DiffError *error );
+
+/* One variant compared with its reference. */
+struct DiffCase
+{
+   char              name[32];   /* Like "SMA". */
+   const char       *variant;    /* Like "stream". */
+   DiffFunction      function;
+   const TA_FuncDef *func;       /* For the variants of any function. */
+   int               param;      /* Depends of the variant (stream id, MA type...). */
+   double            tolerance;  /* Maximum relative error, negative to only report. */
+   int               isSerial;   /* Changes the global settings, not run in parallel. */
+};
+
+/* diff_series.c */
+int  diffMakeSeries( DiffSeries *series, int kind, int nbBars, unsigned int seed );
+void diffFreeSeries( DiffSeries *series );
+
+/* diff_cases.c */
+int diffCases( DiffCase *cases, int maxCases );
+
+void diffInit( DiffError *error );
+
+/* Compare the outputs of a reference and of a variant. The variant
+ * must end on the same bar as the reference, and when sameRange is
+ * set, also start on the same bar. The scale of the relative error
+ * is the largest |ref| of the last 30 to 60 reference values.
+ */
+void diffOutputs( DiffError *error, int sameRange,
+                  const double *ref, int refBegIdx, int refNBElement,
+                  const double *value, int begIdx, int nbElement );
+void diffIntOutputs( DiffError *error, int sameRange,
+                     const int *ref, int refBegIdx, int refNBElement,
+                     const int *value, int begIdx, int nbElement );
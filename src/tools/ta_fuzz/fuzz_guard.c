@@ -0,0 +1,85 @@
+/* Description:
+ *   Arrays placed against an inaccessible page, to detect the reads
+ *   and writes out of the range of a TA function (see ta_fuzz.h).
+ */
+
+/**** Headers ****/
+#ifdef _WIN32
+   #include "windows.h"
+#else
+   /* MAP_ANONYMOUS is not declared by a strict -std=c17. */
+   #define _DEFAULT_SOURCE
+   #include <unistd.h>
+   #include <sys/mman.h>
+#endif
+
+#include "ta_fuzz.h"
+
+/**** Local functions declarations.    ****/
+static size_t pageSize( void );
+
+/**** Global functions definitions.   ****/
+int fuzzGuardAlloc( FuzzGuard *guard, int firstIdx, int lastIdx,
+                    size_t elementSize, int guardBefore )
+{
+   size_t page, size, dataSize;
+   char *data;
+
+   page     = pageSize();
+   size     = (size_t)(lastIdx-firstIdx+1)*elementSize;
+   dataSize = ((size+page-1)/page)*page;
+
+   /* An inaccessible page on each side of the data. */
+   guard->mapSize = dataSize+2*page;
+#ifdef _WIN32
+   guard->map = VirtualAlloc( NULL, guard->mapSize, MEM_RESERVE, PAGE_NOACCESS );
+   if( !guard->map )
+      return 0;
+   if( dataSize && !VirtualAlloc( (char *)guard->map+page, dataSize, MEM_COMMIT, PAGE_READWRITE ) )
+   {
+      VirtualFree( guard->map, 0, MEM_RELEASE );
+      return 0;
+   }
+#else
+   guard->map = mmap( NULL, guard->mapSize, PROT_NONE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0 );
+   if( guard->map == MAP_FAILED )
+      return 0;
+   if( dataSize && (mprotect( (char *)guard->map+page, dataSize, PROT_READ|PROT_WRITE ) != 0) )
+   {
+      munmap( guard->map, guard->mapSize );
+      return 0;
+   }
+#endif
+
+   /* The data starts or ends exactly on a page boundary. The array
+    * itself starts before the data when firstIdx is not 0.
+    */
+   data = (char *)guard->map+page;
+   if( !guardBefore )
+      data += dataSize-size;
+   guard->array = data-(size_t)firstIdx*elementSize;
+
+   return 1;
+}
+
+void fuzzGuardFree( FuzzGuard *guard )
+{
+#ifdef _WIN32
+   VirtualFree( guard->map, 0, MEM_RELEASE );
+#else
+   munmap( guard->map, guard->mapSize );
+#endif
+}
+
+/**** Local functions definitions.     ****/
+static size_t pageSize( void )
+{
+#ifdef _WIN32
+   SYSTEM_INFO info;
+
+   GetSystemInfo( &info );
+   return (size_t)info.dwPageSize;
+#else
+   return (size_t)sysconf( _SC_PAGESIZE );
+#endif
+}
@@ -0,0 +1,190 @@
+/* Description:
+ *   Standalone driver of the fuzz target, for the compilers without
+ *   libFuzzer. Not compiled with TA_FUZZ_LIBFUZZER (libFuzzer has its
+ *   own main).
+ *
+ *   Usage: ta_fuzz [options] [file...]
+ *
+ *      -runs <n>      Number of random inputs (default 100000)
+ *      -seed <n>      Seed of the random inputs (default 1)
+ *      -run <r>       Only the input r of the seed, to reproduce a failure
+ *      -func <name>   Only this function (like TA_FUZZ_FUNC)
+ *      -verbose       Print each run and its decoded call
+ *
+ *   With files, each file is an input (a corpus or a crash of
+ *   libFuzzer) and no random input is generated.
+ */
+
+/**** Headers ****/
+#if defined(_MSC_VER)
+   #define _CRT_SECURE_NO_WARNINGS
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+
+#include "ta_fuzz.h"
+
+#ifndef TA_FUZZ_LIBFUZZER
+
+/**** Local declarations.              ****/
+#define MAX_INPUT_SIZE 8192
+
+/**** Local functions declarations.    ****/
+static size_t randomInput( unsigned int seed, int run, uint8_t *buffer );
+static int    replayFile( const char *fileName );
+static void   onAbort( int sig );
+
+/**** Local variables definitions.     ****/
+static uint8_t      inputBuffer[MAX_INPUT_SIZE];
+static unsigned int currentSeed;
+static int          currentRun = -1;
+
+/**** Global functions definitions.   ****/
+int main( int argc, char **argv )
+{
+   const TA_FuncDef *func;
+   int i, run, nbRuns, firstRun, nbFiles, verbose;
+   size_t size;
+
+   LLVMFuzzerInitialize( &argc, &argv );
+
+   nbRuns   = 100000;
+   firstRun = 0;
+   nbFiles  = 0;
+   verbose  = 0;
+   currentSeed = 1;
+
+   for( i=1; i < argc; i++ )
+   {
+      if( (strcmp( argv[i], "-runs" ) == 0) && (i+1 < argc) )
+         nbRuns = atoi( argv[++i] );
+      else if( (strcmp( argv[i], "-seed" ) == 0) && (i+1 < argc) )
+         currentSeed = (unsigned int)atoi( argv[++i] );
+      else if( (strcmp( argv[i], "-run" ) == 0) && (i+1 < argc) )
+      {
+         firstRun = atoi( argv[++i] );
+         nbRuns   = 1;
+      }
+      else if( (strcmp( argv[i], "-func" ) == 0) && (i+1 < argc) )
+      {
+         func = TA_FuncFind( argv[++i] );
+         if( !func )
+         {
+            printf( "Unknown function %s\n", argv[i] );
+            return 1;
+         }
+         fuzzSelectFunction( func );
+      }
+      else if( strcmp( argv[i], "-verbose" ) == 0 )
+      {
+         verbose = 1;
+         fuzzSetVerbose( 1 );
+      }
+      else if( argv[i][0] == '-' )
+      {
+         printf( "Usage: ta_fuzz [-runs <n>] [-seed <n>] [-run <r>] [-func <name>] [-verbose] [file...]\n" );
+         return 1;
+      }
+   }
+
+   /* Replay the files. */
+   for( i=1; i < argc; i++ )
+   {
+      if( argv[i][0] == '-' )
+      {
+         if( strcmp( argv[i], "-verbose" ) != 0 )
+            i++;
+         continue;
+      }
+      if( verbose )
+         printf( "%s\n", argv[i] );
+      if( !replayFile( argv[i] ) )
+      {
+         printf( "Cannot read %s\n", argv[i] );
+         return 1;
+      }
+      nbFiles++;
+   }
+   if( nbFiles )
+   {
+      printf( "%d file(s) replayed, no failure.\n", nbFiles );
+      TA_Shutdown();
+      return 0;
+   }
+
+   /* The failures of the target abort, print how to reproduce it. */
+   signal( SIGABRT, onAbort );
+
+   for( run=firstRun; run < firstRun+nbRuns; run++ )
+   {
+      if( verbose )
+      {
+         printf( "-seed %u -run %d\n", currentSeed, run );
+         fflush( stdout );
+      }
+      currentRun = run;
+      size = randomInput( currentSeed, run, inputBuffer );
+      LLVMFuzzerTestOneInput( inputBuffer, size );
+
+      if( ((run+1-firstRun)%10000) == 0 )
+      {
+         printf( "%d runs\n", run+1-firstRun );
+         fflush( stdout );
+      }
+   }
+
+   printf( "%d runs, no failure.\n", nbRuns );
+   TA_Shutdown();
+   return 0;
+}
+
+/**** Local functions definitions.     ****/
+
+/* The same (seed, run) always gives the same input. */
+static size_t randomInput( unsigned int seed, int run, uint8_t *buffer )
+{
+   uint64_t state;
+   size_t i, size;
+
+   state = ((uint64_t)seed<<32)^(uint64_t)(unsigned int)run;
+   for( i=0; i < 4; i++ )
+      state = state*6364136223846793005ull+1442695040888963407ull;
+
+   /* Often short: the end of the series comes from the hash. */
+   size = (size_t)((state>>33)%((state&1)? 64 : MAX_INPUT_SIZE));
+   for( i=0; i < size; i++ )
+   {
+      state = state*6364136223846793005ull+1442695040888963407ull;
+      buffer[i] = (uint8_t)(state>>56);
+   }
+
+   return size;
+}
+
+static int replayFile( const char *fileName )
+{
+   FILE *file;
+   size_t size;
+
+   file = fopen( fileName, "rb" );
+   if( !file )
+      return 0;
+   size = fread( inputBuffer, 1, MAX_INPUT_SIZE, file );
+   fclose( file );
+
+   LLVMFuzzerTestOneInput( inputBuffer, size );
+   return 1;
+}
+
+static void onAbort( int sig )
+{
+   /* abort() terminates the process when the handler returns. */
+   signal( sig, SIG_DFL );
+   if( currentRun >= 0 )
+      fprintf( stderr, "Reproduce with: ta_fuzz -seed %u -run %d\n", currentSeed, currentRun );
+}
+
+#endif
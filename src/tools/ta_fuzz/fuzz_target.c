@@ -0,0 +1,522 @@
+/* Description:
+ *   libFuzzer target of all the functions of the registry.
+ *
+ *   The bytes of the fuzzer are decoded in a function, a range
+ *   [startIdx,endIdx], the optional parameters (in their range) and the
+ *   price series (see decode). The function is called with its inputs
+ *   and outputs against an inaccessible page (fuzz_guard.c), then:
+ *
+ *    - the return code must be TA_SUCCESS, or TA_BAD_PARAM when the
+ *      lookback is -1 (a default not supported by the function),
+ *    - outNBElement must be TA_FuncOutputSize() and outBegIdx must be
+ *      max(startIdx,lookback), or 0 when there is no output,
+ *    - all the outNBElement values of each output must be written,
+ *    - TA_FuncTail() on the last nbTail bars must match the reference,
+ *      the call on all the bars [0,endIdx].
+ *
+ *   A failure is printed with the decoded call, then aborts.
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "ta_fuzz.h"
+
+/**** Local declarations.              ****/
+
+/* Value never written by a function, see test_util.c. */
+#define PATTERN_REAL    (-2.849284E-199)
+#define PATTERN_INTEGER (TA_INTEGER_DEFAULT)
+
+/* The bytes of the fuzzer. Past the end, the bytes are pseudo-random
+ * from a hash of all the input, so a short input still gives a long
+ * series.
+ */
+typedef struct
+{
+   const uint8_t *data;
+   size_t         size;
+   size_t         pos;
+   unsigned int   seed;
+} FuzzInput;
+
+/**** Local functions declarations.    ****/
+static unsigned int nextByte( FuzzInput *input );
+static unsigned int nextWord( FuzzInput *input );
+static int  decode( FuzzCase *fuzzCase, const uint8_t *data, size_t size );
+static void decodeOptIn( FuzzCase *fuzzCase, FuzzInput *input );
+static void decodeSeries( FuzzCase *fuzzCase, FuzzInput *input );
+static int  checkCall( const FuzzCase *fuzzCase );
+static void checkTail( const FuzzCase *fuzzCase );
+static int  seriesOf( const FuzzCase *fuzzCase, int inputIdx );
+static int  isSameValue( double value, double ref, double scale );
+static void printCase( const FuzzCase *fuzzCase );
+static void fail( const FuzzCase *fuzzCase, const char *message, int value );
+
+/**** Local variables definitions.     ****/
+static const TA_FuncDef *selectedFunc;
+static int verbose;
+
+/* Too big for the stack of some fuzzers, one call at a time. */
+static FuzzCase fuzzCase;
+static double fullBuffer[FUZZ_MAX_OUTPUT][FUZZ_MAX_BARS];
+static double tailBuffer[FUZZ_MAX_OUTPUT][FUZZ_MAX_BARS];
+
+/**** Global functions definitions.   ****/
+int LLVMFuzzerInitialize( int *argc, char ***argv )
+{
+   const TA_FuncDef *func;
+   const char *name;
+   int i;
+
+   (void)argc;
+   (void)argv;
+
+   if( TA_Initialize() != TA_SUCCESS )
+   {
+      printf( "TA_Initialize failed\n" );
+      fflush( stdout );
+      abort();
+   }
+
+   for( i=0; i < TA_FuncCount(); i++ )
+   {
+      func = TA_FuncAt( i );
+      if( (func->nbInput > FUZZ_MAX_INPUT) || (func->nbOptInput > FUZZ_MAX_OPTIN) ||
+          (func->nbOutput > FUZZ_MAX_OUTPUT) )
+      {
+         printf( "%s is above the limits of ta_fuzz.h\n", func->name );
+         fflush( stdout );
+         abort();
+      }
+   }
+
+   name = getenv( "TA_FUZZ_FUNC" );
+   if( name )
+   {
+      selectedFunc = TA_FuncFind( name );
+      if( !selectedFunc )
+      {
+         printf( "Unknown function TA_FUZZ_FUNC=%s\n", name );
+         fflush( stdout );
+         abort();
+      }
+   }
+
+   return 0;
+}
+
+int LLVMFuzzerTestOneInput( const uint8_t *data, size_t size )
+{
+   if( !decode( &fuzzCase, data, size ) )
+      return 0;
+
+   if( verbose )
+      printCase( &fuzzCase );
+
+   if( checkCall( &fuzzCase ) )
+      checkTail( &fuzzCase );
+
+   return 0;
+}
+
+void fuzzSelectFunction( const TA_FuncDef *func )
+{
+   selectedFunc = func;
+}
+
+void fuzzSetVerbose( int isVerbose )
+{
+   verbose = isVerbose;
+}
+
+/**** Local functions definitions.     ****/
+
+/* Layout of the bytes:
+ *
+ *    Size  Description
+ *    ----  ---------------------------------------------
+ *       1  Function (index in the registry)
+ *       2  Number of bars
+ *       2  startIdx
+ *       2  endIdx (swapped with startIdx when smaller)
+ *       1  Flags, bit 0 is guardBefore
+ *       2  nbTail
+ *     1-3  Each optional parameter (see decodeOptIn)
+ *       6  Each bar (see decodeSeries)
+ */
+static int decode( FuzzCase *fuzzCase, const uint8_t *data, size_t size )
+{
+   FuzzInput input;
+   unsigned int funcIdx;
+   size_t i;
+   int tmp;
+
+   if( size < 10 )
+      return 0;
+
+   input.data = data;
+   input.size = size;
+   input.pos  = 0;
+   input.seed = 2166136261u;
+   for( i=0; i < size; i++ )
+      input.seed = (input.seed^data[i])*16777619u;
+
+   funcIdx = nextByte( &input );
+   fuzzCase->func = selectedFunc? selectedFunc : TA_FuncAt( (int)(funcIdx%(unsigned int)TA_FuncCount()) );
+
+   fuzzCase->nbBars   = 1+(int)(nextWord( &input )%FUZZ_MAX_BARS);
+   fuzzCase->startIdx = (int)(nextWord( &input )%(unsigned int)fuzzCase->nbBars);
+   fuzzCase->endIdx   = (int)(nextWord( &input )%(unsigned int)fuzzCase->nbBars);
+   if( fuzzCase->endIdx < fuzzCase->startIdx )
+   {
+      tmp = fuzzCase->startIdx;
+      fuzzCase->startIdx = fuzzCase->endIdx;
+      fuzzCase->endIdx = tmp;
+   }
+
+   fuzzCase->guardBefore = (int)(nextByte( &input )&1);
+   fuzzCase->nbTail = 1+(int)(nextWord( &input )%(unsigned int)(fuzzCase->endIdx+1));
+
+   decodeOptIn( fuzzCase, &input );
+   decodeSeries( fuzzCase, &input );
+
+   return 1;
+}
+
+/* A parameter is its default, its minimum, its maximum or a value in
+ * its range. Most limits are huge: a real is taken in [-10,10] and
+ * an integer (a period) up to a little more than the number of bars.
+ */
+static void decodeOptIn( FuzzCase *fuzzCase, FuzzInput *input )
+{
+   const TA_OptInputDef *def;
+   double low, high;
+   int i;
+
+   for( i=0; i < fuzzCase->func->nbOptInput; i++ )
+   {
+      def = &fuzzCase->func->optInputs[i];
+
+      switch( nextByte( input )%8 )
+      {
+      case 0:
+         fuzzCase->optIn[i] = (def->type == TA_OPTIN_REAL)? TA_REAL_DEFAULT : (double)TA_INTEGER_DEFAULT;
+         break;
+      case 1:
+         fuzzCase->optIn[i] = def->min;
+         break;
+      case 2:
+         fuzzCase->optIn[i] = def->max;
+         break;
+      default:
+         if( def->type == TA_OPTIN_REAL )
+         {
+            low  = (def->min < -10.0)? -10.0 : def->min;
+            high = (def->max >  10.0)?  10.0 : def->max;
+            fuzzCase->optIn[i] = low+((high-low)*(double)nextWord( input ))/65535.0;
+         }
+         else
+         {
+            high = def->min+fuzzCase->nbBars+8;
+            if( high > def->max )
+               high = def->max;
+            fuzzCase->optIn[i] = def->min+(double)(nextWord( input )%(unsigned int)(high-def->min+1.0));
+         }
+         break;
+      }
+   }
+}
+
+/* A random walk of up to 10% per bar, with low <= open <= high and
+ * low <= close <= high. The volume can be 0. FUZZ_REAL1 is in [1,64],
+ * used as a second series or as periods.
+ */
+static void decodeSeries( FuzzCase *fuzzCase, FuzzInput *input )
+{
+   double close, high, low;
+   int i;
+
+   close = 100.0;
+   for( i=0; i < fuzzCase->nbBars; i++ )
+   {
+      close *= 1.0+((double)nextByte( input )-128.0)/1280.0;
+      if( close < 0.01 )
+         close = 0.01;
+      else if( close > 1e6 )
+         close = 1e6;
+
+      high = close*(1.0+(double)nextByte( input )/2560.0);
+      low  = close*(1.0-(double)nextByte( input )/2560.0);
+
+      fuzzCase->series[FUZZ_OPEN][i]   = low+((high-low)*(double)nextByte( input ))/255.0;
+      fuzzCase->series[FUZZ_HIGH][i]   = high;
+      fuzzCase->series[FUZZ_LOW][i]    = low;
+      fuzzCase->series[FUZZ_CLOSE][i]  = close;
+      fuzzCase->series[FUZZ_VOLUME][i] = (double)nextByte( input )*100.0;
+      fuzzCase->series[FUZZ_REAL1][i]  = (double)(1+nextByte( input )%64);
+   }
+}
+
+/* The call on [startIdx,endIdx] with guarded inputs and outputs.
+ * Returns 0 when the parameters are invalid.
+ */
+static int checkCall( const FuzzCase *fuzzCase )
+{
+   const TA_FuncDef *func;
+   FuzzGuard inputGuard[FUZZ_MAX_INPUT];
+   FuzzGuard outputGuard[FUZZ_MAX_OUTPUT];
+   const double *inputs[FUZZ_MAX_INPUT];
+   void *outputs[FUZZ_MAX_OUTPUT];
+   TA_RetCode retCode;
+   int lookback, expected, firstIdx, outBegIdx, outNBElement, i, j;
+
+   func     = fuzzCase->func;
+   lookback = func->lookback( fuzzCase->optIn );
+   expected = TA_FuncOutputSize( func, fuzzCase->startIdx, fuzzCase->endIdx, fuzzCase->optIn );
+   if( (lookback >= 0) && (expected < 0) )
+      fail( fuzzCase, "Invalid output size", expected );
+
+   /* Nothing must be written when the parameters are invalid. */
+   if( lookback < 0 )
+      expected = 0;
+
+   /* The first bar needed by the calculation. */
+   firstIdx = 0;
+   if( fuzzCase->guardBefore && (fuzzCase->startIdx > lookback) )
+      firstIdx = fuzzCase->startIdx-lookback;
+
+   for( i=0; i < func->nbInput; i++ )
+   {
+      if( !fuzzGuardAlloc( &inputGuard[i], firstIdx, fuzzCase->endIdx,
+                           sizeof(double), fuzzCase->guardBefore ) )
+         fail( fuzzCase, "Cannot allocate a guarded input", i );
+
+      memcpy( (double *)inputGuard[i].array+firstIdx,
+              &fuzzCase->series[seriesOf( fuzzCase, i )][firstIdx],
+              sizeof(double)*(size_t)(fuzzCase->endIdx-firstIdx+1) );
+      inputs[i] = (const double *)inputGuard[i].array;
+   }
+
+   for( i=0; i < func->nbOutput; i++ )
+   {
+      if( func->outputs[i].type == TA_OUTPUT_INTEGER )
+      {
+         if( !fuzzGuardAlloc( &outputGuard[i], 0, expected-1, sizeof(int), fuzzCase->guardBefore ) )
+            fail( fuzzCase, "Cannot allocate a guarded output", i );
+         for( j=0; j < expected; j++ )
+            ((int *)outputGuard[i].array)[j] = PATTERN_INTEGER;
+      }
+      else
+      {
+         if( !fuzzGuardAlloc( &outputGuard[i], 0, expected-1, sizeof(double), fuzzCase->guardBefore ) )
+            fail( fuzzCase, "Cannot allocate a guarded output", i );
+         for( j=0; j < expected; j++ )
+            ((double *)outputGuard[i].array)[j] = PATTERN_REAL;
+      }
+      outputs[i] = outputGuard[i].array;
+   }
+
+   outBegIdx    = -1;
+   outNBElement = -1;
+   retCode = func->call( fuzzCase->startIdx, fuzzCase->endIdx, inputs, fuzzCase->optIn,
+                         &outBegIdx, &outNBElement, outputs );
+
+   if( (lookback < 0) && (retCode != TA_BAD_PARAM) )
+      fail( fuzzCase, "Invalid parameters accepted", retCode );
+   if( (lookback >= 0) && (retCode != TA_SUCCESS) )
+      fail( fuzzCase, "Return code", retCode );
+   if( (lookback >= 0) && (outNBElement != expected) )
+      fail( fuzzCase, "outNBElement is not TA_FuncOutputSize()", outNBElement );
+   if( (lookback >= 0) && (expected > 0) && (outBegIdx != ((fuzzCase->startIdx > lookback)? fuzzCase->startIdx : lookback)) )
+      fail( fuzzCase, "outBegIdx is not max(startIdx,lookback)", outBegIdx );
+   if( (lookback >= 0) && (expected == 0) && (outBegIdx != 0) )
+      fail( fuzzCase, "outBegIdx is not 0 without output", outBegIdx );
+
+   for( i=0; i < func->nbOutput; i++ )
+   {
+      for( j=0; j < expected; j++ )
+      {
+         if( (func->outputs[i].type == TA_OUTPUT_INTEGER)?
+             (((int *)outputs[i])[j] == PATTERN_INTEGER) :
+             (((double *)outputs[i])[j] == PATTERN_REAL) )
+            fail( fuzzCase, "Output value not written", j );
+      }
+      fuzzGuardFree( &outputGuard[i] );
+   }
+
+   for( i=0; i < func->nbInput; i++ )
+      fuzzGuardFree( &inputGuard[i] );
+
+   return lookback >= 0;
+}
+
+/* TA_FuncTail() compared with the reference, the call on all the bars.
+ * The integer outputs, and all the outputs of the functions with an
+ * unstable period, must be identical. The tolerance of the real
+ * outputs is for the running sums of the functions on a fixed window,
+ * started at another bar (see ta_registry.h). Their error is
+ * proportional to the inputs, and to the real parameters used as
+ * multipliers (like optInNbDev). The functions depending on all the
+ * history must return TA_NOT_SUPPORTED.
+ */
+static void checkTail( const FuzzCase *fuzzCase )
+{
+   const TA_FuncDef *func;
+   const double *inputs[FUZZ_MAX_INPUT];
+   void *fullOutputs[FUZZ_MAX_OUTPUT];
+   void *tailOutputs[FUZZ_MAX_OUTPUT];
+   TA_RetCode retCode;
+   TA_TailMode mode;
+   double scale;
+   int fullBegIdx, fullNBElement, tailBegIdx, tailNBElement, expected, i, j, k;
+
+   func  = fuzzCase->func;
+   scale = 0.0;
+   for( i=0; i < func->nbInput; i++ )
+   {
+      inputs[i] = fuzzCase->series[seriesOf( fuzzCase, i )];
+      for( j=0; j <= fuzzCase->endIdx; j++ )
+      {
+         if( fabs( inputs[i][j] ) > scale )
+            scale = fabs( inputs[i][j] );
+      }
+   }
+   for( i=0; i < func->nbOptInput; i++ )
+   {
+      if( (func->optInputs[i].type == TA_OPTIN_REAL) && (fuzzCase->optIn[i] != TA_REAL_DEFAULT) &&
+          (fabs( fuzzCase->optIn[i] ) > 1.0) )
+         scale *= fabs( fuzzCase->optIn[i] );
+   }
+
+   for( i=0; i < func->nbOutput; i++ )
+   {
+      fullOutputs[i] = fullBuffer[i];
+      tailOutputs[i] = tailBuffer[i];
+   }
+
+   retCode = func->call( 0, fuzzCase->endIdx, inputs, fuzzCase->optIn,
+                         &fullBegIdx, &fullNBElement, fullOutputs );
+   if( retCode != TA_SUCCESS )
+      fail( fuzzCase, "Return code of the reference", retCode );
+
+   mode    = TA_FuncTailMode( func, fuzzCase->optIn );
+   retCode = TA_FuncTail( func, fuzzCase->endIdx, fuzzCase->nbTail, TA_TAIL_ALL_HISTORY,
+                          inputs, fuzzCase->optIn, &tailBegIdx, &tailNBElement, tailOutputs );
+   if( mode == TA_TAIL_HISTORY )
+   {
+      if( retCode != TA_NOT_SUPPORTED )
+         fail( fuzzCase, "Return code of TA_FuncTail on all the history", retCode );
+      return;
+   }
+   if( retCode != TA_SUCCESS )
+      fail( fuzzCase, "Return code of TA_FuncTail", retCode );
+
+   expected = TA_FuncOutputSize( func, fuzzCase->endIdx-fuzzCase->nbTail+1,
+                                 fuzzCase->endIdx, fuzzCase->optIn );
+   if( tailNBElement != expected )
+      fail( fuzzCase, "outNBElement of TA_FuncTail", tailNBElement );
+   if( tailNBElement == 0 )
+      return;
+   if( (tailBegIdx+tailNBElement != fuzzCase->endIdx+1) || (fullBegIdx+fullNBElement != fuzzCase->endIdx+1) )
+      fail( fuzzCase, "Last output is not endIdx", tailBegIdx );
+
+   for( i=0; i < func->nbOutput; i++ )
+   {
+      for( j=0, k=tailBegIdx-fullBegIdx; j < tailNBElement; j++, k++ )
+      {
+         if( func->outputs[i].type == TA_OUTPUT_INTEGER )
+         {
+            if( ((int *)tailOutputs[i])[j] != ((int *)fullOutputs[i])[k] )
+               fail( fuzzCase, "TA_FuncTail differs from the reference at bar", tailBegIdx+j );
+         }
+         else if( mode == TA_TAIL_UNSTABLE )
+         {
+            if( memcmp( &tailBuffer[i][j], &fullBuffer[i][k], sizeof(double) ) != 0 )
+               fail( fuzzCase, "TA_FuncTail differs from the reference at bar", tailBegIdx+j );
+         }
+         else if( !isSameValue( tailBuffer[i][j], fullBuffer[i][k], scale ) )
+            fail( fuzzCase, "TA_FuncTail differs from the reference at bar", tailBegIdx+j );
+      }
+   }
+}
+
+/* The series of an input: the prices, then close and FUZZ_REAL1 for
+ * the TA_INPUT_REAL inputs.
+ */
+static int seriesOf( const FuzzCase *fuzzCase, int inputIdx )
+{
+   int i, nbReal;
+
+   switch( fuzzCase->func->inputs[inputIdx].type )
+   {
+   case TA_INPUT_OPEN:   return FUZZ_OPEN;
+   case TA_INPUT_HIGH:   return FUZZ_HIGH;
+   case TA_INPUT_LOW:    return FUZZ_LOW;
+   case TA_INPUT_CLOSE:  return FUZZ_CLOSE;
+   case TA_INPUT_VOLUME: return FUZZ_VOLUME;
+   default:
+      break;
+   }
+
+   for( i=0, nbReal=0; i < inputIdx; i++ )
+   {
+      if( fuzzCase->func->inputs[i].type == TA_INPUT_REAL )
+         nbReal++;
+   }
+
+   return nbReal? FUZZ_REAL1 : FUZZ_CLOSE;
+}
+
+/* The running sums of a window start at another bar in the tail, so
+ * the rounding differs. It is amplified by a ratio on a nearly flat
+ * window (BBDist, STDDEV of close values...), hence the relative
+ * tolerance well above the precision of a double.
+ */
+static int isSameValue( double value, double ref, double scale )
+{
+   if( (value == ref) || ((value != value) && (ref != ref)) )
+      return 1;
+
+   return fabs( value-ref ) <= 1e-5*fabs( ref )+1e-6*scale;
+}
+
+static void fail( const FuzzCase *fuzzCase, const char *message, int value )
+{
+   printf( "\nFAILED %s: %s (%d)\n", fuzzCase->func->name, message, value );
+   printCase( fuzzCase );
+
+   abort();
+}
+
+static void printCase( const FuzzCase *fuzzCase )
+{
+   int i;
+
+   printf( "   %s nbBars=%d startIdx=%d endIdx=%d nbTail=%d guardBefore=%d\n",
+           fuzzCase->func->name, fuzzCase->nbBars, fuzzCase->startIdx, fuzzCase->endIdx,
+           fuzzCase->nbTail, fuzzCase->guardBefore );
+   for( i=0; i < fuzzCase->func->nbOptInput; i++ )
+      printf( "   %s=%.17g\n", fuzzCase->func->optInputs[i].name, fuzzCase->optIn[i] );
+   fflush( stdout );
+}
+
+static unsigned int nextByte( FuzzInput *input )
+{
+   if( input->pos < input->size )
+      return input->data[input->pos++];
+
+   input->seed = input->seed*1103515245u+12345u;
+   return (input->seed>>16)&0xFF;
+}
+
+static unsigned int nextWord( FuzzInput *input )
+{
+   unsigned int low;
+
+   low = nextByte( input );
+   return low|(nextByte( input )<<8);
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ta_libc.h"
+#include "ta_registry.h"
+
+/* Limits of a decoded input, checked against the registry at the
+ * initialization.
+ */
+#define FUZZ_MAX_BARS   1024
+#define FUZZ_MAX_INPUT  8
+#define FUZZ_MAX_OPTIN  16
+#define FUZZ_MAX_OUTPUT 6
+
+/* The series used for the inputs of a function. */
+typedef enum
+{
+   FUZZ_OPEN,
+   FUZZ_HIGH,
+   FUZZ_LOW,
+   FUZZ_CLOSE,
+   FUZZ_VOLUME,
+   FUZZ_REAL1,    /* Second TA_INPUT_REAL (inReal1, inPeriods...). */
+   FUZZ_NB_SERIES
+} FuzzSeriesId;
+
+/* One call decoded from the bytes of the fuzzer. */
+typedef struct
+{
+   const TA_FuncDef *func;
+   int    nbBars;
+   int    startIdx;
+   int    endIdx;
+   int    nbTail;      /* For the comparison of TA_FuncTail with the full call. */
+   int    guardBefore; /* The inaccessible page is before the inputs and outputs. */
+   double optIn[FUZZ_MAX_OPTIN];
+   double series[FUZZ_NB_SERIES][FUZZ_MAX_BARS];
+} FuzzCase;
+
+/* Entry points of libFuzzer, also called by the standalone driver
+ * (fuzz_main.c). TA_FUZZ_FUNC selects a single function by name.
+ */
+int LLVMFuzzerInitialize( int *argc, char ***argv );
+int LLVMFuzzerTestOneInput( const uint8_t *data, size_t size );
+
+/* fuzz_target.c */
+void fuzzSelectFunction( const TA_FuncDef *func );
+void fuzzSetVerbose( int isVerbose ); /* Print each decoded call. */
+
+/* fuzz_guard.c
+ *
+ * An array where only the elements [firstIdx,lastIdx] are accessible.
+ * The element after lastIdx (guardBefore is 0) or before firstIdx
+ * (guardBefore is 1) is on an inaccessible page: reading or writing
+ * it crashes immediately. The array has no accessible element when
+ * lastIdx is firstIdx-1.
+ */
+typedef struct
+{
+   void  *map;
+   size_t mapSize;
+   void  *array;
+} FuzzGuard;
+
+int  fuzzGuardAlloc( FuzzGuard *guard, int firstIdx, int lastIdx,
+                     size_t elementSize, int guardBefore );
+void fuzzGuardFree( FuzzGuard *guard );
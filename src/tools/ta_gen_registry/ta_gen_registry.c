@@ -0,0 +1,700 @@
+/* Description:
+ *   Generate src/ta_func/ta_registry_table.h from the prototypes
+ *   and the comments of include/ta_func.h (see ta_registry.h).
+ *
+ *   Usage: ta_gen_registry [-check] <root of the repository>
+ *
+ *   With -check, nothing is written and the exit code is non-zero
+ *   when the existing file is not up to date.
+ *
+ *   For each function, ta_func.h must have:
+ *      - A comment block starting with " * TA_XXX - Hint", where each
+ *        optional parameter is documented as " * optInXxx:(From A to B)"
+ *        or " * optInXxx:" when there is no range.
+ *      - The "TA_RetCode TA_XXX(...);" prototype.
+ *      - The "int TA_XXX_Lookback(...);" prototype, with the same
+ *        optional parameters.
+ *
+ *   The unstable period id is TA_FUNC_UNST_XXX when it exists in
+ *   ta_defs.h.
+ */
+
+/**** Headers ****/
+#if defined(_MSC_VER)
+   #define _CRT_SECURE_NO_WARNINGS
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdarg.h>
+
+/**** Local declarations.              ****/
+#define MAX_NAME      64
+#define MAX_HINT      128
+#define MAX_RANGE     32
+#define MAX_PARAM     16
+#define MAX_FUNC      512
+#define MAX_UNST      64
+#define MAX_PATH      1024
+
+typedef struct
+{
+   char name[MAX_NAME];
+   char type[MAX_NAME];    /* Enum value of the registry. */
+   char min[MAX_RANGE];
+   char max[MAX_RANGE];
+} ParamDef;
+
+typedef struct
+{
+   char     name[MAX_NAME];
+   char     hint[MAX_HINT];
+   int      nbInput;
+   ParamDef inputs[MAX_PARAM];
+   int      nbOptInput;
+   ParamDef optInputs[MAX_PARAM];
+   int      nbOutput;
+   ParamDef outputs[MAX_PARAM];
+   int      isUnstable;
+} FuncDef;
+
+typedef struct
+{
+   FuncDef *funcs;
+   int      nbFunc;
+   char     unst[MAX_UNST][MAX_NAME];
+   int      nbUnst;
+} Registry;
+
+/**** Local functions declarations.    ****/
+static void printUsage( void );
+static char *loadFile( const char *path );
+static int parseUnstable( const char *defs, Registry *registry );
+static int parseFunctions( const char *header, Registry *registry );
+static const char *parseFunction( const char *doc, FuncDef *func );
+static int parseRange( const char *doc, const char *docEnd, const char *name,
+                       char *min, char *max );
+static int parsePrototype( char *params, FuncDef *func );
+static const char *castOptIn( const ParamDef *param );
+static int countLookbackParams( const char *header, const char *name );
+static void copyToken( char *dst, int size, const char *begin, const char *end );
+static int compareFunc( const void *a, const void *b );
+static char *generate( const Registry *registry );
+static void append( char **out, size_t *size, size_t *used, const char *format, ... );
+
+/**** Global functions definitions.   ****/
+int main( int argc, char **argv )
+{
+   char path[MAX_PATH];
+   Registry registry;
+   char *header, *defs, *output, *existing;
+   const char *root;
+   FILE *out;
+   int check, retValue;
+
+   check = (argc == 3) && (strcmp( argv[1], "-check" ) == 0);
+   if( (argc != 2) && !check )
+   {
+      printUsage();
+      return 1;
+   }
+   root = argv[argc-1];
+
+   sprintf( path, "%.900s/include/ta_func.h", root );
+   header = loadFile( path );
+   sprintf( path, "%.900s/include/ta_defs.h", root );
+   defs = loadFile( path );
+   if( !header || !defs )
+   {
+      printf( "Failed to read ta_func.h/ta_defs.h in [%s/include]\n", root );
+      free( header );
+      free( defs );
+      return 2;
+   }
+
+   memset( &registry, 0, sizeof(registry) );
+   registry.funcs = (FuncDef *)calloc( MAX_FUNC, sizeof(FuncDef) );
+   retValue = 0;
+   if( !registry.funcs || !parseUnstable( defs, &registry ) || !parseFunctions( header, &registry ) )
+      retValue = 3;
+
+   output = NULL;
+   if( retValue == 0 )
+   {
+      qsort( registry.funcs, registry.nbFunc, sizeof(FuncDef), compareFunc );
+      output = generate( &registry );
+      if( !output )
+         retValue = 3;
+   }
+
+   sprintf( path, "%.900s/src/ta_func/ta_registry_table.h", root );
+   if( (retValue == 0) && check )
+   {
+      existing = loadFile( path );
+      if( !existing || (strcmp( existing, output ) != 0) )
+      {
+         printf( "[%s] is not up to date\n", path );
+         retValue = 4;
+      }
+      free( existing );
+   }
+   else if( retValue == 0 )
+   {
+      out = fopen( path, "wb" );
+      if( !out || (fwrite( output, 1, strlen(output), out ) != strlen(output)) )
+         retValue = 5;
+      if( out && (fclose( out ) != 0) )
+         retValue = 5;
+      if( retValue != 0 )
+         printf( "Failed to write [%s]\n", path );
+      else
+         printf( "%d functions written in [%s]\n", registry.nbFunc, path );
+   }
+
+   free( output );
+   free( registry.funcs );
+   free( header );
+   free( defs );
+
+   return retValue;
+}
+
+/**** Local functions definitions.     ****/
+static void printUsage( void )
+{
+   printf( "Usage: ta_gen_registry [-check] <root of the repository>\n" );
+   printf( "\n" );
+   printf( "   Generate src/ta_func/ta_registry_table.h from include/ta_func.h\n" );
+   printf( "   -check  Only verify that the file is up to date.\n" );
+}
+
+static char *loadFile( const char *path )
+{
+   FILE *in;
+   char *buffer, *newBuffer;
+   size_t size, used, nbRead;
+
+   in = fopen( path, "rb" );
+   if( !in )
+      return NULL;
+
+   size = 1024*1024;
+   used = 0;
+   buffer = (char *)malloc( size );
+   while( buffer && ((nbRead = fread( buffer+used, 1, size-used-1, in )) > 0) )
+   {
+      used += nbRead;
+      if( used == size-1 )
+      {
+         newBuffer = (char *)realloc( buffer, size*2 );
+         if( !newBuffer )
+            free( buffer );
+         buffer = newBuffer;
+         size *= 2;
+      }
+   }
+   fclose( in );
+
+   if( buffer )
+   {
+      /* The comparisons and the parsing ignore the '\r'. */
+      buffer[used] = '\0';
+      for( size=0, nbRead=0; size < used; size++ )
+      {
+         if( buffer[size] != '\r' )
+            buffer[nbRead++] = buffer[size];
+      }
+      buffer[nbRead] = '\0';
+   }
+
+   return buffer;
+}
+
+static int parseUnstable( const char *defs, Registry *registry )
+{
+   const char *pos, *end;
+
+   pos = defs;
+   while( (pos = strstr( pos, "TA_FUNC_UNST_" )) != NULL )
+   {
+      pos += strlen( "TA_FUNC_UNST_" );
+      end = pos;
+      while( isalnum( (unsigned char)*end ) || (*end == '_') )
+         end++;
+
+      if( registry->nbUnst == MAX_UNST )
+         return 0;
+      copyToken( registry->unst[registry->nbUnst], MAX_NAME, pos, end );
+      if( (strcmp( registry->unst[registry->nbUnst], "ALL" ) != 0) &&
+          (strcmp( registry->unst[registry->nbUnst], "NONE" ) != 0) )
+         registry->nbUnst++;
+      pos = end;
+   }
+
+   return 1;
+}
+
+static int parseFunctions( const char *header, Registry *registry )
+{
+   const char *pos;
+   FuncDef *func;
+   int i, nbLookback;
+
+   pos = header;
+   while( (pos = strstr( pos, "\n * TA_" )) != NULL )
+   {
+      if( registry->nbFunc == MAX_FUNC )
+      {
+         printf( "Too many functions\n" );
+         return 0;
+      }
+
+      func = &registry->funcs[registry->nbFunc];
+      pos = parseFunction( pos+strlen( "\n * TA_" ), func );
+      if( !pos )
+         return 0;
+
+      nbLookback = countLookbackParams( header, func->name );
+      if( nbLookback != func->nbOptInput )
+      {
+         printf( "TA_%s_Lookback does not have the %d optional parameters of TA_%s\n",
+                 func->name, func->nbOptInput, func->name );
+         return 0;
+      }
+
+      for( i=0; i < registry->nbUnst; i++ )
+      {
+         if( strcmp( registry->unst[i], func->name ) == 0 )
+            func->isUnstable = 1;
+      }
+
+      registry->nbFunc++;
+   }
+
+   if( registry->nbFunc == 0 )
+   {
+      printf( "No function found\n" );
+      return 0;
+   }
+
+   return 1;
+}
+
+/* Parse the comment block and the prototype of one function.
+ * Return the position after the prototype, NULL on error.
+ */
+static const char *parseFunction( const char *doc, FuncDef *func )
+{
+   char prototype[MAX_NAME+16];
+   const char *pos, *docEnd, *proto, *protoEnd;
+   char *params;
+   int i;
+
+   /* " * TA_XXX - Hint" */
+   pos = strstr( doc, " - " );
+   if( !pos || (pos-doc >= MAX_NAME) || memchr( doc, '\n', pos-doc ) )
+   {
+      printf( "Invalid comment block near [%.40s]\n", doc );
+      return NULL;
+   }
+   copyToken( func->name, MAX_NAME, doc, pos );
+   pos += 3;
+   copyToken( func->hint, MAX_HINT, pos, strchr( pos, '\n' ) );
+
+   docEnd = strstr( doc, "*/" );
+   sprintf( prototype, "TA_RetCode TA_%s(", func->name );
+   proto = docEnd? strstr( docEnd, prototype ) : NULL;
+   protoEnd = proto? strstr( proto, ");" ) : NULL;
+   if( !protoEnd )
+   {
+      printf( "Prototype of TA_%s not found\n", func->name );
+      return NULL;
+   }
+
+   proto += strlen( prototype );
+   params = (char *)malloc( protoEnd-proto+1 );
+   if( !params )
+      return NULL;
+   memcpy( params, proto, protoEnd-proto );
+   params[protoEnd-proto] = '\0';
+
+   if( !parsePrototype( params, func ) )
+   {
+      printf( "Unexpected parameter in TA_%s\n", func->name );
+      free( params );
+      return NULL;
+   }
+   free( params );
+
+   for( i=0; i < func->nbOptInput; i++ )
+   {
+      if( !parseRange( doc, docEnd, func->optInputs[i].name,
+                       func->optInputs[i].min, func->optInputs[i].max ) )
+      {
+         printf( "%s of TA_%s is not documented\n", func->optInputs[i].name, func->name );
+         return NULL;
+      }
+
+      /* Default range. */
+      if( func->optInputs[i].min[0] == '\0' )
+      {
+         if( strcmp( func->optInputs[i].type, "TA_OPTIN_MATYPE" ) == 0 )
+         {
+            strcpy( func->optInputs[i].min, "TA_MAType_SMA" );
+            strcpy( func->optInputs[i].max, "TA_MAType_T3" );
+         }
+         else if( strcmp( func->optInputs[i].type, "TA_OPTIN_INTEGER" ) == 0 )
+         {
+            strcpy( func->optInputs[i].min, "TA_INTEGER_MIN" );
+            strcpy( func->optInputs[i].max, "TA_INTEGER_MAX" );
+         }
+         else
+         {
+            strcpy( func->optInputs[i].min, "TA_REAL_MIN" );
+            strcpy( func->optInputs[i].max, "TA_REAL_MAX" );
+         }
+      }
+   }
+
+   return protoEnd;
+}
+
+/* Find " * optInXxx:" within the comment block, with an
+ * optional "(From A to B)".
+ */
+static int parseRange( const char *doc, const char *docEnd, const char *name,
+                       char *min, char *max )
+{
+   char pattern[MAX_NAME+8];
+   const char *pos, *to, *end;
+
+   sprintf( pattern, " * %s:", name );
+   pos = strstr( doc, pattern );
+   if( !pos || (pos > docEnd) )
+      return 0;
+
+   min[0] = max[0] = '\0';
+   pos += strlen( pattern );
+   if( strncmp( pos, "(From ", 6 ) != 0 )
+      return 1;
+
+   pos += 6;
+   to  = strstr( pos, " to " );
+   end = strchr( pos, ')' );
+   if( !to || !end || (to > end) )
+      return 0;
+
+   copyToken( min, MAX_RANGE, pos, to );
+   copyToken( max, MAX_RANGE, to+4, end );
+
+   return 1;
+}
+
+/* Classify each parameter of the prototype by its name. */
+static int parsePrototype( char *params, FuncDef *func )
+{
+   char type[MAX_NAME*2], name[MAX_NAME];
+   char *pos, *end, *nameBegin, *nameEnd;
+   ParamDef *param;
+
+   /* Remove the comments, like the range of the parameters. */
+   while( (pos = strstr( params, "/*" )) != NULL )
+   {
+      end = strstr( pos, "*/" );
+      if( !end )
+         return 0;
+      memset( pos, ' ', end+2-pos );
+   }
+
+   pos = params;
+   while( *pos )
+   {
+      end = strchr( pos, ',' );
+      if( !end )
+         end = pos+strlen( pos );
+
+      nameEnd = end;
+      while( (nameEnd > pos) && (isspace( (unsigned char)nameEnd[-1] ) || (nameEnd[-1] == ']') || (nameEnd[-1] == '[')) )
+         nameEnd--;
+      nameBegin = nameEnd;
+      while( (nameBegin > pos) && (isalnum( (unsigned char)nameBegin[-1] ) || (nameBegin[-1] == '_')) )
+         nameBegin--;
+      copyToken( name, MAX_NAME, nameBegin, nameEnd );
+      copyToken( type, sizeof(type), pos, nameBegin );
+
+      param = NULL;
+      if( (strcmp( name, "startIdx" ) == 0) || (strcmp( name, "endIdx" ) == 0) ||
+          (strcmp( name, "outBegIdx" ) == 0) || (strcmp( name, "outNBElement" ) == 0) )
+      {
+         /* Common to all the functions. */
+      }
+      else if( strncmp( name, "optIn", 5 ) == 0 )
+      {
+         if( func->nbOptInput == MAX_PARAM )
+            return 0;
+         param = &func->optInputs[func->nbOptInput++];
+         if( strcmp( type, "TA_MAType" ) == 0 )
+            strcpy( param->type, "TA_OPTIN_MATYPE" );
+         else if( strcmp( type, "double" ) == 0 )
+            strcpy( param->type, "TA_OPTIN_REAL" );
+         else if( strcmp( type, "int" ) == 0 )
+            strcpy( param->type, "TA_OPTIN_INTEGER" );
+         else
+            return 0;
+      }
+      else if( strncmp( name, "in", 2 ) == 0 )
+      {
+         if( (func->nbInput == MAX_PARAM) || (strcmp( type, "const double" ) != 0) )
+            return 0;
+         param = &func->inputs[func->nbInput++];
+         if( strcmp( name, "inOpen" ) == 0 )
+            strcpy( param->type, "TA_INPUT_OPEN" );
+         else if( strcmp( name, "inHigh" ) == 0 )
+            strcpy( param->type, "TA_INPUT_HIGH" );
+         else if( strcmp( name, "inLow" ) == 0 )
+            strcpy( param->type, "TA_INPUT_LOW" );
+         else if( strcmp( name, "inClose" ) == 0 )
+            strcpy( param->type, "TA_INPUT_CLOSE" );
+         else if( strcmp( name, "inVolume" ) == 0 )
+            strcpy( param->type, "TA_INPUT_VOLUME" );
+         else
+            strcpy( param->type, "TA_INPUT_REAL" );
+      }
+      else if( strncmp( name, "out", 3 ) == 0 )
+      {
+         if( func->nbOutput == MAX_PARAM )
+            return 0;
+         param = &func->outputs[func->nbOutput++];
+         if( strcmp( type, "double" ) == 0 )
+            strcpy( param->type, "TA_OUTPUT_REAL" );
+         else if( strcmp( type, "int" ) == 0 )
+            strcpy( param->type, "TA_OUTPUT_INTEGER" );
+         else
+            return 0;
+      }
+      else
+         return 0;
+
+      if( param )
+         strcpy( param->name, name );
+
+      pos = *end? end+1 : end;
+   }
+
+   return (func->nbInput > 0) && (func->nbOutput > 0);
+}
+
+/* Number of parameters of TA_XXX_Lookback, -1 if not found. */
+static int countLookbackParams( const char *header, const char *name )
+{
+   char prototype[MAX_NAME+32];
+   const char *pos, *end;
+   int nbParam;
+
+   sprintf( prototype, "int TA_%s_Lookback(", name );
+   pos = strstr( header, prototype );
+   end = pos? strstr( pos, ");" ) : NULL;
+   if( !end )
+      return -1;
+
+   pos += strlen( prototype );
+   nbParam = 0;
+   while( (pos = strstr( pos, "optIn" )) != NULL && (pos < end) )
+   {
+      nbParam++;
+      pos += 5;
+   }
+
+   return nbParam;
+}
+
+/* Copy [begin,end[ without the surrounding spaces. */
+static void copyToken( char *dst, int size, const char *begin, const char *end )
+{
+   int len;
+
+   while( (begin < end) && isspace( (unsigned char)*begin ) )
+      begin++;
+   while( (end > begin) && isspace( (unsigned char)end[-1] ) )
+      end--;
+
+   len = (int)(end-begin);
+   if( len > size-1 )
+      len = size-1;
+   memcpy( dst, begin, len );
+   dst[len] = '\0';
+}
+
+static int compareFunc( const void *a, const void *b )
+{
+   return strcmp( ((const FuncDef *)a)->name, ((const FuncDef *)b)->name );
+}
+
+static char *generate( const Registry *registry )
+{
+   const FuncDef *func;
+   char *out;
+   size_t size, used;
+   int i, j, indent, maxOutput;
+
+   size = 256*1024;
+   used = 0;
+   out = (char *)malloc( size );
+   if( !out )
+      return NULL;
+   out[0] = '\0';
+
+   append( &out, &size, &used,
+           "/* Generated by ta_gen_registry from include/ta_func.h, do not edit.\n"
+           " *\n"
+           " * To regenerate: ta_gen_registry <root of the repository>\n"
+           " */\n" );
+
+   for( i=0; out && (i < registry->nbFunc); i++ )
+   {
+      func = &registry->funcs[i];
+
+      append( &out, &size, &used, "\n/* TA_%s */\n", func->name );
+
+      append( &out, &size, &used, "static const TA_InputDef inputs_%s[] = {\n", func->name );
+      for( j=0; j < func->nbInput; j++ )
+         append( &out, &size, &used, "   { %s, \"%s\" }%s\n", func->inputs[j].type,
+                 func->inputs[j].name, j+1 < func->nbInput? "," : "" );
+      append( &out, &size, &used, "};\n" );
+
+      if( func->nbOptInput )
+      {
+         append( &out, &size, &used, "static const TA_OptInputDef optInputs_%s[] = {\n", func->name );
+         for( j=0; j < func->nbOptInput; j++ )
+            append( &out, &size, &used, "   { %s, \"%s\", %s, %s }%s\n",
+                    func->optInputs[j].type, func->optInputs[j].name,
+                    func->optInputs[j].min, func->optInputs[j].max,
+                    j+1 < func->nbOptInput? "," : "" );
+         append( &out, &size, &used, "};\n" );
+      }
+
+      append( &out, &size, &used, "static const TA_OutputDef outputs_%s[] = {\n", func->name );
+      for( j=0; j < func->nbOutput; j++ )
+         append( &out, &size, &used, "   { %s, \"%s\" }%s\n", func->outputs[j].type,
+                 func->outputs[j].name, j+1 < func->nbOutput? "," : "" );
+      append( &out, &size, &used, "};\n\n" );
+
+      /* Lookback wrapper. */
+      append( &out, &size, &used, "static int lookback_%s( const double optIn[] )\n{\n", func->name );
+      if( func->nbOptInput == 0 )
+         append( &out, &size, &used, "   (void)optIn;\n   return TA_%s_Lookback();\n}\n\n", func->name );
+      else
+      {
+         append( &out, &size, &used, "   return TA_%s_Lookback( ", func->name );
+         for( j=0; j < func->nbOptInput; j++ )
+         {
+            append( &out, &size, &used, castOptIn( &func->optInputs[j] ), j );
+            append( &out, &size, &used, j+1 < func->nbOptInput? ", " : " );\n}\n\n" );
+         }
+      }
+
+      /* Call wrapper, counted when built with TA_INSTRUMENT (ta_instr.h). */
+      indent = (int)strlen( func->name );
+      append( &out, &size, &used,
+              "static TA_RetCode call_%s( int startIdx, int endIdx,\n"
+              "%*sconst double *const inputs[], const double optIn[],\n"
+              "%*sint *outBegIdx, int *outNBElement, void *const outputs[] )\n{\n",
+              func->name, indent+25, "", indent+25, "" );
+      append( &out, &size, &used, "   TA_INSTR_PROLOG( %d );\n", i );
+      if( func->nbOptInput == 0 )
+         append( &out, &size, &used, "   (void)optIn;\n" );
+      append( &out, &size, &used, "   TA_INSTR_RETURN( TA_%s( startIdx, endIdx", func->name );
+      for( j=0; j < func->nbInput; j++ )
+         append( &out, &size, &used, ", inputs[%d]", j );
+      for( j=0; j < func->nbOptInput; j++ )
+      {
+         append( &out, &size, &used, ", " );
+         append( &out, &size, &used, castOptIn( &func->optInputs[j] ), j );
+      }
+      append( &out, &size, &used, ",\n%*soutBegIdx, outNBElement", indent+25, "" );
+      for( j=0; j < func->nbOutput; j++ )
+         append( &out, &size, &used, ", (%s *)outputs[%d]",
+                 strcmp( func->outputs[j].type, "TA_OUTPUT_REAL" ) == 0? "double" : "int", j );
+      append( &out, &size, &used, " ) );\n}\n" );
+   }
+
+   append( &out, &size, &used, "\nstatic const TA_FuncDef funcTable[] = {\n" );
+   maxOutput = 0;
+   for( i=0; out && (i < registry->nbFunc); i++ )
+   {
+      func = &registry->funcs[i];
+      if( func->nbOutput > maxOutput )
+         maxOutput = func->nbOutput;
+      append( &out, &size, &used, "   { \"%s\", \"%s\",\n", func->name, func->hint );
+      append( &out, &size, &used, "     %d, inputs_%s, ", func->nbInput, func->name );
+      if( func->nbOptInput )
+         append( &out, &size, &used, "%d, optInputs_%s, ", func->nbOptInput, func->name );
+      else
+         append( &out, &size, &used, "0, NULL, " );
+      append( &out, &size, &used, "%d, outputs_%s,\n", func->nbOutput, func->name );
+      if( func->isUnstable )
+         append( &out, &size, &used, "     TA_FUNC_UNST_%s, ", func->name );
+      else
+         append( &out, &size, &used, "     TA_FUNC_UNST_NONE, " );
+      append( &out, &size, &used, "lookback_%s, call_%s }%s\n", func->name, func->name,
+              i+1 < registry->nbFunc? "," : "" );
+   }
+   append( &out, &size, &used, "};\n" );
+
+   /* Bound of the arrays of outputs kept by the registry. */
+   append( &out, &size, &used,
+           "\n/* The most outputs of a function of the table. */\n"
+           "#define FUNC_MAX_OUTPUT %d\n", maxOutput );
+
+   return out;
+}
+
+/* Format of the conversion from the double array to the type
+ * of the optional parameter.
+ */
+static const char *castOptIn( const ParamDef *param )
+{
+   if( strcmp( param->type, "TA_OPTIN_INTEGER" ) == 0 )
+      return "(int)optIn[%d]";
+   if( strcmp( param->type, "TA_OPTIN_MATYPE" ) == 0 )
+      return "(TA_MAType)(int)optIn[%d]";
+   return "optIn[%d]";
+}
+
+/* printf at the end of a growing buffer. 'out' becomes NULL
+ * when out of memory.
+ */
+static void append( char **out, size_t *size, size_t *used, const char *format, ... )
+{
+   va_list args;
+   char *newOut;
+   int len;
+
+   if( !*out )
+      return;
+
+   while( 1 )
+   {
+      va_start( args, format );
+      len = vsnprintf( *out+*used, *size-*used, format, args );
+      va_end( args );
+
+      if( (len >= 0) && ((size_t)len < *size-*used) )
+      {
+         *used += len;
+         return;
+      }
+
+      newOut = (char *)realloc( *out, *size*2 );
+      if( !newOut )
+      {
+         free( *out );
+         *out = NULL;
+         return;
+      }
+      *out = newOut;
+      *size *= 2;
+   }
+}
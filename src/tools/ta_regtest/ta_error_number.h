@@ -32,6 +32,8 @@ typedef enum
   TA_REGTEST_HISTORYALLOC_19          = 24,
   TA_REGTEST_ADDDSOURCE_FAILED        = 25,
   TA_REGTEST_OPTIMIZATION_REF_ERROR   = 26,
+  TA_REGTEST_SHARD_FAILED             = 27,
+  TA_REGTEST_RESULTS_FILE_ERROR       = 28,
 
   /* Error code for test in test_util.c */
   TA_TESTUTIL_INIT_FAILED             = 101,
@@ -236,6 +238,11 @@ typedef enum
   TA_INTERNAL_TIMESTAMP_TEST_FAILED = 709,
   TA_INTERNAL_PSEUDORANDOM_UINT32   = 710,
   TA_INTERNAL_PSEUDORANDOM_DOUBLE   = 711,
+  TA_INTERNAL_COLFILE_WRITE_FAIL    = 712,
+  TA_INTERNAL_COLFILE_OPEN_FAIL     = 713,
+  TA_INTERNAL_COLFILE_BAD_CONTENT   = 714,
+  TA_INTERNAL_COLFILE_BAD_ALIGNMENT = 715,
+  TA_INTERNAL_COLFILE_BAD_OFFSET    = 716,
 
   /* Error code related to CSI data source tests. */
   TA_CSI_ADDDATASOURCE_FAILED    = 800,
@@ -272,6 +279,123 @@ typedef enum
   TA_TSTMERGE_ASCII_BAD_PATTERN_CLOSE = 1018,
   TA_TSTMERGE_ASCII_BAD_PATTERN_TS    = 1019,  
 
+  /* Error code related to the streaming functions. */
+  TA_STREAM_TST_INIT_FAIL           = 800,
+  TA_STREAM_TST_UPDATE_FAIL         = 801,
+  TA_STREAM_TST_BATCH_FAIL          = 802,
+  TA_STREAM_TST_BEG_IDX             = 803,
+  TA_STREAM_TST_NB_ELEMENT          = 804,
+  TA_STREAM_TST_VALUE               = 805,
+  TA_STREAM_TST_RESAMPLER_FAIL      = 806,
+  TA_STREAM_TST_BAD_BAR             = 807,
+  TA_STREAM_TST_PARSE_FAIL          = 808,
+  TA_STREAM_TST_SNAPSHOT            = 809,
+  TA_STREAM_TST_BLOCKED             = 810,
+
+  /* Error code related to the indicator graph. */
+  TA_GRAPH_TST_ALLOC_FAIL           = 820,
+  TA_GRAPH_TST_ADD_FAIL             = 821,
+  TA_GRAPH_TST_COMPUTE_FAIL         = 822,
+  TA_GRAPH_TST_FUNC_FAIL            = 823,
+  TA_GRAPH_TST_GET_FAIL             = 824,
+  TA_GRAPH_TST_BEG_IDX              = 825,
+  TA_GRAPH_TST_NB_ELEMENT           = 826,
+  TA_GRAPH_TST_VALUE                = 827,
+  TA_GRAPH_TST_SHARING              = 828,
+  TA_GRAPH_TST_BAD_PARAM            = 829,
+
+  /* Error code related to the function registry. */
+  TA_REGISTRY_TST_LOOKUP            = 840,
+  TA_REGISTRY_TST_DEF               = 841,
+  TA_REGISTRY_TST_LOOKBACK          = 842,
+  TA_REGISTRY_TST_CALL_FAIL         = 843,
+  TA_REGISTRY_TST_BAD_PARAM         = 844,
+  TA_REGISTRY_TST_DIRECT            = 845,
+  TA_REGISTRY_TST_SIZE              = 846,
+  TA_REGISTRY_TST_INPLACE           = 847,
+
+  /* Error code related to the correlation matrix. */
+  TA_MATRIX_TST_CALL_FAIL           = 860,
+  TA_MATRIX_TST_CORREL              = 861,
+  TA_MATRIX_TST_COVAR               = 862,
+  TA_MATRIX_TST_BETA                = 863,
+  TA_MATRIX_TST_BAD_PARAM           = 864,
+
+  /* Error code related to MEDIAN, QUANTILE and PCTRANK. */
+  TA_QUANTILE_TST_CALL_FAIL         = 880,
+  TA_QUANTILE_TST_BEG_IDX           = 881,
+  TA_QUANTILE_TST_VALUE             = 882,
+  TA_QUANTILE_TST_NAN               = 883,
+  TA_QUANTILE_TST_BAD_PARAM         = 884,
+
+  /* Error code related to TA_PRECISION_COMPENSATED. */
+  TA_PRECISION_TST_SETTING          = 900,
+  TA_PRECISION_TST_CALL_FAIL        = 901,
+  TA_PRECISION_TST_HISTORY          = 902,
+  TA_PRECISION_TST_INPLACE          = 903,
+  TA_PRECISION_TST_STREAM           = 904,
+  TA_PRECISION_TST_ALLOC            = 905,
+  TA_PRECISION_TST_BOUND            = 906,
+  TA_PRECISION_TST_PREFIX           = 907,
+
+  /* Error code related to TA_MAFused. */
+  TA_MAFUSED_TST_CALL_FAIL          = 920,
+  TA_MAFUSED_TST_BEG_IDX            = 921,
+  TA_MAFUSED_TST_VALUE              = 922,
+  TA_MAFUSED_TST_BAD_PARAM          = 923,
+
+  /* Error code related to TA_FuncTail. */
+  TA_TAIL_TST_CALL_FAIL             = 940,
+  TA_TAIL_TST_UNSTABLE              = 941,
+  TA_TAIL_TST_BEG_IDX               = 942,
+  TA_TAIL_TST_VALUE                 = 943,
+  TA_TAIL_TST_BAD_PARAM             = 944,
+  TA_TAIL_TST_MODE                  = 945,
+
+  /* Error code related to the allocator hooks. */
+  TA_ALLOC_TST_BAD_PARAM            = 960,
+  TA_ALLOC_TST_CALL_FAIL            = 961,
+  TA_ALLOC_TST_STEADY               = 962,
+  TA_ALLOC_TST_HOOK                 = 963,
+  TA_ALLOC_TST_FAILURE              = 964,
+
+  /* Error code related to the instrumentation. */
+  TA_INSTR_TST_EXPORT               = 980,
+  TA_INSTR_TST_MERGE                = 981,
+  TA_INSTR_TST_DISABLED             = 982,
+  TA_INSTR_TST_CALL_FAIL            = 983,
+  TA_INSTR_TST_COUNT                = 984,
+
+  /* Error code related to the panel functions. */
+  TA_PANEL_TST_CALL_FAIL            = 1040,
+  TA_PANEL_TST_BEG_IDX              = 1041,
+  TA_PANEL_TST_VALUE                = 1042,
+  TA_PANEL_TST_INPLACE              = 1043,
+  TA_PANEL_TST_BAD_PARAM            = 1044,
+
+  /* Error code related to the Arrow adapters. */
+  TA_ARROW_TST_CALL_FAIL            = 1060,
+  TA_ARROW_TST_VALUE                = 1061,
+  TA_ARROW_TST_VALIDITY             = 1062,
+  TA_ARROW_TST_CHUNK                = 1063,
+  TA_ARROW_TST_BAD_PARAM            = 1064,
+  TA_ARROW_TST_ALLOC                = 1065,
+
+  /* Error code related to the missing bars. */
+  TA_MISSING_TST_CALL_FAIL          = 1080,
+  TA_MISSING_TST_RANGE              = 1081,
+  TA_MISSING_TST_VALUE              = 1082,
+  TA_MISSING_TST_VALIDITY           = 1083,
+  TA_MISSING_TST_BAD_PARAM          = 1084,
+
+  /* Error code related to MOMENTS, ZSCORE, SKEW and KURT. */
+  TA_MOMENTS_TST_CALL_FAIL          = 1100,
+  TA_MOMENTS_TST_BEG_IDX            = 1101,
+  TA_MOMENTS_TST_VALUE              = 1102,
+  TA_MOMENTS_TST_NAN                = 1103,
+  TA_MOMENTS_TST_SAME               = 1104,
+  TA_MOMENTS_TST_BAD_PARAM          = 1105,
+
   /* Error code related to bug fix documentented on SourceForge. */
   TA_TEST_FAIL_BUG1359452_1  = 2000,
   TA_TEST_FAIL_BUG1359452_2  = 2001,
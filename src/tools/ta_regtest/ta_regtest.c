@@ -1,17 +1,56 @@
 /**** Headers ****/
+#if defined(_MSC_VER)
+   #define _CRT_SECURE_NO_WARNINGS
+#else
+   /* popen() and pclose() are POSIX, not declared by a strict -std=c17. */
+   #define _POSIX_C_SOURCE 200809L
+#endif
+
 #ifdef _WIN32
    #include "windows.h"
+   #define popen  _popen
+   #define pclose _pclose
+#else
+   #include <unistd.h>
+   #include <sys/wait.h>
 #endif
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <ctype.h>
 #include <time.h>
 
 #include "ta_test_priv.h"
 #include "ta_test_func.h"
 #include "ta_utility.h"
 
+/**** Local declarations.              ****/
+#define MAX_NB_JOBS      256
+#define MAX_COMMAND_SIZE 1024
+#define MAX_LINE_SIZE    512
+
+typedef ErrorNumber (*TestFunction)( TA_History *history );
+
+typedef struct
+{
+   TestFunction function;
+   const char  *name;          /* Like "test_func_rsi". */
+   const char  *description;   /* Like "RSI,CMO". */
+   int          isRangeTested; /* Uses doRangeTest, split by fixSize between the shards. */
+} TestGroup;
+
+#define TEST_GROUP(func,str,range) { func, #func, str, range }
+
+typedef struct
+{
+   const char *filter;  /* --filter, NULL for all the groups. */
+   const char *results; /* --results, NULL for no file. */
+   int nbJobs;          /* --jobs, processes started by this one. */
+   int shardIdx;        /* --shard shardIdx/nbShards */
+   int nbShards;
+} RegTestOptions;
+
 /**** Global variables definitions.    ****/
 int nbProfiledCall;
 double timeInProfiledCall;
@@ -19,10 +58,62 @@ double worstProfiledCall;
 int insufficientClockPrecision;
 
 /**** Local functions declarations.    ****/
-static ErrorNumber testTAFunction_ALL( void );
-static ErrorNumber test_with_simulator( void );
+static ErrorNumber testTAFunction_ALL( const RegTestOptions *options, FILE *results );
+static ErrorNumber test_with_simulator( const RegTestOptions *options, FILE *results );
+static ErrorNumber runTestGroup( const TestGroup *group, int slice, int nbSlice,
+                                 TA_History *history, FILE *results );
+static ErrorNumber runJobs( const char *program, const RegTestOptions *options );
+static ErrorNumber mergeResults( FILE *out, const char *fileName, int *isFailed );
+static int parseOptions( int argc, char **argv, RegTestOptions *options );
+static int isSelected( const TestGroup *group, const char *filter );
+static int isSameName( const char *str, int length, const char *filter );
+static int nbProcessors( void );
 static void printUsage(void);
 
+/**** Local variables definitions.     ****/
+
+/* Each group of tests, in the order they are executed. */
+static const TestGroup testGroups[] =
+{
+   TEST_GROUP( test_func_1in_1out, "MATH,VECTOR,DCPERIOD/PHASE,TRENDLINE/MODE", 1 ),
+   TEST_GROUP( test_func_1in_2out, "PHASOR,SINE", 1 ),
+   TEST_GROUP( test_func_adx,      "ADX,ADXR,DI,DM,DX", 1 ),
+   TEST_GROUP( test_func_alloc,    "Allocator hooks", 0 ),
+   TEST_GROUP( test_func_arrow,    "Arrow C data interface", 0 ),
+   TEST_GROUP( test_func_avgdev,   "AVGDEV", 1 ),
+   TEST_GROUP( test_func_bbands,   "BBANDS", 1 ),
+   TEST_GROUP( test_func_imi,      "IMI", 0 ),
+   TEST_GROUP( test_func_instr,    "Instrumentation", 0 ),
+   TEST_GROUP( test_func_graph,    "Indicator graph", 0 ),
+   TEST_GROUP( test_func_ma,       "All Moving Averages", 1 ),
+   TEST_GROUP( test_func_ma_fused, "Fused moving averages", 0 ),
+   TEST_GROUP( test_func_macd,     "MACD,MACDFIX,MACDEXT", 1 ),
+   TEST_GROUP( test_func_matrix,   "Correlation matrix, beta vector", 0 ),
+   TEST_GROUP( test_func_minmax,   "MIN,MAX,MININDEX,MAXINDEX,MINMAX,MINMAXINDEX", 1 ),
+   TEST_GROUP( test_func_missing,  "Missing bars policies", 0 ),
+   TEST_GROUP( test_func_mom_roc,  "MOM,ROC,ROCP,ROCR,ROCR100", 1 ),
+   TEST_GROUP( test_func_moments,  "MOMENTS,ZSCORE,SKEW,KURT", 0 ),
+   TEST_GROUP( test_func_panel,    "EMA,RSI,ATR,KAMA,T3 of a panel", 0 ),
+   TEST_GROUP( test_func_per_ema,  "TRIX", 1 ),
+   TEST_GROUP( test_func_per_hl,   "AROON,CORREL,BETA", 1 ),
+   TEST_GROUP( test_func_per_hlc,  "CCI,WILLR,ULTOSC,NATR", 1 ),
+   TEST_GROUP( test_func_per_hlcv, "MFI,AD,ADOSC", 1 ),
+   TEST_GROUP( test_func_per_ohlc, "BOP,AVGPRICE", 1 ),
+   TEST_GROUP( test_func_po,       "PO,APO", 1 ),
+   TEST_GROUP( test_func_precision, "Compensated running sums", 0 ),
+   TEST_GROUP( test_func_quantile, "MEDIAN,QUANTILE,PCTRANK", 0 ),
+   TEST_GROUP( test_func_registry, "Function registry", 0 ),
+   TEST_GROUP( test_func_rsi,      "RSI,CMO", 1 ),
+   TEST_GROUP( test_func_sar,      "SAR,SAREXT", 0 ),
+   TEST_GROUP( test_func_stddev,   "STDDEV,VAR", 1 ),
+   TEST_GROUP( test_func_stoch,    "STOCH,STOCHF,STOCHRSI", 1 ),
+   TEST_GROUP( test_func_stream,   "Streaming SMA,EMA,RSI,ATR,ADX,KAMA,MAMA", 0 ),
+   TEST_GROUP( test_func_tail,     "Tail mode of all functions", 0 ),
+   TEST_GROUP( test_func_trange,   "TRANGE,ATR", 1 ),
+};
+
+#define NB_TEST_GROUP ((int)(sizeof(testGroups)/sizeof(TestGroup)))
+
 /**** Global functions definitions.   ****/
 int main( int argc, char **argv )
 {
@@ -32,37 +123,79 @@ int main( int argc, char **argv )
    double freq;
 
    ErrorNumber retValue;
-
-   (void)argv;
+   RegTestOptions options;
+   FILE *results;
+   int i;
 
    insufficientClockPrecision = 0;
    timeInProfiledCall = 0.0;
    worstProfiledCall = 0.0;
    nbProfiledCall = 0;
 
-   printf( "\n" );
-   printf( "ta_regtest V%s - Regression Tests of TA-Lib code\n", TA_GetVersionString() );
-   printf( "\n" );
-
-   if ( argc > 1 )
+   if ( !parseOptions( argc, argv, &options ) )
    {
       printUsage();
       return TA_REGTEST_BAD_USER_PARAM;
    }
 
+   if ( options.nbShards == 1 )
+   {
+      printf( "\n" );
+      printf( "ta_regtest V%s - Regression Tests of TA-Lib code\n", TA_GetVersionString() );
+      printf( "\n" );
+   }
+
+   for ( i=0; i < NB_TEST_GROUP; i++ )
+   {
+      if ( isSelected( &testGroups[i], options.filter ) )
+         break;
+   }
+   if ( i == NB_TEST_GROUP )
+   {
+      printf( "No test matching \"%s\"\n", options.filter );
+      return TA_REGTEST_BAD_USER_PARAM;
+   }
+
+   /* The tests are executed by other ta_regtest processes. */
+   if ( options.nbJobs > 1 )
+   {
+      retValue = runJobs( argv[0], &options );
+      if ( retValue != TA_TEST_PASS )
+         return retValue;
+      printf( "\n* All tests succeeded. Enjoy the library. *\n" );
+      return TA_TEST_PASS;
+   }
+
+   results = NULL;
+   if ( options.results )
+   {
+      results = fopen( options.results, "w" );
+      if ( !results )
+      {
+         printf( "Cannot create \"%s\"\n", options.results );
+         return TA_REGTEST_RESULTS_FILE_ERROR;
+      }
+      fprintf( results, "group,slice,nbSlice,result,errorNumber,milliseconds\n" );
+   }
+
    /* Some tests are using randomness. */ 
-   srand( (unsigned)time( NULL ) );
+   srand( (unsigned)time( NULL ) + (unsigned)options.shardIdx );
 
    /* Test utility like Circular buffer etc... */
-   retValue = test_internals();
-   if ( retValue != TA_TEST_PASS )
+   retValue = TA_TEST_PASS;
+   if ( options.shardIdx == 0 )
    {
-      printf( "\nFailed an internal test with code=%d\n", retValue );
-      return retValue;
+      retValue = test_internals();
+      if ( retValue != TA_TEST_PASS )
+         printf( "\nFailed an internal test with code=%d\n", retValue );
    }
 
    /* Perform all regresstions tests. */
-   retValue = test_with_simulator();
+   if ( retValue == TA_TEST_PASS )
+      retValue = test_with_simulator( &options, results );
+
+   if ( results )
+      fclose( results );
    if ( retValue != TA_TEST_PASS )
       return retValue;
 
@@ -87,13 +220,17 @@ int main( int argc, char **argv )
       printf( "\nAverage execution time per function = %g microseconds\n", (timeInProfiledCall/freq/1000000.0)/((double)nbProfiledCall) );
 #endif	  
    }   
-   printf( "\n* All tests succeeded. Enjoy the library. *\n" );
+
+   if ( options.nbShards > 1 )
+      printf( "\n* Shard %d/%d succeeded. *\n", options.shardIdx, options.nbShards );
+   else
+      printf( "\n* All tests succeeded. Enjoy the library. *\n" );
 
    return TA_TEST_PASS; /* Everything succeed !!! */
 }
 
 /**** Local functions definitions.     ****/
-static ErrorNumber test_with_simulator( void )
+static ErrorNumber test_with_simulator( const RegTestOptions *options, FILE *results )
 {
    ErrorNumber retValue;
 
@@ -103,7 +240,7 @@ static ErrorNumber test_with_simulator( void )
       return retValue;
 
    /* Perform testing of each of the TA Functions. */
-   retValue = testTAFunction_ALL();
+   retValue = testTAFunction_ALL( options, results );
    if ( retValue != TA_TEST_PASS )
    {
       return retValue;
@@ -124,10 +261,11 @@ extern double      TA_SREF_low_daily_ref_0_PRIV[];
 extern double      TA_SREF_close_daily_ref_0_PRIV[];
 extern double      TA_SREF_volume_daily_ref_0_PRIV[];
 
-static ErrorNumber testTAFunction_ALL( void )
+static ErrorNumber testTAFunction_ALL( const RegTestOptions *options, FILE *results )
 {
    ErrorNumber retValue;
    TA_History history;
+   int i, slice, nbSlice, itemIdx;
 
    history.nbBars = 252;
    history.open   = TA_SREF_open_daily_ref_0_PRIV;
@@ -140,53 +278,308 @@ static ErrorNumber testTAFunction_ALL( void )
 
    initGlobalBuffer();
 
-   /* Make tests for each TA functions. */
-   #define DO_TEST(func,str) \
-      { \
-      printf( "%50s: Testing....", str ); \
-      fflush(stdout); \
-      showFeedback(); \
-      TA_SetCompatibility( TA_COMPATIBILITY_DEFAULT ); \
-      retValue = func( &history ); \
-      if ( retValue != TA_TEST_PASS ) \
-         return retValue; \
-      hideFeedback(); \
-      printf( "done.\n" ); \
-      fflush(stdout); \
+   /* Make tests for each TA functions.
+    *
+    * The range tests of a group are split in one slice per shard,
+    * the other groups are a single item. The items are distributed
+    * round-robin between the shards, so each shard gets about the
+    * same part of the work.
+    */
+   itemIdx = 0;
+   for ( i=0; i < NB_TEST_GROUP; i++ )
+   {
+      if ( !isSelected( &testGroups[i], options->filter ) )
+         continue;
+
+      nbSlice = testGroups[i].isRangeTested? options->nbShards : 1;
+      for ( slice=0; slice < nbSlice; slice++, itemIdx++ )
+      {
+         if ( (itemIdx % options->nbShards) != options->shardIdx )
+            continue;
+
+         retValue = runTestGroup( &testGroups[i], slice, nbSlice, &history, results );
+         if ( retValue != TA_TEST_PASS )
+            return retValue;
       }
+   }
+
+   return TA_TEST_PASS; /* All tests succeeded. */
+}
+
+/* Execute one slice of a group, with the default settings. */
+static ErrorNumber runTestGroup( const TestGroup *group, int slice, int nbSlice,
+                                 TA_History *history, FILE *results )
+{
+   ErrorNumber retValue;
+   char label[MAX_LINE_SIZE];
+   clock_t start;
+
+   if ( nbSlice > 1 )
+      sprintf( label, "%.400s [%d/%d]", group->description, slice+1, nbSlice );
+   else
+      sprintf( label, "%.400s", group->description );
+
+   printf( "%50s: Testing....", label );
+   fflush(stdout);
+   showFeedback();
+
+   TA_SetCompatibility( TA_COMPATIBILITY_DEFAULT );
+   TA_SetPrecision( TA_PRECISION_DEFAULT );
+   setRangeSlice( slice, nbSlice );
+   start = clock();
+   retValue = group->function( history );
+   setRangeSlice( 0, 1 );
+
+   if ( results )
+   {
+      fprintf( results, "%s,%d,%d,%s,%d,%.0f\n", group->name, slice, nbSlice,
+               retValue == TA_TEST_PASS? "pass" : "fail", retValue,
+               ((double)(clock()-start)*1000.0)/(double)CLOCKS_PER_SEC );
+      fflush( results );
+   }
+
+   if ( retValue != TA_TEST_PASS )
+      return retValue;
+
+   hideFeedback();
+   printf( "done.\n" );
+   fflush(stdout);
+
+   return TA_TEST_PASS;
+}
+
+/* Start options->nbJobs ta_regtest processes, each executing one shard,
+ * and wait for all of them. The output of each shard is printed when it
+ * is done. Returns the error of the first failed test, in the order
+ * of the groups.
+ *
+ * The TA-Lib settings (unstable periods, compatibility...) are global
+ * to a process and changed by many tests, so the shards cannot be
+ * threads of the same process.
+ */
+static ErrorNumber runJobs( const char *program, const RegTestOptions *options )
+{
+   FILE *jobs[MAX_NB_JOBS];
+   FILE *out;
+   char command[MAX_COMMAND_SIZE];
+   char fileName[MAX_COMMAND_SIZE];
+   char line[MAX_LINE_SIZE];
+   const char *results;
+   ErrorNumber retValue, shardError;
+   int i, status, isFailed;
+
+   printf( "Testing with %d processes\n", options->nbJobs );
+   fflush(stdout);
+
+   /* Each shard writes its results in its own file, merged at the end. */
+   results = options->results? options->results : "ta_regtest_results.csv";
 
-#if 0
-   DO_TEST( test_func_1in_1out, "MATH,VECTOR,DCPERIOD/PHASE,TRENDLINE/MODE" );
-   DO_TEST( test_func_1in_2out, "PHASOR,SINE" );
-   DO_TEST( test_func_adx,      "ADX,ADXR,DI,DM,DX" );
-   DO_TEST( test_func_avgdev,   "AVGDEV" );
-   DO_TEST( test_func_bbands,   "BBANDS" );
-   DO_TEST( test_func_imi,      "IMI" );
-   DO_TEST( test_func_ma,       "All Moving Averages" );
-   DO_TEST( test_func_macd,     "MACD,MACDFIX,MACDEXT" );
-   DO_TEST( test_func_minmax,   "MIN,MAX,MININDEX,MAXINDEX,MINMAX,MINMAXINDEX" );
-   DO_TEST( test_func_mom_roc,  "MOM,ROC,ROCP,ROCR,ROCR100" );
-   DO_TEST( test_func_per_ema,  "TRIX" );
-   DO_TEST( test_func_per_hl,   "AROON,CORREL,BETA" );
-   DO_TEST( test_func_per_hlc,  "CCI,WILLR,ULTOSC,NATR" );
-   DO_TEST( test_func_per_hlcv, "MFI,AD,ADOSC" );
-   DO_TEST( test_func_per_ohlc, "BOP,AVGPRICE" );
-   DO_TEST( test_func_po,       "PO,APO" );
-   DO_TEST( test_func_rsi,      "RSI,CMO" );
-   DO_TEST( test_func_sar,      "SAR,SAREXT" );
-   DO_TEST( test_func_stddev,   "STDDEV,VAR" );
-   DO_TEST( test_func_stoch,    "STOCH,STOCHF,STOCHRSI" );
-   DO_TEST( test_func_trange,   "TRANGE,ATR" );
+   for ( i=0; i < options->nbJobs; i++ )
+   {
+      /* cmd.exe removes the first and last quotes of the command. */
+      sprintf( command,
+#ifdef _WIN32
+               "\"\"%.400s\" --shard %d/%d --results \"%.400s.%d\"%s%.100s%s\"",
 #else
-   DO_TEST(test_func_debug, "DEBUG");
+               "\"%.400s\" --shard %d/%d --results \"%.400s.%d\"%s%.100s%s",
 #endif
+               program, i, options->nbJobs, results, i,
+               options->filter? " --filter \"" : "",
+               options->filter? options->filter : "",
+               options->filter? "\"" : "" );
+      jobs[i] = popen( command, "r" );
+      if ( !jobs[i] )
+      {
+         printf( "Cannot start \"%s\"\n", command );
+         while ( i-- > 0 )
+            pclose( jobs[i] );
+         return TA_REGTEST_SHARD_FAILED;
+      }
+   }
 
-   return TA_TEST_PASS; /* All tests succeeded. */
+   out = NULL;
+   if ( options->results )
+   {
+      out = fopen( options->results, "w" );
+      if ( out )
+         fprintf( out, "group,slice,nbSlice,result,errorNumber,milliseconds\n" );
+   }
+
+   retValue = TA_TEST_PASS;
+   for ( i=0; i < options->nbJobs; i++ )
+   {
+      printf( "\n---- Shard %d/%d ----\n", i, options->nbJobs );
+      while ( fgets( line, sizeof(line), jobs[i] ) )
+         fputs( line, stdout );
+      fflush(stdout);
+
+      status = pclose( jobs[i] );
+#ifndef _WIN32
+      status = WIFEXITED(status)? WEXITSTATUS(status) : -1;
+#endif
+
+      /* The exit code of a process can be truncated, the error
+       * number is taken from the results of the shard.
+       */
+      sprintf( fileName, "%.400s.%d", results, i );
+      shardError = mergeResults( out, fileName, &isFailed );
+      remove( fileName );
+
+      if ( (shardError == TA_TEST_PASS) && ((status != 0) || isFailed) )
+         shardError = TA_REGTEST_SHARD_FAILED;
+      if ( (shardError != TA_TEST_PASS) && (retValue == TA_TEST_PASS) )
+         retValue = shardError;
+   }
+
+   if ( out )
+      fclose( out );
+   else if ( options->results )
+   {
+      printf( "Cannot create \"%s\"\n", options->results );
+      if ( retValue == TA_TEST_PASS )
+         retValue = TA_REGTEST_RESULTS_FILE_ERROR;
+   }
+
+   if ( retValue != TA_TEST_PASS )
+      printf( "\nFailed with code=%d\n", retValue );
+
+   return retValue;
+}
+
+/* Copy the results of a shard (without its header) in 'out', which
+ * can be NULL. Returns the error number of the failed test if any.
+ * isFailed is set when the file is missing or incomplete.
+ */
+static ErrorNumber mergeResults( FILE *out, const char *fileName, int *isFailed )
+{
+   FILE *in;
+   char line[MAX_LINE_SIZE];
+   char result[16];
+   int errorNumber, isHeader;
+   ErrorNumber retValue;
+
+   *isFailed = 1;
+   in = fopen( fileName, "r" );
+   if ( !in )
+      return TA_TEST_PASS;
+
+   *isFailed = 0;
+   retValue  = TA_TEST_PASS;
+   for ( isHeader=1; fgets( line, sizeof(line), in ); isHeader=0 )
+   {
+      if ( isHeader )
+         continue;
+      if ( out )
+         fputs( line, out );
+      if ( sscanf( line, "%*[^,],%*d,%*d,%15[^,],%d", result, &errorNumber ) != 2 )
+         *isFailed = 1;
+      else if ( (errorNumber != TA_TEST_PASS) && (retValue == TA_TEST_PASS) )
+         retValue = (ErrorNumber)errorNumber;
+   }
+
+   fclose( in );
+   return retValue;
+}
+
+/* Returns 0 when the command line is invalid. */
+static int parseOptions( int argc, char **argv, RegTestOptions *options )
+{
+   int i;
+
+   memset( options, 0, sizeof(RegTestOptions) );
+   options->nbJobs   = 1;
+   options->nbShards = 1;
+
+   for ( i=1; i < argc; i++ )
+   {
+      if ( i+1 == argc )
+         return 0;
+
+      if ( strcmp( argv[i], "--filter" ) == 0 )
+         options->filter = argv[++i];
+      else if ( strcmp( argv[i], "--results" ) == 0 )
+         options->results = argv[++i];
+      else if ( strcmp( argv[i], "--jobs" ) == 0 )
+      {
+         options->nbJobs = atoi( argv[++i] );
+         if ( options->nbJobs <= 0 )
+            options->nbJobs = nbProcessors();
+         if ( options->nbJobs > MAX_NB_JOBS )
+            options->nbJobs = MAX_NB_JOBS;
+      }
+      else if ( strcmp( argv[i], "--shard" ) == 0 )
+      {
+         if ( sscanf( argv[++i], "%d/%d", &options->shardIdx, &options->nbShards ) != 2 )
+            return 0;
+         if ( (options->nbShards <= 0) || (options->shardIdx < 0) || (options->shardIdx >= options->nbShards) )
+            return 0;
+      }
+      else
+         return 0;
+   }
+
+   /* A shard does not start other processes. */
+   return (options->nbShards == 1) || (options->nbJobs == 1);
+}
+
+/* A group is selected by the name of its test function (with or
+ * without "test_func_"), or by one of the names of its description
+ * (like "RSI" for "RSI,CMO"). The case is ignored.
+ */
+static int isSelected( const TestGroup *group, const char *filter )
+{
+   const char *str, *end;
+
+   if ( !filter )
+      return 1;
+
+   if ( isSameName( group->name, (int)strlen(group->name), filter ) ||
+        isSameName( group->name+10, (int)strlen(group->name+10), filter ) )
+      return 1;
+
+   for ( str=group->description; *str; str=end )
+   {
+      while ( *str && strchr( ",/ ", *str ) )
+         str++;
+      for ( end=str; *end && !strchr( ",/ ", *end ); end++ );
+      if ( (end != str) && isSameName( str, (int)(end-str), filter ) )
+         return 1;
+   }
+
+   return 0;
+}
+
+static int isSameName( const char *str, int length, const char *filter )
+{
+   int i;
+
+   for ( i=0; i < length; i++ )
+   {
+      if ( toupper( (unsigned char)str[i] ) != toupper( (unsigned char)filter[i] ) )
+         return 0;
+   }
+
+   return filter[length] == '\0';
+}
+
+static int nbProcessors( void )
+{
+#ifdef _WIN32
+   SYSTEM_INFO info;
+
+   GetSystemInfo( &info );
+   return (int)info.dwNumberOfProcessors;
+#else
+   long nb;
+
+   nb = sysconf( _SC_NPROCESSORS_ONLN );
+   return nb > 0? (int)nb : 1;
+#endif
 }
 
 static void printUsage(void)
 {
-      printf( "Usage: ta_regtest \n" );
+      printf( "Usage: ta_regtest [--filter <name>] [--jobs <n>] [--results <file>]\n" );
       printf( "\n" );
       printf( "   No parameter needed for regression testing.\n" );
       printf( "\n" );
@@ -194,6 +587,15 @@ static void printUsage(void)
       printf( "   make sure that the library is behaving as\n" );
       printf( "   expected.\n");
 	   printf( "\n" );
+      printf( "   --filter <name>  Only the tests of this function, like RSI\n" );
+      printf( "                    (or a test group, like test_func_rsi).\n" );
+      printf( "   --jobs <n>       Split the tests between n processes,\n" );
+      printf( "                    0 for one per processor.\n" );
+      printf( "   --results <file> Write the result of each test in a CSV\n" );
+      printf( "                    file (group,slice,nbSlice,result,\n" );
+      printf( "                    errorNumber,milliseconds).\n" );
+      printf( "   --shard <k>/<n>  Only the part k of n (used by --jobs).\n" );
+      printf( "\n" );
       printf( "   ** Must be run from the 'bin' directory.\n" );
       printf( "\n" );
       printf( "   On success, the exit code is 0.\n" );
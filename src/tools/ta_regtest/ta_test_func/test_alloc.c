@@ -0,0 +1,233 @@
+/* Description:
+ *     Test the allocator hooks (TA_SetAllocator). A counting allocator
+ *     verifies that the temporary arrays, the large circular buffers
+ *     and the streaming states go through the hooks, and that the
+ *     calls done at each new bar do not allocate.
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ta_test_priv.h"
+#include "ta_test_func.h"
+#include "ta_utility.h"
+#include "ta_stream.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+typedef struct
+{
+   int nbAlloc;
+   int nbRealloc;
+   int nbFree;
+   int failing; /* When set, all the allocations fail. */
+} TA_CountingArena;
+
+/**** Local functions declarations.    ****/
+static void *countingAlloc( void *userData, size_t size );
+static void *countingRealloc( void *userData, void *ptr, size_t size );
+static void  countingFree( void *userData, void *ptr );
+static ErrorNumber checkCounters( const TA_CountingArena *arena,
+                                  int minAlloc, int maxAlloc );
+static ErrorNumber testFunctions( const TA_History *history, TA_CountingArena *arena );
+static ErrorNumber testStream( const TA_History *history, TA_CountingArena *arena );
+
+/**** Local variables definitions.     ****/
+static double output[MAX_NB_TEST_ELEMENT];
+
+/**** Global functions definitions.   ****/
+ErrorNumber test_func_alloc( TA_History *history )
+{
+   ErrorNumber retValue;
+   TA_CountingArena arena;
+   TA_Allocator allocator;
+   TA_StreamState state;
+
+   memset( &arena, 0, sizeof(arena) );
+   allocator.alloc    = countingAlloc;
+   allocator.realloc  = countingRealloc;
+   allocator.free     = countingFree;
+   allocator.userData = &arena;
+
+   /* All the function pointers are needed. */
+   allocator.free = NULL;
+   if( TA_SetAllocator( &allocator ) != TA_BAD_PARAM )
+      return TA_ALLOC_TST_BAD_PARAM;
+   allocator.free = countingFree;
+
+   if( TA_SetAllocator( &allocator ) != TA_SUCCESS )
+      return TA_ALLOC_TST_BAD_PARAM;
+
+   retValue = testFunctions( history, &arena );
+   if( retValue == TA_TEST_PASS )
+      retValue = testStream( history, &arena );
+
+   /* Back to malloc/free, the hooks are no longer called. */
+   TA_SetAllocator( NULL );
+   memset( &arena, 0, sizeof(arena) );
+   if( (retValue == TA_TEST_PASS) &&
+       (TA_StreamInit( &state, TA_STREAM_SMA, 200 ) == TA_SUCCESS) )
+   {
+      TA_StreamFree( &state );
+      if( (arena.nbAlloc != 0) || (arena.nbFree != 0) )
+         retValue = TA_ALLOC_TST_HOOK;
+   }
+
+   return retValue;
+}
+
+/**** Local functions definitions.     ****/
+static ErrorNumber testFunctions( const TA_History *history, TA_CountingArena *arena )
+{
+   TA_RetCode retCode;
+   int outBegIdx, outNBElement;
+   int endIdx = (int)history->nbBars-1;
+
+   /* No temporary memory. */
+   TA_ResetAllocStats();
+   memset( arena, 0, sizeof(*arena) );
+   retCode = TA_SMA( 0, endIdx, history->close, 30, &outBegIdx, &outNBElement, output );
+   if( retCode != TA_SUCCESS )
+      return TA_ALLOC_TST_CALL_FAIL;
+   if( checkCounters( arena, 0, 0 ) != TA_TEST_PASS )
+      return TA_ALLOC_TST_STEADY;
+
+   /* The circular buffer of MFI fits in its local array... */
+   retCode = TA_MFI( 0, endIdx, history->high, history->low, history->close, history->volume,
+                     14, &outBegIdx, &outNBElement, output );
+   if( retCode != TA_SUCCESS )
+      return TA_ALLOC_TST_CALL_FAIL;
+   if( checkCounters( arena, 0, 0 ) != TA_TEST_PASS )
+      return TA_ALLOC_TST_STEADY;
+
+   /* ...but not with a longer period (CIRCBUF_INIT). */
+   retCode = TA_MFI( 0, endIdx, history->high, history->low, history->close, history->volume,
+                     100, &outBegIdx, &outNBElement, output );
+   if( retCode != TA_SUCCESS )
+      return TA_ALLOC_TST_CALL_FAIL;
+   if( checkCounters( arena, 1, 2 ) != TA_TEST_PASS )
+      return TA_ALLOC_TST_HOOK;
+
+   /* The temporary array of DEMA (ARRAY_ALLOC). */
+   TA_ResetAllocStats();
+   memset( arena, 0, sizeof(*arena) );
+   retCode = TA_DEMA( 0, endIdx, history->close, 30, &outBegIdx, &outNBElement, output );
+   if( retCode != TA_SUCCESS )
+      return TA_ALLOC_TST_CALL_FAIL;
+   if( checkCounters( arena, 1, 2 ) != TA_TEST_PASS )
+      return TA_ALLOC_TST_HOOK;
+
+   /* The failure of the allocator is reported. */
+   TA_ResetAllocStats();
+   memset( arena, 0, sizeof(*arena) );
+   arena->failing = 1;
+   retCode = TA_DEMA( 0, endIdx, history->close, 30, &outBegIdx, &outNBElement, output );
+   arena->failing = 0;
+   if( (retCode != TA_ALLOC_ERR) || (arena->nbAlloc != 1) || (arena->nbFree != 0) )
+      return TA_ALLOC_TST_FAILURE;
+
+   return TA_TEST_PASS;
+}
+
+static ErrorNumber testStream( const TA_History *history, TA_CountingArena *arena )
+{
+   TA_StreamState state;
+   TA_Bar bar;
+   double value;
+   int i, nbElement;
+
+   /* The window is allocated once... */
+   TA_ResetAllocStats();
+   memset( arena, 0, sizeof(*arena) );
+   if( TA_StreamInit( &state, TA_STREAM_SMA, 20 ) != TA_SUCCESS )
+      return TA_ALLOC_TST_CALL_FAIL;
+   if( (arena->nbAlloc != 1) || (arena->nbFree != 0) )
+   {
+      TA_StreamFree( &state );
+      return TA_ALLOC_TST_HOOK;
+   }
+
+   /* ...and each new bar does not allocate. */
+   TA_ResetAllocStats();
+   memset( arena, 0, sizeof(*arena) );
+   memset( &bar, 0, sizeof(bar) );
+   for( i=0; i < (int)history->nbBars; i++ )
+   {
+      bar.high  = history->high[i];
+      bar.low   = history->low[i];
+      bar.close = history->close[i];
+      if( TA_StreamUpdate( &state, &bar, &nbElement, &value ) != TA_SUCCESS )
+      {
+         TA_StreamFree( &state );
+         return TA_ALLOC_TST_CALL_FAIL;
+      }
+   }
+   if( checkCounters( arena, 0, 0 ) != TA_TEST_PASS )
+   {
+      TA_StreamFree( &state );
+      return TA_ALLOC_TST_STEADY;
+   }
+
+   TA_StreamFree( &state );
+   if( (arena->nbAlloc != 0) || (arena->nbFree != 1) )
+      return TA_ALLOC_TST_HOOK;
+
+   return TA_TEST_PASS;
+}
+
+/* Every allocation is freed, and the counters of TA-Lib are the
+ * calls received by the hooks.
+ */
+static ErrorNumber checkCounters( const TA_CountingArena *arena,
+                                  int minAlloc, int maxAlloc )
+{
+   TA_AllocStats stats;
+
+   TA_GetAllocStats( &stats );
+   if( (arena->nbAlloc < minAlloc) || (arena->nbAlloc > maxAlloc) ||
+       (arena->nbFree != arena->nbAlloc) || (arena->nbRealloc != 0) ||
+       (stats.nbAlloc != (unsigned long)arena->nbAlloc) ||
+       (stats.nbFree != (unsigned long)arena->nbFree) ||
+       (stats.nbRealloc != 0) )
+   {
+      printf( "Fail: alloc %d/%lu free %d/%lu (expected %d to %d allocations)\n",
+              arena->nbAlloc, stats.nbAlloc, arena->nbFree, stats.nbFree, minAlloc, maxAlloc );
+      return TA_ALLOC_TST_HOOK;
+   }
+
+   return TA_TEST_PASS;
+}
+
+static void *countingAlloc( void *userData, size_t size )
+{
+   TA_CountingArena *arena = (TA_CountingArena *)userData;
+
+   arena->nbAlloc++;
+   return arena->failing? NULL : malloc( size );
+}
+
+static void *countingRealloc( void *userData, void *ptr, size_t size )
+{
+   TA_CountingArena *arena = (TA_CountingArena *)userData;
+
+   arena->nbRealloc++;
+   return arena->failing? NULL : realloc( ptr, size );
+}
+
+static void countingFree( void *userData, void *ptr )
+{
+   TA_CountingArena *arena = (TA_CountingArena *)userData;
+
+   arena->nbFree++;
+   free( ptr );
+}
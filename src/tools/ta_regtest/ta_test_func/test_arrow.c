@@ -0,0 +1,484 @@
+/* Description:
+ *     Test the adapters of the Arrow C data interface (ta_arrow.h).
+ *
+ *     The record batches are built by hand, with offsets and with
+ *     columns of each supported type. The values must be identical
+ *     to the call of the function on arrays of double, the rows of
+ *     the lookback must be null, and the chunks of a stream must
+ *     give the values of the function on all the rows.
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "ta_test_priv.h"
+#include "ta_test_func.h"
+#include "ta_utility.h"
+#include "ta_arrow.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+
+/* A batch of the history with its columns open, high, low, close
+ * (float64) and volume (int64), and a column "close32" (float32).
+ */
+#define NB_COLUMN 6
+#define BATCH_OFFSET 3
+
+typedef struct
+{
+   struct ArrowSchema  schema;
+   struct ArrowSchema  colSchema[NB_COLUMN];
+   struct ArrowSchema *colSchemaPtr[NB_COLUMN];
+   struct ArrowArray   array;
+   struct ArrowArray   column[NB_COLUMN];
+   struct ArrowArray  *columnPtr[NB_COLUMN];
+   const void         *buffers[NB_COLUMN+1][2];
+   int                 length;
+} TA_TestBatch;
+
+typedef struct
+{
+   const char *name;
+   double optIn[4];
+   const char *columns[5];
+} TA_Test;
+
+/**** Local functions declarations.    ****/
+static void buildBatch( const TA_History *history, TA_TestBatch *batch );
+static void noRelease( struct ArrowArray *array );
+static ErrorNumber do_test( const TA_TestBatch *batch, const TA_Test *test );
+static ErrorNumber checkOutput( const struct ArrowArray *out, int isInteger, int outBegIdx,
+                                int outNBElement, const void *expected );
+static ErrorNumber testSingleColumn( const TA_TestBatch *batch );
+static ErrorNumber testStream( const TA_TestBatch *batch );
+static ErrorNumber testBadParam( TA_TestBatch *batch );
+static const double *columnOf( const char *name );
+
+/**** Local variables definitions.     ****/
+static TA_Test tableTest[] =
+{
+   { "SMA",      { 10 },                                { NULL } },
+   { "SMA",      { 10 },                                { "close32" } },
+   { "BBANDS",   { 20, 2.0, 1.5, TA_MAType_EMA },      { NULL } },
+   { "ATR",      { 14 },                                { NULL } },
+   { "AD",       { 0 },                                 { NULL } },
+   { "MININDEX", { 5 },                                 { "low" } },
+   { "CORREL",   { 30 },                                { "high", "low" } },
+   { "MACD",     { 12, 26, 9 },                         { "open" } }
+};
+
+#define NB_TEST (sizeof(tableTest)/sizeof(TA_Test))
+
+static const char *columnName[NB_COLUMN] = { "open", "high", "low", "close", "volume", "close32" };
+
+/* The columns start BATCH_OFFSET rows before the batch. */
+static double priceColumn[4][BATCH_OFFSET+MAX_NB_TEST_ELEMENT];
+static Int64  volumeColumn[BATCH_OFFSET+MAX_NB_TEST_ELEMENT];
+static float  close32Column[BATCH_OFFSET+MAX_NB_TEST_ELEMENT];
+
+/* The same values as double, from the first row of the batch. */
+static double expectedInput[NB_COLUMN][MAX_NB_TEST_ELEMENT];
+static double expectedOutput[3][MAX_NB_TEST_ELEMENT];
+
+/**** Global functions definitions.   ****/
+ErrorNumber test_func_arrow( TA_History *history )
+{
+   TA_TestBatch batch;
+   TA_AllocStats before, after;
+   ErrorNumber retValue;
+   unsigned int i;
+
+   buildBatch( history, &batch );
+
+   TA_GetAllocStats( &before );
+   for( i=0; i < NB_TEST; i++ )
+   {
+      retValue = do_test( &batch, &tableTest[i] );
+      if( retValue != TA_TEST_PASS )
+      {
+         printf( "%s Failed Test #%d (Code=%d)\n", __FILE__, i, retValue );
+         return retValue;
+      }
+   }
+
+   retValue = testSingleColumn( &batch );
+   if( retValue != TA_TEST_PASS )
+      return retValue;
+
+   retValue = testStream( &batch );
+   if( retValue != TA_TEST_PASS )
+      return retValue;
+
+   retValue = testBadParam( &batch );
+   if( retValue != TA_TEST_PASS )
+      return retValue;
+
+   /* Every output was released. */
+   TA_GetAllocStats( &after );
+   if( after.nbAlloc-before.nbAlloc != after.nbFree-before.nbFree )
+   {
+      printf( "Fail: %lu allocations, %lu free\n", after.nbAlloc-before.nbAlloc,
+              after.nbFree-before.nbFree );
+      return TA_ARROW_TST_ALLOC;
+   }
+
+   /* All test succeed. */
+   return TA_TEST_PASS;
+}
+
+/**** Local functions definitions.     ****/
+static void buildBatch( const TA_History *history, TA_TestBatch *batch )
+{
+   const double *source[4];
+   int c, t;
+
+   source[0] = history->open;
+   source[1] = history->high;
+   source[2] = history->low;
+   source[3] = history->close;
+
+   memset( batch, 0, sizeof(TA_TestBatch) );
+   batch->length = (int)history->nbBars-BATCH_OFFSET;
+
+   for( t=0; t < (int)history->nbBars; t++ )
+   {
+      for( c=0; c < 4; c++ )
+         priceColumn[c][t] = source[c][t];
+      volumeColumn[t] = (Int64)history->volume[t];
+      close32Column[t] = (float)history->close[t];
+   }
+
+   for( t=0; t < batch->length; t++ )
+   {
+      for( c=0; c < 4; c++ )
+         expectedInput[c][t] = priceColumn[c][t+BATCH_OFFSET];
+      expectedInput[4][t] = (double)volumeColumn[t+BATCH_OFFSET];
+      expectedInput[5][t] = close32Column[t+BATCH_OFFSET];
+   }
+
+   /* The offset of the batch applies to all its columns. The close
+    * has its own offset on top of it.
+    */
+   for( c=0; c < NB_COLUMN; c++ )
+   {
+      batch->colSchema[c].format = (c == 4)? "l" : (c == 5)? "f" : "g";
+      batch->colSchema[c].name = columnName[c];
+      batch->colSchemaPtr[c] = &batch->colSchema[c];
+
+      batch->buffers[c][0] = NULL;
+      batch->buffers[c][1] = (c < 4)? (const void *)priceColumn[c] :
+                             (c == 4)? (const void *)volumeColumn : (const void *)close32Column;
+      batch->column[c].length = history->nbBars;
+      batch->column[c].n_buffers = 2;
+      batch->column[c].buffers = batch->buffers[c];
+      batch->column[c].release = noRelease;
+      batch->columnPtr[c] = &batch->column[c];
+   }
+   batch->buffers[3][1] = priceColumn[3]-1;
+   batch->column[3].offset = 1;
+
+   batch->schema.format = "+s";
+   batch->schema.n_children = NB_COLUMN;
+   batch->schema.children = batch->colSchemaPtr;
+
+   batch->buffers[NB_COLUMN][0] = NULL;
+   batch->array.length = batch->length;
+   batch->array.offset = BATCH_OFFSET;
+   batch->array.n_buffers = 1;
+   batch->array.buffers = batch->buffers[NB_COLUMN];
+   batch->array.n_children = NB_COLUMN;
+   batch->array.children = batch->columnPtr;
+   batch->array.release = noRelease;
+}
+
+/* The batch belongs to the test. */
+static void noRelease( struct ArrowArray *array )
+{
+   (void)array;
+}
+
+static const double *columnOf( const char *name )
+{
+   int c;
+
+   for( c=0; c < NB_COLUMN; c++ )
+   {
+      if( strcmp( columnName[c], name ) == 0 )
+         return expectedInput[c];
+   }
+   return NULL;
+}
+
+static ErrorNumber do_test( const TA_TestBatch *batch, const TA_Test *test )
+{
+   struct ArrowArray out[3];
+   struct ArrowSchema outSchema[3];
+   const double *inputs[5];
+   void *outputs[3];
+   const TA_FuncDef *func;
+   static const char *defaultName[] = { "close", "open", "high", "low", "close", "volume" };
+   TA_RetCode retCode;
+   ErrorNumber retValue;
+   int i, outBegIdx, outNBElement, isInteger;
+
+   func = TA_FuncFind( test->name );
+   if( !func )
+      return TA_ARROW_TST_CALL_FAIL;
+
+   /* The expected values, by the function on arrays of double. */
+   for( i=0; i < func->nbInput; i++ )
+      inputs[i] = columnOf( test->columns[i]? test->columns[i] : defaultName[func->inputs[i].type] );
+   for( i=0; i < func->nbOutput; i++ )
+      outputs[i] = expectedOutput[i];
+   retCode = func->call( 0, batch->length-1, inputs, test->optIn, &outBegIdx, &outNBElement, outputs );
+   if( retCode != TA_SUCCESS )
+      return TA_ARROW_TST_CALL_FAIL;
+
+   retCode = TA_ArrowCall( func, test->optIn, &batch->schema, &batch->array,
+                           test->columns[0]? test->columns : NULL, out, outSchema );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Fail: TA_ArrowCall %s (retCode=%d)\n", test->name, retCode );
+      return TA_ARROW_TST_CALL_FAIL;
+   }
+
+   retValue = TA_TEST_PASS;
+   for( i=0; i < func->nbOutput; i++ )
+   {
+      isInteger = func->outputs[i].type == TA_OUTPUT_INTEGER;
+      if( (retValue == TA_TEST_PASS) &&
+          ((strcmp( outSchema[i].format, isInteger? "i" : "g" ) != 0) ||
+           (strcmp( outSchema[i].name, func->outputs[i].name ) != 0) || !outSchema[i].release) )
+      {
+         printf( "Fail: %s schema of output %d\n", test->name, i );
+         retValue = TA_ARROW_TST_VALUE;
+      }
+      if( retValue == TA_TEST_PASS )
+         retValue = checkOutput( &out[i], isInteger, outBegIdx, outNBElement, expectedOutput[i] );
+
+      out[i].release( &out[i] );
+      outSchema[i].release( &outSchema[i] );
+      if( out[i].release || outSchema[i].release )
+         retValue = TA_ARROW_TST_ALLOC;
+   }
+
+   return retValue;
+}
+
+/* Rows [outBegIdx,outBegIdx+outNBElement) valid and identical to the
+ * expected values, the others null.
+ */
+static ErrorNumber checkOutput( const struct ArrowArray *out, int isInteger, int outBegIdx,
+                                int outNBElement, const void *expected )
+{
+   const unsigned char *bitmap;
+   size_t elementSize;
+   int t, isValid;
+
+   elementSize = isInteger? sizeof(int) : sizeof(double);
+   if( (out->n_buffers != 2) || (out->offset != 0) || (out->n_children != 0) ||
+       (out->null_count != out->length-outNBElement) )
+   {
+      printf( "Fail: null_count %d (expected %d)\n", (int)out->null_count, (int)(out->length-outNBElement) );
+      return TA_ARROW_TST_VALIDITY;
+   }
+   if( (out->null_count == 0) != (out->buffers[0] == NULL) )
+      return TA_ARROW_TST_VALIDITY;
+
+   bitmap = (const unsigned char *)out->buffers[0];
+   for( t=0; t < out->length; t++ )
+   {
+      isValid = !bitmap || (bitmap[t/8] & (1 << (t%8)));
+      if( isValid != ((t >= outBegIdx) && (t < outBegIdx+outNBElement)) )
+      {
+         printf( "Fail: validity of row %d\n", t );
+         return TA_ARROW_TST_VALIDITY;
+      }
+      if( isValid && (memcmp( (const char *)out->buffers[1] + t*elementSize,
+                              (const char *)expected + (t-outBegIdx)*elementSize, elementSize ) != 0) )
+      {
+         printf( "Fail: row %d\n", t );
+         return TA_ARROW_TST_VALUE;
+      }
+   }
+
+   return TA_TEST_PASS;
+}
+
+/* A float32 column alone is used for all the inputs. */
+static ErrorNumber testSingleColumn( const TA_TestBatch *batch )
+{
+   struct ArrowArray column, out;
+   int outBegIdx, outNBElement;
+   double optIn[1] = { 7 };
+   TA_RetCode retCode;
+   ErrorNumber retValue;
+
+   column = batch->column[5];
+   column.offset = BATCH_OFFSET;
+   column.length = batch->length;
+
+   retCode = TA_SMA( 0, batch->length-1, expectedInput[5], 7, &outBegIdx, &outNBElement, expectedOutput[0] );
+   if( retCode != TA_SUCCESS )
+      return TA_ARROW_TST_CALL_FAIL;
+
+   retCode = TA_ArrowCall( TA_FuncFind( "SMA" ), optIn, &batch->colSchema[5], &column, NULL, &out, NULL );
+   if( retCode != TA_SUCCESS )
+      return TA_ARROW_TST_CALL_FAIL;
+
+   retValue = checkOutput( &out, 0, outBegIdx, outNBElement, expectedOutput[0] );
+   out.release( &out );
+   return retValue;
+}
+
+/* The batch in chunks of several sizes, sliced with the offset of
+ * the batch, must give the values of the function on all the rows.
+ */
+static ErrorNumber testStream( const TA_TestBatch *batch )
+{
+   static const int chunkSize[] = { 1, 5, 13, 0, 40, 1, 1000 };
+   TA_StreamState state;
+   TA_TestBatch chunk;
+   struct ArrowArray out;
+   struct ArrowSchema outSchema;
+   TA_RetCode retCode;
+   ErrorNumber retValue;
+   int f, i, row, size, outBegIdx, outNBElement;
+
+   for( f=0; f < 2; f++ )
+   {
+      if( f == 0 )
+         retCode = TA_EMA( 0, batch->length-1, expectedInput[3], 10, &outBegIdx, &outNBElement, expectedOutput[0] );
+      else
+         retCode = TA_ATR( 0, batch->length-1, expectedInput[1], expectedInput[2], expectedInput[3],
+                           14, &outBegIdx, &outNBElement, expectedOutput[0] );
+      if( retCode == TA_SUCCESS )
+         retCode = TA_StreamInit( &state, f? TA_STREAM_ATR : TA_STREAM_EMA, f? 14 : 10 );
+      if( retCode != TA_SUCCESS )
+         return TA_ARROW_TST_CALL_FAIL;
+
+      retValue = TA_TEST_PASS;
+      row = 0;
+      for( i=0; (row < batch->length) && (retValue == TA_TEST_PASS); i++ )
+      {
+         size = chunkSize[i % (sizeof(chunkSize)/sizeof(int))];
+         if( row+size > batch->length )
+            size = batch->length-row;
+
+         chunk = *batch;
+         chunk.schema.children = chunk.colSchemaPtr;
+         chunk.array.children = batch->array.children;
+         chunk.array.offset = BATCH_OFFSET+row;
+         chunk.array.length = size;
+
+         retCode = TA_ArrowStreamRun( &state, &chunk.schema, &chunk.array, NULL, &out, &outSchema );
+         if( retCode != TA_SUCCESS )
+         {
+            retValue = TA_ARROW_TST_CALL_FAIL;
+            break;
+         }
+
+         /* The rows of the chunk before outBegIdx are in the lookback. */
+         retValue = checkOutput( &out, 0, max( outBegIdx-row, 0 ),
+                                 size-max( min( outBegIdx-row, size ), 0 ),
+                                 &expectedOutput[0][max( row-outBegIdx, 0 )] );
+         if( (retValue == TA_TEST_PASS) && (strcmp( outSchema.format, "g" ) != 0) )
+            retValue = TA_ARROW_TST_VALUE;
+         if( retValue != TA_TEST_PASS )
+            printf( "Fail: chunk %d of %s\n", i, f? "ATR" : "EMA" );
+
+         out.release( &out );
+         outSchema.release( &outSchema );
+         row += size;
+      }
+
+      TA_StreamFree( &state );
+      if( retValue != TA_TEST_PASS )
+         return (retValue == TA_ARROW_TST_CALL_FAIL)? retValue : TA_ARROW_TST_CHUNK;
+   }
+
+   return TA_TEST_PASS;
+}
+
+static ErrorNumber testBadParam( TA_TestBatch *batch )
+{
+   const TA_FuncDef *sma = TA_FuncFind( "SMA" );
+   static const char *missing[1] = { "vwap" };
+   unsigned char bitmap[(BATCH_OFFSET+MAX_NB_TEST_ELEMENT+7)/8];
+   double optIn[1] = { 10 };
+   struct ArrowArray out;
+   TA_StreamState state;
+   TA_RetCode retCode;
+   ErrorNumber retValue;
+
+   retValue = TA_TEST_PASS;
+
+   /* Unknown column. */
+   retCode = TA_ArrowCall( sma, optIn, &batch->schema, &batch->array, missing, &out, NULL );
+   if( (retCode != TA_BAD_PARAM) || out.release )
+      retValue = TA_ARROW_TST_BAD_PARAM;
+
+   /* One null in the close, within the batch. The same null after
+    * the rows of the batch is ignored.
+    */
+   memset( bitmap, 0xFF, sizeof(bitmap) );
+   bitmap[(BATCH_OFFSET+1+20)/8] &= (unsigned char)~(1 << ((BATCH_OFFSET+1+20)%8));
+   batch->buffers[3][0] = bitmap;
+   batch->column[3].null_count = 1;
+   retCode = TA_ArrowCall( sma, optIn, &batch->schema, &batch->array, NULL, &out, NULL );
+   if( (retCode != TA_BAD_PARAM) || out.release )
+      retValue = TA_ARROW_TST_BAD_PARAM;
+   batch->array.length = 20;
+   retCode = TA_ArrowCall( sma, optIn, &batch->schema, &batch->array, NULL, &out, NULL );
+   if( retCode == TA_SUCCESS )
+      out.release( &out );
+   else
+      retValue = TA_ARROW_TST_BAD_PARAM;
+   batch->array.length = batch->length;
+   batch->buffers[3][0] = NULL;
+   batch->column[3].null_count = 0;
+
+   /* A single column for a function with several inputs. */
+   retCode = TA_ArrowCall( TA_FuncFind( "ATR" ), optIn, &batch->colSchema[3], &batch->column[3],
+                           NULL, &out, NULL );
+   if( (retCode != TA_BAD_PARAM) || out.release )
+      retValue = TA_ARROW_TST_BAD_PARAM;
+
+   /* Unsupported type. */
+   batch->colSchema[3].format = "u";
+   retCode = TA_ArrowCall( sma, optIn, &batch->schema, &batch->array, NULL, &out, NULL );
+   if( (retCode != TA_BAD_PARAM) || out.release )
+      retValue = TA_ARROW_TST_BAD_PARAM;
+   batch->colSchema[3].format = "g";
+
+   /* The ATR stream needs the high and the low of a batch. */
+   if( TA_StreamInit( &state, TA_STREAM_ATR, 14 ) != TA_SUCCESS )
+      return TA_ARROW_TST_CALL_FAIL;
+   retCode = TA_ArrowStreamRun( &state, &batch->colSchema[3], &batch->column[3], NULL, &out, NULL );
+   if( (retCode != TA_BAD_PARAM) || out.release )
+      retValue = TA_ARROW_TST_BAD_PARAM;
+   TA_StreamFree( &state );
+
+   /* Released batch. */
+   batch->array.release = NULL;
+   retCode = TA_ArrowCall( sma, optIn, &batch->schema, &batch->array, NULL, &out, NULL );
+   if( (retCode != TA_BAD_PARAM) || out.release )
+      retValue = TA_ARROW_TST_BAD_PARAM;
+   batch->array.release = noRelease;
+
+   if( retValue != TA_TEST_PASS )
+      printf( "Fail: bad parameter accepted\n" );
+
+   return retValue;
+}
@@ -74,6 +74,12 @@ static TA_Test tableTest[] =
    { 1, 0, 251, 5, TA_SUCCESS,     0, 1.0184,  4,  252-4 }, /* First Value */
    { 0, 0, 251, 5, TA_SUCCESS,     1, 0.3684,  4,  252-4 },
    { 0, 0, 251, 5, TA_SUCCESS, 252-5, 0.5952,  4,  252-4 }, /* Last Value */
+
+   /* Long periods, calculated with the sorted window (TA_OrdStat). */
+   { 1, 0, 251, 200, TA_SUCCESS,      0, 15.6438, 199, 252-199 }, /* First Value */
+   { 0, 0, 251, 200, TA_SUCCESS, 252-200, 12.0299, 199, 252-199 }, /* Last Value */
+   { 1, 0, 251, 230, TA_SUCCESS,      0, 14.9980, 229, 252-229 },
+   { 0, 0, 251, 230, TA_SUCCESS, 252-230, 13.6887, 229, 252-229 },
 };
 
 #define NB_TEST (sizeof(tableTest)/sizeof(TA_Test))
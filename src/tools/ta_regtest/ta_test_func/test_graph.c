@@ -0,0 +1,489 @@
+/* Description:
+ *     Test the indicator graph (ta_graph.h). Every output of the
+ *     graph must be identical to the corresponding TA function
+ *     called with startIdx = 0.
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <string.h>
+
+#include "ta_test_priv.h"
+#include "ta_test_func.h"
+#include "ta_utility.h"
+#include "ta_graph.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+typedef struct
+{
+   TA_GraphFuncId funcId;
+   double optIn[4];
+} TA_Test;
+
+/* Outputs of a test, as returned by TA_GraphAdd. */
+typedef struct
+{
+   TA_GraphSeries outputs[3];
+} TA_TestOutputs;
+
+/**** Local functions declarations.    ****/
+static ErrorNumber do_compute( TA_Graph *graph,
+                               const TA_TestOutputs *outputs,
+                               const TA_History *history,
+                               int nbBars );
+static ErrorNumber do_test( const TA_Graph *graph,
+                            const TA_Test *test,
+                            const TA_TestOutputs *outputs,
+                            const TA_History *history,
+                            int nbBars );
+static int nbOutputs( TA_GraphFuncId funcId );
+static TA_RetCode callFunc( const TA_Test *test,
+                            const TA_History *history,
+                            int nbBars,
+                            int *outBegIdx,
+                            int *outNBElement );
+static ErrorNumber testSharing( const TA_History *history );
+static ErrorNumber testChain( const TA_History *history );
+
+/**** Local variables definitions.     ****/
+
+static TA_Test tableTest[] =
+{
+   { TA_GRAPH_MA,       { 30, TA_MAType_SMA } },
+   { TA_GRAPH_MA,       { 20, TA_MAType_EMA } },
+   { TA_GRAPH_MA,       { 10, TA_MAType_TEMA } },
+   { TA_GRAPH_SMA,      { 20 } },
+   { TA_GRAPH_SMA,      { 30 } },
+   { TA_GRAPH_EMA,      { 20 } },
+
+   { TA_GRAPH_STDDEV,   { 20, 1.0 } },
+   { TA_GRAPH_STDDEV,   { 10, 2.5 } },
+
+   { TA_GRAPH_BBANDS,   { 20, 2.0, 2.0, TA_MAType_SMA } },
+   { TA_GRAPH_BBANDS,   { 20, 1.5, 2.5, TA_MAType_EMA } },
+   { TA_GRAPH_BBANDS,   { 10, 1.0, 1.0, TA_MAType_TEMA } },
+   { TA_GRAPH_BBANDS,   { 30, 2.0, 1.0, TA_MAType_SMA } },
+
+   { TA_GRAPH_TRANGE,   { 0 } },
+   { TA_GRAPH_ATR,      { 1 } },
+   { TA_GRAPH_ATR,      { 14 } },
+   { TA_GRAPH_NATR,     { 1 } },
+   { TA_GRAPH_NATR,     { 14 } },
+   { TA_GRAPH_NATR,     { 20 } },
+
+   { TA_GRAPH_RSI,      { 14 } },
+   { TA_GRAPH_STOCHF,   { 5, 3, TA_MAType_SMA } },
+   { TA_GRAPH_STOCHRSI, { 14, 5, 3, TA_MAType_SMA } },
+   { TA_GRAPH_STOCHRSI, { 14, 14, 3, TA_MAType_EMA } },
+
+   { TA_GRAPH_ADX,      { 14 } },
+   { TA_GRAPH_ADXR,     { 14 } },
+   { TA_GRAPH_ADXR,     { 5 } },
+
+   { TA_GRAPH_SMAEXT,   { 10, 0 } },
+   { TA_GRAPH_SMAEXT,   { 10, 3 } },
+   { TA_GRAPH_SMAEXT,   { 1, 2 } },
+   { TA_GRAPH_BIAS,     { 6, 12, 0 } },
+   { TA_GRAPH_BIAS,     { 6, 6, 2 } }
+};
+
+#define NB_TEST (sizeof(tableTest)/sizeof(TA_Test))
+
+/**** Global functions definitions.   ****/
+ErrorNumber test_func_graph( TA_History *history )
+{
+   static const TA_GraphSeries price[3] = { TA_GRAPH_HIGH, TA_GRAPH_LOW, TA_GRAPH_CLOSE };
+   TA_TestOutputs outputs[NB_TEST];
+   TA_Graph *graph;
+   TA_RetCode retCode;
+   ErrorNumber retValue;
+   unsigned int i;
+
+   retCode = TA_GraphAlloc( &graph );
+   if( retCode != TA_SUCCESS )
+      return TA_GRAPH_TST_ALLOC_FAIL;
+
+   /* All the tests are in the same graph. */
+   retValue = TA_TEST_PASS;
+   for( i=0; (i < NB_TEST) && (retValue == TA_TEST_PASS); i++ )
+   {
+      if( nbOutputs( tableTest[i].funcId ) == 1 )
+         retCode = TA_GraphAdd( graph, tableTest[i].funcId,
+                                (tableTest[i].funcId == TA_GRAPH_TRANGE) ||
+                                (tableTest[i].funcId == TA_GRAPH_ATR)    ||
+                                (tableTest[i].funcId == TA_GRAPH_NATR)   ||
+                                (tableTest[i].funcId == TA_GRAPH_ADX)    ||
+                                (tableTest[i].funcId == TA_GRAPH_ADXR)? price : &price[2],
+                                tableTest[i].funcId == TA_GRAPH_TRANGE? NULL : tableTest[i].optIn,
+                                outputs[i].outputs );
+      else
+         retCode = TA_GraphAdd( graph, tableTest[i].funcId,
+                                tableTest[i].funcId == TA_GRAPH_STOCHF? price : &price[2],
+                                tableTest[i].optIn, outputs[i].outputs );
+
+      if( retCode != TA_SUCCESS )
+      {
+         printf( "Failed to add test #%d (retCode=%d)\n", i, retCode );
+         retValue = TA_GRAPH_TST_ADD_FAIL;
+      }
+   }
+
+   /* Whole history, then the same graph re-used with less bars
+    * (including not enough for some of the outputs), and finally
+    * with unstable periods.
+    */
+   if( retValue == TA_TEST_PASS )
+      retValue = do_compute( graph, outputs, history, history->nbBars );
+   if( retValue == TA_TEST_PASS )
+      retValue = do_compute( graph, outputs, history, 100 );
+   if( retValue == TA_TEST_PASS )
+      retValue = do_compute( graph, outputs, history, 25 );
+   if( retValue == TA_TEST_PASS )
+      retValue = do_compute( graph, outputs, history, 0 );
+   if( retValue == TA_TEST_PASS )
+   {
+      TA_SetUnstablePeriod( TA_FUNC_UNST_EMA,  3 );
+      TA_SetUnstablePeriod( TA_FUNC_UNST_RSI,  4 );
+      TA_SetUnstablePeriod( TA_FUNC_UNST_ATR,  5 );
+      TA_SetUnstablePeriod( TA_FUNC_UNST_NATR, 7 );
+      TA_SetUnstablePeriod( TA_FUNC_UNST_ADX,  6 );
+      retValue = do_compute( graph, outputs, history, history->nbBars );
+      TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, 0 );
+   }
+
+   TA_GraphFree( graph );
+
+   if( retValue != TA_TEST_PASS )
+      return retValue;
+
+   retValue = testSharing( history );
+   if( retValue != TA_TEST_PASS )
+      return retValue;
+
+   retValue = testChain( history );
+   if( retValue != TA_TEST_PASS )
+      return retValue;
+
+   /* All test succeed. */
+   return TA_TEST_PASS;
+}
+
+/**** Local functions definitions.     ****/
+static ErrorNumber do_compute( TA_Graph *graph,
+                               const TA_TestOutputs *outputs,
+                               const TA_History *history,
+                               int nbBars )
+{
+   TA_RetCode retCode;
+   ErrorNumber retValue;
+   unsigned int i;
+
+   retCode = TA_GraphCompute( graph, nbBars, NULL, history->high,
+                              history->low, history->close, NULL );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Fail: TA_GraphCompute with %d bars (retCode=%d)\n", nbBars, retCode );
+      return TA_GRAPH_TST_COMPUTE_FAIL;
+   }
+
+   for( i=0; i < NB_TEST; i++ )
+   {
+      retValue = do_test( graph, &tableTest[i], &outputs[i], history, nbBars );
+      if( retValue != TA_TEST_PASS )
+      {
+         printf( "Failed Test #%d with %d bars (Code=%d)\n", i, nbBars, retValue );
+         return retValue;
+      }
+   }
+
+   return TA_TEST_PASS;
+}
+
+static ErrorNumber do_test( const TA_Graph *graph,
+                            const TA_Test *test,
+                            const TA_TestOutputs *outputs,
+                            const TA_History *history,
+                            int nbBars )
+{
+   const double *outReal;
+   TA_RetCode retCode;
+   int outBegIdx, outNBElement, begIdx, nbElement, i, j;
+
+   retCode = callFunc( test, history, nbBars, &outBegIdx, &outNBElement );
+   if( retCode != TA_SUCCESS )
+      return TA_GRAPH_TST_FUNC_FAIL;
+
+   for( i=0; i < nbOutputs( test->funcId ); i++ )
+   {
+      retCode = TA_GraphGetSeries( graph, outputs->outputs[i],
+                                   &begIdx, &nbElement, &outReal );
+      if( retCode != TA_SUCCESS )
+         return TA_GRAPH_TST_GET_FAIL;
+
+      if( nbElement != outNBElement )
+      {
+         printf( "Fail: Output %d has %d elements, expected %d\n", i, nbElement, outNBElement );
+         return TA_GRAPH_TST_NB_ELEMENT;
+      }
+
+      if( (nbElement != 0) && (begIdx != outBegIdx) )
+      {
+         printf( "Fail: Output %d begins at %d, expected %d\n", i, begIdx, outBegIdx );
+         return TA_GRAPH_TST_BEG_IDX;
+      }
+
+      /* Same sequence of operations, so no tolerance is allowed. */
+      for( j=0; j < nbElement; j++ )
+      {
+         if( outReal[j] != gBuffer[i].out0[j] )
+         {
+            printf( "Fail: Output %d value [%d] is %g, expected %g\n",
+                    i, j, outReal[j], gBuffer[i].out0[j] );
+            return TA_GRAPH_TST_VALUE;
+         }
+      }
+   }
+
+   return TA_TEST_PASS;
+}
+
+static int nbOutputs( TA_GraphFuncId funcId )
+{
+   switch( funcId )
+   {
+   case TA_GRAPH_BBANDS:
+      return 3;
+   case TA_GRAPH_STOCHF:
+   case TA_GRAPH_STOCHRSI:
+      return 2;
+   default:
+      return 1;
+   }
+}
+
+static TA_RetCode callFunc( const TA_Test *test,
+                            const TA_History *history,
+                            int nbBars,
+                            int *outBegIdx,
+                            int *outNBElement )
+{
+   const double *opt = test->optIn;
+   int endIdx = nbBars-1;
+
+   /* Nothing to calculate, same as an empty series in the graph. */
+   if( nbBars == 0 )
+   {
+      *outBegIdx = 0;
+      *outNBElement = 0;
+      return TA_SUCCESS;
+   }
+
+   switch( test->funcId )
+   {
+   case TA_GRAPH_MA:
+      return TA_MA( 0, endIdx, history->close, (int)opt[0], (TA_MAType)(int)opt[1],
+                    outBegIdx, outNBElement, gBuffer[0].out0 );
+   case TA_GRAPH_SMA:
+      return TA_SMA( 0, endIdx, history->close, (int)opt[0],
+                     outBegIdx, outNBElement, gBuffer[0].out0 );
+   case TA_GRAPH_EMA:
+      return TA_EMA( 0, endIdx, history->close, (int)opt[0],
+                     outBegIdx, outNBElement, gBuffer[0].out0 );
+   case TA_GRAPH_STDDEV:
+      return TA_STDDEV( 0, endIdx, history->close, (int)opt[0], opt[1],
+                        outBegIdx, outNBElement, gBuffer[0].out0 );
+   case TA_GRAPH_BBANDS:
+      return TA_BBANDS( 0, endIdx, history->close, (int)opt[0], opt[1], opt[2],
+                        (TA_MAType)(int)opt[3], outBegIdx, outNBElement,
+                        gBuffer[0].out0, gBuffer[1].out0, gBuffer[2].out0 );
+   case TA_GRAPH_TRANGE:
+      return TA_TRANGE( 0, endIdx, history->high, history->low, history->close,
+                        outBegIdx, outNBElement, gBuffer[0].out0 );
+   case TA_GRAPH_ATR:
+      return TA_ATR( 0, endIdx, history->high, history->low, history->close,
+                     (int)opt[0], outBegIdx, outNBElement, gBuffer[0].out0 );
+   case TA_GRAPH_NATR:
+      return TA_NATR( 0, endIdx, history->high, history->low, history->close,
+                      (int)opt[0], outBegIdx, outNBElement, gBuffer[0].out0 );
+   case TA_GRAPH_RSI:
+      return TA_RSI( 0, endIdx, history->close, (int)opt[0],
+                     outBegIdx, outNBElement, gBuffer[0].out0 );
+   case TA_GRAPH_STOCHF:
+      return TA_STOCHF( 0, endIdx, history->high, history->low, history->close,
+                        (int)opt[0], (int)opt[1], (TA_MAType)(int)opt[2],
+                        outBegIdx, outNBElement, gBuffer[0].out0, gBuffer[1].out0 );
+   case TA_GRAPH_STOCHRSI:
+      return TA_STOCHRSI( 0, endIdx, history->close, (int)opt[0], (int)opt[1],
+                          (int)opt[2], (TA_MAType)(int)opt[3],
+                          outBegIdx, outNBElement, gBuffer[0].out0, gBuffer[1].out0 );
+   case TA_GRAPH_ADX:
+      return TA_ADX( 0, endIdx, history->high, history->low, history->close,
+                     (int)opt[0], outBegIdx, outNBElement, gBuffer[0].out0 );
+   case TA_GRAPH_ADXR:
+      return TA_ADXR( 0, endIdx, history->high, history->low, history->close,
+                      (int)opt[0], outBegIdx, outNBElement, gBuffer[0].out0 );
+   case TA_GRAPH_SMAEXT:
+      return TA_SmaExt( 0, endIdx, history->close, (int)opt[0], (int)opt[1],
+                        outBegIdx, outNBElement, gBuffer[0].out0 );
+   case TA_GRAPH_BIAS:
+      return TA_Bias( 0, endIdx, history->close, (int)opt[0], (int)opt[1], (int)opt[2],
+                      outBegIdx, outNBElement, gBuffer[0].out0 );
+   default:
+      return TA_BAD_PARAM;
+   }
+}
+
+/* Verify that the intermediates are shared, and that the
+ * buffers are recycled.
+ */
+static ErrorNumber testSharing( const TA_History *history )
+{
+   static const TA_GraphSeries price[3] = { TA_GRAPH_HIGH, TA_GRAPH_LOW, TA_GRAPH_CLOSE };
+   static const double smaOpt[1]    = { 20 };
+   static const double bbandsOpt[4] = { 20, 2.0, 2.0, TA_MAType_SMA };
+   static const double atrOpt[1]    = { 14 };
+   static const double badOpt[2]    = { 20, TA_REAL_DEFAULT };
+   TA_GraphSeries sma, bbands[3], atr, natr, trange;
+   const double *outReal;
+   TA_GraphInfo info;
+   TA_Graph *graph;
+   TA_RetCode retCode;
+   ErrorNumber retValue;
+   int begIdx, nbElement;
+
+   retCode = TA_GraphAlloc( &graph );
+   if( retCode != TA_SUCCESS )
+      return TA_GRAPH_TST_ALLOC_FAIL;
+
+   /* SMA shared with the middle band, TRANGE shared by ATR,
+    * NATR and the explicit TRANGE.
+    */
+   retValue = TA_GRAPH_TST_ADD_FAIL;
+   if( (TA_GraphAdd( graph, TA_GRAPH_SMA, &price[2], smaOpt, &sma ) == TA_SUCCESS) &&
+       (TA_GraphAdd( graph, TA_GRAPH_BBANDS, &price[2], bbandsOpt, bbands ) == TA_SUCCESS) &&
+       (TA_GraphAdd( graph, TA_GRAPH_ATR, price, atrOpt, &atr ) == TA_SUCCESS) &&
+       (TA_GraphAdd( graph, TA_GRAPH_NATR, price, atrOpt, &natr ) == TA_SUCCESS) &&
+       (TA_GraphAdd( graph, TA_GRAPH_TRANGE, price, NULL, &trange ) == TA_SUCCESS) )
+      retValue = TA_TEST_PASS;
+
+   /* Defaults and bad parameters are rejected. */
+   if( (retValue == TA_TEST_PASS) &&
+       ((TA_GraphAdd( graph, TA_GRAPH_STDDEV, &price[2], badOpt, &sma ) != TA_BAD_PARAM) ||
+        (TA_GraphAdd( graph, TA_GRAPH_SMA, &price[2], NULL, &sma ) != TA_BAD_PARAM)) )
+      retValue = TA_GRAPH_TST_BAD_PARAM;
+
+   if( (retValue == TA_TEST_PASS) &&
+       (TA_GraphCompute( graph, history->nbBars, NULL, history->high,
+                         history->low, history->close, NULL ) != TA_SUCCESS) )
+      retValue = TA_GRAPH_TST_COMPUTE_FAIL;
+
+   /* The volume is needed by nothing, but the close is. */
+   if( (retValue == TA_TEST_PASS) &&
+       (TA_GraphCompute( graph, history->nbBars, NULL, history->high,
+                         history->low, NULL, NULL ) != TA_BAD_PARAM) )
+      retValue = TA_GRAPH_TST_BAD_PARAM;
+
+   if( (retValue == TA_TEST_PASS) && (TA_GraphGetInfo( graph, &info ) == TA_SUCCESS) )
+   {
+      /* MA, BBANDS stddev, BBANDS bands, TRANGE, 2 Wilder smoothing and NATR. */
+      if( (bbands[1] != sma) || (info.nbNodes != 7) || (info.nbShared != 3) )
+      {
+         printf( "Fail: %d nodes and %d shared\n", info.nbNodes, info.nbShared );
+         retValue = TA_GRAPH_TST_SHARING;
+      }
+
+      /* The stddev and the NATR smoothing are recycled. */
+      if( info.nbBuffers >= info.nbNodes+1 )
+      {
+         printf( "Fail: %d buffers for %d nodes\n", info.nbBuffers, info.nbNodes );
+         retValue = TA_GRAPH_TST_SHARING;
+      }
+   }
+
+   /* An intermediate series shared with an output remains available. */
+   if( (retValue == TA_TEST_PASS) &&
+       ((TA_GraphGetSeries( graph, trange, &begIdx, &nbElement, &outReal ) != TA_SUCCESS) ||
+        (begIdx != 1) || (nbElement != (int)history->nbBars-1) ||
+        (outReal[0] != max(history->high[1],history->close[0]) - min(history->low[1],history->close[0]))) )
+      retValue = TA_GRAPH_TST_VALUE;
+
+   /* But not the price components. */
+   if( (retValue == TA_TEST_PASS) &&
+       (TA_GraphGetSeries( graph, TA_GRAPH_CLOSE, &begIdx, &nbElement, &outReal ) != TA_BAD_PARAM) )
+      retValue = TA_GRAPH_TST_BAD_PARAM;
+
+   TA_GraphFree( graph );
+
+   return retValue;
+}
+
+/* The output of an indicator used as the input of another. */
+static ErrorNumber testChain( const TA_History *history )
+{
+   static const TA_GraphSeries close = TA_GRAPH_CLOSE;
+   static const double emaOpt[1] = { 10 };
+   static const double rsiOpt[1] = { 14 };
+   TA_GraphSeries ema, rsi;
+   const double *outReal;
+   TA_Graph *graph;
+   TA_RetCode retCode;
+   ErrorNumber retValue;
+   int outBegIdx, outNBElement, begIdx, nbElement, i;
+
+   retCode = TA_GraphAlloc( &graph );
+   if( retCode != TA_SUCCESS )
+      return TA_GRAPH_TST_ALLOC_FAIL;
+
+   retValue = TA_GRAPH_TST_ADD_FAIL;
+   if( (TA_GraphAdd( graph, TA_GRAPH_EMA, &close, emaOpt, &ema ) == TA_SUCCESS) &&
+       (TA_GraphAdd( graph, TA_GRAPH_RSI, &ema, rsiOpt, &rsi ) == TA_SUCCESS) )
+      retValue = TA_TEST_PASS;
+
+   if( (retValue == TA_TEST_PASS) &&
+       (TA_GraphCompute( graph, history->nbBars, NULL, NULL, NULL,
+                         history->close, NULL ) != TA_SUCCESS) )
+      retValue = TA_GRAPH_TST_COMPUTE_FAIL;
+
+   if( retValue == TA_TEST_PASS )
+   {
+      /* RSI of the EMA output, as a caller would do it. */
+      retCode = TA_EMA( 0, history->nbBars-1, history->close, 10,
+                        &outBegIdx, &outNBElement, gBuffer[0].out0 );
+      if( retCode == TA_SUCCESS )
+         retCode = TA_RSI( 0, outNBElement-1, gBuffer[0].out0, 14,
+                           &begIdx, &nbElement, gBuffer[1].out0 );
+      if( retCode != TA_SUCCESS )
+         retValue = TA_GRAPH_TST_FUNC_FAIL;
+      else
+      {
+         outBegIdx += begIdx;
+         outNBElement = nbElement;
+      }
+   }
+
+   if( (retValue == TA_TEST_PASS) &&
+       (TA_GraphGetSeries( graph, rsi, &begIdx, &nbElement, &outReal ) != TA_SUCCESS) )
+      retValue = TA_GRAPH_TST_GET_FAIL;
+
+   if( (retValue == TA_TEST_PASS) && ((begIdx != outBegIdx) || (nbElement != outNBElement)) )
+      retValue = TA_GRAPH_TST_BEG_IDX;
+
+   for( i=0; (retValue == TA_TEST_PASS) && (i < nbElement); i++ )
+   {
+      if( outReal[i] != gBuffer[1].out0[i] )
+         retValue = TA_GRAPH_TST_VALUE;
+   }
+
+   TA_GraphFree( graph );
+
+   return retValue;
+}
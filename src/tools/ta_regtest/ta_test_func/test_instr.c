@@ -0,0 +1,208 @@
+/* Description:
+ *     Test the instrumentation (ta_instr.h).
+ *
+ *     The exporters and the merge are always tested, with counters
+ *     set by the test. The counting of the calls through the registry
+ *     is tested only when TA-Lib is built with TA_INSTRUMENT.
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <string.h>
+
+#include "ta_test_priv.h"
+#include "ta_test_func.h"
+#include "ta_utility.h"
+#include "ta_registry.h"
+#include "ta_instr.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+#define EXPORT_SIZE 2048
+
+/**** Local functions declarations.    ****/
+static ErrorNumber testExport( void );
+static ErrorNumber testCounting( const TA_History *history );
+static TA_RetCode callRegistry( const char *name, const TA_History *history,
+                                int startIdx, int endIdx, int *outNBElement );
+static int funcIndex( const char *name );
+
+/**** Local variables definitions.     ****/
+static TA_InstrSnapshot snapshot, total;
+static char text[EXPORT_SIZE];
+static double output[MAX_NB_TEST_ELEMENT];
+
+static const char expectedJSON[] =
+   "{\"functions\":[\n"
+   "{\"name\":\"ACCBANDS\",\"calls\":2,\"inputBars\":300,\"outputBars\":250,\"nanoseconds\":12345678901,\"allocations\":4,\"bytes\":-1},\n"
+   "{\"name\":\"AD\",\"calls\":1,\"inputBars\":0,\"outputBars\":0,\"nanoseconds\":0,\"allocations\":0,\"bytes\":0}\n"
+   "]}\n";
+
+/**** Global functions definitions.   ****/
+ErrorNumber test_func_instr( TA_History *history )
+{
+   ErrorNumber retValue;
+
+   retValue = testExport();
+   if( retValue != TA_TEST_PASS )
+      return retValue;
+
+   if( !TA_InstrEnabled() )
+   {
+      if( (TA_InstrGetSnapshot( &snapshot ) != TA_NOT_SUPPORTED) ||
+          (TA_InstrReset() != TA_NOT_SUPPORTED) )
+         return TA_INSTR_TST_DISABLED;
+      return TA_TEST_PASS;
+   }
+
+   return testCounting( history );
+}
+
+/**** Local functions definitions.     ****/
+static ErrorNumber testExport( void )
+{
+   size_t size, sizeOnly;
+
+   /* Two functions called, the third one is not exported. */
+   memset( &snapshot, 0, sizeof(snapshot) );
+   snapshot.nbFunc = 3;
+   snapshot.func[0].nbCalls       = 1;
+   snapshot.func[0].nbInputBars   = 100;
+   snapshot.func[0].nbOutputBars  = 80;
+   snapshot.func[0].nbNanoseconds = 12345678901;
+   snapshot.func[0].nbAlloc       = 4;
+   snapshot.func[0].nbBytes       = -1;
+   snapshot.func[1].nbCalls       = 1;
+
+   memset( &total, 0, sizeof(total) );
+   if( (TA_InstrMerge( &total, &snapshot ) != TA_SUCCESS) || (total.nbFunc != 3) )
+      return TA_INSTR_TST_MERGE;
+   snapshot.func[1].nbCalls      = 0;
+   snapshot.func[0].nbInputBars  = 200;
+   snapshot.func[0].nbOutputBars = 170;
+   snapshot.func[0].nbNanoseconds = 0;
+   snapshot.func[0].nbAlloc      = 0;
+   snapshot.func[0].nbBytes      = 0;
+   if( TA_InstrMerge( &total, &snapshot ) != TA_SUCCESS )
+      return TA_INSTR_TST_MERGE;
+
+   if( (TA_InstrExport( &total, TA_INSTR_JSON, NULL, 0, &sizeOnly ) != TA_SUCCESS) ||
+       (TA_InstrExport( &total, TA_INSTR_JSON, text, sizeof(text), &size ) != TA_SUCCESS) ||
+       (size != sizeOnly) || (size != strlen( expectedJSON )) ||
+       (strcmp( text, expectedJSON ) != 0) )
+   {
+      printf( "Fail: JSON\n%s\n", text );
+      return TA_INSTR_TST_EXPORT;
+   }
+
+   /* The buffer must hold the final null. */
+   if( TA_InstrExport( &total, TA_INSTR_JSON, text, size, &size ) != TA_BAD_PARAM )
+      return TA_INSTR_TST_EXPORT;
+
+   if( (TA_InstrExport( &total, TA_INSTR_PROMETHEUS, text, sizeof(text), &size ) != TA_SUCCESS) ||
+       !strstr( text, "# TYPE ta_calls_total counter\n" ) ||
+       !strstr( text, "\nta_calls_total{function=\"ACCBANDS\"} 2\n" ) ||
+       !strstr( text, "\nta_nanoseconds_total{function=\"ACCBANDS\"} 12345678901\n" ) ||
+       !strstr( text, "\nta_allocated_bytes_total{function=\"AD\"} 0\n" ) ||
+       strstr( text, "function=\"ADD\"" ) )
+   {
+      printf( "Fail: Prometheus\n%s\n", text );
+      return TA_INSTR_TST_EXPORT;
+   }
+
+   if( (TA_InstrExport( NULL, TA_INSTR_JSON, text, sizeof(text), &size ) != TA_BAD_PARAM) ||
+       (TA_InstrExport( &total, (TA_InstrFormat)-1, text, sizeof(text), &size ) != TA_BAD_PARAM) )
+      return TA_INSTR_TST_EXPORT;
+
+   return TA_TEST_PASS;
+}
+
+static ErrorNumber testCounting( const TA_History *history )
+{
+   const TA_InstrCounters *sma, *dema;
+   int outBegIdx, outNBElement, nbSMA, nbDEMA;
+   int endIdx = (int)history->nbBars-1;
+
+   if( TA_InstrReset() != TA_SUCCESS )
+      return TA_INSTR_TST_COUNT;
+
+   if( (callRegistry( "SMA", history, 0, endIdx, &nbSMA ) != TA_SUCCESS) ||
+       (callRegistry( "SMA", history, 100, endIdx, &outNBElement ) != TA_SUCCESS) ||
+       (callRegistry( "DEMA", history, 0, endIdx, &nbDEMA ) != TA_SUCCESS) )
+      return TA_INSTR_TST_CALL_FAIL;
+   nbSMA += outNBElement;
+
+   /* A failed call is counted, without bars. */
+   if( callRegistry( "SMA", history, 10, 5, &outNBElement ) == TA_SUCCESS )
+      return TA_INSTR_TST_CALL_FAIL;
+
+   /* The direct calls are not counted. */
+   if( TA_SMA( 0, endIdx, history->close, 5, &outBegIdx, &outNBElement, output ) != TA_SUCCESS )
+      return TA_INSTR_TST_CALL_FAIL;
+
+   if( TA_InstrGetSnapshot( &snapshot ) != TA_SUCCESS )
+      return TA_INSTR_TST_COUNT;
+
+   sma  = &snapshot.func[funcIndex( "SMA" )];
+   dema = &snapshot.func[funcIndex( "DEMA" )];
+   if( (sma->nbCalls != 3) ||
+       (sma->nbInputBars != 2*(Int64)endIdx-100+2) ||
+       (sma->nbOutputBars != nbSMA) ||
+       (sma->nbAlloc != 0) || (sma->nbBytes != 0) ||
+       (dema->nbCalls != 1) ||
+       (dema->nbOutputBars != nbDEMA) ||
+       (dema->nbAlloc < 1) || (dema->nbBytes < (Int64)sizeof(double)*nbDEMA) ||
+       (dema->nbNanoseconds <= 0) )
+   {
+      printf( "Fail: SMA calls %d bars %d/%d, DEMA calls %d alloc %d\n",
+              (int)sma->nbCalls, (int)sma->nbInputBars, (int)sma->nbOutputBars,
+              (int)dema->nbCalls, (int)dema->nbAlloc );
+      return TA_INSTR_TST_COUNT;
+   }
+
+   if( (TA_InstrReset() != TA_SUCCESS) ||
+       (TA_InstrGetSnapshot( &snapshot ) != TA_SUCCESS) ||
+       (snapshot.func[funcIndex( "SMA" )].nbCalls != 0) )
+      return TA_INSTR_TST_COUNT;
+
+   return TA_TEST_PASS;
+}
+
+static TA_RetCode callRegistry( const char *name, const TA_History *history,
+                                int startIdx, int endIdx, int *outNBElement )
+{
+   const TA_FuncDef *func = TA_FuncFind( name );
+   const double *inputs[1];
+   double optIn[1];
+   void *outputs[1];
+   int outBegIdx;
+
+   inputs[0]  = history->close;
+   optIn[0]   = 30;
+   outputs[0] = output;
+   *outNBElement = 0;
+
+   return func->call( startIdx, endIdx, inputs, optIn, &outBegIdx, outNBElement, outputs );
+}
+
+/* Index of the counters of a function. */
+static int funcIndex( const char *name )
+{
+   int i;
+
+   for( i=0; i < TA_FuncCount(); i++ )
+   {
+      if( strcmp( TA_FuncAt( i )->name, name ) == 0 )
+         return i;
+   }
+
+   return 0;
+}
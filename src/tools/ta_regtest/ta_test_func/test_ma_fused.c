@@ -0,0 +1,188 @@
+/* Description:
+ *     Test the fused moving averages (ta_mafused.h). Every output
+ *     must be identical to a call to TA_MA for the same type.
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <string.h>
+
+#include "ta_test_priv.h"
+#include "ta_test_func.h"
+#include "ta_utility.h"
+#include "ta_mafused.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+
+/* Longer than the history, so the sweep goes through several chunks. */
+#define NB_BARS 1500
+
+typedef struct
+{
+   int startIdx;
+   int optInTimePeriod;
+   int maTypeMask;
+   TA_Compatibility compatibility;
+   int unstablePeriod;
+} TA_Test;
+
+/**** Local functions declarations.    ****/
+static ErrorNumber do_test( const TA_Test *test, int nbBars );
+
+/**** Local variables definitions.     ****/
+#define ALL      TA_MA_MASK_ALL
+#define EMA_ONLY (TA_MA_MASK(TA_MAType_EMA)|TA_MA_MASK(TA_MAType_DEMA)|TA_MA_MASK(TA_MAType_TEMA))
+#define SUMS     (TA_MA_MASK(TA_MAType_SMA)|TA_MA_MASK(TA_MAType_WMA)|TA_MA_MASK(TA_MAType_TRIMA))
+
+static TA_Test tableTest[] =
+{
+   {    0,   1, ALL,      TA_COMPATIBILITY_DEFAULT,    0 },
+   {    0,   2, ALL,      TA_COMPATIBILITY_DEFAULT,    0 },
+   {    0,   5, ALL,      TA_COMPATIBILITY_DEFAULT,    0 },
+   {    0,  14, ALL,      TA_COMPATIBILITY_DEFAULT,    0 },
+   {    0,  30, ALL,      TA_COMPATIBILITY_DEFAULT,    0 },
+   {  100,  14, ALL,      TA_COMPATIBILITY_DEFAULT,    0 },
+   { 1000,  30, ALL,      TA_COMPATIBILITY_DEFAULT,    0 },
+   {    0,  45, ALL,      TA_COMPATIBILITY_DEFAULT,    0 },
+   {    0, 300, ALL,      TA_COMPATIBILITY_DEFAULT,    0 },
+   {    0,  14, ALL,      TA_COMPATIBILITY_DEFAULT,   20 },
+   {  200,  14, ALL,      TA_COMPATIBILITY_DEFAULT,   20 },
+   {    0,  14, ALL,      TA_COMPATIBILITY_METASTOCK,  0 },
+   {   50,  10, ALL,      TA_COMPATIBILITY_METASTOCK, 15 },
+   {    0,  20, EMA_ONLY, TA_COMPATIBILITY_DEFAULT,    0 },
+   {   70,  20, EMA_ONLY, TA_COMPATIBILITY_DEFAULT,    0 },
+   {    0,   9, SUMS,     TA_COMPATIBILITY_DEFAULT,    0 },
+   {    0,  10, SUMS,     TA_COMPATIBILITY_DEFAULT,    0 },
+   {    0,  20, TA_MA_MASK(TA_MAType_T3), TA_COMPATIBILITY_DEFAULT, 0 },
+   {    0,  20, TA_MA_MASK(TA_MAType_KAMA)|TA_MA_MASK(TA_MAType_MAMA), TA_COMPATIBILITY_DEFAULT, 0 }
+};
+
+#define NB_TEST (sizeof(tableTest)/sizeof(TA_Test))
+
+static double input[NB_BARS];
+static double fusedOut[TA_MA_NB_TYPE][NB_BARS];
+static double expectedOut[NB_BARS];
+
+/**** Global functions definitions.   ****/
+ErrorNumber test_func_ma_fused( TA_History *history )
+{
+   unsigned int i;
+   int t, outBegIdx[TA_MA_NB_TYPE], outNBElement[TA_MA_NB_TYPE];
+   double *outReal[TA_MA_NB_TYPE];
+   ErrorNumber retValue;
+   TA_RetCode retCode;
+   TA_Test test;
+
+   /* The history repeated with a trend. */
+   for( t=0; t < NB_BARS; t++ )
+      input[t] = history->close[t%history->nbBars]*(1.0+t/1000.0);
+
+   for( i=0; i < NB_TEST; i++ )
+   {
+      retValue = do_test( &tableTest[i], NB_BARS );
+      if( retValue != TA_TEST_PASS )
+      {
+         printf( "%s Failed Test #%d (Code=%d)\n", __FILE__, i, retValue );
+         return retValue;
+      }
+   }
+
+   /* The SMA is calculated by TA_SMA with the compensated sums. */
+   TA_SetPrecision( TA_PRECISION_COMPENSATED );
+   test = tableTest[4];
+   retValue = do_test( &test, NB_BARS );
+   TA_SetPrecision( TA_PRECISION_DEFAULT );
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "%s Failed compensated precision (Code=%d)\n", __FILE__, retValue );
+      return retValue;
+   }
+
+   /* Bad parameters. */
+   for( t=0; t < TA_MA_NB_TYPE; t++ )
+      outReal[t] = fusedOut[t];
+
+   if( (TA_MAFused( 0, 100, input, 10, 0, outBegIdx, outNBElement, outReal ) != TA_BAD_PARAM) ||
+       (TA_MAFused( 0, 100, input, 10, TA_MA_MASK(TA_MA_NB_TYPE), outBegIdx, outNBElement, outReal ) != TA_BAD_PARAM) ||
+       (TA_MAFused( 0, 100, input, 0, ALL, outBegIdx, outNBElement, outReal ) != TA_BAD_PARAM) ||
+       (TA_MAFused( 0, 100, NULL, 10, ALL, outBegIdx, outNBElement, outReal ) != TA_BAD_PARAM) ||
+       (TA_MAFused( 10, 9, input, 10, ALL, outBegIdx, outNBElement, outReal ) != TA_OUT_OF_RANGE_END_INDEX) )
+      return TA_MAFUSED_TST_BAD_PARAM;
+
+   /* An output shared with the input or with another output. */
+   outReal[TA_MAType_WMA] = input;
+   retCode = TA_MAFused( 0, 100, input, 10, ALL, outBegIdx, outNBElement, outReal );
+   outReal[TA_MAType_WMA] = outReal[TA_MAType_SMA];
+   if( (retCode != TA_BAD_PARAM) ||
+       (TA_MAFused( 0, 100, input, 10, ALL, outBegIdx, outNBElement, outReal ) != TA_BAD_PARAM) )
+      return TA_MAFUSED_TST_BAD_PARAM;
+
+   /* The unused outputs can be NULL. */
+   outReal[TA_MAType_WMA] = NULL;
+   if( TA_MAFused( 0, 100, input, 10, TA_MA_MASK(TA_MAType_SMA), outBegIdx, outNBElement, outReal ) != TA_SUCCESS )
+      return TA_MAFUSED_TST_BAD_PARAM;
+
+   /* All test succeed. */
+   return TA_TEST_PASS;
+}
+
+/**** Local functions definitions.     ****/
+static ErrorNumber do_test( const TA_Test *test, int nbBars )
+{
+   TA_RetCode retCode;
+   ErrorNumber errNb;
+   int outBegIdx[TA_MA_NB_TYPE], outNBElement[TA_MA_NB_TYPE];
+   double *outReal[TA_MA_NB_TYPE];
+   int type, begIdx, nbElement;
+
+   TA_SetCompatibility( test->compatibility );
+   TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, test->unstablePeriod );
+
+   for( type=0; type < TA_MA_NB_TYPE; type++ )
+   {
+      outReal[type] = fusedOut[type];
+      memset( fusedOut[type], 0, sizeof(fusedOut[type]) );
+   }
+
+   errNb = TA_TEST_PASS;
+   retCode = TA_MAFused( test->startIdx, nbBars-1, input, test->optInTimePeriod,
+                         test->maTypeMask, outBegIdx, outNBElement, outReal );
+   if( retCode != TA_SUCCESS )
+      errNb = TA_MAFUSED_TST_CALL_FAIL;
+
+   for( type=0; (type < TA_MA_NB_TYPE) && (errNb == TA_TEST_PASS); type++ )
+   {
+      if( !(test->maTypeMask & TA_MA_MASK(type)) )
+         continue;
+
+      retCode = TA_MA( test->startIdx, nbBars-1, input, test->optInTimePeriod,
+                       (TA_MAType)type, &begIdx, &nbElement, expectedOut );
+      if( retCode != TA_SUCCESS )
+         errNb = TA_MAFUSED_TST_CALL_FAIL;
+      else if( (begIdx != outBegIdx[type]) || (nbElement != outNBElement[type]) )
+      {
+         printf( "Fail: type %d begIdx %d/%d nbElement %d/%d\n", type,
+                 outBegIdx[type], begIdx, outNBElement[type], nbElement );
+         errNb = TA_MAFUSED_TST_BEG_IDX;
+      }
+      else if( memcmp( fusedOut[type], expectedOut, sizeof(double)*nbElement ) != 0 )
+      {
+         printf( "Fail: type %d not identical to TA_MA\n", type );
+         errNb = TA_MAFUSED_TST_VALUE;
+      }
+   }
+
+   TA_SetCompatibility( TA_COMPATIBILITY_DEFAULT );
+   TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, 0 );
+
+   return errNb;
+}
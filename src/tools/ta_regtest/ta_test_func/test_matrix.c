@@ -0,0 +1,279 @@
+/* Description:
+ *     Test the rolling correlation matrix and the beta vector
+ *     (ta_matrix.h). Every element must be identical to a call
+ *     to TA_CORREL or TA_BETA for the same pair.
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "ta_test_priv.h"
+#include "ta_test_func.h"
+#include "ta_utility.h"
+#include "ta_matrix.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+
+/* More than one tile, the last one partial. */
+#define NB_SERIES (TA_MATRIX_TILE+8)
+
+typedef struct
+{
+   int startIdx;
+   int optInTimePeriod;
+   int nbThread;
+} TA_Test;
+
+/**** Local functions declarations.    ****/
+static void buildSeries( const TA_History *history );
+static ErrorNumber do_test( const TA_History *history, const TA_Test *test );
+static ErrorNumber testBeta( const TA_History *history, const TA_Test *test );
+static ErrorNumber testBadParam( const TA_History *history );
+
+/**** Local variables definitions.     ****/
+static TA_Test tableTest[] =
+{
+   {   0,  1, 1 },
+   {   0, 20, 1 },
+   { 100, 20, 4 },
+   {   0, 30, 4 },
+   { 240, 30, 1 }
+};
+
+#define NB_TEST (sizeof(tableTest)/sizeof(TA_Test))
+
+static double series[NB_SERIES][MAX_NB_TEST_ELEMENT];
+static const double *inReal[NB_SERIES];
+
+/**** Global functions definitions.   ****/
+ErrorNumber test_func_matrix( TA_History *history )
+{
+   unsigned int i;
+   ErrorNumber retValue;
+
+   buildSeries( history );
+
+   for( i=0; i < NB_TEST; i++ )
+   {
+      retValue = do_test( history, &tableTest[i] );
+      if( retValue == TA_TEST_PASS )
+         retValue = testBeta( history, &tableTest[i] );
+      if( retValue != TA_TEST_PASS )
+      {
+         printf( "%s Failed Test #%d (Code=%d)\n", __FILE__, i, retValue );
+         return retValue;
+      }
+   }
+
+   retValue = testBadParam( history );
+   if( retValue != TA_TEST_PASS )
+      return retValue;
+
+   /* All test succeed. */
+   return TA_TEST_PASS;
+}
+
+/**** Local functions definitions.     ****/
+
+/* Each price component, scaled and shifted in time, so all
+ * the pairs have a different correlation.
+ */
+static void buildSeries( const TA_History *history )
+{
+   const double *component;
+   int i, t, nbBars;
+
+   nbBars = (int)history->nbBars;
+   for( i=0; i < NB_SERIES; i++ )
+   {
+      switch( i%4 )
+      {
+      case 0:  component = history->close; break;
+      case 1:  component = history->high;  break;
+      case 2:  component = history->low;   break;
+      default: component = history->volume;
+      }
+      for( t=0; t < nbBars; t++ )
+         series[i][t] = component[(t+i)%nbBars]*(1.0+i/10.0);
+      inReal[i] = series[i];
+   }
+}
+
+static ErrorNumber do_test( const TA_History *history, const TA_Test *test )
+{
+   TA_RetCode retCode;
+   ErrorNumber errNb;
+   double *outCorrel, *outCovar;
+   double sumX, sumY, sumXY, cov;
+   int outBegIdx, outNBElement, begIdx, nbElement;
+   int i, j, k, t, endIdx, idx;
+
+   endIdx = history->nbBars-1;
+   outCorrel = (double *)TA_Malloc( sizeof(double)*NB_SERIES*NB_SERIES*history->nbBars );
+   outCovar  = (double *)TA_Malloc( sizeof(double)*NB_SERIES*NB_SERIES*history->nbBars );
+   if( !outCorrel || !outCovar )
+   {
+      FREE_IF_NOT_NULL( outCorrel );
+      FREE_IF_NOT_NULL( outCovar );
+      return TA_TESTUTIL_TFRR_BAD_PARAM;
+   }
+
+   errNb = TA_TEST_PASS;
+   retCode = TA_CorrelMatrix( test->startIdx, endIdx, NB_SERIES, inReal,
+                              test->optInTimePeriod, test->nbThread,
+                              &outBegIdx, &outNBElement, outCorrel, outCovar );
+   if( retCode != TA_SUCCESS )
+      errNb = TA_MATRIX_TST_CALL_FAIL;
+
+   for( i=0; (i < NB_SERIES) && (errNb == TA_TEST_PASS); i++ )
+   {
+      for( j=i; (j < NB_SERIES) && (errNb == TA_TEST_PASS); j++ )
+      {
+         retCode = TA_CORREL( test->startIdx, endIdx, inReal[i], inReal[j],
+                              test->optInTimePeriod, &begIdx, &nbElement,
+                              gBuffer[0].out0 );
+         if( retCode != TA_SUCCESS )
+         {
+            errNb = TA_MATRIX_TST_CALL_FAIL;
+            break;
+         }
+         if( (begIdx != outBegIdx) || (nbElement != outNBElement) )
+         {
+            errNb = TA_MATRIX_TST_CORREL;
+            break;
+         }
+
+         for( t=0; t < nbElement; t++ )
+         {
+            idx = (t*NB_SERIES+i)*NB_SERIES+j;
+
+            /* Identical to TA_CORREL, and symmetric. */
+            if( (outCorrel[idx] != gBuffer[0].out0[t]) ||
+                (outCorrel[(t*NB_SERIES+j)*NB_SERIES+i] != outCorrel[idx]) )
+            {
+               printf( "Fail: correl(%d,%d)[%d] = %g (expected %g)\n",
+                       i, j, t, outCorrel[idx], gBuffer[0].out0[t] );
+               errNb = TA_MATRIX_TST_CORREL;
+               break;
+            }
+
+            /* Covariance calculated directly. */
+            sumX = sumY = sumXY = 0.0;
+            for( k=begIdx+t-test->optInTimePeriod+1; k <= begIdx+t; k++ )
+            {
+               sumX  += inReal[i][k];
+               sumY  += inReal[j][k];
+               sumXY += inReal[i][k]*inReal[j][k];
+            }
+            cov = (sumXY-(sumX*sumY)/test->optInTimePeriod)/test->optInTimePeriod;
+            if( (outCovar[(t*NB_SERIES+j)*NB_SERIES+i] != outCovar[idx]) ||
+                (fabs(outCovar[idx]-cov) > 1e-6*(fabs(cov)+1.0)) )
+            {
+               printf( "Fail: covar(%d,%d)[%d] = %g (expected %g)\n",
+                       i, j, t, outCovar[idx], cov );
+               errNb = TA_MATRIX_TST_COVAR;
+               break;
+            }
+         }
+      }
+   }
+
+   /* Only the correlation requested. */
+   if( errNb == TA_TEST_PASS )
+   {
+      retCode = TA_CorrelMatrix( test->startIdx, endIdx, NB_SERIES, inReal,
+                                 test->optInTimePeriod, test->nbThread,
+                                 &begIdx, &nbElement, outCovar, NULL );
+      if( (retCode != TA_SUCCESS) || (begIdx != outBegIdx) || (nbElement != outNBElement) )
+         errNb = TA_MATRIX_TST_CALL_FAIL;
+      else if( memcmp( outCovar, outCorrel, sizeof(double)*NB_SERIES*NB_SERIES*nbElement ) != 0 )
+         errNb = TA_MATRIX_TST_CORREL;
+   }
+
+   TA_Free( outCorrel );
+   TA_Free( outCovar );
+
+   return errNb;
+}
+
+static ErrorNumber testBeta( const TA_History *history, const TA_Test *test )
+{
+   TA_RetCode retCode;
+   ErrorNumber errNb;
+   double *outBeta;
+   int outBegIdx, outNBElement, begIdx, nbElement;
+   int i, t, endIdx;
+
+   endIdx = history->nbBars-1;
+   outBeta = (double *)TA_Malloc( sizeof(double)*NB_SERIES*history->nbBars );
+   if( !outBeta )
+      return TA_TESTUTIL_TFRR_BAD_PARAM;
+
+   errNb = TA_TEST_PASS;
+   retCode = TA_BetaVector( test->startIdx, endIdx, NB_SERIES, inReal, history->close,
+                            test->optInTimePeriod, test->nbThread,
+                            &outBegIdx, &outNBElement, outBeta );
+   if( retCode != TA_SUCCESS )
+      errNb = TA_MATRIX_TST_CALL_FAIL;
+
+   for( i=0; (i < NB_SERIES) && (errNb == TA_TEST_PASS); i++ )
+   {
+      retCode = TA_BETA( test->startIdx, endIdx, history->close, inReal[i],
+                         test->optInTimePeriod, &begIdx, &nbElement, gBuffer[0].out0 );
+      if( retCode != TA_SUCCESS )
+         errNb = TA_MATRIX_TST_CALL_FAIL;
+      else if( (begIdx != outBegIdx) || (nbElement != outNBElement) )
+         errNb = TA_MATRIX_TST_BETA;
+
+      for( t=0; (t < nbElement) && (errNb == TA_TEST_PASS); t++ )
+      {
+         if( outBeta[t*NB_SERIES+i] != gBuffer[0].out0[t] )
+         {
+            printf( "Fail: beta(%d)[%d] = %g (expected %g)\n",
+                    i, t, outBeta[t*NB_SERIES+i], gBuffer[0].out0[t] );
+            errNb = TA_MATRIX_TST_BETA;
+         }
+      }
+   }
+
+   TA_Free( outBeta );
+
+   return errNb;
+}
+
+static ErrorNumber testBadParam( const TA_History *history )
+{
+   int outBegIdx, outNBElement;
+   int endIdx = history->nbBars-1;
+   const double *nullInput[2];
+
+   nullInput[0] = history->close;
+   nullInput[1] = NULL;
+
+   if( (TA_CorrelMatrix( 0, endIdx, 2, inReal, 10, 1, &outBegIdx, &outNBElement, NULL, NULL ) != TA_BAD_PARAM) ||
+       (TA_CorrelMatrix( 0, endIdx, 0, inReal, 10, 1, &outBegIdx, &outNBElement, gBuffer[0].out0, NULL ) != TA_BAD_PARAM) ||
+       (TA_CorrelMatrix( 0, endIdx, 2, nullInput, 10, 1, &outBegIdx, &outNBElement, gBuffer[0].out0, NULL ) != TA_BAD_PARAM) ||
+       (TA_CorrelMatrix( 0, endIdx, 2, inReal, 0, 1, &outBegIdx, &outNBElement, gBuffer[0].out0, NULL ) != TA_BAD_PARAM) ||
+       (TA_CorrelMatrix( 10, 9, 2, inReal, 10, 1, &outBegIdx, &outNBElement, gBuffer[0].out0, NULL ) != TA_OUT_OF_RANGE_END_INDEX) ||
+       (TA_BetaVector( 0, endIdx, 2, inReal, NULL, 10, 1, &outBegIdx, &outNBElement, gBuffer[0].out0 ) != TA_BAD_PARAM) ||
+       (TA_BetaVector( 0, endIdx, 2, inReal, history->close, 10, 1, &outBegIdx, &outNBElement, NULL ) != TA_BAD_PARAM) )
+      return TA_MATRIX_TST_BAD_PARAM;
+
+   /* Nothing to calculate. */
+   if( (TA_CorrelMatrix( 0, 5, 2, inReal, 10, 1, &outBegIdx, &outNBElement, gBuffer[0].out0, NULL ) != TA_SUCCESS) ||
+       (outBegIdx != 0) || (outNBElement != 0) )
+      return TA_MATRIX_TST_BAD_PARAM;
+
+   return TA_TEST_PASS;
+}
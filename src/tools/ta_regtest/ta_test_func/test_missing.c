@@ -0,0 +1,412 @@
+/* Description:
+ *     Test the missing bars policies (see TA_SetMissingPolicy) and the
+ *     functions with a validity bitmap (ta_missing.h).
+ *
+ *     Without missing bar, every policy must give the values of
+ *     TA_MISSING_NONE, bit for bit.
+ *
+ *     With missing bars, the expected values are calculated with
+ *     TA_MISSING_NONE on the input cleaned the way of the policy: the
+ *     bars not missing packed together (skip), the last value repeated
+ *     (carry forward), or each run of bars not missing on its own
+ *     (reset). The values must be identical, with the missing bars given
+ *     as NaN, or as a bitmap with any value in the missing bars.
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "ta_test_priv.h"
+#include "ta_test_func.h"
+#include "ta_missing.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+typedef enum
+{
+   MISSING_SMA,
+   MISSING_EMA,
+   MISSING_WMA,
+   MISSING_VAR,
+   MISSING_STDDEV,
+   MISSING_BBANDS,
+   NB_MISSING_FUNC
+} TA_MissingFunc;
+
+static const char *funcName[NB_MISSING_FUNC] = { "SMA", "EMA", "WMA", "VAR", "STDDEV", "BBANDS" };
+
+#define NB_BAR_MAX MAX_NB_TEST_ELEMENT
+
+/**** Local functions declarations.    ****/
+static TA_RetCode callFunc( TA_MissingFunc func, int startIdx, int endIdx, const double *in,
+                            int period, int *outBegIdx, int *outNBElement, double *out );
+static TA_RetCode callMasked( TA_MissingFunc func, int startIdx, int endIdx, const double *in,
+                              const unsigned char *inValid, int period, int *outBegIdx,
+                              int *outNBElement, double *out, unsigned char *outValid );
+static int isMissing( int idx );
+static ErrorNumber expectedValues( TA_MissingFunc func, TA_MissingPolicy policy, const double *in,
+                                   int nbBar, int period, double *expected );
+static ErrorNumber compare( const char *what, TA_MissingFunc func, TA_MissingPolicy policy,
+                            const double *out, const double *expected, int nbValue, int exact );
+static ErrorNumber testNoMissing( const double *close, int nbBar );
+static ErrorNumber testPolicy( const double *close, int nbBar, TA_MissingPolicy policy );
+static ErrorNumber testBadParam( const double *close, int nbBar );
+
+/**** Local variables definitions.     ****/
+static double inBuffer[NB_BAR_MAX];
+static double outBuffer[NB_BAR_MAX];
+static double expectedBuffer[NB_BAR_MAX];
+static double packedIn[NB_BAR_MAX];
+static double packedOut[NB_BAR_MAX];
+static int    packedPos[NB_BAR_MAX];
+static unsigned char inValid[NB_BAR_MAX/8+1];
+static unsigned char outValid[NB_BAR_MAX/8+1];
+
+static int nbLeading;
+
+static const int periodTest[] = { 2, 10, 20 };
+#define NB_PERIOD_TEST (sizeof(periodTest)/sizeof(int))
+
+/**** Global functions definitions.   ****/
+ErrorNumber test_func_missing( TA_History *history )
+{
+   static const TA_MissingPolicy policy[] = { TA_MISSING_NONE, TA_MISSING_SKIP,
+                                              TA_MISSING_CARRY_FORWARD, TA_MISSING_RESET };
+   ErrorNumber retValue;
+   int nbBar;
+   unsigned int i;
+
+   nbBar = (int)history->nbBars;
+   if( nbBar > NB_BAR_MAX )
+      nbBar = NB_BAR_MAX;
+
+   retValue = testNoMissing( history->close, nbBar );
+
+   for( i=0; (i < sizeof(policy)/sizeof(TA_MissingPolicy)) && (retValue == TA_TEST_PASS); i++ )
+      retValue = testPolicy( history->close, nbBar, policy[i] );
+
+   if( retValue == TA_TEST_PASS )
+      retValue = testBadParam( history->close, nbBar );
+
+   /* The following tests use the default. */
+   TA_SetMissingPolicy( TA_MISSING_NONE );
+
+   return retValue;
+}
+
+/**** Local functions definitions.     ****/
+
+/* A few isolated bars, a run longer than the periods and, except
+ * with TA_MISSING_NONE, the first bars.
+ */
+static int isMissing( int idx )
+{
+   return (idx < nbLeading) || ((idx % 37) == 5) || ((idx >= 120) && (idx < 142)) || (idx == 143);
+}
+
+static TA_RetCode callFunc( TA_MissingFunc func, int startIdx, int endIdx, const double *in,
+                            int period, int *outBegIdx, int *outNBElement, double *out )
+{
+   static double band[2][NB_BAR_MAX];
+
+   switch( func )
+   {
+   case MISSING_SMA:
+      return TA_SMA( startIdx, endIdx, in, period, outBegIdx, outNBElement, out );
+   case MISSING_EMA:
+      return TA_EMA( startIdx, endIdx, in, period, outBegIdx, outNBElement, out );
+   case MISSING_WMA:
+      return TA_WMA( startIdx, endIdx, in, period, outBegIdx, outNBElement, out );
+   case MISSING_VAR:
+      return TA_VAR( startIdx, endIdx, in, period, 1.0, outBegIdx, outNBElement, out );
+   case MISSING_STDDEV:
+      return TA_STDDEV( startIdx, endIdx, in, period, 1.5, outBegIdx, outNBElement, out );
+   default:
+      /* The upper band. */
+      return TA_BBANDS( startIdx, endIdx, in, period, 2.0, 2.0, TA_MAType_SMA,
+                        outBegIdx, outNBElement, out, band[0], band[1] );
+   }
+}
+
+static TA_RetCode callMasked( TA_MissingFunc func, int startIdx, int endIdx, const double *in,
+                              const unsigned char *inBits, int period, int *outBegIdx,
+                              int *outNBElement, double *out, unsigned char *outBits )
+{
+   switch( func )
+   {
+   case MISSING_SMA:
+      return TA_MaskedSMA( startIdx, endIdx, in, inBits, period, outBegIdx, outNBElement, out, outBits );
+   case MISSING_EMA:
+      return TA_MaskedEMA( startIdx, endIdx, in, inBits, period, outBegIdx, outNBElement, out, outBits );
+   case MISSING_WMA:
+      return TA_MaskedWMA( startIdx, endIdx, in, inBits, period, outBegIdx, outNBElement, out, outBits );
+   case MISSING_VAR:
+      return TA_MaskedVAR( startIdx, endIdx, in, inBits, period, 1.0, outBegIdx, outNBElement, out, outBits );
+   case MISSING_STDDEV:
+      return TA_MaskedSTDDEV( startIdx, endIdx, in, inBits, period, 1.5, outBegIdx, outNBElement, out, outBits );
+   default:
+      return TA_FUNC_NOT_FOUND;
+   }
+}
+
+/* The values of the function at all the bars for the policy, by
+ * TA_MISSING_NONE on the parts of the input cleaned the way of the
+ * policy.
+ */
+static ErrorNumber expectedValues( TA_MissingFunc func, TA_MissingPolicy policy, const double *in,
+                                   int nbBar, int period, double *expected )
+{
+   TA_RetCode retCode;
+   int i, j, nbPacked, outBegIdx, outNBElement, lastValid;
+
+   for( i=0; i < nbBar; i++ )
+      expected[i] = NAN;
+
+   i = 0;
+   while( i < nbBar )
+   {
+      /* Pack the next part. */
+      nbPacked = 0;
+      lastValid = -1;
+      for( ; i < nbBar; i++ )
+      {
+         if( !isMissing( i ) )
+         {
+            packedPos[nbPacked] = i;
+            packedIn[nbPacked++] = in[i];
+            lastValid = i;
+         }
+         else if( (policy == TA_MISSING_CARRY_FORWARD) && (lastValid >= 0) )
+         {
+            packedPos[nbPacked] = i;
+            packedIn[nbPacked++] = in[lastValid];
+         }
+         else if( ((policy == TA_MISSING_RESET) && (nbPacked > 0)) || (policy == TA_MISSING_NONE) )
+            break;
+      }
+      if( policy == TA_MISSING_NONE )
+         i = nbBar;
+
+      if( nbPacked > 0 )
+      {
+         TA_SetMissingPolicy( TA_MISSING_NONE );
+         retCode = callFunc( func, 0, nbPacked-1, packedIn, period, &outBegIdx, &outNBElement, packedOut );
+         TA_SetMissingPolicy( policy );
+         if( retCode != TA_SUCCESS )
+            return TA_MISSING_TST_CALL_FAIL;
+
+         for( j=0; j < outNBElement; j++ )
+            expected[packedPos[outBegIdx+j]] = packedOut[j];
+      }
+   }
+
+   return TA_TEST_PASS;
+}
+
+/* Identical, or close when the sums are not done in the same order
+ * (BBANDS, of which the standard deviation is calculated differently
+ * with missing bars, and a later start), NaN included.
+ */
+static ErrorNumber compare( const char *what, TA_MissingFunc func, TA_MissingPolicy policy,
+                            const double *out, const double *expected, int nbValue, int exact )
+{
+   int i, same;
+
+   for( i=0; i < nbValue; i++ )
+   {
+      if( isnan( out[i] ) || isnan( expected[i] ) )
+         same = isnan( out[i] ) && isnan( expected[i] );
+      else if( exact )
+         same = out[i] == expected[i];
+      else
+         same = fabs( out[i]-expected[i] ) <= 1e-9*(1.0+fabs( expected[i] ));
+
+      if( !same )
+      {
+         printf( "Fail: %s %s policy %d, output %d is %.17g (expected %.17g)\n",
+                 what, funcName[func], (int)policy, i, out[i], expected[i] );
+         return TA_MISSING_TST_VALUE;
+      }
+   }
+
+   return TA_TEST_PASS;
+}
+
+static ErrorNumber testNoMissing( const double *close, int nbBar )
+{
+   static const TA_MissingPolicy policy[] = { TA_MISSING_SKIP, TA_MISSING_CARRY_FORWARD,
+                                              TA_MISSING_RESET };
+   static const int startTest[] = { 0, 1, 25, 200 };
+   TA_RetCode retCode;
+   ErrorNumber retValue;
+   int func, p, s, k, begIdx, nbElement, outBegIdx, outNBElement;
+
+   for( func=0; func < NB_MISSING_FUNC; func++ )
+   {
+      for( p=0; p < (int)NB_PERIOD_TEST; p++ )
+      {
+         for( s=0; s < (int)(sizeof(startTest)/sizeof(int)); s++ )
+         {
+            TA_SetMissingPolicy( TA_MISSING_NONE );
+            retCode = callFunc( (TA_MissingFunc)func, startTest[s], nbBar-1, close, periodTest[p],
+                                &begIdx, &nbElement, expectedBuffer );
+            if( retCode != TA_SUCCESS )
+               return TA_MISSING_TST_CALL_FAIL;
+
+            for( k=0; k < (int)(sizeof(policy)/sizeof(TA_MissingPolicy)); k++ )
+            {
+               /* In place. */
+               memcpy( outBuffer, close, sizeof(double)*nbBar );
+               TA_SetMissingPolicy( policy[k] );
+               retCode = callFunc( (TA_MissingFunc)func, startTest[s], nbBar-1, outBuffer, periodTest[p],
+                                   &outBegIdx, &outNBElement, outBuffer );
+               if( retCode != TA_SUCCESS )
+                  return TA_MISSING_TST_CALL_FAIL;
+               if( (outBegIdx != begIdx) || (outNBElement != nbElement) )
+               {
+                  printf( "Fail: %s policy %d, range [%d,%d] (expected [%d,%d])\n", funcName[func],
+                          (int)policy[k], outBegIdx, outNBElement, begIdx, nbElement );
+                  return TA_MISSING_TST_RANGE;
+               }
+               retValue = compare( "no missing bar", (TA_MissingFunc)func, policy[k], outBuffer,
+                                   expectedBuffer, nbElement, func != MISSING_BBANDS );
+               if( retValue != TA_TEST_PASS )
+                  return retValue;
+            }
+         }
+      }
+   }
+
+   return TA_TEST_PASS;
+}
+
+static ErrorNumber testPolicy( const double *close, int nbBar, TA_MissingPolicy policy )
+{
+   TA_RetCode retCode;
+   ErrorNumber retValue;
+   int func, p, i, lookback, outBegIdx, outNBElement, startIdx, isValid;
+
+   nbLeading = (policy == TA_MISSING_NONE)? 0 : 2;
+   memset( inValid, 0, sizeof(inValid) );
+   for( i=0; i < nbBar; i++ )
+   {
+      if( !isMissing( i ) )
+         inValid[i >> 3] |= (unsigned char)(1 << (i & 7));
+   }
+
+   for( func=0; func < NB_MISSING_FUNC; func++ )
+   {
+      for( p=0; p < (int)NB_PERIOD_TEST; p++ )
+      {
+         if( (func == MISSING_STDDEV) || (func == MISSING_BBANDS) )
+            lookback = TA_STDDEV_Lookback( periodTest[p], 1.0 );
+         else if( func == MISSING_EMA )
+            lookback = TA_EMA_Lookback( periodTest[p] );
+         else
+            lookback = periodTest[p]-1;
+
+         TA_SetMissingPolicy( policy );
+         retValue = expectedValues( (TA_MissingFunc)func, policy, close, nbBar, periodTest[p], expectedBuffer );
+         if( retValue != TA_TEST_PASS )
+            return retValue;
+
+         /* The missing bars as NaN, in place. The policy NONE is
+          * only tested with a bitmap: the NaN are the default case.
+          */
+         if( policy != TA_MISSING_NONE )
+         {
+            for( i=0; i < nbBar; i++ )
+               outBuffer[i] = isMissing( i )? NAN : close[i];
+            retCode = callFunc( (TA_MissingFunc)func, 0, nbBar-1, outBuffer, periodTest[p],
+                                &outBegIdx, &outNBElement, outBuffer );
+            if( retCode != TA_SUCCESS )
+               return TA_MISSING_TST_CALL_FAIL;
+            if( (outBegIdx != lookback) || (outNBElement != nbBar-lookback) )
+               return TA_MISSING_TST_RANGE;
+            retValue = compare( "NaN", (TA_MissingFunc)func, policy, outBuffer, &expectedBuffer[lookback],
+                                outNBElement, func != MISSING_BBANDS );
+            if( retValue != TA_TEST_PASS )
+               return retValue;
+         }
+
+         if( func == MISSING_BBANDS )
+            continue;
+
+         /* A bitmap, any value in the missing bars. */
+         for( i=0; i < nbBar; i++ )
+            inBuffer[i] = isMissing( i )? ((i & 1)? NAN : 1.0e300) : close[i];
+         memset( outValid, 0xA5, sizeof(outValid) );
+         retCode = callMasked( (TA_MissingFunc)func, 0, nbBar-1, inBuffer, inValid, periodTest[p],
+                               &outBegIdx, &outNBElement, outBuffer, outValid );
+         if( retCode != TA_SUCCESS )
+            return TA_MISSING_TST_CALL_FAIL;
+         if( (outBegIdx != lookback) || (outNBElement != nbBar-lookback) )
+            return TA_MISSING_TST_RANGE;
+         retValue = compare( "bitmap", (TA_MissingFunc)func, policy, outBuffer, &expectedBuffer[lookback],
+                             outNBElement, 1 );
+         if( retValue != TA_TEST_PASS )
+            return retValue;
+         for( i=0; i < outNBElement; i++ )
+         {
+            isValid = (outValid[i >> 3] >> (i & 7)) & 1;
+            if( isValid != !isnan( expectedBuffer[lookback+i] ) )
+            {
+               printf( "Fail: %s policy %d, bit of output %d is %d\n", funcName[func], (int)policy, i, isValid );
+               return TA_MISSING_TST_VALIDITY;
+            }
+         }
+
+         /* The windows from a later start are the same, with the
+          * rounding of other running sums. Not for the EMA, which
+          * depends of where it starts, and not for TA_MISSING_NONE,
+          * where only the bars read count.
+          */
+         if( (func == MISSING_EMA) || (policy == TA_MISSING_NONE) )
+            continue;
+         startIdx = 150;
+         retCode = callMasked( (TA_MissingFunc)func, startIdx, nbBar-1, inBuffer, inValid, periodTest[p],
+                               &outBegIdx, &outNBElement, outBuffer, NULL );
+         if( retCode != TA_SUCCESS )
+            return TA_MISSING_TST_CALL_FAIL;
+         if( (outBegIdx != startIdx) || (outNBElement != nbBar-startIdx) )
+            return TA_MISSING_TST_RANGE;
+         retValue = compare( "start 150", (TA_MissingFunc)func, policy, outBuffer, &expectedBuffer[startIdx],
+                             outNBElement, 0 );
+         if( retValue != TA_TEST_PASS )
+            return retValue;
+      }
+   }
+
+   return TA_TEST_PASS;
+}
+
+static ErrorNumber testBadParam( const double *close, int nbBar )
+{
+   int outBegIdx, outNBElement;
+
+   if( TA_SetMissingPolicy( (TA_MissingPolicy)4 ) != TA_BAD_PARAM )
+      return TA_MISSING_TST_BAD_PARAM;
+   if( TA_SetMissingPolicy( TA_MISSING_RESET ) != TA_SUCCESS )
+      return TA_MISSING_TST_BAD_PARAM;
+   if( TA_GetMissingPolicy() != TA_MISSING_RESET )
+      return TA_MISSING_TST_BAD_PARAM;
+
+   if( TA_MaskedSMA( 0, nbBar-1, close, NULL, 10, &outBegIdx, &outNBElement, outBuffer, NULL ) != TA_BAD_PARAM )
+      return TA_MISSING_TST_BAD_PARAM;
+   if( TA_MaskedEMA( 0, nbBar-1, close, inValid, 1, &outBegIdx, &outNBElement, outBuffer, NULL ) != TA_BAD_PARAM )
+      return TA_MISSING_TST_BAD_PARAM;
+   if( TA_MaskedVAR( 5, 4, close, inValid, 10, 1.0, &outBegIdx, &outNBElement, outBuffer, NULL ) != TA_OUT_OF_RANGE_END_INDEX )
+      return TA_MISSING_TST_BAD_PARAM;
+
+   return TA_TEST_PASS;
+}
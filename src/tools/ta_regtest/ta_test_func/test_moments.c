@@ -0,0 +1,307 @@
+/* Description:
+ *     Test MOMENTS, ZSCORE, SKEW and KURT against a brute force
+ *     calculation (two passes on the whole window for each output).
+ *
+ *     Two long generated series make the accumulator start again
+ *     from the window for all its reasons: a trend (drift of the
+ *     mean, bars), and spikes around a constant followed by a small
+ *     noise (drop of M2, the mean staying on the shift).
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "ta_test_priv.h"
+#include "ta_test_func.h"
+#include "ta_utility.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+typedef struct
+{
+   int input;
+   int startIdx;
+   int optInTimePeriod;
+} TA_Test;
+
+/* The input series used by the tests. */
+typedef enum
+{
+   INPUT_CLOSE,
+   INPUT_TIES,   /* Close rounded, many windows of equal values. */
+   INPUT_NAN,    /* Close with a NaN. */
+   INPUT_LONG,   /* Generated, trend then small noise. */
+   INPUT_SPIKES, /* Generated, +-100 around 1000 then small noise. */
+   NB_INPUT
+} TA_TestInput;
+
+typedef enum
+{
+   OUT_MEAN,
+   OUT_VAR,
+   OUT_STDDEV,
+   OUT_SKEW,
+   OUT_KURT,
+   OUT_ZSCORE,
+   NB_OUT
+} TA_TestOutput;
+
+#define NAN_IDX 120
+#define NB_LONG 20000
+
+/**** Local functions declarations.    ****/
+static ErrorNumber do_test( const TA_Test *test );
+static void bruteForce( const double *input, int today, int period, double expected[NB_OUT] );
+static int isClose( int out, double value, double expected, double variance );
+
+/**** Local variables definitions.     ****/
+static TA_Test tableTest[] =
+{
+   { INPUT_CLOSE,    0,    2 },
+   { INPUT_CLOSE,    0,    3 },
+   { INPUT_CLOSE,    0,    5 },
+   { INPUT_CLOSE,  100,   14 },
+   { INPUT_CLOSE,    0,   20 },
+   { INPUT_CLOSE,    0,  252 },
+   { INPUT_TIES,     0,    2 },
+   { INPUT_TIES,     0,    5 },
+   { INPUT_TIES,    10,   20 },
+   { INPUT_NAN,      0,    5 },
+   { INPUT_NAN,    110,   20 },
+   { INPUT_LONG,     0,    5 },
+   { INPUT_LONG,     0,   30 },
+   { INPUT_LONG, 9000,  100 },
+   { INPUT_LONG,     0, 5000 },
+   { INPUT_SPIKES,   0,   10 },
+   { INPUT_SPIKES,   0,  500 }
+};
+
+#define NB_TEST (sizeof(tableTest)/sizeof(TA_Test))
+
+static double inputs[NB_INPUT][NB_LONG];
+static int    nbInputBars[NB_INPUT];
+static double outputs[NB_OUT][NB_LONG];
+static double single[NB_LONG];
+static double inPlace[NB_LONG];
+
+/**** Global functions definitions.   ****/
+ErrorNumber test_func_moments( TA_History *history )
+{
+   unsigned int i, seed;
+   int t, nbBars;
+   double price, noise;
+   ErrorNumber retValue;
+   int outBegIdx, outNBElement;
+
+   nbBars = (int)history->nbBars;
+   for( t=0; t < nbBars; t++ )
+   {
+      inputs[INPUT_CLOSE][t] = history->close[t];
+      inputs[INPUT_TIES][t]  = std_floor(history->close[t]/4.0);
+      inputs[INPUT_NAN][t]   = history->close[t];
+   }
+   inputs[INPUT_NAN][NAN_IDX] = sqrt(-1.0);
+   nbInputBars[INPUT_CLOSE] = nbInputBars[INPUT_TIES] = nbInputBars[INPUT_NAN] = nbBars;
+
+   /* Random walk around 1000 with a trend, its noise divided by 10000
+    * after 3/4 of the bars.
+    */
+   seed  = 1;
+   price = 1000.0;
+   for( t=0; t < NB_LONG; t++ )
+   {
+      seed  = seed*1103515245u + 12345u;
+      noise = ((seed >> 8) & 0xFFFF)/32768.0-1.0;
+      if( t < NB_LONG*3/4 )
+         price += 0.05+noise;
+      else
+         price += noise*0.0001;
+      inputs[INPUT_LONG][t] = price;
+
+      if( t < NB_LONG/2 )
+         inputs[INPUT_SPIKES][t] = (t & 1)? 1100.0 : 900.0;
+      else
+         inputs[INPUT_SPIKES][t] = 1000.0+noise*0.001;
+   }
+   nbInputBars[INPUT_LONG] = nbInputBars[INPUT_SPIKES] = NB_LONG;
+
+   for( i=0; i < NB_TEST; i++ )
+   {
+      retValue = do_test( &tableTest[i] );
+      if( retValue != TA_TEST_PASS )
+      {
+         printf( "%s Failed Test #%d (Code=%d)\n", __FILE__, i, retValue );
+         return retValue;
+      }
+   }
+
+   /* Out of range parameters. */
+   if( (TA_MOMENTS( 0, 10, inputs[0], 1, &outBegIdx, &outNBElement, outputs[0], outputs[1],
+                    outputs[2], outputs[3], outputs[4], outputs[5] ) != TA_BAD_PARAM) ||
+       (TA_MOMENTS( 0, 10, inputs[0], 5, &outBegIdx, &outNBElement, outputs[0], outputs[1],
+                    outputs[2], outputs[3], NULL, outputs[5] ) != TA_BAD_PARAM) ||
+       (TA_ZSCORE( 0, 10, inputs[0], 1, &outBegIdx, &outNBElement, single ) != TA_BAD_PARAM) ||
+       (TA_SKEW( 0, 10, inputs[0], 100001, &outBegIdx, &outNBElement, single ) != TA_BAD_PARAM) ||
+       (TA_KURT( 0, 10, inputs[0], 5, &outBegIdx, &outNBElement, NULL ) != TA_BAD_PARAM) ||
+       (TA_MOMENTS_Lookback( TA_INTEGER_DEFAULT ) != 19) ||
+       (TA_KURT_Lookback( 10 ) != 9) )
+      return TA_MOMENTS_TST_BAD_PARAM;
+
+   /* All test succeed. */
+   return TA_TEST_PASS;
+}
+
+/**** Local functions definitions.     ****/
+static ErrorNumber do_test( const TA_Test *test )
+{
+   TA_RetCode retCode;
+   const double *input;
+   int nbBars, outBegIdx, outNBElement, i, out, today;
+   double expected[NB_OUT];
+
+   input  = inputs[test->input];
+   nbBars = nbInputBars[test->input];
+
+   retCode = TA_MOMENTS( test->startIdx, nbBars-1, input, test->optInTimePeriod,
+                         &outBegIdx, &outNBElement, outputs[OUT_MEAN], outputs[OUT_VAR],
+                         outputs[OUT_STDDEV], outputs[OUT_SKEW], outputs[OUT_KURT],
+                         outputs[OUT_ZSCORE] );
+   if( retCode != TA_SUCCESS )
+      return TA_MOMENTS_TST_CALL_FAIL;
+
+   if( (outBegIdx != max(test->startIdx, test->optInTimePeriod-1)) ||
+       (outNBElement != nbBars-outBegIdx) )
+      return TA_MOMENTS_TST_BEG_IDX;
+
+   for( i=0; i < outNBElement; i++ )
+   {
+      today = outBegIdx+i;
+      bruteForce( input, today, test->optInTimePeriod, expected );
+      for( out=0; out < NB_OUT; out++ )
+      {
+         if( expected[out] != expected[out] )
+         {
+            if( outputs[out][i] == outputs[out][i] )
+               return TA_MOMENTS_TST_NAN;
+         }
+         else if( !isClose( out, outputs[out][i], expected[out], expected[OUT_VAR] ) )
+         {
+            printf( "Fail: output %d bar %d = %.17g (expected %.17g)\n",
+                    out, today, outputs[out][i], expected[out] );
+            return TA_MOMENTS_TST_VALUE;
+         }
+      }
+   }
+
+   /* The functions of a single output are the same kernel. */
+   retCode = TA_ZSCORE( test->startIdx, nbBars-1, input, test->optInTimePeriod,
+                        &outBegIdx, &outNBElement, single );
+   if( (retCode != TA_SUCCESS) || (memcmp( single, outputs[OUT_ZSCORE], sizeof(double)*outNBElement ) != 0) )
+      return TA_MOMENTS_TST_SAME;
+   retCode = TA_SKEW( test->startIdx, nbBars-1, input, test->optInTimePeriod,
+                      &outBegIdx, &outNBElement, single );
+   if( (retCode != TA_SUCCESS) || (memcmp( single, outputs[OUT_SKEW], sizeof(double)*outNBElement ) != 0) )
+      return TA_MOMENTS_TST_SAME;
+   retCode = TA_KURT( test->startIdx, nbBars-1, input, test->optInTimePeriod,
+                      &outBegIdx, &outNBElement, single );
+   if( (retCode != TA_SUCCESS) || (memcmp( single, outputs[OUT_KURT], sizeof(double)*outNBElement ) != 0) )
+      return TA_MOMENTS_TST_SAME;
+
+   /* Same result when an output is the input. */
+   memcpy( inPlace, input, sizeof(double)*nbBars );
+   retCode = TA_KURT( test->startIdx, nbBars-1, inPlace, test->optInTimePeriod,
+                      &outBegIdx, &outNBElement, inPlace );
+   if( (retCode != TA_SUCCESS) || (memcmp( inPlace, outputs[OUT_KURT], sizeof(double)*outNBElement ) != 0) )
+      return TA_MOMENTS_TST_SAME;
+
+   memcpy( inPlace, input, sizeof(double)*nbBars );
+   retCode = TA_MOMENTS( test->startIdx, nbBars-1, inPlace, test->optInTimePeriod,
+                         &outBegIdx, &outNBElement, inPlace, single, single,
+                         single, single, single );
+   if( (retCode != TA_SUCCESS) || (memcmp( inPlace, outputs[OUT_MEAN], sizeof(double)*outNBElement ) != 0) )
+      return TA_MOMENTS_TST_SAME;
+
+   return TA_TEST_PASS;
+}
+
+/* Two passes on the window, in long double. */
+static void bruteForce( const double *input, int today, int period, double expected[NB_OUT] )
+{
+   long double mean, delta, m2, m3, m4, variance, stdDev;
+   int i, out, allSame;
+
+   allSame = 1;
+   for( i=today-period+1; i <= today; i++ )
+   {
+      if( input[i] != input[i] )
+      {
+         for( out=0; out < NB_OUT; out++ )
+            expected[out] = sqrt(-1.0);
+         return;
+      }
+      if( input[i] != input[today] )
+         allSame = 0;
+   }
+
+   if( allSame )
+   {
+      expected[OUT_MEAN] = input[today];
+      for( out=OUT_VAR; out < NB_OUT; out++ )
+         expected[out] = 0.0;
+      return;
+   }
+
+   mean = 0.0;
+   for( i=today-period+1; i <= today; i++ )
+      mean += input[i];
+   mean /= period;
+
+   m2 = m3 = m4 = 0.0;
+   for( i=today-period+1; i <= today; i++ )
+   {
+      delta = input[i]-mean;
+      m2 += delta*delta;
+      m3 += delta*delta*delta;
+      m4 += delta*delta*delta*delta;
+   }
+
+   variance = m2/period;
+   stdDev   = sqrtl(variance);
+   expected[OUT_MEAN]   = (double)mean;
+   expected[OUT_VAR]    = (double)variance;
+   expected[OUT_STDDEV] = (double)stdDev;
+   expected[OUT_SKEW]   = (double)((m3/period)/(variance*stdDev));
+   expected[OUT_KURT]   = (double)((m4/period)/(variance*variance)-3.0);
+   expected[OUT_ZSCORE] = (double)((input[today]-mean)/stdDev);
+}
+
+/* Equal within the rounding, the exact values of the windows of
+ * equal values included. The variance is relative to itself, the
+ * ratios relative to 1.
+ */
+static int isClose( int out, double value, double expected, double variance )
+{
+   if( variance == 0.0 )
+      return value == expected;
+
+   switch( out )
+   {
+   case OUT_MEAN:
+      return fabs(value-expected) <= 1e-12*fabs(expected);
+   case OUT_VAR:
+   case OUT_STDDEV:
+      return fabs(value-expected) <= 1e-10*fabs(expected);
+   default:
+      return fabs(value-expected) <= 1e-8*(1.0+fabs(expected));
+   }
+}
@@ -0,0 +1,327 @@
+/* Description:
+ *     Test the EMA, RSI, ATR, KAMA and T3 of a panel of symbols
+ *     (ta_panel.h). The values of each symbol must be identical to
+ *     the call to the function for this symbol alone.
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "ta_test_priv.h"
+#include "ta_test_func.h"
+#include "ta_utility.h"
+#include "ta_panel.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+
+/* A full group of 16*TA_PANEL_LANES symbols, a group of two blocks
+ * and a partial block.
+ */
+#define NB_SYMBOLS (18*TA_PANEL_LANES+3)
+
+typedef enum
+{
+   PANEL_EMA,
+   PANEL_RSI,
+   PANEL_ATR,
+   PANEL_KAMA,
+   PANEL_T3
+} TA_PanelFunc;
+
+typedef struct
+{
+   TA_PanelFunc func;
+   int startIdx;
+   int optInTimePeriod;
+   int nbSymbols;
+   int unstablePeriod;
+   TA_Compatibility compatibility;
+   TA_Precision precision;
+} TA_Test;
+
+/**** Local functions declarations.    ****/
+static void buildSeries( const TA_History *history );
+static ErrorNumber do_test( const TA_History *history, const TA_Test *test );
+static TA_RetCode callPanel( const TA_Test *test, int endIdx, int isInPlace,
+                             int *outBegIdx, int *outNBElement, double outReal[] );
+static TA_RetCode callSymbol( const TA_Test *test, int endIdx, int symbol,
+                              int *outBegIdx, int *outNBElement, double outReal[] );
+static ErrorNumber testUnpack( const TA_History *history );
+static ErrorNumber testBadParam( const TA_History *history );
+
+/**** Local variables definitions.     ****/
+static TA_Test tableTest[] =
+{
+   { PANEL_EMA,   0, 10, NB_SYMBOLS, 0,  TA_COMPATIBILITY_DEFAULT,   TA_PRECISION_DEFAULT },
+   { PANEL_EMA,  50,  2, 3,          0,  TA_COMPATIBILITY_DEFAULT,   TA_PRECISION_DEFAULT },
+   { PANEL_EMA,   0, 20, NB_SYMBOLS, 0,  TA_COMPATIBILITY_METASTOCK, TA_PRECISION_DEFAULT },
+   { PANEL_EMA,   0, 12, NB_SYMBOLS, 30, TA_COMPATIBILITY_DEFAULT,   TA_PRECISION_DEFAULT },
+   { PANEL_RSI,   0, 14, NB_SYMBOLS, 0,  TA_COMPATIBILITY_DEFAULT,   TA_PRECISION_DEFAULT },
+   { PANEL_RSI,  30,  2, 5,          0,  TA_COMPATIBILITY_DEFAULT,   TA_PRECISION_DEFAULT },
+   { PANEL_RSI,   0, 14, NB_SYMBOLS, 0,  TA_COMPATIBILITY_METASTOCK, TA_PRECISION_DEFAULT },
+   { PANEL_RSI,  20, 14, NB_SYMBOLS, 25, TA_COMPATIBILITY_DEFAULT,   TA_PRECISION_DEFAULT },
+   { PANEL_ATR,   0, 14, NB_SYMBOLS, 0,  TA_COMPATIBILITY_DEFAULT,   TA_PRECISION_DEFAULT },
+   { PANEL_ATR,   0,  1, NB_SYMBOLS, 0,  TA_COMPATIBILITY_DEFAULT,   TA_PRECISION_DEFAULT },
+   { PANEL_ATR,  40, 20, 7,          10, TA_COMPATIBILITY_DEFAULT,   TA_PRECISION_DEFAULT },
+   { PANEL_ATR,   0, 14, NB_SYMBOLS, 0,  TA_COMPATIBILITY_DEFAULT,   TA_PRECISION_COMPENSATED },
+   { PANEL_KAMA,  0, 10, NB_SYMBOLS, 0,  TA_COMPATIBILITY_DEFAULT,   TA_PRECISION_DEFAULT },
+   { PANEL_KAMA, 60, 30, NB_SYMBOLS, 20, TA_COMPATIBILITY_DEFAULT,   TA_PRECISION_DEFAULT },
+   { PANEL_KAMA,  0,  2, 1,          0,  TA_COMPATIBILITY_DEFAULT,   TA_PRECISION_DEFAULT },
+   { PANEL_T3,    0,  5, NB_SYMBOLS, 0,  TA_COMPATIBILITY_DEFAULT,   TA_PRECISION_DEFAULT },
+   { PANEL_T3,   45,  2, 4,          0,  TA_COMPATIBILITY_DEFAULT,   TA_PRECISION_DEFAULT },
+   { PANEL_T3,    0, 10, NB_SYMBOLS, 15, TA_COMPATIBILITY_DEFAULT,   TA_PRECISION_DEFAULT }
+};
+
+#define NB_TEST (sizeof(tableTest)/sizeof(TA_Test))
+
+/* [price component][symbol][bar], and the same packed in panels. */
+static double series[3][NB_SYMBOLS][MAX_NB_TEST_ELEMENT];
+static double panel[3][MAX_NB_TEST_ELEMENT*NB_SYMBOLS];
+static double inPlace[MAX_NB_TEST_ELEMENT*NB_SYMBOLS];
+static double outPanel[MAX_NB_TEST_ELEMENT*NB_SYMBOLS];
+
+/**** Global functions definitions.   ****/
+ErrorNumber test_func_panel( TA_History *history )
+{
+   unsigned int i;
+   ErrorNumber retValue;
+
+   buildSeries( history );
+
+   for( i=0; i < NB_TEST; i++ )
+   {
+      TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, tableTest[i].unstablePeriod );
+      TA_SetCompatibility( tableTest[i].compatibility );
+      TA_SetPrecision( tableTest[i].precision );
+
+      retValue = do_test( history, &tableTest[i] );
+
+      TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, 0 );
+      TA_SetCompatibility( TA_COMPATIBILITY_DEFAULT );
+      TA_SetPrecision( TA_PRECISION_DEFAULT );
+
+      if( retValue != TA_TEST_PASS )
+      {
+         printf( "%s Failed Test #%d (Code=%d)\n", __FILE__, i, retValue );
+         return retValue;
+      }
+   }
+
+   retValue = testUnpack( history );
+   if( retValue != TA_TEST_PASS )
+      return retValue;
+
+   retValue = testBadParam( history );
+   if( retValue != TA_TEST_PASS )
+      return retValue;
+
+   /* All test succeed. */
+   return TA_TEST_PASS;
+}
+
+/**** Local functions definitions.     ****/
+
+/* The high, low and close of each symbol, scaled and shifted in
+ * time, so each symbol is different.
+ */
+static void buildSeries( const TA_History *history )
+{
+   const double *component[3];
+   const double *inSeries[NB_SYMBOLS];
+   int c, i, t, nbBars;
+
+   component[0] = history->high;
+   component[1] = history->low;
+   component[2] = history->close;
+
+   nbBars = (int)history->nbBars;
+   for( c=0; c < 3; c++ )
+   {
+      for( i=0; i < NB_SYMBOLS; i++ )
+      {
+         for( t=0; t < nbBars; t++ )
+            series[c][i][t] = component[c][(t+3*i)%nbBars]*(1.0+i/10.0);
+         inSeries[i] = series[c][i];
+      }
+      TA_PanelPack( NB_SYMBOLS, nbBars, inSeries, panel[c] );
+   }
+}
+
+static ErrorNumber do_test( const TA_History *history, const TA_Test *test )
+{
+   TA_RetCode retCode;
+   int outBegIdx, outNBElement, begIdx, nbElement;
+   int i, t, endIdx, isInPlace;
+   double *out;
+
+   endIdx = history->nbBars-1;
+
+   for( isInPlace=0; isInPlace < 2; isInPlace++ )
+   {
+      out = isInPlace? inPlace : outPanel;
+      retCode = callPanel( test, endIdx, isInPlace, &outBegIdx, &outNBElement, out );
+      if( retCode != TA_SUCCESS )
+         return TA_PANEL_TST_CALL_FAIL;
+
+      for( i=0; i < test->nbSymbols; i++ )
+      {
+         retCode = callSymbol( test, endIdx, i, &begIdx, &nbElement, gBuffer[0].out0 );
+         if( retCode != TA_SUCCESS )
+            return TA_PANEL_TST_CALL_FAIL;
+         if( (begIdx != outBegIdx) || (nbElement != outNBElement) )
+         {
+            printf( "Fail: symbol %d begIdx %d nbElement %d (expected %d %d)\n",
+                    i, outBegIdx, outNBElement, begIdx, nbElement );
+            return TA_PANEL_TST_BEG_IDX;
+         }
+
+         /* Bit identical to the function. */
+         for( t=0; t < nbElement; t++ )
+         {
+            if( memcmp( &out[t*test->nbSymbols+i], &gBuffer[0].out0[t], sizeof(double) ) != 0 )
+            {
+               printf( "Fail: symbol %d [%d] = %.17g (expected %.17g)%s\n",
+                       i, t, out[t*test->nbSymbols+i], gBuffer[0].out0[t],
+                       isInPlace? " in place" : "" );
+               return isInPlace? TA_PANEL_TST_INPLACE : TA_PANEL_TST_VALUE;
+            }
+         }
+      }
+   }
+
+   return TA_TEST_PASS;
+}
+
+/* The panels of this call have test->nbSymbols symbols, built from
+ * the first ones. In place, the output is the close (or the input).
+ */
+static TA_RetCode callPanel( const TA_Test *test, int endIdx, int isInPlace,
+                             int *outBegIdx, int *outNBElement, double outReal[] )
+{
+   static double in[3][MAX_NB_TEST_ELEMENT*NB_SYMBOLS];
+   const double *inClose;
+   int c, i, t;
+
+   for( c=0; c < 3; c++ )
+   {
+      for( t=0; t <= endIdx; t++ )
+      {
+         for( i=0; i < test->nbSymbols; i++ )
+            in[c][t*test->nbSymbols+i] = panel[c][t*NB_SYMBOLS+i];
+      }
+   }
+   inClose = in[2];
+   if( isInPlace )
+   {
+      memcpy( outReal, in[2], sizeof(double)*(endIdx+1)*test->nbSymbols );
+      inClose = outReal;
+   }
+
+   switch( test->func )
+   {
+   case PANEL_EMA:
+      return TA_PanelEMA( test->startIdx, endIdx, test->nbSymbols, inClose,
+                          test->optInTimePeriod, outBegIdx, outNBElement, outReal );
+   case PANEL_RSI:
+      return TA_PanelRSI( test->startIdx, endIdx, test->nbSymbols, inClose,
+                          test->optInTimePeriod, outBegIdx, outNBElement, outReal );
+   case PANEL_ATR:
+      return TA_PanelATR( test->startIdx, endIdx, test->nbSymbols, in[0], in[1], inClose,
+                          test->optInTimePeriod, outBegIdx, outNBElement, outReal );
+   case PANEL_KAMA:
+      return TA_PanelKAMA( test->startIdx, endIdx, test->nbSymbols, inClose,
+                           test->optInTimePeriod, outBegIdx, outNBElement, outReal );
+   default:
+      return TA_PanelT3( test->startIdx, endIdx, test->nbSymbols, inClose,
+                         test->optInTimePeriod, 0.7, outBegIdx, outNBElement, outReal );
+   }
+}
+
+static TA_RetCode callSymbol( const TA_Test *test, int endIdx, int symbol,
+                              int *outBegIdx, int *outNBElement, double outReal[] )
+{
+   const double *inHigh  = series[0][symbol];
+   const double *inLow   = series[1][symbol];
+   const double *inClose = series[2][symbol];
+
+   switch( test->func )
+   {
+   case PANEL_EMA:
+      return TA_EMA( test->startIdx, endIdx, inClose, test->optInTimePeriod,
+                     outBegIdx, outNBElement, outReal );
+   case PANEL_RSI:
+      return TA_RSI( test->startIdx, endIdx, inClose, test->optInTimePeriod,
+                     outBegIdx, outNBElement, outReal );
+   case PANEL_ATR:
+      return TA_ATR( test->startIdx, endIdx, inHigh, inLow, inClose, test->optInTimePeriod,
+                     outBegIdx, outNBElement, outReal );
+   case PANEL_KAMA:
+      return TA_KAMA( test->startIdx, endIdx, inClose, test->optInTimePeriod,
+                      outBegIdx, outNBElement, outReal );
+   default:
+      return TA_T3( test->startIdx, endIdx, inClose, test->optInTimePeriod, 0.7,
+                    outBegIdx, outNBElement, outReal );
+   }
+}
+
+/* TA_PanelUnpack gives back the series packed by buildSeries. */
+static ErrorNumber testUnpack( const TA_History *history )
+{
+   static double unpacked[NB_SYMBOLS][MAX_NB_TEST_ELEMENT];
+   double *outSeries[NB_SYMBOLS];
+   int i;
+
+   for( i=0; i < NB_SYMBOLS; i++ )
+      outSeries[i] = unpacked[i];
+
+   if( TA_PanelUnpack( NB_SYMBOLS, history->nbBars, panel[2], outSeries ) != TA_SUCCESS )
+      return TA_PANEL_TST_CALL_FAIL;
+
+   for( i=0; i < NB_SYMBOLS; i++ )
+   {
+      if( memcmp( unpacked[i], series[2][i], sizeof(double)*history->nbBars ) != 0 )
+         return TA_PANEL_TST_VALUE;
+   }
+
+   return TA_TEST_PASS;
+}
+
+static ErrorNumber testBadParam( const TA_History *history )
+{
+   int outBegIdx, outNBElement;
+   int endIdx = history->nbBars-1;
+   const double *inSeries[2];
+
+   if( (TA_PanelEMA( 0, endIdx, 0, panel[2], 10, &outBegIdx, &outNBElement, outPanel ) != TA_BAD_PARAM) ||
+       (TA_PanelEMA( 0, endIdx, 2, NULL, 10, &outBegIdx, &outNBElement, outPanel ) != TA_BAD_PARAM) ||
+       (TA_PanelRSI( 0, endIdx, 2, panel[2], 1, &outBegIdx, &outNBElement, outPanel ) != TA_BAD_PARAM) ||
+       (TA_PanelATR( 0, endIdx, 2, panel[0], NULL, panel[2], 14, &outBegIdx, &outNBElement, outPanel ) != TA_BAD_PARAM) ||
+       (TA_PanelKAMA( 0, endIdx, 2, panel[2], 10, &outBegIdx, &outNBElement, NULL ) != TA_BAD_PARAM) ||
+       (TA_PanelT3( 0, endIdx, 2, panel[2], 5, 1.5, &outBegIdx, &outNBElement, outPanel ) != TA_BAD_PARAM) ||
+       (TA_PanelT3( 10, 9, 2, panel[2], 5, 0.7, &outBegIdx, &outNBElement, outPanel ) != TA_OUT_OF_RANGE_END_INDEX) )
+      return TA_PANEL_TST_BAD_PARAM;
+
+   inSeries[0] = series[2][0];
+   inSeries[1] = NULL;
+   if( (TA_PanelPack( 2, endIdx+1, inSeries, outPanel ) != TA_BAD_PARAM) ||
+       (TA_PanelUnpack( 0, endIdx+1, panel[2], NULL ) != TA_BAD_PARAM) )
+      return TA_PANEL_TST_BAD_PARAM;
+
+   /* Nothing to calculate. */
+   if( (TA_PanelKAMA( 0, 5, 2, panel[2], 10, &outBegIdx, &outNBElement, outPanel ) != TA_SUCCESS) ||
+       (outBegIdx != 0) || (outNBElement != 0) )
+      return TA_PANEL_TST_BAD_PARAM;
+
+   return TA_TEST_PASS;
+}
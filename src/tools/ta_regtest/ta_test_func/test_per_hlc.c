@@ -130,6 +130,13 @@ static TA_Test tableTest[] =
    { 0, TA_CCI_TEST, 186,187,  2, 0, 0, TA_SUCCESS,   1, 0.0, 186,  2 },
    { 0, TA_CCI_TEST, 187,187,  2, 0, 0, TA_SUCCESS,   0, 0.0, 187,  1 },
  
+   /* Long periods, calculated with the sorted window (TA_OrdStat). */
+   { 1, TA_CCI_TEST, 0, 251, 200, 0, 0, TA_SUCCESS,       0,  -8.6024, 199, 252-199 },
+   { 0, TA_CCI_TEST, 0, 251, 200, 0, 0, TA_SUCCESS,      26, -10.5284, 199, 252-199 },
+   { 0, TA_CCI_TEST, 0, 251, 200, 0, 0, TA_SUCCESS, 252-200, -24.6708, 199, 252-199 },
+   { 1, TA_CCI_TEST, 0, 251, 230, 0, 0, TA_SUCCESS,       0, -18.7749, 229, 252-229 },
+   { 0, TA_CCI_TEST, 0, 251, 230, 0, 0, TA_SUCCESS, 252-230,  -5.5798, 229, 252-229 },
+
    /* Test period 2, 5 and 11 */
    { 0, TA_CCI_TEST, 0, 251,  2, 0, 0, TA_SUCCESS,  0, 66.666, 1,  252-1 },
    { 1, TA_CCI_TEST, 0, 251,  5, 0, 0, TA_SUCCESS,  0, 18.857, 4,  252-4 },
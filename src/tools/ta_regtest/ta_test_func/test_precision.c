@@ -0,0 +1,718 @@
+/* Description:
+ *     Test TA_PRECISION_COMPENSATED and TA_PRECISION_PREFIX_SUM (see
+ *     TA_SetPrecision).
+ *
+ *     On the reference history, the compensated results must be
+ *     close to the default ones, and the input/output can still be
+ *     the same buffer.
+ *
+ *     On a long synthetic series where the prices go from 1000000
+ *     down to 1, the compensated results must stay within a fixed
+ *     error bound of an exact calculation of each window, no matter
+ *     how many bars were processed before. The variance and the
+ *     standard deviation of the bands must also stay within the bound
+ *     on a series whose scale jumps by up to 1e18.
+ *
+ *     The prefix sums are done by blocks: on a series long enough for
+ *     many blocks, the functions using them must stay close to the
+ *     default results, also in place.
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "ta_test_priv.h"
+#include "ta_test_func.h"
+#include "ta_utility.h"
+#include "ta_stream.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+typedef enum
+{
+   TA_SMA_TEST,
+   TA_VAR_TEST,
+   TA_STDDEV_TEST,
+   TA_CORREL_TEST,
+   TA_BETA_TEST,
+   TA_ACCBANDS_TEST,
+   TA_OBV_TEST,
+   TA_AD_TEST,
+   NB_PRECISION_TEST
+} TA_TestId;
+
+/* The inputs of a test, output written in outReal. */
+typedef struct
+{
+   const double *close;
+   const double *close2;
+   const double *high;
+   const double *low;
+   const double *volume;
+   int nbBars;
+} TA_Inputs;
+
+#define NB_LONG_BARS   1000000
+#define LONG_PERIOD    30
+#define SAMPLE_STEP    997
+
+/* Blocks of bars at each scale. */
+#define NB_SCALE_BARS  2000
+#define NB_SCALE       4
+
+/* The functions using the prefix sums. */
+typedef enum
+{
+   PREFIX_SMA,
+   PREFIX_VAR,
+   PREFIX_STDDEV,
+   PREFIX_BBANDS,
+   PREFIX_BBDIST,
+   PREFIX_BBWIDTH,
+   PREFIX_ACCBANDS,
+   PREFIX_SMAEXT,
+   NB_PREFIX_TEST
+} TA_PrefixTestId;
+
+/* Several blocks of TA_WINSUM_BLOCK bars, and several direct
+ * sums of the windows.
+ */
+#define NB_PREFIX_BARS 20000
+
+/* Sum of doubles kept as an unevaluated sum hi+lo (double-double),
+ * used for the exact reference.
+ */
+typedef struct
+{
+   double hi;
+   double lo;
+} ExactSum;
+
+/**** Local functions declarations.    ****/
+static TA_RetCode callFunc( TA_TestId id, int startIdx, const TA_Inputs *inputs,
+                            int optInTimePeriod, int *outBegIdx, int *outNBElement,
+                            double *outReal );
+static ErrorNumber testHistory( const TA_History *history );
+static ErrorNumber testStream( const TA_History *history );
+static ErrorNumber testLongSeries( void );
+static ErrorNumber testScaleJumps( void );
+static TA_RetCode callPrefixFunc( TA_PrefixTestId id, int startIdx, const TA_Inputs *inputs,
+                                  int optInTimePeriod, int *outBegIdx, int *outNBElement,
+                                  double *outReal, double *outOther );
+static ErrorNumber testPrefixSum( void );
+static void exactAdd( ExactSum *sum, double value );
+static double exactValue( const ExactSum *sum );
+static double nextRandom( unsigned int *seed );
+
+/**** Local variables definitions.     ****/
+static const double scaleJump[NB_SCALE] = { 1e9, 1e-6, 1e12, 1e-3 };
+
+static const int prefixPeriod[] = { 2, 20, 600, 5000 };
+
+/* Largest relative difference with the default results. The variance
+ * is the difference of two means of squares: its error is relative to
+ * the square of the prices, and the functions dividing by the
+ * standard deviation of a window of 2 bars make it much larger.
+ */
+static const double prefixTolerance[NB_PREFIX_TEST] =
+{ 1e-12, 1e-8, 1e-5, 1e-6, 1e-1, 1e-4, 1e-12, 1e-12 };
+
+#define NB_PREFIX_PERIOD ((int)(sizeof(prefixPeriod)/sizeof(int)))
+
+/**** Global functions definitions.   ****/
+ErrorNumber test_func_precision( TA_History *history )
+{
+   ErrorNumber retValue;
+
+   if( (TA_GetPrecision() != TA_PRECISION_DEFAULT) ||
+       (TA_SetPrecision( (TA_Precision)3 ) != TA_BAD_PARAM) ||
+       (TA_GetPrecision() != TA_PRECISION_DEFAULT) )
+      return TA_PRECISION_TST_SETTING;
+
+   retValue = testHistory( history );
+   if( retValue == TA_TEST_PASS )
+      retValue = testStream( history );
+   if( retValue == TA_TEST_PASS )
+      retValue = testLongSeries();
+   if( retValue == TA_TEST_PASS )
+      retValue = testScaleJumps();
+   if( retValue == TA_TEST_PASS )
+      retValue = testPrefixSum();
+
+   TA_SetPrecision( TA_PRECISION_DEFAULT );
+
+   return retValue;
+}
+
+/**** Local functions definitions.     ****/
+static TA_RetCode callFunc( TA_TestId id, int startIdx, const TA_Inputs *inputs,
+                            int optInTimePeriod, int *outBegIdx, int *outNBElement,
+                            double *outReal )
+{
+   int endIdx = inputs->nbBars-1;
+
+   switch( id )
+   {
+   case TA_SMA_TEST:
+      return TA_SMA( startIdx, endIdx, inputs->close, optInTimePeriod,
+                     outBegIdx, outNBElement, outReal );
+   case TA_VAR_TEST:
+      return TA_VAR( startIdx, endIdx, inputs->close, optInTimePeriod, 1.0,
+                     outBegIdx, outNBElement, outReal );
+   case TA_STDDEV_TEST:
+      return TA_STDDEV( startIdx, endIdx, inputs->close, optInTimePeriod, 1.0,
+                        outBegIdx, outNBElement, outReal );
+   case TA_CORREL_TEST:
+      return TA_CORREL( startIdx, endIdx, inputs->close, inputs->close2, optInTimePeriod,
+                        outBegIdx, outNBElement, outReal );
+   case TA_BETA_TEST:
+      return TA_BETA( startIdx, endIdx, inputs->close2, inputs->close, optInTimePeriod,
+                      outBegIdx, outNBElement, outReal );
+   case TA_ACCBANDS_TEST:
+      /* Only the middle band is checked, the other ones are in gBuffer[4]. */
+      return TA_ACCBANDS( startIdx, endIdx, inputs->high, inputs->low, inputs->close,
+                          optInTimePeriod, outBegIdx, outNBElement,
+                          gBuffer[4].out0, outReal, gBuffer[4].out1 );
+   case TA_OBV_TEST:
+      return TA_OBV( startIdx, endIdx, inputs->close, inputs->volume,
+                     outBegIdx, outNBElement, outReal );
+   default:
+      return TA_AD( startIdx, endIdx, inputs->high, inputs->low, inputs->close,
+                    inputs->volume, outBegIdx, outNBElement, outReal );
+   }
+}
+
+static ErrorNumber testHistory( const TA_History *history )
+{
+   TA_Inputs inputs;
+   TA_RetCode retCode;
+   int id, i, startIdx, outBegIdx, outNBElement, begIdx, nbElement;
+
+   inputs.close  = history->close;
+   inputs.close2 = history->high;
+   inputs.high   = history->high;
+   inputs.low    = history->low;
+   inputs.volume = history->volume;
+   inputs.nbBars = (int)history->nbBars;
+
+   for( id=0; id < NB_PRECISION_TEST; id++ )
+   {
+      for( startIdx=0; startIdx <= 100; startIdx += 100 )
+      {
+         TA_SetPrecision( TA_PRECISION_DEFAULT );
+         retCode = callFunc( (TA_TestId)id, startIdx, &inputs, 20,
+                             &outBegIdx, &outNBElement, gBuffer[0].out0 );
+         if( retCode != TA_SUCCESS )
+            return TA_PRECISION_TST_CALL_FAIL;
+
+         TA_SetPrecision( TA_PRECISION_COMPENSATED );
+         retCode = callFunc( (TA_TestId)id, startIdx, &inputs, 20,
+                             &begIdx, &nbElement, gBuffer[1].out0 );
+         if( retCode != TA_SUCCESS )
+            return TA_PRECISION_TST_CALL_FAIL;
+
+         if( (begIdx != outBegIdx) || (nbElement != outNBElement) )
+            return TA_PRECISION_TST_HISTORY;
+
+         for( i=0; i < nbElement; i++ )
+         {
+            if( !TA_REAL_EQ( gBuffer[1].out0[i], gBuffer[0].out0[i],
+                             1e-8*(std_fabs(gBuffer[0].out0[i])+1.0) ) )
+            {
+               printf( "Fail: test %d output %d = %.12g (default %.12g)\n",
+                       id, i, gBuffer[1].out0[i], gBuffer[0].out0[i] );
+               return TA_PRECISION_TST_HISTORY;
+            }
+         }
+
+         /* Same result when the close is also the output. */
+         memcpy( gBuffer[2].in, history->close, sizeof(double)*inputs.nbBars );
+         inputs.close = gBuffer[2].in;
+         retCode = callFunc( (TA_TestId)id, startIdx, &inputs, 20,
+                             &begIdx, &nbElement, gBuffer[2].in );
+         inputs.close = history->close;
+         if( retCode != TA_SUCCESS )
+            return TA_PRECISION_TST_CALL_FAIL;
+         if( memcmp( gBuffer[2].in, gBuffer[1].out0, sizeof(double)*nbElement ) != 0 )
+            return TA_PRECISION_TST_INPLACE;
+      }
+   }
+
+   return TA_TEST_PASS;
+}
+
+/* The streaming SMA captures the precision and gives
+ * the same values as TA_SMA.
+ */
+static ErrorNumber testStream( const TA_History *history )
+{
+   TA_StreamState state;
+   TA_RetCode retCode;
+   TA_Bar bar;
+   int i, outBegIdx, outNBElement, nbElement;
+   double value;
+
+   TA_SetPrecision( TA_PRECISION_COMPENSATED );
+   retCode = TA_SMA( 0, history->nbBars-1, history->close, 20,
+                     &outBegIdx, &outNBElement, gBuffer[0].out0 );
+   if( retCode != TA_SUCCESS )
+      return TA_PRECISION_TST_CALL_FAIL;
+
+   retCode = TA_StreamInit( &state, TA_STREAM_SMA, 20 );
+   if( retCode != TA_SUCCESS )
+      return TA_PRECISION_TST_CALL_FAIL;
+   TA_SetPrecision( TA_PRECISION_DEFAULT );
+
+   memset( &bar, 0, sizeof(bar) );
+   for( i=0; i < (int)history->nbBars; i++ )
+   {
+      bar.close = history->close[i];
+      retCode = TA_StreamUpdate( &state, &bar, &nbElement, &value );
+      if( (retCode != TA_SUCCESS) ||
+          (nbElement != (i >= outBegIdx)) ||
+          (nbElement && (value != gBuffer[0].out0[i-outBegIdx])) )
+      {
+         TA_StreamFree( &state );
+         return TA_PRECISION_TST_STREAM;
+      }
+   }
+
+   TA_StreamFree( &state );
+
+   return TA_TEST_PASS;
+}
+
+static ErrorNumber testLongSeries( void )
+{
+   TA_Inputs inputs;
+   TA_RetCode retCode;
+   ErrorNumber errNb;
+   ExactSum sumX, sumY, sumXX, sumXY, sumYY;
+   double *buffer, *close, *close2, *high, *low, *volume, *outReal;
+   double trend, noise, x, y, meanX, meanY, expected, error;
+   double changeX[LONG_PERIOD], changeY[LONG_PERIOD];
+   unsigned int seed;
+   int id, t, k, outBegIdx, outNBElement;
+
+   buffer = (double *)TA_Malloc( sizeof(double)*NB_LONG_BARS*6 );
+   if( !buffer )
+      return TA_PRECISION_TST_ALLOC;
+
+   close   = buffer;
+   close2  = buffer+NB_LONG_BARS;
+   high    = buffer+2*NB_LONG_BARS;
+   low     = buffer+3*NB_LONG_BARS;
+   volume  = buffer+4*NB_LONG_BARS;
+   outReal = buffer+5*NB_LONG_BARS;
+
+   /* Prices going down from 1000000 to 1 with some noise. */
+   seed  = 1234;
+   noise = 0.0;
+   for( t=0; t < NB_LONG_BARS; t++ )
+   {
+      trend = std_log(1000000.0)*(1.0-(double)t/NB_LONG_BARS);
+      noise = 0.99*noise + 0.01*(nextRandom(&seed)-0.5);
+      close[t]  = std_exp( trend+noise );
+      close2[t] = std_exp( trend+0.5*noise+0.005*(nextRandom(&seed)-0.5) );
+      high[t]   = close[t]*(1.0+0.01*nextRandom(&seed));
+      low[t]    = close[t]*(1.0-0.01*nextRandom(&seed));
+      volume[t] = 1000.0+10000000.0*nextRandom(&seed);
+   }
+
+   inputs.close  = close;
+   inputs.close2 = close2;
+   inputs.high   = high;
+   inputs.low    = low;
+   inputs.volume = volume;
+   inputs.nbBars = NB_LONG_BARS;
+
+   TA_SetPrecision( TA_PRECISION_COMPENSATED );
+   errNb = TA_TEST_PASS;
+   for( id=0; (id < NB_PRECISION_TEST) && (errNb == TA_TEST_PASS); id++ )
+   {
+      if( (id == TA_STDDEV_TEST) || (id == TA_ACCBANDS_TEST) )
+         continue; /* Same sums as VAR and SMA. */
+
+      retCode = callFunc( (TA_TestId)id, 0, &inputs, LONG_PERIOD,
+                          &outBegIdx, &outNBElement, outReal );
+      if( (retCode != TA_SUCCESS) || (outBegIdx+outNBElement != NB_LONG_BARS) )
+      {
+         errNb = TA_PRECISION_TST_CALL_FAIL;
+         break;
+      }
+
+      /* Exact calculation of the window of some outputs,
+       * the last one being the farthest from the start.
+       */
+      for( t=NB_LONG_BARS-1; t >= outBegIdx+LONG_PERIOD; t -= SAMPLE_STEP )
+      {
+         memset( &sumX, 0, sizeof(sumX) );
+         memset( &sumY, 0, sizeof(sumY) );
+         for( k=0; k < LONG_PERIOD; k++ )
+         {
+            x = close[t-k];
+            y = close2[t-k];
+            if( id == TA_BETA_TEST )
+            {
+               x = (close2[t-k]-close2[t-k-1])/close2[t-k-1];
+               y = (close[t-k]-close[t-k-1])/close[t-k-1];
+            }
+            changeX[k] = x;
+            changeY[k] = y;
+            exactAdd( &sumX, x );
+            exactAdd( &sumY, y );
+         }
+         meanX = exactValue( &sumX )/LONG_PERIOD;
+         meanY = exactValue( &sumY )/LONG_PERIOD;
+
+         memset( &sumXX, 0, sizeof(sumXX) );
+         memset( &sumXY, 0, sizeof(sumXY) );
+         memset( &sumYY, 0, sizeof(sumYY) );
+         for( k=0; k < LONG_PERIOD; k++ )
+         {
+            exactAdd( &sumXX, (changeX[k]-meanX)*(changeX[k]-meanX) );
+            exactAdd( &sumXY, (changeX[k]-meanX)*(changeY[k]-meanY) );
+            exactAdd( &sumYY, (changeY[k]-meanY)*(changeY[k]-meanY) );
+         }
+
+         /* The bounds are relative to the magnitude of the values
+          * in the window, like the error of a direct calculation
+          * (the variance is the difference of two means).
+          */
+         switch( id )
+         {
+         case TA_SMA_TEST:
+            expected = meanX;
+            error = std_fabs(outReal[t-outBegIdx]-expected)/meanX;
+            break;
+         case TA_VAR_TEST:
+            expected = exactValue( &sumXX )/LONG_PERIOD;
+            error = std_fabs(outReal[t-outBegIdx]-expected)/(meanX*meanX);
+            break;
+         case TA_CORREL_TEST:
+            expected = exactValue( &sumXY )/std_sqrt( exactValue( &sumXX )*exactValue( &sumYY ) );
+            error = std_fabs(outReal[t-outBegIdx]-expected);
+            break;
+         case TA_BETA_TEST:
+            expected = exactValue( &sumXY )/exactValue( &sumXX );
+            error = std_fabs(outReal[t-outBegIdx]-expected)/(std_fabs(expected)+1.0);
+            break;
+         default:
+            continue; /* Checked below. */
+         }
+
+         if( error > 1e-9 )
+         {
+            printf( "Fail: test %d output at bar %d = %.15g (expected %.15g)\n",
+                    id, t, outReal[t-outBegIdx], expected );
+            errNb = TA_PRECISION_TST_BOUND;
+            break;
+         }
+      }
+
+      /* Exact calculation of the cumulative functions. */
+      if( (id == TA_OBV_TEST) || (id == TA_AD_TEST) )
+      {
+         memset( &sumX, 0, sizeof(sumX) );
+         if( id == TA_OBV_TEST )
+            exactAdd( &sumX, volume[0] );
+         for( t=0; t < NB_LONG_BARS; t++ )
+         {
+            if( id == TA_OBV_TEST )
+            {
+               if( (t > 0) && (close[t] > close[t-1]) )
+                  exactAdd( &sumX, volume[t] );
+               else if( (t > 0) && (close[t] < close[t-1]) )
+                  exactAdd( &sumX, -volume[t] );
+            }
+            else if( high[t] > low[t] )
+               exactAdd( &sumX, (((close[t]-low[t])-(high[t]-close[t]))/(high[t]-low[t]))*volume[t] );
+
+            /* Relative to the volume of one bar. */
+            expected = exactValue( &sumX );
+            if( std_fabs(outReal[t]-expected) > 1e-12*10000000.0 )
+            {
+               printf( "Fail: test %d output at bar %d = %.15g (expected %.15g)\n",
+                       id, t, outReal[t], expected );
+               errNb = TA_PRECISION_TST_BOUND;
+               break;
+            }
+         }
+      }
+   }
+
+   TA_SetPrecision( TA_PRECISION_DEFAULT );
+   TA_Free( buffer );
+
+   return errNb;
+}
+
+/* The running totals of the squares fall by many more digits than a
+ * compensated sum keeps: they are done again from the window.
+ */
+static ErrorNumber testScaleJumps( void )
+{
+   TA_RetCode retCode;
+   ExactSum sum, sumSq;
+   double *buffer, *close, *outVar, *outUpper, *outMiddle, *outLower;
+   double price, mean, scale, expected, error, stdError;
+   unsigned int seed;
+   int nbBars, t, k, outBegIdx, outNBElement, bandsBegIdx, bandsNBElement;
+
+   nbBars = NB_SCALE*NB_SCALE_BARS;
+   buffer = (double *)TA_Malloc( sizeof(double)*nbBars*5 );
+   if( !buffer )
+      return TA_PRECISION_TST_ALLOC;
+
+   close     = buffer;
+   outVar    = buffer+nbBars;
+   outUpper  = buffer+2*nbBars;
+   outMiddle = buffer+3*nbBars;
+   outLower  = buffer+4*nbBars;
+
+   seed  = 4321;
+   price = 0.0;
+   for( t=0; t < nbBars; t++ )
+   {
+      if( (t%NB_SCALE_BARS) == 0 )
+         price = 100.0*scaleJump[t/NB_SCALE_BARS];
+      price *= std_exp( 0.02*(nextRandom(&seed)-0.5) );
+      close[t] = price;
+   }
+
+   TA_SetPrecision( TA_PRECISION_COMPENSATED );
+   retCode = TA_VAR( 0, nbBars-1, close, LONG_PERIOD, 1.0,
+                     &outBegIdx, &outNBElement, outVar );
+   if( retCode == TA_SUCCESS )
+      retCode = TA_BBANDS( 0, nbBars-1, close, LONG_PERIOD, 1.0, 1.0, TA_MAType_SMA,
+                           &bandsBegIdx, &bandsNBElement, outUpper, outMiddle, outLower );
+   TA_SetPrecision( TA_PRECISION_DEFAULT );
+   if( (retCode != TA_SUCCESS) || (outBegIdx != bandsBegIdx) || (outNBElement != bandsNBElement) )
+   {
+      TA_Free( buffer );
+      return TA_PRECISION_TST_CALL_FAIL;
+   }
+
+   for( t=outBegIdx; t < nbBars; t++ )
+   {
+      memset( &sum, 0, sizeof(sum) );
+      scale = 0.0;
+      for( k=0; k < LONG_PERIOD; k++ )
+      {
+         exactAdd( &sum, close[t-k] );
+         if( close[t-k] > scale )
+            scale = close[t-k];
+      }
+      mean = exactValue( &sum )/LONG_PERIOD;
+      memset( &sumSq, 0, sizeof(sumSq) );
+      for( k=0; k < LONG_PERIOD; k++ )
+         exactAdd( &sumSq, (close[t-k]-mean)*(close[t-k]-mean) );
+      expected = exactValue( &sumSq )/LONG_PERIOD;
+
+      /* Relative to the square of the values for the variance, and
+       * to the values for the standard deviation (its square root).
+       * Under 1e-8, the standard deviation of the bands is 0.
+       */
+      error    = std_fabs(outVar[t-outBegIdx]-expected)/(scale*scale);
+      stdError = std_fabs((outUpper[t-outBegIdx]-outMiddle[t-outBegIdx])-std_sqrt(expected))/scale;
+      if( (error > 1e-12) || ((expected > 1e-8) && (stdError > 1e-8)) )
+      {
+         printf( "Fail: scale jump at bar %d, variance %.15g stddev %.15g (expected %.15g)\n",
+                 t, outVar[t-outBegIdx], outUpper[t-outBegIdx]-outMiddle[t-outBegIdx], expected );
+         TA_Free( buffer );
+         return TA_PRECISION_TST_BOUND;
+      }
+   }
+
+   TA_Free( buffer );
+
+   return TA_TEST_PASS;
+}
+
+/* Only one output is checked, the other ones are written in outOther
+ * (2*nbBars values).
+ */
+static TA_RetCode callPrefixFunc( TA_PrefixTestId id, int startIdx, const TA_Inputs *inputs,
+                                  int optInTimePeriod, int *outBegIdx, int *outNBElement,
+                                  double *outReal, double *outOther )
+{
+   int endIdx = inputs->nbBars-1;
+
+   switch( id )
+   {
+   case PREFIX_SMA:
+      return TA_SMA( startIdx, endIdx, inputs->close, optInTimePeriod,
+                     outBegIdx, outNBElement, outReal );
+   case PREFIX_VAR:
+      return TA_VAR( startIdx, endIdx, inputs->close, optInTimePeriod, 1.0,
+                     outBegIdx, outNBElement, outReal );
+   case PREFIX_STDDEV:
+      return TA_STDDEV( startIdx, endIdx, inputs->close, optInTimePeriod, 1.0,
+                        outBegIdx, outNBElement, outReal );
+   case PREFIX_BBANDS:
+      return TA_BBANDS( startIdx, endIdx, inputs->close, optInTimePeriod, 2.0, 2.0,
+                        TA_MAType_SMA, outBegIdx, outNBElement,
+                        outReal, outOther, outOther+inputs->nbBars );
+   case PREFIX_BBDIST:
+      return TA_BBDist( startIdx, endIdx, inputs->close, optInTimePeriod, 2.0,
+                        outBegIdx, outNBElement, outReal, outOther );
+   case PREFIX_BBWIDTH:
+      return TA_BBWidth( startIdx, endIdx, inputs->close, optInTimePeriod, 2.0,
+                         outBegIdx, outNBElement, outReal );
+   case PREFIX_ACCBANDS:
+      return TA_ACCBANDS( startIdx, endIdx, inputs->high, inputs->low, inputs->close,
+                          optInTimePeriod, outBegIdx, outNBElement,
+                          outReal, outOther, outOther+inputs->nbBars );
+   default:
+      return TA_SmaExt( startIdx, endIdx, inputs->close, optInTimePeriod, 3,
+                        outBegIdx, outNBElement, outReal );
+   }
+}
+
+static ErrorNumber testPrefixSum( void )
+{
+   TA_Inputs inputs;
+   TA_RetCode retCode;
+   ErrorNumber errNb;
+   double *buffer, *close, *high, *low, *outDefault, *outPrefix, *inPlace, *outOther;
+   double noise, error;
+   unsigned int seed;
+   int id, p, t, startIdx, outBegIdx, outNBElement, begIdx, nbElement;
+
+   buffer = (double *)TA_Malloc( sizeof(double)*NB_PREFIX_BARS*8 );
+   if( !buffer )
+      return TA_PRECISION_TST_ALLOC;
+
+   close      = buffer;
+   high       = buffer+NB_PREFIX_BARS;
+   low        = buffer+2*NB_PREFIX_BARS;
+   outDefault = buffer+3*NB_PREFIX_BARS;
+   outPrefix  = buffer+4*NB_PREFIX_BARS;
+   inPlace    = buffer+5*NB_PREFIX_BARS;
+   outOther   = buffer+6*NB_PREFIX_BARS;
+
+   seed  = 4321;
+   noise = 0.0;
+   for( t=0; t < NB_PREFIX_BARS; t++ )
+   {
+      noise = 0.99*noise + 0.01*(nextRandom(&seed)-0.5);
+      close[t] = 100.0*std_exp( noise+0.2*std_sin( t/700.0 ) );
+      high[t]  = close[t]*(1.0+0.01*nextRandom(&seed));
+      low[t]   = close[t]*(1.0-0.01*nextRandom(&seed));
+   }
+
+   inputs.close  = close;
+   inputs.close2 = close;
+   inputs.high   = high;
+   inputs.low    = low;
+   inputs.volume = NULL;
+   inputs.nbBars = NB_PREFIX_BARS;
+
+   errNb = TA_TEST_PASS;
+   for( id=0; (id < NB_PREFIX_TEST) && (errNb == TA_TEST_PASS); id++ )
+   {
+      for( p=0; (p < NB_PREFIX_PERIOD) && (errNb == TA_TEST_PASS); p++ )
+      {
+         for( startIdx=0; startIdx <= 7000; startIdx += 7000 )
+         {
+            TA_SetPrecision( TA_PRECISION_DEFAULT );
+            retCode = callPrefixFunc( (TA_PrefixTestId)id, startIdx, &inputs, prefixPeriod[p],
+                                      &outBegIdx, &outNBElement, outDefault, outOther );
+            if( retCode != TA_SUCCESS )
+            {
+               errNb = TA_PRECISION_TST_CALL_FAIL;
+               break;
+            }
+
+            TA_SetPrecision( TA_PRECISION_PREFIX_SUM );
+            retCode = callPrefixFunc( (TA_PrefixTestId)id, startIdx, &inputs, prefixPeriod[p],
+                                      &begIdx, &nbElement, outPrefix, outOther );
+            if( retCode != TA_SUCCESS )
+            {
+               errNb = TA_PRECISION_TST_CALL_FAIL;
+               break;
+            }
+            if( (begIdx != outBegIdx) || (nbElement != outNBElement) )
+            {
+               errNb = TA_PRECISION_TST_PREFIX;
+               break;
+            }
+
+            for( t=0; t < nbElement; t++ )
+            {
+               error = std_fabs(outPrefix[t]-outDefault[t])/(std_fabs(outDefault[t])+1.0);
+               if( error > prefixTolerance[id] )
+               {
+                  printf( "Fail: prefix test %d period %d output %d = %.15g (default %.15g)\n",
+                          id, prefixPeriod[p], t, outPrefix[t], outDefault[t] );
+                  errNb = TA_PRECISION_TST_PREFIX;
+                  break;
+               }
+            }
+            if( errNb != TA_TEST_PASS )
+               break;
+
+            /* Same result when the close is also the output. */
+            memcpy( inPlace, close, sizeof(double)*NB_PREFIX_BARS );
+            inputs.close = inPlace;
+            retCode = callPrefixFunc( (TA_PrefixTestId)id, startIdx, &inputs, prefixPeriod[p],
+                                      &begIdx, &nbElement, inPlace, outOther );
+            inputs.close = close;
+            if( retCode != TA_SUCCESS )
+            {
+               errNb = TA_PRECISION_TST_CALL_FAIL;
+               break;
+            }
+            if( memcmp( inPlace, outPrefix, sizeof(double)*nbElement ) != 0 )
+            {
+               errNb = TA_PRECISION_TST_INPLACE;
+               break;
+            }
+         }
+      }
+   }
+
+   TA_SetPrecision( TA_PRECISION_DEFAULT );
+   TA_Free( buffer );
+
+   return errNb;
+}
+
+/* Error-free addition (Knuth's TwoSum) in a double-double. */
+static void exactAdd( ExactSum *sum, double value )
+{
+   double newHi, virtualValue;
+
+   newHi = sum->hi+value;
+   virtualValue = newHi-sum->hi;
+   sum->lo += (sum->hi-(newHi-virtualValue))+(value-virtualValue);
+   sum->hi = newHi;
+}
+
+static double exactValue( const ExactSum *sum )
+{
+   return sum->hi+sum->lo;
+}
+
+/* Uniform in [0,1), xorshift32. */
+static double nextRandom( unsigned int *seed )
+{
+   unsigned int x = *seed;
+
+   x ^= x << 13;
+   x ^= x >> 17;
+   x ^= x << 5;
+   *seed = x;
+
+   return x/4294967296.0;
+}
@@ -0,0 +1,237 @@
+/* Description:
+ *     Test MEDIAN, QUANTILE and PCTRANK against a brute force
+ *     calculation (sort of the whole window for each output).
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "ta_test_priv.h"
+#include "ta_test_func.h"
+#include "ta_utility.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+typedef enum
+{
+   TA_MEDIAN_TEST,
+   TA_QUANTILE_TEST,
+   TA_PCTRANK_TEST
+} TA_TestId;
+
+typedef struct
+{
+   TA_TestId theFunction;
+   int startIdx;
+   int optInTimePeriod;
+   double optInQuantile;
+} TA_Test;
+
+/* The input series used by the tests. */
+typedef enum
+{
+   INPUT_CLOSE,
+   INPUT_TIES,  /* Close rounded, many equal values. */
+   INPUT_NAN,   /* Close with a NaN. */
+   NB_INPUT
+} TA_TestInput;
+
+#define NAN_IDX 120
+
+/**** Local functions declarations.    ****/
+static ErrorNumber do_test( const double *input, int nbBars, const TA_Test *test );
+static TA_RetCode callFunc( const TA_Test *test, const double *input, int nbBars,
+                            int *outBegIdx, int *outNBElement, double *outReal );
+static double bruteForce( const TA_Test *test, const double *input, int today );
+
+/**** Local variables definitions.     ****/
+static TA_Test tableTest[] =
+{
+   { TA_MEDIAN_TEST,     0,   2, 0.0  },
+   { TA_MEDIAN_TEST,     0,   3, 0.0  },
+   { TA_MEDIAN_TEST,   100,  14, 0.0  },
+   { TA_MEDIAN_TEST,     0,  15, 0.0  },
+   { TA_MEDIAN_TEST,     0, 252, 0.0  },
+
+   { TA_QUANTILE_TEST,   0,   2, 0.0  },
+   { TA_QUANTILE_TEST,   0,   2, 0.3  },
+   { TA_QUANTILE_TEST,   0,  14, 0.5  },
+   { TA_QUANTILE_TEST,  50,  14, 0.1  },
+   { TA_QUANTILE_TEST,   0,  20, 0.25 },
+   { TA_QUANTILE_TEST,   0,  20, 0.95 },
+   { TA_QUANTILE_TEST,   0,  20, 1.0  },
+   { TA_QUANTILE_TEST,   0, 100, 0.75 },
+
+   { TA_PCTRANK_TEST,    0,   2, 0.0  },
+   { TA_PCTRANK_TEST,    0,  14, 0.0  },
+   { TA_PCTRANK_TEST,  200,  30, 0.0  },
+   { TA_PCTRANK_TEST,    0, 100, 0.0  }
+};
+
+#define NB_TEST (sizeof(tableTest)/sizeof(TA_Test))
+
+static double inputs[NB_INPUT][MAX_NB_TEST_ELEMENT];
+static double sorted[MAX_NB_TEST_ELEMENT];
+
+/**** Global functions definitions.   ****/
+ErrorNumber test_func_quantile( TA_History *history )
+{
+   unsigned int i, j;
+   int t, nbBars;
+   ErrorNumber retValue;
+   int outBegIdx, outNBElement;
+
+   nbBars = (int)history->nbBars;
+   for( t=0; t < nbBars; t++ )
+   {
+      inputs[INPUT_CLOSE][t] = history->close[t];
+      inputs[INPUT_TIES][t]  = std_floor(history->close[t]/4.0);
+      inputs[INPUT_NAN][t]   = history->close[t];
+   }
+   inputs[INPUT_NAN][NAN_IDX] = sqrt(-1.0);
+
+   for( i=0; i < NB_TEST; i++ )
+   {
+      for( j=0; j < NB_INPUT; j++ )
+      {
+         retValue = do_test( inputs[j], nbBars, &tableTest[i] );
+         if( retValue != TA_TEST_PASS )
+         {
+            printf( "%s Failed Test #%d, input %d (Code=%d)\n", __FILE__, i, j, retValue );
+            return retValue;
+         }
+      }
+   }
+
+   /* Out of range parameters. */
+   if( (TA_QUANTILE( 0, 10, inputs[0], 5, -0.1, &outBegIdx, &outNBElement, gBuffer[0].out0 ) != TA_BAD_PARAM) ||
+       (TA_QUANTILE( 0, 10, inputs[0], 5,  1.1, &outBegIdx, &outNBElement, gBuffer[0].out0 ) != TA_BAD_PARAM) ||
+       (TA_MEDIAN( 0, 10, inputs[0], 1, &outBegIdx, &outNBElement, gBuffer[0].out0 ) != TA_BAD_PARAM) ||
+       (TA_PCTRANK( 0, 10, inputs[0], 1, &outBegIdx, &outNBElement, gBuffer[0].out0 ) != TA_BAD_PARAM) ||
+       (TA_QUANTILE_Lookback( 10, TA_REAL_DEFAULT ) != 9) ||
+       (TA_MEDIAN_Lookback( TA_INTEGER_DEFAULT ) != 13) )
+      return TA_QUANTILE_TST_BAD_PARAM;
+
+   /* All test succeed. */
+   return TA_TEST_PASS;
+}
+
+/**** Local functions definitions.     ****/
+static ErrorNumber do_test( const double *input, int nbBars, const TA_Test *test )
+{
+   TA_RetCode retCode;
+   int outBegIdx, outNBElement, i, today, hasNaN;
+   double expected, value;
+
+   retCode = callFunc( test, input, nbBars, &outBegIdx, &outNBElement, gBuffer[0].out0 );
+   if( retCode != TA_SUCCESS )
+      return TA_QUANTILE_TST_CALL_FAIL;
+
+   if( (outBegIdx != max(test->startIdx, test->optInTimePeriod-1)) ||
+       (outNBElement != nbBars-outBegIdx) )
+      return TA_QUANTILE_TST_BEG_IDX;
+
+   for( i=0; i < outNBElement; i++ )
+   {
+      today = outBegIdx+i;
+      hasNaN = (input == inputs[INPUT_NAN]) &&
+               (NAN_IDX <= today) && (NAN_IDX > today-test->optInTimePeriod);
+
+      value = gBuffer[0].out0[i];
+      if( hasNaN )
+      {
+         if( value == value )
+            return TA_QUANTILE_TST_NAN;
+         continue;
+      }
+
+      expected = bruteForce( test, input, today );
+      if( value != expected )
+      {
+         printf( "Fail: output %d = %.10g (expected %.10g)\n", i, value, expected );
+         return TA_QUANTILE_TST_VALUE;
+      }
+   }
+
+   /* Same result when the output is the input. */
+   memcpy( gBuffer[1].in, input, sizeof(double)*nbBars );
+   retCode = callFunc( test, gBuffer[1].in, nbBars, &outBegIdx, &outNBElement, gBuffer[1].in );
+   if( retCode != TA_SUCCESS )
+      return TA_QUANTILE_TST_CALL_FAIL;
+   if( memcmp( gBuffer[1].in, gBuffer[0].out0, sizeof(double)*outNBElement ) != 0 )
+      return TA_QUANTILE_TST_VALUE;
+
+   return TA_TEST_PASS;
+}
+
+static TA_RetCode callFunc( const TA_Test *test, const double *input, int nbBars,
+                            int *outBegIdx, int *outNBElement, double *outReal )
+{
+   switch( test->theFunction )
+   {
+   case TA_MEDIAN_TEST:
+      return TA_MEDIAN( test->startIdx, nbBars-1, input, test->optInTimePeriod,
+                        outBegIdx, outNBElement, outReal );
+   case TA_QUANTILE_TEST:
+      return TA_QUANTILE( test->startIdx, nbBars-1, input, test->optInTimePeriod,
+                          test->optInQuantile, outBegIdx, outNBElement, outReal );
+   default:
+      return TA_PCTRANK( test->startIdx, nbBars-1, input, test->optInTimePeriod,
+                         outBegIdx, outNBElement, outReal );
+   }
+}
+
+/* Sort the whole window, then apply the definition. */
+static double bruteForce( const TA_Test *test, const double *input, int today )
+{
+   int i, j, n, lowRank, nbBelow, nbEqual;
+   double tmp, rank, fraction;
+
+   n = test->optInTimePeriod;
+   for( i=0; i < n; i++ )
+   {
+      tmp = input[today-n+1+i];
+      for( j=i; (j > 0) && (sorted[j-1] > tmp); j-- )
+         sorted[j] = sorted[j-1];
+      sorted[j] = tmp;
+   }
+
+   switch( test->theFunction )
+   {
+   case TA_MEDIAN_TEST:
+      if( n & 1 )
+         return sorted[n/2];
+      return (sorted[n/2-1]+sorted[n/2])/2.0;
+
+   case TA_QUANTILE_TEST:
+      rank     = (n-1)*test->optInQuantile;
+      lowRank  = (int)std_floor(rank);
+      fraction = rank-lowRank;
+      if( lowRank >= n-1 )
+         return sorted[n-1];
+      if( fraction == 0.0 )
+         return sorted[lowRank];
+      return sorted[lowRank]+fraction*(sorted[lowRank+1]-sorted[lowRank]);
+
+   default:
+      nbBelow = nbEqual = 0;
+      for( i=0; i < n; i++ )
+      {
+         if( sorted[i] < input[today] )
+            nbBelow++;
+         else if( sorted[i] == input[today] )
+            nbEqual++;
+      }
+      return 100.0*(nbBelow+(nbEqual-1)/2.0)/(n-1);
+   }
+}
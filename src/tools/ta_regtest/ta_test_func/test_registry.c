@@ -0,0 +1,397 @@
+/* Description:
+ *     Test the function registry (ta_registry.h). Every function
+ *     is called through its uniform entry point, and a few are
+ *     compared with a direct call.
+ *
+ *     Also verify for every function the exact output size and
+ *     the in-place calculation (see ta_func.h).
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <string.h>
+
+#include "ta_test_priv.h"
+#include "ta_test_func.h"
+#include "ta_utility.h"
+#include "ta_registry.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+#define MAX_OPTIN   16
+#define MAX_OUTPUT  8
+#define MAX_INPUTS   8
+
+/**** Local functions declarations.    ****/
+static ErrorNumber testLookup( void );
+static ErrorNumber testFunc( const TA_FuncDef *func, const TA_History *history );
+static ErrorNumber testDirect( const TA_History *history );
+static ErrorNumber testInPlace( const TA_FuncDef *func, const TA_History *history,
+                                int startIdx );
+static void setOptIn( const TA_FuncDef *func, double *optIn );
+static void setInputs( const TA_FuncDef *func, const TA_History *history,
+                       const double **inputs );
+
+/**** Local variables definitions.     ****/
+static int    outInteger[MAX_OUTPUT][MAX_NB_TEST_ELEMENT];
+static double outReal[MAX_OUTPUT][MAX_NB_TEST_ELEMENT];
+static double refReal[MAX_OUTPUT][MAX_NB_TEST_ELEMENT];
+static double inCopy[MAX_INPUTS][MAX_NB_TEST_ELEMENT];
+
+/**** Global functions definitions.   ****/
+ErrorNumber test_func_registry( TA_History *history )
+{
+   ErrorNumber retValue;
+   int i;
+
+   retValue = testLookup();
+   if( retValue != TA_TEST_PASS )
+      return retValue;
+
+   for( i=0; i < TA_FuncCount(); i++ )
+   {
+      retValue = testFunc( TA_FuncAt( i ), history );
+      if( retValue == TA_TEST_PASS )
+         retValue = testInPlace( TA_FuncAt( i ), history, 0 );
+      if( retValue == TA_TEST_PASS )
+         retValue = testInPlace( TA_FuncAt( i ), history, 100 );
+      if( retValue != TA_TEST_PASS )
+      {
+         printf( "Failed TA_%s (Code=%d)\n", TA_FuncAt( i )->name, retValue );
+         return retValue;
+      }
+   }
+
+   retValue = testDirect( history );
+   if( retValue != TA_TEST_PASS )
+      return retValue;
+
+   /* All test succeed. */
+   return TA_TEST_PASS;
+}
+
+/**** Local functions definitions.     ****/
+static ErrorNumber testLookup( void )
+{
+   const TA_FuncDef *func;
+   int i;
+
+   if( (TA_FuncCount() <= 0) || TA_FuncAt( -1 ) || TA_FuncAt( TA_FuncCount() ) )
+      return TA_REGISTRY_TST_LOOKUP;
+
+   for( i=0; i < TA_FuncCount(); i++ )
+   {
+      func = TA_FuncAt( i );
+
+      /* Sorted, so the binary search can find all of them. */
+      if( (i > 0) && (strcmp( TA_FuncAt( i-1 )->name, func->name ) >= 0) )
+         return TA_REGISTRY_TST_LOOKUP;
+
+      if( TA_FuncFind( func->name ) != func )
+         return TA_REGISTRY_TST_LOOKUP;
+
+      if( (func->nbInput <= 0) || (func->nbOutput <= 0) ||
+          (func->nbOutput > MAX_OUTPUT) || (func->nbOptInput > MAX_OPTIN) ||
+          ((func->nbOptInput == 0) != (func->optInputs == NULL)) )
+         return TA_REGISTRY_TST_DEF;
+   }
+
+   if( (TA_FuncFind( "TA_BBANDS" ) != TA_FuncFind( "BBANDS" )) ||
+       (TA_FuncFind( "BBANDS" ) == NULL) ||
+       (TA_FuncFind( "bbands" ) != NULL) ||
+       (TA_FuncFind( "BBAND" ) != NULL) ||
+       (TA_FuncFind( "" ) != NULL) ||
+       (TA_FuncFind( NULL ) != NULL) )
+      return TA_REGISTRY_TST_LOOKUP;
+
+   /* Some known definitions. */
+   func = TA_FuncFind( "MAMA" );
+   if( !func || (func->unstId != TA_FUNC_UNST_MAMA) || (func->nbOptInput != 2) ||
+       (func->optInputs[0].type != TA_OPTIN_REAL) ||
+       (func->optInputs[0].min != 0.01) || (func->optInputs[0].max != 0.99) )
+      return TA_REGISTRY_TST_DEF;
+
+   func = TA_FuncFind( "MINMAXINDEX" );
+   if( !func || (func->unstId != TA_FUNC_UNST_NONE) || (func->nbOutput != 2) ||
+       (func->outputs[1].type != TA_OUTPUT_INTEGER) )
+      return TA_REGISTRY_TST_DEF;
+
+   func = TA_FuncFind( "STOCH" );
+   if( !func || (func->nbInput != 3) || (func->inputs[0].type != TA_INPUT_HIGH) ||
+       (func->inputs[2].type != TA_INPUT_CLOSE) || (func->optInputs[2].type != TA_OPTIN_MATYPE) ||
+       (func->optInputs[0].min != 1) || (func->optInputs[0].max != 100000) )
+      return TA_REGISTRY_TST_DEF;
+
+   return TA_TEST_PASS;
+}
+
+/* Call a function on the whole history with valid parameters. */
+static ErrorNumber testFunc( const TA_FuncDef *func, const TA_History *history )
+{
+   const double *inputs[MAX_OUTPUT];
+   void *outputs[MAX_OUTPUT];
+   double optIn[MAX_OPTIN];
+   TA_RetCode retCode;
+   int i, lookback, outBegIdx, outNBElement;
+
+   setOptIn( func, optIn );
+   setInputs( func, history, inputs );
+   for( i=0; i < func->nbOutput; i++ )
+   {
+      if( func->outputs[i].type == TA_OUTPUT_INTEGER )
+         outputs[i] = outInteger[i];
+      else
+         outputs[i] = outReal[i];
+   }
+
+   lookback = func->lookback( optIn );
+   if( lookback < 0 )
+      return TA_REGISTRY_TST_LOOKBACK;
+
+   retCode = func->call( 0, history->nbBars-1, inputs, optIn,
+                         &outBegIdx, &outNBElement, outputs );
+   if( retCode != TA_SUCCESS )
+      return TA_REGISTRY_TST_CALL_FAIL;
+
+   if( (outNBElement != 0) &&
+       ((outBegIdx != lookback) || (outNBElement != (int)history->nbBars-lookback)) )
+   {
+      printf( "Fail: outBegIdx=%d outNBElement=%d lookback=%d\n",
+              outBegIdx, outNBElement, lookback );
+      return TA_REGISTRY_TST_LOOKBACK;
+   }
+
+   /* Out of range parameters are still rejected by the function. */
+   if( func->nbOptInput > 0 )
+   {
+      optIn[0] = func->optInputs[0].min-1.0;
+      if( (func->optInputs[0].type != TA_OPTIN_REAL) &&
+          (func->optInputs[0].min > TA_INTEGER_MIN) &&
+          (func->call( 0, history->nbBars-1, inputs, optIn,
+                       &outBegIdx, &outNBElement, outputs ) != TA_BAD_PARAM) )
+         return TA_REGISTRY_TST_BAD_PARAM;
+   }
+
+   return TA_TEST_PASS;
+}
+
+/* Same result as a direct call, including with the defaults. */
+static ErrorNumber testDirect( const TA_History *history )
+{
+   const TA_FuncDef *func;
+   const double *inputs[3];
+   void *outputs[3];
+   double optIn[4];
+   int outBegIdx, outNBElement, begIdx, nbElement, i;
+   TA_RetCode retCode;
+
+   func = TA_FuncFind( "BBANDS" );
+   inputs[0] = history->close;
+   optIn[0] = 20;
+   optIn[1] = 1.5;
+   optIn[2] = TA_REAL_DEFAULT;
+   optIn[3] = TA_MAType_EMA;
+   outputs[0] = outReal[0];
+   outputs[1] = outReal[1];
+   outputs[2] = outReal[2];
+   retCode = func->call( 0, history->nbBars-1, inputs, optIn,
+                         &outBegIdx, &outNBElement, outputs );
+   if( retCode == TA_SUCCESS )
+      retCode = TA_BBANDS( 0, history->nbBars-1, history->close, 20, 1.5, TA_REAL_DEFAULT,
+                           TA_MAType_EMA, &begIdx, &nbElement,
+                           gBuffer[0].out0, gBuffer[0].out1, gBuffer[0].out2 );
+   if( retCode != TA_SUCCESS )
+      return TA_REGISTRY_TST_CALL_FAIL;
+   if( (outBegIdx != begIdx) || (outNBElement != nbElement) )
+      return TA_REGISTRY_TST_DIRECT;
+   for( i=0; i < nbElement; i++ )
+   {
+      if( (outReal[0][i] != gBuffer[0].out0[i]) ||
+          (outReal[1][i] != gBuffer[0].out1[i]) ||
+          (outReal[2][i] != gBuffer[0].out2[i]) )
+         return TA_REGISTRY_TST_DIRECT;
+   }
+
+   func = TA_FuncFind( "MINMAXINDEX" );
+   inputs[0] = history->high;
+   optIn[0] = TA_INTEGER_DEFAULT;
+   outputs[0] = outInteger[0];
+   outputs[1] = outInteger[1];
+   retCode = func->call( 0, history->nbBars-1, inputs, optIn,
+                         &outBegIdx, &outNBElement, outputs );
+   if( retCode == TA_SUCCESS )
+      retCode = TA_MINMAXINDEX( 0, history->nbBars-1, history->high, TA_INTEGER_DEFAULT,
+                                &begIdx, &nbElement, outInteger[2], outInteger[3] );
+   if( retCode != TA_SUCCESS )
+      return TA_REGISTRY_TST_CALL_FAIL;
+   if( (outBegIdx != begIdx) || (outNBElement != nbElement) || (begIdx != 29) )
+      return TA_REGISTRY_TST_DIRECT;
+   for( i=0; i < nbElement; i++ )
+   {
+      if( (outInteger[0][i] != outInteger[2][i]) ||
+          (outInteger[1][i] != outInteger[3][i]) )
+         return TA_REGISTRY_TST_DIRECT;
+   }
+
+   return TA_TEST_PASS;
+}
+
+/* Each double output is calculated in one of the inputs, and all the
+ * outputs must be identical to a calculation in separate buffers.
+ * The outputs must also not go beyond TA_FuncOutputSize.
+ */
+static ErrorNumber testInPlace( const TA_FuncDef *func, const TA_History *history,
+                                int startIdx )
+{
+   const double *inputs[MAX_INPUTS];
+   const double *histInputs[MAX_INPUTS];
+   void *outputs[MAX_OUTPUT];
+   double optIn[MAX_OPTIN];
+   TA_RetCode retCode;
+   int i, j, in, out, endIdx, size, outBegIdx, outNBElement, begIdx, nbElement;
+
+   if( func->nbInput > MAX_INPUTS )
+      return TA_REGISTRY_TST_DEF;
+
+   endIdx = history->nbBars-1;
+   setOptIn( func, optIn );
+   setInputs( func, history, histInputs );
+
+   size = TA_FuncOutputSize( func, startIdx, endIdx, optIn );
+   if( (size < 0) || (TA_FuncOutputSize( func, endIdx+1, endIdx, optIn ) != -1) )
+      return TA_REGISTRY_TST_SIZE;
+
+   /* Reference, with a marker after the expected size. */
+   for( i=0; i < func->nbOutput; i++ )
+   {
+      for( j=0; j < MAX_NB_TEST_ELEMENT; j++ )
+         refReal[i][j] = -1.0e20;
+      outputs[i] = refReal[i];
+   }
+   retCode = func->call( startIdx, endIdx, histInputs, optIn,
+                         &begIdx, &nbElement, outputs );
+   if( retCode != TA_SUCCESS )
+      return TA_REGISTRY_TST_CALL_FAIL;
+
+   if( nbElement != size )
+   {
+      printf( "Fail: outNBElement=%d expected size=%d\n", nbElement, size );
+      return TA_REGISTRY_TST_SIZE;
+   }
+
+   for( i=0; i < func->nbOutput; i++ )
+   {
+      if( func->outputs[i].type == TA_OUTPUT_INTEGER )
+         continue;
+      for( j=size; j < MAX_NB_TEST_ELEMENT; j++ )
+      {
+         if( refReal[i][j] != -1.0e20 )
+            return TA_REGISTRY_TST_SIZE;
+      }
+   }
+
+   for( out=0; out < func->nbOutput; out++ )
+   {
+      if( func->outputs[out].type == TA_OUTPUT_INTEGER )
+         continue;
+
+      for( in=0; in < func->nbInput; in++ )
+      {
+         for( i=0; i < func->nbInput; i++ )
+         {
+            memcpy( inCopy[i], histInputs[i], history->nbBars*sizeof(double) );
+            inputs[i] = inCopy[i];
+         }
+         for( i=0; i < func->nbOutput; i++ )
+         {
+            if( func->outputs[i].type == TA_OUTPUT_INTEGER )
+               outputs[i] = outInteger[i];
+            else
+               outputs[i] = outReal[i];
+         }
+         outputs[out] = inCopy[in];
+
+         retCode = func->call( startIdx, endIdx, inputs, optIn,
+                               &outBegIdx, &outNBElement, outputs );
+         if( retCode != TA_SUCCESS )
+            return TA_REGISTRY_TST_CALL_FAIL;
+
+         if( (outBegIdx != begIdx) || (outNBElement != nbElement) )
+            return TA_REGISTRY_TST_INPLACE;
+
+         for( i=0; i < func->nbOutput; i++ )
+         {
+            if( func->outputs[i].type == TA_OUTPUT_INTEGER )
+               continue;
+            for( j=0; j < nbElement; j++ )
+            {
+               if( memcmp( &((double *)outputs[i])[j], &refReal[i][j], sizeof(double) ) != 0 )
+               {
+                  printf( "Fail: output %d in input %d differs at %d (startIdx=%d)\n",
+                          out, in, j, startIdx );
+                  return TA_REGISTRY_TST_INPLACE;
+               }
+            }
+         }
+      }
+   }
+
+   return TA_TEST_PASS;
+}
+
+/* A valid value for each optional parameter. */
+static void setOptIn( const TA_FuncDef *func, double *optIn )
+{
+   const TA_OptInputDef *def;
+   int i;
+
+   for( i=0; i < func->nbOptInput; i++ )
+   {
+      def = &func->optInputs[i];
+      switch( def->type )
+      {
+      case TA_OPTIN_MATYPE:
+         optIn[i] = TA_MAType_SMA;
+         break;
+      case TA_OPTIN_INTEGER:
+         optIn[i] = max( def->min, min( def->max, 5 ) );
+         break;
+      default:
+         if( (def->min > TA_REAL_MIN) && (def->max < TA_REAL_MAX) )
+            optIn[i] = (def->min+def->max)/2.0;
+         else
+            optIn[i] = max( def->min, min( def->max, 1.0 ) );
+      }
+   }
+}
+
+static void setInputs( const TA_FuncDef *func, const TA_History *history,
+                       const double **inputs )
+{
+   int i;
+
+   for( i=0; i < func->nbInput; i++ )
+   {
+      switch( func->inputs[i].type )
+      {
+      case TA_INPUT_OPEN:   inputs[i] = history->open;   break;
+      case TA_INPUT_HIGH:   inputs[i] = history->high;   break;
+      case TA_INPUT_LOW:    inputs[i] = history->low;    break;
+      case TA_INPUT_VOLUME: inputs[i] = history->volume; break;
+      case TA_INPUT_CLOSE:  inputs[i] = history->close;  break;
+      default:
+         /* A second series (like CORREL) is the open. The
+          * periods of MAVP are bounded by the function.
+          */
+         inputs[i] = (i == 0)? history->close : history->open;
+      }
+   }
+}
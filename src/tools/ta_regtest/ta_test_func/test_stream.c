@@ -0,0 +1,781 @@
+/* Description:
+ *     Test the streaming functions (ta_stream.h) against their
+ *     batch equivalent, one bar at a time, by chunks and by
+ *     tiles of many states, the snapshot of the states
+ *     (ta_snapshot.h) and the tick resampling (ta_tick.h).
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <string.h>
+
+#include "ta_test_priv.h"
+#include "ta_test_func.h"
+#include "ta_utility.h"
+#include "ta_stream.h"
+#include "ta_snapshot.h"
+#include "ta_tick.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+typedef struct
+{
+   TA_StreamFuncId funcId;
+   TA_FuncUnstId   unstId;
+   int             optInTimePeriod;
+   int             unstablePeriod;
+   TA_Compatibility compatibility;
+} TA_Test;
+
+#define TICK_PER_BAR 4
+#define BAR_PERIOD   60
+
+/* The bars consumed before the snapshot. */
+#define SNAPSHOT_NB_BARS 100
+
+typedef struct
+{
+   const TA_History *history;
+   int nbBars;
+   int nbBadBars;
+   int nbBadValues;
+} TA_ResamplerTestData;
+
+/**** Local functions declarations.    ****/
+static ErrorNumber do_test( const TA_History *history,
+                            const TA_Test *test );
+static ErrorNumber testChunks( const TA_History *history,
+                               TA_StreamState *state,
+                               int outBegIdx,
+                               int outNBElement );
+static ErrorNumber testMAMALimits( const TA_History *history );
+static ErrorNumber testBlocked( const TA_History *history );
+static ErrorNumber testBlockedStates( const TA_History *history,
+                                      TA_StreamState *states,
+                                      int tileSize );
+static TA_RetCode initTestState( const TA_Test *test, TA_StreamState *state );
+static ErrorNumber testSnapshot( const TA_History *history );
+static ErrorNumber testSnapshotStates( const TA_History *history,
+                                       TA_StreamState *states,
+                                       TA_StreamState *loaded );
+static TA_RetCode callBatch( const TA_History *history,
+                             const TA_Test *test,
+                             int *outBegIdx,
+                             int *outNBElement,
+                             double *outReal );
+static void makeBar( const TA_History *history, int idx, TA_Bar *bar );
+static ErrorNumber testResampler( const TA_History *history );
+static ErrorNumber testParseCSV( void );
+static void onBar( void *opaqueData, int timeframeIdx,
+                   const TA_Timeframe *timeframe, const TA_Bar *bar );
+
+/**** Local variables definitions.     ****/
+
+static TA_Test tableTest[] =
+{
+   { TA_STREAM_SMA, TA_FUNC_UNST_NONE, 2,  0, TA_COMPATIBILITY_DEFAULT },
+   { TA_STREAM_SMA, TA_FUNC_UNST_NONE, 30, 0, TA_COMPATIBILITY_DEFAULT },
+
+   { TA_STREAM_EMA, TA_FUNC_UNST_EMA,  2,  0, TA_COMPATIBILITY_DEFAULT },
+   { TA_STREAM_EMA, TA_FUNC_UNST_EMA,  14, 0, TA_COMPATIBILITY_DEFAULT },
+   { TA_STREAM_EMA, TA_FUNC_UNST_EMA,  14, 7, TA_COMPATIBILITY_DEFAULT },
+   { TA_STREAM_EMA, TA_FUNC_UNST_EMA,  14, 0, TA_COMPATIBILITY_METASTOCK },
+   { TA_STREAM_EMA, TA_FUNC_UNST_EMA,  14, 7, TA_COMPATIBILITY_METASTOCK },
+
+   { TA_STREAM_RSI, TA_FUNC_UNST_RSI,  2,  0, TA_COMPATIBILITY_DEFAULT },
+   { TA_STREAM_RSI, TA_FUNC_UNST_RSI,  14, 0, TA_COMPATIBILITY_DEFAULT },
+   { TA_STREAM_RSI, TA_FUNC_UNST_RSI,  14, 9, TA_COMPATIBILITY_DEFAULT },
+   { TA_STREAM_RSI, TA_FUNC_UNST_RSI,  14, 0, TA_COMPATIBILITY_METASTOCK },
+   { TA_STREAM_RSI, TA_FUNC_UNST_RSI,  14, 1, TA_COMPATIBILITY_METASTOCK },
+   { TA_STREAM_RSI, TA_FUNC_UNST_RSI,  14, 9, TA_COMPATIBILITY_METASTOCK },
+
+   { TA_STREAM_ATR, TA_FUNC_UNST_ATR,  1,  0, TA_COMPATIBILITY_DEFAULT },
+   { TA_STREAM_ATR, TA_FUNC_UNST_ATR,  14, 0, TA_COMPATIBILITY_DEFAULT },
+   { TA_STREAM_ATR, TA_FUNC_UNST_ATR,  14, 5, TA_COMPATIBILITY_DEFAULT },
+
+   { TA_STREAM_ADX, TA_FUNC_UNST_ADX,  2,  0, TA_COMPATIBILITY_DEFAULT },
+   { TA_STREAM_ADX, TA_FUNC_UNST_ADX,  14, 0, TA_COMPATIBILITY_DEFAULT },
+   { TA_STREAM_ADX, TA_FUNC_UNST_ADX,  14, 6, TA_COMPATIBILITY_DEFAULT },
+
+   { TA_STREAM_KAMA, TA_FUNC_UNST_KAMA, 2,  0, TA_COMPATIBILITY_DEFAULT },
+   { TA_STREAM_KAMA, TA_FUNC_UNST_KAMA, 10, 0, TA_COMPATIBILITY_DEFAULT },
+   { TA_STREAM_KAMA, TA_FUNC_UNST_KAMA, 10, 4, TA_COMPATIBILITY_DEFAULT },
+
+   { TA_STREAM_MAMA, TA_FUNC_UNST_MAMA, TA_INTEGER_DEFAULT, 0, TA_COMPATIBILITY_DEFAULT },
+   { TA_STREAM_MAMA, TA_FUNC_UNST_MAMA, TA_INTEGER_DEFAULT, 5, TA_COMPATIBILITY_DEFAULT },
+   { TA_STREAM_FAMA, TA_FUNC_UNST_MAMA, TA_INTEGER_DEFAULT, 0, TA_COMPATIBILITY_DEFAULT },
+   { TA_STREAM_FAMA, TA_FUNC_UNST_MAMA, TA_INTEGER_DEFAULT, 3, TA_COMPATIBILITY_DEFAULT }
+};
+
+#define NB_TEST (sizeof(tableTest)/sizeof(TA_Test))
+
+/* One state of each function in the snapshot. */
+static TA_Test snapshotTest[] =
+{
+   { TA_STREAM_SMA,  TA_FUNC_UNST_NONE, 10, 0, TA_COMPATIBILITY_DEFAULT },
+   { TA_STREAM_EMA,  TA_FUNC_UNST_EMA,  10, 0, TA_COMPATIBILITY_DEFAULT },
+   { TA_STREAM_RSI,  TA_FUNC_UNST_RSI,  14, 0, TA_COMPATIBILITY_DEFAULT },
+   { TA_STREAM_ATR,  TA_FUNC_UNST_ATR,  14, 0, TA_COMPATIBILITY_DEFAULT },
+   { TA_STREAM_ADX,  TA_FUNC_UNST_ADX,  14, 0, TA_COMPATIBILITY_DEFAULT },
+   { TA_STREAM_KAMA, TA_FUNC_UNST_KAMA, 10, 0, TA_COMPATIBILITY_DEFAULT },
+   { TA_STREAM_MAMA, TA_FUNC_UNST_MAMA, TA_INTEGER_DEFAULT, 0, TA_COMPATIBILITY_DEFAULT },
+   { TA_STREAM_FAMA, TA_FUNC_UNST_MAMA, TA_INTEGER_DEFAULT, 0, TA_COMPATIBILITY_DEFAULT },
+   /* Still within its lookback at the snapshot. */
+   { TA_STREAM_SMA,  TA_FUNC_UNST_NONE, 150, 0, TA_COMPATIBILITY_DEFAULT }
+};
+
+#define NB_SNAPSHOT_STATE (sizeof(snapshotTest)/sizeof(TA_Test))
+
+static unsigned char snapshot[16384];
+
+/* The outputs of all the states of tableTest by testBlocked. */
+static double blockedOut[NB_TEST][MAX_NB_TEST_ELEMENT];
+
+/**** Global functions definitions.   ****/
+ErrorNumber test_func_stream( TA_History *history )
+{
+   unsigned int i;
+   ErrorNumber retValue;
+
+   for( i=0; i < NB_TEST; i++ )
+   {
+      retValue = do_test( history, &tableTest[i] );
+      if( retValue != 0 )
+      {
+         printf( "Failed Test #%d (Code=%d)\n", i, retValue );
+         return retValue;
+      }
+   }
+
+   retValue = testMAMALimits( history );
+   if( retValue != TA_TEST_PASS )
+      return retValue;
+
+   retValue = testBlocked( history );
+   if( retValue != TA_TEST_PASS )
+      return retValue;
+
+   retValue = testSnapshot( history );
+   if( retValue != TA_TEST_PASS )
+      return retValue;
+
+   retValue = testResampler( history );
+   if( retValue != TA_TEST_PASS )
+      return retValue;
+
+   retValue = testParseCSV();
+   if( retValue != TA_TEST_PASS )
+      return retValue;
+
+   /* All test succeed. */
+   return TA_TEST_PASS;
+}
+
+/**** Local functions definitions.     ****/
+static ErrorNumber do_test( const TA_History *history,
+                            const TA_Test *test )
+{
+   TA_StreamState state, chunkState;
+   TA_RetCode retCode;
+   TA_Bar bar;
+   double value;
+   int i, outBegIdx, outNBElement, nbElement, nbOut;
+   ErrorNumber retValue;
+
+   TA_SetCompatibility( test->compatibility );
+   if( test->unstId != TA_FUNC_UNST_NONE )
+      TA_SetUnstablePeriod( test->unstId, test->unstablePeriod );
+
+   retCode = callBatch( history, test, &outBegIdx, &outNBElement, gBuffer[0].out0 );
+   if( retCode == TA_SUCCESS )
+   {
+      retValue = TA_TEST_PASS;
+      retCode = TA_StreamInit( &state, test->funcId, test->optInTimePeriod );
+      if( retCode == TA_SUCCESS )
+      {
+         retCode = TA_StreamInit( &chunkState, test->funcId, test->optInTimePeriod );
+         if( retCode != TA_SUCCESS )
+            TA_StreamFree( &state );
+      }
+      if( retCode != TA_SUCCESS )
+         retValue = TA_STREAM_TST_INIT_FAIL;
+   }
+   else
+      retValue = TA_STREAM_TST_BATCH_FAIL;
+
+   /* The settings are captured by TA_StreamInit. */
+   TA_SetCompatibility( TA_COMPATIBILITY_DEFAULT );
+   TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, 0 );
+
+   if( retValue != TA_TEST_PASS )
+      return retValue;
+
+   if( TA_StreamLookback( &state ) != outBegIdx )
+   {
+      TA_StreamFree( &state );
+      TA_StreamFree( &chunkState );
+      return TA_STREAM_TST_BEG_IDX;
+   }
+
+   nbOut = 0;
+   for( i=0; (i < (int)history->nbBars) && (retValue == TA_TEST_PASS); i++ )
+   {
+      makeBar( history, i, &bar );
+      retCode = TA_StreamUpdate( &state, &bar, &nbElement, &value );
+      if( retCode != TA_SUCCESS )
+         retValue = TA_STREAM_TST_UPDATE_FAIL;
+      else if( nbElement != (i >= outBegIdx? 1 : 0) )
+         retValue = TA_STREAM_TST_BEG_IDX;
+      else if( nbElement == 1 )
+      {
+         /* Must be the same sequence of operations, so
+          * no tolerance is allowed.
+          */
+         if( value != gBuffer[0].out0[nbOut] )
+         {
+            printf( "Fail: Stream value [%d] is %g, expected %g\n",
+                    i, value, gBuffer[0].out0[nbOut] );
+            retValue = TA_STREAM_TST_VALUE;
+         }
+         nbOut++;
+      }
+   }
+
+   if( (retValue == TA_TEST_PASS) && (nbOut != outNBElement) )
+      retValue = TA_STREAM_TST_NB_ELEMENT;
+
+   if( retValue == TA_TEST_PASS )
+      retValue = testChunks( history, &chunkState, outBegIdx, outNBElement );
+
+   TA_StreamFree( &state );
+   TA_StreamFree( &chunkState );
+
+   return retValue;
+}
+
+/* The history by chunks of various sizes must give the same values
+ * as the batch function in gBuffer[0].out0.
+ */
+static ErrorNumber testChunks( const TA_History *history,
+                               TA_StreamState *state,
+                               int outBegIdx,
+                               int outNBElement )
+{
+   static const int chunkSize[] = { 1, 2, 7, 31, 64 };
+   TA_RetCode retCode;
+   double *out = gBuffer[1].out0;
+   int i, chunkIdx, size, chunkBegIdx, chunkNBElement, nbOut, expectedBegIdx;
+
+   nbOut = 0;
+   chunkIdx = 0;
+   for( i=0; i < (int)history->nbBars; i += size )
+   {
+      size = chunkSize[chunkIdx++ % (sizeof(chunkSize)/sizeof(int))];
+      if( size > (int)history->nbBars-i )
+         size = (int)history->nbBars-i;
+
+      retCode = TA_StreamRun( state, size, &history->high[i], &history->low[i], &history->close[i],
+                              &chunkBegIdx, &chunkNBElement, out );
+      if( retCode != TA_SUCCESS )
+         return TA_STREAM_TST_UPDATE_FAIL;
+
+      /* Every bar after the lookback has a value. */
+      expectedBegIdx = max( i, outBegIdx );
+      if( (chunkNBElement != max( 0, i+size-expectedBegIdx )) ||
+          (chunkNBElement && (i+chunkBegIdx != expectedBegIdx)) )
+      {
+         printf( "Fail: Chunk at %d begIdx %d nbElement %d\n", i, chunkBegIdx, chunkNBElement );
+         return TA_STREAM_TST_BEG_IDX;
+      }
+
+      if( memcmp( out, &gBuffer[0].out0[nbOut], sizeof(double)*chunkNBElement ) != 0 )
+      {
+         printf( "Fail: Chunk at %d not identical to the batch\n", i );
+         return TA_STREAM_TST_VALUE;
+      }
+      nbOut += chunkNBElement;
+   }
+
+   if( nbOut != outNBElement )
+      return TA_STREAM_TST_NB_ELEMENT;
+
+   return TA_TEST_PASS;
+}
+
+/* Other limits than the default, MAMA and FAMA by chunks. */
+static ErrorNumber testMAMALimits( const TA_History *history )
+{
+   TA_StreamState mamaState, famaState;
+   TA_RetCode retCode;
+   ErrorNumber retValue;
+   int outBegIdx, outNBElement;
+
+   retCode = TA_MAMA( 0, history->nbBars-1, history->close, 0.3, 0.1,
+                      &outBegIdx, &outNBElement, gBuffer[0].out0, gBuffer[0].out1 );
+   if( retCode != TA_SUCCESS )
+      return TA_STREAM_TST_BATCH_FAIL;
+
+   if( (TA_StreamInitMAMA( &mamaState, TA_STREAM_EMA, 0.3, 0.1 ) != TA_BAD_PARAM) ||
+       (TA_StreamInitMAMA( &mamaState, TA_STREAM_MAMA, 1.5, 0.1 ) != TA_BAD_PARAM) ||
+       (TA_StreamInit( &mamaState, TA_STREAM_MAMA, 10 ) != TA_BAD_PARAM) )
+      return TA_STREAM_TST_INIT_FAIL;
+
+   if( TA_StreamInitMAMA( &mamaState, TA_STREAM_MAMA, 0.3, 0.1 ) != TA_SUCCESS )
+      return TA_STREAM_TST_INIT_FAIL;
+   if( TA_StreamInitMAMA( &famaState, TA_STREAM_FAMA, 0.3, 0.1 ) != TA_SUCCESS )
+   {
+      TA_StreamFree( &mamaState );
+      return TA_STREAM_TST_INIT_FAIL;
+   }
+
+   retValue = testChunks( history, &mamaState, outBegIdx, outNBElement );
+   if( retValue == TA_TEST_PASS )
+   {
+      memcpy( gBuffer[0].out0, gBuffer[0].out1, sizeof(double)*outNBElement );
+      retValue = testChunks( history, &famaState, outBegIdx, outNBElement );
+   }
+
+   TA_StreamFree( &mamaState );
+   TA_StreamFree( &famaState );
+
+   return retValue;
+}
+
+/* All the states of tableTest advanced together, by tiles of
+ * various sizes, must give the values of each state alone.
+ */
+static ErrorNumber testBlocked( const TA_History *history )
+{
+   static const int tileSize[] = { 1, 7, 64, 0 };
+   TA_StreamState states[NB_TEST];
+   ErrorNumber retValue;
+   unsigned int i, j, t;
+
+   retValue = TA_TEST_PASS;
+   for( t=0; (t < sizeof(tileSize)/sizeof(int)) && (retValue == TA_TEST_PASS); t++ )
+   {
+      for( i=0; i < NB_TEST; i++ )
+      {
+         if( initTestState( &tableTest[i], &states[i] ) != TA_SUCCESS )
+         {
+            for( j=0; j < i; j++ )
+               TA_StreamFree( &states[j] );
+            return TA_STREAM_TST_INIT_FAIL;
+         }
+      }
+
+      retValue = testBlockedStates( history, states, tileSize[t] );
+
+      for( i=0; i < NB_TEST; i++ )
+         TA_StreamFree( &states[i] );
+   }
+
+   return retValue;
+}
+
+static ErrorNumber testBlockedStates( const TA_History *history,
+                                      TA_StreamState *states,
+                                      int tileSize )
+{
+   TA_StreamState state;
+   TA_RetCode retCode;
+   double *outReal[NB_TEST];
+   int outBegIdx[NB_TEST], outNBElement[NB_TEST], begIdx, nbElement;
+   unsigned int i;
+
+   for( i=0; i < NB_TEST; i++ )
+      outReal[i] = blockedOut[i];
+
+   /* An output can not be an input of the tile. */
+   outReal[1] = history->close;
+   retCode = TA_StreamRunBlocked( states, NB_TEST, history->nbBars, tileSize,
+                                  history->high, history->low, history->close,
+                                  outBegIdx, outNBElement, outReal );
+   outReal[1] = blockedOut[1];
+   if( retCode != TA_BAD_PARAM )
+      return TA_STREAM_TST_BLOCKED;
+
+   retCode = TA_StreamRunBlocked( states, NB_TEST, history->nbBars, tileSize,
+                                  history->high, history->low, history->close,
+                                  outBegIdx, outNBElement, outReal );
+   if( retCode != TA_SUCCESS )
+      return TA_STREAM_TST_UPDATE_FAIL;
+
+   for( i=0; i < NB_TEST; i++ )
+   {
+      if( initTestState( &tableTest[i], &state ) != TA_SUCCESS )
+         return TA_STREAM_TST_INIT_FAIL;
+      retCode = TA_StreamRun( &state, history->nbBars, history->high, history->low, history->close,
+                              &begIdx, &nbElement, gBuffer[0].out0 );
+      TA_StreamFree( &state );
+      if( retCode != TA_SUCCESS )
+         return TA_STREAM_TST_UPDATE_FAIL;
+
+      if( (outBegIdx[i] != begIdx) || (outNBElement[i] != nbElement) ||
+          (memcmp( outReal[i], gBuffer[0].out0, sizeof(double)*nbElement ) != 0) )
+      {
+         printf( "Fail: State %d by tiles of %d not identical\n", i, tileSize );
+         return TA_STREAM_TST_BLOCKED;
+      }
+   }
+
+   return TA_TEST_PASS;
+}
+
+/* TA_StreamInit with the settings of the test. */
+static TA_RetCode initTestState( const TA_Test *test, TA_StreamState *state )
+{
+   TA_RetCode retCode;
+
+   TA_SetCompatibility( test->compatibility );
+   if( test->unstId != TA_FUNC_UNST_NONE )
+      TA_SetUnstablePeriod( test->unstId, test->unstablePeriod );
+
+   retCode = TA_StreamInit( state, test->funcId, test->optInTimePeriod );
+
+   TA_SetCompatibility( TA_COMPATIBILITY_DEFAULT );
+   TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, 0 );
+
+   return retCode;
+}
+
+/* Save the states after some bars, load them in other states and
+ * verify that both continue with the same values.
+ */
+static ErrorNumber testSnapshot( const TA_History *history )
+{
+   TA_StreamState states[NB_SNAPSHOT_STATE], loaded[NB_SNAPSHOT_STATE];
+   ErrorNumber retValue;
+   unsigned int i, j;
+
+   /* Not the default settings, they must be saved and verified. */
+   TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, 2 );
+   TA_SetCompatibility( TA_COMPATIBILITY_METASTOCK );
+
+   for( i=0; i < NB_SNAPSHOT_STATE; i++ )
+   {
+      if( TA_StreamInit( &states[i], snapshotTest[i].funcId, snapshotTest[i].optInTimePeriod ) != TA_SUCCESS )
+      {
+         for( j=0; j < i; j++ )
+            TA_StreamFree( &states[j] );
+         TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, 0 );
+         TA_SetCompatibility( TA_COMPATIBILITY_DEFAULT );
+         return TA_STREAM_TST_INIT_FAIL;
+      }
+   }
+
+   retValue = testSnapshotStates( history, states, loaded );
+
+   for( i=0; i < NB_SNAPSHOT_STATE; i++ )
+      TA_StreamFree( &states[i] );
+
+   TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, 0 );
+   TA_SetCompatibility( TA_COMPATIBILITY_DEFAULT );
+
+   return retValue;
+}
+
+static ErrorNumber testSnapshotStates( const TA_History *history,
+                                       TA_StreamState *states,
+                                       TA_StreamState *loaded )
+{
+   TA_RetCode retCode;
+   ErrorNumber retValue;
+   size_t size;
+   unsigned int i;
+   int outBegIdx, outNBElement, loadedBegIdx, loadedNBElement, nbBars;
+
+   for( i=0; i < NB_SNAPSHOT_STATE; i++ )
+   {
+      retCode = TA_StreamRun( &states[i], SNAPSHOT_NB_BARS, history->high, history->low, history->close,
+                              &outBegIdx, &outNBElement, gBuffer[0].out0 );
+      if( retCode != TA_SUCCESS )
+         return TA_STREAM_TST_UPDATE_FAIL;
+   }
+
+   retCode = TA_SnapshotSave( states, NB_SNAPSHOT_STATE, NULL, 0, &size );
+   if( (retCode != TA_SUCCESS) || (size > sizeof(snapshot)) )
+      return TA_STREAM_TST_SNAPSHOT;
+   memset( snapshot, 0xFF, sizeof(snapshot) );
+   retCode = TA_SnapshotSave( states, NB_SNAPSHOT_STATE, snapshot, sizeof(snapshot), &size );
+   if( (retCode != TA_SUCCESS) || (TA_SnapshotNbStates( snapshot, size ) != (int)NB_SNAPSHOT_STATE) )
+      return TA_STREAM_TST_SNAPSHOT;
+   if( TA_SnapshotSave( states, NB_SNAPSHOT_STATE, snapshot, size-1, &size ) != TA_BAD_PARAM )
+      return TA_STREAM_TST_SNAPSHOT;
+
+   /* Refused with other settings. */
+   TA_SetUnstablePeriod( TA_FUNC_UNST_KAMA, 3 );
+   retCode = TA_SnapshotLoad( loaded, NB_SNAPSHOT_STATE, snapshot, size );
+   TA_SetUnstablePeriod( TA_FUNC_UNST_KAMA, 2 );
+   if( retCode != TA_SETTINGS_MISMATCH )
+      return TA_STREAM_TST_SNAPSHOT;
+
+   TA_SetCompatibility( TA_COMPATIBILITY_DEFAULT );
+   retCode = TA_SnapshotLoad( loaded, NB_SNAPSHOT_STATE, snapshot, size );
+   TA_SetCompatibility( TA_COMPATIBILITY_METASTOCK );
+   if( retCode != TA_SETTINGS_MISMATCH )
+      return TA_STREAM_TST_SNAPSHOT;
+
+   /* Invalid snapshots. */
+   if( (TA_SnapshotLoad( loaded, NB_SNAPSHOT_STATE, snapshot, size-1 ) != TA_BAD_FILE_FORMAT) ||
+       (TA_SnapshotLoad( loaded, NB_SNAPSHOT_STATE-1, snapshot, size ) != TA_BAD_PARAM) )
+      return TA_STREAM_TST_SNAPSHOT;
+   snapshot[0] = 'X';
+   retCode = TA_SnapshotLoad( loaded, NB_SNAPSHOT_STATE, snapshot, size );
+   snapshot[0] = TA_SNAPSHOT_MAGIC[0];
+   if( (retCode != TA_BAD_FILE_FORMAT) || (TA_SnapshotNbStates( snapshot, 4 ) != -1) )
+      return TA_STREAM_TST_SNAPSHOT;
+
+   if( TA_SnapshotLoad( loaded, NB_SNAPSHOT_STATE, snapshot, size ) != TA_SUCCESS )
+      return TA_STREAM_TST_SNAPSHOT;
+
+   /* Both continue with identical values. */
+   retValue = TA_TEST_PASS;
+   nbBars = (int)history->nbBars-SNAPSHOT_NB_BARS;
+   for( i=0; (i < NB_SNAPSHOT_STATE) && (retValue == TA_TEST_PASS); i++ )
+   {
+      retCode = TA_StreamRun( &states[i], nbBars, &history->high[SNAPSHOT_NB_BARS],
+                              &history->low[SNAPSHOT_NB_BARS], &history->close[SNAPSHOT_NB_BARS],
+                              &outBegIdx, &outNBElement, gBuffer[0].out0 );
+      if( retCode == TA_SUCCESS )
+         retCode = TA_StreamRun( &loaded[i], nbBars, &history->high[SNAPSHOT_NB_BARS],
+                                 &history->low[SNAPSHOT_NB_BARS], &history->close[SNAPSHOT_NB_BARS],
+                                 &loadedBegIdx, &loadedNBElement, gBuffer[0].out1 );
+      if( retCode != TA_SUCCESS )
+         retValue = TA_STREAM_TST_UPDATE_FAIL;
+      else if( (outBegIdx != loadedBegIdx) || (outNBElement != loadedNBElement) || !outNBElement ||
+               (memcmp( gBuffer[0].out0, gBuffer[0].out1, sizeof(double)*outNBElement ) != 0) )
+      {
+         printf( "Fail: Snapshot of state %d\n", i );
+         retValue = TA_STREAM_TST_SNAPSHOT;
+      }
+   }
+
+   for( i=0; i < NB_SNAPSHOT_STATE; i++ )
+      TA_StreamFree( &loaded[i] );
+
+   return retValue;
+}
+
+static TA_RetCode callBatch( const TA_History *history,
+                             const TA_Test *test,
+                             int *outBegIdx,
+                             int *outNBElement,
+                             double *outReal )
+{
+   int endIdx = history->nbBars-1;
+
+   switch( test->funcId )
+   {
+   case TA_STREAM_SMA:
+      return TA_SMA( 0, endIdx, history->close, test->optInTimePeriod,
+                     outBegIdx, outNBElement, outReal );
+   case TA_STREAM_EMA:
+      return TA_EMA( 0, endIdx, history->close, test->optInTimePeriod,
+                     outBegIdx, outNBElement, outReal );
+   case TA_STREAM_RSI:
+      return TA_RSI( 0, endIdx, history->close, test->optInTimePeriod,
+                     outBegIdx, outNBElement, outReal );
+   case TA_STREAM_ATR:
+      return TA_ATR( 0, endIdx, history->high, history->low, history->close,
+                     test->optInTimePeriod, outBegIdx, outNBElement, outReal );
+   case TA_STREAM_ADX:
+      return TA_ADX( 0, endIdx, history->high, history->low, history->close,
+                     test->optInTimePeriod, outBegIdx, outNBElement, outReal );
+   case TA_STREAM_KAMA:
+      return TA_KAMA( 0, endIdx, history->close, test->optInTimePeriod,
+                      outBegIdx, outNBElement, outReal );
+   case TA_STREAM_MAMA:
+      return TA_MAMA( 0, endIdx, history->close, TA_REAL_DEFAULT, TA_REAL_DEFAULT,
+                      outBegIdx, outNBElement, outReal, gBuffer[0].out1 );
+   case TA_STREAM_FAMA:
+      return TA_MAMA( 0, endIdx, history->close, TA_REAL_DEFAULT, TA_REAL_DEFAULT,
+                      outBegIdx, outNBElement, gBuffer[0].out1, outReal );
+   default:
+      return TA_BAD_PARAM;
+   }
+}
+
+static void makeBar( const TA_History *history, int idx, TA_Bar *bar )
+{
+   bar->timestamp = (Int64)idx*BAR_PERIOD;
+   bar->open      = history->open[idx];
+   bar->high      = history->high[idx];
+   bar->low       = history->low[idx];
+   bar->close     = history->close[idx];
+   bar->volume    = history->volume[idx];
+}
+
+/* Split each bar of the history in ticks and verify that the
+ * resampler rebuild the same bars, and that its states give the
+ * same values as the batch function.
+ */
+static ErrorNumber testResampler( const TA_History *history )
+{
+   TA_Tick ticks[TICK_PER_BAR];
+   TA_StreamState state;
+   TA_Timeframe timeframe[2];
+   TA_Resampler *resampler;
+   TA_ResamplerTestData data;
+   TA_RetCode retCode;
+   UInt64 nbDropped;
+   double outReal;
+   int outNBElement, outBegIdx, nbBatch, i;
+
+   retCode = TA_EMA( 0, history->nbBars-1, history->close, 10,
+                     &outBegIdx, &nbBatch, gBuffer[1].out0 );
+   if( retCode != TA_SUCCESS )
+      return TA_STREAM_TST_BATCH_FAIL;
+
+   retCode = TA_StreamInit( &state, TA_STREAM_EMA, 10 );
+   if( retCode != TA_SUCCESS )
+      return TA_STREAM_TST_INIT_FAIL;
+
+   /* Same bars as the history, plus bars twice as long. */
+   memset( timeframe, 0, sizeof(timeframe) );
+   timeframe[0].period       = BAR_PERIOD;
+   timeframe[0].states       = &state;
+   timeframe[0].nbStates     = 1;
+   timeframe[0].outReal      = &outReal;
+   timeframe[0].outNBElement = &outNBElement;
+   timeframe[1].period       = BAR_PERIOD*2;
+
+   data.history     = history;
+   data.nbBars      = 0;
+   data.nbBadBars   = 0;
+   data.nbBadValues = 0;
+
+   retCode = TA_ResamplerAlloc( timeframe, 2, onBar, &data, &resampler );
+   if( retCode != TA_SUCCESS )
+   {
+      TA_StreamFree( &state );
+      return TA_STREAM_TST_RESAMPLER_FAIL;
+   }
+
+   for( i=0; (i < (int)history->nbBars) && (retCode == TA_SUCCESS); i++ )
+   {
+      ticks[0].timestamp = (Int64)i*BAR_PERIOD;
+      ticks[0].price     = history->open[i];
+      ticks[0].volume    = history->volume[i];
+      ticks[1].timestamp = ticks[0].timestamp+10;
+      ticks[1].price     = history->high[i];
+      ticks[1].volume    = 0.0;
+      ticks[2].timestamp = ticks[0].timestamp+20;
+      ticks[2].price     = history->low[i];
+      ticks[2].volume    = 0.0;
+      ticks[3].timestamp = ticks[0].timestamp+59;
+      ticks[3].price     = history->close[i];
+      ticks[3].volume    = 0.0;
+      retCode = TA_ResamplerAddTicks( resampler, ticks, TICK_PER_BAR );
+
+      /* A late tick must be ignored. */
+      if( (retCode == TA_SUCCESS) && (i == 10) )
+      {
+         ticks[0].timestamp -= 1;
+         ticks[0].price      = 0.0;
+         retCode = TA_ResamplerAddTicks( resampler, ticks, 1 );
+      }
+   }
+
+   if( retCode == TA_SUCCESS )
+      retCode = TA_ResamplerFlush( resampler );
+
+   nbDropped = TA_ResamplerNbDropped( resampler );
+
+   TA_ResamplerFree( resampler );
+   TA_StreamFree( &state );
+
+   if( (retCode != TA_SUCCESS) || (nbDropped != 1) )
+      return TA_STREAM_TST_RESAMPLER_FAIL;
+
+   if( (data.nbBars != (int)history->nbBars) || data.nbBadBars )
+      return TA_STREAM_TST_BAD_BAR;
+
+   if( data.nbBadValues )
+      return TA_STREAM_TST_VALUE;
+
+   return TA_TEST_PASS;
+}
+
+static void onBar( void *opaqueData, int timeframeIdx,
+                   const TA_Timeframe *timeframe, const TA_Bar *bar )
+{
+   TA_ResamplerTestData *data;
+   const TA_History *history;
+   int idx;
+
+   data = (TA_ResamplerTestData *)opaqueData;
+   history = data->history;
+
+   if( timeframeIdx == 1 )
+   {
+      /* Combine two bars of the history. */
+      idx = (int)(bar->timestamp/BAR_PERIOD);
+      if( (bar->timestamp % (BAR_PERIOD*2)) || (bar->open != history->open[idx]) ||
+          ((idx+1 < (int)history->nbBars) && (bar->close != history->close[idx+1])) )
+         data->nbBadBars++;
+      return;
+   }
+
+   idx = data->nbBars++;
+   if( (idx >= (int)history->nbBars) ||
+       (bar->timestamp != (Int64)idx*BAR_PERIOD) ||
+       (bar->open   != history->open[idx])  || (bar->high   != history->high[idx]) ||
+       (bar->low    != history->low[idx])   || (bar->close  != history->close[idx]) ||
+       (bar->volume != history->volume[idx]) )
+   {
+      data->nbBadBars++;
+      return;
+   }
+
+   /* EMA(10) lookback is 9. */
+   if( timeframe->outNBElement[0] != (idx >= 9? 1 : 0) )
+      data->nbBadValues++;
+   else if( timeframe->outNBElement[0] && (timeframe->outReal[0] != gBuffer[1].out0[idx-9]) )
+      data->nbBadValues++;
+}
+
+static ErrorNumber testParseCSV( void )
+{
+   static const char csv[] =
+      "1700000000000,101.25,300\n"
+      "\r\n"
+      "-5,-0.5,1e3\r\n"
+      "1700000000001,1.23456789012345678,0\n"
+      "1700000000002,7,";
+   static const char badCsv[] = "123,abc,1\n";
+   TA_Tick ticks[4];
+   TA_RetCode retCode;
+   size_t nbBytesUsed;
+   int nbTicks;
+
+   retCode = TA_TickParseCSV( csv, sizeof(csv)-1, ticks, 4,
+                              &nbTicks, &nbBytesUsed );
+
+   /* The last line is incomplete. */
+   if( (retCode != TA_SUCCESS) || (nbTicks != 3) ||
+       (nbBytesUsed != sizeof(csv)-1-strlen("1700000000002,7,")) )
+      return TA_STREAM_TST_PARSE_FAIL;
+
+   if( (ticks[0].timestamp != (Int64)1700000000000) ||
+       (ticks[0].price != 101.25) || (ticks[0].volume != 300.0) ||
+       (ticks[1].timestamp != -5) ||
+       (ticks[1].price != -0.5) || (ticks[1].volume != 1000.0) ||
+       (ticks[2].price != 1.23456789012345678) )
+      return TA_STREAM_TST_PARSE_FAIL;
+
+   retCode = TA_TickParseCSV( badCsv, sizeof(badCsv)-1, ticks, 4,
+                              &nbTicks, &nbBytesUsed );
+   if( (retCode != TA_BAD_FILE_FORMAT) || (nbTicks != 0) || (nbBytesUsed != 0) )
+      return TA_STREAM_TST_PARSE_FAIL;
+
+   return TA_TEST_PASS;
+}
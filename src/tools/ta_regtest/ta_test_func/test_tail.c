@@ -0,0 +1,415 @@
+/* Description:
+ *     Test the tail mode of the registry (TA_FuncTail). For every
+ *     function, the last values are compared with the same bars of
+ *     a call on all the history.
+ *
+ *     The functions using an unstable period must be identical. With
+ *     a bounded warm-up, the reference is the call on the history
+ *     starting at the first bar of the warm-up. The functions on a
+ *     fixed window start their running sums at another bar, they must
+ *     be equal within the rounding. The functions depending of all
+ *     the history are not supported.
+ *
+ *     The tests are repeated on a copy of the history ending with a
+ *     flat run (the directional movement and the true range decrease
+ *     to zero, DX repeats its last value).
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "ta_test_priv.h"
+#include "ta_test_func.h"
+#include "ta_utility.h"
+#include "ta_registry.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+#define MAX_OPTIN   16
+#define MAX_OUTPUT  8
+#define MAX_INPUTS  8
+#define FLAT_BARS   150
+
+typedef struct
+{
+   int endIdx;  /* From the last bar, 0 is the last one. */
+   int nbTail;
+   TA_MAType maType;
+   TA_Compatibility compatibility;
+   int unstablePeriod;
+   int maxWarmUp;
+} TA_Test;
+
+/**** Local functions declarations.    ****/
+static ErrorNumber do_test( const TA_FuncDef *func, const TA_Test *test,
+                            const TA_History *history );
+static int isExact( const TA_FuncDef *func, const TA_Test *test );
+static int isHistory( const TA_FuncDef *func, TA_MAType maType, TA_Compatibility compatibility );
+static void setOptIn( const TA_FuncDef *func, TA_MAType maType, double *optIn );
+static void setInputs( const TA_FuncDef *func, const TA_History *history,
+                       const double **inputs );
+static void makeFlat( const TA_History *history, TA_History *flat );
+
+/**** Local variables definitions.     ****/
+static TA_Test tableTest[] =
+{
+   {   0,   1, TA_MAType_SMA,  TA_COMPATIBILITY_DEFAULT,   0, TA_TAIL_ALL_HISTORY },
+   {   0,   3, TA_MAType_SMA,  TA_COMPATIBILITY_DEFAULT,   0, TA_TAIL_ALL_HISTORY },
+   {  50,   3, TA_MAType_SMA,  TA_COMPATIBILITY_DEFAULT,   0, TA_TAIL_ALL_HISTORY },
+   {   0,  20, TA_MAType_WMA,  TA_COMPATIBILITY_DEFAULT,   0, TA_TAIL_ALL_HISTORY },
+   {   0,   1, TA_MAType_SMA,  TA_COMPATIBILITY_DEFAULT,   5, TA_TAIL_ALL_HISTORY },
+   {   0,   3, TA_MAType_SMA,  TA_COMPATIBILITY_METASTOCK, 0, TA_TAIL_ALL_HISTORY },
+   {  10,   3, TA_MAType_SMA,  TA_COMPATIBILITY_METASTOCK, 5, TA_TAIL_ALL_HISTORY },
+   {   0,   3, TA_MAType_EMA,  TA_COMPATIBILITY_DEFAULT,   0, TA_TAIL_ALL_HISTORY },
+   {   0,   3, TA_MAType_EMA,  TA_COMPATIBILITY_METASTOCK, 5, TA_TAIL_ALL_HISTORY },
+   {   0,   2, TA_MAType_DEMA, TA_COMPATIBILITY_DEFAULT,   0, TA_TAIL_ALL_HISTORY },
+   {   0,   2, TA_MAType_KAMA, TA_COMPATIBILITY_DEFAULT,   3, TA_TAIL_ALL_HISTORY },
+   {   0,   2, TA_MAType_MAMA, TA_COMPATIBILITY_DEFAULT,   0, TA_TAIL_ALL_HISTORY },
+   {   0,   2, TA_MAType_T3,   TA_COMPATIBILITY_DEFAULT,   0, TA_TAIL_ALL_HISTORY },
+   /* Bounded warm-up (at most the lookback for the first one). */
+   {   0,   1, TA_MAType_SMA,  TA_COMPATIBILITY_DEFAULT,   0,   0 },
+   {   0,   3, TA_MAType_SMA,  TA_COMPATIBILITY_DEFAULT,   0,  40 },
+   {  10,   3, TA_MAType_EMA,  TA_COMPATIBILITY_METASTOCK, 5, 100 },
+   {   0,   2, TA_MAType_KAMA, TA_COMPATIBILITY_DEFAULT,   3,  60 },
+   /* The tail starts before the first output. */
+   {   0, 300, TA_MAType_SMA,  TA_COMPATIBILITY_DEFAULT,   0, TA_TAIL_ALL_HISTORY },
+   {   0, 300, TA_MAType_EMA,  TA_COMPATIBILITY_DEFAULT,   0,  10 }
+};
+
+#define NB_TEST (sizeof(tableTest)/sizeof(TA_Test))
+
+/* Each value depends of all the previous bars. */
+static const char *const historyName[] =
+{
+   "AD", "ADOSC", "DEMA", "MACD", "MACDFIX", "OBV", "SAR", "SAREXT", "TEMA", "TRIX", "TrendData"
+};
+
+#define NB_HISTORY (sizeof(historyName)/sizeof(const char *))
+
+static int    tailInteger[MAX_OUTPUT][MAX_NB_TEST_ELEMENT];
+static double tailReal[MAX_OUTPUT][MAX_NB_TEST_ELEMENT];
+static int    refInteger[MAX_OUTPUT][MAX_NB_TEST_ELEMENT];
+static double refReal[MAX_OUTPUT][MAX_NB_TEST_ELEMENT];
+static double flatData[5][MAX_NB_TEST_ELEMENT];
+
+/**** Global functions definitions.   ****/
+ErrorNumber test_func_tail( TA_History *history )
+{
+   ErrorNumber retValue;
+   const TA_FuncDef *func;
+   const double *inputs[MAX_INPUTS];
+   double optIn[MAX_OPTIN];
+   void *outputs[MAX_OUTPUT];
+   TA_History flat;
+   const TA_History *hist;
+   int i, t, h, outBegIdx, outNBElement;
+
+   makeFlat( history, &flat );
+
+   for( h=0; h < 2; h++ )
+   {
+      hist = (h == 0)? history : &flat;
+      for( i=0; i < TA_FuncCount(); i++ )
+      {
+         func = TA_FuncAt( i );
+         for( t=0; t < (int)NB_TEST; t++ )
+         {
+            retValue = do_test( func, &tableTest[t], hist );
+            if( retValue != TA_TEST_PASS )
+            {
+               printf( "%s Failed TA_%s Test #%d%s (Code=%d)\n", __FILE__, func->name, t,
+                       (h == 0)? "" : " (flat run)", retValue );
+               return retValue;
+            }
+         }
+      }
+   }
+
+   /* Bad parameters. */
+   func = TA_FuncFind( "EMA" );
+   setOptIn( func, TA_MAType_SMA, optIn );
+   setInputs( func, history, inputs );
+   outputs[0] = tailReal[0];
+   if( (TA_FuncTail( NULL, 100, 1, -1, inputs, optIn, &outBegIdx, &outNBElement, outputs ) != TA_BAD_PARAM) ||
+       (TA_FuncTail( func, 100, 0, -1, inputs, optIn, &outBegIdx, &outNBElement, outputs ) != TA_BAD_PARAM) ||
+       (TA_FuncTail( func, -1, 1, -1, inputs, optIn, &outBegIdx, &outNBElement, outputs ) != TA_OUT_OF_RANGE_END_INDEX) ||
+       (TA_FuncTailMode( NULL, optIn ) != TA_TAIL_HISTORY) )
+      return TA_TAIL_TST_BAD_PARAM;
+
+   /* All test succeed. */
+   return TA_TEST_PASS;
+}
+
+/**** Local functions definitions.     ****/
+static ErrorNumber do_test( const TA_FuncDef *func, const TA_Test *test,
+                            const TA_History *history )
+{
+   TA_RetCode retCode;
+   TA_TailMode mode;
+   ErrorNumber errNb;
+   const double *inputs[MAX_INPUTS];
+   const double *refInputs[MAX_INPUTS];
+   double optIn[MAX_OPTIN];
+   void *outputs[MAX_OUTPUT];
+   void *refOutputs[MAX_OUTPUT];
+   int i, j, id, exact, endIdx, startIdx, lookback, warmUp, from, skip = 0;
+   int outBegIdx, outNBElement, refBegIdx, refNBElement;
+   double a, b;
+
+   endIdx = history->nbBars-1-test->endIdx;
+   exact  = isExact( func, test );
+   setOptIn( func, test->maType, optIn );
+   setInputs( func, history, inputs );
+
+   for( i=0; i < func->nbOutput; i++ )
+   {
+      outputs[i]    = (func->outputs[i].type == TA_OUTPUT_INTEGER)? (void *)tailInteger[i] : (void *)tailReal[i];
+      refOutputs[i] = (func->outputs[i].type == TA_OUTPUT_INTEGER)? (void *)refInteger[i] : (void *)refReal[i];
+   }
+
+   TA_SetCompatibility( test->compatibility );
+   TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, test->unstablePeriod );
+
+   errNb = TA_TEST_PASS;
+   mode  = TA_FuncTailMode( func, optIn );
+   if( (mode == TA_TAIL_HISTORY) != isHistory( func, test->maType, test->compatibility ) )
+   {
+      printf( "Fail: tail mode %d\n", mode );
+      errNb = TA_TAIL_TST_MODE;
+   }
+
+   /* The history starts at the first bar of the warm-up. */
+   lookback = func->lookback( optIn );
+   startIdx = endIdx-test->nbTail+1;
+   from = 0;
+   if( (mode == TA_TAIL_UNSTABLE) && (test->maxWarmUp >= 0) && (startIdx > lookback) )
+   {
+      warmUp = max( test->maxWarmUp, lookback );
+      if( warmUp < startIdx )
+         from = startIdx-warmUp;
+   }
+   for( i=0; i < func->nbInput; i++ )
+      refInputs[i] = inputs[i]+from;
+
+   retCode = func->call( 0, endIdx-from, refInputs, optIn, &refBegIdx, &refNBElement, refOutputs );
+   refBegIdx += from;
+   if( retCode == TA_SUCCESS )
+      retCode = TA_FuncTail( func, endIdx, test->nbTail, test->maxWarmUp, inputs, optIn,
+                             &outBegIdx, &outNBElement, outputs );
+   if( mode == TA_TAIL_HISTORY )
+   {
+      if( retCode != TA_NOT_SUPPORTED )
+      {
+         printf( "Fail: retCode %d for a function on all the history\n", retCode );
+         errNb = TA_TAIL_TST_MODE;
+      }
+      outNBElement = refNBElement = 0;
+   }
+   else if( (retCode != TA_SUCCESS) && (errNb == TA_TEST_PASS) )
+   {
+      printf( "Fail: retCode %d\n", retCode );
+      errNb = TA_TAIL_TST_CALL_FAIL;
+   }
+
+   /* The unstable periods are not modified. */
+   for( id=0; (id < TA_FUNC_UNST_ALL) && (errNb == TA_TEST_PASS); id++ )
+   {
+      if( TA_GetUnstablePeriod( (TA_FuncUnstId)id ) != (unsigned int)test->unstablePeriod )
+         errNb = TA_TAIL_TST_UNSTABLE;
+   }
+
+   /* The last bars of the reference call. */
+   if( errNb == TA_TEST_PASS )
+   {
+      skip = refNBElement-min( refNBElement, test->nbTail );
+      if( (outNBElement != refNBElement-skip) ||
+          (outNBElement && (outBegIdx != refBegIdx+skip)) )
+      {
+         printf( "Fail: begIdx %d/%d nbElement %d/%d\n",
+                 outBegIdx, refBegIdx+skip, outNBElement, refNBElement-skip );
+         errNb = TA_TAIL_TST_BEG_IDX;
+      }
+   }
+
+   for( i=0; (i < func->nbOutput) && (errNb == TA_TEST_PASS); i++ )
+   {
+      if( func->outputs[i].type == TA_OUTPUT_INTEGER )
+      {
+         if( memcmp( tailInteger[i], &refInteger[i][skip], sizeof(int)*outNBElement ) != 0 )
+            errNb = TA_TAIL_TST_VALUE;
+      }
+      else if( exact )
+      {
+         if( memcmp( tailReal[i], &refReal[i][skip], sizeof(double)*outNBElement ) != 0 )
+            errNb = TA_TAIL_TST_VALUE;
+      }
+      else
+      {
+         for( j=0; (j < outNBElement) && (errNb == TA_TEST_PASS); j++ )
+         {
+            a = tailReal[i][j];
+            b = refReal[i][skip+j];
+            if( fabs(a-b) > 1e-8*(1.0+fabs(b)) )
+            {
+               printf( "Fail: output %d bar %d %.17g/%.17g\n", i, outBegIdx+j, a, b );
+               errNb = TA_TAIL_TST_VALUE;
+            }
+         }
+      }
+   }
+
+   TA_SetCompatibility( TA_COMPATIBILITY_DEFAULT );
+   TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, 0 );
+
+   return errNb;
+}
+
+/* The same code path as the reference call: identical results. */
+static int isExact( const TA_FuncDef *func, const TA_Test *test )
+{
+   TA_MAType maType = test->maType;
+
+   if( isHistory( func, maType, test->compatibility ) )
+      return 1;
+
+   if( (maType == TA_MAType_EMA) || (maType == TA_MAType_KAMA) ||
+       (maType == TA_MAType_MAMA) || (maType == TA_MAType_T3) )
+   {
+      if( strcmp( func->name, "MA" ) == 0 )
+         return 1;
+   }
+
+   /* The unstable period of IMI is part of its window. The %D of
+    * STOCHRSI is a moving average of the RSI.
+    */
+   return (func->unstId != TA_FUNC_UNST_NONE) &&
+          (strcmp( func->name, "IMI" ) != 0) &&
+          (strcmp( func->name, "STOCHRSI" ) != 0);
+}
+
+/* No bounded warm-up: a recursion without an unstable period, or a
+ * moving average other than SMA, WMA and TRIMA inside the function.
+ * TA_MA alone uses the unstable period of EMA, KAMA, MAMA and T3,
+ * except for the EMA seeded by the first bar (METASTOCK).
+ */
+static int isHistory( const TA_FuncDef *func, TA_MAType maType, TA_Compatibility compatibility )
+{
+   unsigned int i;
+
+   for( i=0; i < NB_HISTORY; i++ )
+   {
+      if( strcmp( func->name, historyName[i] ) == 0 )
+         return 1;
+   }
+
+   if( compatibility == TA_COMPATIBILITY_METASTOCK )
+   {
+      if( (strcmp( func->name, "EMA" ) == 0) ||
+          ((strcmp( func->name, "MA" ) == 0) && (maType == TA_MAType_EMA)) )
+         return 1;
+   }
+
+   if( (maType == TA_MAType_SMA) || (maType == TA_MAType_WMA) || (maType == TA_MAType_TRIMA) )
+      return 0;
+
+   if( (strcmp( func->name, "MA" ) == 0) && (maType != TA_MAType_DEMA) && (maType != TA_MAType_TEMA) )
+      return 0;
+
+   for( i=0; i < (unsigned int)func->nbOptInput; i++ )
+   {
+      if( func->optInputs[i].type == TA_OPTIN_MATYPE )
+         return 1;
+   }
+
+   return 0;
+}
+
+/* A valid value for each optional parameter (as test_registry.c). */
+static void setOptIn( const TA_FuncDef *func, TA_MAType maType, double *optIn )
+{
+   const TA_OptInputDef *def;
+   int i;
+
+   for( i=0; i < func->nbOptInput; i++ )
+   {
+      def = &func->optInputs[i];
+      switch( def->type )
+      {
+      case TA_OPTIN_MATYPE:
+         optIn[i] = maType;
+         break;
+      case TA_OPTIN_INTEGER:
+         optIn[i] = max( def->min, min( def->max, 5 ) );
+         break;
+      default:
+         if( (def->min > TA_REAL_MIN) && (def->max < TA_REAL_MAX) )
+            optIn[i] = (def->min+def->max)/2.0;
+         else
+            optIn[i] = max( def->min, min( def->max, 1.0 ) );
+      }
+   }
+}
+
+static void setInputs( const TA_FuncDef *func, const TA_History *history,
+                       const double **inputs )
+{
+   int i;
+
+   for( i=0; i < func->nbInput; i++ )
+   {
+      switch( func->inputs[i].type )
+      {
+      case TA_INPUT_OPEN:   inputs[i] = history->open;   break;
+      case TA_INPUT_HIGH:   inputs[i] = history->high;   break;
+      case TA_INPUT_LOW:    inputs[i] = history->low;    break;
+      case TA_INPUT_VOLUME: inputs[i] = history->volume; break;
+      case TA_INPUT_CLOSE:  inputs[i] = history->close;  break;
+      default:
+         inputs[i] = (i == 0)? history->close : history->open;
+      }
+   }
+}
+
+/* The last FLAT_BARS bars are all at the price of the bar before. */
+static void makeFlat( const TA_History *history, TA_History *flat )
+{
+   double *src[5];
+   unsigned int i, j, first;
+
+   src[0] = history->open;
+   src[1] = history->high;
+   src[2] = history->low;
+   src[3] = history->close;
+   src[4] = history->volume;
+   first  = history->nbBars-FLAT_BARS;
+
+   for( j=0; j < 5; j++ )
+   {
+      for( i=0; i < history->nbBars; i++ )
+      {
+         if( i < first )
+            flatData[j][i] = src[j][i];
+         else if( j == 4 )
+            flatData[j][i] = src[j][first-1];
+         else
+            flatData[j][i] = history->close[first-1];
+      }
+   }
+
+   flat->nbBars = history->nbBars;
+   flat->open   = flatData[0];
+   flat->high   = flatData[1];
+   flat->low    = flatData[2];
+   flat->close  = flatData[3];
+   flat->volume = flatData[4];
+}
@@ -191,6 +191,13 @@ ErrorNumber doRangeTest( RangeTestFunction testFunction,
                          unsigned int nbOutput,
                          unsigned int integerTolerance );
 
+/* Only the fixSize where (fixSize % nbSlice) == slice are tested
+ * by doRangeTest. Allows to split the range tests of a function
+ * between many ta_regtest processes (see --jobs). By default, all
+ * fixSize are tested (slice 0 of 1).
+ */
+void setRangeSlice( int slice, int nbSlice );
+
 /* Print out info about a retCode */
 void printRetCode( TA_RetCode retCode );
 
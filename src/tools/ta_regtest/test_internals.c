@@ -7,15 +7,18 @@
 
 /**** Headers ****/
 #include <stdio.h>
+#include <stddef.h>
 #include <string.h>
 
 #include "ta_common.h"
 #include "ta_memory.h"
+#include "ta_columnar.h"
 
 #include "ta_test_priv.h"
 
 /**** Local functions declarations.    ****/
 static ErrorNumber testCircularBuffer( void );
+static ErrorNumber testColumnarFile( void );
 
 static TA_RetCode circBufferFillFrom0ToSize( int size, int *buffer );
 
@@ -33,6 +36,13 @@ ErrorNumber test_internals( void )
       return retValue;
    }
 
+   retValue = testColumnarFile();
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "\nFailed: Columnar file tests (%d)\n", retValue );
+      return retValue;
+   }
+
    return TA_TEST_PASS; /* Success. */
 }
 
@@ -158,6 +168,128 @@ static ErrorNumber testCircularBuffer( void )
    return TA_TEST_PASS; /* Success. */
 }
 
+/* Write two series in a columnar file, map it back and verify
+ * that the columns are identical and properly aligned. Then a
+ * column offset wrapping around with the size of the column must
+ * be rejected.
+ */
+static ErrorNumber testColumnarFile( void )
+{
+   #define COLFILE_NAME "ta_regtest_col.tmp"
+   #define COLFILE_NB_BARS 1001
+   double close[COLFILE_NB_BARS];
+   Int64 timestamp[COLFILE_NB_BARS];
+   TA_ColWriter *writer;
+   TA_ColFile *file;
+   TA_ColSeries series;
+   TA_ColFileHeader header;
+   TA_RetCode retCode;
+   ErrorNumber retValue;
+   FILE *out;
+   UInt64 offset;
+   int i;
+
+   for( i=0; i < COLFILE_NB_BARS; i++ )
+   {
+      close[i] = 100.0 + (double)i/7.0;
+      timestamp[i] = (Int64)1000000000 + i*60;
+   }
+
+   retCode = TA_ColWriterOpen( COLFILE_NAME, &writer );
+   if( retCode != TA_SUCCESS )
+      return TA_INTERNAL_COLFILE_WRITE_FAIL;
+
+   /* First series has an odd number of bars with only the close,
+    * so the second one must be realigned.
+    */
+   retCode = TA_ColWriterAddSeries( writer, "SYM1", 3, NULL, NULL, NULL,
+                                    close, NULL, NULL );
+   if( retCode == TA_SUCCESS )
+      retCode = TA_ColWriterAddSeries( writer, "SYM2", COLFILE_NB_BARS,
+                                       close, close, close, close, close, timestamp );
+   if( retCode != TA_SUCCESS )
+   {
+      TA_ColWriterClose( writer );
+      remove( COLFILE_NAME );
+      return TA_INTERNAL_COLFILE_WRITE_FAIL;
+   }
+
+   retCode = TA_ColWriterClose( writer );
+   if( retCode != TA_SUCCESS )
+   {
+      remove( COLFILE_NAME );
+      return TA_INTERNAL_COLFILE_WRITE_FAIL;
+   }
+
+   retCode = TA_ColFileOpen( COLFILE_NAME, &file );
+   if( retCode != TA_SUCCESS )
+   {
+      remove( COLFILE_NAME );
+      return TA_INTERNAL_COLFILE_OPEN_FAIL;
+   }
+
+   retValue = TA_TEST_PASS;
+
+   if( TA_ColFileNbSymbols( file ) != 2 )
+      retValue = TA_INTERNAL_COLFILE_BAD_CONTENT;
+
+   if( retValue == TA_TEST_PASS )
+   {
+      retCode = TA_ColFileFindSeries( file, "SYM1", &series );
+      if( (retCode != TA_SUCCESS) || (series.nbBars != 3) ||
+          series.open || series.timestamp || !series.close ||
+          (memcmp( series.close, close, sizeof(double)*3 ) != 0) )
+         retValue = TA_INTERNAL_COLFILE_BAD_CONTENT;
+   }
+
+   if( retValue == TA_TEST_PASS )
+   {
+      retCode = TA_ColFileFindSeries( file, "SYM2", &series );
+      if( (retCode != TA_SUCCESS) || (series.nbBars != COLFILE_NB_BARS) ||
+          !series.open || !series.volume || !series.timestamp ||
+          (memcmp( series.close, close, sizeof(close) ) != 0) ||
+          (memcmp( series.timestamp, timestamp, sizeof(timestamp) ) != 0) )
+         retValue = TA_INTERNAL_COLFILE_BAD_CONTENT;
+      else if( (((size_t)series.open) % TA_COL_ALIGNMENT) ||
+               (((size_t)series.close) % TA_COL_ALIGNMENT) ||
+               (((size_t)series.timestamp) % TA_COL_ALIGNMENT) )
+         retValue = TA_INTERNAL_COLFILE_BAD_ALIGNMENT;
+   }
+
+   if( (retValue == TA_TEST_PASS) &&
+       (TA_ColFileFindSeries( file, "SYM3", &series ) == TA_SUCCESS) )
+      retValue = TA_INTERNAL_COLFILE_BAD_CONTENT;
+
+   TA_ColFileClose( file );
+
+   /* Close column of SYM2, 64 bytes under 2^64. */
+   if( retValue == TA_TEST_PASS )
+   {
+      out = fopen( COLFILE_NAME, "r+b" );
+      offset = ~(UInt64)(TA_COL_ALIGNMENT-1);
+      if( !out ||
+          (fread( &header, sizeof(header), 1, out ) != 1) ||
+          fseek( out, (long)(header.symbolTableOffset+sizeof(TA_ColSymbolEntry)+
+                             offsetof(TA_ColSymbolEntry,columnOffset[TA_COL_CLOSE])), SEEK_SET ) ||
+          (fwrite( &offset, sizeof(offset), 1, out ) != 1) )
+         retValue = TA_INTERNAL_COLFILE_WRITE_FAIL;
+      if( out )
+         fclose( out );
+   }
+
+   if( (retValue == TA_TEST_PASS) &&
+       (TA_ColFileOpen( COLFILE_NAME, &file ) != TA_BAD_FILE_FORMAT) )
+   {
+      if( file )
+         TA_ColFileClose( file );
+      retValue = TA_INTERNAL_COLFILE_BAD_OFFSET;
+   }
+
+   remove( COLFILE_NAME );
+
+   return retValue;
+}
+
 /* This function is suppose to fill the buffer
  * with values going from 0 to 'size'.
  * The filling is done using the CIRCBUF macros.
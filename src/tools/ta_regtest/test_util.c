@@ -51,6 +51,10 @@ double memoryGuard2 = RESV_PATTERN_MEMGUARD_2; /* Magic number to detect problem
 
 TestBuffer gBuffer[5]; /* See initGlobalBuffer. */
 
+/* Slice of the fixSize tested by doRangeTest (see setRangeSlice). */
+static int rangeSlice   = 0;
+static int nbRangeSlice = 1;
+
 /**** Local functions declarations.    ****/
 static ErrorNumber doRangeTestFixSize( RangeTestFunction testFunction,
                                        void *opaqueData,
@@ -447,6 +451,12 @@ ErrorNumber doRangeTest( RangeTestFunction testFunction,
    return TA_TEST_PASS;
 }
 
+void setRangeSlice( int slice, int nbSlice )
+{
+   rangeSlice   = slice;
+   nbRangeSlice = nbSlice;
+}
+
 void printRetCode( TA_RetCode retCode )
 {
    TA_RetCodeInfo retCodeInfo;
@@ -542,6 +552,10 @@ static ErrorNumber doRangeTestForOneOutput( RangeTestFunction testFunction,
     */
    for ( fixSize=1; fixSize <= MAX_RANGE_SIZE; fixSize++ )
    {
+      /* Another process tests this fixSize. */
+      if ( (fixSize % nbRangeSlice) != rangeSlice )
+         continue;
+
       /* When a function has an unstable period, verify some
        * unstable period between 0 and MAX_RANGE_SIZE.
        */